@@ -0,0 +1,148 @@
+#ifndef D3D12_DYNAMIC_VERTEX_BUFFER_H
+#define D3D12_DYNAMIC_VERTEX_BUFFER_H
+
+#include <d3d12.h>
+#include <vector>
+#include "Graphics/Buffers/DynamicVertexBuffer.h"
+#include "private_inc/D3D12/D3D12_Core.h"
+#include "private_inc/DynamicBufferRing.h"
+
+/// <summary>
+/// Vertex buffer with a version per frame in flight, all stored in 1 persistently mapped upload buffer
+/// </summary>
+class D3D12_DynamicVertexBuffer : public DynamicVertexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a dynamic vertex buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num_frames">
+    /// number of versions of the buffer in the ring
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 entry
+    /// </param>
+    /// <param name="data">
+    /// initial data for every version of the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_DynamicVertexBuffer* Create(GraphicsCore& graphics, UINT num_frames, UINT num, UINT stride, const void* data);
+
+    ~D3D12_DynamicVertexBuffer();
+
+    /// <summary>
+    /// Switches to the version of the buffer for the next frame, waiting for the GPU if it is still using it, and
+    /// brings it up to date with everything uploaded while older frames were using it
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void NextFrame();
+
+    /// <summary>
+    /// Updates part of the buffer for the current frame
+    /// </summary>
+    /// <param name="buffer_start_index">
+    /// byte offset in the buffer to start writing data to
+    /// </param>
+    /// <param name="data">
+    /// data to write to the buffer
+    /// </param>
+    /// <param name="num_bytes">
+    /// number of bytes to write
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void Upload(UINT buffer_start_index, const void* data, UINT num_bytes);
+
+    /// <summary>
+    /// Retrieves the number of versions of the buffer in the ring
+    /// </summary>
+    /// <returns>
+    /// number of frames that can be in flight at once
+    /// </returns>
+    UINT GetNumFrames() const;
+
+  private:
+    // disabled
+    D3D12_DynamicVertexBuffer();
+    D3D12_DynamicVertexBuffer(const D3D12_DynamicVertexBuffer& cpy);
+    D3D12_DynamicVertexBuffer& operator=(const D3D12_DynamicVertexBuffer& cpy);
+
+    /// <summary>
+    /// Creates a dynamic vertex buffer
+    /// </summary>
+    /// <param name="core">
+    /// core graphics interface, whose fence tells when the GPU is done with a version
+    /// </param>
+    /// <param name="num_frames">
+    /// number of versions of the buffer in the ring
+    /// </param>
+    /// <param name="version_size">
+    /// number of bytes between the start of consecutive versions in the ring
+    /// </param>
+    /// <param name="buffer">
+    /// upload buffer holding the ring
+    /// </param>
+    /// <param name="view">
+    /// view of the first version of the buffer
+    /// </param>
+    /// <param name="mapped">
+    /// CPU address of the mapped upload buffer
+    /// </param>
+    /// <param name="data">
+    /// initial data for the buffer
+    /// </param>
+    D3D12_DynamicVertexBuffer(D3D12_Core& core, UINT num_frames, UINT version_size, ID3D12Resource* buffer, const VertexBufferView& view,
+      UINT8* mapped, const void* data);
+
+    /// <summary>
+    /// core graphics interface
+    /// </summary>
+    D3D12_Core& m_core;
+
+    /// <summary>
+    /// number of bytes between the start of consecutive versions in the ring
+    /// </summary>
+    UINT m_version_size;
+
+    /// <summary>
+    /// which version the current frame uses, which versions the GPU may still be reading, and the out of date range of
+    /// each version
+    /// </summary>
+    DynamicBufferRing m_versions;
+
+    /// <summary>
+    /// upload buffer holding the ring
+    /// </summary>
+    ID3D12Resource* m_buffer;
+
+    /// <summary>
+    /// CPU address of the mapped upload buffer.  Only ever written to, since it is write-combined memory
+    /// </summary>
+    UINT8* m_mapped;
+
+    /// <summary>
+    /// GPU address of the first version
+    /// </summary>
+    UINT64 m_base_location;
+
+    /// <summary>
+    /// CPU copy of the up to date contents of the buffer, which versions are brought up to date from
+    /// </summary>
+    std::vector<UINT8> m_shadow;
+};
+
+#endif /* D3D12_DYNAMIC_VERTEX_BUFFER_H */
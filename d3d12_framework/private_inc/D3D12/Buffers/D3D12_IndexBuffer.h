@@ -3,6 +3,7 @@
 
 #include <d3d12.h>
 #include "public_inc/Graphics/GraphicsCore.h"
+#include "public_inc/Graphics/Buffers/IndexBufferView.h"
 
 namespace D3D12_IndexBuffer
 {
@@ -22,18 +23,18 @@ namespace D3D12_IndexBuffer
   /// number of entries in the buffer
   /// </param>
   /// <param name="data">
-  /// initial data for the vertex buffer
+  /// initial data for the index buffer
   /// </param>
   /// <param name="buffer">
-  /// output parameter for where to put the created vertex buffer
+  /// output parameter for where to put the created index buffer
   /// </param>
   /// <param name="view">
-  /// output parameter for where to put the created vertex buffer view
+  /// output parameter for where to put the created index buffer view
   /// </param>
   /// <exception cref="FrameworkException">
   /// Thrown when an error is encountered
   /// </exception>
-  void CreateBuffer(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, const void* data, ID3D12Resource*& buffer, D3D12_INDEX_BUFFER_VIEW& view);
+  void CreateBuffer(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, const void* data, ID3D12Resource*& buffer, IndexBufferView& view);
 
   /// <summary>
   /// Creates an index buffer that is only accessible to the GPU
@@ -51,15 +52,15 @@ namespace D3D12_IndexBuffer
   /// number of entries in the buffer
   /// </param>
   /// <param name="buffer">
-  /// output parameter for where to put the created vertex buffer
+  /// output parameter for where to put the created index buffer
   /// </param>
   /// <param name="view">
-  /// output parameter for where to put the created vertex buffer view
+  /// output parameter for where to put the created index buffer view
   /// </param>
   /// <exception cref="FrameworkException">
   /// Thrown when an error is encountered
   /// </exception>
-  void CreateBufferGPU(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, D3D12_INDEX_BUFFER_VIEW& view);
+  void CreateBufferGPU(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, IndexBufferView& view);
 
   /// <summary>
   /// Preps the command list for uploading the contents of the index buffer to the specified GPU-only accessible index buffer.  The command list must execute followed by a fence for the transfer to be
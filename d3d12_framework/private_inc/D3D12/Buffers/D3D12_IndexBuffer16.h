@@ -32,14 +32,6 @@ class D3D12_IndexBuffer16 : public IndexBuffer16
     
     ~D3D12_IndexBuffer16();
 
-    /// <summary>
-    /// Retrieves the number of indices in the buffer
-    /// </summary>
-    /// <returns>
-    /// number of indices
-    /// </returns>
-    UINT GetNumIndices() const;
-
     /// <summary>
     /// Preps the command list for uploading the contents of the index buffer to the specified GPU-only accessible index buffer.  The command list must execute followed by a fence for the transfer to be
     /// completed.
@@ -57,14 +49,6 @@ class D3D12_IndexBuffer16 : public IndexBuffer16
     /// Thrown when an error is encountered
     /// </exception>
     void PrepUpload(GraphicsCore& graphics, CommandList& command_list, const IndexBufferGPU16& buffer);
-
-    /// <summary>
-    /// Retrieves the D3D12 index buffer
-    /// </summary>
-    /// <returns>
-    /// D3D12 index buffer
-    /// </returns>
-    const D3D12_INDEX_BUFFER_VIEW& GetBuffer() const;
     
   private:
     // disabled
@@ -75,31 +59,18 @@ class D3D12_IndexBuffer16 : public IndexBuffer16
     /// <summary>
     /// Creates an index buffer
     /// </summary>
-    /// <param name="num">
-    /// number of indices in the buffer
-    /// </param>
     /// <param name="buffer">
     /// index buffer
     /// </param>
     /// <param name="view">
     /// index buffer view
     /// </param>
-    D3D12_IndexBuffer16(UINT num, ID3D12Resource* buffer, D3D12_INDEX_BUFFER_VIEW& view);
-
-    /// <summary>
-    /// number of indices in the buffer
-    /// </summary>
-    UINT m_num;
+    D3D12_IndexBuffer16(ID3D12Resource* buffer, const IndexBufferView& view);
 
     /// <summary>
     /// index buffer
     /// </summary>
     ID3D12Resource* m_buffer;
-
-    /// <summary>
-    /// index buffer view, used to provide data to the command list for rendering
-    /// </summary>
-    D3D12_INDEX_BUFFER_VIEW m_view;
 };
 
 #endif /* D3D12_INDEX_BUFFER16_H */
@@ -0,0 +1,76 @@
+#ifndef D3D12_INDEX_BUFFER32_H
+#define D3D12_INDEX_BUFFER32_H
+
+#include <d3d12.h>
+#include "Graphics/Buffers/IndexBuffer32.h"
+
+/// <summary>
+/// Index buffer with 32bit entries
+/// </summary>
+class D3D12_IndexBuffer32 : public IndexBuffer32
+{
+  public:
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <param name="data">
+    /// initial data for the index buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the index buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_IndexBuffer32* Create(GraphicsCore& graphics,UINT num, const UINT* data);
+    
+    ~D3D12_IndexBuffer32();
+
+    /// <summary>
+    /// Preps the command list for uploading the contents of the index buffer to the specified GPU-only accessible index buffer.  The command list must execute followed by a fence for the transfer to be
+    /// completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// GPU-only index buffer to upload to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, const IndexBufferGPU32& buffer);
+    
+  private:
+    // disabled
+    D3D12_IndexBuffer32();
+    D3D12_IndexBuffer32(const D3D12_IndexBuffer32& cpy);
+    D3D12_IndexBuffer32& operator=(const D3D12_IndexBuffer32& cpy);
+
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="buffer">
+    /// index buffer
+    /// </param>
+    /// <param name="view">
+    /// index buffer view
+    /// </param>
+    D3D12_IndexBuffer32(ID3D12Resource* buffer, const IndexBufferView& view);
+
+    /// <summary>
+    /// index buffer
+    /// </summary>
+    ID3D12Resource* m_buffer;
+};
+
+#endif /* D3D12_INDEX_BUFFER32_H */
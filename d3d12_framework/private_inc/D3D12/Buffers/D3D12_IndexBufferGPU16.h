@@ -29,22 +29,6 @@ class D3D12_IndexBufferGPU16 : public IndexBufferGPU16
     
     ~D3D12_IndexBufferGPU16();
 
-    /// <summary>
-    /// Retrieves the number of indices in the buffer
-    /// </summary>
-    /// <returns>
-    /// number of indices
-    /// </returns>
-    UINT GetNumIndices() const;
-
-    /// <summary>
-    /// Retrieves the D3D12 index buffer
-    /// </summary>
-    /// <returns>
-    /// D3D12 index buffer
-    /// </returns>
-    const D3D12_INDEX_BUFFER_VIEW& GetBuffer() const;
-
     /// <summary>
     /// Retrieves the D3D12 resource
     /// </summary>
@@ -62,31 +46,18 @@ class D3D12_IndexBufferGPU16 : public IndexBufferGPU16
     /// <summary>
     /// Creates an index buffer
     /// </summary>
-    /// <param name="num">
-    /// number of indices in the buffer
-    /// </param>
     /// <param name="buffer">
     /// index buffer
     /// </param>
     /// <param name="view">
     /// index buffer view
     /// </param>
-    D3D12_IndexBufferGPU16(UINT num, ID3D12Resource* buffer, D3D12_INDEX_BUFFER_VIEW& view);
-
-    /// <summary>
-    /// number of indices in the buffer
-    /// </summary>
-    UINT m_num;
+    D3D12_IndexBufferGPU16(ID3D12Resource* buffer, const IndexBufferView& view);
 
     /// <summary>
     /// index buffer
     /// </summary>
     ID3D12Resource* m_buffer;
-
-    /// <summary>
-    /// index buffer view, used to provide data to the command list for rendering
-    /// </summary>
-    D3D12_INDEX_BUFFER_VIEW m_view;
 };
 
 #endif /* D3D12_INDEX_BUFFER_GPU_16_H */
@@ -0,0 +1,63 @@
+#ifndef D3D12_INDEX_BUFFER_GPU_32_H
+#define D3D12_INDEX_BUFFER_GPU_32_H
+
+#include <d3d12.h>
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+
+/// <summary>
+/// Index buffer with 32bit entries
+/// </summary>
+class D3D12_IndexBufferGPU32 : public IndexBufferGPU32
+{
+  public:
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the index buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_IndexBufferGPU32* Create(GraphicsCore& graphics,UINT num);
+    
+    ~D3D12_IndexBufferGPU32();
+
+    /// <summary>
+    /// Retrieves the D3D12 resource
+    /// </summary>
+    /// <returns>
+    /// D3D12 resource for the texture
+    /// </returns>
+    ID3D12Resource* GetResource() const;
+    
+  private:
+    // disabled
+    D3D12_IndexBufferGPU32();
+    D3D12_IndexBufferGPU32(const D3D12_IndexBufferGPU32& cpy);
+    D3D12_IndexBufferGPU32& operator=(const D3D12_IndexBufferGPU32& cpy);
+
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="buffer">
+    /// index buffer
+    /// </param>
+    /// <param name="view">
+    /// index buffer view
+    /// </param>
+    D3D12_IndexBufferGPU32(ID3D12Resource* buffer, const IndexBufferView& view);
+
+    /// <summary>
+    /// index buffer
+    /// </summary>
+    ID3D12Resource* m_buffer;
+};
+
+#endif /* D3D12_INDEX_BUFFER_GPU_32_H */
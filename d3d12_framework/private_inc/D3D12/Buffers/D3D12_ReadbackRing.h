@@ -0,0 +1,180 @@
+#ifndef D3D12_READBACK_RING_H
+#define D3D12_READBACK_RING_H
+
+#include <d3d12.h>
+#include <vector>
+#include "Graphics/Buffers/ReadbackRing.h"
+#include "private_inc/D3D12/Buffers/D3D12_ReadbackBuffer.h"
+#include "private_inc/D3D12/D3D12_Core.h"
+#include "private_inc/FenceSlotRing.h"
+
+/// <summary>
+/// Readback ring with every slot stored in 1 D3D12 readback buffer
+/// </summary>
+class D3D12_ReadbackRing : public ReadbackRing
+{
+  public:
+    /// <summary>
+    /// Creates a readback ring
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num_slots">
+    /// number of readbacks that can be in flight at once
+    /// </param>
+    /// <param name="slot_size">
+    /// largest number of bytes in 1 readback
+    /// </param>
+    /// <returns>
+    /// pointer to the readback ring instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_ReadbackRing* Create(GraphicsCore& graphics, UINT num_slots, UINT slot_size);
+
+    ~D3D12_ReadbackRing();
+
+    /// <summary>
+    /// Adds a copy of part of a structured buffer into the next free slot to the command list
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded
+    /// </param>
+    /// <param name="src">
+    /// buffer to read
+    /// </param>
+    /// <param name="src_offset">
+    /// byte offset in the buffer to start reading from
+    /// </param>
+    /// <param name="num_bytes">
+    /// number of bytes to read
+    /// </param>
+    /// <param name="callback">
+    /// function to call from Poll once the data is available
+    /// </param>
+    /// <returns>
+    /// true  if the copy was added
+    /// false if every slot is in flight
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the range is outside of the buffer or larger than a slot
+    /// </exception>
+    bool PrepReadback(CommandList& command_list, const StructuredBufferGPU& src, UINT src_offset, UINT num_bytes, const Callback& callback);
+
+    /// <summary>
+    /// Adds copies of the filled sizes of stream output buffers into the next free slot to the command list
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded
+    /// </param>
+    /// <param name="so_buffers">
+    /// stream output buffers to determine how many vertices were written to each
+    /// </param>
+    /// <param name="callback">
+    /// function to call from Poll once the counts are available
+    /// </param>
+    /// <returns>
+    /// true  if the copies were added
+    /// false if every slot is in flight
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the filled sizes do not fit in a slot
+    /// </exception>
+    bool PrepNumVerticesWritten(CommandList& command_list, const std::vector<StreamOutputBuffer*>& so_buffers, const NumVerticesCallback& callback);
+
+    /// <summary>
+    /// Signals the fence and tags the readbacks prepared since the last call with it
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void Submit();
+
+    /// <summary>
+    /// Calls the callbacks of the readbacks the GPU has finished and frees their slots
+    /// </summary>
+    /// <returns>
+    /// number of readbacks delivered
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    UINT Poll();
+
+    /// <summary>
+    /// Waits for the GPU to finish every readback and delivers them
+    /// </summary>
+    /// <returns>
+    /// number of readbacks delivered
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    UINT Flush();
+
+    /// <summary>
+    /// Retrieves the number of readbacks that have been prepared but not delivered yet
+    /// </summary>
+    /// <returns>
+    /// number of slots in use
+    /// </returns>
+    UINT GetNumPending() const;
+
+    /// <summary>
+    /// Retrieves the number of slots in the ring
+    /// </summary>
+    /// <returns>
+    /// number of readbacks that can be in flight at once
+    /// </returns>
+    UINT GetNumSlots() const;
+
+    /// <summary>
+    /// Retrieves the size of each slot
+    /// </summary>
+    /// <returns>
+    /// largest number of bytes in 1 readback
+    /// </returns>
+    UINT GetSlotSize() const;
+
+  private:
+    // disabled
+    D3D12_ReadbackRing();
+    D3D12_ReadbackRing(const D3D12_ReadbackRing& cpy);
+    D3D12_ReadbackRing& operator=(const D3D12_ReadbackRing& cpy);
+
+    D3D12_ReadbackRing(D3D12_Core& core, D3D12_ReadbackBuffer* buffer, UINT num_slots, UINT slot_size);
+
+    /// <summary>
+    /// core the fence is signaled and read through
+    /// </summary>
+    D3D12_Core& m_core;
+
+    /// <summary>
+    /// readback buffer holding every slot, 1 after the other
+    /// </summary>
+    D3D12_ReadbackBuffer* m_buffer;
+
+    /// <summary>
+    /// which slots are in flight and the fence value each is waiting for
+    /// </summary>
+    FenceSlotRing m_slots;
+
+    /// <summary>
+    /// number of bytes in each slot
+    /// </summary>
+    UINT m_slot_size;
+
+    /// <summary>
+    /// function to deliver each slot's data to
+    /// </summary>
+    std::vector<Callback> m_callbacks;
+
+    /// <summary>
+    /// number of bytes copied into each slot
+    /// </summary>
+    std::vector<UINT> m_num_bytes;
+};
+
+#endif /* D3D12_READBACK_RING_H */
@@ -0,0 +1,196 @@
+#ifndef D3D12_STRUCTURED_BUFFER_H
+#define D3D12_STRUCTURED_BUFFER_H
+
+#include <d3d12.h>
+#include "Graphics/Buffers/StructuredBuffer.h"
+
+/// <summary>
+/// Structured buffer that is writable by the CPU
+/// </summary>
+class D3D12_StructuredBuffer : public StructuredBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element.  Must be a multiple of 4
+    /// </param>
+    /// <param name="data">
+    /// initial data for the buffer, or NULL to leave the buffer uninitialized
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_StructuredBuffer* Create(GraphicsCore& graphics, UINT num, UINT stride, const void* data);
+
+    /// <summary>
+    /// Creates the committed resource backing a structured buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="heap_type">
+    /// type of heap to create the buffer in
+    /// </param>
+    /// <param name="flags">
+    /// resource flags for the buffer
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element.  Must be a multiple of 4
+    /// </param>
+    /// <returns>
+    /// the created resource, in the generic read state
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static ID3D12Resource* CreateResource(GraphicsCore& graphics, D3D12_HEAP_TYPE heap_type, D3D12_RESOURCE_FLAGS flags, UINT num, UINT stride);
+
+    /// <summary>
+    /// Calculates the GPU address of an element of a structured buffer, for binding to a root descriptor
+    /// </summary>
+    /// <param name="base">
+    /// GPU address of the first element
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element the root descriptor starts at
+    /// </param>
+    /// <returns>
+    /// GPU address of the element
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when element_offset is not within the buffer
+    /// </exception>
+    static D3D12_GPU_VIRTUAL_ADDRESS GetElementAddr(D3D12_GPU_VIRTUAL_ADDRESS base, UINT num, UINT stride, UINT element_offset);
+
+    /// <summary>
+    /// Cleans up the structured buffer
+    /// </summary>
+    ~D3D12_StructuredBuffer();
+
+    /// <summary>
+    /// Retrieves the number of elements in the buffer
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    UINT GetNumElements() const;
+
+    /// <summary>
+    /// Retrieves the size of 1 element in bytes
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 element
+    /// </returns>
+    UINT GetStride() const;
+
+    /// <summary>
+    /// Updates a range of elements in the buffer
+    /// </summary>
+    /// <param name="start_element">
+    /// index of the first element to write
+    /// </param>
+    /// <param name="num_elements">
+    /// number of elements to write
+    /// </param>
+    /// <param name="data">
+    /// data to write.  Must be at least num_elements * GetStride() bytes long
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void Upload(UINT start_element, UINT num_elements, const void* data);
+
+    /// <summary>
+    /// Preps the command list for uploading the contents of the buffer to the specified GPU-only accessible structured
+    /// buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// GPU-only structured buffer to upload to.  Must be the same size as this buffer
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUpload(CommandList& command_list, const StructuredBufferGPU& buffer);
+
+    /// <summary>
+    /// Retrieves the GPU address of an element of the buffer
+    /// </summary>
+    /// <param name="element_offset">
+    /// index of the element
+    /// </param>
+    /// <returns>
+    /// GPU address of the element
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when element_offset is not within the buffer
+    /// </exception>
+    D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddr(UINT element_offset) const;
+
+  private:
+    // disabled
+    D3D12_StructuredBuffer();
+    D3D12_StructuredBuffer(const D3D12_StructuredBuffer& cpy);
+    D3D12_StructuredBuffer& operator=(const D3D12_StructuredBuffer& cpy);
+
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element
+    /// </param>
+    /// <param name="buffer">
+    /// upload heap buffer
+    /// </param>
+    /// <param name="data">
+    /// persistently mapped CPU address of the buffer
+    /// </param>
+    D3D12_StructuredBuffer(UINT num, UINT stride, ID3D12Resource* buffer, UINT8* data);
+
+    /// <summary>
+    /// number of elements in the buffer
+    /// </summary>
+    UINT m_num;
+
+    /// <summary>
+    /// number of bytes in 1 element
+    /// </summary>
+    UINT m_stride;
+
+    /// <summary>
+    /// upload heap buffer
+    /// </summary>
+    ID3D12Resource* m_buffer;
+
+    /// <summary>
+    /// CPU address of the buffer.  Upload heaps can stay mapped for their lifetime, so it is mapped once at creation
+    /// </summary>
+    UINT8* m_data;
+};
+
+#endif /* D3D12_STRUCTURED_BUFFER_H */
@@ -0,0 +1,112 @@
+#ifndef D3D12_STRUCTURED_BUFFER_GPU_H
+#define D3D12_STRUCTURED_BUFFER_GPU_H
+
+#include <d3d12.h>
+#include "Graphics/Buffers/StructuredBufferGPU.h"
+
+/// <summary>
+/// Structured buffer that is only accessible to the GPU
+/// </summary>
+class D3D12_StructuredBufferGPU : public StructuredBufferGPU
+{
+  public:
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element.  Must be a multiple of 4
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_StructuredBufferGPU* Create(GraphicsCore& graphics, UINT num, UINT stride);
+
+    /// <summary>
+    /// Cleans up the structured buffer
+    /// </summary>
+    ~D3D12_StructuredBufferGPU();
+
+    /// <summary>
+    /// Retrieves the number of elements in the buffer
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    UINT GetNumElements() const;
+
+    /// <summary>
+    /// Retrieves the size of 1 element in bytes
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 element
+    /// </returns>
+    UINT GetStride() const;
+
+    /// <summary>
+    /// Retrieves the GPU address of an element of the buffer
+    /// </summary>
+    /// <param name="element_offset">
+    /// index of the element
+    /// </param>
+    /// <returns>
+    /// GPU address of the element
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when element_offset is not within the buffer
+    /// </exception>
+    D3D12_GPU_VIRTUAL_ADDRESS GetGPUAddr(UINT element_offset) const;
+
+    /// <summary>
+    /// Retrieves the D3D12 resource
+    /// </summary>
+    /// <returns>
+    /// D3D12 resource for the structured buffer
+    /// </returns>
+    ID3D12Resource* GetResource() const;
+
+  private:
+    // disabled
+    D3D12_StructuredBufferGPU();
+    D3D12_StructuredBufferGPU(const D3D12_StructuredBufferGPU& cpy);
+    D3D12_StructuredBufferGPU& operator=(const D3D12_StructuredBufferGPU& cpy);
+
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element
+    /// </param>
+    /// <param name="buffer">
+    /// default heap buffer
+    /// </param>
+    D3D12_StructuredBufferGPU(UINT num, UINT stride, ID3D12Resource* buffer);
+
+    /// <summary>
+    /// number of elements in the buffer
+    /// </summary>
+    UINT m_num;
+
+    /// <summary>
+    /// number of bytes in 1 element
+    /// </summary>
+    UINT m_stride;
+
+    /// <summary>
+    /// default heap buffer
+    /// </summary>
+    ID3D12Resource* m_buffer;
+};
+
+#endif /* D3D12_STRUCTURED_BUFFER_GPU_H */
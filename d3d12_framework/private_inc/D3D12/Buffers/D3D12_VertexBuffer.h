@@ -3,6 +3,7 @@
 
 #include <d3d12.h>
 #include "public_inc/Graphics/GraphicsCore.h"
+#include "public_inc/Graphics/Buffers/VertexBufferView.h"
 
 namespace D3D12_VertexBuffer
 {
@@ -30,7 +31,34 @@ namespace D3D12_VertexBuffer
   /// <exception cref="FrameworkException">
   /// Thrown when an error is encountered
   /// </exception>
-  void CreateBuffer(GraphicsCore& graphics, UINT stride, UINT num, const void* data, ID3D12Resource*& buffer, D3D12_VERTEX_BUFFER_VIEW& view);
+  void CreateBuffer(GraphicsCore& graphics, UINT stride, UINT num, const void* data, ID3D12Resource*& buffer, VertexBufferView& view);
+
+  /// <summary>
+  /// Creates a vertex buffer that is writable by the CPU and leaves it mapped for the lifetime of the buffer
+  /// </summary>
+  /// <param name="graphics">
+  /// core graphics interface
+  /// </param>
+  /// <param name="stride">
+  /// size of each entry in bytes
+  /// </param>
+  /// <param name="num">
+  /// number of entries in the buffer
+  /// </param>
+  /// <param name="buffer">
+  /// output parameter for where to put the created vertex buffer
+  /// </param>
+  /// <param name="view">
+  /// output parameter for where to put the created vertex buffer view
+  /// </param>
+  /// <param name="data">
+  /// output parameter for where to put the CPU address of the mapped buffer.  The memory is write-combined, so it
+  /// should only be written to sequentially and never read from
+  /// </param>
+  /// <exception cref="FrameworkException">
+  /// Thrown when an error is encountered
+  /// </exception>
+  void CreateBufferMapped(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, VertexBufferView& view, UINT8*& data);
 
   /// <summary>
   /// Creates a vertex buffer that is only accessible to the GPU
@@ -53,7 +81,7 @@ namespace D3D12_VertexBuffer
   /// <exception cref="FrameworkException">
   /// Thrown when an error is encountered
   /// </exception>
-  void CreateBufferGPU(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, D3D12_VERTEX_BUFFER_VIEW& view);
+  void CreateBufferGPU(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, VertexBufferView& view);
 
   /// <summary>
   /// Preps the command list for uploading the contents of the vertex buffer to the specified GPU-only accessible vertex buffer.  The command list must execute followed by a fence for the transfer to be
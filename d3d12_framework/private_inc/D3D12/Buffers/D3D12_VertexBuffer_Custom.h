@@ -4,8 +4,6 @@
 #include <d3d12.h>
 #include "Graphics/Buffers/VertexBuffer_Custom.h"
 
-class D3D12_VertexBufferArray;
-
 /// <summary>
 /// Vertex buffer that applications define the data of
 /// </summary>
@@ -57,14 +55,6 @@ class D3D12_VertexBuffer_Custom : public VertexBuffer_Custom
     /// </exception>
     void Upload(UINT buffer_start_index, const void* data, UINT num_bytes);
 
-    /// <summary>
-    /// Retrieves the number of entries in the buffer
-    /// </summary>
-    /// <returns>
-    /// number of entries
-    /// </returns>
-    UINT GetNumVertices() const;
-
     /// <summary>
     /// Preps the command list for uploading the contents of the vertex buffer to the specified GPU-only accessible vertex buffer.  The command list must execute followed by a fence for the transfer to be
     /// completed.
@@ -92,34 +82,18 @@ class D3D12_VertexBuffer_Custom : public VertexBuffer_Custom
     /// <summary>
     /// Creates a vertex buffer
     /// </summary>
-    /// <param name="num">
-    /// number of entries in the buffer
-    /// </param>
     /// <param name="buffer">
     /// vertex buffer
     /// </param>
     /// <param name="view">
     /// vertex buffer view
     /// </param>
-    D3D12_VertexBuffer_Custom(UINT num, ID3D12Resource* buffer, const D3D12_VERTEX_BUFFER_VIEW& view);
-
-    /// <summary>
-    /// number of entries in the buffer
-    /// </summary>
-    UINT m_num;
+    D3D12_VertexBuffer_Custom(ID3D12Resource* buffer, const VertexBufferView& view);
 
     /// <summary>
     /// vertex buffer
     /// </summary>
     ID3D12Resource* m_buffer;
-
-    /// <summary>
-    /// vertex buffer view, used to provide data to the command list for rendering
-    /// </summary>
-    D3D12_VERTEX_BUFFER_VIEW m_view;
-
-    // allow D3D12_VertexBufferArray full access to the members since it is an optimization for multiple vertex buffers
-    friend D3D12_VertexBufferArray;
 };
 
 #endif /* D3D12_VERTEX_BUFFER_CUSTOM_H */
@@ -83,6 +83,86 @@ class D3D12_CommandList : public CommandList
     /// </param>
     void SetConstantBuffer(UINT slot, const ConstantBuffer& constant_buffer);
 
+    /// <summary>
+    /// Sets 32-bit constants of a root signature slot that was configured with SetParamAsConstants
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot to set the constants of
+    /// </param>
+    /// <param name="num_32bit_values">
+    /// number of 32-bit values to set
+    /// </param>
+    /// <param name="data">
+    /// values to set
+    /// </param>
+    /// <param name="dest_offset">
+    /// index of the first 32-bit value within the slot to set
+    /// </param>
+    void SetRootConstants(UINT slot, UINT num_32bit_values, const void* data, UINT dest_offset);
+
+    // the override above hides the templated version from the base class
+    using CommandList::SetRootConstants;
+
+    /// <summary>
+    /// Sets a root shader resource view slot to the specified structured buffer
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsShaderResourceView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    void SetShaderResourceView(UINT slot, const StructuredBuffer& buffer, UINT element_offset);
+
+    /// <summary>
+    /// Sets a root shader resource view slot to the specified GPU-only structured buffer
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsShaderResourceView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    void SetShaderResourceView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset);
+
+    /// <summary>
+    /// Sets a root unordered access view slot to the specified GPU-only structured buffer.  The buffer must have been
+    /// made writable with StructuredBufferToUnorderedAccess
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsUnorderedAccessView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    void SetUnorderedAccessView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset);
+
+    /// <summary>
+    /// Makes a GPU-only structured buffer writable through an unordered access view
+    /// </summary>
+    /// <param name="buffer">
+    /// structured buffer
+    /// </param>
+    void StructuredBufferToUnorderedAccess(const StructuredBufferGPU& buffer);
+
+    /// <summary>
+    /// Makes a structured buffer that previously had StructuredBufferToUnorderedAccess called on it readable through
+    /// a shader resource view again
+    /// </summary>
+    /// <param name="buffer">
+    /// structured buffer
+    /// </param>
+    void UnorderedAccessToStructuredBuffer(const StructuredBufferGPU& buffer);
+
     /// <summary>
     /// Sets the root signature descriptor table to use the specified texture as the start of the descriptor table
     /// <remarks>
@@ -469,6 +549,38 @@ class D3D12_CommandList : public CommandList
     /// </param>
     void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, UINT instance_cnt, UINT instance_start_index);
 
+    /// <summary>
+    /// Draws instances of indexed primitives whose indices are relative to a base vertex.  Used to draw meshes that were
+    /// split into chunks of 16bit indices
+    /// </summary>
+    /// <param name="indices_per_instance">
+    /// number of indices for each instance
+    /// </param>
+    /// <param name="index_start_index">
+    /// index in the index buffer to start at
+    /// </param>
+    /// <param name="base_vertex">
+    /// value added to each index before reading from the vertex buffers
+    /// </param>
+    /// <param name="instance_cnt">
+    /// number of instances
+    /// </param>
+    /// <param name="instance_start_index">
+    /// index in the instance buffer to start at
+    /// </param>
+    void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, INT base_vertex, UINT instance_cnt, UINT instance_start_index);
+
+    /// <summary>
+    /// Issues a series of indexed draws
+    /// </summary>
+    /// <param name="draws">
+    /// arguments of each draw
+    /// </param>
+    /// <param name="num_draws">
+    /// number of entries in draws
+    /// </param>
+    void DrawIndexedInstanced(const DrawIndexedArgs* draws, UINT num_draws);
+
     /// <summary>
     /// Draws instances of primitives
     /// </summary>
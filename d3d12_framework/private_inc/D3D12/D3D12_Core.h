@@ -5,6 +5,7 @@
 #include <dxgi1_4.h>
 #include "Graphics/GraphicsCore.h"
 #include "private_inc/D3D12/Buffers/D3D12_BackBuffer.h"
+#include "private_inc/D3D12/D3D12_RootSignatureCache.h"
 
 /// <summary>
 /// Manages the core needed variables to use D3D12
@@ -69,6 +70,25 @@ class D3D12_Core : public GraphicsCore
     /// </summary>
     void WaitOnFence();
 
+    /// <summary>
+    /// Signals the fence for the default command queue without waiting for it
+    /// </summary>
+    /// <returns>
+    /// fence value that indicates every command list executed so far has finished
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    UINT64 SignalFence();
+
+    /// <summary>
+    /// Retrieves the last value the fence for the default command queue has reached.  Does not block
+    /// </summary>
+    /// <returns>
+    /// completed fence value
+    /// </returns>
+    UINT64 GetCompletedFenceValue() const;
+
     /// <summary>
     /// Performs the operations specified in the command list
     /// </summary>
@@ -128,6 +148,29 @@ class D3D12_Core : public GraphicsCore
     /// </exception>
     UINT CheckSupportedMultisampleLevels(GraphicsDataFormat format, UINT sample_count, bool tiled) const;
 
+    /// <summary>
+    /// Adds the serialized root signatures stored in a file to the root signature cache, so root signatures created
+    /// afterwards with a matching config skip serialization.  A missing file is ignored
+    /// </summary>
+    /// <param name="path">
+    /// path to a file written by SaveRootSignatureCache
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file exists but is not a valid cache file
+    /// </exception>
+    void LoadRootSignatureCache(const char* path);
+
+    /// <summary>
+    /// Writes the serialized form of every root signature created so far to a file
+    /// </summary>
+    /// <param name="path">
+    /// path to the file to write
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file could not be written
+    /// </exception>
+    void SaveRootSignatureCache(const char* path) const;
+
     /// <summary>
     /// Retrieves the D3D12 device
     /// </summary>
@@ -135,6 +178,22 @@ class D3D12_Core : public GraphicsCore
     /// D3D12 device
     /// </returns>
     ID3D12Device* GetDevice() const;
+
+    /// <summary>
+    /// Retrieves the default command queue
+    /// </summary>
+    /// <returns>
+    /// D3D12 command queue
+    /// </returns>
+    ID3D12CommandQueue* GetCommandQueue() const;
+
+    /// <summary>
+    /// Retrieves the cache that root signatures are created through
+    /// </summary>
+    /// <returns>
+    /// root signature cache
+    /// </returns>
+    D3D12_RootSignatureCache& GetRootSignatureCache() const;
     
   private:
     D3D12_Core(ID3D12Device* device, ID3D12Fence* fence, HANDLE fence_event, IDXGISwapChain* swap_chain_base, IDXGISwapChain3* swap_chain, ID3D12CommandQueue* command_queue,
@@ -193,6 +252,11 @@ class D3D12_Core : public GraphicsCore
     /// keeps track if in full screen mode or not
     /// </summary>
     bool m_fullscreen;
+
+    /// <summary>
+    /// root signatures created with this device, shared between equivalent configs
+    /// </summary>
+    D3D12_RootSignatureCache* m_root_sig_cache;
 };
 
 #endif /* D3D12_CORE_H */
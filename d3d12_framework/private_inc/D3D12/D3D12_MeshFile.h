@@ -0,0 +1,265 @@
+#ifndef D3D12_MESH_FILE_H
+#define D3D12_MESH_FILE_H
+
+#include "Graphics/Mesh/MeshFile.h"
+#include "private_inc/MeshFileFormat.h"
+
+/// <summary>
+/// Memory mapped binary mesh
+/// </summary>
+class D3D12_MeshFile : public MeshFile
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified mesh file and validates its layout
+    /// </summary>
+    /// <param name="path">
+    /// path to the mesh file to open
+    /// </param>
+    /// <returns>
+    /// pointer to the D3D12_MeshFile instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped or is not a valid mesh file
+    /// </exception>
+    static D3D12_MeshFile* Open(const char* path);
+
+    ~D3D12_MeshFile();
+
+    /// <summary>
+    /// Retrieves the number of vertices in the mesh
+    /// </summary>
+    /// <returns>
+    /// number of vertices
+    /// </returns>
+    UINT GetNumVertices() const;
+
+    /// <summary>
+    /// Retrieves the size of each vertex
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 vertex
+    /// </returns>
+    UINT GetVertexStride() const;
+
+    /// <summary>
+    /// Retrieves the number of elements in each vertex
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    UINT GetNumElements() const;
+
+    /// <summary>
+    /// Retrieves an element of the vertices
+    /// </summary>
+    /// <param name="index">
+    /// index of the element, in input layout order
+    /// </param>
+    /// <returns>
+    /// description of the element
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index is out of range
+    /// </exception>
+    VertexElementDesc GetElement(UINT index) const;
+
+    /// <summary>
+    /// Creates an input layout with the elements of the vertices
+    /// </summary>
+    /// <param name="input_slot">
+    /// input slot the vertex buffer is bound to
+    /// </param>
+    /// <returns>
+    /// pointer to the InputLayout instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    InputLayout* CreateInputLayout(UINT input_slot) const;
+
+    /// <summary>
+    /// Retrieves the number of indices in the mesh
+    /// </summary>
+    /// <returns>
+    /// number of indices
+    /// </returns>
+    UINT GetNumIndices() const;
+
+    /// <summary>
+    /// Retrieves the format of the indices
+    /// </summary>
+    /// <returns>
+    /// R16_UINT or R32_UINT
+    /// </returns>
+    GraphicsDataFormat GetIndexFormat() const;
+
+    /// <summary>
+    /// Retrieves the number of submeshes
+    /// </summary>
+    /// <returns>
+    /// number of submeshes
+    /// </returns>
+    UINT GetNumSubmeshes() const;
+
+    /// <summary>
+    /// Retrieves a submesh
+    /// </summary>
+    /// <param name="index">
+    /// index of the submesh
+    /// </param>
+    /// <returns>
+    /// the submesh
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index is out of range
+    /// </exception>
+    MeshSubmesh GetSubmesh(UINT index) const;
+
+    /// <summary>
+    /// Retrieves the box enclosing the whole mesh
+    /// </summary>
+    /// <param name="bounds_min">
+    /// output parameter for the smallest corner of the box
+    /// </param>
+    /// <param name="bounds_max">
+    /// output parameter for the largest corner of the box
+    /// </param>
+    void GetBounds(DirectX::XMFLOAT3& bounds_min, DirectX::XMFLOAT3& bounds_max) const;
+
+    /// <summary>
+    /// Retrieves the vertex data in the mapping
+    /// </summary>
+    /// <returns>
+    /// first vertex
+    /// </returns>
+    const void* GetVertexData() const;
+
+    /// <summary>
+    /// Retrieves the index data in the mapping
+    /// </summary>
+    /// <returns>
+    /// first index
+    /// </returns>
+    const void* GetIndexData() const;
+
+    /// <summary>
+    /// Creates a vertex buffer in upload memory holding the vertices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    VertexBuffer_Custom* CreateVertexBuffer(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Creates a vertex buffer in GPU memory that is large enough for the vertices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    VertexBufferGPU_Custom* CreateVertexBufferGPU(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Creates an index buffer in upload memory holding the indices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to an IndexBuffer16 or IndexBuffer32 instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    IndexBuffer* CreateIndexBuffer(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Creates an index buffer in GPU memory that is large enough for the indices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to an IndexBufferGPU16 or IndexBufferGPU32 instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    IndexBuffer* CreateIndexBufferGPU(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Adds commands to copy the upload buffers into the GPU buffers
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to add the copies to
+    /// </param>
+    /// <param name="vertices">
+    /// vertex buffer created by CreateVertexBuffer
+    /// </param>
+    /// <param name="vertices_gpu">
+    /// vertex buffer created by CreateVertexBufferGPU
+    /// </param>
+    /// <param name="indices">
+    /// index buffer created by CreateIndexBuffer
+    /// </param>
+    /// <param name="indices_gpu">
+    /// index buffer created by CreateIndexBufferGPU
+    /// </param>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, VertexBuffer_Custom& vertices, const VertexBufferGPU_Custom& vertices_gpu,
+      IndexBuffer& indices, const IndexBuffer& indices_gpu) const;
+
+  private:
+    D3D12_MeshFile(HANDLE file, HANDLE mapping, const UINT8* data);
+
+    // disabled
+    D3D12_MeshFile();
+    D3D12_MeshFile(const D3D12_MeshFile& cpy);
+    D3D12_MeshFile& operator=(const D3D12_MeshFile& cpy);
+
+    /// <summary>
+    /// handle to the mesh file
+    /// </summary>
+    HANDLE m_file;
+
+    /// <summary>
+    /// handle to the file mapping
+    /// </summary>
+    HANDLE m_mapping;
+
+    /// <summary>
+    /// start of the mapped view of the file
+    /// </summary>
+    const UINT8* m_data;
+
+    /// <summary>
+    /// header at the start of the mapping
+    /// </summary>
+    const MeshFileHeader* m_header;
+
+    /// <summary>
+    /// element descriptions in the mapping
+    /// </summary>
+    const MeshFileElement* m_elements;
+
+    /// <summary>
+    /// submeshes in the mapping
+    /// </summary>
+    const MeshFileSubmesh* m_submeshes;
+};
+
+#endif /* D3D12_MESH_FILE_H */
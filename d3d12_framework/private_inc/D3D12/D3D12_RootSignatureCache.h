@@ -0,0 +1,136 @@
+#ifndef D3D12_ROOT_SIGNATURE_CACHE_H
+#define D3D12_ROOT_SIGNATURE_CACHE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <d3d12.h>
+#include "private_inc/D3D12/D3D12_RootSignatureConfig.h"
+
+/// <summary>
+/// Cache of root signatures keyed by the canonical form of their configuration.  Identical configurations share one
+/// ID3D12RootSignature, and the serialized blobs can be saved to disk so later runs skip serialization
+/// </summary>
+class D3D12_RootSignatureCache
+{
+  public:
+    /// <summary>
+    /// Creates an empty cache
+    /// </summary>
+    /// <param name="version">
+    /// highest root signature version the device supports.  Configurations are serialized as version 1.1 when
+    /// possible, and converted to version 1.0 otherwise
+    /// </param>
+    D3D12_RootSignatureCache(D3D_ROOT_SIGNATURE_VERSION version);
+
+    /// <summary>
+    /// Releases every cached root signature
+    /// </summary>
+    ~D3D12_RootSignatureCache();
+
+    /// <summary>
+    /// Gets the root signature for the config, serializing and creating it only if an equivalent config has not been
+    /// seen before
+    /// </summary>
+    /// <param name="device">
+    /// device to create the root signature with
+    /// </param>
+    /// <param name="config">
+    /// configuration of the root signature
+    /// </param>
+    /// <returns>
+    /// root signature with a reference added for the caller, who must Release it
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the root signature could not be serialized or created.  A blob loaded from a cache file that the device
+    /// rejects is serialized again from the config first, so this is only thrown when the fresh blob is rejected too
+    /// </exception>
+    ID3D12RootSignature* GetOrCreate(ID3D12Device* device, const D3D12_RootSignatureConfig& config);
+
+    /// <summary>
+    /// Adds the serialized blobs stored in a file to the cache.  A missing file is not an error, since it is expected
+    /// on the first run
+    /// </summary>
+    /// <param name="path">
+    /// path to the file written by Save
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file exists but is not a valid cache file
+    /// </exception>
+    void Load(const char* path);
+
+    /// <summary>
+    /// Writes the serialized blob of every cached root signature to a file
+    /// </summary>
+    /// <param name="path">
+    /// path to the file to write
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file could not be written
+    /// </exception>
+    void Save(const char* path) const;
+
+  private:
+    // disabled
+    D3D12_RootSignatureCache(const D3D12_RootSignatureCache& cpy);
+    D3D12_RootSignatureCache& operator=(const D3D12_RootSignatureCache& cpy);
+
+    /// <summary>
+    /// Serializes a root signature config as the version the cache was created with
+    /// </summary>
+    /// <param name="config">
+    /// configuration of the root signature
+    /// </param>
+    /// <param name="blob">
+    /// filled in with the serialized root signature
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the root signature could not be serialized
+    /// </exception>
+    void Serialize(const D3D12_RootSignatureConfig& config, std::vector<UINT8>& blob) const;
+
+    /// <summary>
+    /// Cached data for one root signature configuration
+    /// </summary>
+    struct Entry
+    {
+      Entry()
+      :root_sig(NULL)
+      {
+      }
+
+      /// <summary>
+      /// serialized root signature
+      /// </summary>
+      std::vector<UINT8> blob;
+
+      /// <summary>
+      /// root signature created from the blob.  NULL if the blob was loaded from disk and not requested yet
+      /// </summary>
+      ID3D12RootSignature* root_sig;
+    };
+
+    /// <summary>
+    /// cached entries keyed by D3D12_RootSignatureConfig::GetKey
+    /// </summary>
+    std::unordered_map<std::string, Entry> m_entries;
+
+    /// <summary>
+    /// guards m_entries so root signatures can be created from worker threads
+    /// </summary>
+    mutable std::mutex m_lock;
+
+    /// <summary>
+    /// root signature version configurations are serialized as
+    /// </summary>
+    D3D_ROOT_SIGNATURE_VERSION m_version;
+
+    /// <summary>
+    /// D3D12SerializeVersionedRootSignature, looked up at run time since older versions of d3d12.dll do not export it.
+    /// NULL when serializing as version 1.0
+    /// </summary>
+    PFN_D3D12_SERIALIZE_VERSIONED_ROOT_SIGNATURE m_serialize_versioned;
+};
+
+#endif /* D3D12_ROOT_SIGNATURE_CACHE_H */
@@ -1,6 +1,8 @@
 #ifndef D3D12_ROOT_SIGNATURE_CONFIG_H
 #define D3D12_ROOT_SIGNATURE_CONFIG_H
 
+#include <string>
+#include <vector>
 #include <d3d12.h>
 #include "Graphics/RootSignatureConfig.h"
 
@@ -24,6 +26,20 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// number of samplers the root signature will have
     /// </param>
     D3D12_RootSignatureConfig(UINT num_params, UINT num_sampler);
+
+    /// <summary>
+    /// Creates a config that is completely filled in from a description
+    /// </summary>
+    /// <param name="desc">
+    /// description of the root signature
+    /// </param>
+    /// <returns>
+    /// pointer to the root signature config instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the description has an invalid parameter or range type
+    /// </exception>
+    static D3D12_RootSignatureConfig* Create(const RootSignatureDesc& desc);
     
     ~D3D12_RootSignatureConfig();
 
@@ -143,7 +159,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    void SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders);
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    void SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a shader resource view with the associated values
@@ -160,7 +180,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    void SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders);
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    void SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -177,7 +201,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    void SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders);
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    void SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a descriptor table
@@ -211,7 +239,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    void SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space);
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0
+    /// </param>
+    void SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a shader resource view with the associated values
@@ -231,7 +263,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    void SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space);
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0
+    /// </param>
+    void SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -251,7 +287,11 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    void SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space);
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0
+    /// </param>
+    void SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags);
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -271,15 +311,63 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    void SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space);
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0
+    /// </param>
+    void SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags);
+
+    /// <summary>
+    /// Computes a hash of the configuration.  Equivalent configurations always produce the same hash
+    /// </summary>
+    /// <returns>
+    /// 64-bit FNV-1a hash of the canonical key
+    /// </returns>
+    UINT64 GetHash() const;
+
+    /// <summary>
+    /// Checks if this configuration would produce the same root signature as another one
+    /// </summary>
+    /// <param name="other">
+    /// configuration to compare against
+    /// </param>
+    /// <returns>
+    /// true  if the canonical keys of the two configurations match
+    /// false otherwise
+    /// </returns>
+    bool IsEquivalent(const RootSignatureConfig& other) const;
 
     /// <summary>
     /// Retrieves the root signature description
     /// </summary>
     /// <returns>
-    /// root signature description
+    /// version 1.1 root signature description
     /// </returns>
-    const D3D12_ROOT_SIGNATURE_DESC& GetDesc() const;
+    const D3D12_ROOT_SIGNATURE_DESC1& GetDesc() const;
+
+    /// <summary>
+    /// Converts the description to version 1.0 for devices that do not support version 1.1, dropping the volatility
+    /// flags
+    /// </summary>
+    /// <param name="desc">
+    /// receives the version 1.0 description
+    /// </param>
+    /// <param name="params">
+    /// storage for the parameters desc points to.  Must outlive desc
+    /// </param>
+    /// <param name="ranges">
+    /// storage for the descriptor ranges desc points to.  Must outlive desc
+    /// </param>
+    void GetDescVersion1_0(D3D12_ROOT_SIGNATURE_DESC& desc, std::vector<D3D12_ROOT_PARAMETER>& params, std::vector<D3D12_DESCRIPTOR_RANGE>& ranges) const;
+
+    /// <summary>
+    /// Builds the canonical byte representation of the configuration.  Only the fields that are meaningful for each
+    /// parameter type are written, so two configurations producing the same root signature produce the same key
+    /// </summary>
+    /// <param name="key">
+    /// string to write the key to.  Its previous contents are replaced
+    /// </param>
+    void GetKey(std::string& key) const;
     
   private:
     // disabled
@@ -290,7 +378,7 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <summary>
     /// D3D12 description of the root signature
     /// </summary>
-    D3D12_ROOT_SIGNATURE_DESC m_desc;
+    D3D12_ROOT_SIGNATURE_DESC1 m_desc;
 
     /// <summary>
     /// root param array to set the configuration of
@@ -298,7 +386,7 @@ class D3D12_RootSignatureConfig : public RootSignatureConfig
     /// <remarks>
     /// since pParameters in m_desc is declared const, keeping a pointer to a mutable version of the same memory
     /// </remarks>
-    D3D12_ROOT_PARAMETER* m_params;
+    D3D12_ROOT_PARAMETER1* m_params;
 
     /// <summary>
     /// sampler array to set the configuration of
@@ -2,6 +2,7 @@
 #define D3D12_SHADER_H
 
 #include <d3d12.h>
+#include <mutex>
 #include "Graphics/Shader.h"
 
 class D3D12_Shader : public Shader
@@ -21,21 +22,61 @@ class D3D12_Shader : public Shader
     /// </exception>
     static D3D12_Shader* Load(const char* path);
 
+    /// <summary>
+    /// Creates a shader that refers to bytecode owned by someone else, such as a memory mapped shader archive
+    /// </summary>
+    /// <param name="bytecode">
+    /// start of the compiled shader.  Must remain valid for the lifetime of the shader
+    /// </param>
+    /// <param name="len">
+    /// size of the compiled shader, in bytes
+    /// </param>
+    /// <returns>
+    /// pointer to the Shader instance
+    /// </returns>
+    static D3D12_Shader* CreateFromMemory(const void* bytecode, size_t len);
+
     ~D3D12_Shader();
 
     const D3D12_SHADER_BYTECODE& GetShader() const;
 
+    /// <summary>
+    /// Retrieves the reflection data of the shader, parsing the container the first time it is requested
+    /// </summary>
+    /// <returns>
+    /// reflection data, owned by the shader
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the shader container cannot be parsed
+    /// </exception>
+    const ShaderReflection& GetReflection() const;
+
   private:
     // disabled
     D3D12_Shader(const D3D12_Shader& cpy);
     D3D12_Shader& operator= (const D3D12_Shader& cpy);
 
-    D3D12_Shader(const char* bytecode, size_t len);
+    D3D12_Shader(const void* bytecode, size_t len, bool owns_bytecode);
 
     /// <summary>
     /// byte code data for the shader
     /// </summary>
     D3D12_SHADER_BYTECODE m_bytecode;
+
+    /// <summary>
+    /// true if the byte code was allocated by this instance and must be freed with it
+    /// </summary>
+    bool m_owns_bytecode;
+
+    /// <summary>
+    /// reflection data, NULL until it is first requested
+    /// </summary>
+    mutable ShaderReflection* m_reflection;
+
+    /// <summary>
+    /// guards creation of the reflection data
+    /// </summary>
+    mutable std::mutex m_reflection_lock;
 };
 
 #endif /* D3D12_SHADER_H */
\ No newline at end of file
@@ -0,0 +1,92 @@
+#ifndef D3D12_SHADER_ARCHIVE_H
+#define D3D12_SHADER_ARCHIVE_H
+
+#include "Graphics/ShaderArchive.h"
+#include "private_inc/ShaderArchiveFormat.h"
+
+/// <summary>
+/// Memory mapped archive of compiled shaders
+/// </summary>
+class D3D12_ShaderArchive : public ShaderArchive
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified archive and validates its index
+    /// </summary>
+    /// <param name="path">
+    /// path to the archive to open
+    /// </param>
+    /// <returns>
+    /// pointer to the D3D12_ShaderArchive instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped or is not a valid shader archive
+    /// </exception>
+    static D3D12_ShaderArchive* Open(const char* path);
+
+    ~D3D12_ShaderArchive();
+
+    /// <summary>
+    /// Creates a shader that uses the bytecode stored in the archive without copying it
+    /// </summary>
+    /// <param name="name">
+    /// name the shader was stored with
+    /// </param>
+    /// <returns>
+    /// pointer to the Shader instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the archive does not contain a shader with the specified name
+    /// </exception>
+    Shader* LoadShader(const char* name) const;
+
+    /// <summary>
+    /// Checks if the archive contains a shader with the specified name
+    /// </summary>
+    /// <param name="name">
+    /// name the shader was stored with
+    /// </param>
+    /// <returns>
+    /// true  if the shader is in the archive
+    /// false otherwise
+    /// </returns>
+    bool Contains(const char* name) const;
+
+    /// <summary>
+    /// Retrieves the number of shaders in the archive
+    /// </summary>
+    /// <returns>
+    /// number of shaders
+    /// </returns>
+    UINT GetNumShaders() const;
+
+  private:
+    D3D12_ShaderArchive(HANDLE file, HANDLE mapping, const UINT8* data);
+
+    // disabled
+    D3D12_ShaderArchive();
+    D3D12_ShaderArchive(const D3D12_ShaderArchive& cpy);
+    D3D12_ShaderArchive& operator=(const D3D12_ShaderArchive& cpy);
+
+    /// <summary>
+    /// handle to the archive file
+    /// </summary>
+    HANDLE m_file;
+
+    /// <summary>
+    /// handle to the file mapping
+    /// </summary>
+    HANDLE m_mapping;
+
+    /// <summary>
+    /// start of the mapped view of the file
+    /// </summary>
+    const UINT8* m_data;
+
+    /// <summary>
+    /// number of index entries
+    /// </summary>
+    UINT m_num_entries;
+};
+
+#endif /* D3D12_SHADER_ARCHIVE_H */
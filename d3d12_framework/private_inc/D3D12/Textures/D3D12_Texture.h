@@ -21,6 +21,11 @@ namespace D3D12_Texture
     /// handle to where the texture is on the GPU
     /// </summary>
     D3D12_GPU_DESCRIPTOR_HANDLE gpu_handle;
+
+    /// <summary>
+    /// handle to where the texture's shader resource view is written, for rewriting the view
+    /// </summary>
+    D3D12_CPU_DESCRIPTOR_HANDLE cpu_handle;
   };
 
   /// <summary>
@@ -50,6 +55,10 @@ namespace D3D12_Texture
   /// <param name="mip_levels">
   /// number of mipmap levels
   /// </param>
+  /// <param name="reserved">
+  /// true to create a reserved resource, whose tiles have no memory until they are mapped to a heap
+  /// false to create a committed resource
+  /// </param>
   /// <returns>
   /// D3D12 texture data
   /// </returns>
@@ -57,7 +66,7 @@ namespace D3D12_Texture
   /// Thrown when an error is encountered
   /// </exception>
   CreatedTexture Create(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, UINT16 depth, GraphicsDataFormat format, D3D12_SRV_DIMENSION dimension,
-    D3D12_RESOURCE_FLAGS flags, UINT16 mip_levels);
+    D3D12_RESOURCE_FLAGS flags, UINT16 mip_levels, bool reserved = false);
 }
 
 #endif /* D3D12_TEXTURE_H */
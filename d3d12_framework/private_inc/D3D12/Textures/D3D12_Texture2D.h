@@ -37,6 +37,35 @@ class D3D12_Texture2D : public Texture2D
     /// </exception>
     static Texture2D* Create(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, GraphicsDataFormat format, UINT16 mip_levels);
 
+    /// <summary>
+    /// Creates a D3D12 texture as a reserved resource, whose tiles have no memory until they are mapped to a heap
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <param name="width">
+    /// width of the texture in pixels
+    /// </param>
+    /// <param name="height">
+    /// height of the texture in pixels
+    /// </param>
+    /// <param name="format">
+    /// texture format
+    /// </param>
+    /// <param name="mip_levels">
+    /// number of mipmap levels
+    /// </param>
+    /// <returns>
+    /// D3D12 texture 2D
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static D3D12_Texture2D* CreateReserved(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, GraphicsDataFormat format, UINT16 mip_levels);
+
     ~D3D12_Texture2D();
 
     /// <summary>
@@ -63,13 +92,25 @@ class D3D12_Texture2D : public Texture2D
     /// </returns>
     UINT16 GetNumMipmapLevels() const;
 
+    /// <summary>
+    /// Rewrites the texture's shader resource view so sampling never uses mipmap levels more detailed than the given
+    /// one.  Command lists that use the view must not be executing
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="min_lod">
+    /// most detailed mipmap level that may be sampled
+    /// </param>
+    void SetMinLOD(const GraphicsCore& graphics, float min_lod);
+
   private:
     // disabled
     D3D12_Texture2D();
     D3D12_Texture2D(const D3D12_Texture2D& cpy);
     D3D12_Texture2D& operator=(const D3D12_Texture2D& cpy);
 
-    D3D12_Texture2D(ID3D12Resource* buffer, D3D12_GPU_DESCRIPTOR_HANDLE gpu_mem, UINT width, UINT height, GraphicsDataFormat format, UINT16 num_mip_levels);
+    D3D12_Texture2D(ID3D12Resource* buffer, D3D12_GPU_DESCRIPTOR_HANDLE gpu_mem, D3D12_CPU_DESCRIPTOR_HANDLE cpu_mem, UINT width, UINT height, GraphicsDataFormat format, UINT16 num_mip_levels);
 
     /// <summary>
     /// D3D12 texture resource
@@ -81,6 +122,11 @@ class D3D12_Texture2D : public Texture2D
     /// </summary>
     D3D12_GPU_DESCRIPTOR_HANDLE m_gpu_mem;
 
+    /// <summary>
+    /// where the texture's shader resource view is written
+    /// </summary>
+    D3D12_CPU_DESCRIPTOR_HANDLE m_cpu_mem;
+
     /// <summary>
     /// width of the texture in pixels
     /// <summary>
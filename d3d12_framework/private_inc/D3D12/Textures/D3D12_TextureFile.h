@@ -0,0 +1,452 @@
+#ifndef D3D12_TEXTURE_FILE_H
+#define D3D12_TEXTURE_FILE_H
+
+#include <d3d12.h>
+#include "Graphics/Textures/TextureFile.h"
+#include "private_inc/TextureFileFormat.h"
+
+/// <summary>
+/// Memory mapped DDS or KTX2 texture
+/// </summary>
+class D3D12_TextureFile : public TextureFile
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified DDS or KTX2 file and validates its layout
+    /// </summary>
+    /// <param name="path">
+    /// path to the texture file to open
+    /// </param>
+    /// <returns>
+    /// pointer to the D3D12_TextureFile instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped, is not a valid texture file or uses an unsupported format
+    /// </exception>
+    static D3D12_TextureFile* Open(const char* path);
+
+    ~D3D12_TextureFile();
+
+    /// <summary>
+    /// Retrieves which texture class the file is loaded as
+    /// </summary>
+    /// <returns>
+    /// type of the texture
+    /// </returns>
+    TextureFileType GetType() const;
+
+    /// <summary>
+    /// Retrieves the format of the texels
+    /// </summary>
+    /// <returns>
+    /// format of the texture
+    /// </returns>
+    GraphicsDataFormat GetFormat() const;
+
+    /// <summary>
+    /// Retrieves the width of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// width in texels
+    /// </returns>
+    UINT GetWidth() const;
+
+    /// <summary>
+    /// Retrieves the height of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// height in texels, 1 for 1D textures
+    /// </returns>
+    UINT GetHeight() const;
+
+    /// <summary>
+    /// Retrieves the depth of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// depth in texels, 1 for anything other than 3D textures
+    /// </returns>
+    UINT16 GetDepth() const;
+
+    /// <summary>
+    /// Retrieves the number of textures in the array
+    /// </summary>
+    /// <returns>
+    /// number of textures, or number of cubes for cube arrays.  1 for types that are not arrays
+    /// </returns>
+    UINT16 GetArraySize() const;
+
+    /// <summary>
+    /// Retrieves the number of mipmap levels stored in the file
+    /// </summary>
+    /// <returns>
+    /// number of mipmap levels
+    /// </returns>
+    UINT16 GetNumMipmapLevels() const;
+
+    /// <summary>
+    /// Retrieves where a subresource is in the mapping for processing on the CPU.  Only valid while the texture file
+    /// is open
+    /// </summary>
+    /// <param name="index">
+    /// index of the texture in the array.  For cubes this is the cube index * 6 + the side index
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level
+    /// </param>
+    /// <returns>
+    /// location of the subresource
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index or mipmap level is out of range
+    /// </exception>
+    TextureFileSubresource GetSubresource(UINT index, UINT16 mip_level) const;
+
+    /// <summary>
+    /// Creates a 1D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 1D texture or an error is encountered
+    /// </exception>
+    Texture1D* CreateTexture1D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a 1D texture array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 1D texture array or an error is encountered
+    /// </exception>
+    Texture1DArray* CreateTexture1DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a 2D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture or an error is encountered
+    /// </exception>
+    Texture2D* CreateTexture2D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a 2D texture array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture array or an error is encountered
+    /// </exception>
+    Texture2DArray* CreateTexture2DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a 3D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 3D texture or an error is encountered
+    /// </exception>
+    Texture3D* CreateTexture3D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a texture cube that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a cube map or an error is encountered
+    /// </exception>
+    TextureCube* CreateTextureCube(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a texture cube array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a cube map array or an error is encountered
+    /// </exception>
+    TextureCubeArray* CreateTextureCubeArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates an upload buffer large enough for every subresource of the file at once
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the upload buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    TextureUploadBuffer* CreateUploadBuffer(const GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture1D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1D& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture1DArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1DArray& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture2D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2D& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture2DArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2DArray& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture3D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture3D& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTextureCube
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCube& texture) const;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTextureCubeArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCubeArray& texture) const;
+
+  private:
+    D3D12_TextureFile(HANDLE file, HANDLE mapping, const UINT8* data, const TextureFileLayout& layout);
+
+    // disabled
+    D3D12_TextureFile();
+    D3D12_TextureFile(const D3D12_TextureFile& cpy);
+    D3D12_TextureFile& operator=(const D3D12_TextureFile& cpy);
+
+    /// <summary>
+    /// Checks that the file is loaded as the specified type of texture
+    /// </summary>
+    /// <param name="type">
+    /// type of texture being created
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is a different type of texture
+    /// </exception>
+    void CheckType(TextureFileType type) const;
+
+    /// <summary>
+    /// Builds the description of a texture that fits the file
+    /// </summary>
+    /// <returns>
+    /// resource description
+    /// </returns>
+    D3D12_RESOURCE_DESC GetResourceDesc() const;
+
+    /// <summary>
+    /// Main implementation of the various public PrepUpload functions
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture resource to upload to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    void PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, ID3D12Resource* texture) const;
+
+    /// <summary>
+    /// handle to the texture file
+    /// </summary>
+    HANDLE m_file;
+
+    /// <summary>
+    /// handle to the file mapping
+    /// </summary>
+    HANDLE m_mapping;
+
+    /// <summary>
+    /// start of the mapped view of the file
+    /// </summary>
+    const UINT8* m_data;
+
+    /// <summary>
+    /// description of the texture, with subresources pointing into the mapping
+    /// </summary>
+    TextureFileLayout m_layout;
+};
+
+#endif /* D3D12_TEXTURE_FILE_H */
@@ -0,0 +1,294 @@
+#ifndef D3D12_TEXTURE_STREAMER_H
+#define D3D12_TEXTURE_STREAMER_H
+
+#include <d3d12.h>
+#include <deque>
+#include <vector>
+#include "Graphics/Textures/TextureStreamer.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture2D.h"
+#include "private_inc/D3D12/D3D12_Core.h"
+
+/// <summary>
+/// Texture streamer that creates each texture as a reserved resource and gives each of its streamed levels its own
+/// D3D12 heap, so evicting a level frees its memory
+/// </summary>
+class D3D12_TextureStreamer : public TextureStreamer
+{
+  public:
+    /// <summary>
+    /// Creates a texture streamer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the textures will be accessed from
+    /// </param>
+    /// <param name="memory_budget">
+    /// number of bytes of GPU memory that the resident levels of all textures may take
+    /// </param>
+    /// <param name="upload_budget">
+    /// number of bytes of streamed levels that may be uploaded per call to PrepUpdate
+    /// </param>
+    /// <returns>
+    /// pointer to the texture streamer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the device does not support tiled resources
+    /// </exception>
+    static D3D12_TextureStreamer* Create(GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget);
+
+    ~D3D12_TextureStreamer();
+
+    /// <summary>
+    /// Adds a texture that streams from a file.  Its tail is mapped to a heap immediately and uploaded by the next call
+    /// to PrepUpdate
+    /// </summary>
+    /// <param name="file">
+    /// 2D texture file to stream from.  Must stay open until the streamer is deleted
+    /// </param>
+    /// <returns>
+    /// index of the texture
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture, or an error is encountered
+    /// </exception>
+    UINT AddTexture(const TextureFile& file);
+
+    /// <summary>
+    /// Retrieves a texture, for binding
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <returns>
+    /// the texture
+    /// </returns>
+    const Texture2D& GetTexture(UINT texture) const;
+
+    /// <summary>
+    /// Retrieves the policy that decides which levels are resident
+    /// </summary>
+    /// <returns>
+    /// streaming policy
+    /// </returns>
+    MipStreamingPolicy& GetPolicy();
+
+    /// <summary>
+    /// Clamps off and unmaps the levels the policy evicts, and maps and adds uploads of the levels it schedules and of
+    /// new tails to the command list
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the previous update was not submitted, or an error is encountered
+    /// </exception>
+    void PrepUpdate(CommandList& command_list);
+
+    /// <summary>
+    /// Signals the fence and tags the update prepared since the last call with it
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void Submit();
+
+    /// <summary>
+    /// Unclamps the levels of the updates the GPU has finished, and frees their evicted heaps and upload buffers
+    /// </summary>
+    /// <returns>
+    /// number of levels that became resident
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    UINT Poll();
+
+  private:
+    // disabled
+    D3D12_TextureStreamer();
+    D3D12_TextureStreamer(const D3D12_TextureStreamer& cpy);
+    D3D12_TextureStreamer& operator=(const D3D12_TextureStreamer& cpy);
+
+    D3D12_TextureStreamer(D3D12_Core& core, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget);
+
+    /// <summary>
+    /// Texture being streamed and the memory backing it
+    /// </summary>
+    struct StreamedTexture
+    {
+      /// <summary>
+      /// file the levels are uploaded from
+      /// </summary>
+      const TextureFile* file;
+
+      /// <summary>
+      /// reserved texture
+      /// </summary>
+      D3D12_Texture2D* texture;
+
+      /// <summary>
+      /// number of levels before the tail
+      /// </summary>
+      UINT16 num_streamed;
+
+      /// <summary>
+      /// number of tiles in each streamed level
+      /// </summary>
+      std::vector<UINT> level_tiles;
+
+      /// <summary>
+      /// heap backing each streamed level, or NULL when the level is not mapped
+      /// </summary>
+      std::vector<ID3D12Heap*> heaps;
+
+      /// <summary>
+      /// heap backing the tail
+      /// </summary>
+      ID3D12Heap* tail_heap;
+    };
+
+    /// <summary>
+    /// Buffer the levels are copied through
+    /// </summary>
+    struct UploadBuffer
+    {
+      /// <summary>
+      /// D3D12 upload buffer, or NULL when there is none
+      /// </summary>
+      ID3D12Resource* resource;
+
+      /// <summary>
+      /// number of bytes in the buffer
+      /// </summary>
+      UINT64 size;
+    };
+
+    /// <summary>
+    /// Uploads and evictions of 1 call to PrepUpdate
+    /// </summary>
+    struct Batch
+    {
+      /// <summary>
+      /// levels the policy scheduled for upload, which become resident once the batch completes
+      /// </summary>
+      std::vector<MipStreamingAction> uploads;
+
+      /// <summary>
+      /// heaps of the evicted levels, which the GPU may use until the batch completes
+      /// </summary>
+      std::vector<ID3D12Heap*> evicted_heaps;
+
+      /// <summary>
+      /// upload buffer holding the uploaded levels, which has no resource when nothing was uploaded
+      /// </summary>
+      UploadBuffer upload_buffer;
+
+      /// <summary>
+      /// fence value the batch completes at
+      /// </summary>
+      UINT64 fence;
+    };
+
+    /// <summary>
+    /// Creates a heap that levels of textures can be mapped to
+    /// </summary>
+    /// <param name="num_tiles">
+    /// number of 64KB tiles the heap holds
+    /// </param>
+    /// <returns>
+    /// D3D12 heap
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the heap cannot be created
+    /// </exception>
+    ID3D12Heap* CreateHeap(UINT num_tiles);
+
+    /// <summary>
+    /// Maps the tiles of a level or of the packed tail of a texture to the start of a heap, or unmaps them, on the
+    /// command queue
+    /// </summary>
+    /// <param name="texture">
+    /// reserved texture
+    /// </param>
+    /// <param name="subresource">
+    /// level to map, or the first packed level
+    /// </param>
+    /// <param name="num_tiles">
+    /// number of tiles to map
+    /// </param>
+    /// <param name="heap">
+    /// heap to map the tiles to, or NULL to unmap them
+    /// </param>
+    void MapTiles(ID3D12Resource* texture, UINT subresource, UINT num_tiles, ID3D12Heap* heap);
+
+    /// <summary>
+    /// Retrieves an upload buffer from the pool or creates one
+    /// </summary>
+    /// <param name="size">
+    /// number of bytes needed
+    /// </param>
+    /// <returns>
+    /// upload buffer of at least the number of bytes needed
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the buffer cannot be created
+    /// </exception>
+    UploadBuffer AcquireUploadBuffer(UINT64 size);
+
+    /// <summary>
+    /// Releases the evicted heaps and upload buffer of a batch
+    /// </summary>
+    /// <param name="batch">
+    /// batch to release
+    /// </param>
+    static void ReleaseBatch(Batch& batch);
+
+    /// <summary>
+    /// core the command queue, device, and fence are accessed through
+    /// </summary>
+    D3D12_Core& m_core;
+
+    /// <summary>
+    /// shader resources descriptor heap the textures are created in
+    /// </summary>
+    ShaderResourceDescHeap& m_shader_buffer_heap;
+
+    /// <summary>
+    /// decides which levels to upload and evict
+    /// </summary>
+    MipStreamingPolicy m_policy;
+
+    /// <summary>
+    /// textures being streamed
+    /// </summary>
+    std::vector<StreamedTexture> m_textures;
+
+    /// <summary>
+    /// tail levels of new textures that the next call to PrepUpdate uploads
+    /// </summary>
+    std::vector<MipStreamingAction> m_tail_uploads;
+
+    /// <summary>
+    /// batch prepared by PrepUpdate and not submitted yet
+    /// </summary>
+    Batch m_prepared;
+
+    /// <summary>
+    /// if m_prepared holds a batch
+    /// </summary>
+    bool m_has_prepared;
+
+    /// <summary>
+    /// submitted batches, oldest first
+    /// </summary>
+    std::deque<Batch> m_in_flight;
+
+    /// <summary>
+    /// upload buffers of completed batches, ready for reuse
+    /// </summary>
+    std::vector<UploadBuffer> m_free_buffers;
+};
+
+#endif /* D3D12_TEXTURE_STREAMER_H */
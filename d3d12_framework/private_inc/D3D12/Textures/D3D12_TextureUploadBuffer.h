@@ -3,6 +3,7 @@
 
 #include <d3d12.h>
 #include "Graphics/Textures/TextureUploadBuffer.h"
+#include "Graphics/Textures/TextureFile.h"
 
 class D3D12_TextureUploadBuffer : public TextureUploadBuffer
 {
@@ -138,6 +139,43 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// </exception>
     static TextureUploadBuffer* Create(const GraphicsCore& graphics, const TextureCubeArray& texture);
 
+    /// <summary>
+    /// Creates a D3D12 buffer for uploading every subresource of a texture at once
+    /// </summary>
+    /// <param name="graphics">
+    /// Core graphics interface
+    /// </param>
+    /// <param name="resource_desc">
+    /// resource description of the texture to create the upload buffer for
+    /// </param>
+    /// <returns>
+    /// Texture upload buffer
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static TextureUploadBuffer* CreateForAllSubresources(const GraphicsCore& graphics, const D3D12_RESOURCE_DESC& resource_desc);
+
+    /// <summary>
+    /// Records the copy of 1 subresource from its footprint in an upload buffer, and the barriers around it
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// upload buffer holding the subresource
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// subresource index to upload to
+    /// </param>
+    /// <param name="layout">
+    /// footprint of the subresource in the upload buffer
+    /// </param>
+    static void RecordUpload(CommandList& command_list, ID3D12Resource* buffer, ID3D12Resource* texture, UINT index, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout);
+
     ~D3D12_TextureUploadBuffer();
 
     /// <summary>
@@ -153,15 +191,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -176,15 +219,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -199,15 +247,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -225,15 +278,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// index of the texture in the array to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -251,15 +309,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// index of the texture in the array to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -277,15 +340,20 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// index of which side of the cube to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -306,15 +374,306 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// index of which side of the cube to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, UINT16 mip_level);
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of the texture in the array to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of the texture in the array to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of which side of the cube to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="cube_index">
+    /// index of which cube to upload to
+    /// </param>
+    /// <param name="side_index">
+    /// index of which side of the cube to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode);
+
+    /// <summary>
+    /// Maps the part of the upload buffer that holds the specified mipmap level of the specified texture, so it can be
+    /// written in place, such as by PngDecoder.  May be called from several threads at once, for different upload
+    /// buffers.  PrepUploadMapped must be called once the texels are written.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="texture">
+    /// texture that will be uploaded to
+    /// </param>
+    /// <param name="row_pitch">
+    /// output parameter for the number of bytes between the start of consecutive rows
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level that will be uploaded to
+    /// </param>
+    /// <returns>
+    /// first row of the mipmap level
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void* Map(GraphicsCore& graphics, Texture2D& texture, UINT& row_pitch, UINT16 mip_level);
+
+    /// <summary>
+    /// Unmaps the memory returned by Map, and preps the command list for uploading it to the specified texture.  The
+    /// command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to, which was passed to Map
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level to upload to, which was passed to Map
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUploadMapped(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, UINT16 mip_level);
+
+    /// <summary>
+    /// Copies every subresource of a texture into the footprints they have in the upload buffer and preps the command
+    /// list for uploading them.  Rows are copied straight from the source, so nothing is staged in between.  The
+    /// command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="subresources">
+    /// where to read each subresource from, in subresource index order
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUploadSubresources(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, const std::vector<TextureFileSubresource>& subresources);
 
   protected:
     D3D12_TextureUploadBuffer(ID3D12Resource* buffer);
@@ -352,15 +711,53 @@ class D3D12_TextureUploadBuffer : public TextureUploadBuffer
     /// subresource index to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, const std::vector<UINT8>& data, TexelConversion conversion);
+
+    /// <summary>
+    /// Main implementation of the various public PrepUploadMips functions that handles 1D, 2D, and 3D textures and texture arrays
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// subresource index of the top mipmap level to upload to
+    /// </param>
+    /// <param name="num_levels">
+    /// number of mipmap levels to upload, starting with the top one
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    void PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, const std::vector<UINT8>& data);
+    void PrepUploadMipsInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, UINT16 num_levels, const std::vector<UINT8>& data,
+      MipFilter filter, MipEdgeMode edge_mode);
 
     /// <summary>
     /// D3D12 buffer resource
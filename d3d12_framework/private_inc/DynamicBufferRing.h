@@ -0,0 +1,124 @@
+#ifndef DYNAMIC_BUFFER_RING_H
+#define DYNAMIC_BUFFER_RING_H
+
+#include <windows.h>
+#include <vector>
+#include "private_inc/FenceSlotRing.h"
+
+/// <summary>
+/// Tracks the versions of a buffer that the CPU rewrites every frame while earlier frames may still be reading it.
+/// Each frame writes to its own version, which is only reused once the fence tagged when its frame ended has been
+/// reached.  Also tracks the range of bytes in each version that has been written in other versions since it was last
+/// current, so only that range has to be copied when it comes around again.  Only does the bookkeeping, so it works
+/// with any fence and any memory holding the versions.
+/// </summary>
+class DynamicBufferRing
+{
+  public:
+    /// <summary>
+    /// Range of bytes in a version of the buffer.  Empty when start >= end
+    /// </summary>
+    struct Range
+    {
+      /// <summary>
+      /// offset of the first byte in the range
+      /// </summary>
+      UINT start;
+
+      /// <summary>
+      /// offset of the byte after the range
+      /// </summary>
+      UINT end;
+    };
+
+    /// <summary>
+    /// Creates a ring with version 0 current and every version up to date
+    /// </summary>
+    /// <param name="num_versions">
+    /// number of versions of the buffer
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when num_versions is 0
+    /// </exception>
+    DynamicBufferRing(UINT num_versions);
+
+    /// <summary>
+    /// Records that a range was written to the current version, which leaves the others out of date there
+    /// </summary>
+    /// <param name="start">
+    /// offset of the first byte written
+    /// </param>
+    /// <param name="end">
+    /// offset of the byte after the last byte written
+    /// </param>
+    void MarkWritten(UINT start, UINT end);
+
+    /// <summary>
+    /// Ends the current version's frame and moves to the next version if the GPU is done with it
+    /// </summary>
+    /// <param name="fence_value">
+    /// value signaled on the fence after the commands that use the current version.  Ignored when the current version
+    /// was already tagged by a call that returned false
+    /// </param>
+    /// <param name="completed_value">
+    /// value the fence has completed
+    /// </param>
+    /// <returns>
+    /// true if the next version is now current
+    /// false if every other version is still in flight, in which case the current version is unchanged and this
+    /// should be called again once the fence has progressed
+    /// </returns>
+    bool Advance(UINT64 fence_value, UINT64 completed_value);
+
+    /// <summary>
+    /// Gets the range of the current version that is out of date and marks the version up to date.  The caller must
+    /// copy the range into the version from the up to date contents
+    /// </summary>
+    /// <returns>
+    /// out of date range, empty if there is none
+    /// </returns>
+    Range TakeStale();
+
+    /// <summary>
+    /// Gets the version the current frame writes to
+    /// </summary>
+    /// <returns>
+    /// index of the current version
+    /// </returns>
+    UINT GetCurrent() const
+    {
+      return m_current;
+    }
+
+    /// <summary>
+    /// Gets the number of versions of the buffer
+    /// </summary>
+    /// <returns>
+    /// number of versions
+    /// </returns>
+    UINT GetNumVersions() const
+    {
+      return (UINT)m_stale.size();
+    }
+
+  private:
+    // disabled
+    DynamicBufferRing();
+
+    /// <summary>
+    /// versions the GPU may still be reading, in the order they were current, and the fence values that release them
+    /// </summary>
+    FenceSlotRing m_in_flight;
+
+    /// <summary>
+    /// index of the current version
+    /// </summary>
+    UINT m_current;
+
+    /// <summary>
+    /// range of bytes in each version that is out of date
+    /// </summary>
+    std::vector<Range> m_stale;
+};
+
+#endif /* DYNAMIC_BUFFER_RING_H */
@@ -0,0 +1,103 @@
+#ifndef FENCE_SLOT_RING_H
+#define FENCE_SLOT_RING_H
+
+#include <windows.h>
+#include <vector>
+
+/// <summary>
+/// Tracks which slots of a fixed size ring are waiting on the GPU.  Slots are handed out in ring order, tagged with
+/// the fence value signaled after the commands using them were submitted, and retired in the same order once the
+/// fence reaches that value.  Only does the bookkeeping, so it works with any fence and any per slot resource.
+/// </summary>
+class FenceSlotRing
+{
+  public:
+    /// <summary>
+    /// Returned instead of a slot index when no slot is available
+    /// </summary>
+    static const UINT NO_SLOT = 0xFFFFFFFF;
+
+    /// <summary>
+    /// Creates a ring with every slot free
+    /// </summary>
+    /// <param name="num_slots">
+    /// number of slots in the ring
+    /// </param>
+    FenceSlotRing(UINT num_slots);
+
+    /// <summary>
+    /// Takes the next free slot.  It stays in use until it is released after its fence value is reached
+    /// </summary>
+    /// <returns>
+    /// index of the slot
+    /// NO_SLOT if every slot is in use
+    /// </returns>
+    UINT Acquire();
+
+    /// <summary>
+    /// Tags every slot acquired since the last call with the fence value that indicates the GPU is done with it
+    /// </summary>
+    /// <param name="fence_value">
+    /// value signaled on the fence after the commands using the slots
+    /// </param>
+    void Tag(UINT64 fence_value);
+
+    /// <summary>
+    /// Gets the oldest slot in use if the fence has reached its tag.  Does not release it
+    /// </summary>
+    /// <param name="completed_value">
+    /// value the fence has completed
+    /// </param>
+    /// <returns>
+    /// index of the slot
+    /// NO_SLOT if the oldest slot is still in flight, not tagged yet or there are no slots in use
+    /// </returns>
+    UINT GetRetired(UINT64 completed_value) const;
+
+    /// <summary>
+    /// Frees the oldest slot in use so it can be acquired again
+    /// </summary>
+    void ReleaseOldest();
+
+    /// <summary>
+    /// Gets the number of slots that are in use
+    /// </summary>
+    /// <returns>
+    /// number of slots acquired and not released yet
+    /// </returns>
+    UINT GetNumInUse() const;
+
+    /// <summary>
+    /// Gets the number of slots in use that are not tagged yet
+    /// </summary>
+    /// <returns>
+    /// number of slots acquired since the last call to Tag
+    /// </returns>
+    UINT GetNumUntagged() const;
+
+  private:
+    // disabled
+    FenceSlotRing();
+
+    /// <summary>
+    /// fence value each slot was tagged with.  0 for slots that are free or not tagged yet
+    /// </summary>
+    std::vector<UINT64> m_fence_values;
+
+    /// <summary>
+    /// index of the oldest slot in use
+    /// </summary>
+    UINT m_oldest;
+
+    /// <summary>
+    /// number of slots in use
+    /// </summary>
+    UINT m_num_in_use;
+
+    /// <summary>
+    /// number of the newest slots in use that are not tagged yet
+    /// </summary>
+    UINT m_num_untagged;
+};
+
+#endif /* FENCE_SLOT_RING_H */
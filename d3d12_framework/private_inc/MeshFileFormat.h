@@ -0,0 +1,231 @@
+#ifndef MESH_FILE_FORMAT_H
+#define MESH_FILE_FORMAT_H
+
+// Layout of binary mesh files.  This is shared with tools/obj_to_mesh, so it only uses standard types.
+//
+// file layout:
+//   MeshFileHeader
+//   MeshFileElement[num_elements], in input layout order
+//   MeshFileSubmesh[num_submeshes]
+//   interleaved vertex data, starting on a MESH_FILE_ALIGNMENT boundary
+//   16 or 32 bit index data, starting on a MESH_FILE_ALIGNMENT boundary
+//
+// The vertex and index data are stored exactly as the GPU reads them, so loading them is a single copy from the
+// mapped file to upload memory.
+
+#include <stdint.h>
+#include <vector>
+
+/// <summary>
+/// "MESH" when read as a little endian 32-bit value
+/// </summary>
+const uint32_t MESH_FILE_MAGIC = 0x4853454D;
+
+/// <summary>
+/// version of the layout described in this file
+/// </summary>
+const uint32_t MESH_FILE_VERSION = 1;
+
+/// <summary>
+/// alignment of the vertex and index data from the start of the file
+/// </summary>
+const uint32_t MESH_FILE_ALIGNMENT = 16;
+
+/// <summary>
+/// Start of a mesh file
+/// </summary>
+struct MeshFileHeader
+{
+  /// <summary>
+  /// MESH_FILE_MAGIC
+  /// </summary>
+  uint32_t magic;
+
+  /// <summary>
+  /// MESH_FILE_VERSION
+  /// </summary>
+  uint32_t version;
+
+  /// <summary>
+  /// number of elements in each vertex
+  /// </summary>
+  uint32_t num_elements;
+
+  /// <summary>
+  /// number of submeshes
+  /// </summary>
+  uint32_t num_submeshes;
+
+  /// <summary>
+  /// number of vertices
+  /// </summary>
+  uint32_t num_vertices;
+
+  /// <summary>
+  /// number of bytes in 1 vertex
+  /// </summary>
+  uint32_t vertex_stride;
+
+  /// <summary>
+  /// number of indices
+  /// </summary>
+  uint32_t num_indices;
+
+  /// <summary>
+  /// number of bytes in 1 index, 2 or 4
+  /// </summary>
+  uint32_t index_size;
+
+  /// <summary>
+  /// offset of the element descriptions from the start of the file
+  /// </summary>
+  uint32_t elements_offset;
+
+  /// <summary>
+  /// offset of the submeshes from the start of the file
+  /// </summary>
+  uint32_t submeshes_offset;
+
+  /// <summary>
+  /// offset of the vertex data from the start of the file
+  /// </summary>
+  uint32_t vertices_offset;
+
+  /// <summary>
+  /// offset of the index data from the start of the file
+  /// </summary>
+  uint32_t indices_offset;
+
+  /// <summary>
+  /// smallest corner of the box enclosing every vertex position
+  /// </summary>
+  float bounds_min[3];
+
+  /// <summary>
+  /// largest corner of the box enclosing every vertex position
+  /// </summary>
+  float bounds_max[3];
+};
+
+/// <summary>
+/// Description of 1 element of each vertex, matching the arguments of InputLayout::SetNextElement
+/// </summary>
+struct MeshFileElement
+{
+  /// <summary>
+  /// value of the Semantics entry of the element
+  /// </summary>
+  uint32_t semantic;
+
+  /// <summary>
+  /// semantic index of the element
+  /// </summary>
+  uint32_t semantic_index;
+
+  /// <summary>
+  /// value of the GraphicsDataFormat entry of the element
+  /// </summary>
+  uint32_t format;
+
+  /// <summary>
+  /// offset of the element from the start of the vertex.  Elements are packed in order, so this is the sum of the
+  /// sizes of the previous elements
+  /// </summary>
+  uint32_t byte_offset;
+
+  /// <summary>
+  /// number of bytes in the element, which must be the size of its format.  Only formats that are a multiple of 4
+  /// bytes are supported
+  /// </summary>
+  uint32_t size;
+};
+
+/// <summary>
+/// Range of the index data drawn with 1 material
+/// </summary>
+struct MeshFileSubmesh
+{
+  /// <summary>
+  /// index of the first index of the submesh
+  /// </summary>
+  uint32_t first_index;
+
+  /// <summary>
+  /// number of indices in the submesh
+  /// </summary>
+  uint32_t num_indices;
+
+  /// <summary>
+  /// smallest corner of the box enclosing the submesh
+  /// </summary>
+  float bounds_min[3];
+
+  /// <summary>
+  /// largest corner of the box enclosing the submesh
+  /// </summary>
+  float bounds_max[3];
+};
+
+namespace MeshFileFormat
+{
+  /// <summary>
+  /// Retrieves the number of bytes in a vertex element of the specified format
+  /// </summary>
+  /// <param name="format">
+  /// value of the GraphicsDataFormat entry of the element
+  /// </param>
+  /// <returns>
+  /// number of bytes in the element
+  /// 0 if the format can't be used for a vertex element
+  /// </returns>
+  uint32_t GetElementSize(uint32_t format);
+
+  /// <summary>
+  /// Checks that everything the header of a mesh file refers to is inside of the file and that the vertex elements
+  /// describe the vertex data, so the accessors can trust the header afterwards
+  /// </summary>
+  /// <param name="data">
+  /// start of the file, aligned to at least 4 bytes
+  /// </param>
+  /// <param name="size">
+  /// number of bytes in the file
+  /// </param>
+  /// <returns>
+  /// description of the first problem found, worded to follow the name of the file
+  /// NULL if the file is valid
+  /// </returns>
+  const char* Validate(const uint8_t* data, uint64_t size);
+
+  /// <summary>
+  /// Lays out a mesh file.  tools/obj_to_mesh writes its output with this, so everything that builds mesh files
+  /// produces the same layout
+  /// </summary>
+  /// <param name="elements">
+  /// elements of each vertex, in input layout order.  Only the semantic, semantic index and format are read.  The
+  /// offset and size are filled in
+  /// </param>
+  /// <param name="vertices">
+  /// interleaved vertex data, packed the way the elements describe
+  /// </param>
+  /// <param name="num_vertices">
+  /// number of vertices
+  /// </param>
+  /// <param name="indices">
+  /// indices of the triangles.  They're stored as 16 bit indices when there are at most 65536 vertices
+  /// </param>
+  /// <param name="submeshes">
+  /// submeshes of the mesh.  Only the first index and number of indices are read.  The bounds are filled in from the
+  /// R32G32B32_FLOAT or R32G32B32A32_FLOAT POSITION element if there is one, and are 0 otherwise
+  /// </param>
+  /// <param name="file">
+  /// bytes of the file on success, empty on failure.  The vector's storage is aligned enough for the header
+  /// </param>
+  /// <returns>
+  /// description of the problem if the mesh can't be packed
+  /// NULL if the file was packed
+  /// </returns>
+  const char* Pack(std::vector<MeshFileElement>& elements, const void* vertices, uint32_t num_vertices,
+    const std::vector<uint32_t>& indices, std::vector<MeshFileSubmesh>& submeshes, std::vector<uint8_t>& file);
+}
+
+#endif /* MESH_FILE_FORMAT_H */
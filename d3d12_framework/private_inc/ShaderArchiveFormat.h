@@ -0,0 +1,178 @@
+#ifndef SHADER_ARCHIVE_FORMAT_H
+#define SHADER_ARCHIVE_FORMAT_H
+
+// Layout of shader archive files, the packing tools/shader_archive_builder does, and the validation and lookup the
+// framework does on them.  This is shared with the tool, so it only uses standard types.
+//
+// file layout:
+//   ShaderArchiveHeader
+//   ShaderArchiveEntry[num_entries], sorted by name_hash
+//   names, each null terminated
+//   bytecode blobs, each starting on a SHADER_ARCHIVE_ALIGNMENT boundary
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// "SHAR" when read as a little endian 32-bit value
+/// </summary>
+const uint32_t SHADER_ARCHIVE_MAGIC = 0x52414853;
+
+/// <summary>
+/// version of the layout described in this file
+/// </summary>
+const uint32_t SHADER_ARCHIVE_VERSION = 1;
+
+/// <summary>
+/// alignment of each bytecode blob from the start of the file
+/// </summary>
+const uint32_t SHADER_ARCHIVE_ALIGNMENT = 16;
+
+/// <summary>
+/// Start of a shader archive file
+/// </summary>
+struct ShaderArchiveHeader
+{
+  /// <summary>
+  /// SHADER_ARCHIVE_MAGIC
+  /// </summary>
+  uint32_t magic;
+
+  /// <summary>
+  /// SHADER_ARCHIVE_VERSION
+  /// </summary>
+  uint32_t version;
+
+  /// <summary>
+  /// number of entries in the index
+  /// </summary>
+  uint32_t num_entries;
+
+  /// <summary>
+  /// offset of the index from the start of the file
+  /// </summary>
+  uint32_t index_offset;
+};
+
+/// <summary>
+/// Index entry for one shader in the archive
+/// </summary>
+struct ShaderArchiveEntry
+{
+  /// <summary>
+  /// ShaderArchiveHash of the name
+  /// </summary>
+  uint64_t name_hash;
+
+  /// <summary>
+  /// offset of the null terminated name from the start of the file
+  /// </summary>
+  uint32_t name_offset;
+
+  /// <summary>
+  /// length of the name, not including the null terminator
+  /// </summary>
+  uint32_t name_length;
+
+  /// <summary>
+  /// offset of the bytecode from the start of the file
+  /// </summary>
+  uint32_t data_offset;
+
+  /// <summary>
+  /// size of the bytecode, in bytes
+  /// </summary>
+  uint32_t data_size;
+};
+
+/// <summary>
+/// Hashes a shader name for the archive index using 64-bit FNV-1a
+/// </summary>
+/// <param name="name">
+/// name to hash
+/// </param>
+/// <param name="length">
+/// number of characters in the name
+/// </param>
+/// <returns>
+/// hash of the name
+/// </returns>
+inline uint64_t ShaderArchiveHash(const char* name, size_t length)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash ^= (uint8_t)name[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/// <summary>
+/// Shader to pack into an archive
+/// </summary>
+struct ShaderArchiveShader
+{
+  /// <summary>
+  /// name the shader is stored with
+  /// </summary>
+  std::string name;
+
+  /// <summary>
+  /// compiled shader
+  /// </summary>
+  std::vector<uint8_t> bytecode;
+};
+
+namespace ShaderArchiveFormat
+{
+  /// <summary>
+  /// Lays out an archive: the header and index first, then the names, then the aligned bytecode blobs
+  /// </summary>
+  /// <param name="shaders">
+  /// shaders to pack.  Sorted into index order, by the hash of their name and then by name, so the archive does not
+  /// depend on the order they were listed in
+  /// </param>
+  /// <param name="archive">
+  /// output parameter for the bytes of the archive
+  /// </param>
+  /// <returns>
+  /// description of the problem if the shaders can't be packed
+  /// NULL if the archive was packed
+  /// </returns>
+  const char* Pack(std::vector<ShaderArchiveShader>& shaders, std::vector<uint8_t>& archive);
+
+  /// <summary>
+  /// Checks the header and every index entry of an archive, so lookups can trust the index afterwards
+  /// </summary>
+  /// <param name="data">
+  /// start of the archive, aligned to at least 8 bytes
+  /// </param>
+  /// <param name="size">
+  /// number of bytes in the archive
+  /// </param>
+  /// <returns>
+  /// description of the first problem found, worded to follow the name of the file
+  /// NULL if the archive is valid
+  /// </returns>
+  const char* Validate(const uint8_t* data, uint64_t size);
+
+  /// <summary>
+  /// Binary searches the index of an archive that passed Validate for a name
+  /// </summary>
+  /// <param name="data">
+  /// start of the archive
+  /// </param>
+  /// <param name="name">
+  /// name to look for
+  /// </param>
+  /// <returns>
+  /// index entry for the name
+  /// NULL if it is not in the archive
+  /// </returns>
+  const ShaderArchiveEntry* Find(const uint8_t* data, const char* name);
+}
+
+#endif /* SHADER_ARCHIVE_FORMAT_H */
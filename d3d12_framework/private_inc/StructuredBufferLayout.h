@@ -0,0 +1,72 @@
+#ifndef STRUCTURED_BUFFER_LAYOUT_H
+#define STRUCTURED_BUFFER_LAYOUT_H
+
+// Size and offset math of structured buffers, kept apart from the D3D12 resources so it can be checked without a device.
+// Every size is calculated in 64 bits, since the number of elements times the stride can exceed 32 bits.
+
+#include <windows.h>
+
+namespace StructuredBufferLayout
+{
+  /// <summary>
+  /// Calculates the number of bytes in a structured buffer
+  /// </summary>
+  /// <param name="num">
+  /// number of elements in the buffer
+  /// </param>
+  /// <param name="stride">
+  /// number of bytes in 1 element
+  /// </param>
+  /// <returns>
+  /// number of bytes in the buffer
+  /// </returns>
+  /// <exception cref="FrameworkException">
+  /// Thrown when there are no elements, or the stride is not a non-zero multiple of 4 bytes
+  /// </exception>
+  UINT64 GetSize(UINT num, UINT stride);
+
+  /// <summary>
+  /// Calculates the byte offset of an element a root descriptor starts at
+  /// </summary>
+  /// <param name="num">
+  /// number of elements in the buffer
+  /// </param>
+  /// <param name="stride">
+  /// number of bytes in 1 element
+  /// </param>
+  /// <param name="element_offset">
+  /// index of the element
+  /// </param>
+  /// <returns>
+  /// byte offset of the element from the start of the buffer
+  /// </returns>
+  /// <exception cref="FrameworkException">
+  /// Thrown when element_offset is not within the buffer
+  /// </exception>
+  UINT64 GetElementOffset(UINT num, UINT stride, UINT element_offset);
+
+  /// <summary>
+  /// Calculates the byte offset an upload of a range of elements starts at
+  /// </summary>
+  /// <param name="num">
+  /// number of elements in the buffer
+  /// </param>
+  /// <param name="stride">
+  /// number of bytes in 1 element
+  /// </param>
+  /// <param name="start_element">
+  /// index of the first element to write
+  /// </param>
+  /// <param name="num_elements">
+  /// number of elements to write
+  /// </param>
+  /// <returns>
+  /// byte offset of start_element from the start of the buffer
+  /// </returns>
+  /// <exception cref="FrameworkException">
+  /// Thrown when the range extends beyond the end of the buffer
+  /// </exception>
+  UINT64 GetUploadOffset(UINT num, UINT stride, UINT start_element, UINT num_elements);
+}
+
+#endif /* STRUCTURED_BUFFER_LAYOUT_H */
@@ -0,0 +1,222 @@
+#ifndef TEXTURE_FILE_FORMAT_H
+#define TEXTURE_FILE_FORMAT_H
+
+// Layouts of the DDS and KTX2 texture containers, and the parser that turns either into the subresources the
+// framework uploads.
+//
+// DDS layout:
+//   "DDS " magic
+//   DDSHeader
+//   DDSHeaderDX10, only when the pixel format's FourCC is "DX10"
+//   for each array slice (each cube face for cube maps): for each mipmap level: tightly packed texels
+//
+// KTX2 layout:
+//   KTX2Header
+//   KTX2LevelIndex[max(level_count, 1)]
+//   data format descriptor, key/value data and supercompression data, which are not used
+//   for each mipmap level, at the offset in its KTX2LevelIndex: for each layer: for each face: tightly packed texels
+
+#include <windows.h>
+#include <vector>
+#include <stdint.h>
+#include "Graphics/Textures/TextureFile.h"
+
+/// <summary>
+/// "DDS " when read as a little endian 32-bit value
+/// </summary>
+const uint32_t DDS_MAGIC = 0x20534444;
+
+/// <summary>
+/// ddspf flag for a FourCC code
+/// </summary>
+const uint32_t DDS_PF_FOURCC = 0x4;
+
+/// <summary>
+/// ddspf flag for uncompressed RGB data described by masks
+/// </summary>
+const uint32_t DDS_PF_RGB = 0x40;
+
+/// <summary>
+/// ddspf flag for single channel data described by the red mask
+/// </summary>
+const uint32_t DDS_PF_LUMINANCE = 0x20000;
+
+/// <summary>
+/// ddspf flag for alpha data in legacy formats
+/// </summary>
+const uint32_t DDS_PF_ALPHAPIXELS = 0x1;
+
+/// <summary>
+/// caps2 flag for cube maps
+/// </summary>
+const uint32_t DDS_CAPS2_CUBEMAP = 0x200;
+
+/// <summary>
+/// caps2 flags for all 6 faces of a cube map
+/// </summary>
+const uint32_t DDS_CAPS2_CUBEMAP_ALL_FACES = 0xFC00;
+
+/// <summary>
+/// caps2 flag for volume textures
+/// </summary>
+const uint32_t DDS_CAPS2_VOLUME = 0x200000;
+
+/// <summary>
+/// DX10 header misc_flag for cube maps
+/// </summary>
+const uint32_t DDS_MISC_TEXTURECUBE = 0x4;
+
+/// <summary>
+/// DX10 header resource dimensions, matching D3D12_RESOURCE_DIMENSION
+/// </summary>
+const uint32_t DDS_DIMENSION_TEXTURE1D = 2;
+const uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+const uint32_t DDS_DIMENSION_TEXTURE3D = 4;
+
+/// <summary>
+/// Pixel format of a DDS file.  Fields follow DDS_PIXELFORMAT
+/// </summary>
+struct DDSPixelFormat
+{
+  uint32_t size;
+  uint32_t flags;
+  uint32_t four_cc;
+  uint32_t rgb_bit_count;
+  uint32_t r_mask;
+  uint32_t g_mask;
+  uint32_t b_mask;
+  uint32_t a_mask;
+};
+
+/// <summary>
+/// Header following the DDS magic.  Fields follow DDS_HEADER
+/// </summary>
+struct DDSHeader
+{
+  uint32_t size;
+  uint32_t flags;
+  uint32_t height;
+  uint32_t width;
+  uint32_t pitch_or_linear_size;
+  uint32_t depth;
+  uint32_t mip_map_count;
+  uint32_t reserved1[11];
+  DDSPixelFormat ddspf;
+  uint32_t caps;
+  uint32_t caps2;
+  uint32_t caps3;
+  uint32_t caps4;
+  uint32_t reserved2;
+};
+
+/// <summary>
+/// Extended header for formats that are described by a DXGI format.  Fields follow DDS_HEADER_DXT10
+/// </summary>
+struct DDSHeaderDX10
+{
+  uint32_t dxgi_format;
+  uint32_t resource_dimension;
+  uint32_t misc_flag;
+  uint32_t array_size;
+  uint32_t misc_flags2;
+};
+
+/// <summary>
+/// First 12 bytes of a KTX2 file
+/// </summary>
+const uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+/// <summary>
+/// Start of a KTX2 file, including the index of the other sections
+/// </summary>
+struct KTX2Header
+{
+  uint8_t  identifier[12];
+  uint32_t vk_format;
+  uint32_t type_size;
+  uint32_t pixel_width;
+  uint32_t pixel_height;
+  uint32_t pixel_depth;
+  uint32_t layer_count;
+  uint32_t face_count;
+  uint32_t level_count;
+  uint32_t supercompression_scheme;
+  uint32_t dfd_byte_offset;
+  uint32_t dfd_byte_length;
+  uint32_t kvd_byte_offset;
+  uint32_t kvd_byte_length;
+  uint64_t sgd_byte_offset;
+  uint64_t sgd_byte_length;
+};
+
+/// <summary>
+/// Where 1 mipmap level of a KTX2 file is
+/// </summary>
+struct KTX2LevelIndex
+{
+  uint64_t byte_offset;
+  uint64_t byte_length;
+  uint64_t uncompressed_byte_length;
+};
+
+/// <summary>
+/// Description of a parsed texture file
+/// </summary>
+struct TextureFileLayout
+{
+  /// <summary>
+  /// which texture class the file is loaded as
+  /// </summary>
+  TextureFileType type;
+
+  /// <summary>
+  /// format of the texels
+  /// </summary>
+  GraphicsDataFormat format;
+
+  /// <summary>
+  /// size of the top mipmap level in texels
+  /// </summary>
+  UINT width;
+  UINT height;
+  UINT16 depth;
+
+  /// <summary>
+  /// number of textures in the array, or number of cubes for cube arrays
+  /// </summary>
+  UINT16 array_size;
+
+  /// <summary>
+  /// number of mipmap levels
+  /// </summary>
+  UINT16 mip_levels;
+
+  /// <summary>
+  /// every subresource in D3D12 subresource order, mipmap level + array slice * mip_levels, where each face of a cube
+  /// is an array slice
+  /// </summary>
+  std::vector<TextureFileSubresource> subresources;
+};
+
+namespace TextureFileFormat
+{
+  /// <summary>
+  /// Parses a DDS or KTX2 file and checks that every subresource is inside of it
+  /// </summary>
+  /// <param name="data">
+  /// start of the file
+  /// </param>
+  /// <param name="size">
+  /// number of bytes in the file
+  /// </param>
+  /// <param name="layout">
+  /// output parameter for the description of the texture, with subresources pointing into data
+  /// </param>
+  /// <returns>
+  /// description of the first problem found
+  /// NULL if the file is valid
+  /// </returns>
+  const char* Parse(const UINT8* data, UINT64 size, TextureFileLayout& layout);
+}
+
+#endif /* TEXTURE_FILE_FORMAT_H */
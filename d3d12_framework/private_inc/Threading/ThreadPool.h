@@ -0,0 +1,119 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <windows.h>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/// <summary>
+/// Fixed size pool of worker threads that run queued jobs in FIFO order
+/// </summary>
+class ThreadPool
+{
+  public:
+    /// <summary>
+    /// Job that can be queued on the pool
+    /// </summary>
+    typedef std::function<void()> Job;
+
+    /// <summary>
+    /// Part of a ParallelFor loop, covering the items from begin up to but not including end
+    /// </summary>
+    typedef std::function<void(UINT begin, UINT end)> RangeJob;
+
+    /// <summary>
+    /// Gets the pool shared by the framework for background work.  It is created on first use with one less worker than
+    /// the number of hardware threads (minimum of 1)
+    /// </summary>
+    /// <returns>
+    /// reference to the shared pool
+    /// </returns>
+    static ThreadPool& GetDefault();
+
+    /// <summary>
+    /// Creates a pool and starts its worker threads
+    /// </summary>
+    /// <param name="num_threads">
+    /// number of worker threads to start.  0 is treated as 1
+    /// </param>
+    ThreadPool(UINT num_threads);
+
+    /// <summary>
+    /// Runs any jobs still in the queue, then joins the worker threads
+    /// </summary>
+    ~ThreadPool();
+
+    /// <summary>
+    /// Adds a job to the end of the queue
+    /// </summary>
+    /// <param name="job">
+    /// job to run on one of the worker threads.  Jobs are responsible for catching their own exceptions
+    /// </param>
+    void Enqueue(const Job& job);
+
+    /// <summary>
+    /// Splits a loop into chunks and runs them on the worker threads and the calling thread, returning once every
+    /// chunk has finished.  The calling thread keeps taking chunks itself, so this completes even when every worker
+    /// is busy or it is called from a job on the pool
+    /// </summary>
+    /// <param name="num">
+    /// number of items in the loop
+    /// </param>
+    /// <param name="chunk_size">
+    /// number of items in each chunk.  0 is treated as 1
+    /// </param>
+    /// <param name="job">
+    /// function to run on each chunk.  Chunks run concurrently, in no particular order, and must not throw
+    /// </param>
+    void ParallelFor(UINT num, UINT chunk_size, const RangeJob& job);
+
+    /// <summary>
+    /// Gets the number of worker threads in the pool
+    /// </summary>
+    /// <returns>
+    /// number of worker threads
+    /// </returns>
+    UINT GetNumThreads() const;
+
+  private:
+    // disabled
+    ThreadPool();
+    ThreadPool(const ThreadPool& cpy);
+    ThreadPool& operator=(const ThreadPool& cpy);
+
+    /// <summary>
+    /// Entry point for each worker thread
+    /// </summary>
+    void WorkerMain();
+
+    /// <summary>
+    /// worker threads
+    /// </summary>
+    std::vector<std::thread> m_threads;
+
+    /// <summary>
+    /// jobs waiting for a worker
+    /// </summary>
+    std::deque<Job> m_jobs;
+
+    /// <summary>
+    /// guards m_jobs and m_shutdown
+    /// </summary>
+    std::mutex m_lock;
+
+    /// <summary>
+    /// signaled when a job is queued or the pool is shutting down
+    /// </summary>
+    std::condition_variable m_job_available;
+
+    /// <summary>
+    /// true once the destructor has started
+    /// </summary>
+    bool m_shutdown;
+};
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,107 @@
+#ifndef ASYNC_PIPELINE_H
+#define ASYNC_PIPELINE_H
+
+#include <functional>
+#include <memory>
+
+class Pipeline;
+class ThreadPool;
+struct AsyncPipelineState;
+
+/// <summary>
+/// Handle to a pipeline that is being compiled on a background worker thread.  The handle owns the pipeline once
+/// compilation completes
+/// </summary>
+class AsyncPipeline
+{
+  public:
+    /// <summary>
+    /// Function that performs the actual compile and returns the resulting pipeline
+    /// </summary>
+    typedef std::function<Pipeline*()> CompileFunction;
+
+    /// <summary>
+    /// Queues the compile function on the framework's worker pool
+    /// </summary>
+    /// <param name="compile">
+    /// function to run on a worker thread.  A FrameworkException thrown by it is captured and rethrown by Wait
+    /// </param>
+    /// <returns>
+    /// pointer to the handle for the pending pipeline
+    /// </returns>
+    static AsyncPipeline* Create(const CompileFunction& compile);
+
+    /// <summary>
+    /// Queues the compile function on a specific worker pool
+    /// </summary>
+    /// <param name="compile">
+    /// function to run on a worker thread.  A FrameworkException thrown by it is captured and rethrown by Wait
+    /// </param>
+    /// <param name="pool">
+    /// pool to run the compile on.  It must outlive the compile
+    /// </param>
+    /// <returns>
+    /// pointer to the handle for the pending pipeline
+    /// </returns>
+    static AsyncPipeline* Create(const CompileFunction& compile, ThreadPool& pool);
+
+    /// <summary>
+    /// Waits for the compile to finish if it is still pending, then releases the pipeline
+    /// </summary>
+    ~AsyncPipeline();
+
+    /// <summary>
+    /// Checks if the compile has finished, either successfully or with an error.  Does not block
+    /// </summary>
+    /// <returns>
+    /// true if the compile has finished
+    /// false if it is still pending
+    /// </returns>
+    bool IsReady() const;
+
+    /// <summary>
+    /// Gets the compiled pipeline without blocking
+    /// </summary>
+    /// <returns>
+    /// pointer to the pipeline
+    /// NULL if the compile is still pending or failed
+    /// </returns>
+    Pipeline* GetPipeline() const;
+
+    /// <summary>
+    /// Gets the compiled pipeline without blocking, or the fallback if it is not available yet
+    /// </summary>
+    /// <param name="fallback">
+    /// pipeline to use until the compile has finished
+    /// </param>
+    /// <returns>
+    /// reference to the compiled pipeline if it is available, otherwise the fallback
+    /// </returns>
+    const Pipeline& GetPipelineOrFallback(const Pipeline& fallback) const;
+
+    /// <summary>
+    /// Blocks until the compile has finished
+    /// </summary>
+    /// <returns>
+    /// reference to the compiled pipeline
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the compile failed
+    /// </exception>
+    Pipeline& Wait() const;
+
+  private:
+    AsyncPipeline(const std::shared_ptr<AsyncPipelineState>& state);
+
+    // disabled
+    AsyncPipeline();
+    AsyncPipeline(const AsyncPipeline& cpy);
+    AsyncPipeline& operator=(const AsyncPipeline& cpy);
+
+    /// <summary>
+    /// state shared with the worker thread running the compile
+    /// </summary>
+    std::shared_ptr<AsyncPipelineState> m_state;
+};
+
+#endif /* ASYNC_PIPELINE_H */
@@ -0,0 +1,100 @@
+#ifndef DYNAMIC_VERTEX_BUFFER_H
+#define DYNAMIC_VERTEX_BUFFER_H
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/Buffers/VertexBuffer.h"
+
+/// <summary>
+/// Vertex buffer that is rewritten by the CPU while previous frames using it may still be in flight.  Each frame gets
+/// its own version of the buffer from a ring in mapped upload memory, so writing the next frame's data never touches
+/// memory the GPU may still be reading.  Only the ranges that were uploaded since a version was last used are
+/// written to it.
+/// </summary>
+/// <remarks>
+/// The view returned by GetView changes when NextFrame is called, so the buffer must be set on the VertexBufferArray
+/// used for drawing after each call to NextFrame.  A version is only reused once the GPU is done with the frame that
+/// last used it, so NextFrame waits when the GPU hasn't finished the frame num_frames before the new one
+/// </remarks>
+class DynamicVertexBuffer : public VertexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a dynamic vertex buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num_frames">
+    /// number of frames that can be in flight at once, which is the number of versions of the buffer in the ring
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 entry
+    /// </param>
+    /// <param name="data">
+    /// initial data for every version of the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static DynamicVertexBuffer* CreateD3D12(GraphicsCore& graphics, UINT num_frames, UINT num, UINT stride, const void* data);
+
+    /// <summary>
+    /// Cleans up the vertex buffer
+    /// </summary>
+    virtual ~DynamicVertexBuffer();
+
+    /// <summary>
+    /// Switches to the version of the buffer for the next frame and brings it up to date with everything uploaded
+    /// while older frames were using it.  Call once per frame before uploading that frame's changes.
+    /// </summary>
+    /// <remarks>
+    /// Signals the graphics core's fence to mark the end of the previous version's frame, so it must be called after
+    /// the previous frame's command lists are executed and before the next frame's are.  If the GPU is still reading
+    /// the next version, this waits for the GPU to finish everything submitted so far
+    /// </remarks>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void NextFrame() = 0;
+
+    /// <summary>
+    /// Updates part of the buffer for the current frame.  Only the specified bytes are written to the mapped memory.
+    /// </summary>
+    /// <param name="buffer_start_index">
+    /// byte offset in the buffer to start writing data to
+    /// </param>
+    /// <param name="data">
+    /// data to write to the buffer
+    /// </param>
+    /// <param name="num_bytes">
+    /// number of bytes to write
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void Upload(UINT buffer_start_index, const void* data, UINT num_bytes) = 0;
+
+    /// <summary>
+    /// Retrieves the number of versions of the buffer in the ring
+    /// </summary>
+    /// <returns>
+    /// number of frames that can be in flight at once
+    /// </returns>
+    virtual UINT GetNumFrames() const = 0;
+
+  protected:
+    DynamicVertexBuffer();
+
+  private:
+    // disabled
+    DynamicVertexBuffer(const DynamicVertexBuffer& cpy);
+    DynamicVertexBuffer& operator=(const DynamicVertexBuffer& cpy);
+};
+
+#endif /* DYNAMIC_VERTEX_BUFFER_H */
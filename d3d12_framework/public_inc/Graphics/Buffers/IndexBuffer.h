@@ -2,6 +2,7 @@
 #define INDEX_BUFFER_H
 
 #include <windows.h>
+#include "Graphics/Buffers/IndexBufferView.h"
 
 /// <summary>
 /// Base class for index buffers
@@ -17,10 +18,29 @@ class IndexBuffer
     /// <returns>
     /// number of indices
     /// </returns>
-    virtual UINT GetNumIndices() const = 0;
+    UINT GetNumIndices() const
+    {
+      return m_view.size_in_bytes / (m_view.format == R16_UINT ? 2 : 4);
+    }
+
+    /// <summary>
+    /// Retrieves the view that binds the buffer to the input assembler stage
+    /// </summary>
+    /// <returns>
+    /// index buffer view
+    /// </returns>
+    const IndexBufferView& GetView() const
+    {
+      return m_view;
+    }
     
   protected:
     IndexBuffer();
+
+    /// <summary>
+    /// view of the buffer, filled in by the implementation when the buffer is created
+    /// </summary>
+    IndexBufferView m_view;
     
   private:
     // disabled
@@ -0,0 +1,66 @@
+#ifndef INDEX_BUFFER32_H
+#define INDEX_BUFFER32_H
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/Buffers/IndexBuffer.h"
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+
+/// <summary>
+/// Index buffer with 32bit entries
+/// </summary>
+class IndexBuffer32 : public IndexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <param name="data">
+    /// initial data for the index buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the index buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static IndexBuffer32* CreateD3D12(GraphicsCore& graphics, UINT num, const UINT* data);
+    
+    /// <summary>
+    /// Cleans up the index buffer
+    /// </summary>
+    virtual ~IndexBuffer32();
+
+    /// <summary>
+    /// Preps the command list for uploading the contents of the index buffer to the specified GPU-only accessible index buffer.  The command list must execute followed by a fence for the transfer to be
+    /// completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// GPU-only index buffer to upload to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, const IndexBufferGPU32& buffer) = 0;
+    
+  protected:
+    IndexBuffer32();
+    
+  private:
+    // disabled
+    IndexBuffer32(const IndexBuffer32& cpy);
+    IndexBuffer32& operator=(const IndexBuffer32& cpy);
+};
+
+#endif /* INDEX_BUFFER32_H */
@@ -0,0 +1,234 @@
+#ifndef INDEX_BUFFER_BUILDER_H
+#define INDEX_BUFFER_BUILDER_H
+
+class CommandList;
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/Buffers/IndexBuffer.h"
+
+/// <summary>
+/// Range of indices in an index buffer that is drawn with a single DrawIndexedInstanced call
+/// </summary>
+struct IndexBufferChunk
+{
+  /// <summary>
+  /// index in the index buffer of the first index in the chunk
+  /// </summary>
+  UINT first_index;
+
+  /// <summary>
+  /// number of indices in the chunk
+  /// </summary>
+  UINT num_indices;
+
+  /// <summary>
+  /// value to pass as the base vertex when drawing the chunk, since the indices in the chunk are relative to it
+  /// </summary>
+  UINT base_vertex;
+};
+
+/// <summary>
+/// Converts 32bit mesh indices into the narrowest index format that can hold them.  When the indices don't fit in
+/// 16bits, the mesh can be split into chunks whose indices are rebased to the smallest index in the chunk, so each
+/// chunk still fits in 16bits and is drawn with its own base vertex
+/// </summary>
+class IndexBufferBuilder
+{
+  public:
+    /// <summary>
+    /// Builds the index data
+    /// </summary>
+    /// <param name="indices">
+    /// 32bit indices of the mesh
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices
+    /// </param>
+    /// <param name="indices_per_primitive">
+    /// number of indices in 1 primitive.  Chunks are only split on primitive boundaries, so the indices must be a list
+    /// topology and num_indices must be a multiple of this
+    /// </param>
+    /// <param name="split">
+    /// true if the indices can be split into 16bit chunks when they don't fit in 16bits, false if they should be kept
+    /// as 32bit indices instead
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    IndexBufferBuilder(const UINT* indices, UINT num_indices, UINT indices_per_primitive = 3, bool split = true);
+
+    /// <summary>
+    /// Cleans up the builder
+    /// </summary>
+    ~IndexBufferBuilder();
+
+    /// <summary>
+    /// Checks if all of the indices can be stored in a 16bit index buffer without rebasing them
+    /// </summary>
+    /// <param name="indices">
+    /// indices to check
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices
+    /// </param>
+    /// <returns>
+    /// true if every index fits in 16bits, false otherwise
+    /// </returns>
+    static bool FitsIn16Bits(const UINT* indices, UINT num_indices);
+
+    /// <summary>
+    /// Checks which index format was picked
+    /// </summary>
+    /// <returns>
+    /// true if the index data is 16bit, false if it is 32bit
+    /// </returns>
+    bool Is16Bit() const;
+
+    /// <summary>
+    /// Retrieves the number of indices
+    /// </summary>
+    /// <returns>
+    /// number of indices
+    /// </returns>
+    UINT GetNumIndices() const;
+
+    /// <summary>
+    /// Retrieves the 16bit index data
+    /// </summary>
+    /// <returns>
+    /// 16bit indices, or NULL if the index data is 32bit
+    /// </returns>
+    const WORD* Get16BitData() const;
+
+    /// <summary>
+    /// Retrieves the 32bit index data
+    /// </summary>
+    /// <returns>
+    /// 32bit indices, or NULL if the index data is 16bit
+    /// </returns>
+    const UINT* Get32BitData() const;
+
+    /// <summary>
+    /// Retrieves the number of chunks the indices were split into
+    /// </summary>
+    /// <returns>
+    /// number of chunks.  1 unless the indices had to be split
+    /// </returns>
+    UINT GetNumChunks() const;
+
+    /// <summary>
+    /// Retrieves a chunk of the indices
+    /// </summary>
+    /// <param name="index">
+    /// index of the chunk to get
+    /// </param>
+    /// <returns>
+    /// chunk at the requested index
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    const IndexBufferChunk& GetChunk(UINT index) const;
+
+    /// <summary>
+    /// Creates an index buffer that is writable by the CPU from the index data
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// IndexBuffer16 or IndexBuffer32 instance, depending on the picked index format
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    IndexBuffer* CreateD3D12(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Creates an index buffer that is only accessible to the GPU and is large enough for the index data
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// IndexBufferGPU16 or IndexBufferGPU32 instance, depending on the picked index format
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    IndexBuffer* CreateGPUD3D12(GraphicsCore& graphics) const;
+
+    /// <summary>
+    /// Preps the command list for uploading an index buffer made by CreateD3D12 to one made by CreateGPUD3D12.  The
+    /// command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="src">
+    /// index buffer created by CreateD3D12
+    /// </param>
+    /// <param name="dst">
+    /// index buffer created by CreateGPUD3D12
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, IndexBuffer& src, const IndexBuffer& dst) const;
+
+  private:
+    // disabled
+    IndexBufferBuilder();
+    IndexBufferBuilder(const IndexBufferBuilder& cpy);
+    IndexBufferBuilder& operator=(const IndexBufferBuilder& cpy);
+
+    /// <summary>
+    /// Splits the indices into chunks whose indices span at most 16bits
+    /// </summary>
+    /// <param name="indices">
+    /// 32bit indices of the mesh
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices
+    /// </param>
+    /// <param name="indices_per_primitive">
+    /// number of indices in 1 primitive
+    /// </param>
+    /// <returns>
+    /// true if the indices were split, false if a single primitive spans more than 16bits so the indices can't be
+    /// split
+    /// </returns>
+    bool Split(const UINT* indices, UINT num_indices, UINT indices_per_primitive);
+
+    /// <summary>
+    /// 16bit index data, empty if the index data is 32bit
+    /// </summary>
+    std::vector<WORD> m_data16;
+
+    /// <summary>
+    /// 32bit index data, empty if the index data is 16bit
+    /// </summary>
+    std::vector<UINT> m_data32;
+
+    /// <summary>
+    /// chunks the indices are drawn in
+    /// </summary>
+    std::vector<IndexBufferChunk> m_chunks;
+
+    /// <summary>
+    /// number of indices
+    /// </summary>
+    UINT m_num;
+
+    /// <summary>
+    /// true if the index data is 16bit
+    /// </summary>
+    bool m_16bit;
+};
+
+#endif /* INDEX_BUFFER_BUILDER_H */
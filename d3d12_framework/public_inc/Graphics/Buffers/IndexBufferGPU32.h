@@ -0,0 +1,44 @@
+#ifndef INDEX_BUFFER_GPU_32_H
+#define INDEX_BUFFER_GPU_32_H
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/Buffers/IndexBuffer.h"
+
+/// <summary>
+/// Index buffer with 32bit entries that is only accessible on the GPU
+/// </summary>
+class IndexBufferGPU32 : public IndexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates an index buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the index buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static IndexBufferGPU32* CreateD3D12(GraphicsCore& graphics, UINT num);
+    
+    /// <summary>
+    /// Cleans up the index buffer
+    /// </summary>
+    virtual ~IndexBufferGPU32();
+    
+  protected:
+    IndexBufferGPU32();
+    
+  private:
+    // disabled
+    IndexBufferGPU32(const IndexBufferGPU32& cpy);
+    IndexBufferGPU32& operator=(const IndexBufferGPU32& cpy);
+};
+
+#endif /* INDEX_BUFFER_GPU_32_H */
@@ -0,0 +1,31 @@
+#ifndef INDEX_BUFFER_VIEW_H
+#define INDEX_BUFFER_VIEW_H
+
+#include <windows.h>
+#include "Graphics/GraphicsDataFormat.h"
+
+/// <summary>
+/// Location and format of an index buffer as seen by the input assembler stage
+/// </summary>
+/// <remarks>
+/// Layout must match up to D3D12_INDEX_BUFFER_VIEW so the view can be passed to D3D12 without conversion
+/// </remarks>
+struct IndexBufferView
+{
+  /// <summary>
+  /// GPU address of the first index
+  /// </summary>
+  UINT64 buffer_location;
+
+  /// <summary>
+  /// number of bytes in the buffer
+  /// </summary>
+  UINT size_in_bytes;
+
+  /// <summary>
+  /// format of the indices, either R16_UINT or R32_UINT
+  /// </summary>
+  GraphicsDataFormat format;
+};
+
+#endif /* INDEX_BUFFER_VIEW_H */
@@ -0,0 +1,178 @@
+#ifndef READBACK_RING_H
+#define READBACK_RING_H
+
+#include <vector>
+#include <functional>
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/CommandList.h"
+#include "Graphics/Buffers/StreamOutputBuffer.h"
+#include "Graphics/Buffers/StructuredBufferGPU.h"
+
+/// <summary>
+/// Ring of readback slots for getting results from the GPU without waiting on it.  Each readback copies into the next
+/// free slot as part of a command list the caller is already recording.  Submit tags the slots with the fence value
+/// signaled after the command list, and Poll delivers the results of every slot whose fence value has been reached,
+/// usually a couple of frames later.  When every slot is still in flight new readbacks are skipped instead of
+/// blocking.
+/// </summary>
+/// <remarks>
+/// The GPU must be done with the ring before it is deleted, so call Flush or GraphicsCore::WaitOnFence first
+/// </remarks>
+class ReadbackRing
+{
+  public:
+    /// <summary>
+    /// Function that receives the data of a finished readback.  The data is only valid until the function returns
+    /// </summary>
+    typedef std::function<void(const void* data, UINT num_bytes)> Callback;
+
+    /// <summary>
+    /// Function that receives the number of vertices written to each stream output buffer, in the same order as the
+    /// buffers were given to PrepNumVerticesWritten
+    /// </summary>
+    typedef std::function<void(const std::vector<UINT>& num_vertices)> NumVerticesCallback;
+
+    /// <summary>
+    /// Creates a readback ring
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface.  Its fence is used to tell when slots can be read
+    /// </param>
+    /// <param name="num_slots">
+    /// number of readbacks that can be in flight at once.  Frames in flight + 1 is enough to never skip 1 readback per
+    /// frame
+    /// </param>
+    /// <param name="slot_size">
+    /// largest number of bytes in 1 readback
+    /// </param>
+    /// <returns>
+    /// pointer to the readback ring instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static ReadbackRing* CreateD3D12(GraphicsCore& graphics, UINT num_slots, UINT slot_size);
+
+    /// <summary>
+    /// Cleans up the readback ring.  Callbacks of readbacks that have not been delivered are not called
+    /// </summary>
+    virtual ~ReadbackRing();
+
+    /// <summary>
+    /// Adds a copy of part of a structured buffer into the next free slot to the command list
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded.  The copy happens after the commands already in it
+    /// </param>
+    /// <param name="src">
+    /// buffer to read.  It must not be bound for unordered access when the copy runs
+    /// </param>
+    /// <param name="src_offset">
+    /// byte offset in the buffer to start reading from
+    /// </param>
+    /// <param name="num_bytes">
+    /// number of bytes to read.  Must be at most the slot size
+    /// </param>
+    /// <param name="callback">
+    /// function to call from Poll once the data is available
+    /// </param>
+    /// <returns>
+    /// true  if the copy was added
+    /// false if every slot is in flight and the readback was skipped
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the range is outside of the buffer or larger than a slot
+    /// </exception>
+    virtual bool PrepReadback(CommandList& command_list, const StructuredBufferGPU& src, UINT src_offset, UINT num_bytes,
+      const Callback& callback) = 0;
+
+    /// <summary>
+    /// Adds copies of the filled sizes of stream output buffers into the next free slot to the command list.  This is
+    /// the non-blocking version of StreamOutputBuffer::GetNumVerticesWrittenD3D12
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded.  The copies happen after the commands already in it
+    /// </param>
+    /// <param name="so_buffers">
+    /// stream output buffers to determine how many vertices were written to each.  sizeof(UINT64) * so_buffers.size()
+    /// must be at most the slot size.  They must be in the stream output state, and are left in it
+    /// </param>
+    /// <param name="callback">
+    /// function to call from Poll once the counts are available
+    /// </param>
+    /// <returns>
+    /// true  if the copies were added
+    /// false if every slot is in flight and the readback was skipped
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the filled sizes do not fit in a slot
+    /// </exception>
+    virtual bool PrepNumVerticesWritten(CommandList& command_list, const std::vector<StreamOutputBuffer*>& so_buffers,
+      const NumVerticesCallback& callback) = 0;
+
+    /// <summary>
+    /// Signals the fence and tags the readbacks prepared since the last call with it.  Call after executing the
+    /// command lists the readbacks were added to
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void Submit() = 0;
+
+    /// <summary>
+    /// Calls the callbacks of the readbacks the GPU has finished, oldest first, and frees their slots.  Does not block
+    /// </summary>
+    /// <returns>
+    /// number of readbacks delivered
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual UINT Poll() = 0;
+
+    /// <summary>
+    /// Waits for the GPU to finish every submitted readback and delivers them.  Readbacks that were prepared but not
+    /// submitted are submitted first
+    /// </summary>
+    /// <returns>
+    /// number of readbacks delivered
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual UINT Flush() = 0;
+
+    /// <summary>
+    /// Retrieves the number of readbacks that have been prepared but not delivered yet
+    /// </summary>
+    /// <returns>
+    /// number of slots in use
+    /// </returns>
+    virtual UINT GetNumPending() const = 0;
+
+    /// <summary>
+    /// Retrieves the number of slots in the ring
+    /// </summary>
+    /// <returns>
+    /// number of readbacks that can be in flight at once
+    /// </returns>
+    virtual UINT GetNumSlots() const = 0;
+
+    /// <summary>
+    /// Retrieves the size of each slot
+    /// </summary>
+    /// <returns>
+    /// largest number of bytes in 1 readback
+    /// </returns>
+    virtual UINT GetSlotSize() const = 0;
+
+  protected:
+    ReadbackRing();
+
+  private:
+    // disabled
+    ReadbackRing(const ReadbackRing& cpy);
+    ReadbackRing& operator=(const ReadbackRing& cpy);
+};
+
+#endif /* READBACK_RING_H */
@@ -0,0 +1,127 @@
+#ifndef STRUCTURED_BUFFER_H
+#define STRUCTURED_BUFFER_H
+
+class CommandList;
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/Buffers/StructuredBufferGPU.h"
+
+/// <summary>
+/// Structured buffer that is writable by the CPU.  Shaders can read it through a root shader resource view.  Uploads
+/// write straight into memory the GPU reads from, so elements must not be rewritten while a command list that reads
+/// them may still be executing; data that changes every frame needs one buffer per frame in flight
+/// </summary>
+class StructuredBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element.  Must be a multiple of 4
+    /// </param>
+    /// <param name="data">
+    /// initial data for the buffer, or NULL to leave the buffer uninitialized
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static StructuredBuffer* CreateD3D12(GraphicsCore& graphics, UINT num, UINT stride, const void* data);
+
+    /// <summary>
+    /// Creates a structured buffer whose elements are of type T
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="data">
+    /// initial data for the buffer, or NULL to leave the buffer uninitialized
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    template <class T>
+    static StructuredBuffer* CreateD3D12(GraphicsCore& graphics, UINT num, const T* data)
+    {
+      static_assert(sizeof(T) % 4 == 0, "Structured buffer elements must be a multiple of 4 bytes");
+      return CreateD3D12(graphics, num, sizeof(T), (const void*)data);
+    }
+
+    /// <summary>
+    /// Cleans up the structured buffer
+    /// </summary>
+    virtual ~StructuredBuffer();
+
+    /// <summary>
+    /// Retrieves the number of elements in the buffer
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    virtual UINT GetNumElements() const = 0;
+
+    /// <summary>
+    /// Retrieves the size of 1 element in bytes
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 element
+    /// </returns>
+    virtual UINT GetStride() const = 0;
+
+    /// <summary>
+    /// Updates a range of elements in the buffer
+    /// </summary>
+    /// <param name="start_element">
+    /// index of the first element to write
+    /// </param>
+    /// <param name="num_elements">
+    /// number of elements to write
+    /// </param>
+    /// <param name="data">
+    /// data to write.  Must be at least num_elements * GetStride() bytes long
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void Upload(UINT start_element, UINT num_elements, const void* data) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the contents of the buffer to the specified GPU-only accessible structured
+    /// buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// GPU-only structured buffer to upload to.  Must be the same size as this buffer
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void PrepUpload(CommandList& command_list, const StructuredBufferGPU& buffer) = 0;
+
+  protected:
+    StructuredBuffer();
+
+  private:
+    // disabled
+    StructuredBuffer(const StructuredBuffer& cpy);
+    StructuredBuffer& operator=(const StructuredBuffer& cpy);
+};
+
+#endif /* STRUCTURED_BUFFER_H */
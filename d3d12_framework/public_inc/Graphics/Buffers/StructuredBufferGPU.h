@@ -0,0 +1,85 @@
+#ifndef STRUCTURED_BUFFER_GPU_H
+#define STRUCTURED_BUFFER_GPU_H
+
+#include "Graphics/GraphicsCore.h"
+
+/// <summary>
+/// Structured buffer that is only accessible to the GPU.  Shaders can read it through a root shader resource view and
+/// write it through a root unordered access view
+/// </summary>
+class StructuredBufferGPU
+{
+  public:
+    /// <summary>
+    /// Creates a structured buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes in 1 element.  Must be a multiple of 4
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static StructuredBufferGPU* CreateD3D12(GraphicsCore& graphics, UINT num, UINT stride);
+
+    /// <summary>
+    /// Creates a structured buffer whose elements are of type T
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of elements in the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the structured buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    template <class T>
+    static StructuredBufferGPU* CreateD3D12(GraphicsCore& graphics, UINT num)
+    {
+      static_assert(sizeof(T) % 4 == 0, "Structured buffer elements must be a multiple of 4 bytes");
+      return CreateD3D12(graphics, num, sizeof(T));
+    }
+
+    /// <summary>
+    /// Cleans up the structured buffer
+    /// </summary>
+    virtual ~StructuredBufferGPU();
+
+    /// <summary>
+    /// Retrieves the number of elements in the buffer
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    virtual UINT GetNumElements() const = 0;
+
+    /// <summary>
+    /// Retrieves the size of 1 element in bytes
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 element
+    /// </returns>
+    virtual UINT GetStride() const = 0;
+
+  protected:
+    StructuredBufferGPU();
+
+  private:
+    // disabled
+    StructuredBufferGPU(const StructuredBufferGPU& cpy);
+    StructuredBufferGPU& operator=(const StructuredBufferGPU& cpy);
+};
+
+#endif /* STRUCTURED_BUFFER_GPU_H */
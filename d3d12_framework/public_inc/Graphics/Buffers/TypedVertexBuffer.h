@@ -0,0 +1,236 @@
+#ifndef TYPED_VERTEX_BUFFER_H
+#define TYPED_VERTEX_BUFFER_H
+
+class CommandList;
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/InputLayout.h"
+#include "Graphics/Buffers/VertexBuffer.h"
+#include "Graphics/Buffers/VertexBuffer_Custom.h"
+#include "Graphics/Buffers/VertexBufferGPU_Custom.h"
+#include "Graphics/VertexDeclarations/Vertex_Position.h"
+#include "Graphics/VertexDeclarations/Vertex_PositionColor.h"
+#include "Graphics/VertexDeclarations/Vertex_PositionTexture.h"
+
+/// <summary>
+/// Which heap the memory of a vertex buffer is in
+/// </summary>
+enum VertexBufferHeap
+{
+  /// <summary>
+  /// writable by the CPU, and can be used to upload to a VERTEX_BUFFER_HEAP_GPU buffer
+  /// </summary>
+  VERTEX_BUFFER_HEAP_UPLOAD = 0,
+
+  /// <summary>
+  /// only accessible to the GPU
+  /// </summary>
+  VERTEX_BUFFER_HEAP_GPU
+};
+
+/// <summary>
+/// Vertex buffer whose entries are of type TVertex.  Any vertex structure can be used; giving it a VertexTraits
+/// specialization allows the input layout to be generated with InputLayout::CreateD3D12&lt;TVertex&gt;
+/// </summary>
+template <class TVertex, VertexBufferHeap Heap>
+class TypedVertexBuffer;
+
+/// <summary>
+/// Vertex buffer whose entries are of type TVertex and that is only accessible to the GPU
+/// </summary>
+template <class TVertex>
+class TypedVertexBuffer<TVertex, VERTEX_BUFFER_HEAP_GPU> : public VertexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a vertex buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static TypedVertexBuffer* CreateD3D12(GraphicsCore& graphics, UINT num)
+    {
+      return new TypedVertexBuffer(VertexBufferGPU_Custom::CreateD3D12(graphics, num, sizeof(TVertex)));
+    }
+
+    /// <summary>
+    /// Cleans up the vertex buffer
+    /// </summary>
+    ~TypedVertexBuffer()
+    {
+      delete m_buffer;
+    }
+
+    /// <summary>
+    /// Retrieves the untyped buffer that holds the data
+    /// </summary>
+    /// <returns>
+    /// untyped vertex buffer
+    /// </returns>
+    const VertexBufferGPU_Custom& GetBuffer() const
+    {
+      return *m_buffer;
+    }
+
+  private:
+    // disabled
+    TypedVertexBuffer();
+    TypedVertexBuffer(const TypedVertexBuffer& cpy);
+    TypedVertexBuffer& operator=(const TypedVertexBuffer& cpy);
+
+    /// <summary>
+    /// Wraps an untyped vertex buffer
+    /// </summary>
+    /// <param name="buffer">
+    /// untyped vertex buffer to take ownership of
+    /// </param>
+    explicit TypedVertexBuffer(VertexBufferGPU_Custom* buffer)
+    :m_buffer(buffer)
+    {
+      m_view = buffer->GetView();
+    }
+
+    /// <summary>
+    /// untyped vertex buffer that holds the data
+    /// </summary>
+    VertexBufferGPU_Custom* m_buffer;
+};
+
+/// <summary>
+/// Vertex buffer whose entries are of type TVertex and that is writable by the CPU
+/// </summary>
+template <class TVertex>
+class TypedVertexBuffer<TVertex, VERTEX_BUFFER_HEAP_UPLOAD> : public VertexBuffer
+{
+  public:
+    /// <summary>
+    /// Creates a vertex buffer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="num">
+    /// number of entries in the buffer
+    /// </param>
+    /// <param name="data">
+    /// initial data for the vertex buffer
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static TypedVertexBuffer* CreateD3D12(GraphicsCore& graphics, UINT num, const TVertex* data)
+    {
+      return new TypedVertexBuffer(VertexBuffer_Custom::CreateD3D12(graphics, num, sizeof(TVertex), data));
+    }
+
+    /// <summary>
+    /// Cleans up the vertex buffer
+    /// </summary>
+    ~TypedVertexBuffer()
+    {
+      delete m_buffer;
+    }
+
+    /// <summary>
+    /// Updates the data in the vertex buffer starting at the specified index
+    /// </summary>
+    /// <param name="buffer_start_index">
+    /// index of the entry in the vertex buffer to start writing data to
+    /// </param>
+    /// <param name="data">
+    /// data to write to the vertex buffer
+    /// </param>
+    /// <param name="num_entries">
+    /// number of entries to write to the vertex buffer
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void Upload(UINT buffer_start_index, const TVertex* data, UINT num_entries)
+    {
+      m_buffer->Upload(buffer_start_index * sizeof(TVertex), data, num_entries * sizeof(TVertex));
+    }
+
+    /// <summary>
+    /// Preps the command list for uploading the contents of the vertex buffer to the specified GPU-only accessible
+    /// vertex buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="buffer">
+    /// GPU-only vertex buffer to upload to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    void PrepUpload(GraphicsCore& graphics, CommandList& command_list, const TypedVertexBuffer<TVertex, VERTEX_BUFFER_HEAP_GPU>& buffer)
+    {
+      m_buffer->PrepUpload(graphics, command_list, buffer.GetBuffer());
+    }
+
+    /// <summary>
+    /// Retrieves the untyped buffer that holds the data
+    /// </summary>
+    /// <returns>
+    /// untyped vertex buffer
+    /// </returns>
+    const VertexBuffer_Custom& GetBuffer() const
+    {
+      return *m_buffer;
+    }
+
+  private:
+    // disabled
+    TypedVertexBuffer();
+    TypedVertexBuffer(const TypedVertexBuffer& cpy);
+    TypedVertexBuffer& operator=(const TypedVertexBuffer& cpy);
+
+    /// <summary>
+    /// Wraps an untyped vertex buffer
+    /// </summary>
+    /// <param name="buffer">
+    /// untyped vertex buffer to take ownership of
+    /// </param>
+    explicit TypedVertexBuffer(VertexBuffer_Custom* buffer)
+    :m_buffer(buffer)
+    {
+      m_view = buffer->GetView();
+    }
+
+    /// <summary>
+    /// untyped vertex buffer that holds the data
+    /// </summary>
+    VertexBuffer_Custom* m_buffer;
+};
+
+// names of the vertex buffers for the framework's vertex declarations
+typedef TypedVertexBuffer<Vertex_Position,                VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_Position;
+typedef TypedVertexBuffer<Vertex_PositionColor,           VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_PositionColor;
+typedef TypedVertexBuffer<Vertex_PositionTextureU,        VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_PositionTextureU;
+typedef TypedVertexBuffer<Vertex_PositionTextureUV,       VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_PositionTextureUV;
+typedef TypedVertexBuffer<Vertex_PositionTextureUVNormal, VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_PositionTextureUVNormal;
+typedef TypedVertexBuffer<Vertex_PositionTextureUVW,      VERTEX_BUFFER_HEAP_UPLOAD> VertexBuffer_PositionTextureUVW;
+typedef TypedVertexBuffer<Vertex_Position,                VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_Position;
+typedef TypedVertexBuffer<Vertex_PositionColor,           VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_PositionColor;
+typedef TypedVertexBuffer<Vertex_PositionTextureU,        VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_PositionTextureU;
+typedef TypedVertexBuffer<Vertex_PositionTextureUV,       VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_PositionTextureUV;
+typedef TypedVertexBuffer<Vertex_PositionTextureUVNormal, VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_PositionTextureUVNormal;
+typedef TypedVertexBuffer<Vertex_PositionTextureUVW,      VERTEX_BUFFER_HEAP_GPU>    VertexBufferGPU_PositionTextureUVW;
+
+#endif /* TYPED_VERTEX_BUFFER_H */
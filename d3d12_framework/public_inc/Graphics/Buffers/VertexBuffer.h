@@ -4,6 +4,7 @@
 class VertexBufferArray;
 
 #include <windows.h>
+#include "Graphics/Buffers/VertexBufferView.h"
 
 /// <summary>
 /// Base class for vertex buffers
@@ -19,11 +20,30 @@ class VertexBuffer
     /// <returns>
     /// number of entries
     /// </returns>
-    virtual UINT GetNumVertices() const = 0;
-    
+    UINT GetNumVertices() const
+    {
+      return m_view.size_in_bytes / m_view.stride_in_bytes;
+    }
+
+    /// <summary>
+    /// Retrieves the view that binds the buffer to the input assembler stage
+    /// </summary>
+    /// <returns>
+    /// vertex buffer view
+    /// </returns>
+    const VertexBufferView& GetView() const
+    {
+      return m_view;
+    }
+
   protected:
     VertexBuffer();
-    
+
+    /// <summary>
+    /// view of the buffer, filled in by the implementation when the buffer is created
+    /// </summary>
+    VertexBufferView m_view;
+
   private:
     // disabled
     VertexBuffer(const VertexBuffer& cpy);
@@ -1,23 +1,12 @@
 #ifndef VERTEX_BUFFER_ARRAY_H
 #define VERTEX_BUFFER_ARRAY_H
 
-class VertexBuffer_Custom;
-class VertexBuffer_Position;
-class VertexBuffer_PositionTextureU;
-class VertexBuffer_PositionTextureUV;
-class VertexBuffer_PositionTextureUVNormal;
-class VertexBuffer_PositionTextureUVW;
-class VertexBuffer_PositionColor;
 class StreamOutputBuffer;
 
 #include <windows.h>
-#include "Graphics/Buffers/VertexBuffer_Custom.h"
-#include "Graphics/Buffers/VertexBuffer_Position.h"
-#include "Graphics/Buffers/VertexBuffer_PositionTextureU.h"
-#include "Graphics/Buffers/VertexBuffer_PositionTextureUV.h"
-#include "Graphics/Buffers/VertexBuffer_PositionTextureUVNormal.h"
-#include "Graphics/Buffers/VertexBuffer_PositionTextureUVW.h"
-#include "Graphics/Buffers/VertexBuffer_PositionColor.h"
+#include "Graphics/Buffers/VertexBuffer.h"
+#include "Graphics/Buffers/VertexBufferView.h"
+#include "Graphics/Buffers/TypedVertexBuffer.h"
 #include "Graphics/Buffers/StreamOutputBuffer.h"
 
 /// <summary>
@@ -52,189 +41,13 @@ class VertexBufferArray
     /// <param name="buffer">
     /// buffer to set the element to
     /// </param>
-    virtual void Set(UINT index, const VertexBuffer_Custom& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_Position& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_PositionTextureU& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_PositionTextureUV& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_PositionTextureUVNormal& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_PositionTextureUVW& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBuffer_PositionColor& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_Custom& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_Position& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_PositionTextureU& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_PositionTextureUV& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_PositionTextureUVNormal& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_PositionTextureUVW& buffer) = 0;
-
-    /// <summary>
-    /// Sets the element at that specified index to the specified buffer
-    /// <summary>
-    /// <remarks>
-    /// If a vertex buffer is to be destroyed, then it must be cleared from this before the array is used again
-    /// </remarks>
-    /// <param name="index">
-    /// where in the array to set the buffer
-    /// </param>
-    /// <param name="buffer">
-    /// buffer to set the element to
-    /// </param>
-    virtual void Set(UINT index, const VertexBufferGPU_PositionColor& buffer) = 0;
+    /// <exception cref="FrameworkException">
+    /// Thrown when index is beyond the number of buffers in the array
+    /// </exception>
+    void Set(UINT index, const VertexBuffer& buffer)
+    {
+      SetView(index, buffer.GetView());
+    }
 
     /// <summary>
     /// Sets the element at that specified index to the specified buffer
@@ -256,7 +69,10 @@ class VertexBufferArray
     /// <param name="index">
     /// which index to clear
     /// </param>
-    virtual void Clear(UINT index) = 0;
+    /// <exception cref="FrameworkException">
+    /// Thrown when index is beyond the number of buffers in the array
+    /// </exception>
+    void Clear(UINT index);
 
     /// <summary>
     /// Retrieves the number of buffers the array was created to hold
@@ -264,15 +80,60 @@ class VertexBufferArray
     /// <returns>
     /// number of entries in the array
     /// </returns>
-    virtual UINT GetNumBuffers() const = 0;
+    UINT GetNumBuffers() const
+    {
+      return m_num;
+    }
 
   protected:
-    VertexBufferArray();
+    /// <summary>
+    /// Creates a vertex buffer array with the specified number of elements, all clear of a vertex buffer
+    /// </summary>
+    /// <param name="num_buffers">
+    /// number of buffers that will be in the array
+    /// </param>
+    VertexBufferArray(UINT num_buffers);
+
+    /// <summary>
+    /// Sets the element at that specified index to the specified view
+    /// </summary>
+    /// <param name="index">
+    /// where in the array to set the view
+    /// </param>
+    /// <param name="view">
+    /// view to set the element to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when index is beyond the number of buffers in the array
+    /// </exception>
+    void SetView(UINT index, const VertexBufferView& view);
+
+    /// <summary>
+    /// Retrieves the array of views
+    /// </summary>
+    /// <returns>
+    /// array of GetNumBuffers() views
+    /// </returns>
+    const VertexBufferView* GetViews() const
+    {
+      return m_views;
+    }
     
   private:
     // disabled
+    VertexBufferArray();
     VertexBufferArray(const VertexBufferArray& cpy);
     VertexBufferArray& operator=(const VertexBufferArray& cpy);
+
+    /// <summary>
+    /// views of the vertex buffers
+    /// </summary>
+    VertexBufferView* m_views;
+
+    /// <summary>
+    /// number of elements in m_views
+    /// </summary>
+    UINT m_num;
 };
 
 #endif /* VERTEX_BUFFER_ARRAY_H */
@@ -5,7 +5,7 @@
 #include "Graphics/Buffers/VertexBuffer.h"
 
 /// <summary>
-/// Vertex buffer whose only element is position
+/// Vertex buffer that applications define the data of and that is only accessible to the GPU
 /// </summary>
 class VertexBufferGPU_Custom : public VertexBuffer
 {
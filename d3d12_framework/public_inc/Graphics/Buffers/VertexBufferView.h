@@ -0,0 +1,30 @@
+#ifndef VERTEX_BUFFER_VIEW_H
+#define VERTEX_BUFFER_VIEW_H
+
+#include <windows.h>
+
+/// <summary>
+/// Location and layout of a vertex buffer as seen by the input assembler stage
+/// </summary>
+/// <remarks>
+/// Layout must match up to D3D12_VERTEX_BUFFER_VIEW so arrays of views can be passed to D3D12 without conversion
+/// </remarks>
+struct VertexBufferView
+{
+  /// <summary>
+  /// GPU address of the first vertex
+  /// </summary>
+  UINT64 buffer_location;
+
+  /// <summary>
+  /// number of bytes in the buffer
+  /// </summary>
+  UINT size_in_bytes;
+
+  /// <summary>
+  /// number of bytes in 1 vertex
+  /// </summary>
+  UINT stride_in_bytes;
+};
+
+#endif /* VERTEX_BUFFER_VIEW_H */
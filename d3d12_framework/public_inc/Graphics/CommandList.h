@@ -7,6 +7,8 @@ class Pipeline;
 class VertexBufferArray;
 class HeapArray;
 class ConstantBuffer;
+class StructuredBuffer;
+class StructuredBufferGPU;
 class StreamOutputBufferArray;
 class Texture1D;
 class Texture2D;
@@ -28,7 +30,10 @@ class DepthStencilMSAA;
 #include "Graphics/Textures/RenderTarget.h"
 #include "Graphics/HeapArray.h"
 #include "Graphics/Buffers/ConstantBuffer.h"
+#include "Graphics/Buffers/StructuredBuffer.h"
+#include "Graphics/Buffers/StructuredBufferGPU.h"
 #include "Graphics/Topology.h"
+#include "Graphics/DrawIndexedArgs.h"
 #include "Graphics/Buffers/VertexBufferArray.h"
 #include "Graphics/Buffers/IndexBuffer.h"
 #include "Graphics/Buffers/StreamOutputBufferArray.h"
@@ -123,6 +128,104 @@ class CommandList
     /// </param>
     virtual void SetConstantBuffer(UINT slot, const ConstantBuffer& constant_buffer) = 0;
 
+    /// <summary>
+    /// Sets 32-bit constants of a root signature slot that was configured with SetParamAsConstants
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot to set the constants of
+    /// </param>
+    /// <param name="num_32bit_values">
+    /// number of 32-bit values to set
+    /// </param>
+    /// <param name="data">
+    /// values to set
+    /// </param>
+    /// <param name="dest_offset">
+    /// index of the first 32-bit value within the slot to set
+    /// </param>
+    virtual void SetRootConstants(UINT slot, UINT num_32bit_values, const void* data, UINT dest_offset = 0) = 0;
+
+    /// <summary>
+    /// Sets 32-bit constants of a root signature slot from a structure, checking at compile time that it fits within
+    /// the 64 DWORD root signature limit
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot to set the constants of
+    /// </param>
+    /// <param name="data">
+    /// structure to copy into the slot.  Its size must be a multiple of 4 bytes
+    /// </param>
+    /// <param name="dest_offset">
+    /// index of the first 32-bit value within the slot to set
+    /// </param>
+    template <class T>
+    void SetRootConstants(UINT slot, const T& data, UINT dest_offset = 0)
+    {
+      static_assert(sizeof(T) % sizeof(UINT) == 0, "Root constants must be a multiple of 4 bytes");
+      static_assert(sizeof(T) <= 64 * sizeof(UINT), "Root constants cannot be larger than 64 DWORDs");
+      SetRootConstants(slot, sizeof(T) / sizeof(UINT), &data, dest_offset);
+    }
+
+    /// <summary>
+    /// Sets a root shader resource view slot to the specified structured buffer
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsShaderResourceView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    virtual void SetShaderResourceView(UINT slot, const StructuredBuffer& buffer, UINT element_offset = 0) = 0;
+
+    /// <summary>
+    /// Sets a root shader resource view slot to the specified GPU-only structured buffer
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsShaderResourceView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    virtual void SetShaderResourceView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset = 0) = 0;
+
+    /// <summary>
+    /// Sets a root unordered access view slot to the specified GPU-only structured buffer.  The buffer must have been
+    /// made writable with StructuredBufferToUnorderedAccess
+    /// </summary>
+    /// <param name="slot">
+    /// index of the slot that was configured with SetParamAsUnorderedAccessView
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to use
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    virtual void SetUnorderedAccessView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset = 0) = 0;
+
+    /// <summary>
+    /// Makes a GPU-only structured buffer writable through an unordered access view
+    /// </summary>
+    /// <param name="buffer">
+    /// structured buffer
+    /// </param>
+    virtual void StructuredBufferToUnorderedAccess(const StructuredBufferGPU& buffer) = 0;
+
+    /// <summary>
+    /// Makes a structured buffer that previously had StructuredBufferToUnorderedAccess called on it readable through
+    /// a shader resource view again
+    /// </summary>
+    /// <param name="buffer">
+    /// structured buffer
+    /// </param>
+    virtual void UnorderedAccessToStructuredBuffer(const StructuredBufferGPU& buffer) = 0;
+
     /// <summary>
     /// Sets the root signature descriptor table to use the specified texture as the start of the descriptor table
     /// <remarks>
@@ -532,6 +635,38 @@ class CommandList
       /// </param>
       virtual void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, UINT instance_cnt, UINT instance_start_index) = 0;
 
+      /// <summary>
+      /// Draws instances of indexed primitives whose indices are relative to a base vertex.  Used to draw meshes that were
+      /// split into chunks of 16bit indices
+      /// </summary>
+      /// <param name="indices_per_instance">
+      /// number of indices for each instance
+      /// </param>
+      /// <param name="index_start_index">
+      /// index in the index buffer to start at
+      /// </param>
+      /// <param name="base_vertex">
+      /// value added to each index before reading from the vertex buffers
+      /// </param>
+      /// <param name="instance_cnt">
+      /// number of instances
+      /// </param>
+      /// <param name="instance_start_index">
+      /// index in the instance buffer to start at
+      /// </param>
+      virtual void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, INT base_vertex, UINT instance_cnt, UINT instance_start_index) = 0;
+
+      /// <summary>
+      /// Issues a series of indexed draws, such as the ranges left after culling the clusters of a mesh
+      /// </summary>
+      /// <param name="draws">
+      /// arguments of each draw
+      /// </param>
+      /// <param name="num_draws">
+      /// number of entries in draws
+      /// </param>
+      virtual void DrawIndexedInstanced(const DrawIndexedArgs* draws, UINT num_draws) = 0;
+
       /// <summary>
       /// Draws instances of primitives
       /// </summary>
@@ -0,0 +1,21 @@
+#ifndef DRAW_INDEXED_ARGS_H
+#define DRAW_INDEXED_ARGS_H
+
+#include <windows.h>
+
+/// <summary>
+/// Arguments of an indexed draw call, matching the parameters of CommandList::DrawIndexedInstanced
+/// </summary>
+/// <remarks>
+/// Layout must match D3D12_DRAW_INDEXED_ARGUMENTS so arrays of these can be uploaded as indirect arguments
+/// </remarks>
+struct DrawIndexedArgs
+{
+  UINT indices_per_instance;
+  UINT instance_cnt;
+  UINT index_start_index;
+  INT  base_vertex;
+  UINT instance_start_index;
+};
+
+#endif /* DRAW_INDEXED_ARGS_H */
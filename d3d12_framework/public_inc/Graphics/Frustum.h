@@ -0,0 +1,99 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <windows.h>
+#include <directxmath.h>
+
+/// <summary>
+/// Planes bounding the volume a camera can see, for culling objects on the CPU
+/// </summary>
+class Frustum
+{
+  public:
+    /// <summary>
+    /// Number of planes in a frustum
+    /// </summary>
+    static const UINT NUM_PLANES = 6;
+
+    /// <summary>
+    /// Extracts the frustum of a camera.  Objects tested against the frustum must be in the space the view matrix
+    /// transforms from, so pass world * view to test object space bounds.
+    /// </summary>
+    /// <param name="view">
+    /// view matrix of the camera, as created by XMMatrixLookAtLH
+    /// </param>
+    /// <param name="proj">
+    /// projection matrix of the camera, as created by XMMatrixPerspectiveFovLH or XMMatrixOrthographicLH
+    /// </param>
+    Frustum(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& proj);
+
+    /// <summary>
+    /// Extracts the frustum of a camera from the matrices returned by its GetView and GetProjection
+    /// </summary>
+    /// <param name="view">
+    /// view matrix of the camera
+    /// </param>
+    /// <param name="proj">
+    /// projection matrix of the camera
+    /// </param>
+    Frustum(DirectX::FXMMATRIX view, DirectX::CXMMATRIX proj);
+
+    /// <summary>
+    /// Checks if a sphere is at least partly inside of the frustum
+    /// </summary>
+    /// <param name="center">
+    /// center of the sphere
+    /// </param>
+    /// <param name="radius">
+    /// radius of the sphere
+    /// </param>
+    /// <returns>
+    /// true if the sphere may be visible, false if it is entirely outside of the frustum
+    /// </returns>
+    bool IntersectsSphere(const DirectX::XMFLOAT3& center, float radius) const;
+
+    /// <summary>
+    /// Checks if an axis aligned box is at least partly inside of the frustum.  Boxes near the corners of the
+    /// frustum that are outside of it but not entirely behind any 1 plane are reported as visible
+    /// </summary>
+    /// <param name="center">
+    /// center of the box
+    /// </param>
+    /// <param name="extents">
+    /// distance from the center to the faces of the box along each axis
+    /// </param>
+    /// <returns>
+    /// true if the box may be visible, false if it is entirely outside of the frustum
+    /// </returns>
+    bool IntersectsBox(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents) const;
+
+    /// <summary>
+    /// Retrieves a plane of the frustum
+    /// </summary>
+    /// <param name="index">
+    /// index of the plane, in the order left, right, bottom, top, near, far
+    /// </param>
+    /// <returns>
+    /// normalized plane, with the normal in xyz pointing into the frustum and the distance in w
+    /// </returns>
+    const DirectX::XMFLOAT4& GetPlane(UINT index) const;
+
+  private:
+    /// <summary>
+    /// Extracts the planes from the camera's matrices
+    /// </summary>
+    /// <param name="view">
+    /// view matrix of the camera
+    /// </param>
+    /// <param name="proj">
+    /// projection matrix of the camera
+    /// </param>
+    void ExtractPlanes(const DirectX::XMFLOAT4X4& view, const DirectX::XMFLOAT4X4& proj);
+
+    /// <summary>
+    /// planes of the frustum
+    /// </summary>
+    DirectX::XMFLOAT4 m_planes[NUM_PLANES];
+};
+
+#endif /* FRUSTUM_H */
@@ -0,0 +1,133 @@
+#ifndef FRUSTUM_CULLER_H
+#define FRUSTUM_CULLER_H
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/Frustum.h"
+
+/// <summary>
+/// Bounding spheres of a set of objects.  Each array has 1 entry per object so culling reads 4 or 8 objects with
+/// each load.
+/// </summary>
+struct BoundingSphereTable
+{
+  /// <summary>
+  /// x coordinate of the center of each sphere
+  /// </summary>
+  std::vector<float> center_x;
+
+  /// <summary>
+  /// y coordinate of the center of each sphere
+  /// </summary>
+  std::vector<float> center_y;
+
+  /// <summary>
+  /// z coordinate of the center of each sphere
+  /// </summary>
+  std::vector<float> center_z;
+
+  /// <summary>
+  /// radius of each sphere
+  /// </summary>
+  std::vector<float> radius;
+};
+
+/// <summary>
+/// Axis aligned bounding boxes of a set of objects, stored as centers and extents.  Each array has 1 entry per object
+/// so culling reads 4 or 8 objects with each load.
+/// </summary>
+struct BoundingBoxTable
+{
+  /// <summary>
+  /// x coordinate of the center of each box
+  /// </summary>
+  std::vector<float> center_x;
+
+  /// <summary>
+  /// y coordinate of the center of each box
+  /// </summary>
+  std::vector<float> center_y;
+
+  /// <summary>
+  /// z coordinate of the center of each box
+  /// </summary>
+  std::vector<float> center_z;
+
+  /// <summary>
+  /// half of the width of each box along x
+  /// </summary>
+  std::vector<float> extent_x;
+
+  /// <summary>
+  /// half of the height of each box along y
+  /// </summary>
+  std::vector<float> extent_y;
+
+  /// <summary>
+  /// half of the depth of each box along z
+  /// </summary>
+  std::vector<float> extent_z;
+};
+
+/// <summary>
+/// Tests many bounding volumes against a frustum at once.  Volumes are tested 4 at a time with SSE2, or 8 at a time
+/// when the framework is built with AVX2 enabled, and large tables are split across the framework's worker threads.
+/// </summary>
+class FrustumCuller
+{
+  public:
+    /// <summary>
+    /// Number of objects in each piece of a table that is culled on a worker thread.  Tables with fewer objects than
+    /// this are culled on the calling thread only
+    /// </summary>
+    static const UINT CHUNK_SIZE = 16384;
+
+    /// <summary>
+    /// Finds the spheres that are at least partly inside of the frustum
+    /// </summary>
+    /// <param name="frustum">
+    /// frustum in the same space as the spheres
+    /// </param>
+    /// <param name="spheres">
+    /// spheres to test.  Every array must have the same size
+    /// </param>
+    /// <param name="visible">
+    /// output parameter for the indices of the visible spheres, in increasing order.  Replaces the contents
+    /// </param>
+    /// <returns>
+    /// number of visible spheres
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the arrays of the table have different sizes
+    /// </exception>
+    static UINT CullSpheres(const Frustum& frustum, const BoundingSphereTable& spheres, std::vector<UINT>& visible);
+
+    /// <summary>
+    /// Finds the boxes that are at least partly inside of the frustum.  Matches Frustum::IntersectsBox, so boxes
+    /// near the corners of the frustum may be reported as visible
+    /// </summary>
+    /// <param name="frustum">
+    /// frustum in the same space as the boxes
+    /// </param>
+    /// <param name="boxes">
+    /// boxes to test.  Every array must have the same size
+    /// </param>
+    /// <param name="visible">
+    /// output parameter for the indices of the visible boxes, in increasing order.  Replaces the contents
+    /// </param>
+    /// <returns>
+    /// number of visible boxes
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the arrays of the table have different sizes
+    /// </exception>
+    static UINT CullBoxes(const Frustum& frustum, const BoundingBoxTable& boxes, std::vector<UINT>& visible);
+
+  private:
+    // disabled
+    FrustumCuller();
+    FrustumCuller(const FrustumCuller& cpy);
+    FrustumCuller& operator=(const FrustumCuller& cpy);
+};
+
+#endif /* FRUSTUM_CULLER_H */
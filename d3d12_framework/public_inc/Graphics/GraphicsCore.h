@@ -70,7 +70,26 @@ class GraphicsCore
     /// Waits for the fence for the default command queue to indicate that the command queue has finished
     /// </summary>
     virtual void WaitOnFence() = 0;
-    
+
+    /// <summary>
+    /// Signals the fence for the default command queue without waiting for it
+    /// </summary>
+    /// <returns>
+    /// fence value that indicates every command list executed so far has finished
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual UINT64 SignalFence() = 0;
+
+    /// <summary>
+    /// Retrieves the last value the fence for the default command queue has reached.  Does not block
+    /// </summary>
+    /// <returns>
+    /// completed fence value
+    /// </returns>
+    virtual UINT64 GetCompletedFenceValue() const = 0;
+
     /// <summary>
     /// Swaps the back and front buffers to display the frame to the user
     /// </summary>
@@ -129,6 +148,29 @@ class GraphicsCore
     /// </exception>
     virtual UINT CheckSupportedMultisampleLevels(GraphicsDataFormat format, UINT sample_count, bool tiled) const = 0;
 
+    /// <summary>
+    /// Adds the serialized root signatures stored in a file to the root signature cache, so root signatures created
+    /// afterwards with a matching config skip serialization.  A missing file is ignored
+    /// </summary>
+    /// <param name="path">
+    /// path to a file written by SaveRootSignatureCache
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file exists but is not a valid cache file
+    /// </exception>
+    virtual void LoadRootSignatureCache(const char* path) = 0;
+
+    /// <summary>
+    /// Writes the serialized form of every root signature created so far to a file
+    /// </summary>
+    /// <param name="path">
+    /// path to the file to write
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file could not be written
+    /// </exception>
+    virtual void SaveRootSignatureCache(const char* path) const = 0;
+
   protected:
     GraphicsCore();
     
@@ -10,13 +10,47 @@
 enum GraphicsDataFormat
 {
   R32G32B32A32_FLOAT = 2,
+  R32G32B32A32_UINT  = 3,
+  R32G32B32A32_SINT  = 4,
   R32G32B32_FLOAT    = 6,
+  R32G32B32_UINT     = 7,
+  R32G32B32_SINT     = 8,
+  R16G16B16A16_FLOAT = 10,
+  R16G16B16A16_SNORM = 13,
   R32G32_FLOAT       = 16,
+  R32G32_UINT        = 17,
+  R32G32_SINT        = 18,
   D32_FLOAT_S8_UINT  = 20,
+  R10G10B10A2_UNORM  = 24,
   R8B8G8A8_UNORM     = 28,
+  R8G8B8A8_UNORM_SRGB = 29,
+  R8G8B8A8_SNORM     = 31,
+  R16G16_FLOAT       = 34,
+  R16G16_SNORM       = 37,
   D32_FLOAT          = 40,
   R32_FLOAT          = 41,
   R32_UINT           = 42,
+  R32_SINT           = 43,
+  R8G8_UNORM         = 49,
+  R8G8_SNORM         = 51,
+  R16_UINT           = 57,
+  R8_UNORM           = 61,
+  BC1_UNORM          = 71,
+  BC1_UNORM_SRGB     = 72,
+  BC2_UNORM          = 74,
+  BC2_UNORM_SRGB     = 75,
+  BC3_UNORM          = 77,
+  BC3_UNORM_SRGB     = 78,
+  BC4_UNORM          = 80,
+  BC4_SNORM          = 81,
+  BC5_UNORM          = 83,
+  BC5_SNORM          = 84,
+  B8G8R8A8_UNORM     = 87,
+  B8G8R8A8_UNORM_SRGB = 91,
+  BC6H_UF16          = 95,
+  BC6H_SF16          = 96,
+  BC7_UNORM          = 98,
+  BC7_UNORM_SRGB     = 99,
   // todo: fill in the rest
 };
 
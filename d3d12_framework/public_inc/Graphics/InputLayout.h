@@ -4,6 +4,7 @@
 #include <windows.h>
 #include "Graphics/Semantics.h"
 #include "Graphics/GraphicsDataFormat.h"
+#include "Graphics/VertexDeclarations/VertexTraits.h"
 
 /// <summary>
 /// Describes the input layout for a vertex shader
@@ -23,6 +24,32 @@ class InputLayout
     /// </returns>
     static InputLayout* CreateD3D12(UINT num);
 
+    /// <summary>
+    /// Creates a D3D12 input layout for per vertex data of type TVertex, using the elements described by
+    /// VertexTraits&lt;TVertex&gt;
+    /// </summary>
+    /// <param name="input_slot">
+    /// input slot the vertex buffer is bound to
+    /// </param>
+    /// <returns>
+    /// pointer to the input layout instance
+    /// </returns>
+    template <class TVertex>
+    static InputLayout* CreateD3D12(UINT input_slot = 0)
+    {
+      InputLayout* layout = CreateD3D12((UINT)VertexTraits<TVertex>::num_elements);
+      try
+      {
+        layout->SetNextElements<TVertex>(input_slot, false);
+      }
+      catch (...)
+      {
+        delete layout;
+        throw;
+      }
+      return layout;
+    }
+
     virtual ~InputLayout();
     
     /// <summary>
@@ -60,6 +87,33 @@ class InputLayout
     /// </param>
     virtual void SetNextElement(Semantics semantic, UINT index, GraphicsDataFormat format, UINT input_slot, bool instance, UINT step_rate = 1) = 0;
 
+    /// <summary>
+    /// Sets the input element descriptions of the next entries in the layout to the elements of TVertex, as described
+    /// by VertexTraits&lt;TVertex&gt;.  Uses VertexTraits&lt;TVertex&gt;::num_elements entries
+    /// </summary>
+    /// <param name="input_slot">
+    /// input slot to use
+    /// </param>
+    /// <param name="instance">
+    /// true if this is for per instance data
+    /// false for per vertex
+    /// </param>
+    /// <param name="step_rate">
+    /// number of instances to draw before moving to the next instance specific data
+    /// <remarks>
+    /// only needs to be specified if instance is true
+    /// </remarks>
+    /// </param>
+    template <class TVertex>
+    void SetNextElements(UINT input_slot, bool instance, UINT step_rate = 1)
+    {
+      const VertexElementDesc* elements = VertexTraits<TVertex>::GetElements();
+      for (UINT i = 0; i < (UINT)VertexTraits<TVertex>::num_elements; ++i)
+      {
+        SetNextElement(elements[i].semantic, elements[i].index, elements[i].format, input_slot, instance, step_rate);
+      }
+    }
+
   protected:
     InputLayout();
     
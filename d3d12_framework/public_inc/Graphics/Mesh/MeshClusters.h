@@ -0,0 +1,148 @@
+#ifndef MESH_CLUSTERS_H
+#define MESH_CLUSTERS_H
+
+#include <windows.h>
+#include <vector>
+#include <directxmath.h>
+#include "Graphics/Frustum.h"
+#include "Graphics/DrawIndexedArgs.h"
+
+/// <summary>
+/// Clusters of a mesh along with the data needed to cull them.  Each array has 1 entry per cluster so culling reads
+/// only the values it tests, in order.
+/// </summary>
+struct ClusterTable
+{
+  /// <summary>
+  /// x coordinate of the center of each cluster's bounding sphere
+  /// </summary>
+  std::vector<float> center_x;
+
+  /// <summary>
+  /// y coordinate of the center of each cluster's bounding sphere
+  /// </summary>
+  std::vector<float> center_y;
+
+  /// <summary>
+  /// z coordinate of the center of each cluster's bounding sphere
+  /// </summary>
+  std::vector<float> center_z;
+
+  /// <summary>
+  /// radius of each cluster's bounding sphere
+  /// </summary>
+  std::vector<float> radius;
+
+  /// <summary>
+  /// x component of the average facing of each cluster's triangles
+  /// </summary>
+  std::vector<float> cone_axis_x;
+
+  /// <summary>
+  /// y component of the average facing of each cluster's triangles
+  /// </summary>
+  std::vector<float> cone_axis_y;
+
+  /// <summary>
+  /// z component of the average facing of each cluster's triangles
+  /// </summary>
+  std::vector<float> cone_axis_z;
+
+  /// <summary>
+  /// sine of the angle between each cluster's cone axis and its triangle that faces furthest from it.  1 for
+  /// clusters whose triangles face too many directions to ever be backface culled
+  /// </summary>
+  std::vector<float> cone_cutoff;
+
+  /// <summary>
+  /// index in indices of the first index of each cluster
+  /// </summary>
+  std::vector<UINT> first_index;
+
+  /// <summary>
+  /// number of indices in each cluster
+  /// </summary>
+  std::vector<UINT> num_indices;
+
+  /// <summary>
+  /// triangle list indices of the mesh, reordered so each cluster's triangles are contiguous.  Replaces the mesh's
+  /// original index buffer, the vertex buffer is unchanged
+  /// </summary>
+  std::vector<UINT> indices;
+};
+
+/// <summary>
+/// Splits meshes into small clusters of nearby triangles that can be culled individually on the CPU, so large meshes
+/// only draw the parts that may be visible
+/// </summary>
+class MeshClusters
+{
+  public:
+    /// <summary>
+    /// Largest number of unique vertices in a cluster
+    /// </summary>
+    static const UINT MAX_VERTICES = 64;
+
+    /// <summary>
+    /// Largest number of triangles in a cluster
+    /// </summary>
+    static const UINT MAX_TRIANGLES = 124;
+
+    /// <summary>
+    /// Splits a mesh into clusters.  Clusters are grown from neighboring triangles, preferring triangles that add
+    /// the fewest new vertices, so they stay compact and face similar directions.
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices of the mesh
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="positions">
+    /// position of the first vertex.  Each position is 3 floats
+    /// </param>
+    /// <param name="position_stride">
+    /// number of bytes between consecutive positions
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices in the mesh
+    /// </param>
+    /// <param name="clusters">
+    /// output parameter for the clusters and their reordered indices
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static void Build(const UINT* indices, UINT num_indices, const void* positions, UINT position_stride, UINT num_vertices,
+      ClusterTable& clusters);
+
+    /// <summary>
+    /// Culls the clusters that are outside of the frustum or face entirely away from the camera, and merges the
+    /// remaining clusters that are next to each other in the index buffer into as few draws as possible
+    /// </summary>
+    /// <param name="clusters">
+    /// clusters of the mesh
+    /// </param>
+    /// <param name="frustum">
+    /// frustum in the same space as the mesh's positions
+    /// </param>
+    /// <param name="camera_position">
+    /// position of the camera in the same space as the mesh's positions
+    /// </param>
+    /// <param name="draws">
+    /// output parameter for the draws of the visible clusters, using the cluster table's indices.  Cleared first
+    /// </param>
+    /// <returns>
+    /// number of clusters that are visible
+    /// </returns>
+    static UINT Cull(const ClusterTable& clusters, const Frustum& frustum, const DirectX::XMFLOAT3& camera_position,
+      std::vector<DrawIndexedArgs>& draws);
+
+  private:
+    // disabled
+    MeshClusters();
+    MeshClusters(const MeshClusters& cpy);
+    MeshClusters& operator=(const MeshClusters& cpy);
+};
+
+#endif /* MESH_CLUSTERS_H */
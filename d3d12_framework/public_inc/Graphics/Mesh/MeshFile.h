@@ -0,0 +1,277 @@
+#ifndef MESH_FILE_H
+#define MESH_FILE_H
+
+class CommandList;
+
+#include <windows.h>
+#include <directxmath.h>
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/InputLayout.h"
+#include "Graphics/Buffers/VertexBuffer_Custom.h"
+#include "Graphics/Buffers/VertexBufferGPU_Custom.h"
+#include "Graphics/Buffers/IndexBuffer.h"
+
+/// <summary>
+/// Range of a mesh's indices that is drawn with 1 material
+/// </summary>
+struct MeshSubmesh
+{
+  /// <summary>
+  /// index in the index buffer of the first index of the submesh
+  /// </summary>
+  UINT first_index;
+
+  /// <summary>
+  /// number of indices in the submesh
+  /// </summary>
+  UINT num_indices;
+
+  /// <summary>
+  /// smallest corner of the box enclosing the submesh
+  /// </summary>
+  DirectX::XMFLOAT3 bounds_min;
+
+  /// <summary>
+  /// largest corner of the box enclosing the submesh
+  /// </summary>
+  DirectX::XMFLOAT3 bounds_max;
+};
+
+/// <summary>
+/// Read only binary mesh, built by tools/obj_to_mesh.  The file is memory mapped and its vertex and index data are
+/// stored in the layout the GPU reads, so creating buffers from it is a single copy from the mapping into the upload
+/// buffer
+/// </summary>
+class MeshFile
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified mesh file and validates its layout
+    /// </summary>
+    /// <param name="path">
+    /// path to the mesh file to open
+    /// </param>
+    /// <returns>
+    /// pointer to the MeshFile instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped or is not a valid mesh file
+    /// </exception>
+    static MeshFile* OpenD3D12(const char* path);
+
+    /// <summary>
+    /// Unmaps the mesh file.  Buffers created from it are unaffected
+    /// </summary>
+    virtual ~MeshFile();
+
+    /// <summary>
+    /// Retrieves the number of vertices in the mesh
+    /// </summary>
+    /// <returns>
+    /// number of vertices
+    /// </returns>
+    virtual UINT GetNumVertices() const = 0;
+
+    /// <summary>
+    /// Retrieves the size of each vertex
+    /// </summary>
+    /// <returns>
+    /// number of bytes in 1 vertex
+    /// </returns>
+    virtual UINT GetVertexStride() const = 0;
+
+    /// <summary>
+    /// Retrieves the number of elements in each vertex
+    /// </summary>
+    /// <returns>
+    /// number of elements
+    /// </returns>
+    virtual UINT GetNumElements() const = 0;
+
+    /// <summary>
+    /// Retrieves an element of the vertices
+    /// </summary>
+    /// <param name="index">
+    /// index of the element, in input layout order
+    /// </param>
+    /// <returns>
+    /// description of the element
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index is out of range
+    /// </exception>
+    virtual VertexElementDesc GetElement(UINT index) const = 0;
+
+    /// <summary>
+    /// Creates an input layout with the elements of the vertices
+    /// </summary>
+    /// <param name="input_slot">
+    /// input slot the vertex buffer is bound to
+    /// </param>
+    /// <returns>
+    /// pointer to the InputLayout instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual InputLayout* CreateInputLayout(UINT input_slot = 0) const = 0;
+
+    /// <summary>
+    /// Retrieves the number of indices in the mesh
+    /// </summary>
+    /// <returns>
+    /// number of indices
+    /// </returns>
+    virtual UINT GetNumIndices() const = 0;
+
+    /// <summary>
+    /// Retrieves the format of the indices
+    /// </summary>
+    /// <returns>
+    /// R16_UINT or R32_UINT
+    /// </returns>
+    virtual GraphicsDataFormat GetIndexFormat() const = 0;
+
+    /// <summary>
+    /// Retrieves the number of submeshes
+    /// </summary>
+    /// <returns>
+    /// number of submeshes
+    /// </returns>
+    virtual UINT GetNumSubmeshes() const = 0;
+
+    /// <summary>
+    /// Retrieves a submesh
+    /// </summary>
+    /// <param name="index">
+    /// index of the submesh
+    /// </param>
+    /// <returns>
+    /// the submesh
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index is out of range
+    /// </exception>
+    virtual MeshSubmesh GetSubmesh(UINT index) const = 0;
+
+    /// <summary>
+    /// Retrieves the box enclosing the whole mesh
+    /// </summary>
+    /// <param name="bounds_min">
+    /// output parameter for the smallest corner of the box
+    /// </param>
+    /// <param name="bounds_max">
+    /// output parameter for the largest corner of the box
+    /// </param>
+    virtual void GetBounds(DirectX::XMFLOAT3& bounds_min, DirectX::XMFLOAT3& bounds_max) const = 0;
+
+    /// <summary>
+    /// Retrieves the vertex data for processing on the CPU.  Points into the mapping, so it is only valid while the
+    /// mesh file is open
+    /// </summary>
+    /// <returns>
+    /// first vertex
+    /// </returns>
+    virtual const void* GetVertexData() const = 0;
+
+    /// <summary>
+    /// Retrieves the index data for processing on the CPU.  Points into the mapping, so it is only valid while the
+    /// mesh file is open
+    /// </summary>
+    /// <returns>
+    /// first index, either 16 or 32 bits depending on GetIndexFormat
+    /// </returns>
+    virtual const void* GetIndexData() const = 0;
+
+    /// <summary>
+    /// Creates a vertex buffer in upload memory holding the vertices.  It can be drawn from directly or used as the
+    /// source of an upload to the buffer created by CreateVertexBufferGPU
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual VertexBuffer_Custom* CreateVertexBuffer(GraphicsCore& graphics) const = 0;
+
+    /// <summary>
+    /// Creates a vertex buffer in GPU memory that is large enough for the vertices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the vertex buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual VertexBufferGPU_Custom* CreateVertexBufferGPU(GraphicsCore& graphics) const = 0;
+
+    /// <summary>
+    /// Creates an index buffer in upload memory holding the indices.  It can be drawn from directly or used as the
+    /// source of an upload to the buffer created by CreateIndexBufferGPU
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to an IndexBuffer16 or IndexBuffer32 instance, depending on GetIndexFormat
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual IndexBuffer* CreateIndexBuffer(GraphicsCore& graphics) const = 0;
+
+    /// <summary>
+    /// Creates an index buffer in GPU memory that is large enough for the indices
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to an IndexBufferGPU16 or IndexBufferGPU32 instance, depending on GetIndexFormat
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual IndexBuffer* CreateIndexBufferGPU(GraphicsCore& graphics) const = 0;
+
+    /// <summary>
+    /// Adds commands to copy the upload buffers into the GPU buffers
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to add the copies to
+    /// </param>
+    /// <param name="vertices">
+    /// vertex buffer created by CreateVertexBuffer
+    /// </param>
+    /// <param name="vertices_gpu">
+    /// vertex buffer created by CreateVertexBufferGPU
+    /// </param>
+    /// <param name="indices">
+    /// index buffer created by CreateIndexBuffer
+    /// </param>
+    /// <param name="indices_gpu">
+    /// index buffer created by CreateIndexBufferGPU
+    /// </param>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, VertexBuffer_Custom& vertices, const VertexBufferGPU_Custom& vertices_gpu,
+      IndexBuffer& indices, const IndexBuffer& indices_gpu) const = 0;
+
+  protected:
+    MeshFile();
+
+  private:
+    // disabled
+    MeshFile(const MeshFile& cpy);
+    MeshFile& operator=(const MeshFile& cpy);
+};
+
+#endif /* MESH_FILE_H */
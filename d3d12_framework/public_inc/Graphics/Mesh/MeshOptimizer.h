@@ -0,0 +1,228 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <windows.h>
+#include <stddef.h>
+#include <vector>
+
+/// <summary>
+/// Post-transform vertex cache efficiency of an index buffer
+/// </summary>
+struct VertexCacheStats
+{
+  /// <summary>
+  /// average cache miss ratio, the number of vertex shader invocations per triangle.  Ranges from 0.5 for an ideal
+  /// mesh to 3.0 when no vertices are reused
+  /// </summary>
+  float acmr;
+
+  /// <summary>
+  /// average transformed vertex ratio, the number of vertex shader invocations per referenced vertex.  1.0 is ideal
+  /// </summary>
+  float atvr;
+};
+
+/// <summary>
+/// Vertex cache efficiency of a mesh before and after it was optimized
+/// </summary>
+struct MeshOptimizationReport
+{
+  /// <summary>
+  /// statistics of the index buffer as it was provided
+  /// </summary>
+  VertexCacheStats before;
+
+  /// <summary>
+  /// statistics of the optimized index buffer
+  /// </summary>
+  VertexCacheStats after;
+};
+
+/// <summary>
+/// Reorders triangle list meshes so they render faster.  The stages are meant to be run in the order they are
+/// declared, which Optimize does: vertex cache reordering, then overdraw aware cluster ordering, then vertex fetch
+/// remapping.  Everything runs on the CPU, so meshes can be optimized offline or at load time.  Only the basic integer
+/// types are needed from windows.h, which the CPU tests stand in for when they build this on Linux.
+/// </summary>
+class MeshOptimizer
+{
+  public:
+    /// <summary>
+    /// Cache size used when reporting statistics, which roughly matches the post-transform cache of current hardware
+    /// </summary>
+    static const UINT DEFAULT_CACHE_SIZE = 16;
+
+    /// <summary>
+    /// Reorders the triangles of a mesh so vertices are reused while they are still in the post-transform vertex
+    /// cache, using Tom Forsyth's linear-speed vertex cache optimization
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices to reorder in place
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices the indices refer to
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static void OptimizeVertexCache(UINT* indices, UINT num_indices, UINT num_vertices);
+
+    /// <summary>
+    /// Splits a vertex cache optimized mesh into clusters and sorts the clusters so the ones facing away from the
+    /// center of the mesh are drawn first, letting them occlude the rest of the mesh.  The ACMR of the result is at
+    /// most threshold times the input's: when the sorted clusters miss the cache more than that, fewer clusters are
+    /// used, and the input order is kept if that doesn't help either.
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices to reorder in place
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="positions">
+    /// position of the first vertex.  Each position is 3 floats
+    /// </param>
+    /// <param name="position_stride">
+    /// number of bytes between 2 consecutive positions
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices the indices refer to
+    /// </param>
+    /// <param name="threshold">
+    /// how much worse the ACMR may get in exchange for less overdraw.  1.0 keeps the vertex cache efficiency
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static void OptimizeOverdraw(UINT* indices, UINT num_indices, const void* positions, UINT position_stride, UINT num_vertices,
+      float threshold = 1.05f);
+
+    /// <summary>
+    /// Reorders the vertices of a mesh in the order the indices first reference them so vertex fetches walk memory
+    /// linearly, and rewrites the indices to match.  Vertices that aren't referenced are removed.
+    /// </summary>
+    /// <param name="vertices">
+    /// vertices to reorder in place
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices
+    /// </param>
+    /// <param name="vertex_stride">
+    /// number of bytes in 1 vertex
+    /// </param>
+    /// <param name="indices">
+    /// indices to rewrite in place
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices
+    /// </param>
+    /// <returns>
+    /// number of vertices left at the start of vertices
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static UINT OptimizeVertexFetch(void* vertices, UINT num_vertices, UINT vertex_stride, UINT* indices, UINT num_indices);
+
+    /// <summary>
+    /// Simulates a FIFO post-transform vertex cache to measure how often vertices are reused
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices the indices refer to
+    /// </param>
+    /// <param name="cache_size">
+    /// number of entries in the simulated cache
+    /// </param>
+    /// <returns>
+    /// vertex cache statistics
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static VertexCacheStats AnalyzeVertexCache(const UINT* indices, UINT num_indices, UINT num_vertices, UINT cache_size = DEFAULT_CACHE_SIZE);
+
+    /// <summary>
+    /// Runs all optimization stages on a mesh
+    /// </summary>
+    /// <param name="vertices">
+    /// vertices to reorder in place
+    /// </param>
+    /// <param name="num_vertices">
+    /// number of vertices.  Updated with the number of vertices left after unreferenced vertices are removed
+    /// </param>
+    /// <param name="vertex_stride">
+    /// number of bytes in 1 vertex
+    /// </param>
+    /// <param name="position_offset">
+    /// byte offset of the 3 float position in each vertex
+    /// </param>
+    /// <param name="indices">
+    /// triangle list indices to reorder in place
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="overdraw_threshold">
+    /// how much worse the ACMR may get in exchange for less overdraw
+    /// </param>
+    /// <returns>
+    /// vertex cache statistics before and after the optimization
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static MeshOptimizationReport Optimize(void* vertices, UINT& num_vertices, UINT vertex_stride, UINT position_offset, UINT* indices,
+      UINT num_indices, float overdraw_threshold = 1.05f);
+
+    /// <summary>
+    /// Runs all optimization stages on a mesh made of the framework's vertex declarations, or any vertex structure
+    /// with a DirectX::XMFLOAT3 pos member
+    /// </summary>
+    /// <param name="vertices">
+    /// vertices to reorder.  Unreferenced vertices are removed
+    /// </param>
+    /// <param name="indices">
+    /// triangle list indices to reorder
+    /// </param>
+    /// <param name="overdraw_threshold">
+    /// how much worse the ACMR may get in exchange for less overdraw
+    /// </param>
+    /// <returns>
+    /// vertex cache statistics before and after the optimization
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    template <class TVertex>
+    static MeshOptimizationReport Optimize(std::vector<TVertex>& vertices, std::vector<UINT>& indices, float overdraw_threshold = 1.05f)
+    {
+      MeshOptimizationReport report = { { 0, 0 }, { 0, 0 } };
+      if (vertices.empty() || indices.empty())
+      {
+        return report;
+      }
+
+      UINT num_vertices = (UINT)vertices.size();
+      report = Optimize(&vertices[0], num_vertices, sizeof(TVertex), offsetof(TVertex, pos), &indices[0], (UINT)indices.size(),
+        overdraw_threshold);
+      vertices.resize(num_vertices);
+      return report;
+    }
+
+  private:
+    // disabled
+    MeshOptimizer();
+    MeshOptimizer(const MeshOptimizer& cpy);
+    MeshOptimizer& operator=(const MeshOptimizer& cpy);
+};
+
+#endif /* MESH_OPTIMIZER_H */
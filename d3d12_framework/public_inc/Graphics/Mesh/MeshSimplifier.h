@@ -0,0 +1,204 @@
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include <windows.h>
+#include <vector>
+#include <directxmath.h>
+
+/// <summary>
+/// Offset to use in SimplifierVertexLayout for attributes the vertices don't have
+/// </summary>
+static const UINT SIMPLIFIER_ATTRIBUTE_NONE = 0xFFFFFFFF;
+
+/// <summary>
+/// Describes where the simplifier finds the attributes of each vertex
+/// </summary>
+struct SimplifierVertexLayout
+{
+  /// <summary>
+  /// first vertex
+  /// </summary>
+  const void* vertices;
+
+  /// <summary>
+  /// number of vertices
+  /// </summary>
+  UINT num_vertices;
+
+  /// <summary>
+  /// number of bytes in 1 vertex
+  /// </summary>
+  UINT stride;
+
+  /// <summary>
+  /// byte offset of the 3 float position in each vertex
+  /// </summary>
+  UINT position_offset;
+
+  /// <summary>
+  /// byte offset of the 2 float uv coordinates in each vertex, or SIMPLIFIER_ATTRIBUTE_NONE
+  /// </summary>
+  UINT uv_offset;
+
+  /// <summary>
+  /// byte offset of the 3 float normal in each vertex, or SIMPLIFIER_ATTRIBUTE_NONE
+  /// </summary>
+  UINT normal_offset;
+
+  /// <summary>
+  /// how much uv differences count compared to position differences, with positions scaled to fit a unit cube
+  /// </summary>
+  float uv_weight;
+
+  /// <summary>
+  /// how much normal differences count compared to position differences, with positions scaled to fit a unit cube
+  /// </summary>
+  float normal_weight;
+};
+
+/// <summary>
+/// 1 level of detail of a mesh, stored as a range of a shared index buffer
+/// </summary>
+struct MeshLOD
+{
+  /// <summary>
+  /// index in the index buffer of the first index of the level
+  /// </summary>
+  UINT first_index;
+
+  /// <summary>
+  /// number of indices in the level
+  /// </summary>
+  UINT num_indices;
+
+  /// <summary>
+  /// approximate distance, in the units of the vertex positions, the level deviates from the full detail mesh.  Only
+  /// positions count towards it, so it can be compared against a screen space distance
+  /// </summary>
+  float error;
+};
+
+/// <summary>
+/// Reduces the number of triangles in triangle list meshes using quadric error metrics.  Each quadric covers the
+/// positions and, when present, uvs and normals of the vertices so attributes are preserved along with the shape.
+/// Edges are collapsed into one of their existing vertices, so simplified meshes reuse the original vertex buffer.
+/// Vertices on open borders and attribute seams, where vertices share a position but not their other attributes,
+/// are never removed.
+/// </summary>
+class MeshSimplifier
+{
+  public:
+    /// <summary>
+    /// Simplifies a mesh
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices of the mesh
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="layout">
+    /// vertices the indices refer to
+    /// </param>
+    /// <param name="target_num_indices">
+    /// number of indices to reduce the mesh to
+    /// </param>
+    /// <param name="max_error">
+    /// largest distance, in the units of the vertex positions, a collapse may move the surface.  Only positions count
+    /// towards it, uv and normal differences just affect the order of the collapses.  FLT_MAX to only stop at the
+    /// target
+    /// </param>
+    /// <param name="dst">
+    /// where to write the indices of the simplified mesh.  Must have room for num_indices entries
+    /// </param>
+    /// <param name="result_error">
+    /// optional output parameter for the largest distance, in the units of the vertex positions, a collapse moved the
+    /// surface
+    /// </param>
+    /// <param name="result_attribute_error">
+    /// optional output parameter for the largest error of a collapse including the uv and normal terms.  It is
+    /// relative to the size of the mesh and mixes in the attribute weights, so it is only useful for comparing
+    /// simplifications of the same mesh
+    /// </param>
+    /// <returns>
+    /// number of indices written to dst
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static UINT Simplify(const UINT* indices, UINT num_indices, const SimplifierVertexLayout& layout, UINT target_num_indices, float max_error,
+      UINT* dst, float* result_error = NULL, float* result_attribute_error = NULL);
+
+    /// <summary>
+    /// Generates a chain of levels of detail, each a simplification of the previous one.  Level 0 is the original
+    /// mesh.  Generation stops early once a level can't be reduced much further.
+    /// </summary>
+    /// <param name="indices">
+    /// triangle list indices of the mesh
+    /// </param>
+    /// <param name="num_indices">
+    /// number of entries in indices.  Must be a multiple of 3
+    /// </param>
+    /// <param name="layout">
+    /// vertices the indices refer to
+    /// </param>
+    /// <param name="max_lods">
+    /// largest number of levels to generate, including level 0
+    /// </param>
+    /// <param name="reduction">
+    /// fraction of the previous level's indices each level is reduced to
+    /// </param>
+    /// <param name="max_error">
+    /// largest distance, in the units of the vertex positions, a single level may move the surface
+    /// </param>
+    /// <param name="lod_indices">
+    /// output parameter for the indices of all of the levels, one after the other
+    /// </param>
+    /// <param name="lods">
+    /// output parameter for the range of lod_indices each level uses, from most to least detailed
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    static void GenerateLODs(const UINT* indices, UINT num_indices, const SimplifierVertexLayout& layout, UINT max_lods, float reduction,
+      float max_error, std::vector<UINT>& lod_indices, std::vector<MeshLOD>& lods);
+
+    /// <summary>
+    /// Picks the least detailed level whose error covers at most the specified number of pixels on screen
+    /// </summary>
+    /// <param name="lods">
+    /// levels of detail, from most to least detailed
+    /// </param>
+    /// <param name="num_lods">
+    /// number of entries in lods
+    /// </param>
+    /// <param name="center">
+    /// world space center of the mesh.  Errors are assumed to be in world units, so for a scaled mesh either scale
+    /// max_pixel_error by the inverse of the scale or generate the levels from scaled positions
+    /// </param>
+    /// <param name="view">
+    /// view matrix of the camera, as created by XMMatrixLookAtLH
+    /// </param>
+    /// <param name="proj">
+    /// projection matrix of the camera, as created by XMMatrixPerspectiveFovLH
+    /// </param>
+    /// <param name="viewport_height">
+    /// height of the viewport in pixels
+    /// </param>
+    /// <param name="max_pixel_error">
+    /// number of pixels the error of the chosen level may cover
+    /// </param>
+    /// <returns>
+    /// index of the level to draw
+    /// </returns>
+    static UINT SelectLOD(const MeshLOD* lods, UINT num_lods, const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT4X4& view,
+      const DirectX::XMFLOAT4X4& proj, float viewport_height, float max_pixel_error = 1.0f);
+
+  private:
+    // disabled
+    MeshSimplifier();
+    MeshSimplifier(const MeshSimplifier& cpy);
+    MeshSimplifier& operator=(const MeshSimplifier& cpy);
+};
+
+#endif /* MESH_SIMPLIFIER_H */
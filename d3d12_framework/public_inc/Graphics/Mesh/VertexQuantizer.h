@@ -0,0 +1,212 @@
+#ifndef VERTEX_QUANTIZER_H
+#define VERTEX_QUANTIZER_H
+
+#include <windows.h>
+#include <directxmath.h>
+#include "Graphics/VertexDeclarations/Vertex_Position.h"
+#include "Graphics/VertexDeclarations/Vertex_PositionTexture.h"
+#include "Graphics/VertexDeclarations/Vertex_Quantized.h"
+
+/// <summary>
+/// Box that quantized positions are relative to.  Shaders decode a position with pos.xyz * extents + center
+/// </summary>
+struct QuantizationBounds
+{
+  /// <summary>
+  /// center of the box
+  /// </summary>
+  DirectX::XMFLOAT3 center;
+
+  /// <summary>
+  /// half the size of the box along each axis
+  /// </summary>
+  DirectX::XMFLOAT3 extents;
+};
+
+/// <summary>
+/// Encodes vertex attributes into the compact formats used by the declarations in Vertex_Quantized.h.  The encoders
+/// work on strided arrays so they can read from and write to the middle of interleaved vertices, and use SSE2 to
+/// encode several values at once
+/// </summary>
+class VertexQuantizer
+{
+  public:
+    /// <summary>
+    /// Computes the box that encloses a set of positions
+    /// </summary>
+    /// <param name="positions">
+    /// first position.  Each position is 3 floats
+    /// </param>
+    /// <param name="stride">
+    /// number of bytes between 2 consecutive positions
+    /// </param>
+    /// <param name="num">
+    /// number of positions
+    /// </param>
+    /// <returns>
+    /// bounds enclosing the positions
+    /// </returns>
+    static QuantizationBounds ComputeBounds(const void* positions, UINT stride, UINT num);
+
+    /// <summary>
+    /// Encodes positions as 4 16bit normalized integers relative to a bounding box.  The 4th component is always 1
+    /// </summary>
+    /// <param name="src">
+    /// first position to encode.  Each position is 3 floats
+    /// </param>
+    /// <param name="src_stride">
+    /// number of bytes between 2 consecutive source positions
+    /// </param>
+    /// <param name="num">
+    /// number of positions to encode
+    /// </param>
+    /// <param name="bounds">
+    /// box the positions are encoded relative to.  Positions outside of it are clamped to it
+    /// </param>
+    /// <param name="dst">
+    /// where to write the first encoded position.  Each encoded position is 4 INT16s
+    /// </param>
+    /// <param name="dst_stride">
+    /// number of bytes between 2 consecutive encoded positions
+    /// </param>
+    static void EncodePositions(const void* src, UINT src_stride, UINT num, const QuantizationBounds& bounds, void* dst, UINT dst_stride);
+
+    /// <summary>
+    /// Encodes pairs of floats, such as uv coordinates, as half floats
+    /// </summary>
+    /// <param name="src">
+    /// first pair to encode.  Each pair is 2 floats
+    /// </param>
+    /// <param name="src_stride">
+    /// number of bytes between 2 consecutive source pairs
+    /// </param>
+    /// <param name="num">
+    /// number of pairs to encode
+    /// </param>
+    /// <param name="dst">
+    /// where to write the first encoded pair.  Each encoded pair is 2 UINT16s
+    /// </param>
+    /// <param name="dst_stride">
+    /// number of bytes between 2 consecutive encoded pairs
+    /// </param>
+    static void EncodeHalf2(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride);
+
+    /// <summary>
+    /// Encodes unit vectors with an octahedral mapping, stored as 2 8bit normalized integers
+    /// </summary>
+    /// <param name="src">
+    /// first normal to encode.  Each normal is 3 floats and doesn't need to be normalized
+    /// </param>
+    /// <param name="src_stride">
+    /// number of bytes between 2 consecutive source normals
+    /// </param>
+    /// <param name="num">
+    /// number of normals to encode
+    /// </param>
+    /// <param name="dst">
+    /// where to write the first encoded normal.  Each encoded normal is 2 INT8s
+    /// </param>
+    /// <param name="dst_stride">
+    /// number of bytes between 2 consecutive encoded normals
+    /// </param>
+    static void EncodeOctahedralSNORM8(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride);
+
+    /// <summary>
+    /// Encodes unit vectors with an octahedral mapping, stored in the x and y channels of a 10:10:10:2 normalized
+    /// integer
+    /// </summary>
+    /// <param name="src">
+    /// first normal to encode.  Each normal is 3 floats and doesn't need to be normalized
+    /// </param>
+    /// <param name="src_stride">
+    /// number of bytes between 2 consecutive source normals
+    /// </param>
+    /// <param name="num">
+    /// number of normals to encode
+    /// </param>
+    /// <param name="dst">
+    /// where to write the first encoded normal.  Each encoded normal is 1 UINT
+    /// </param>
+    /// <param name="dst_stride">
+    /// number of bytes between 2 consecutive encoded normals
+    /// </param>
+    static void EncodeOctahedral1010102(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride);
+
+    /// <summary>
+    /// Quantizes vertices that are comprised of just a position
+    /// </summary>
+    /// <param name="src">
+    /// vertices to quantize
+    /// </param>
+    /// <param name="num">
+    /// number of vertices
+    /// </param>
+    /// <param name="bounds">
+    /// box the positions are encoded relative to
+    /// </param>
+    /// <param name="dst">
+    /// where to write the quantized vertices
+    /// </param>
+    static void Quantize(const Vertex_Position* src, UINT num, const QuantizationBounds& bounds, Vertex_PositionQ* dst);
+
+    /// <summary>
+    /// Quantizes vertices that are comprised of just a position and uv coordinates
+    /// </summary>
+    /// <param name="src">
+    /// vertices to quantize
+    /// </param>
+    /// <param name="num">
+    /// number of vertices
+    /// </param>
+    /// <param name="bounds">
+    /// box the positions are encoded relative to
+    /// </param>
+    /// <param name="dst">
+    /// where to write the quantized vertices
+    /// </param>
+    static void Quantize(const Vertex_PositionTextureUV* src, UINT num, const QuantizationBounds& bounds, Vertex_PositionTextureUVQ* dst);
+
+    /// <summary>
+    /// Quantizes vertices that are comprised of just a position, uv coordinates, and a normal, using 8bit normals
+    /// </summary>
+    /// <param name="src">
+    /// vertices to quantize
+    /// </param>
+    /// <param name="num">
+    /// number of vertices
+    /// </param>
+    /// <param name="bounds">
+    /// box the positions are encoded relative to
+    /// </param>
+    /// <param name="dst">
+    /// where to write the quantized vertices
+    /// </param>
+    static void Quantize(const Vertex_PositionTextureUVNormal* src, UINT num, const QuantizationBounds& bounds,
+      Vertex_PositionTextureUVNormalQ8* dst);
+
+    /// <summary>
+    /// Quantizes vertices that are comprised of just a position, uv coordinates, and a normal, using 10bit normals
+    /// </summary>
+    /// <param name="src">
+    /// vertices to quantize
+    /// </param>
+    /// <param name="num">
+    /// number of vertices
+    /// </param>
+    /// <param name="bounds">
+    /// box the positions are encoded relative to
+    /// </param>
+    /// <param name="dst">
+    /// where to write the quantized vertices
+    /// </param>
+    static void Quantize(const Vertex_PositionTextureUVNormal* src, UINT num, const QuantizationBounds& bounds,
+      Vertex_PositionTextureUVNormalQ10* dst);
+
+  private:
+    // disabled
+    VertexQuantizer();
+    VertexQuantizer(const VertexQuantizer& cpy);
+    VertexQuantizer& operator=(const VertexQuantizer& cpy);
+};
+
+#endif /* VERTEX_QUANTIZER_H */
@@ -5,6 +5,7 @@
 #include "Graphics/ShaderVisibility.h"
 #include "Graphics/TextureEnums.h"
 #include "Graphics/CompareFuncs.h"
+#include "Graphics/RootSignatureDesc.h"
 
 /// <summary>
 /// Configuration for a root signature (see https://msdn.microsoft.com/en-us/library/windows/desktop/dn899208%28v=vs.85%29.aspx)
@@ -31,6 +32,22 @@ class RootSignatureConfig
     /// </returns>
     static RootSignatureConfig* CreateD3D12(UINT num_params, UINT num_sampler);
 
+    /// <summary>
+    /// Creates a RootSignatureConfig that is completely filled in from a description, without going through the
+    /// individual setters
+    /// </summary>
+    /// <param name="desc">
+    /// description of the root signature.  Usually produced by a RootSig layout (see RootSignatureLayout.h), which
+    /// checks the description at compile time
+    /// </param>
+    /// <returns>
+    /// pointer to the root signature config instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the description has an invalid parameter or range type
+    /// </exception>
+    static RootSignatureConfig* CreateD3D12(const RootSignatureDesc& desc);
+
     virtual ~RootSignatureConfig();
 
     /// <summary>
@@ -149,7 +166,11 @@ class RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    virtual void SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders) = 0;
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    virtual void SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a shader resource view with the associated values
@@ -166,7 +187,11 @@ class RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    virtual void SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders) = 0;
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    virtual void SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -183,7 +208,11 @@ class RootSignatureConfig
     /// <param name="shaders">
     /// which shader or shaders the parameter is visible to
     /// </param>
-    virtual void SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders) = 0;
+    /// <param name="flags">
+    /// how often the data the descriptor points to changes.  Ignored when the device only supports root signature
+    /// version 1.0
+    /// </param>
+    virtual void SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a descriptor table
@@ -217,7 +246,14 @@ class RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    virtual void SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space) = 0;
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0.  DESCRIPTORS_VOLATILE can't be combined with DATA_STATIC
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the flags can't be combined
+    /// </exception>
+    virtual void SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a shader resource view with the associated values
@@ -237,7 +273,14 @@ class RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    virtual void SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space) = 0;
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0.  DESCRIPTORS_VOLATILE can't be combined with DATA_STATIC
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the flags can't be combined
+    /// </exception>
+    virtual void SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -257,7 +300,14 @@ class RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    virtual void SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space) = 0;
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0.  DESCRIPTORS_VOLATILE can't be combined with DATA_STATIC
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the flags can't be combined
+    /// </exception>
+    virtual void SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
 
     /// <summary>
     /// Sets a parameter entry as a unordered access view with the associated values
@@ -277,7 +327,34 @@ class RootSignatureConfig
     /// <param name="register_space">
     /// register space
     /// </param>
-    virtual void SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space) = 0;
+    /// <param name="flags">
+    /// how often the descriptors in the range and the data they point to change.  Ignored when the device only supports
+    /// root signature version 1.0.  Samplers have no data, so only DESCRIPTORS_VOLATILE is used
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the flags can't be combined
+    /// </exception>
+    virtual void SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags = ROOT_FLAGS_VOLATILE) = 0;
+
+    /// <summary>
+    /// Computes a hash of the configuration.  Equivalent configurations always produce the same hash
+    /// </summary>
+    /// <returns>
+    /// 64-bit hash of the parameters, ranges, static samplers, and stage access flags
+    /// </returns>
+    virtual UINT64 GetHash() const = 0;
+
+    /// <summary>
+    /// Checks if this configuration would produce the same root signature as another one
+    /// </summary>
+    /// <param name="other">
+    /// configuration to compare against
+    /// </param>
+    /// <returns>
+    /// true  if the parameters, ranges, static samplers, and stage access flags all match
+    /// false otherwise
+    /// </returns>
+    virtual bool IsEquivalent(const RootSignatureConfig& other) const = 0;
 
   protected:
     RootSignatureConfig();
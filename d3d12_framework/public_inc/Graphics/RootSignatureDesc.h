@@ -0,0 +1,213 @@
+#ifndef ROOT_SIGNATURE_DESC_H
+#define ROOT_SIGNATURE_DESC_H
+
+#include <windows.h>
+#include "Graphics/ShaderVisibility.h"
+#include "Graphics/TextureEnums.h"
+#include "Graphics/CompareFuncs.h"
+
+/// <summary>
+/// Type of a root signature parameter
+/// </summary>
+/// <remarks>
+/// Values must match up to the values used by D3D12_ROOT_PARAMETER_TYPE
+/// </remarks>
+enum RootParamType
+{
+  ROOT_PARAM_DESCRIPTOR_TABLE = 0,
+  ROOT_PARAM_CONSTANTS,
+  ROOT_PARAM_CBV,
+  ROOT_PARAM_SRV,
+  ROOT_PARAM_UAV
+};
+
+/// <summary>
+/// Type of the descriptors in a descriptor table range
+/// </summary>
+/// <remarks>
+/// Values must match up to the values used by D3D12_DESCRIPTOR_RANGE_TYPE
+/// </remarks>
+enum RootRangeType
+{
+  ROOT_RANGE_SRV = 0,
+  ROOT_RANGE_UAV,
+  ROOT_RANGE_CBV,
+  ROOT_RANGE_SAMPLER
+};
+
+/// <summary>
+/// How often descriptors and the data they point to change, so drivers of root signature version 1.1 can skip work for
+/// the parts that do not
+/// </summary>
+/// <remarks>
+/// Values must match up to the values used by D3D12_DESCRIPTOR_RANGE_FLAGS and D3D12_ROOT_DESCRIPTOR_FLAGS
+/// </remarks>
+enum RootDescriptorFlags
+{
+  /// <summary>
+  /// version 1.1 defaults.  Descriptors do not change once the command list is recorded, and the data they point to
+  /// does not change while it is set during execution (UAV data is volatile)
+  /// </summary>
+  ROOT_FLAGS_NONE                             = 0,
+
+  /// <summary>
+  /// descriptors in a table can change up to the point the command list executes.  Ignored for root descriptors
+  /// </summary>
+  ROOT_FLAGS_DESCRIPTORS_VOLATILE             = 0x1,
+
+  /// <summary>
+  /// data can change at any time, including during execution
+  /// </summary>
+  ROOT_FLAGS_DATA_VOLATILE                    = 0x2,
+
+  /// <summary>
+  /// data does not change while the descriptors are set during execution
+  /// </summary>
+  ROOT_FLAGS_DATA_STATIC_WHILE_SET_AT_EXECUTE = 0x4,
+
+  /// <summary>
+  /// data does not change once the descriptors are recorded into a command list, such as textures loaded at startup
+  /// </summary>
+  ROOT_FLAGS_DATA_STATIC                      = 0x8,
+
+  /// <summary>
+  /// descriptors and data are both volatile, which is what root signature version 1.0 assumes
+  /// </summary>
+  ROOT_FLAGS_VOLATILE                         = ROOT_FLAGS_DESCRIPTORS_VOLATILE | ROOT_FLAGS_DATA_VOLATILE
+};
+
+/// <summary>
+/// One range of a descriptor table
+/// </summary>
+struct RootRangeDesc
+{
+  /// <summary>
+  /// type of descriptors in the range
+  /// </summary>
+  RootRangeType type;
+
+  /// <summary>
+  /// number of descriptors in the range
+  /// </summary>
+  UINT num_descriptors;
+
+  /// <summary>
+  /// first shader register the range is bound to
+  /// </summary>
+  UINT base_shader_register;
+
+  /// <summary>
+  /// register space the range is bound to
+  /// </summary>
+  UINT register_space;
+
+  /// <summary>
+  /// how often the descriptors and the data they point to change
+  /// </summary>
+  RootDescriptorFlags flags;
+};
+
+/// <summary>
+/// One root signature parameter
+/// </summary>
+struct RootParamDesc
+{
+  /// <summary>
+  /// type of the parameter
+  /// </summary>
+  RootParamType type;
+
+  /// <summary>
+  /// shader register of a constants or root descriptor parameter
+  /// </summary>
+  UINT shader_register;
+
+  /// <summary>
+  /// register space of a constants or root descriptor parameter
+  /// </summary>
+  UINT register_space;
+
+  /// <summary>
+  /// number of 32-bit values of a constants parameter
+  /// </summary>
+  UINT num_32bit_values;
+
+  /// <summary>
+  /// number of ranges of a descriptor table parameter
+  /// </summary>
+  UINT num_ranges;
+
+  /// <summary>
+  /// ranges of a descriptor table parameter.  Copied when the config is created
+  /// </summary>
+  const RootRangeDesc* ranges;
+
+  /// <summary>
+  /// how often the data of a root descriptor parameter changes
+  /// </summary>
+  RootDescriptorFlags flags;
+
+  /// <summary>
+  /// shaders that can see the parameter
+  /// </summary>
+  ShaderVisibility shaders;
+};
+
+/// <summary>
+/// One static sampler of a root signature.  See RootSignatureConfig::SetSampler for the meaning of each field
+/// </summary>
+struct RootSamplerDesc
+{
+  TextureFilters filter;
+  TextureAddressMode address_u;
+  TextureAddressMode address_v;
+  TextureAddressMode address_w;
+  float mip_lod_bias;
+  UINT max_anisotropy;
+  CompareFuncs compare_func;
+  TextureBorderColor border_color;
+  float min_lod;
+  float max_lod;
+  UINT shader_register;
+  UINT register_space;
+  ShaderVisibility shaders;
+};
+
+/// <summary>
+/// Complete description of a root signature, filled in one go instead of through the RootSignatureConfig setters
+/// </summary>
+struct RootSignatureDesc
+{
+  /// <summary>
+  /// number of entries in params
+  /// </summary>
+  UINT num_params;
+
+  /// <summary>
+  /// parameters of the root signature
+  /// </summary>
+  const RootParamDesc* params;
+
+  /// <summary>
+  /// number of entries in samplers
+  /// </summary>
+  UINT num_samplers;
+
+  /// <summary>
+  /// static samplers of the root signature
+  /// </summary>
+  const RootSamplerDesc* samplers;
+
+  /// <summary>
+  /// stage access, see RootSignatureConfig::SetStageAccess
+  /// </summary>
+  bool ia;
+  bool vs;
+  bool hs;
+  bool ds;
+  bool gs;
+  bool ps;
+  bool so;
+};
+
+#endif /* ROOT_SIGNATURE_DESC_H */
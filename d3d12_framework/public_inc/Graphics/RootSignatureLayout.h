@@ -0,0 +1,502 @@
+#ifndef ROOT_SIGNATURE_LAYOUT_H
+#define ROOT_SIGNATURE_LAYOUT_H
+
+#include <float.h>
+#include <limits.h>
+#include "Graphics/RootSignatureDesc.h"
+#include "Graphics/RootSignatureConfig.h"
+#include "Graphics/RootSignature.h"
+#include "Graphics/CommandList.h"
+
+/*
+ * Compile time root signature layouts.  A layout is described as a type, for example
+ *
+ *   typedef RootSig<RootTable<SHADER_VISIBILITY_PIXEL, RangeSRV<0> >,
+ *                   RootCBV<0, SHADER_VISIBILITY_VERTEX>,
+ *                   StaticSampler<0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, SHADER_VISIBILITY_PIXEL> > MyRootSig;
+ *
+ * Root parameters are numbered in the order they are listed, skipping static samplers.  The 64 DWORD size limit and
+ * the type of the parameter behind every typed binder (MyRootSig::SetConstantBuffer<1>, MyRootSig::SetTable<0>, ...)
+ * are checked by the compiler, so no run time validation is needed when creating or binding the root signature.
+ */
+
+/// <summary>
+/// Root parameter that is a constant buffer view placed directly in the root signature.  Costs 2 DWORDs
+/// </summary>
+template <UINT Register, ShaderVisibility Shaders = SHADER_VISIBILITY_ALL, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RootCBV
+{
+  enum { param_type = ROOT_PARAM_CBV, cost = 2, is_sampler = 0 };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    RootParamDesc& param = params[next_param++];
+    param.type             = ROOT_PARAM_CBV;
+    param.shader_register  = Register;
+    param.register_space   = Space;
+    param.num_32bit_values = 0;
+    param.num_ranges       = 0;
+    param.ranges           = NULL;
+    param.flags            = Flags;
+    param.shaders          = Shaders;
+  }
+};
+
+/// <summary>
+/// Root parameter that is a shader resource view placed directly in the root signature.  Costs 2 DWORDs
+/// </summary>
+template <UINT Register, ShaderVisibility Shaders = SHADER_VISIBILITY_ALL, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RootSRV
+{
+  enum { param_type = ROOT_PARAM_SRV, cost = 2, is_sampler = 0 };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    RootParamDesc& param = params[next_param++];
+    param.type             = ROOT_PARAM_SRV;
+    param.shader_register  = Register;
+    param.register_space   = Space;
+    param.num_32bit_values = 0;
+    param.num_ranges       = 0;
+    param.ranges           = NULL;
+    param.flags            = Flags;
+    param.shaders          = Shaders;
+  }
+};
+
+/// <summary>
+/// Root parameter that is an unordered access view placed directly in the root signature.  Costs 2 DWORDs
+/// </summary>
+template <UINT Register, ShaderVisibility Shaders = SHADER_VISIBILITY_ALL, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RootUAV
+{
+  enum { param_type = ROOT_PARAM_UAV, cost = 2, is_sampler = 0 };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    RootParamDesc& param = params[next_param++];
+    param.type             = ROOT_PARAM_UAV;
+    param.shader_register  = Register;
+    param.register_space   = Space;
+    param.num_32bit_values = 0;
+    param.num_ranges       = 0;
+    param.ranges           = NULL;
+    param.flags            = Flags;
+    param.shaders          = Shaders;
+  }
+};
+
+/// <summary>
+/// Root parameter of 32-bit constants placed directly in the root signature.  Costs 1 DWORD per constant
+/// </summary>
+template <UINT Register, UINT Num32BitValues, ShaderVisibility Shaders = SHADER_VISIBILITY_ALL, UINT Space = 0>
+struct RootConstants
+{
+  static_assert(Num32BitValues > 0, "Root constants need at least one 32-bit value");
+
+  enum { param_type = ROOT_PARAM_CONSTANTS, cost = Num32BitValues, is_sampler = 0, num_32bit_values = Num32BitValues };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    RootParamDesc& param = params[next_param++];
+    param.type             = ROOT_PARAM_CONSTANTS;
+    param.shader_register  = Register;
+    param.register_space   = Space;
+    param.num_32bit_values = Num32BitValues;
+    param.num_ranges       = 0;
+    param.ranges           = NULL;
+    param.flags            = ROOT_FLAGS_NONE;
+    param.shaders          = Shaders;
+  }
+};
+
+/// <summary>
+/// Range of constant buffer views in a RootTable
+/// </summary>
+template <UINT BaseRegister, UINT NumDescriptors = 1, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RangeCBV
+{
+  enum { is_sampler_range = 0 };
+
+  static RootRangeDesc Get()
+  {
+    RootRangeDesc range = { ROOT_RANGE_CBV, NumDescriptors, BaseRegister, Space, Flags };
+    return range;
+  }
+};
+
+/// <summary>
+/// Range of shader resource views in a RootTable
+/// </summary>
+template <UINT BaseRegister, UINT NumDescriptors = 1, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RangeSRV
+{
+  enum { is_sampler_range = 0 };
+
+  static RootRangeDesc Get()
+  {
+    RootRangeDesc range = { ROOT_RANGE_SRV, NumDescriptors, BaseRegister, Space, Flags };
+    return range;
+  }
+};
+
+/// <summary>
+/// Range of unordered access views in a RootTable
+/// </summary>
+template <UINT BaseRegister, UINT NumDescriptors = 1, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_VOLATILE>
+struct RangeUAV
+{
+  enum { is_sampler_range = 0 };
+
+  static RootRangeDesc Get()
+  {
+    RootRangeDesc range = { ROOT_RANGE_UAV, NumDescriptors, BaseRegister, Space, Flags };
+    return range;
+  }
+};
+
+/// <summary>
+/// Range of samplers in a RootTable.  Sampler ranges cannot share a table with other range types
+/// </summary>
+template <UINT BaseRegister, UINT NumDescriptors = 1, UINT Space = 0, RootDescriptorFlags Flags = ROOT_FLAGS_DESCRIPTORS_VOLATILE>
+struct RangeSampler
+{
+  enum { is_sampler_range = 1 };
+
+  static RootRangeDesc Get()
+  {
+    RootRangeDesc range = { ROOT_RANGE_SAMPLER, NumDescriptors, BaseRegister, Space, Flags };
+    return range;
+  }
+};
+
+/// <summary>
+/// Counts how many ranges of a table are sampler ranges.  Implementation detail of RootTable
+/// </summary>
+template <class... Ranges>
+struct RootLayoutSamplerRanges
+{
+  enum { count = 0 };
+};
+
+template <class First, class... Rest>
+struct RootLayoutSamplerRanges<First, Rest...>
+{
+  enum { count = First::is_sampler_range + RootLayoutSamplerRanges<Rest...>::count };
+};
+
+/// <summary>
+/// Root parameter that is a descriptor table made up of the listed ranges.  Costs 1 DWORD
+/// </summary>
+template <ShaderVisibility Shaders, class... Ranges>
+struct RootTable
+{
+  static_assert(sizeof...(Ranges) > 0, "Descriptor tables need at least one range");
+  static_assert(RootLayoutSamplerRanges<Ranges...>::count == 0 || RootLayoutSamplerRanges<Ranges...>::count == sizeof...(Ranges),
+    "Sampler ranges cannot share a descriptor table with other range types");
+
+  enum { param_type = ROOT_PARAM_DESCRIPTOR_TABLE, cost = 1, is_sampler = 0 };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    static const RootRangeDesc ranges[] = { Ranges::Get()... };
+
+    RootParamDesc& param = params[next_param++];
+    param.type             = ROOT_PARAM_DESCRIPTOR_TABLE;
+    param.shader_register  = 0;
+    param.register_space   = 0;
+    param.num_32bit_values = 0;
+    param.num_ranges       = sizeof...(Ranges);
+    param.ranges           = ranges;
+    param.flags            = ROOT_FLAGS_NONE;
+    param.shaders          = Shaders;
+  }
+};
+
+/// <summary>
+/// Static sampler baked into the root signature.  Costs nothing and is not a root parameter.  The same address mode is
+/// used for u, v and w, and there is no mip LOD bias.  MaxLOD is the highest mip level that can be sampled, with UINT_MAX
+/// allowing every level
+/// </summary>
+template <UINT Register, TextureFilters Filter, TextureAddressMode Address, ShaderVisibility Shaders = SHADER_VISIBILITY_ALL, UINT Space = 0,
+  UINT MaxAnisotropy = 1, CompareFuncs Compare = COMPARISON_FUNC_NEVER, TextureBorderColor Border = BORDER_COLOR_TRANSPARENT_BLACK, UINT MaxLOD = UINT_MAX>
+struct StaticSampler
+{
+  static_assert(MaxAnisotropy >= 1 && MaxAnisotropy <= 16, "Max anisotropy must be in [1, 16]");
+
+  enum { cost = 0, is_sampler = 1 };
+
+  static void Describe(RootParamDesc* params, UINT& next_param, RootSamplerDesc* samplers, UINT& next_sampler)
+  {
+    RootSamplerDesc& sampler = samplers[next_sampler++];
+    sampler.filter          = Filter;
+    sampler.address_u       = Address;
+    sampler.address_v       = Address;
+    sampler.address_w       = Address;
+    sampler.mip_lod_bias    = 0;
+    sampler.max_anisotropy  = MaxAnisotropy;
+    sampler.compare_func    = Compare;
+    sampler.border_color    = Border;
+    sampler.min_lod         = 0;
+    sampler.max_lod         = MaxLOD == UINT_MAX ? FLT_MAX : (float)MaxLOD;
+    sampler.shader_register = Register;
+    sampler.register_space  = Space;
+    sampler.shaders         = Shaders;
+  }
+};
+
+/// <summary>
+/// Totals the cost and entry counts of a layout.  Implementation detail of RootSig
+/// </summary>
+template <class... Entries>
+struct RootLayoutTotals
+{
+  enum { cost = 0, num_params = 0, num_samplers = 0 };
+};
+
+template <class First, class... Rest>
+struct RootLayoutTotals<First, Rest...>
+{
+  enum
+  {
+    cost         = First::cost + RootLayoutTotals<Rest...>::cost,
+    num_params   = (First::is_sampler ? 0 : 1) + RootLayoutTotals<Rest...>::num_params,
+    num_samplers = (First::is_sampler ? 1 : 0) + RootLayoutTotals<Rest...>::num_samplers
+  };
+};
+
+/// <summary>
+/// Finds the entry of a layout that is root parameter Slot, skipping static samplers.  Implementation detail of RootSig
+/// </summary>
+template <UINT Slot, class... Entries>
+struct RootLayoutParam
+{
+  static_assert(Slot != Slot, "Root parameter index is beyond the number of parameters in the layout");
+
+  struct type
+  {
+    enum { param_type = -1 };
+  };
+};
+
+template <UINT Slot, bool IsSampler, class First, class... Rest>
+struct RootLayoutParamStep : RootLayoutParam<Slot - 1, Rest...>
+{
+};
+
+template <class First, class... Rest>
+struct RootLayoutParamStep<0, false, First, Rest...>
+{
+  typedef First type;
+};
+
+template <UINT Slot, class First, class... Rest>
+struct RootLayoutParamStep<Slot, true, First, Rest...> : RootLayoutParam<Slot, Rest...>
+{
+};
+
+template <class First, class... Rest>
+struct RootLayoutParamStep<0, true, First, Rest...> : RootLayoutParam<0, Rest...>
+{
+};
+
+template <UINT Slot, class First, class... Rest>
+struct RootLayoutParam<Slot, First, Rest...> : RootLayoutParamStep<Slot, First::is_sampler != 0, First, Rest...>
+{
+};
+
+/// <summary>
+/// Root signature whose layout is fixed at compile time
+/// </summary>
+template <class... Entries>
+class RootSig
+{
+  public:
+    enum
+    {
+      cost         = RootLayoutTotals<Entries...>::cost,
+      num_params   = RootLayoutTotals<Entries...>::num_params,
+      num_samplers = RootLayoutTotals<Entries...>::num_samplers
+    };
+
+    static_assert(cost <= 64, "Root signature is larger than the 64 DWORD limit");
+
+    /// <summary>
+    /// Creates a RootSignatureConfig with the layout
+    /// </summary>
+    /// <param name="ia">
+    /// true  if input assembler stage has access
+    /// false otherwise
+    /// </param>
+    /// <param name="vs">
+    /// true  if vertex shader has access
+    /// false otherwise
+    /// </param>
+    /// <param name="hs">
+    /// true  if hull shader has access
+    /// false otherwise
+    /// </param>
+    /// <param name="ds">
+    /// true  if domain shader has access
+    /// false otherwise
+    /// </param>
+    /// <param name="gs">
+    /// true  if geometry shader has access
+    /// false otherwise
+    /// </param>
+    /// <param name="ps">
+    /// true  if pixel shader has access
+    /// false otherwise
+    /// </param>
+    /// <param name="so">
+    /// true  if stream output stage has access
+    /// false otherwise
+    /// </param>
+    /// <returns>
+    /// pointer to the root signature config instance
+    /// </returns>
+    static RootSignatureConfig* CreateConfigD3D12(bool ia, bool vs, bool hs, bool ds, bool gs, bool ps, bool so)
+    {
+      // one extra entry so neither array is zero sized
+      RootParamDesc params[num_params + 1];
+      RootSamplerDesc samplers[num_samplers + 1];
+      UINT next_param = 0;
+      UINT next_sampler = 0;
+      int expand[] = { 0, (Entries::Describe(params, next_param, samplers, next_sampler), 0)... };
+      (void)expand;
+
+      RootSignatureDesc desc;
+      desc.num_params   = num_params;
+      desc.params       = params;
+      desc.num_samplers = num_samplers;
+      desc.samplers     = samplers;
+      desc.ia           = ia;
+      desc.vs           = vs;
+      desc.hs           = hs;
+      desc.ds           = ds;
+      desc.gs           = gs;
+      desc.ps           = ps;
+      desc.so           = so;
+      return RootSignatureConfig::CreateD3D12(desc);
+    }
+
+    /// <summary>
+    /// Creates a D3D12 root signature with the layout.  See CreateConfigD3D12 for the meaning of the stage access flags
+    /// </summary>
+    /// <returns>
+    /// pointer to the root signature instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered in creating the instance
+    /// </exception>
+    static RootSignature* CreateD3D12(const GraphicsCore& graphics, bool ia, bool vs, bool hs, bool ds, bool gs, bool ps, bool so)
+    {
+      RootSignatureConfig* config = CreateConfigD3D12(ia, vs, hs, ds, gs, ps, so);
+      RootSignature* sig;
+      try
+      {
+        sig = RootSignature::CreateD3D12(graphics, *config);
+      }
+      catch (...)
+      {
+        delete config;
+        throw;
+      }
+      delete config;
+      return sig;
+    }
+
+    /// <summary>
+    /// Binds a constant buffer to root parameter Slot, which must be a RootCBV
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to record the binding in
+    /// </param>
+    /// <param name="buffer">
+    /// constant buffer to bind
+    /// </param>
+    template <UINT Slot>
+    static void SetConstantBuffer(CommandList& command_list, const ConstantBuffer& buffer)
+    {
+      static_assert((int)RootLayoutParam<Slot, Entries...>::type::param_type == ROOT_PARAM_CBV, "Root parameter is not a RootCBV");
+      command_list.SetConstantBuffer(Slot, buffer);
+    }
+
+    /// <summary>
+    /// Binds a structured buffer to root parameter Slot, which must be a RootSRV
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to record the binding in
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to bind, either a StructuredBuffer or a StructuredBufferGPU
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    template <UINT Slot, class BufferType>
+    static void SetShaderResourceView(CommandList& command_list, const BufferType& buffer, UINT element_offset = 0)
+    {
+      static_assert((int)RootLayoutParam<Slot, Entries...>::type::param_type == ROOT_PARAM_SRV, "Root parameter is not a RootSRV");
+      command_list.SetShaderResourceView(Slot, buffer, element_offset);
+    }
+
+    /// <summary>
+    /// Binds a GPU-only structured buffer to root parameter Slot, which must be a RootUAV
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to record the binding in
+    /// </param>
+    /// <param name="buffer">
+    /// structured buffer to bind
+    /// </param>
+    /// <param name="element_offset">
+    /// index of the element that the shader sees as element 0
+    /// </param>
+    template <UINT Slot>
+    static void SetUnorderedAccessView(CommandList& command_list, const StructuredBufferGPU& buffer, UINT element_offset = 0)
+    {
+      static_assert((int)RootLayoutParam<Slot, Entries...>::type::param_type == ROOT_PARAM_UAV, "Root parameter is not a RootUAV");
+      command_list.SetUnorderedAccessView(Slot, buffer, element_offset);
+    }
+
+    /// <summary>
+    /// Binds the descriptor table of root parameter Slot, which must be a RootTable, to start at a texture
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to record the binding in
+    /// </param>
+    /// <param name="texture">
+    /// texture whose descriptor is the start of the table
+    /// </param>
+    template <UINT Slot, class TextureType>
+    static void SetTable(CommandList& command_list, const TextureType& texture)
+    {
+      static_assert((int)RootLayoutParam<Slot, Entries...>::type::param_type == ROOT_PARAM_DESCRIPTOR_TABLE, "Root parameter is not a RootTable");
+      command_list.SetTextureAsStartOfDescriptorTable(Slot, texture);
+    }
+
+    /// <summary>
+    /// Sets the 32-bit constants of root parameter Slot, which must be a RootConstants large enough to hold the data
+    /// </summary>
+    /// <param name="command_list">
+    /// command list to record the constants in
+    /// </param>
+    /// <param name="data">
+    /// structure to copy into the root parameter
+    /// </param>
+    template <UINT Slot, class T>
+    static void SetConstants(CommandList& command_list, const T& data)
+    {
+      typedef typename RootLayoutParam<Slot, Entries...>::type Param;
+      static_assert((int)Param::param_type == ROOT_PARAM_CONSTANTS, "Root parameter is not a RootConstants");
+      static_assert(sizeof(T) <= Param::num_32bit_values * sizeof(UINT), "Data is larger than the RootConstants parameter");
+      command_list.SetRootConstants(Slot, data);
+    }
+
+  private:
+    // disabled
+    RootSig();
+};
+
+#endif /* ROOT_SIGNATURE_LAYOUT_H */
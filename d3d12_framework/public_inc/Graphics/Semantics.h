@@ -57,6 +57,25 @@ enum Semantics
 /// <returns>
 /// the corresponding string
 /// </returns>
+/// <exception cref="FrameworkException">
+/// Thrown when sem is not an entry of Semantics
+/// </exception>
 const char* GetSemanticName(Semantics sem);
 
+/// <summary>
+/// Converts the string form of a semantic name to the matching entry of the Semantics enum.  The comparison is case
+/// insensitive, as it is in HLSL
+/// </summary>
+/// <param name="name">
+/// semantic name, without the semantic index
+/// </param>
+/// <param name="sem">
+/// receives the corresponding entry when found
+/// </param>
+/// <returns>
+/// true  if the name matches an entry of the Semantics enum
+/// false otherwise
+/// </returns>
+bool GetSemanticFromName(const char* name, Semantics& sem);
+
 #endif /* SEMANTICS_H */
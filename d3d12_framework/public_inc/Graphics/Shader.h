@@ -1,6 +1,8 @@
 #ifndef SHADER_H
 #define SHADER_H
 
+class ShaderReflection;
+
 class Shader
 {
   public:
@@ -20,6 +22,17 @@ class Shader
 
     virtual ~Shader();
 
+    /// <summary>
+    /// Retrieves the reflection data of the shader, parsing the container the first time it is requested
+    /// </summary>
+    /// <returns>
+    /// reflection data, owned by the shader
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the shader container cannot be parsed
+    /// </exception>
+    virtual const ShaderReflection& GetReflection() const = 0;
+
   protected:
     Shader();
 
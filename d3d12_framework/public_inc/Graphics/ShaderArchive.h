@@ -0,0 +1,76 @@
+#ifndef SHADER_ARCHIVE_H
+#define SHADER_ARCHIVE_H
+
+#include <windows.h>
+#include "Graphics/Shader.h"
+
+/// <summary>
+/// Read only archive of compiled shaders, built by tools/shader_archive_builder.  The file is memory mapped once and
+/// shaders loaded from it point directly into the mapping
+/// </summary>
+class ShaderArchive
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified archive and validates its index
+    /// </summary>
+    /// <param name="path">
+    /// path to the archive to open
+    /// </param>
+    /// <returns>
+    /// pointer to the ShaderArchive instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped or is not a valid shader archive
+    /// </exception>
+    static ShaderArchive* OpenD3D12(const char* path);
+
+    /// <summary>
+    /// Unmaps the archive.  All shaders loaded from it must be cleaned up before calling this
+    /// </summary>
+    virtual ~ShaderArchive();
+
+    /// <summary>
+    /// Creates a shader that uses the bytecode stored in the archive without copying it
+    /// </summary>
+    /// <param name="name">
+    /// name the shader was stored with, which is the file name of the .cso that was packed (e.g. "fps_monitor_vs.cso")
+    /// </param>
+    /// <returns>
+    /// pointer to the Shader instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the archive does not contain a shader with the specified name
+    /// </exception>
+    virtual Shader* LoadShader(const char* name) const = 0;
+
+    /// <summary>
+    /// Checks if the archive contains a shader with the specified name
+    /// </summary>
+    /// <param name="name">
+    /// name the shader was stored with
+    /// </param>
+    /// <returns>
+    /// true  if the shader is in the archive
+    /// false otherwise
+    /// </returns>
+    virtual bool Contains(const char* name) const = 0;
+
+    /// <summary>
+    /// Retrieves the number of shaders in the archive
+    /// </summary>
+    /// <returns>
+    /// number of shaders
+    /// </returns>
+    virtual UINT GetNumShaders() const = 0;
+
+  protected:
+    ShaderArchive();
+
+  private:
+    // disabled
+    ShaderArchive(const ShaderArchive& cpy);
+    ShaderArchive& operator=(const ShaderArchive& cpy);
+};
+
+#endif /* SHADER_ARCHIVE_H */
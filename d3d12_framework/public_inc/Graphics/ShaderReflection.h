@@ -0,0 +1,272 @@
+#ifndef SHADER_REFLECTION_H
+#define SHADER_REFLECTION_H
+
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "Graphics/InputLayout.h"
+#include "Graphics/RootSignatureConfig.h"
+
+/// <summary>
+/// Type of the components of a signature element
+/// </summary>
+/// <remarks>
+/// Values must match up to the values used by D3D_REGISTER_COMPONENT_TYPE
+/// </remarks>
+enum ShaderComponentType
+{
+  SHADER_COMPONENT_UNKNOWN = 0,
+  SHADER_COMPONENT_UINT32,
+  SHADER_COMPONENT_SINT32,
+  SHADER_COMPONENT_FLOAT32
+};
+
+/// <summary>
+/// Type of a resource bound to a shader
+/// </summary>
+/// <remarks>
+/// Values must match up to the values used by D3D_SHADER_INPUT_TYPE
+/// </remarks>
+enum ShaderResourceType
+{
+  SHADER_RESOURCE_CBUFFER = 0,
+  SHADER_RESOURCE_TBUFFER,
+  SHADER_RESOURCE_TEXTURE,
+  SHADER_RESOURCE_SAMPLER,
+  SHADER_RESOURCE_UAV_RWTYPED,
+  SHADER_RESOURCE_STRUCTURED,
+  SHADER_RESOURCE_UAV_RWSTRUCTURED,
+  SHADER_RESOURCE_BYTEADDRESS,
+  SHADER_RESOURCE_UAV_RWBYTEADDRESS,
+  SHADER_RESOURCE_UAV_APPEND_STRUCTURED,
+  SHADER_RESOURCE_UAV_CONSUME_STRUCTURED,
+  SHADER_RESOURCE_UAV_RWSTRUCTURED_WITH_COUNTER
+};
+
+/// <summary>
+/// One element of an input or output signature
+/// </summary>
+struct ShaderSignatureElement
+{
+  /// <summary>
+  /// semantic name, as written in the HLSL
+  /// </summary>
+  std::string semantic_name;
+
+  /// <summary>
+  /// semantic index
+  /// </summary>
+  UINT semantic_index;
+
+  /// <summary>
+  /// system value the element maps to (D3D_NAME), 0 for regular semantics
+  /// </summary>
+  UINT system_value;
+
+  /// <summary>
+  /// type of each component
+  /// </summary>
+  ShaderComponentType component_type;
+
+  /// <summary>
+  /// register the element is packed into
+  /// </summary>
+  UINT register_index;
+
+  /// <summary>
+  /// components of the register the element occupies
+  /// </summary>
+  UINT8 mask;
+
+  /// <summary>
+  /// components the shader reads (inputs) or never writes (outputs)
+  /// </summary>
+  UINT8 rw_mask;
+
+  /// <summary>
+  /// geometry shader output stream, 0 for other stages
+  /// </summary>
+  UINT stream;
+};
+
+/// <summary>
+/// Constant buffer declared by a shader
+/// </summary>
+struct ShaderConstantBufferInfo
+{
+  /// <summary>
+  /// name of the constant buffer
+  /// </summary>
+  std::string name;
+
+  /// <summary>
+  /// size of the constant buffer, in bytes
+  /// </summary>
+  UINT size;
+
+  /// <summary>
+  /// number of variables declared in the constant buffer
+  /// </summary>
+  UINT num_variables;
+};
+
+/// <summary>
+/// Resource bound to a shader
+/// </summary>
+struct ShaderResourceBinding
+{
+  /// <summary>
+  /// name of the resource.  Empty for DXIL shaders, whose names are only stored in the LLVM bitcode
+  /// </summary>
+  std::string name;
+
+  /// <summary>
+  /// type of the resource
+  /// </summary>
+  ShaderResourceType type;
+
+  /// <summary>
+  /// first register the resource is bound to
+  /// </summary>
+  UINT bind_point;
+
+  /// <summary>
+  /// number of registers the resource is bound to, 0 for unbounded arrays
+  /// </summary>
+  UINT bind_count;
+
+  /// <summary>
+  /// register space
+  /// </summary>
+  UINT space;
+};
+
+/// <summary>
+/// Information parsed from a compiled DXBC or DXIL shader container, without going through the D3D compiler
+/// </summary>
+class ShaderReflection
+{
+  public:
+    /// <summary>
+    /// Parses the ISGN/OSGN (or ISG1/OSG1/OSG5), RDEF or PSV0, and RTS0 chunks of a compiled shader
+    /// </summary>
+    /// <param name="bytecode">
+    /// start of the compiled shader
+    /// </param>
+    /// <param name="size">
+    /// size of the compiled shader, in bytes
+    /// </param>
+    /// <returns>
+    /// pointer to the reflection data
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the data is not a valid shader container
+    /// </exception>
+    static ShaderReflection* Parse(const void* bytecode, size_t size);
+
+    ~ShaderReflection();
+
+    /// <summary>
+    /// Retrieves the input signature
+    /// </summary>
+    /// <returns>
+    /// elements of the input signature, in register order
+    /// </returns>
+    const std::vector<ShaderSignatureElement>& GetInputs() const;
+
+    /// <summary>
+    /// Retrieves the output signature
+    /// </summary>
+    /// <returns>
+    /// elements of the output signature, in register order
+    /// </returns>
+    const std::vector<ShaderSignatureElement>& GetOutputs() const;
+
+    /// <summary>
+    /// Retrieves the constant buffers the shader declares.  Only available for DXBC shaders
+    /// </summary>
+    /// <returns>
+    /// constant buffers
+    /// </returns>
+    const std::vector<ShaderConstantBufferInfo>& GetConstantBuffers() const;
+
+    /// <summary>
+    /// Retrieves the resources the shader binds
+    /// </summary>
+    /// <returns>
+    /// bound resources
+    /// </returns>
+    const std::vector<ShaderResourceBinding>& GetResources() const;
+
+    /// <summary>
+    /// Checks if the shader was compiled with a root signature
+    /// </summary>
+    /// <returns>
+    /// true  if the container has an RTS0 chunk
+    /// false otherwise
+    /// </returns>
+    bool HasRootSignature() const;
+
+    /// <summary>
+    /// Creates an input layout matching the input signature, treating every element as tightly packed 32-bit
+    /// components in a single per vertex slot.  System generated values such as SV_VertexID are skipped
+    /// </summary>
+    /// <param name="input_slot">
+    /// input slot every element reads from
+    /// </param>
+    /// <returns>
+    /// pointer to the input layout instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an element uses a semantic that is not in the Semantics enum or has an unsupported type
+    /// </exception>
+    InputLayout* CreateInputLayoutD3D12(UINT input_slot = 0) const;
+
+    /// <summary>
+    /// Creates a root signature config matching the root signature embedded in the shader
+    /// </summary>
+    /// <returns>
+    /// pointer to the root signature config instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the shader has no embedded root signature or it cannot be represented
+    /// </exception>
+    /// <remarks>
+    /// Descriptor ranges are always appended, since RootSignatureConfig does not support explicit table offsets
+    /// </remarks>
+    RootSignatureConfig* CreateRootSignatureConfigD3D12() const;
+
+  private:
+    ShaderReflection();
+
+    // disabled
+    ShaderReflection(const ShaderReflection& cpy);
+    ShaderReflection& operator=(const ShaderReflection& cpy);
+
+    /// <summary>
+    /// input signature
+    /// </summary>
+    std::vector<ShaderSignatureElement> m_inputs;
+
+    /// <summary>
+    /// output signature
+    /// </summary>
+    std::vector<ShaderSignatureElement> m_outputs;
+
+    /// <summary>
+    /// constant buffers declared by the shader
+    /// </summary>
+    std::vector<ShaderConstantBufferInfo> m_constant_buffers;
+
+    /// <summary>
+    /// resources bound by the shader
+    /// </summary>
+    std::vector<ShaderResourceBinding> m_resources;
+
+    /// <summary>
+    /// copy of the RTS0 chunk, empty if the shader has no root signature
+    /// </summary>
+    std::vector<UINT8> m_root_signature;
+};
+
+#endif /* SHADER_REFLECTION_H */
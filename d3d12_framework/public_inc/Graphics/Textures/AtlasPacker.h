@@ -0,0 +1,153 @@
+#ifndef ATLAS_PACKER_H
+#define ATLAS_PACKER_H
+
+#include <windows.h>
+#include <vector>
+
+/// <summary>
+/// Rectangle in an atlas page
+/// </summary>
+struct AtlasRect
+{
+  /// <summary>
+  /// left edge
+  /// </summary>
+  UINT x;
+
+  /// <summary>
+  /// top edge
+  /// </summary>
+  UINT y;
+
+  /// <summary>
+  /// width
+  /// </summary>
+  UINT width;
+
+  /// <summary>
+  /// height
+  /// </summary>
+  UINT height;
+};
+
+/// <summary>
+/// Packs rectangles into 1 fixed size page with the MaxRects algorithm.  Every maximal free rectangle is tracked, so
+/// each rectangle can go in the free space that fits it most tightly, which packs far denser than shelf or skyline
+/// packing at the cost of more bookkeeping per insert
+/// </summary>
+/// <remarks>
+/// Each rectangle is placed by the best short side fit rule, where the free rectangle that leaves the smallest leftover
+/// on its shorter side wins.  Inserting rectangles from largest to smallest packs the tightest.
+/// </remarks>
+class AtlasPacker
+{
+  public:
+    /// <summary>
+    /// Creates an empty page
+    /// </summary>
+    /// <param name="width">
+    /// width of the page
+    /// </param>
+    /// <param name="height">
+    /// height of the page
+    /// </param>
+    AtlasPacker(UINT width, UINT height);
+
+    ~AtlasPacker();
+
+    /// <summary>
+    /// Places a rectangle in the page
+    /// </summary>
+    /// <param name="width">
+    /// width of the rectangle
+    /// </param>
+    /// <param name="height">
+    /// height of the rectangle
+    /// </param>
+    /// <param name="rect">
+    /// output parameter for where the rectangle was placed
+    /// </param>
+    /// <returns>
+    /// true  if the rectangle was placed, which is always the case for empty rectangles
+    /// false if there is no room left for it, in which case the page is unchanged
+    /// </returns>
+    bool Insert(UINT width, UINT height, AtlasRect& rect);
+
+    /// <summary>
+    /// Removes every rectangle from the page
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// Gets the width of the page
+    /// </summary>
+    /// <returns>
+    /// width of the page
+    /// </returns>
+    UINT GetWidth() const;
+
+    /// <summary>
+    /// Gets the height of the page
+    /// </summary>
+    /// <returns>
+    /// height of the page
+    /// </returns>
+    UINT GetHeight() const;
+
+    /// <summary>
+    /// Gets how much of the page the placed rectangles cover
+    /// </summary>
+    /// <returns>
+    /// fraction of the page's area from 0 to 1
+    /// </returns>
+    float GetOccupancy() const;
+
+  private:
+    // disabled
+    AtlasPacker();
+    AtlasPacker(const AtlasPacker& cpy);
+    AtlasPacker& operator=(const AtlasPacker& cpy);
+
+    /// <summary>
+    /// Removes a placed rectangle from the free rectangles, splitting each one it overlaps into the up to 4 maximal
+    /// rectangles around it
+    /// </summary>
+    /// <param name="used">
+    /// rectangle that was placed
+    /// </param>
+    /// <param name="split">
+    /// output parameter for the rectangles the overlapped free rectangles were split into
+    /// </param>
+    void SplitFreeRects(const AtlasRect& used, std::vector<AtlasRect>& split);
+
+    /// <summary>
+    /// Adds the rectangles from a split to the free rectangles, leaving out any that are inside of another free
+    /// rectangle.  Free rectangles that were not split never contain each other, so only the new ones are checked
+    /// </summary>
+    /// <param name="split">
+    /// rectangles the overlapped free rectangles were split into
+    /// </param>
+    void AddSplitRects(const std::vector<AtlasRect>& split);
+
+    /// <summary>
+    /// width of the page
+    /// </summary>
+    UINT m_width;
+
+    /// <summary>
+    /// height of the page
+    /// </summary>
+    UINT m_height;
+
+    /// <summary>
+    /// maximal rectangles of free space, which overlap each other
+    /// </summary>
+    std::vector<AtlasRect> m_free;
+
+    /// <summary>
+    /// area covered by placed rectangles
+    /// </summary>
+    UINT64 m_used_area;
+};
+
+#endif /* ATLAS_PACKER_H */
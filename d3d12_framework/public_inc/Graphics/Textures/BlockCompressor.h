@@ -0,0 +1,186 @@
+#ifndef BLOCK_COMPRESSOR_H
+#define BLOCK_COMPRESSOR_H
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/GraphicsDataFormat.h"
+
+/// <summary>
+/// Trade off between encoding time and quality
+/// </summary>
+enum BlockCompressionQuality
+{
+  /// <summary>
+  /// single pass endpoint fit.  BC7 only uses mode 6
+  /// </summary>
+  BC_QUALITY_FAST,
+
+  /// <summary>
+  /// endpoints are refined by least squares.  BC7 also tries mode 5, keeping apart the channel that looks to vary most
+  /// on its own, and mode 1 with the most promising partition on opaque blocks that neither fits well
+  /// </summary>
+  BC_QUALITY_NORMAL,
+
+  /// <summary>
+  /// more refinement passes.  BC7 also tries mode 1 on opaque blocks with the most promising partitions and mode 5 with
+  /// every channel rotation
+  /// </summary>
+  BC_QUALITY_HIGH
+};
+
+/// <summary>
+/// Encodes 8-bit RGBA texels into block compressed formats on the CPU.  Blocks are fit with SSE2 and rows of blocks
+/// are split across the framework's worker threads.
+/// </summary>
+/// <remarks>
+/// Supported formats are BC1, BC3 and BC7 (UNORM and UNORM_SRGB), and BC4_UNORM and BC5_UNORM.  BC4 encodes the red
+/// channel and BC5 the red and green channels.  sRGB formats are encoded in the stored sRGB space, as the hardware
+/// decodes them to sRGB before converting to linear.  Images that are not a multiple of 4 texels repeat their edge
+/// texels to fill the last blocks.
+/// </remarks>
+class BlockCompressor
+{
+  public:
+    /// <summary>
+    /// Width and height of each block in texels
+    /// </summary>
+    static const UINT BLOCK_DIM = 4;
+
+    /// <summary>
+    /// Checks if a format is one of the block compressed formats
+    /// </summary>
+    /// <param name="format">
+    /// format to check
+    /// </param>
+    /// <returns>
+    /// true if the format stores 4x4 blocks
+    /// false otherwise
+    /// </returns>
+    static bool IsBlockCompressed(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Checks if the compressor can encode a format
+    /// </summary>
+    /// <param name="format">
+    /// format to check
+    /// </param>
+    /// <returns>
+    /// true if the format is supported
+    /// false otherwise
+    /// </returns>
+    static bool IsFormatSupported(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Retrieves the number of bytes in each block of a block compressed format
+    /// </summary>
+    /// <param name="format">
+    /// block compressed format
+    /// </param>
+    /// <returns>
+    /// 8 for BC1 and BC4, 16 for the others
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not block compressed
+    /// </exception>
+    static UINT GetBytesPerBlock(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Retrieves the uncompressed format the encoder reads for a format.  Mipmaps generated in this format are filtered
+    /// in the same color space the compressed texture is sampled in
+    /// </summary>
+    /// <param name="format">
+    /// supported block compressed format
+    /// </param>
+    /// <returns>
+    /// R8G8B8A8_UNORM_SRGB for sRGB formats, R8B8G8A8_UNORM otherwise
+    /// </returns>
+    static GraphicsDataFormat GetSourceFormat(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Retrieves the number of bytes in the compressed form of an image
+    /// </summary>
+    /// <param name="format">
+    /// block compressed format
+    /// </param>
+    /// <param name="width">
+    /// width of the image in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the image in texels
+    /// </param>
+    /// <returns>
+    /// number of bytes with no padding between rows of blocks
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not block compressed
+    /// </exception>
+    static size_t GetCompressedSize(GraphicsDataFormat format, UINT width, UINT height);
+
+    /// <summary>
+    /// Compresses an image
+    /// </summary>
+    /// <param name="src">
+    /// 4 bytes per texel of RGBA data
+    /// </param>
+    /// <param name="width">
+    /// width of the image in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the image in texels
+    /// </param>
+    /// <param name="src_row_pitch">
+    /// number of bytes between the start of consecutive rows of src
+    /// </param>
+    /// <param name="format">
+    /// format to compress to
+    /// </param>
+    /// <param name="quality">
+    /// how much time to spend on each block
+    /// </param>
+    /// <param name="dst">
+    /// where to write the blocks
+    /// </param>
+    /// <param name="dst_row_pitch">
+    /// number of bytes between the start of consecutive rows of blocks in dst
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported
+    /// </exception>
+    static void Compress(const void* src, UINT width, UINT height, UINT src_row_pitch, GraphicsDataFormat format, BlockCompressionQuality quality,
+      void* dst, UINT dst_row_pitch);
+
+    /// <summary>
+    /// Compresses an image into a tightly packed array, ready for TextureUploadBuffer::PrepUpload
+    /// </summary>
+    /// <param name="src">
+    /// 4 bytes per texel of RGBA data, with no padding between rows
+    /// </param>
+    /// <param name="width">
+    /// width of the image in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the image in texels
+    /// </param>
+    /// <param name="format">
+    /// format to compress to
+    /// </param>
+    /// <param name="quality">
+    /// how much time to spend on each block
+    /// </param>
+    /// <param name="dst">
+    /// output parameter for the blocks
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported or src is too small
+    /// </exception>
+    static void Compress(const std::vector<UINT8>& src, UINT width, UINT height, GraphicsDataFormat format, BlockCompressionQuality quality,
+      std::vector<UINT8>& dst);
+
+  private:
+    // disabled
+    BlockCompressor();
+    BlockCompressor(const BlockCompressor& cpy);
+    BlockCompressor& operator=(const BlockCompressor& cpy);
+};
+
+#endif /* BLOCK_COMPRESSOR_H */
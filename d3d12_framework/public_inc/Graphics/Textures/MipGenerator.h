@@ -0,0 +1,204 @@
+#ifndef MIP_GENERATOR_H
+#define MIP_GENERATOR_H
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/GraphicsDataFormat.h"
+
+/// <summary>
+/// Filter used to shrink each mipmap level into the next
+/// </summary>
+enum MipFilter
+{
+  /// <summary>
+  /// average of the texels each smaller texel covers.  Fastest, but softer and more prone to aliasing
+  /// </summary>
+  MIP_FILTER_BOX,
+
+  /// <summary>
+  /// Kaiser windowed sinc with a radius of 3 texels.  Sharp with little ringing
+  /// </summary>
+  MIP_FILTER_KAISER,
+
+  /// <summary>
+  /// Lanczos windowed sinc with a radius of 3 texels.  Sharpest, with some ringing at hard edges
+  /// </summary>
+  MIP_FILTER_LANCZOS
+};
+
+/// <summary>
+/// How filters read texels beyond the edges of a level
+/// </summary>
+enum MipEdgeMode
+{
+  /// <summary>
+  /// repeat the texels on the edge, for textures sampled with clamp addressing
+  /// </summary>
+  MIP_EDGE_CLAMP,
+
+  /// <summary>
+  /// read from the opposite edge, for textures sampled with wrap addressing
+  /// </summary>
+  MIP_EDGE_WRAP
+};
+
+/// <summary>
+/// Where to write 1 mipmap level
+/// </summary>
+struct MipLevelData
+{
+  /// <summary>
+  /// first row of the first slice of the level
+  /// </summary>
+  void* data;
+
+  /// <summary>
+  /// number of bytes between the start of consecutive rows
+  /// </summary>
+  UINT row_pitch;
+
+  /// <summary>
+  /// number of bytes between the start of consecutive slices.  Only used by 3D textures
+  /// </summary>
+  UINT slice_pitch;
+};
+
+/// <summary>
+/// Generates mipmap chains on the CPU.  Texels are filtered in linear space as 4 floats at a time with SSE2, so sRGB
+/// formats are converted to linear before filtering and back afterwards, and the work for each level is split by
+/// rows across the framework's worker threads.  Each level is written to its destination exactly once, in order, so
+/// the destination can be mapped upload memory.
+/// </summary>
+/// <remarks>
+/// Supported formats are R8_UNORM, R8G8_UNORM, R8B8G8A8_UNORM, R8G8B8A8_UNORM_SRGB, B8G8R8A8_UNORM,
+/// B8G8R8A8_UNORM_SRGB, R16G16_FLOAT, R16G16B16A16_FLOAT, R32_FLOAT, R32G32_FLOAT and R32G32B32A32_FLOAT.
+/// Array slices and cube faces are separate images, so each is generated on its own, and cube faces are filtered
+/// without reading across to their neighbors.
+/// </remarks>
+class MipGenerator
+{
+  public:
+    /// <summary>
+    /// Checks if mipmaps can be generated for a format
+    /// </summary>
+    /// <param name="format">
+    /// format of the texture
+    /// </param>
+    /// <returns>
+    /// true if the format is supported
+    /// false otherwise
+    /// </returns>
+    static bool IsFormatSupported(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Retrieves the number of bytes in 1 texel of a supported format
+    /// </summary>
+    /// <param name="format">
+    /// format of the texture
+    /// </param>
+    /// <returns>
+    /// number of bytes per texel
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported
+    /// </exception>
+    static UINT GetBytesPerTexel(GraphicsDataFormat format);
+
+    /// <summary>
+    /// Retrieves the number of levels in a full mipmap chain, down to 1x1x1
+    /// </summary>
+    /// <param name="width">
+    /// width of the top level in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the top level in texels
+    /// </param>
+    /// <param name="depth">
+    /// depth of the top level in texels
+    /// </param>
+    /// <returns>
+    /// number of levels
+    /// </returns>
+    static UINT16 GetNumLevels(UINT width, UINT height = 1, UINT depth = 1);
+
+    /// <summary>
+    /// Generates a mipmap chain.  Each level is half the size of the previous one along each axis, rounded down,
+    /// with a minimum of 1
+    /// </summary>
+    /// <param name="src">
+    /// texels of the top level, with no padding between rows or slices
+    /// </param>
+    /// <param name="width">
+    /// width of the top level in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the top level in texels.  1 for 1D textures
+    /// </param>
+    /// <param name="depth">
+    /// depth of the top level in texels.  1 for anything other than 3D textures
+    /// </param>
+    /// <param name="format">
+    /// format of the texels
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how to read texels beyond the edges
+    /// </param>
+    /// <param name="num_levels">
+    /// number of levels to write, including the top level
+    /// </param>
+    /// <param name="levels">
+    /// where to write each level.  Level 0 receives a copy of src
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported or there are more levels than the full chain
+    /// </exception>
+    static void Generate(const void* src, UINT width, UINT height, UINT depth, GraphicsDataFormat format, MipFilter filter,
+      MipEdgeMode edge_mode, UINT num_levels, const MipLevelData* levels);
+
+    /// <summary>
+    /// Generates a mipmap chain into tightly packed arrays, ready for TextureUploadBuffer::PrepUpload
+    /// </summary>
+    /// <param name="src">
+    /// texels of the top level, with no padding between rows or slices
+    /// </param>
+    /// <param name="width">
+    /// width of the top level in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the top level in texels.  1 for 1D textures
+    /// </param>
+    /// <param name="depth">
+    /// depth of the top level in texels.  1 for anything other than 3D textures
+    /// </param>
+    /// <param name="format">
+    /// format of the texels
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how to read texels beyond the edges
+    /// </param>
+    /// <param name="num_levels">
+    /// number of levels to generate, including the top level
+    /// </param>
+    /// <param name="levels">
+    /// output parameter for the texels of each level, starting with a copy of the top level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported, src is too small or there are more levels than the full chain
+    /// </exception>
+    static void Generate(const std::vector<UINT8>& src, UINT width, UINT height, UINT depth, GraphicsDataFormat format, MipFilter filter,
+      MipEdgeMode edge_mode, UINT num_levels, std::vector<std::vector<UINT8> >& levels);
+
+  private:
+    // disabled
+    MipGenerator();
+    MipGenerator(const MipGenerator& cpy);
+    MipGenerator& operator=(const MipGenerator& cpy);
+};
+
+#endif /* MIP_GENERATOR_H */
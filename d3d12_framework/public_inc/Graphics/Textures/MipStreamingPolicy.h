@@ -0,0 +1,317 @@
+#ifndef MIP_STREAMING_POLICY_H
+#define MIP_STREAMING_POLICY_H
+
+#include <windows.h>
+#include <vector>
+
+/// <summary>
+/// A mipmap level that the policy decided to upload or evict
+/// </summary>
+struct MipStreamingAction
+{
+  /// <summary>
+  /// index of the texture returned by AddTexture
+  /// </summary>
+  UINT texture;
+
+  /// <summary>
+  /// mipmap level to upload or evict
+  /// </summary>
+  UINT16 mip_level;
+};
+
+/// <summary>
+/// Decides which mipmap levels of streamed textures to upload and evict each frame.  Each texture keeps its least
+/// detailed levels, the tail, resident at all times, and the levels more detailed than that are uploaded 1 at a time,
+/// most detailed last, so the resident levels of a texture are always a contiguous range ending at its least detailed
+/// level.  Does not touch the GPU, so the decisions can be checked on the CPU.
+/// </summary>
+/// <remarks>
+/// Each frame, textures that want more detail than they have are ordered by how many levels they are missing, then
+/// by their size on screen, and the next level of each is scheduled while the upload budget allows.  The first upload
+/// of a frame is always allowed, so levels larger than the upload budget still stream in.  When the memory budget
+/// would be exceeded, levels are evicted first from textures that have more detail than they want, then from textures
+/// that would still be missing fewer levels afterwards than the texture being uploaded to.  A texture that gives up a
+/// level does not get an upload in the same frame.
+/// </remarks>
+class MipStreamingPolicy
+{
+  public:
+    /// <summary>
+    /// Creates a policy with no textures
+    /// </summary>
+    /// <param name="memory_budget">
+    /// number of bytes that the resident levels of all textures may take
+    /// </param>
+    /// <param name="upload_budget">
+    /// number of bytes that may be uploaded per call to Schedule
+    /// </param>
+    MipStreamingPolicy(UINT64 memory_budget, UINT64 upload_budget);
+
+    ~MipStreamingPolicy();
+
+    /// <summary>
+    /// Gets the mipmap level that has enough detail for a texture at a size on screen.  A level has enough detail once
+    /// it has at least 1 texel per pixel
+    /// </summary>
+    /// <param name="width">
+    /// width of the top mipmap level in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the top mipmap level in texels
+    /// </param>
+    /// <param name="num_levels">
+    /// number of mipmap levels in the texture
+    /// </param>
+    /// <param name="screen_size">
+    /// largest dimension of the texture on screen in pixels, or 0 when it is not visible
+    /// </param>
+    /// <returns>
+    /// least detailed mipmap level with enough detail
+    /// </returns>
+    static UINT16 GetLevelForScreenSize(UINT width, UINT height, UINT16 num_levels, float screen_size);
+
+    /// <summary>
+    /// Estimates the size on screen of an object from its distance to the camera
+    /// </summary>
+    /// <param name="radius">
+    /// radius of the object's bounding sphere
+    /// </param>
+    /// <param name="distance">
+    /// distance from the camera to the center of the bounding sphere
+    /// </param>
+    /// <param name="fov_y">
+    /// vertical field of view of the camera in radians
+    /// </param>
+    /// <param name="viewport_height">
+    /// height of the viewport in pixels
+    /// </param>
+    /// <returns>
+    /// diameter of the bounding sphere on screen in pixels
+    /// </returns>
+    static float GetScreenSizeAtDistance(float radius, float distance, float fov_y, float viewport_height);
+
+    /// <summary>
+    /// Adds a texture, with only its tail resident
+    /// </summary>
+    /// <param name="width">
+    /// width of the top mipmap level in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the top mipmap level in texels
+    /// </param>
+    /// <param name="level_sizes">
+    /// number of bytes that each mipmap level takes when resident, for every mipmap level of the texture.  The bytes
+    /// of the tail may be split between its levels in any way
+    /// </param>
+    /// <param name="num_streamed_levels">
+    /// number of mipmap levels that are streamed, starting with the top one.  The rest are the tail
+    /// </param>
+    /// <returns>
+    /// index of the texture
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when there are no mipmap levels, or no tail
+    /// </exception>
+    UINT AddTexture(UINT width, UINT height, const std::vector<UINT64>& level_sizes, UINT16 num_streamed_levels);
+
+    /// <summary>
+    /// Sets how large a texture is on screen, which decides how detailed it should be and how urgently
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <param name="screen_size">
+    /// largest dimension of the texture on screen in pixels, or 0 when it is not visible
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture index is out of range
+    /// </exception>
+    void SetScreenSize(UINT texture, float screen_size);
+
+    /// <summary>
+    /// Sets the number of bytes that the resident levels of all textures may take.  Lowering it evicts levels on the
+    /// next call to Schedule
+    /// </summary>
+    /// <param name="memory_budget">
+    /// number of bytes
+    /// </param>
+    void SetMemoryBudget(UINT64 memory_budget);
+
+    /// <summary>
+    /// Sets the number of bytes that may be uploaded per call to Schedule
+    /// </summary>
+    /// <param name="upload_budget">
+    /// number of bytes
+    /// </param>
+    void SetUploadBudget(UINT64 upload_budget);
+
+    /// <summary>
+    /// Gets the number of textures
+    /// </summary>
+    /// <returns>
+    /// number of textures
+    /// </returns>
+    UINT GetNumTextures() const;
+
+    /// <summary>
+    /// Gets the most detailed mipmap level of a texture that can be sampled
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <returns>
+    /// mipmap level
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture index is out of range
+    /// </exception>
+    UINT16 GetResidentLevel(UINT texture) const;
+
+    /// <summary>
+    /// Gets the mipmap level that a texture should have resident for its size on screen
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <returns>
+    /// mipmap level
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture index is out of range
+    /// </exception>
+    UINT16 GetDesiredLevel(UINT texture) const;
+
+    /// <summary>
+    /// Gets the number of bytes taken by the resident levels of all textures, including levels being uploaded
+    /// </summary>
+    /// <returns>
+    /// number of bytes
+    /// </returns>
+    UINT64 GetResidentBytes() const;
+
+    /// <summary>
+    /// Decides which mipmap levels to upload and evict.  Evicted levels stop being resident immediately, while
+    /// uploaded levels become resident when OnUploaded is called for them
+    /// </summary>
+    /// <param name="uploads">
+    /// output parameter for the levels to upload, in the order to upload them
+    /// </param>
+    /// <param name="evictions">
+    /// output parameter for the levels to evict
+    /// </param>
+    void Schedule(std::vector<MipStreamingAction>& uploads, std::vector<MipStreamingAction>& evictions);
+
+    /// <summary>
+    /// Reports that an upload scheduled by Schedule has completed, making the level resident
+    /// </summary>
+    /// <param name="upload">
+    /// level that was uploaded
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the level was not being uploaded
+    /// </exception>
+    void OnUploaded(const MipStreamingAction& upload);
+
+  private:
+    // disabled
+    MipStreamingPolicy();
+    MipStreamingPolicy(const MipStreamingPolicy& cpy);
+    MipStreamingPolicy& operator=(const MipStreamingPolicy& cpy);
+
+    /// <summary>
+    /// Streaming state of 1 texture
+    /// </summary>
+    struct TextureState
+    {
+      /// <summary>
+      /// width of the top mipmap level in texels
+      /// </summary>
+      UINT width;
+
+      /// <summary>
+      /// height of the top mipmap level in texels
+      /// </summary>
+      UINT height;
+
+      /// <summary>
+      /// number of bytes that each level takes when resident
+      /// </summary>
+      std::vector<UINT64> level_sizes;
+
+      /// <summary>
+      /// number of mipmap levels in the texture
+      /// </summary>
+      UINT16 num_levels;
+
+      /// <summary>
+      /// number of mipmap levels before the tail
+      /// </summary>
+      UINT16 num_streamed;
+
+      /// <summary>
+      /// most detailed resident level
+      /// </summary>
+      UINT16 resident;
+
+      /// <summary>
+      /// least detailed level with enough detail for the size on screen, which may be in the tail
+      /// </summary>
+      UINT16 desired;
+
+      /// <summary>
+      /// if resident - 1 is being uploaded
+      /// </summary>
+      bool uploading;
+
+      /// <summary>
+      /// largest dimension of the texture on screen in pixels
+      /// </summary>
+      float screen_size;
+    };
+
+    /// <summary>
+    /// Finds the texture to evict a level from to make room for an upload
+    /// </summary>
+    /// <param name="candidate">
+    /// index of the texture being uploaded to
+    /// </param>
+    /// <returns>
+    /// index of the texture to evict the most detailed resident level of
+    /// UINT_MAX if no texture can give up a level
+    /// </returns>
+    UINT FindVictim(UINT candidate) const;
+
+    /// <summary>
+    /// Evicts the most detailed resident level of a texture
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <param name="evictions">
+    /// list to add the eviction to
+    /// </param>
+    void Evict(UINT texture, std::vector<MipStreamingAction>& evictions);
+
+    /// <summary>
+    /// streaming state of each texture
+    /// </summary>
+    std::vector<TextureState> m_textures;
+
+    /// <summary>
+    /// number of bytes that the resident levels may take
+    /// </summary>
+    UINT64 m_memory_budget;
+
+    /// <summary>
+    /// number of bytes that may be uploaded per call to Schedule
+    /// </summary>
+    UINT64 m_upload_budget;
+
+    /// <summary>
+    /// number of bytes taken by the resident levels, including levels being uploaded
+    /// </summary>
+    UINT64 m_resident_bytes;
+};
+
+#endif /* MIP_STREAMING_POLICY_H */
@@ -0,0 +1,105 @@
+#ifndef PNG_DECODER_H
+#define PNG_DECODER_H
+
+#include <windows.h>
+#include <vector>
+#include <string>
+#include <functional>
+
+/// <summary>
+/// Where the rows of a decoded image are written
+/// </summary>
+struct PngDestination
+{
+  /// <summary>
+  /// first row of the image
+  /// </summary>
+  void* data;
+
+  /// <summary>
+  /// number of bytes between the start of consecutive rows.  At least 4 * the width of the image
+  /// </summary>
+  UINT row_pitch;
+};
+
+/// <summary>
+/// Decodes PNG files to 8-bit RGBA texels using lodepng for the header and inflate.  Scanlines are unfiltered straight
+/// into the destination rows, so images can be decoded into the memory returned by TextureUploadBuffer::Map at the
+/// footprint's row pitch without an unpitched copy of the decoded image.
+/// </summary>
+/// <remarks>
+/// 8-bit RGBA, RGB, greyscale and greyscale with alpha images that are not interlaced take the direct path.  lodepng
+/// only inflates whole buffers, so the direct path still gathers the IDAT chunks into 1 compressed buffer and inflates
+/// it into a buffer of every filtered scanline, which is the size of the image plus 1 byte per row.  Other images
+/// (palettes, other bit depths, interlacing and color keys) are decoded by lodepng into an unpitched image and copied
+/// to the rows.
+/// </remarks>
+class PngDecoder
+{
+  public:
+    /// <summary>
+    /// Called once the header of an image is read, to get where its rows go.  May be called from several threads at
+    /// once, for different images
+    /// </summary>
+    typedef std::function<PngDestination(UINT index, UINT width, UINT height)> DestinationCallback;
+
+    /// <summary>
+    /// Reads the size of an image from its header
+    /// </summary>
+    /// <param name="png">
+    /// contents of the PNG file
+    /// </param>
+    /// <param name="size">
+    /// number of bytes in png
+    /// </param>
+    /// <param name="width">
+    /// output parameter for the width of the image in texels
+    /// </param>
+    /// <param name="height">
+    /// output parameter for the height of the image in texels
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the header is not valid
+    /// </exception>
+    static void ReadHeader(const void* png, size_t size, UINT& width, UINT& height);
+
+    /// <summary>
+    /// Decodes an image into rows of 8-bit RGBA texels
+    /// </summary>
+    /// <param name="png">
+    /// contents of the PNG file
+    /// </param>
+    /// <param name="size">
+    /// number of bytes in png
+    /// </param>
+    /// <param name="dst">
+    /// where to write the rows.  Large enough for the size read by ReadHeader
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the image cannot be decoded
+    /// </exception>
+    static void Decode(const void* png, size_t size, const PngDestination& dst);
+
+    /// <summary>
+    /// Reads and decodes several files at once.  A separate thread reads the files in order while the framework's
+    /// worker threads decode the ones that have been read, and each file's contents are freed once it is decoded
+    /// </summary>
+    /// <param name="paths">
+    /// paths of the PNG files
+    /// </param>
+    /// <param name="get_destination">
+    /// called with the index in paths and size of each image before it is decoded
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when a file cannot be read or decoded, or the callback throws.  Every other file is still decoded first
+    /// </exception>
+    static void DecodeFiles(const std::vector<std::string>& paths, const DestinationCallback& get_destination);
+
+  private:
+    // disabled
+    PngDecoder();
+    PngDecoder(const PngDecoder& cpy);
+    PngDecoder& operator=(const PngDecoder& cpy);
+};
+
+#endif /* PNG_DECODER_H */
@@ -0,0 +1,125 @@
+#ifndef TEXEL_COPY_H
+#define TEXEL_COPY_H
+
+#include <windows.h>
+#include "Graphics/GraphicsDataFormat.h"
+
+/// <summary>
+/// Conversion applied to texels while they are copied
+/// </summary>
+enum TexelConversion
+{
+  /// <summary>
+  /// bytes are copied as they are
+  /// </summary>
+  TEXEL_CONVERSION_NONE,
+
+  /// <summary>
+  /// 3 byte RGB8 texels are expanded to 4 byte RGBA8 texels with an alpha of 255
+  /// </summary>
+  TEXEL_CONVERSION_RGB8_TO_RGBA8,
+
+  /// <summary>
+  /// the first and third bytes of each 4 byte texel are swapped, converting BGRA8 to RGBA8 and back
+  /// </summary>
+  TEXEL_CONVERSION_SWAP_RB8,
+
+  /// <summary>
+  /// each 32-bit float channel is converted to a 16-bit float, rounding to nearest even
+  /// </summary>
+  TEXEL_CONVERSION_FLOAT_TO_HALF
+};
+
+/// <summary>
+/// Copies rows of texels into upload buffers, converting them on the way if needed.  The rows are written with
+/// non-temporal streaming stores wherever the destination is aligned, which suits the write-combined memory of upload
+/// buffers since it is never read back, and large copies are split across the thread pool
+/// </summary>
+/// <remarks>
+/// The kernels use SSE2, or AVX2 when the compiler targets it (/arch:AVX2), and the float to half conversion uses F16C
+/// when it is available.  Streaming stores bypass the cache, so the destination should not be memory the CPU is about
+/// to read.
+/// </remarks>
+class TexelCopy
+{
+  public:
+    /// <summary>
+    /// Gets the number of source bytes that convert to a row of destination bytes
+    /// </summary>
+    /// <param name="dst_row_size">
+    /// number of bytes in a row of the destination
+    /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels
+    /// </param>
+    /// <returns>
+    /// number of bytes in a row of the source
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the destination row is not a whole number of the conversion's texels
+    /// </exception>
+    static UINT GetSourceRowSize(UINT dst_row_size, TexelConversion conversion);
+
+    /// <summary>
+    /// Checks if a conversion writes texels of a format.  A conversion only works when its output texels have the size
+    /// and type of the format's, so none of them write block compressed formats
+    /// </summary>
+    /// <param name="dst_format">
+    /// format of the destination texels
+    /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels
+    /// </param>
+    /// <returns>
+    /// true  if the conversion writes texels of the format
+    /// false otherwise
+    /// </returns>
+    static bool IsConversionSupported(GraphicsDataFormat dst_format, TexelConversion conversion);
+
+    /// <summary>
+    /// Copies rows of texels from 1 or more depth slices, converting them
+    /// </summary>
+    /// <param name="dst">
+    /// where to write the first row of the first slice
+    /// </param>
+    /// <param name="dst_row_pitch">
+    /// number of bytes between the start of consecutive rows of the destination
+    /// </param>
+    /// <param name="dst_slice_pitch">
+    /// number of bytes between the start of consecutive slices of the destination
+    /// </param>
+    /// <param name="src">
+    /// first row of the first slice to read
+    /// </param>
+    /// <param name="src_row_pitch">
+    /// number of bytes between the start of consecutive rows of the source
+    /// </param>
+    /// <param name="src_slice_pitch">
+    /// number of bytes between the start of consecutive slices of the source
+    /// </param>
+    /// <param name="dst_row_size">
+    /// number of bytes to write to each row of the destination.  Padding after it up to the row pitch is left alone
+    /// </param>
+    /// <param name="num_rows">
+    /// number of rows in each slice
+    /// </param>
+    /// <param name="depth">
+    /// number of slices
+    /// </param>
+    /// <param name="conversion">
+    /// conversion to apply to the texels
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the destination row is not a whole number of the conversion's texels
+    /// </exception>
+    static void CopyRows(void* dst, SIZE_T dst_row_pitch, SIZE_T dst_slice_pitch, const void* src, SIZE_T src_row_pitch, SIZE_T src_slice_pitch,
+      UINT dst_row_size, UINT num_rows, UINT depth = 1, TexelConversion conversion = TEXEL_CONVERSION_NONE);
+
+  private:
+    // disabled
+    TexelCopy();
+    TexelCopy(const TexelCopy& cpy);
+    TexelCopy& operator=(const TexelCopy& cpy);
+};
+
+#endif /* TEXEL_COPY_H */
@@ -0,0 +1,296 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+class ShaderResourceDescHeap;
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/GraphicsDataFormat.h"
+#include "Graphics/Textures/AtlasPacker.h"
+#include "Graphics/Textures/Texture2D.h"
+#include "Graphics/Textures/Texture2DArray.h"
+
+/// <summary>
+/// Where an image ended up in a texture atlas
+/// </summary>
+struct AtlasRegion
+{
+  /// <summary>
+  /// page the image is on, which is the index into the texture array
+  /// </summary>
+  UINT16 page;
+
+  /// <summary>
+  /// texels of the image in the page, not including its gutter
+  /// </summary>
+  AtlasRect rect;
+
+  /// <summary>
+  /// texture coordinate of the image's left edge
+  /// </summary>
+  float u0;
+
+  /// <summary>
+  /// texture coordinate of the image's top edge
+  /// </summary>
+  float v0;
+
+  /// <summary>
+  /// texture coordinate of the image's right edge
+  /// </summary>
+  float u1;
+
+  /// <summary>
+  /// texture coordinate of the image's bottom edge
+  /// </summary>
+  float v1;
+};
+
+/// <summary>
+/// Packs many small images into a few large pages, so draws that use different images can share 1 texture and 1
+/// descriptor.  Images are added, then packed with AtlasPacker, and each one's page and texture coordinates are
+/// looked up by the index it was added at
+/// </summary>
+/// <remarks>
+/// Each image is surrounded by a gutter of copies of its edge texels, so filtering near its edge does not pick up its
+/// neighbors.  For mipmapped pages, each image and its gutter are rounded up to a cell that starts on a multiple of
+/// 2^(levels - 1) texels, so no texel of any level mixes 2 images, and a padding of at least 2^(levels - 1) keeps
+/// bilinear filtering of the smallest level inside of the gutter.  Filters wider than a box can still bleed into the
+/// gutter of the smallest levels.
+///
+/// The pages are uploaded with TextureUploadBuffer::PrepUpload, or PrepUploadMips when there are mipmaps, from
+/// GetPage into the texture created by CreateTexture2D or CreateTexture2DArray.
+/// </remarks>
+class TextureAtlas
+{
+  public:
+    /// <summary>
+    /// Creates an atlas with no images
+    /// </summary>
+    /// <param name="page_width">
+    /// width of each page in texels
+    /// </param>
+    /// <param name="page_height">
+    /// height of each page in texels
+    /// </param>
+    /// <param name="format">
+    /// format of the images and pages.  Must be supported by MipGenerator
+    /// </param>
+    /// <param name="padding">
+    /// number of gutter texels on each side of each image
+    /// </param>
+    /// <param name="num_mip_levels">
+    /// number of mipmap levels the pages will have, which decides how the images are aligned.  Unlike Texture2D, 0 is
+    /// not a full chain
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the format is not supported, the number of mipmap levels is 0 or more than the page size has, or the
+    /// page size is not a multiple of the cell alignment
+    /// </exception>
+    TextureAtlas(UINT page_width, UINT page_height, GraphicsDataFormat format, UINT padding = 1, UINT16 num_mip_levels = 1);
+
+    ~TextureAtlas();
+
+    /// <summary>
+    /// Adds a copy of an image to the atlas.  It is placed by the next call to Pack
+    /// </summary>
+    /// <param name="data">
+    /// texels of the image in the atlas's format
+    /// </param>
+    /// <param name="width">
+    /// width of the image in texels
+    /// </param>
+    /// <param name="height">
+    /// height of the image in texels
+    /// </param>
+    /// <param name="row_pitch">
+    /// number of bytes between the start of consecutive rows of data
+    /// </param>
+    /// <returns>
+    /// index of the image
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the image is empty
+    /// </exception>
+    UINT Add(const void* data, UINT width, UINT height, UINT row_pitch);
+
+    /// <summary>
+    /// Places every image in the pages, largest first, opening a new page whenever an image does not fit in the
+    /// existing ones, and fills in the pages' texels.  Packing again after adding more images can move every image
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an image and its gutter are larger than a page
+    /// </exception>
+    void Pack();
+
+    /// <summary>
+    /// Gets the number of images that have been added
+    /// </summary>
+    /// <returns>
+    /// number of images
+    /// </returns>
+    UINT GetNumImages() const;
+
+    /// <summary>
+    /// Gets the number of pages the images were packed into
+    /// </summary>
+    /// <returns>
+    /// number of pages
+    /// </returns>
+    UINT16 GetNumPages() const;
+
+    /// <summary>
+    /// Gets where an image was placed by the last call to Pack
+    /// </summary>
+    /// <param name="image">
+    /// index of the image
+    /// </param>
+    /// <returns>
+    /// page and texture coordinates of the image
+    /// </returns>
+    const AtlasRegion& GetRegion(UINT image) const;
+
+    /// <summary>
+    /// Gets the texels of a page, tightly packed, for uploading to its top mipmap level
+    /// </summary>
+    /// <param name="page">
+    /// index of the page
+    /// </param>
+    /// <returns>
+    /// texels of the page
+    /// </returns>
+    const std::vector<UINT8>& GetPage(UINT16 page) const;
+
+    /// <summary>
+    /// Gets how much of the pages the images cover, not counting their gutters
+    /// </summary>
+    /// <returns>
+    /// fraction of the pages' area from 0 to 1
+    /// </returns>
+    float GetOccupancy() const;
+
+    /// <summary>
+    /// Creates a texture for 1 page
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    Texture2D* CreateTexture2D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+    /// <summary>
+    /// Creates a texture array with 1 texture per page
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture array instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when there are no pages, or an error is encountered
+    /// </exception>
+    Texture2DArray* CreateTexture2DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const;
+
+  private:
+    // disabled
+    TextureAtlas();
+    TextureAtlas(const TextureAtlas& cpy);
+    TextureAtlas& operator=(const TextureAtlas& cpy);
+
+    /// <summary>
+    /// Image waiting to be packed
+    /// </summary>
+    struct Image
+    {
+      /// <summary>
+      /// tightly packed texels of the image
+      /// </summary>
+      std::vector<UINT8> texels;
+
+      /// <summary>
+      /// width of the image in texels
+      /// </summary>
+      UINT width;
+
+      /// <summary>
+      /// height of the image in texels
+      /// </summary>
+      UINT height;
+    };
+
+    /// <summary>
+    /// Copies an image into its cell of a page, filling the rest of the cell with copies of its edge texels
+    /// </summary>
+    /// <param name="image">
+    /// index of the image
+    /// </param>
+    /// <param name="cell">
+    /// cell of the image in its page
+    /// </param>
+    void FillCell(UINT image, const AtlasRect& cell);
+
+    /// <summary>
+    /// width of each page in texels
+    /// </summary>
+    UINT m_page_width;
+
+    /// <summary>
+    /// height of each page in texels
+    /// </summary>
+    UINT m_page_height;
+
+    /// <summary>
+    /// format of the images and pages
+    /// </summary>
+    GraphicsDataFormat m_format;
+
+    /// <summary>
+    /// number of bytes per texel of the format
+    /// </summary>
+    UINT m_texel_size;
+
+    /// <summary>
+    /// number of gutter texels on each side of each image
+    /// </summary>
+    UINT m_padding;
+
+    /// <summary>
+    /// number of mipmap levels the pages will have
+    /// </summary>
+    UINT16 m_num_mip_levels;
+
+    /// <summary>
+    /// number of texels each cell's position and size are a multiple of
+    /// </summary>
+    UINT m_cell_alignment;
+
+    /// <summary>
+    /// images that have been added
+    /// </summary>
+    std::vector<Image> m_images;
+
+    /// <summary>
+    /// where each image was placed
+    /// </summary>
+    std::vector<AtlasRegion> m_regions;
+
+    /// <summary>
+    /// texels of each page
+    /// </summary>
+    std::vector<std::vector<UINT8> > m_pages;
+};
+
+#endif /* TEXTURE_ATLAS_H */
@@ -0,0 +1,442 @@
+#ifndef TEXTURE_FILE_H
+#define TEXTURE_FILE_H
+
+class CommandList;
+class ShaderResourceDescHeap;
+
+#include <windows.h>
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/GraphicsDataFormat.h"
+#include "Graphics/Textures/TextureUploadBuffer.h"
+
+/// <summary>
+/// Which texture class a texture file is loaded as
+/// </summary>
+enum TextureFileType
+{
+  TEXTURE_FILE_1D,
+  TEXTURE_FILE_1D_ARRAY,
+  TEXTURE_FILE_2D,
+  TEXTURE_FILE_2D_ARRAY,
+  TEXTURE_FILE_3D,
+  TEXTURE_FILE_CUBE,
+  TEXTURE_FILE_CUBE_ARRAY
+};
+
+/// <summary>
+/// Location of 1 subresource inside of a texture file's mapping
+/// </summary>
+struct TextureFileSubresource
+{
+  /// <summary>
+  /// first row of the first slice
+  /// </summary>
+  const void* data;
+
+  /// <summary>
+  /// number of bytes between the start of consecutive rows.  Block compressed formats count rows of 4x4 blocks
+  /// </summary>
+  UINT row_pitch;
+
+  /// <summary>
+  /// number of bytes between the start of consecutive depth slices
+  /// </summary>
+  UINT slice_pitch;
+};
+
+/// <summary>
+/// Read only DDS or KTX2 texture.  The file is memory mapped and each subresource is copied straight from the mapping
+/// into the footprint it has in the upload buffer, so there is no intermediate decode buffer
+/// </summary>
+/// <remarks>
+/// DDS files can use the DX10 header or the legacy FourCC and RGB masks for the formats in GraphicsDataFormat.  KTX2
+/// files must not be supercompressed.  Cube maps must have all 6 faces, and a KTX2 file with a level count of 0 is
+/// loaded with only its top mipmap level.
+/// </remarks>
+class TextureFile
+{
+  public:
+    /// <summary>
+    /// Memory maps the specified DDS or KTX2 file and validates its layout.  The container is detected from the
+    /// start of the file rather than its extension
+    /// </summary>
+    /// <param name="path">
+    /// path to the texture file to open
+    /// </param>
+    /// <returns>
+    /// pointer to the TextureFile instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file cannot be mapped, is not a valid texture file or uses an unsupported format
+    /// </exception>
+    static TextureFile* OpenD3D12(const char* path);
+
+    /// <summary>
+    /// Unmaps the texture file.  Textures created from it are unaffected, but uploads from it must have executed
+    /// </summary>
+    virtual ~TextureFile();
+
+    /// <summary>
+    /// Retrieves which texture class the file is loaded as
+    /// </summary>
+    /// <returns>
+    /// type of the texture
+    /// </returns>
+    virtual TextureFileType GetType() const = 0;
+
+    /// <summary>
+    /// Retrieves the format of the texels
+    /// </summary>
+    /// <returns>
+    /// format of the texture
+    /// </returns>
+    virtual GraphicsDataFormat GetFormat() const = 0;
+
+    /// <summary>
+    /// Retrieves the width of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// width in texels
+    /// </returns>
+    virtual UINT GetWidth() const = 0;
+
+    /// <summary>
+    /// Retrieves the height of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// height in texels, 1 for 1D textures
+    /// </returns>
+    virtual UINT GetHeight() const = 0;
+
+    /// <summary>
+    /// Retrieves the depth of the top mipmap level
+    /// </summary>
+    /// <returns>
+    /// depth in texels, 1 for anything other than 3D textures
+    /// </returns>
+    virtual UINT16 GetDepth() const = 0;
+
+    /// <summary>
+    /// Retrieves the number of textures in the array
+    /// </summary>
+    /// <returns>
+    /// number of textures, or number of cubes for cube arrays.  1 for types that are not arrays
+    /// </returns>
+    virtual UINT16 GetArraySize() const = 0;
+
+    /// <summary>
+    /// Retrieves the number of mipmap levels stored in the file
+    /// </summary>
+    /// <returns>
+    /// number of mipmap levels
+    /// </returns>
+    virtual UINT16 GetNumMipmapLevels() const = 0;
+
+    /// <summary>
+    /// Retrieves where a subresource is in the mapping for processing on the CPU.  Only valid while the texture file
+    /// is open
+    /// </summary>
+    /// <param name="index">
+    /// index of the texture in the array.  For cubes this is the cube index * 6 + the side index
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level
+    /// </param>
+    /// <returns>
+    /// location of the subresource
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the index or mipmap level is out of range
+    /// </exception>
+    virtual TextureFileSubresource GetSubresource(UINT index, UINT16 mip_level) const = 0;
+
+    /// <summary>
+    /// Creates a 1D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 1D texture or an error is encountered
+    /// </exception>
+    virtual Texture1D* CreateTexture1D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a 1D texture array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 1D texture array or an error is encountered
+    /// </exception>
+    virtual Texture1DArray* CreateTexture1DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a 2D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture or an error is encountered
+    /// </exception>
+    virtual Texture2D* CreateTexture2D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a 2D texture array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture array or an error is encountered
+    /// </exception>
+    virtual Texture2DArray* CreateTexture2DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a 3D texture that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 3D texture or an error is encountered
+    /// </exception>
+    virtual Texture3D* CreateTexture3D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a texture cube that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a cube map or an error is encountered
+    /// </exception>
+    virtual TextureCube* CreateTextureCube(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates a texture cube array that fits the file
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the texture will be accessed from
+    /// </param>
+    /// <returns>
+    /// pointer to the texture instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a cube map array or an error is encountered
+    /// </exception>
+    virtual TextureCubeArray* CreateTextureCubeArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const = 0;
+
+    /// <summary>
+    /// Creates an upload buffer large enough for every subresource of the file at once
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <returns>
+    /// pointer to the upload buffer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual TextureUploadBuffer* CreateUploadBuffer(const GraphicsCore& graphics) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture1D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1D& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture1DArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1DArray& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture2D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2D& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture2DArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2DArray& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTexture3D
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture3D& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTextureCube
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCube& texture) const = 0;
+
+    /// <summary>
+    /// Copies every subresource from the mapping into the upload buffer and preps the command list for uploading them
+    /// to the texture.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="upload_buffer">
+    /// upload buffer created by CreateUploadBuffer
+    /// </param>
+    /// <param name="texture">
+    /// texture created by CreateTextureCubeArray
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the texture does not fit the file or an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCubeArray& texture) const = 0;
+
+  protected:
+    TextureFile();
+
+  private:
+    // disabled
+    TextureFile(const TextureFile& cpy);
+    TextureFile& operator=(const TextureFile& cpy);
+};
+
+#endif /* TEXTURE_FILE_H */
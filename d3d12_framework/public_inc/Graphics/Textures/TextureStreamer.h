@@ -0,0 +1,133 @@
+#ifndef TEXTURE_STREAMER_H
+#define TEXTURE_STREAMER_H
+
+class ShaderResourceDescHeap;
+
+#include "Graphics/GraphicsCore.h"
+#include "Graphics/CommandList.h"
+#include "Graphics/Textures/Texture2D.h"
+#include "Graphics/Textures/TextureFile.h"
+#include "Graphics/Textures/MipStreamingPolicy.h"
+
+/// <summary>
+/// Streams the mipmap levels of 2D textures in and out of GPU memory.  Each texture is created with all of its levels,
+/// but only its tail, the levels too small to be tiled, has memory to begin with.  Its more detailed levels get memory
+/// and are uploaded from its TextureFile as MipStreamingPolicy decides, within a per-frame upload budget, and give up
+/// their memory again when the memory budget runs out.  The texture's view is clamped to the most detailed level that
+/// is resident, so sampling never reads a level without memory.
+/// </summary>
+/// <remarks>
+/// Each frame, call Poll, set the screen sizes through GetPolicy, call PrepUpdate while recording a command list, and
+/// call Submit once that command list is executed.  Poll and PrepUpdate rewrite the views of textures whose resident
+/// levels changed, so they must not be called while a command list that samples a streamed texture is executing.
+///
+/// Textures are reserved resources, so the device must support tiled resources.  The GPU must be done with the
+/// streamer before it is deleted, so call GraphicsCore::WaitOnFence first.
+/// </remarks>
+class TextureStreamer
+{
+  public:
+    /// <summary>
+    /// Creates a texture streamer
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface.  Its fence is used to tell when uploads have finished
+    /// </param>
+    /// <param name="shader_buffer_heap">
+    /// shader resources descriptor heap that the textures will be accessed from
+    /// </param>
+    /// <param name="memory_budget">
+    /// number of bytes of GPU memory that the resident levels of all textures may take
+    /// </param>
+    /// <param name="upload_budget">
+    /// number of bytes of streamed levels that may be uploaded per call to PrepUpdate
+    /// </param>
+    /// <returns>
+    /// pointer to the texture streamer instance
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the device does not support tiled resources, or another error is encountered
+    /// </exception>
+    static TextureStreamer* CreateD3D12(GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget);
+
+    /// <summary>
+    /// Cleans up the texture streamer and its textures
+    /// </summary>
+    virtual ~TextureStreamer();
+
+    /// <summary>
+    /// Adds a texture that streams from a file.  Its tail is uploaded by the next call to PrepUpdate
+    /// </summary>
+    /// <param name="file">
+    /// 2D texture file to stream from.  Must stay open until the streamer is deleted
+    /// </param>
+    /// <returns>
+    /// index of the texture, for GetTexture and the policy
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the file is not a 2D texture, or an error is encountered
+    /// </exception>
+    virtual UINT AddTexture(const TextureFile& file) = 0;
+
+    /// <summary>
+    /// Retrieves a texture, for binding
+    /// </summary>
+    /// <param name="texture">
+    /// index of the texture
+    /// </param>
+    /// <returns>
+    /// the texture
+    /// </returns>
+    virtual const Texture2D& GetTexture(UINT texture) const = 0;
+
+    /// <summary>
+    /// Retrieves the policy that decides which levels are resident, for setting screen sizes and budgets
+    /// </summary>
+    /// <returns>
+    /// streaming policy
+    /// </returns>
+    virtual MipStreamingPolicy& GetPolicy() = 0;
+
+    /// <summary>
+    /// Evicts and uploads the levels the policy schedules.  Evicted levels are clamped off immediately, and uploads are
+    /// added to the command list
+    /// </summary>
+    /// <param name="command_list">
+    /// command list that is being recorded
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when the previous update was not submitted, or an error is encountered
+    /// </exception>
+    virtual void PrepUpdate(CommandList& command_list) = 0;
+
+    /// <summary>
+    /// Tags the work added by PrepUpdate with the fence value signaled after the command list.  Call after executing
+    /// the command list
+    /// </summary>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void Submit() = 0;
+
+    /// <summary>
+    /// Makes the levels the GPU has finished uploading resident, and frees the memory of evicted levels the GPU is done
+    /// with.  Does not block
+    /// </summary>
+    /// <returns>
+    /// number of levels that became resident
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual UINT Poll() = 0;
+
+  protected:
+    TextureStreamer();
+
+  private:
+    // disabled
+    TextureStreamer(const TextureStreamer& cpy);
+    TextureStreamer& operator=(const TextureStreamer& cpy);
+};
+
+#endif /* TEXTURE_STREAMER_H */
@@ -9,6 +9,8 @@
 #include "Graphics/Textures/Texture2DArray.h"
 #include "Graphics/Textures/TextureCube.h"
 #include "Graphics/Textures/TextureCubeArray.h"
+#include "Graphics/Textures/MipGenerator.h"
+#include "Graphics/Textures/TexelCopy.h"
 
 class TextureUploadBuffer
 {
@@ -159,15 +161,20 @@ class TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -182,15 +189,20 @@ class TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -205,15 +217,20 @@ class TextureUploadBuffer
     /// texture to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -231,15 +248,20 @@ class TextureUploadBuffer
     /// index of the texture in the array to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -257,15 +279,20 @@ class TextureUploadBuffer
     /// index of the texture in the array to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -283,15 +310,20 @@ class TextureUploadBuffer
     /// index of which side of the cube to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
 
     /// <summary>
     /// Preps the command list for uploading the specified data to the specified texture.  The command list must execute followed by a fence for the transfer to be completed.
@@ -312,15 +344,284 @@ class TextureUploadBuffer
     /// index of which side of the cube to upload to
     /// </param>
     /// <param name="data">
-    /// bytes to write to the texture
+    /// bytes to write to the texture, with no padding between rows.  Block compressed formats are rows of 4x4 blocks
     /// </param>
     /// <param name="mip_level">
     /// mipmap level to upload to
     /// </param>
+    /// <param name="conversion">
+    /// conversion applied to the texels of data as they are copied, for data that is not already in the texture's
+    /// format.  Rows of data are then sized for the unconverted texels, such as 3 bytes each for TEXEL_CONVERSION_RGB8_TO_RGBA8.
+    /// The conversion must write texels of the texture's format, see TexelCopy::IsConversionSupported
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, UINT16 mip_level = 0, TexelConversion conversion = TEXEL_CONVERSION_NONE) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of the texture in the array to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of the texture in the array to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="index">
+    /// index of which side of the cube to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Preps the command list for uploading the specified data to the top mipmap level of the specified texture, and
+    /// every other mipmap level of it generated from the data by MipGenerator.  The levels are generated straight into the
+    /// upload buffer.  The command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to
+    /// </param>
+    /// <param name="cube_index">
+    /// index of which cube to upload to
+    /// </param>
+    /// <param name="side_index">
+    /// index of which side of the cube to upload to
+    /// </param>
+    /// <param name="data">
+    /// bytes to write to the top mipmap level.  Block compressed textures take R8B8G8A8 texels, and each level is
+    /// compressed by BlockCompressor at BC_QUALITY_NORMAL
+    /// </param>
+    /// <param name="filter">
+    /// filter to shrink each mipmap level with
+    /// </param>
+    /// <param name="edge_mode">
+    /// how the filter reads texels beyond the edges of each mipmap level
+    /// </param>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered, including when MipGenerator does not support the texture's format
+    /// </exception>
+    virtual void PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, MipFilter filter = MIP_FILTER_BOX, MipEdgeMode edge_mode = MIP_EDGE_CLAMP) = 0;
+
+    /// <summary>
+    /// Maps the part of the upload buffer that holds the specified mipmap level of the specified texture, so it can be
+    /// written in place, such as by PngDecoder.  May be called from several threads at once, for different upload
+    /// buffers.  PrepUploadMapped must be called once the texels are written.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="texture">
+    /// texture that will be uploaded to
+    /// </param>
+    /// <param name="row_pitch">
+    /// output parameter for the number of bytes between the start of consecutive rows
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level that will be uploaded to
+    /// </param>
+    /// <returns>
+    /// first row of the mipmap level
+    /// </returns>
+    /// <exception cref="FrameworkException">
+    /// Thrown when an error is encountered
+    /// </exception>
+    virtual void* Map(GraphicsCore& graphics, Texture2D& texture, UINT& row_pitch, UINT16 mip_level = 0) = 0;
+
+    /// <summary>
+    /// Unmaps the memory returned by Map, and preps the command list for uploading it to the specified texture.  The
+    /// command list must execute followed by a fence for the transfer to be completed.
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list to use for uploading
+    /// </param>
+    /// <param name="texture">
+    /// texture to upload to, which was passed to Map
+    /// </param>
+    /// <param name="mip_level">
+    /// mipmap level to upload to, which was passed to Map
+    /// </param>
     /// <exception cref="FrameworkException">
     /// Thrown when an error is encountered
     /// </exception>
-    virtual void PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const std::vector<UINT8>& data, UINT16 mip_level = 0) = 0;
+    virtual void PrepUploadMapped(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, UINT16 mip_level = 0) = 0;
 
   protected:
     TextureUploadBuffer();
@@ -0,0 +1,41 @@
+#ifndef VERTEX_TRAITS_H
+#define VERTEX_TRAITS_H
+
+#include <windows.h>
+#include "Graphics/Semantics.h"
+#include "Graphics/GraphicsDataFormat.h"
+
+/// <summary>
+/// One element of a vertex structure
+/// </summary>
+struct VertexElementDesc
+{
+  /// <summary>
+  /// semantic the shader input is bound with
+  /// </summary>
+  Semantics semantic;
+
+  /// <summary>
+  /// semantic index the shader input is bound with
+  /// </summary>
+  UINT index;
+
+  /// <summary>
+  /// format of the element
+  /// </summary>
+  GraphicsDataFormat format;
+};
+
+/// <summary>
+/// Describes the elements of a vertex structure so the input layout for it can be generated.  Vertex structures provide
+/// a specialization with
+///
+///   enum { num_elements = N };
+///   static const VertexElementDesc* GetElements();
+///
+/// where the elements are listed in the order they are laid out in the structure, without padding between them
+/// </summary>
+template <class TVertex>
+struct VertexTraits;
+
+#endif /* VERTEX_TRAITS_H */
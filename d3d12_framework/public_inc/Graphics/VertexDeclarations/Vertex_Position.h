@@ -2,6 +2,7 @@
 #define VERTEX_POSITION_H
 
 #include <directxmath.h>
+#include "Graphics/VertexDeclarations/VertexTraits.h"
 
 /// <summary>
 /// For vertices that are comprised of just a position
@@ -11,4 +12,22 @@ struct Vertex_Position
   DirectX::XMFLOAT3 pos;
 };
 
+/// <summary>
+/// Elements of Vertex_Position, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_Position>
+{
+  enum { num_elements = 1 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 #endif /* VERTEX_POSITION_H */
@@ -2,6 +2,7 @@
 #define VERTEX_POSITION_COLOR_H
 
 #include <directxmath.h>
+#include "Graphics/VertexDeclarations/VertexTraits.h"
 
 /// <summary>
 /// For vertices that are comprised of just a position and rgba color
@@ -12,4 +13,23 @@ struct Vertex_PositionColor
   DirectX::XMFLOAT4 color;
 };
 
+/// <summary>
+/// Elements of Vertex_PositionColor, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionColor>
+{
+  enum { num_elements = 2 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT },
+      { SEM_COLOR,    0, R32G32B32A32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 #endif /* VERTEX_POSITION_COLOR_H */
@@ -2,6 +2,7 @@
 #define VERTEX_POSITION_TEXTURE_H
 
 #include <directxmath.h>
+#include "Graphics/VertexDeclarations/VertexTraits.h"
 
 /// <summary>
 /// For vertices that are comprised of just a position and u coordinates
@@ -12,6 +13,25 @@ struct Vertex_PositionTextureU
   float             u;
 };
 
+/// <summary>
+/// Elements of Vertex_PositionTextureU, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureU>
+{
+  enum { num_elements = 2 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT },
+      { SEM_TEXCOORD, 0, R32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 /// <summary>
 /// For vertices that are comprised of just a position and uv coordinates
 /// </summary>
@@ -21,6 +41,25 @@ struct Vertex_PositionTextureUV
   DirectX::XMFLOAT2 uv;
 };
 
+/// <summary>
+/// Elements of Vertex_PositionTextureUV, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUV>
+{
+  enum { num_elements = 2 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT },
+      { SEM_TEXCOORD, 0, R32G32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 /// <summary>
 /// For vertices that are comprised of just a position, uv coordinates, and a 3d normal vector
 /// </summary>
@@ -31,6 +70,26 @@ struct Vertex_PositionTextureUVNormal
   DirectX::XMFLOAT3 normal;
 };
 
+/// <summary>
+/// Elements of Vertex_PositionTextureUVNormal, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUVNormal>
+{
+  enum { num_elements = 3 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT },
+      { SEM_TEXCOORD, 0, R32G32_FLOAT },
+      { SEM_NORMAL,   0, R32G32B32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 /// <summary>
 /// For vertices that are comprised of just a position and uvw coordinates
 /// </summary>
@@ -40,4 +99,23 @@ struct Vertex_PositionTextureUVW
   DirectX::XMFLOAT3 uvw;
 };
 
+/// <summary>
+/// Elements of Vertex_PositionTextureUVW, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUVW>
+{
+  enum { num_elements = 2 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R32G32B32_FLOAT },
+      { SEM_TEXCOORD, 0, R32G32B32_FLOAT }
+    };
+    return elements;
+  }
+};
+
 #endif /* VERTEX_POSITION_TEXTURE_H */
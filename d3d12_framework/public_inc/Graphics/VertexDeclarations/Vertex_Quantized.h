@@ -0,0 +1,142 @@
+#ifndef VERTEX_QUANTIZED_H
+#define VERTEX_QUANTIZED_H
+
+#include <windows.h>
+#include "Graphics/VertexDeclarations/VertexTraits.h"
+
+/*
+ * Quantized versions of the framework's vertex declarations, filled in by VertexQuantizer.  Shaders decode the
+ * elements as follows:
+ *
+ *   position: pos.xyz * extents + center, where center and extents come from the QuantizationBounds the vertices
+ *             were encoded with.  w is always 1
+ *   uv:       read directly, the input assembler expands the half floats
+ *   normal:   octahedral coordinates n.xy in [-1, 1] (for the 10:10:10:2 format, n.xy * 2 - 1).  Decode with
+ *               float3 v = float3(n.x, n.y, 1 - abs(n.x) - abs(n.y));
+ *               float  t = saturate(-v.z);
+ *               v.xy += v.xy >= 0 ? -t : t;
+ *               normal = normalize(v);
+ */
+
+/// <summary>
+/// For vertices that are comprised of just a position, stored as 16bit normalized integers relative to a bounding box
+/// </summary>
+struct Vertex_PositionQ
+{
+  INT16 pos[4];
+};
+
+/// <summary>
+/// Elements of Vertex_PositionQ, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionQ>
+{
+  enum { num_elements = 1 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R16G16B16A16_SNORM }
+    };
+    return elements;
+  }
+};
+
+/// <summary>
+/// For vertices that are comprised of just a quantized position and half float uv coordinates
+/// </summary>
+struct Vertex_PositionTextureUVQ
+{
+  INT16  pos[4];
+  UINT16 uv[2];
+};
+
+/// <summary>
+/// Elements of Vertex_PositionTextureUVQ, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUVQ>
+{
+  enum { num_elements = 2 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R16G16B16A16_SNORM },
+      { SEM_TEXCOORD, 0, R16G16_FLOAT }
+    };
+    return elements;
+  }
+};
+
+/// <summary>
+/// For vertices that are comprised of just a quantized position, half float uv coordinates, and an octahedral encoded
+/// normal stored as 8bit normalized integers
+/// </summary>
+struct Vertex_PositionTextureUVNormalQ8
+{
+  INT16  pos[4];
+  UINT16 uv[2];
+  INT8   normal[2];
+
+  /// <summary>
+  /// keeps the vertex size a multiple of 4 bytes
+  /// </summary>
+  INT8   padding[2];
+};
+
+/// <summary>
+/// Elements of Vertex_PositionTextureUVNormalQ8, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUVNormalQ8>
+{
+  enum { num_elements = 3 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R16G16B16A16_SNORM },
+      { SEM_TEXCOORD, 0, R16G16_FLOAT },
+      { SEM_NORMAL,   0, R8G8_SNORM }
+    };
+    return elements;
+  }
+};
+
+/// <summary>
+/// For vertices that are comprised of just a quantized position, half float uv coordinates, and an octahedral encoded
+/// normal stored in the x and y channels of a 10:10:10:2 normalized integer
+/// </summary>
+struct Vertex_PositionTextureUVNormalQ10
+{
+  INT16  pos[4];
+  UINT16 uv[2];
+  UINT   normal;
+};
+
+/// <summary>
+/// Elements of Vertex_PositionTextureUVNormalQ10, used to generate its input layout
+/// </summary>
+template <>
+struct VertexTraits<Vertex_PositionTextureUVNormalQ10>
+{
+  enum { num_elements = 3 };
+
+  static const VertexElementDesc* GetElements()
+  {
+    static const VertexElementDesc elements[num_elements] =
+    {
+      { SEM_POSITION, 0, R16G16B16A16_SNORM },
+      { SEM_TEXCOORD, 0, R16G16_FLOAT },
+      { SEM_NORMAL,   0, R10G10B10A2_UNORM }
+    };
+    return elements;
+  }
+};
+
+#endif /* VERTEX_QUANTIZED_H */
@@ -0,0 +1,114 @@
+#include <string.h>
+#include "private_inc/D3D12/Buffers/D3D12_DynamicVertexBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_VertexBuffer.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Alignment of each version of the buffer in the ring
+/// </summary>
+static const UINT VERSION_ALIGNMENT = 256;
+
+D3D12_DynamicVertexBuffer* D3D12_DynamicVertexBuffer::Create(GraphicsCore& graphics, UINT num_frames, UINT num, UINT stride, const void* data)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num_frames == 0)
+  {
+    throw FrameworkException("Dynamic vertex buffer must have at least 1 frame");
+  }
+  if (num == 0 || stride == 0)
+  {
+    throw FrameworkException("Dynamic vertex buffer must have at least 1 non-empty entry");
+  }
+  if (num * (UINT64)stride > UINT_MAX - VERSION_ALIGNMENT)
+  {
+    throw FrameworkException("Requested size of the dynamic vertex buffer is larger than the max number of bytes available in a vertex buffer view");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  UINT size         = num * stride;
+  UINT version_size = (size + VERSION_ALIGNMENT - 1) & ~(VERSION_ALIGNMENT - 1);
+
+  ID3D12Resource*  buffer;
+  VertexBufferView view;
+  UINT8*           mapped;
+  D3D12_VertexBuffer::CreateBufferMapped(graphics, version_size, num_frames, buffer, view, mapped);
+
+  view.size_in_bytes   = size;
+  view.stride_in_bytes = stride;
+  return new D3D12_DynamicVertexBuffer((D3D12_Core&)graphics, num_frames, version_size, buffer, view, mapped, data);
+}
+
+D3D12_DynamicVertexBuffer::D3D12_DynamicVertexBuffer(D3D12_Core& core, UINT num_frames, UINT version_size, ID3D12Resource* buffer,
+  const VertexBufferView& view, UINT8* mapped, const void* data)
+:m_core(core),
+ m_version_size(version_size),
+ m_versions(num_frames),
+ m_buffer(buffer),
+ m_mapped(mapped),
+ m_base_location(view.buffer_location)
+{
+  m_view = view;
+
+  m_shadow.resize(view.size_in_bytes, 0);
+  if (data != NULL)
+  {
+    memcpy(&m_shadow[0], data, view.size_in_bytes);
+  }
+  for (UINT i = 0; i < num_frames; i++)
+  {
+    memcpy(m_mapped + i * (size_t)m_version_size, &m_shadow[0], view.size_in_bytes);
+  }
+}
+
+D3D12_DynamicVertexBuffer::~D3D12_DynamicVertexBuffer()
+{
+  m_buffer->Unmap(0, NULL);
+  m_buffer->Release();
+}
+
+void D3D12_DynamicVertexBuffer::NextFrame()
+{
+  // the fence is signaled here rather than when the frame's command lists are executed, which covers everything the
+  // previous frame submitted as long as this is called after that and before the next frame's command lists are
+  // executed.  When the CPU is a whole ring ahead of the GPU, it waits for the GPU to catch up
+  UINT64 fence_value = m_core.SignalFence();
+  while (!m_versions.Advance(fence_value, m_core.GetCompletedFenceValue()))
+  {
+    m_core.WaitOnFence();
+  }
+
+  UINT current = m_versions.GetCurrent();
+  m_view.buffer_location = m_base_location + current * (UINT64)m_version_size;
+
+  DynamicBufferRing::Range stale = m_versions.TakeStale();
+  if (stale.start < stale.end)
+  {
+    memcpy(m_mapped + current * (size_t)m_version_size + stale.start, &m_shadow[stale.start], stale.end - stale.start);
+  }
+}
+
+void D3D12_DynamicVertexBuffer::Upload(UINT buffer_start_index, const void* data, UINT num_bytes)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if ((UINT64)buffer_start_index + num_bytes > m_shadow.size())
+  {
+    throw FrameworkException("Attempting to upload beyond the end of the dynamic vertex buffer");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  if (num_bytes == 0)
+  {
+    return;
+  }
+
+  memcpy(&m_shadow[buffer_start_index], data, num_bytes);
+  memcpy(m_mapped + m_versions.GetCurrent() * (size_t)m_version_size + buffer_start_index, data, num_bytes);
+  m_versions.MarkWritten(buffer_start_index, buffer_start_index + num_bytes);
+}
+
+UINT D3D12_DynamicVertexBuffer::GetNumFrames() const
+{
+  return m_versions.GetNumVersions();
+}
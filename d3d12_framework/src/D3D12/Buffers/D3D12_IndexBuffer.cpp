@@ -5,7 +5,7 @@
 #include "FrameworkException.h"
 using namespace std;
 
-void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, D3D12_INDEX_BUFFER_VIEW& view)
+void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, IndexBufferView& view)
 {
   D3D12_Core& core = (D3D12_Core&)graphics;
 
@@ -31,12 +31,12 @@ void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT
     throw FrameworkException(out.str());
   }
 
-  view.BufferLocation = buffer->GetGPUVirtualAddress();
-  view.SizeInBytes = num * stride;
-  view.Format = format;
+  view.buffer_location = buffer->GetGPUVirtualAddress();
+  view.size_in_bytes   = num * stride;
+  view.format          = (GraphicsDataFormat)format;
 }
 
-void D3D12_IndexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, const void* data, ID3D12Resource*& buffer, D3D12_INDEX_BUFFER_VIEW& view)
+void D3D12_IndexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, const void* data, ID3D12Resource*& buffer, IndexBufferView& view)
 {
   D3D12_HEAP_PROPERTIES heap_prop;
   heap_prop.Type                 = D3D12_HEAP_TYPE_UPLOAD;
@@ -61,7 +61,7 @@ void D3D12_IndexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, DXGI_F
   buffer->Unmap(0, NULL);
 }
 
-void D3D12_IndexBuffer::CreateBufferGPU(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, D3D12_INDEX_BUFFER_VIEW& view)
+void D3D12_IndexBuffer::CreateBufferGPU(GraphicsCore& graphics, UINT stride, DXGI_FORMAT format, UINT num, ID3D12Resource*& buffer, IndexBufferView& view)
 {
   D3D12_HEAP_PROPERTIES heap_prop;
   heap_prop.Type                 = D3D12_HEAP_TYPE_DEFAULT;
@@ -0,0 +1,27 @@
+#include "private_inc/D3D12/Buffers/D3D12_IndexBuffer32.h"
+#include "private_inc/D3D12/Buffers/D3D12_IndexBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_IndexBufferGPU32.h"
+
+D3D12_IndexBuffer32* D3D12_IndexBuffer32::Create(GraphicsCore& graphics, UINT num, const UINT* data)
+{
+  ID3D12Resource* buffer;
+  IndexBufferView view;
+  D3D12_IndexBuffer::CreateBuffer(graphics, sizeof(UINT), DXGI_FORMAT_R32_UINT, num, data, buffer, view);
+  return new D3D12_IndexBuffer32(buffer, view);
+}
+
+D3D12_IndexBuffer32::D3D12_IndexBuffer32(ID3D12Resource* buffer, const IndexBufferView& view)
+:m_buffer(buffer)
+{
+  m_view = view;
+}
+
+D3D12_IndexBuffer32::~D3D12_IndexBuffer32()
+{
+  m_buffer->Release();
+}
+
+void D3D12_IndexBuffer32::PrepUpload(GraphicsCore& graphics, CommandList& command_list, const IndexBufferGPU32& buffer)
+{
+  D3D12_IndexBuffer::PrepUpload(graphics, command_list, m_buffer, ((const D3D12_IndexBufferGPU32&)buffer).GetResource());
+}
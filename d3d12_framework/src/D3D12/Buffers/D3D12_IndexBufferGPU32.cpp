@@ -0,0 +1,26 @@
+#include "private_inc/D3D12/Buffers/D3D12_IndexBufferGPU32.h"
+#include "private_inc/D3D12/Buffers/D3D12_IndexBuffer.h"
+
+D3D12_IndexBufferGPU32* D3D12_IndexBufferGPU32::Create(GraphicsCore& graphics, UINT num)
+{
+  ID3D12Resource* buffer;
+  IndexBufferView view;
+  D3D12_IndexBuffer::CreateBufferGPU(graphics, sizeof(UINT), DXGI_FORMAT_R32_UINT, num, buffer, view);
+  return new D3D12_IndexBufferGPU32(buffer, view);
+}
+
+D3D12_IndexBufferGPU32::D3D12_IndexBufferGPU32(ID3D12Resource* buffer, const IndexBufferView& view)
+:m_buffer(buffer)
+{
+  m_view = view;
+}
+
+D3D12_IndexBufferGPU32::~D3D12_IndexBufferGPU32()
+{
+  m_buffer->Release();
+}
+
+ID3D12Resource* D3D12_IndexBufferGPU32::GetResource() const
+{
+  return m_buffer;
+}
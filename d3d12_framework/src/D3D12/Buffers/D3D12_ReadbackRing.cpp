@@ -0,0 +1,235 @@
+#include <sstream>
+#include "private_inc/D3D12/Buffers/D3D12_ReadbackRing.h"
+#include "private_inc/D3D12/Buffers/D3D12_StreamOutputBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBufferGPU.h"
+#include "private_inc/D3D12/D3D12_CommandList.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Alignment of each slot in the readback buffer, so the stream output filled sizes can be read as UINT64s
+/// </summary>
+static const UINT SLOT_ALIGNMENT = sizeof(UINT64);
+
+D3D12_ReadbackRing* D3D12_ReadbackRing::Create(GraphicsCore& graphics, UINT num_slots, UINT slot_size)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num_slots == 0 || slot_size == 0)
+  {
+    ostringstream out;
+    out << "Readback ring must have at least 1 slot of at least 1 byte (" << num_slots << " slots of " << slot_size << " bytes requested)";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  slot_size = (slot_size + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT * SLOT_ALIGNMENT;
+  if ((UINT64)slot_size * num_slots > 0xFFFFFFFF)
+  {
+    ostringstream out;
+    out << "Readback ring of " << num_slots << " slots of " << slot_size << " bytes is larger than 4GB";
+    throw FrameworkException(out.str());
+  }
+
+  D3D12_ReadbackBuffer* buffer = D3D12_ReadbackBuffer::Create(graphics, slot_size * num_slots);
+  return new D3D12_ReadbackRing((D3D12_Core&)graphics, buffer, num_slots, slot_size);
+}
+
+D3D12_ReadbackRing::D3D12_ReadbackRing(D3D12_Core& core, D3D12_ReadbackBuffer* buffer, UINT num_slots, UINT slot_size)
+:m_core(core),
+ m_buffer(buffer),
+ m_slots(num_slots),
+ m_slot_size(slot_size),
+ m_callbacks(num_slots),
+ m_num_bytes(num_slots, 0)
+{
+}
+
+D3D12_ReadbackRing::~D3D12_ReadbackRing()
+{
+  delete m_buffer;
+}
+
+bool D3D12_ReadbackRing::PrepReadback(CommandList& command_list, const StructuredBufferGPU& src, UINT src_offset, UINT num_bytes,
+  const Callback& callback)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  UINT64 src_size = (UINT64)src.GetNumElements() * src.GetStride();
+  if ((UINT64)src_offset + num_bytes > src_size)
+  {
+    ostringstream out;
+    out << "Readback of bytes " << src_offset << " to " << (UINT64)src_offset + num_bytes << " is outside of the " << src_size << " byte structured buffer";
+    throw FrameworkException(out.str());
+  }
+  if (num_bytes > m_slot_size)
+  {
+    ostringstream out;
+    out << "Readback of " << num_bytes << " bytes does not fit in a " << m_slot_size << " byte slot";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  UINT slot = m_slots.Acquire();
+  if (slot == FenceSlotRing::NO_SLOT)
+  {
+    return false;
+  }
+
+  ID3D12GraphicsCommandList* cmd_list = ((D3D12_CommandList&)command_list).GetCommandList();
+  cmd_list->CopyBufferRegion(m_buffer->GetResource(), (UINT64)slot * m_slot_size, ((const D3D12_StructuredBufferGPU&)src).GetResource(), src_offset,
+    num_bytes);
+
+  m_callbacks[slot] = callback;
+  m_num_bytes[slot] = num_bytes;
+  return true;
+}
+
+bool D3D12_ReadbackRing::PrepNumVerticesWritten(CommandList& command_list, const vector<StreamOutputBuffer*>& so_buffers,
+  const NumVerticesCallback& callback)
+{
+  UINT num_bytes = (UINT)(sizeof(UINT64) * so_buffers.size());
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num_bytes > m_slot_size)
+  {
+    ostringstream out;
+    out << "Filled sizes of " << so_buffers.size() << " stream output buffers do not fit in a " << m_slot_size << " byte slot";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  UINT slot = m_slots.Acquire();
+  if (slot == FenceSlotRing::NO_SLOT)
+  {
+    return false;
+  }
+
+  ID3D12GraphicsCommandList*     cmd_list = ((D3D12_CommandList&)command_list).GetCommandList();
+  ID3D12Resource*                resource = m_buffer->GetResource();
+  vector<UINT>                   strides;
+  vector<D3D12_RESOURCE_BARRIER> barriers(so_buffers.size());
+  strides.reserve(so_buffers.size());
+  for (size_t i = 0; i < so_buffers.size(); i++)
+  {
+    D3D12_StreamOutputBuffer* curr_so_buffer = (D3D12_StreamOutputBuffer*)so_buffers[i];
+    barriers[i].Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barriers[i].Flags                  = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barriers[i].Transition.pResource   = curr_so_buffer->GetResource();
+    barriers[i].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    barriers[i].Transition.StateBefore = D3D12_RESOURCE_STATE_STREAM_OUT;
+    barriers[i].Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_SOURCE;
+    strides.push_back(curr_so_buffer->GetVertexBufferView().StrideInBytes);
+  }
+
+  // the filled sizes are written by the stream output stage, so the buffers have to leave the stream output state for
+  // the copy to see them.  All of the buffers move in one barrier each way
+  if (!barriers.empty())
+  {
+    cmd_list->ResourceBarrier((UINT)barriers.size(), &barriers[0]);
+  }
+
+  UINT64 dst_offset = (UINT64)slot * m_slot_size;
+  for (size_t i = 0; i < barriers.size(); i++)
+  {
+    cmd_list->CopyBufferRegion(resource, dst_offset, barriers[i].Transition.pResource, 0, sizeof(UINT64));
+    dst_offset += sizeof(UINT64);
+
+    barriers[i].Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_SOURCE;
+    barriers[i].Transition.StateAfter  = D3D12_RESOURCE_STATE_STREAM_OUT;
+  }
+
+  if (!barriers.empty())
+  {
+    cmd_list->ResourceBarrier((UINT)barriers.size(), &barriers[0]);
+  }
+
+  m_callbacks[slot] = [strides, callback](const void* data, UINT num_bytes)
+  {
+    const UINT64* filled_size = (const UINT64*)data;
+    vector<UINT> num_vertices;
+    num_vertices.reserve(strides.size());
+    for (size_t i = 0; i < strides.size(); i++)
+    {
+      num_vertices.push_back((UINT)(filled_size[i] / strides[i]));
+    }
+    callback(num_vertices);
+  };
+  m_num_bytes[slot] = num_bytes;
+  return true;
+}
+
+void D3D12_ReadbackRing::Submit()
+{
+  if (m_slots.GetNumUntagged() > 0)
+  {
+    m_slots.Tag(m_core.SignalFence());
+  }
+}
+
+UINT D3D12_ReadbackRing::Poll()
+{
+  UINT64          completed = m_core.GetCompletedFenceValue();
+  ID3D12Resource* resource  = m_buffer->GetResource();
+  UINT            delivered = 0;
+  for (UINT slot = m_slots.GetRetired(completed); slot != FenceSlotRing::NO_SLOT; slot = m_slots.GetRetired(completed))
+  {
+    // free the slot before calling back, so the callback can prepare another readback and an exception from it
+    // does not deliver the same data twice
+    Callback callback;
+    callback.swap(m_callbacks[slot]);
+    UINT num_bytes = m_num_bytes[slot];
+    m_slots.ReleaseOldest();
+
+    D3D12_RANGE read_range;
+    read_range.Begin = (SIZE_T)slot * m_slot_size;
+    read_range.End   = read_range.Begin + num_bytes;
+    UINT8* data;
+    HRESULT rc = resource->Map(0, &read_range, (void**)&data);
+    if (FAILED(rc))
+    {
+      ostringstream out;
+      out << "Failed to map readback ring slot " << slot << ".  HRESULT = " << rc;
+      throw FrameworkException(out.str());
+    }
+
+    D3D12_RANGE write_range;
+    write_range.Begin = 0;
+    write_range.End   = 0;
+    try
+    {
+      callback(data + read_range.Begin, num_bytes);
+    }
+    catch (...)
+    {
+      resource->Unmap(0, &write_range);
+      throw;
+    }
+    resource->Unmap(0, &write_range);
+    delivered++;
+  }
+  return delivered;
+}
+
+UINT D3D12_ReadbackRing::Flush()
+{
+  Submit();
+  if (m_slots.GetNumInUse() > 0)
+  {
+    m_core.WaitOnFence();
+  }
+  return Poll();
+}
+
+UINT D3D12_ReadbackRing::GetNumPending() const
+{
+  return m_slots.GetNumInUse();
+}
+
+UINT D3D12_ReadbackRing::GetNumSlots() const
+{
+  return (UINT)m_callbacks.size();
+}
+
+UINT D3D12_ReadbackRing::GetSlotSize() const
+{
+  return m_slot_size;
+}
@@ -0,0 +1,142 @@
+#include <sstream>
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBufferGPU.h"
+#include "private_inc/D3D12/D3D12_Core.h"
+#include "private_inc/D3D12/D3D12_CommandList.h"
+#include "private_inc/StructuredBufferLayout.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+D3D12_StructuredBuffer* D3D12_StructuredBuffer::Create(GraphicsCore& graphics, UINT num, UINT stride, const void* data)
+{
+  ID3D12Resource* buffer = CreateResource(graphics, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_FLAG_NONE, num, stride);
+
+  void* buffer_data;
+  HRESULT rc = buffer->Map(0, NULL, &buffer_data);
+  if (FAILED(rc))
+  {
+    buffer->Release();
+
+    ostringstream out;
+    out << "Failed to map buffer for structured buffer.  HRESULT = " << rc;
+    throw FrameworkException(out.str());
+  }
+  if (data != NULL)
+  {
+    memcpy(buffer_data, data, (size_t)StructuredBufferLayout::GetSize(num, stride));
+  }
+
+  return new D3D12_StructuredBuffer(num, stride, buffer, (UINT8*)buffer_data);
+}
+
+ID3D12Resource* D3D12_StructuredBuffer::CreateResource(GraphicsCore& graphics, D3D12_HEAP_TYPE heap_type, D3D12_RESOURCE_FLAGS flags, UINT num, UINT stride)
+{
+  const UINT64 size = StructuredBufferLayout::GetSize(num, stride);
+  D3D12_Core& core = (D3D12_Core&)graphics;
+
+  D3D12_HEAP_PROPERTIES heap_prop;
+  heap_prop.Type                 = heap_type;
+  heap_prop.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+  heap_prop.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+  heap_prop.CreationNodeMask     = 0;
+  heap_prop.VisibleNodeMask      = 0;
+
+  D3D12_RESOURCE_DESC res_desc;
+  res_desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
+  res_desc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+  res_desc.Width              = size;
+  res_desc.Height             = 1;
+  res_desc.DepthOrArraySize   = 1;
+  res_desc.MipLevels          = 1;
+  res_desc.Format             = DXGI_FORMAT_UNKNOWN;
+  res_desc.SampleDesc.Count   = 1;
+  res_desc.SampleDesc.Quality = 0;
+  res_desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+  res_desc.Flags              = flags;
+
+  ID3D12Resource* buffer;
+  HRESULT rc = core.GetDevice()->CreateCommittedResource(&heap_prop, D3D12_HEAP_FLAG_NONE, &res_desc, D3D12_RESOURCE_STATE_GENERIC_READ, NULL,
+    __uuidof(ID3D12Resource), (void**)&buffer);
+  if (FAILED(rc))
+  {
+    ostringstream out;
+    out << "Failed to create committed resource for structured buffer.  HRESULT = " << rc;
+    throw FrameworkException(out.str());
+  }
+
+  return buffer;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12_StructuredBuffer::GetElementAddr(D3D12_GPU_VIRTUAL_ADDRESS base, UINT num, UINT stride, UINT element_offset)
+{
+  return base + StructuredBufferLayout::GetElementOffset(num, stride, element_offset);
+}
+
+D3D12_StructuredBuffer::D3D12_StructuredBuffer(UINT num, UINT stride, ID3D12Resource* buffer, UINT8* data)
+:m_num(num),
+ m_stride(stride),
+ m_buffer(buffer),
+ m_data(data)
+{
+}
+
+D3D12_StructuredBuffer::~D3D12_StructuredBuffer()
+{
+  m_buffer->Unmap(0, NULL);
+  m_buffer->Release();
+}
+
+UINT D3D12_StructuredBuffer::GetNumElements() const
+{
+  return m_num;
+}
+
+UINT D3D12_StructuredBuffer::GetStride() const
+{
+  return m_stride;
+}
+
+void D3D12_StructuredBuffer::Upload(UINT start_element, UINT num_elements, const void* data)
+{
+  const UINT64 offset = StructuredBufferLayout::GetUploadOffset(m_num, m_stride, start_element, num_elements);
+  memcpy(m_data + (size_t)offset, data, num_elements * (size_t)m_stride);
+}
+
+void D3D12_StructuredBuffer::PrepUpload(CommandList& command_list, const StructuredBufferGPU& buffer)
+{
+  const D3D12_StructuredBufferGPU& dst = (const D3D12_StructuredBufferGPU&)buffer;
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (dst.GetNumElements() * (UINT64)dst.GetStride() != m_num * (UINT64)m_stride)
+  {
+    throw FrameworkException("Structured buffers must be the same size to upload from one to the other");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  ID3D12GraphicsCommandList* cmd_list = ((D3D12_CommandList&)command_list).GetCommandList();
+
+  D3D12_RESOURCE_BARRIER prep_copy;
+  prep_copy.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  prep_copy.Flags                  = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  prep_copy.Transition.pResource   = dst.GetResource();
+  prep_copy.Transition.Subresource = 0;
+  prep_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_GENERIC_READ;
+  prep_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
+  cmd_list->ResourceBarrier(1, &prep_copy);
+
+  cmd_list->CopyResource(dst.GetResource(), m_buffer);
+
+  D3D12_RESOURCE_BARRIER done_copy;
+  done_copy.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  done_copy.Flags                  = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  done_copy.Transition.pResource   = dst.GetResource();
+  done_copy.Transition.Subresource = 0;
+  done_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
+  done_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_GENERIC_READ;
+  cmd_list->ResourceBarrier(1, &done_copy);
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12_StructuredBuffer::GetGPUAddr(UINT element_offset) const
+{
+  return GetElementAddr(m_buffer->GetGPUVirtualAddress(), m_num, m_stride, element_offset);
+}
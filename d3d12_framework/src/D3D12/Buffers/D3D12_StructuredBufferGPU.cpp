@@ -0,0 +1,42 @@
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBufferGPU.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBuffer.h"
+using namespace std;
+
+D3D12_StructuredBufferGPU* D3D12_StructuredBufferGPU::Create(GraphicsCore& graphics, UINT num, UINT stride)
+{
+  ID3D12Resource* buffer = D3D12_StructuredBuffer::CreateResource(graphics, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS, num,
+    stride);
+  return new D3D12_StructuredBufferGPU(num, stride, buffer);
+}
+
+D3D12_StructuredBufferGPU::D3D12_StructuredBufferGPU(UINT num, UINT stride, ID3D12Resource* buffer)
+:m_num(num),
+ m_stride(stride),
+ m_buffer(buffer)
+{
+}
+
+D3D12_StructuredBufferGPU::~D3D12_StructuredBufferGPU()
+{
+  m_buffer->Release();
+}
+
+UINT D3D12_StructuredBufferGPU::GetNumElements() const
+{
+  return m_num;
+}
+
+UINT D3D12_StructuredBufferGPU::GetStride() const
+{
+  return m_stride;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12_StructuredBufferGPU::GetGPUAddr(UINT element_offset) const
+{
+  return D3D12_StructuredBuffer::GetElementAddr(m_buffer->GetGPUVirtualAddress(), m_num, m_stride, element_offset);
+}
+
+ID3D12Resource* D3D12_StructuredBufferGPU::GetResource() const
+{
+  return m_buffer;
+}
@@ -6,7 +6,7 @@
 #include "FrameworkException.h"
 using namespace std;
 
-void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT stride, UINT num, ID3D12Resource*& buffer, D3D12_VERTEX_BUFFER_VIEW& view)
+void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT stride, UINT num, ID3D12Resource*& buffer, VertexBufferView& view)
 {
   D3D12_Core& core = (D3D12_Core&)graphics;
 
@@ -40,12 +40,12 @@ void CreateBuffer(GraphicsCore& graphics, D3D12_HEAP_PROPERTIES heap_prop, UINT
     throw FrameworkException(out.str());
   }
 
-  view.BufferLocation = buffer->GetGPUVirtualAddress();
-  view.SizeInBytes = (UINT)num_bytes;
-  view.StrideInBytes = stride;
+  view.buffer_location = buffer->GetGPUVirtualAddress();
+  view.size_in_bytes   = (UINT)num_bytes;
+  view.stride_in_bytes = stride;
 }
 
-void D3D12_VertexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, UINT num, const void* data, ID3D12Resource*& buffer, D3D12_VERTEX_BUFFER_VIEW& view)
+void D3D12_VertexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, UINT num, const void* data, ID3D12Resource*& buffer, VertexBufferView& view)
 {
   D3D12_HEAP_PROPERTIES heap_prop;
   heap_prop.Type                 = D3D12_HEAP_TYPE_UPLOAD;
@@ -70,7 +70,31 @@ void D3D12_VertexBuffer::CreateBuffer(GraphicsCore& graphics, UINT stride, UINT
   buffer->Unmap(0, NULL);
 }
 
-void D3D12_VertexBuffer::CreateBufferGPU(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, D3D12_VERTEX_BUFFER_VIEW& view)
+void D3D12_VertexBuffer::CreateBufferMapped(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, VertexBufferView& view, UINT8*& data)
+{
+  D3D12_HEAP_PROPERTIES heap_prop;
+  heap_prop.Type                 = D3D12_HEAP_TYPE_UPLOAD;
+  heap_prop.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+  heap_prop.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+  heap_prop.CreationNodeMask     = 0;
+  heap_prop.VisibleNodeMask      = 0;
+
+  CreateBuffer(graphics, heap_prop, stride, num, buffer, view);
+
+  void* buffer_data;
+  HRESULT rc = buffer->Map(0, NULL, &buffer_data);
+  if (FAILED(rc))
+  {
+    buffer->Release();
+
+    ostringstream out;
+    out << "Failed to map buffer for vertex buffer.  HRESULT = " << rc;
+    throw FrameworkException(out.str());
+  }
+  data = (UINT8*)buffer_data;
+}
+
+void D3D12_VertexBuffer::CreateBufferGPU(GraphicsCore& graphics, UINT stride, UINT num, ID3D12Resource*& buffer, VertexBufferView& view)
 {
   D3D12_HEAP_PROPERTIES heap_prop;
   heap_prop.Type                 = D3D12_HEAP_TYPE_DEFAULT;
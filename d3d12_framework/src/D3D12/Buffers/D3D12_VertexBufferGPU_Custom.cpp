@@ -8,16 +8,15 @@ using namespace std;
 D3D12_VertexBufferGPU_Custom* D3D12_VertexBufferGPU_Custom::Create(GraphicsCore& graphics, UINT num, UINT size)
 {
   ID3D12Resource* buffer;
-  D3D12_VERTEX_BUFFER_VIEW view;
+  VertexBufferView view;
   D3D12_VertexBuffer::CreateBufferGPU(graphics, size, num,  buffer, view);
-  return new D3D12_VertexBufferGPU_Custom(num, buffer, view);
+  return new D3D12_VertexBufferGPU_Custom(buffer, view);
 }
 
-D3D12_VertexBufferGPU_Custom::D3D12_VertexBufferGPU_Custom(UINT num, ID3D12Resource* buffer, const D3D12_VERTEX_BUFFER_VIEW& view)
-:m_num(num),
- m_buffer(buffer),
- m_view(view)
+D3D12_VertexBufferGPU_Custom::D3D12_VertexBufferGPU_Custom(ID3D12Resource* buffer, const VertexBufferView& view)
+:m_buffer(buffer)
 {
+  m_view = view;
 }
 
 D3D12_VertexBufferGPU_Custom::~D3D12_VertexBufferGPU_Custom()
@@ -25,11 +24,6 @@ D3D12_VertexBufferGPU_Custom::~D3D12_VertexBufferGPU_Custom()
   m_buffer->Release();
 }
 
-UINT D3D12_VertexBufferGPU_Custom::GetNumVertices() const
-{
-  return m_num;
-}
-
 ID3D12Resource* D3D12_VertexBufferGPU_Custom::GetResource() const
 {
   return m_buffer;
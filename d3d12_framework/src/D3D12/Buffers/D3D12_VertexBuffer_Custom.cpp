@@ -9,16 +9,15 @@ using namespace std;
 D3D12_VertexBuffer_Custom* D3D12_VertexBuffer_Custom::Create(GraphicsCore& graphics, UINT num, UINT size, const void* data)
 {
   ID3D12Resource* buffer;
-  D3D12_VERTEX_BUFFER_VIEW view;
+  VertexBufferView view;
   D3D12_VertexBuffer::CreateBuffer(graphics, size, num, data, buffer, view);
-  return new D3D12_VertexBuffer_Custom(num, buffer, view);
+  return new D3D12_VertexBuffer_Custom(buffer, view);
 }
 
-D3D12_VertexBuffer_Custom::D3D12_VertexBuffer_Custom(UINT num, ID3D12Resource* buffer, const D3D12_VERTEX_BUFFER_VIEW& view)
-:m_num(num),
- m_buffer(buffer),
- m_view(view)
+D3D12_VertexBuffer_Custom::D3D12_VertexBuffer_Custom(ID3D12Resource* buffer, const VertexBufferView& view)
+:m_buffer(buffer)
 {
+  m_view = view;
 }
 
 D3D12_VertexBuffer_Custom::~D3D12_VertexBuffer_Custom()
@@ -47,11 +46,6 @@ void D3D12_VertexBuffer_Custom::Upload(UINT buffer_start_index, const void* data
   m_buffer->Unmap(0, NULL);
 }
 
-UINT D3D12_VertexBuffer_Custom::GetNumVertices() const
-{
-  return m_num;
-}
-
 void D3D12_VertexBuffer_Custom::PrepUpload(GraphicsCore& graphics, CommandList& command_list, const VertexBufferGPU_Custom& buffer)
 {
   D3D12_VertexBuffer::PrepUpload(graphics, command_list, m_buffer, ((const D3D12_VertexBufferGPU_Custom&)buffer).GetResource());
@@ -1,14 +1,16 @@
 #include <sstream>
+#include <stddef.h>
 #include <d3d12.h>
 #include "private_inc/D3D12/D3D12_Core.h"
 #include "private_inc/D3D12/D3D12_CommandList.h"
 #include "private_inc/D3D12/D3D12_Pipeline.h"
 #include "private_inc/D3D12/D3D12_RootSignature.h"
 #include "private_inc/D3D12/Buffers/D3D12_VertexBufferArray.h"
-#include "private_inc/D3D12/Buffers/D3D12_IndexBuffer16.h"
 #include "private_inc/D3D12/Textures/D3D12_RenderTarget.h"
 #include "private_inc/D3D12/D3D12_HeapArray.h"
 #include "private_inc/D3D12/Buffers/D3D12_ConstantBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBufferGPU.h"
 #include "private_inc/D3D12/Buffers/D3D12_StreamOutputBuffer.h"
 #include "private_inc/D3D12/Buffers/D3D12_StreamOutputBufferArray.h"
 #include "private_inc/D3D12/Textures/D3D12_Texture1D.h"
@@ -26,6 +28,13 @@
 #include "FrameworkException.h"
 using namespace std;
 
+static_assert(sizeof(IndexBufferView) == sizeof(D3D12_INDEX_BUFFER_VIEW), "IndexBufferView must match D3D12_INDEX_BUFFER_VIEW");
+static_assert(offsetof(IndexBufferView, buffer_location) == offsetof(D3D12_INDEX_BUFFER_VIEW, BufferLocation), "IndexBufferView must match D3D12_INDEX_BUFFER_VIEW");
+static_assert(offsetof(IndexBufferView, size_in_bytes) == offsetof(D3D12_INDEX_BUFFER_VIEW, SizeInBytes), "IndexBufferView must match D3D12_INDEX_BUFFER_VIEW");
+static_assert(offsetof(IndexBufferView, format) == offsetof(D3D12_INDEX_BUFFER_VIEW, Format), "IndexBufferView must match D3D12_INDEX_BUFFER_VIEW");
+static_assert(sizeof(DrawIndexedArgs) == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS), "DrawIndexedArgs must match D3D12_DRAW_INDEXED_ARGUMENTS");
+static_assert(offsetof(DrawIndexedArgs, base_vertex) == offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, BaseVertexLocation), "DrawIndexedArgs must match D3D12_DRAW_INDEXED_ARGUMENTS");
+
 D3D12_CommandList* D3D12_CommandList::Create(const GraphicsCore& graphics, Pipeline* pipeline)
 {
   const D3D12_Core&          core           = (const D3D12_Core&)graphics;
@@ -122,6 +131,62 @@ void D3D12_CommandList::SetConstantBuffer(UINT slot, const ConstantBuffer& const
   m_command_list->SetGraphicsRootConstantBufferView(slot, buffer.GetGPUAddr());
 }
 
+void D3D12_CommandList::SetRootConstants(UINT slot, UINT num_32bit_values, const void* data, UINT dest_offset)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num_32bit_values + dest_offset > 64)
+  {
+    throw FrameworkException("root constants extend beyond the 64 DWORD root signature limit");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  m_command_list->SetGraphicsRoot32BitConstants(slot, num_32bit_values, data, dest_offset);
+}
+
+void D3D12_CommandList::SetShaderResourceView(UINT slot, const StructuredBuffer& buffer, UINT element_offset)
+{
+  const D3D12_StructuredBuffer& structured = (const D3D12_StructuredBuffer&)buffer;
+  m_command_list->SetGraphicsRootShaderResourceView(slot, structured.GetGPUAddr(element_offset));
+}
+
+void D3D12_CommandList::SetShaderResourceView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset)
+{
+  const D3D12_StructuredBufferGPU& structured = (const D3D12_StructuredBufferGPU&)buffer;
+  m_command_list->SetGraphicsRootShaderResourceView(slot, structured.GetGPUAddr(element_offset));
+}
+
+void D3D12_CommandList::SetUnorderedAccessView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset)
+{
+  const D3D12_StructuredBufferGPU& structured = (const D3D12_StructuredBufferGPU&)buffer;
+  m_command_list->SetGraphicsRootUnorderedAccessView(slot, structured.GetGPUAddr(element_offset));
+}
+
+void D3D12_CommandList::StructuredBufferToUnorderedAccess(const StructuredBufferGPU& buffer)
+{
+  const D3D12_StructuredBufferGPU& structured = (const D3D12_StructuredBufferGPU&)buffer;
+  D3D12_RESOURCE_BARRIER barrier;
+  barrier.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  barrier.Flags                  = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  barrier.Transition.pResource   = structured.GetResource();
+  barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+  barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_GENERIC_READ;
+  barrier.Transition.StateAfter  = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+  m_command_list->ResourceBarrier(1, &barrier);
+}
+
+void D3D12_CommandList::UnorderedAccessToStructuredBuffer(const StructuredBufferGPU& buffer)
+{
+  const D3D12_StructuredBufferGPU& structured = (const D3D12_StructuredBufferGPU&)buffer;
+  D3D12_RESOURCE_BARRIER barrier;
+  barrier.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  barrier.Flags                  = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  barrier.Transition.pResource   = structured.GetResource();
+  barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+  barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+  barrier.Transition.StateAfter  = D3D12_RESOURCE_STATE_GENERIC_READ;
+  m_command_list->ResourceBarrier(1, &barrier);
+}
+
 void D3D12_CommandList::SetTextureAsStartOfDescriptorTable(UINT slot, const Texture1D& texture)
 {
   const D3D12_Texture1D& tex = (const D3D12_Texture1D&)texture;
@@ -196,8 +261,7 @@ void D3D12_CommandList::IASetVertexBuffers(const VertexBufferArray& buffers)
 
 void D3D12_CommandList::IASetIndexBuffer(const IndexBuffer& buffer)
 {
-  const D3D12_INDEX_BUFFER_VIEW& index_buffer = ((const D3D12_IndexBuffer16&)buffer).GetBuffer();
-  m_command_list->IASetIndexBuffer(&index_buffer);
+  m_command_list->IASetIndexBuffer((const D3D12_INDEX_BUFFER_VIEW*)&buffer.GetView());
 }
 
 void D3D12_CommandList::SOSetBuffers(const StreamOutputBufferArray& buffers)
@@ -440,6 +504,21 @@ void D3D12_CommandList::DrawIndexedInstanced(UINT indices_per_instance, UINT ind
   m_command_list->DrawIndexedInstanced(indices_per_instance, instance_cnt, index_start_index, 0, instance_start_index);
 }
 
+void D3D12_CommandList::DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, INT base_vertex, UINT instance_cnt, UINT instance_start_index)
+{
+  m_command_list->DrawIndexedInstanced(indices_per_instance, instance_cnt, index_start_index, base_vertex, instance_start_index);
+}
+
+void D3D12_CommandList::DrawIndexedInstanced(const DrawIndexedArgs* draws, UINT num_draws)
+{
+  for (UINT i = 0; i < num_draws; i++)
+  {
+    const DrawIndexedArgs& draw = draws[i];
+    m_command_list->DrawIndexedInstanced(draw.indices_per_instance, draw.instance_cnt, draw.index_start_index, draw.base_vertex,
+      draw.instance_start_index);
+  }
+}
+
 void D3D12_CommandList::DrawInstanced(UINT vertices_per_instance, UINT instance_cnt, UINT instance_start_index)
 {
   m_command_list->DrawInstanced(vertices_per_instance, instance_cnt, 0, instance_start_index);
@@ -131,6 +131,27 @@ D3D12_Core* D3D12_Core::Create(HWND& wnd)
   return new D3D12_Core(device, fence, fence_event, swap_chain, swap_chain3, command_queue, back_buffer, vp);
 }
 
+/// <summary>
+/// Queries the highest root signature version the device supports
+/// </summary>
+/// <param name="device">
+/// device to query
+/// </param>
+/// <returns>
+/// D3D_ROOT_SIGNATURE_VERSION_1_1 if supported, D3D_ROOT_SIGNATURE_VERSION_1 otherwise
+/// </returns>
+static D3D_ROOT_SIGNATURE_VERSION GetHighestRootSignatureVersion(ID3D12Device* device)
+{
+  // runtimes that predate version 1.1 fail the query instead of lowering HighestVersion
+  D3D12_FEATURE_DATA_ROOT_SIGNATURE query;
+  query.HighestVersion = D3D_ROOT_SIGNATURE_VERSION_1_1;
+  if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_ROOT_SIGNATURE, &query, sizeof(query))))
+  {
+    return D3D_ROOT_SIGNATURE_VERSION_1;
+  }
+  return query.HighestVersion;
+}
+
 D3D12_Core::D3D12_Core(ID3D12Device* device, ID3D12Fence* fence, HANDLE fence_event, IDXGISwapChain* swap_chain_base, IDXGISwapChain3* swap_chain, ID3D12CommandQueue* command_queue,
   D3D12_BackBuffers* back_buffer, const D3D12_VIEWPORT& viewport)
 :m_device(device),
@@ -141,7 +162,8 @@ D3D12_Core::D3D12_Core(ID3D12Device* device, ID3D12Fence* fence, HANDLE fence_ev
  m_swap_chain(swap_chain),
  m_command_queue(command_queue),
  m_back_buffer(back_buffer),
- m_fullscreen(false)
+ m_fullscreen(false),
+ m_root_sig_cache(new D3D12_RootSignatureCache(GetHighestRootSignatureVersion(device)))
 {
   memcpy(&m_default_viewport, &viewport, sizeof(Viewport));
 }
@@ -159,6 +181,7 @@ D3D12_Core::~D3D12_Core()
 
   CloseHandle(m_fence_event);
   m_fence->Release();
+  delete m_root_sig_cache;
   delete m_back_buffer;
   m_swap_chain->Release();
   m_swap_chain_base->Release();
@@ -258,19 +281,11 @@ void D3D12_Core::OnResize(UINT width,UINT height)
 void D3D12_Core::WaitOnFence()
 {
   // todo: Make thread-safe or a separate thread-safe version of the function
-  const UINT64 fence_val = m_fence_value;
-  HRESULT rc = m_command_queue->Signal(m_fence, fence_val);
-  if (FAILED(rc))
-  {
-    ostringstream out;
-    out << "Failed signaling command queue for fence.  HRESULT: " << rc;
-    throw FrameworkException(out.str());
-  }
-  ++m_fence_value;
+  const UINT64 fence_val = SignalFence();
 
   if (m_fence->GetCompletedValue() < fence_val)
   {
-    rc = m_fence->SetEventOnCompletion(fence_val, m_fence_event);
+    HRESULT rc = m_fence->SetEventOnCompletion(fence_val, m_fence_event);
     if (FAILED(rc))
     {
       ostringstream out;
@@ -281,6 +296,25 @@ void D3D12_Core::WaitOnFence()
   }
 }
 
+UINT64 D3D12_Core::SignalFence()
+{
+  const UINT64 fence_val = m_fence_value;
+  HRESULT rc = m_command_queue->Signal(m_fence, fence_val);
+  if (FAILED(rc))
+  {
+    ostringstream out;
+    out << "Failed signaling command queue for fence.  HRESULT: " << rc;
+    throw FrameworkException(out.str());
+  }
+  ++m_fence_value;
+  return fence_val;
+}
+
+UINT64 D3D12_Core::GetCompletedFenceValue() const
+{
+  return m_fence->GetCompletedValue();
+}
+
 void D3D12_Core::ExecuteCommandList(const CommandList& list) const
 {
   ID3D12GraphicsCommandList* command_lists = ((const D3D12_CommandList&)list).GetCommandList();
@@ -331,3 +365,23 @@ ID3D12Device* D3D12_Core::GetDevice() const
 {
   return m_device;
 }
+
+ID3D12CommandQueue* D3D12_Core::GetCommandQueue() const
+{
+  return m_command_queue;
+}
+
+void D3D12_Core::LoadRootSignatureCache(const char* path)
+{
+  m_root_sig_cache->Load(path);
+}
+
+void D3D12_Core::SaveRootSignatureCache(const char* path) const
+{
+  m_root_sig_cache->Save(path);
+}
+
+D3D12_RootSignatureCache& D3D12_Core::GetRootSignatureCache() const
+{
+  return *m_root_sig_cache;
+}
@@ -12,7 +12,7 @@ D3D12_InputLayout::D3D12_InputLayout(UINT num)
 
 D3D12_InputLayout::~D3D12_InputLayout()
 {
-  delete m_layout;
+  delete[] m_layout;
 }
 
 void D3D12_InputLayout::SetNextElement(Semantics semantic,UINT index, GraphicsDataFormat format, UINT input_slot, bool instance, UINT step_rate)
@@ -0,0 +1,232 @@
+#include <sstream>
+#include "private_inc/D3D12/D3D12_MeshFile.h"
+#include "Graphics/Buffers/IndexBuffer16.h"
+#include "Graphics/Buffers/IndexBuffer32.h"
+#include "Graphics/Buffers/IndexBufferGPU16.h"
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+using namespace DirectX;
+
+D3D12_MeshFile* D3D12_MeshFile::Open(const char* path)
+{
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ostringstream out;
+    out << "Unable to open \"" << path << "\". Error code: " << GetLastError();
+    throw FrameworkException(out.str());
+  }
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG)sizeof(MeshFileHeader) || file_size.QuadPart > UINT_MAX)
+  {
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" is not a mesh file";
+    throw FrameworkException(out.str());
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  const UINT8* data = (const UINT8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map a view of \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  // validate everything up front so the accessors can trust the header
+  const char* error = MeshFileFormat::Validate(data, (UINT64)file_size.QuadPart);
+  if (error != NULL)
+  {
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" " << error;
+    throw FrameworkException(out.str());
+  }
+
+  return new D3D12_MeshFile(file, mapping, data);
+}
+
+D3D12_MeshFile::D3D12_MeshFile(HANDLE file, HANDLE mapping, const UINT8* data)
+:m_file(file),
+ m_mapping(mapping),
+ m_data(data)
+{
+  m_header    = (const MeshFileHeader*)data;
+  m_elements  = (const MeshFileElement*)(data + m_header->elements_offset);
+  m_submeshes = (const MeshFileSubmesh*)(data + m_header->submeshes_offset);
+}
+
+D3D12_MeshFile::~D3D12_MeshFile()
+{
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  CloseHandle(m_file);
+}
+
+UINT D3D12_MeshFile::GetNumVertices() const
+{
+  return m_header->num_vertices;
+}
+
+UINT D3D12_MeshFile::GetVertexStride() const
+{
+  return m_header->vertex_stride;
+}
+
+UINT D3D12_MeshFile::GetNumElements() const
+{
+  return m_header->num_elements;
+}
+
+VertexElementDesc D3D12_MeshFile::GetElement(UINT index) const
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= m_header->num_elements)
+  {
+    ostringstream out;
+    out << "Element index " << index << " is out of range, only " << m_header->num_elements << " elements";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  VertexElementDesc desc;
+  desc.semantic = (Semantics)m_elements[index].semantic;
+  desc.index    = m_elements[index].semantic_index;
+  desc.format   = (GraphicsDataFormat)m_elements[index].format;
+  return desc;
+}
+
+InputLayout* D3D12_MeshFile::CreateInputLayout(UINT input_slot) const
+{
+  InputLayout* layout = InputLayout::CreateD3D12(m_header->num_elements);
+  try
+  {
+    for (UINT i = 0; i < m_header->num_elements; i++)
+    {
+      VertexElementDesc desc = GetElement(i);
+      layout->SetNextElement(desc.semantic, desc.index, desc.format, input_slot, false);
+    }
+  }
+  catch (...)
+  {
+    delete layout;
+    throw;
+  }
+  return layout;
+}
+
+UINT D3D12_MeshFile::GetNumIndices() const
+{
+  return m_header->num_indices;
+}
+
+GraphicsDataFormat D3D12_MeshFile::GetIndexFormat() const
+{
+  return m_header->index_size == sizeof(WORD) ? R16_UINT : R32_UINT;
+}
+
+UINT D3D12_MeshFile::GetNumSubmeshes() const
+{
+  return m_header->num_submeshes;
+}
+
+MeshSubmesh D3D12_MeshFile::GetSubmesh(UINT index) const
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= m_header->num_submeshes)
+  {
+    ostringstream out;
+    out << "Submesh index " << index << " is out of range, only " << m_header->num_submeshes << " submeshes";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  const MeshFileSubmesh& src = m_submeshes[index];
+  MeshSubmesh submesh;
+  submesh.first_index = src.first_index;
+  submesh.num_indices = src.num_indices;
+  submesh.bounds_min  = XMFLOAT3(src.bounds_min[0], src.bounds_min[1], src.bounds_min[2]);
+  submesh.bounds_max  = XMFLOAT3(src.bounds_max[0], src.bounds_max[1], src.bounds_max[2]);
+  return submesh;
+}
+
+void D3D12_MeshFile::GetBounds(XMFLOAT3& bounds_min, XMFLOAT3& bounds_max) const
+{
+  bounds_min = XMFLOAT3(m_header->bounds_min[0], m_header->bounds_min[1], m_header->bounds_min[2]);
+  bounds_max = XMFLOAT3(m_header->bounds_max[0], m_header->bounds_max[1], m_header->bounds_max[2]);
+}
+
+const void* D3D12_MeshFile::GetVertexData() const
+{
+  return m_data + m_header->vertices_offset;
+}
+
+const void* D3D12_MeshFile::GetIndexData() const
+{
+  return m_data + m_header->indices_offset;
+}
+
+VertexBuffer_Custom* D3D12_MeshFile::CreateVertexBuffer(GraphicsCore& graphics) const
+{
+  // the vertex data goes straight from the mapping into the upload buffer
+  return VertexBuffer_Custom::CreateD3D12(graphics, m_header->num_vertices, m_header->vertex_stride, GetVertexData());
+}
+
+VertexBufferGPU_Custom* D3D12_MeshFile::CreateVertexBufferGPU(GraphicsCore& graphics) const
+{
+  return VertexBufferGPU_Custom::CreateD3D12(graphics, m_header->num_vertices, m_header->vertex_stride);
+}
+
+IndexBuffer* D3D12_MeshFile::CreateIndexBuffer(GraphicsCore& graphics) const
+{
+  if (m_header->index_size == sizeof(WORD))
+  {
+    return IndexBuffer16::CreateD3D12(graphics, m_header->num_indices, (const WORD*)GetIndexData());
+  }
+  return IndexBuffer32::CreateD3D12(graphics, m_header->num_indices, (const UINT*)GetIndexData());
+}
+
+IndexBuffer* D3D12_MeshFile::CreateIndexBufferGPU(GraphicsCore& graphics) const
+{
+  if (m_header->index_size == sizeof(WORD))
+  {
+    return IndexBufferGPU16::CreateD3D12(graphics, m_header->num_indices);
+  }
+  return IndexBufferGPU32::CreateD3D12(graphics, m_header->num_indices);
+}
+
+void D3D12_MeshFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, VertexBuffer_Custom& vertices, const VertexBufferGPU_Custom& vertices_gpu,
+  IndexBuffer& indices, const IndexBuffer& indices_gpu) const
+{
+  vertices.PrepUpload(graphics, command_list, vertices_gpu);
+  if (m_header->index_size == sizeof(WORD))
+  {
+    ((IndexBuffer16&)indices).PrepUpload(graphics, command_list, (const IndexBufferGPU16&)indices_gpu);
+  }
+  else
+  {
+    ((IndexBuffer32&)indices).PrepUpload(graphics, command_list, (const IndexBufferGPU32&)indices_gpu);
+  }
+}
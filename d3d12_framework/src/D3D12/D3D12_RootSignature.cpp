@@ -7,7 +7,7 @@
 using namespace std;
 
 #if 0
-void dump_root_sig_config(const D3D12_ROOT_SIGNATURE_DESC& desc)
+void dump_root_sig_config(const D3D12_ROOT_SIGNATURE_DESC1& desc)
 {
   std::ostringstream out;
   UINT i;
@@ -27,7 +27,7 @@ void dump_root_sig_config(const D3D12_ROOT_SIGNATURE_DESC& desc)
         {
           for (UINT j = 0; j < desc.pParameters[i].DescriptorTable.NumDescriptorRanges; j++)
           {
-            const D3D12_DESCRIPTOR_RANGE& range = desc.pParameters[i].DescriptorTable.pDescriptorRanges[j];
+            const D3D12_DESCRIPTOR_RANGE1& range = desc.pParameters[i].DescriptorTable.pDescriptorRanges[j];
             out << "    entry[" << j << "]: " << "type " << range.RangeType << ", num " << range.NumDescriptors << ", base " << range.BaseShaderRegister << ", reg space " << range.RegisterSpace
                 << ", offset " << range.OffsetInDescriptorsFromTableStart << '\n';
           }
@@ -79,26 +79,9 @@ D3D12_RootSignature* D3D12_RootSignature::Create(const GraphicsCore& graphics, c
 {
   const D3D12_Core& core = (const D3D12_Core&)graphics;
   const D3D12_RootSignatureConfig& conf = (const D3D12_RootSignatureConfig&)config;
-  const D3D12_ROOT_SIGNATURE_DESC& desc = conf.GetDesc();
 
-  ID3DBlob* sig;
-  ID3DBlob* err;
   //dump_root_sig_config(conf.GetDesc());
-  HRESULT rc = D3D12SerializeRootSignature(&desc, D3D_ROOT_SIGNATURE_VERSION_1, &sig, &err);
-  if (FAILED(rc))
-  {
-    ostringstream out;
-    out << "Failed to serialize root signature, HRESULT = " << rc;
-    throw FrameworkException(out.str());
-  }
-  ID3D12RootSignature* root_sig;
-  rc = core.GetDevice()->CreateRootSignature(0, sig->GetBufferPointer(), sig->GetBufferSize(), IID_PPV_ARGS(&root_sig));
-  if (FAILED(rc))
-  {
-    ostringstream out;
-    out << "Failed to create root signature, HRESULT = " << rc;
-    throw FrameworkException(out.str());
-  }
+  ID3D12RootSignature* root_sig = core.GetRootSignatureCache().GetOrCreate(core.GetDevice(), conf);
 
   return new D3D12_RootSignature(root_sig, conf.GetDesc().Flags);
 }
@@ -0,0 +1,246 @@
+#include <sstream>
+#include <fstream>
+#include "private_inc/D3D12/D3D12_RootSignatureCache.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// identifies a root signature cache file and its version
+/// </summary>
+static const UINT CACHE_FILE_MAGIC = 0x32435352; // "RSC2"
+
+D3D12_RootSignatureCache::D3D12_RootSignatureCache(D3D_ROOT_SIGNATURE_VERSION version)
+:m_version(D3D_ROOT_SIGNATURE_VERSION_1),
+ m_serialize_versioned(NULL)
+{
+  if (version >= D3D_ROOT_SIGNATURE_VERSION_1_1)
+  {
+    HMODULE d3d12 = GetModuleHandleA("d3d12.dll");
+    if (d3d12 != NULL)
+    {
+      m_serialize_versioned = (PFN_D3D12_SERIALIZE_VERSIONED_ROOT_SIGNATURE)GetProcAddress(d3d12, "D3D12SerializeVersionedRootSignature");
+    }
+    if (m_serialize_versioned != NULL)
+    {
+      m_version = D3D_ROOT_SIGNATURE_VERSION_1_1;
+    }
+  }
+}
+
+D3D12_RootSignatureCache::~D3D12_RootSignatureCache()
+{
+  unordered_map<string, Entry>::iterator it = m_entries.begin();
+  while (it != m_entries.end())
+  {
+    if (it->second.root_sig != NULL)
+    {
+      it->second.root_sig->Release();
+    }
+
+    ++it;
+  }
+}
+
+ID3D12RootSignature* D3D12_RootSignatureCache::GetOrCreate(ID3D12Device* device, const D3D12_RootSignatureConfig& config)
+{
+  // blobs of different versions are not interchangeable, so the version is part of the key
+  string key;
+  config.GetKey(key);
+  key.append((const char*)&m_version, sizeof(m_version));
+
+  lock_guard<mutex> guard(m_lock);
+  Entry& entry = m_entries[key];
+  if (entry.root_sig != NULL)
+  {
+    entry.root_sig->AddRef();
+    return entry.root_sig;
+  }
+
+  // a blob loaded from a cache file may have been written by a runtime or driver that no longer accepts it, so it is
+  // only trusted until the device rejects it, at which point the root signature is serialized again from the config
+  ID3D12RootSignature* root_sig = NULL;
+  HRESULT rc = E_FAIL;
+  if (!entry.blob.empty())
+  {
+    rc = device->CreateRootSignature(0, &entry.blob[0], entry.blob.size(), IID_PPV_ARGS(&root_sig));
+  }
+  if (FAILED(rc))
+  {
+    try
+    {
+      Serialize(config, entry.blob);
+    }
+    catch (...)
+    {
+      m_entries.erase(key);
+      throw;
+    }
+
+    rc = device->CreateRootSignature(0, &entry.blob[0], entry.blob.size(), IID_PPV_ARGS(&root_sig));
+    if (FAILED(rc))
+    {
+      ostringstream out;
+      out << "Failed to create root signature, HRESULT = " << rc;
+      m_entries.erase(key);
+      throw FrameworkException(out.str());
+    }
+  }
+
+  // one reference is held by the cache, the other is handed to the caller
+  entry.root_sig = root_sig;
+  root_sig->AddRef();
+  return root_sig;
+}
+
+void D3D12_RootSignatureCache::Serialize(const D3D12_RootSignatureConfig& config, vector<UINT8>& blob) const
+{
+  ID3DBlob* sig = NULL;
+  ID3DBlob* err = NULL;
+  HRESULT rc;
+  if (m_version == D3D_ROOT_SIGNATURE_VERSION_1_1)
+  {
+    D3D12_VERSIONED_ROOT_SIGNATURE_DESC desc;
+    desc.Version  = D3D_ROOT_SIGNATURE_VERSION_1_1;
+    desc.Desc_1_1 = config.GetDesc();
+    rc = m_serialize_versioned(&desc, &sig, &err);
+  }
+  else
+  {
+    D3D12_ROOT_SIGNATURE_DESC desc;
+    vector<D3D12_ROOT_PARAMETER> params;
+    vector<D3D12_DESCRIPTOR_RANGE> ranges;
+    config.GetDescVersion1_0(desc, params, ranges);
+    rc = D3D12SerializeRootSignature(&desc, D3D_ROOT_SIGNATURE_VERSION_1, &sig, &err);
+  }
+  if (FAILED(rc))
+  {
+    ostringstream out;
+    out << "Failed to serialize root signature, HRESULT = " << rc;
+    if (err != NULL)
+    {
+      out << "\n" << string((const char*)err->GetBufferPointer(), err->GetBufferSize());
+      err->Release();
+    }
+    throw FrameworkException(out.str());
+  }
+  if (err != NULL)
+  {
+    err->Release();
+  }
+
+  const UINT8* bytes = (const UINT8*)sig->GetBufferPointer();
+  blob.assign(bytes, bytes + sig->GetBufferSize());
+  sig->Release();
+}
+
+void D3D12_RootSignatureCache::Load(const char* path)
+{
+  ifstream file(path, ios::in | ios::binary);
+  if (!file.is_open())
+  {
+    return;
+  }
+
+  // the sizes in the file are checked against the bytes left in it before anything is allocated for them, so a corrupt
+  // file can't ask for more memory than it holds
+  file.seekg(0, ios::end);
+  UINT64 remaining = (UINT64)file.tellg();
+  file.seekg(0, ios::beg);
+
+  UINT magic = 0;
+  UINT num_entries = 0;
+  file.read((char*)&magic, sizeof(magic));
+  file.read((char*)&num_entries, sizeof(num_entries));
+  if (!file || magic != CACHE_FILE_MAGIC)
+  {
+    ostringstream out;
+    out << "\"" << path << "\" is not a root signature cache file";
+    throw FrameworkException(out.str());
+  }
+  remaining -= sizeof(magic) + sizeof(num_entries);
+
+  lock_guard<mutex> guard(m_lock);
+  for (UINT i = 0; i < num_entries; i++)
+  {
+    UINT key_size = 0;
+    UINT blob_size = 0;
+    string key;
+    vector<UINT8> blob;
+
+    bool valid = remaining >= sizeof(key_size);
+    if (valid)
+    {
+      file.read((char*)&key_size, sizeof(key_size));
+      remaining -= sizeof(key_size);
+      valid = file && key_size > 0 && key_size <= remaining;
+    }
+    if (valid)
+    {
+      key.resize(key_size);
+      file.read(&key[0], key_size);
+      remaining -= key_size;
+      valid = file && remaining >= sizeof(blob_size);
+    }
+    if (valid)
+    {
+      file.read((char*)&blob_size, sizeof(blob_size));
+      remaining -= sizeof(blob_size);
+      valid = file && blob_size > 0 && blob_size <= remaining;
+    }
+    if (valid)
+    {
+      blob.resize(blob_size);
+      file.read((char*)&blob[0], blob_size);
+      remaining -= blob_size;
+      valid = !file.fail();
+    }
+    if (!valid)
+    {
+      ostringstream out;
+      out << "Root signature cache file \"" << path << "\" is truncated at entry " << i;
+      throw FrameworkException(out.str());
+    }
+
+    Entry& entry = m_entries[key];
+    if (entry.blob.empty())
+    {
+      entry.blob.swap(blob);
+    }
+  }
+}
+
+void D3D12_RootSignatureCache::Save(const char* path) const
+{
+  ofstream file(path, ios::out | ios::binary | ios::trunc);
+  if (!file.is_open())
+  {
+    ostringstream out;
+    out << "Unable to open \"" << path << "\" to write the root signature cache";
+    throw FrameworkException(out.str());
+  }
+
+  lock_guard<mutex> guard(m_lock);
+  const UINT num_entries = (UINT)m_entries.size();
+  file.write((const char*)&CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+  file.write((const char*)&num_entries, sizeof(num_entries));
+
+  unordered_map<string, Entry>::const_iterator it = m_entries.begin();
+  while (it != m_entries.end())
+  {
+    const UINT key_size = (UINT)it->first.size();
+    const UINT blob_size = (UINT)it->second.blob.size();
+    file.write((const char*)&key_size, sizeof(key_size));
+    file.write(it->first.data(), key_size);
+    file.write((const char*)&blob_size, sizeof(blob_size));
+    file.write((const char*)&it->second.blob[0], blob_size);
+
+    ++it;
+  }
+
+  if (!file)
+  {
+    ostringstream out;
+    out << "Failed writing the root signature cache to \"" << path << "\"";
+    throw FrameworkException(out.str());
+  }
+}
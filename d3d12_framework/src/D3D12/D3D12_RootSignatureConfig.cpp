@@ -1,11 +1,104 @@
 #include "private_inc/D3D12/D3D12_RootSignatureConfig.h"
 #include "private_inc/BuildSettings.h"
 #include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Appends a 32-bit value to a canonical root signature key
+/// </summary>
+/// <param name="key">
+/// key to append to
+/// </param>
+/// <param name="value">
+/// value to append
+/// </param>
+static void AppendKey(string& key, UINT value)
+{
+  key.append((const char*)&value, sizeof(value));
+}
+
+/// <summary>
+/// Appends a float to a canonical root signature key using its bit pattern.  -0 is appended as 0, since the 2 compare
+/// equal and describe the same sampler
+/// </summary>
+/// <param name="key">
+/// key to append to
+/// </param>
+/// <param name="value">
+/// value to append
+/// </param>
+static void AppendKey(string& key, float value)
+{
+  if (value == 0)
+  {
+    value = 0;
+  }
+  key.append((const char*)&value, sizeof(value));
+}
+
+/// <summary>
+/// Converts framework volatility flags to the flags of a descriptor range
+/// </summary>
+/// <param name="type">
+/// type of the range.  Samplers have no data, so only DESCRIPTORS_VOLATILE is kept for them
+/// </param>
+/// <param name="flags">
+/// flags to convert
+/// </param>
+/// <returns>
+/// D3D12 descriptor range flags
+/// </returns>
+static D3D12_DESCRIPTOR_RANGE_FLAGS GetRangeFlags(D3D12_DESCRIPTOR_RANGE_TYPE type, RootDescriptorFlags flags)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  UINT data_flags = flags & (ROOT_FLAGS_DATA_VOLATILE | ROOT_FLAGS_DATA_STATIC_WHILE_SET_AT_EXECUTE | ROOT_FLAGS_DATA_STATIC);
+  if ((data_flags & (data_flags - 1)) != 0)
+  {
+    throw FrameworkException("only one data volatility flag can be set");
+  }
+  // D3D12 only rejects this when the root signature is serialized, which is far from the call that set it
+  if (type != D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER && (flags & ROOT_FLAGS_DESCRIPTORS_VOLATILE) != 0 && (flags & ROOT_FLAGS_DATA_STATIC) != 0)
+  {
+    throw FrameworkException("volatile descriptors can't point to static data");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  if (type == D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER)
+  {
+    return (D3D12_DESCRIPTOR_RANGE_FLAGS)(flags & ROOT_FLAGS_DESCRIPTORS_VOLATILE);
+  }
+  return (D3D12_DESCRIPTOR_RANGE_FLAGS)flags;
+}
+
+/// <summary>
+/// Converts framework volatility flags to the flags of a root descriptor.  Root descriptors are not stored in a heap,
+/// so DESCRIPTORS_VOLATILE is dropped
+/// </summary>
+/// <param name="flags">
+/// flags to convert
+/// </param>
+/// <returns>
+/// D3D12 root descriptor flags
+/// </returns>
+static D3D12_ROOT_DESCRIPTOR_FLAGS GetDescriptorFlags(RootDescriptorFlags flags)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  UINT data_flags = flags & (ROOT_FLAGS_DATA_VOLATILE | ROOT_FLAGS_DATA_STATIC_WHILE_SET_AT_EXECUTE | ROOT_FLAGS_DATA_STATIC);
+  if ((data_flags & (data_flags - 1)) != 0)
+  {
+    throw FrameworkException("only one data volatility flag can be set");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return (D3D12_ROOT_DESCRIPTOR_FLAGS)(flags & ~ROOT_FLAGS_DESCRIPTORS_VOLATILE);
+}
 
 D3D12_RootSignatureConfig::D3D12_RootSignatureConfig(UINT num_params, UINT num_sampler)
 {
-  m_params   = new D3D12_ROOT_PARAMETER[num_params];
-  m_samplers = new D3D12_STATIC_SAMPLER_DESC[num_sampler];
+  // zeroed so a config that is destroyed before every parameter is set, e.g. when parsing an embedded root signature
+  // fails part way, only sees empty descriptor tables
+  m_params   = new D3D12_ROOT_PARAMETER1[num_params]();
+  m_samplers = new D3D12_STATIC_SAMPLER_DESC[num_sampler]();
 
   m_desc.Flags             = D3D12_ROOT_SIGNATURE_FLAG_NONE;
   m_desc.NumParameters     = num_params;
@@ -14,6 +107,92 @@ D3D12_RootSignatureConfig::D3D12_RootSignatureConfig(UINT num_params, UINT num_s
   m_desc.pStaticSamplers   = m_samplers;
 }
 
+D3D12_RootSignatureConfig* D3D12_RootSignatureConfig::Create(const RootSignatureDesc& desc)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  for (UINT i = 0; i < desc.num_params; i++)
+  {
+    const RootParamDesc& param = desc.params[i];
+    if (param.type > ROOT_PARAM_UAV)
+    {
+      throw FrameworkException("invalid root parameter type");
+    }
+    if (param.type == ROOT_PARAM_DESCRIPTOR_TABLE)
+    {
+      for (UINT j = 0; j < param.num_ranges; j++)
+      {
+        if (param.ranges[j].type > ROOT_RANGE_SAMPLER)
+        {
+          throw FrameworkException("invalid descriptor range type");
+        }
+      }
+    }
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  // the description is trusted from here on, so fill in the D3D12 structures directly instead of through the setters
+  D3D12_RootSignatureConfig* config = new D3D12_RootSignatureConfig(desc.num_params, desc.num_samplers);
+  config->SetStageAccess(desc.ia, desc.vs, desc.hs, desc.ds, desc.gs, desc.ps, desc.so);
+
+  for (UINT i = 0; i < desc.num_params; i++)
+  {
+    const RootParamDesc& src = desc.params[i];
+    D3D12_ROOT_PARAMETER1& param = config->m_params[i];
+    param.ParameterType         = (D3D12_ROOT_PARAMETER_TYPE)src.type;
+    param.ShaderVisibility      = (D3D12_SHADER_VISIBILITY)src.shaders;
+    switch (src.type)
+    {
+      case ROOT_PARAM_DESCRIPTOR_TABLE:
+      {
+        D3D12_DESCRIPTOR_RANGE1* ranges = new D3D12_DESCRIPTOR_RANGE1[src.num_ranges];
+        for (UINT j = 0; j < src.num_ranges; j++)
+        {
+          ranges[j].RangeType                         = (D3D12_DESCRIPTOR_RANGE_TYPE)src.ranges[j].type;
+          ranges[j].NumDescriptors                    = src.ranges[j].num_descriptors;
+          ranges[j].BaseShaderRegister                = src.ranges[j].base_shader_register;
+          ranges[j].RegisterSpace                     = src.ranges[j].register_space;
+          ranges[j].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+          ranges[j].Flags                             = GetRangeFlags(ranges[j].RangeType, src.ranges[j].flags);
+        }
+        param.DescriptorTable.NumDescriptorRanges = src.num_ranges;
+        param.DescriptorTable.pDescriptorRanges   = ranges;
+        break;
+      }
+      case ROOT_PARAM_CONSTANTS:
+        param.Constants.ShaderRegister = src.shader_register;
+        param.Constants.RegisterSpace  = src.register_space;
+        param.Constants.Num32BitValues = src.num_32bit_values;
+        break;
+      default:
+        param.Descriptor.ShaderRegister = src.shader_register;
+        param.Descriptor.RegisterSpace  = src.register_space;
+        param.Descriptor.Flags          = GetDescriptorFlags(src.flags);
+        break;
+    }
+  }
+
+  for (UINT i = 0; i < desc.num_samplers; i++)
+  {
+    const RootSamplerDesc& src = desc.samplers[i];
+    D3D12_STATIC_SAMPLER_DESC& sampler = config->m_samplers[i];
+    sampler.Filter                     = (D3D12_FILTER)src.filter;
+    sampler.AddressU                   = (D3D12_TEXTURE_ADDRESS_MODE)src.address_u;
+    sampler.AddressV                   = (D3D12_TEXTURE_ADDRESS_MODE)src.address_v;
+    sampler.AddressW                   = (D3D12_TEXTURE_ADDRESS_MODE)src.address_w;
+    sampler.MipLODBias                 = src.mip_lod_bias;
+    sampler.MaxAnisotropy              = src.max_anisotropy;
+    sampler.ComparisonFunc             = (D3D12_COMPARISON_FUNC)src.compare_func;
+    sampler.BorderColor                = (D3D12_STATIC_BORDER_COLOR)src.border_color;
+    sampler.MinLOD                     = src.min_lod;
+    sampler.MaxLOD                     = src.max_lod;
+    sampler.ShaderRegister             = src.shader_register;
+    sampler.RegisterSpace              = src.register_space;
+    sampler.ShaderVisibility           = (D3D12_SHADER_VISIBILITY)src.shaders;
+  }
+
+  return config;
+}
+
 D3D12_RootSignatureConfig::~D3D12_RootSignatureConfig()
 {
   for (UINT i = 0; i < m_desc.NumParameters; i++)
@@ -96,7 +275,7 @@ void D3D12_RootSignatureConfig::SetParamAsConstants(UINT param_index, UINT shade
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_ROOT_PARAMETER& param    = m_params[param_index];
+  D3D12_ROOT_PARAMETER1& param    = m_params[param_index];
   param.ParameterType            = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
   param.Constants.ShaderRegister = shader_register;
   param.Constants.RegisterSpace  = register_space;
@@ -104,7 +283,7 @@ void D3D12_RootSignatureConfig::SetParamAsConstants(UINT param_index, UINT shade
   param.ShaderVisibility         = (D3D12_SHADER_VISIBILITY)shaders;
 }
 
-void D3D12_RootSignatureConfig::SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders)
+void D3D12_RootSignatureConfig::SetParamAsConstantBufferView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -113,14 +292,15 @@ void D3D12_RootSignatureConfig::SetParamAsConstantBufferView(UINT param_index, U
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_ROOT_PARAMETER& param     = m_params[param_index];
+  D3D12_ROOT_PARAMETER1& param     = m_params[param_index];
   param.ParameterType             = D3D12_ROOT_PARAMETER_TYPE_CBV;
   param.Descriptor.ShaderRegister = shader_register;
   param.Descriptor.RegisterSpace  = register_space;
+  param.Descriptor.Flags          = GetDescriptorFlags(flags);
   param.ShaderVisibility          = (D3D12_SHADER_VISIBILITY)shaders;
 }
 
-void D3D12_RootSignatureConfig::SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders)
+void D3D12_RootSignatureConfig::SetParamAsShaderResourceView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -129,14 +309,15 @@ void D3D12_RootSignatureConfig::SetParamAsShaderResourceView(UINT param_index, U
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_ROOT_PARAMETER& param     = m_params[param_index];
+  D3D12_ROOT_PARAMETER1& param     = m_params[param_index];
   param.ParameterType             = D3D12_ROOT_PARAMETER_TYPE_SRV;
   param.Descriptor.ShaderRegister = shader_register;
   param.Descriptor.RegisterSpace  = register_space;
+  param.Descriptor.Flags          = GetDescriptorFlags(flags);
   param.ShaderVisibility          = (D3D12_SHADER_VISIBILITY)shaders;
 }
 
-void D3D12_RootSignatureConfig::SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders)
+void D3D12_RootSignatureConfig::SetParamAsUnorderedAccessView(UINT param_index, UINT shader_register, UINT register_space, ShaderVisibility shaders, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -145,10 +326,11 @@ void D3D12_RootSignatureConfig::SetParamAsUnorderedAccessView(UINT param_index,
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_ROOT_PARAMETER& param     = m_params[param_index];
+  D3D12_ROOT_PARAMETER1& param     = m_params[param_index];
   param.ParameterType             = D3D12_ROOT_PARAMETER_TYPE_UAV;
   param.Descriptor.ShaderRegister = shader_register;
   param.Descriptor.RegisterSpace  = register_space;
+  param.Descriptor.Flags          = GetDescriptorFlags(flags);
   param.ShaderVisibility          = (D3D12_SHADER_VISIBILITY)shaders;
 }
 
@@ -161,14 +343,14 @@ void D3D12_RootSignatureConfig::SetParamAsDescriptorTable(UINT param_index, UINT
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_ROOT_PARAMETER& param               = m_params[param_index];
+  D3D12_ROOT_PARAMETER1& param               = m_params[param_index];
   param.ParameterType                       = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
   param.DescriptorTable.NumDescriptorRanges = num_ranges;
-  param.DescriptorTable.pDescriptorRanges   = new D3D12_DESCRIPTOR_RANGE[num_ranges];
+  param.DescriptorTable.pDescriptorRanges   = new D3D12_DESCRIPTOR_RANGE1[num_ranges];
   param.ShaderVisibility                    = (D3D12_SHADER_VISIBILITY)shaders;
 }
 
-void D3D12_RootSignatureConfig::SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space)
+void D3D12_RootSignatureConfig::SetRangeAsConstantBufferView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -185,15 +367,16 @@ void D3D12_RootSignatureConfig::SetRangeAsConstantBufferView(UINT param_index, U
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_DESCRIPTOR_RANGE* range            = (D3D12_DESCRIPTOR_RANGE*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
+  D3D12_DESCRIPTOR_RANGE1* range            = (D3D12_DESCRIPTOR_RANGE1*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
   range->RangeType                         = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
   range->NumDescriptors                    = num_descriptors;
   range->BaseShaderRegister                = base_shader_register;
   range->RegisterSpace                     = register_space;
   range->OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+  range->Flags                             = GetRangeFlags(range->RangeType, flags);
 }
 
-void D3D12_RootSignatureConfig::SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space)
+void D3D12_RootSignatureConfig::SetRangeAsShaderResourceView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -210,15 +393,16 @@ void D3D12_RootSignatureConfig::SetRangeAsShaderResourceView(UINT param_index, U
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_DESCRIPTOR_RANGE* range            = (D3D12_DESCRIPTOR_RANGE*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
+  D3D12_DESCRIPTOR_RANGE1* range            = (D3D12_DESCRIPTOR_RANGE1*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
   range->RangeType                         = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
   range->NumDescriptors                    = num_descriptors;
   range->BaseShaderRegister                = base_shader_register;
   range->RegisterSpace                     = register_space;
   range->OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+  range->Flags                             = GetRangeFlags(range->RangeType, flags);
 }
 
-void D3D12_RootSignatureConfig::SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space)
+void D3D12_RootSignatureConfig::SetRangeAsUnorderedAccessView(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -235,15 +419,16 @@ void D3D12_RootSignatureConfig::SetRangeAsUnorderedAccessView(UINT param_index,
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_DESCRIPTOR_RANGE* range            = (D3D12_DESCRIPTOR_RANGE*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
+  D3D12_DESCRIPTOR_RANGE1* range            = (D3D12_DESCRIPTOR_RANGE1*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
   range->RangeType                         = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
   range->NumDescriptors                    = num_descriptors;
   range->BaseShaderRegister                = base_shader_register;
   range->RegisterSpace                     = register_space;
   range->OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+  range->Flags                             = GetRangeFlags(range->RangeType, flags);
 }
 
-void D3D12_RootSignatureConfig::SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space)
+void D3D12_RootSignatureConfig::SetRangeAsSampler(UINT param_index, UINT range_index, UINT num_descriptors, UINT base_shader_register, UINT register_space, RootDescriptorFlags flags)
 {
 #ifdef VALIDATE_FUNCTION_ARGUMENTS
   if (param_index >= m_desc.NumParameters)
@@ -260,15 +445,157 @@ void D3D12_RootSignatureConfig::SetRangeAsSampler(UINT param_index, UINT range_i
   }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
-  D3D12_DESCRIPTOR_RANGE* range            = (D3D12_DESCRIPTOR_RANGE*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
+  D3D12_DESCRIPTOR_RANGE1* range            = (D3D12_DESCRIPTOR_RANGE1*)&m_params[param_index].DescriptorTable.pDescriptorRanges[range_index];
   range->RangeType                         = D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER;
   range->NumDescriptors                    = num_descriptors;
   range->BaseShaderRegister                = base_shader_register;
   range->RegisterSpace                     = register_space;
   range->OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+  range->Flags                             = GetRangeFlags(range->RangeType, flags);
 }
 
-const D3D12_ROOT_SIGNATURE_DESC& D3D12_RootSignatureConfig::GetDesc() const
+const D3D12_ROOT_SIGNATURE_DESC1& D3D12_RootSignatureConfig::GetDesc() const
 {
   return m_desc;
 }
+
+void D3D12_RootSignatureConfig::GetDescVersion1_0(D3D12_ROOT_SIGNATURE_DESC& desc, vector<D3D12_ROOT_PARAMETER>& params, vector<D3D12_DESCRIPTOR_RANGE>& ranges) const
+{
+  // size the range storage up front so the pointers handed out below stay valid
+  UINT num_ranges = 0;
+  for (UINT i = 0; i < m_desc.NumParameters; i++)
+  {
+    if (m_params[i].ParameterType == D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+    {
+      num_ranges += m_params[i].DescriptorTable.NumDescriptorRanges;
+    }
+  }
+  params.resize(m_desc.NumParameters);
+  ranges.resize(num_ranges);
+
+  // version 1.0 has no flags, the driver treats everything as volatile
+  UINT next_range = 0;
+  for (UINT i = 0; i < m_desc.NumParameters; i++)
+  {
+    const D3D12_ROOT_PARAMETER1& src = m_params[i];
+    D3D12_ROOT_PARAMETER& param      = params[i];
+    param.ParameterType              = src.ParameterType;
+    param.ShaderVisibility           = src.ShaderVisibility;
+    switch (src.ParameterType)
+    {
+      case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+        param.DescriptorTable.NumDescriptorRanges = src.DescriptorTable.NumDescriptorRanges;
+        param.DescriptorTable.pDescriptorRanges   = num_ranges > 0 ? &ranges[next_range] : NULL;
+        for (UINT j = 0; j < src.DescriptorTable.NumDescriptorRanges; j++)
+        {
+          const D3D12_DESCRIPTOR_RANGE1& src_range = src.DescriptorTable.pDescriptorRanges[j];
+          D3D12_DESCRIPTOR_RANGE& range            = ranges[next_range++];
+          range.RangeType                          = src_range.RangeType;
+          range.NumDescriptors                     = src_range.NumDescriptors;
+          range.BaseShaderRegister                 = src_range.BaseShaderRegister;
+          range.RegisterSpace                      = src_range.RegisterSpace;
+          range.OffsetInDescriptorsFromTableStart  = src_range.OffsetInDescriptorsFromTableStart;
+        }
+        break;
+
+      case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+        param.Constants = src.Constants;
+        break;
+
+      default:
+        param.Descriptor.ShaderRegister = src.Descriptor.ShaderRegister;
+        param.Descriptor.RegisterSpace  = src.Descriptor.RegisterSpace;
+        break;
+    }
+  }
+
+  desc.Flags             = m_desc.Flags;
+  desc.NumParameters     = m_desc.NumParameters;
+  desc.pParameters       = params.empty() ? NULL : &params[0];
+  desc.NumStaticSamplers = m_desc.NumStaticSamplers;
+  desc.pStaticSamplers   = m_desc.pStaticSamplers;
+}
+
+void D3D12_RootSignatureConfig::GetKey(string& key) const
+{
+  key.clear();
+  AppendKey(key, (UINT)m_desc.Flags);
+  AppendKey(key, m_desc.NumParameters);
+  for (UINT i = 0; i < m_desc.NumParameters; i++)
+  {
+    const D3D12_ROOT_PARAMETER1& param = m_params[i];
+    AppendKey(key, (UINT)param.ParameterType);
+    AppendKey(key, (UINT)param.ShaderVisibility);
+    switch (param.ParameterType)
+    {
+      case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+        AppendKey(key, param.DescriptorTable.NumDescriptorRanges);
+        for (UINT j = 0; j < param.DescriptorTable.NumDescriptorRanges; j++)
+        {
+          const D3D12_DESCRIPTOR_RANGE1& range = param.DescriptorTable.pDescriptorRanges[j];
+          AppendKey(key, (UINT)range.RangeType);
+          AppendKey(key, range.NumDescriptors);
+          AppendKey(key, range.BaseShaderRegister);
+          AppendKey(key, range.RegisterSpace);
+          AppendKey(key, range.OffsetInDescriptorsFromTableStart);
+          AppendKey(key, (UINT)range.Flags);
+        }
+        break;
+
+      case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+        AppendKey(key, param.Constants.ShaderRegister);
+        AppendKey(key, param.Constants.RegisterSpace);
+        AppendKey(key, param.Constants.Num32BitValues);
+        break;
+
+      default:
+        AppendKey(key, param.Descriptor.ShaderRegister);
+        AppendKey(key, param.Descriptor.RegisterSpace);
+        AppendKey(key, (UINT)param.Descriptor.Flags);
+        break;
+    }
+  }
+
+  AppendKey(key, m_desc.NumStaticSamplers);
+  for (UINT i = 0; i < m_desc.NumStaticSamplers; i++)
+  {
+    const D3D12_STATIC_SAMPLER_DESC& sampler = m_samplers[i];
+    AppendKey(key, (UINT)sampler.Filter);
+    AppendKey(key, (UINT)sampler.AddressU);
+    AppendKey(key, (UINT)sampler.AddressV);
+    AppendKey(key, (UINT)sampler.AddressW);
+    AppendKey(key, sampler.MipLODBias);
+    AppendKey(key, sampler.MaxAnisotropy);
+    AppendKey(key, (UINT)sampler.ComparisonFunc);
+    AppendKey(key, (UINT)sampler.BorderColor);
+    AppendKey(key, sampler.MinLOD);
+    AppendKey(key, sampler.MaxLOD);
+    AppendKey(key, sampler.ShaderRegister);
+    AppendKey(key, sampler.RegisterSpace);
+    AppendKey(key, (UINT)sampler.ShaderVisibility);
+  }
+}
+
+UINT64 D3D12_RootSignatureConfig::GetHash() const
+{
+  string key;
+  GetKey(key);
+
+  // 64-bit FNV-1a
+  UINT64 hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < key.size(); i++)
+  {
+    hash ^= (UINT8)key[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool D3D12_RootSignatureConfig::IsEquivalent(const RootSignatureConfig& other) const
+{
+  string key;
+  string other_key;
+  GetKey(key);
+  ((const D3D12_RootSignatureConfig&)other).GetKey(other_key);
+  return key == other_key;
+}
@@ -2,6 +2,7 @@
 #include <sstream>
 #include "private_inc/D3D12/D3D12_Shader.h"
 #include "private_inc/BuildSettings.h"
+#include "Graphics/ShaderReflection.h"
 #include "FrameworkException.h"
 using namespace std;
 
@@ -36,14 +37,24 @@ D3D12_Shader* D3D12_Shader::Load(const char* path)
   {
     delete [] data;
     in.close();
-    return false;
+
+    ostringstream out;
+    out << "Unable to read \"" << path << '\"';
+    throw FrameworkException(out.str());
   }
 
   in.close();
-  return new D3D12_Shader(data, length);
+  return new D3D12_Shader(data, length, true);
 }
 
-D3D12_Shader::D3D12_Shader(const char* bytecode, size_t len)
+D3D12_Shader* D3D12_Shader::CreateFromMemory(const void* bytecode, size_t len)
+{
+  return new D3D12_Shader(bytecode, len, false);
+}
+
+D3D12_Shader::D3D12_Shader(const void* bytecode, size_t len, bool owns_bytecode)
+:m_owns_bytecode(owns_bytecode),
+ m_reflection(NULL)
 {
   m_bytecode.pShaderBytecode = bytecode;
   m_bytecode.BytecodeLength = len;
@@ -51,10 +62,24 @@ D3D12_Shader::D3D12_Shader(const char* bytecode, size_t len)
 
 D3D12_Shader::~D3D12_Shader()
 {
-  delete[] m_bytecode.pShaderBytecode;
+  delete m_reflection;
+  if (m_owns_bytecode)
+  {
+    delete[] (const char*)m_bytecode.pShaderBytecode;
+  }
 }
 
 const D3D12_SHADER_BYTECODE& D3D12_Shader::GetShader() const
 {
   return m_bytecode;
 }
+
+const ShaderReflection& D3D12_Shader::GetReflection() const
+{
+  lock_guard<mutex> lock(m_reflection_lock);
+  if (m_reflection == NULL)
+  {
+    m_reflection = ShaderReflection::Parse(m_bytecode.pShaderBytecode, m_bytecode.BytecodeLength);
+  }
+  return *m_reflection;
+}
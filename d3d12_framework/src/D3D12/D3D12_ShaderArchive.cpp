@@ -0,0 +1,102 @@
+#include <sstream>
+#include "private_inc/D3D12/D3D12_ShaderArchive.h"
+#include "private_inc/D3D12/D3D12_Shader.h"
+#include "FrameworkException.h"
+using namespace std;
+
+D3D12_ShaderArchive* D3D12_ShaderArchive::Open(const char* path)
+{
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ostringstream out;
+    out << "Unable to open \"" << path << "\". Error code: " << GetLastError();
+    throw FrameworkException(out.str());
+  }
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG)sizeof(ShaderArchiveHeader) || file_size.QuadPart > UINT_MAX)
+  {
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" is not a shader archive";
+    throw FrameworkException(out.str());
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  const UINT8* data = (const UINT8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map a view of \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  // validate everything up front so lookups can trust the index
+  const char* error = ShaderArchiveFormat::Validate(data, (UINT64)file_size.QuadPart);
+  if (error != NULL)
+  {
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" " << error;
+    throw FrameworkException(out.str());
+  }
+
+  return new D3D12_ShaderArchive(file, mapping, data);
+}
+
+D3D12_ShaderArchive::D3D12_ShaderArchive(HANDLE file, HANDLE mapping, const UINT8* data)
+:m_file(file),
+ m_mapping(mapping),
+ m_data(data),
+ m_num_entries(((const ShaderArchiveHeader*)data)->num_entries)
+{
+}
+
+D3D12_ShaderArchive::~D3D12_ShaderArchive()
+{
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  CloseHandle(m_file);
+}
+
+Shader* D3D12_ShaderArchive::LoadShader(const char* name) const
+{
+  const ShaderArchiveEntry* entry = ShaderArchiveFormat::Find(m_data, name);
+  if (entry == NULL)
+  {
+    ostringstream out;
+    out << "Shader archive does not contain \"" << name << '\"';
+    throw FrameworkException(out.str());
+  }
+
+  return D3D12_Shader::CreateFromMemory(m_data + entry->data_offset, entry->data_size);
+}
+
+bool D3D12_ShaderArchive::Contains(const char* name) const
+{
+  return ShaderArchiveFormat::Find(m_data, name) != NULL;
+}
+
+UINT D3D12_ShaderArchive::GetNumShaders() const
+{
+  return m_num_entries;
+}
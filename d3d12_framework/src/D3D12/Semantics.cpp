@@ -1,4 +1,7 @@
+#include <string.h>
 #include "Graphics/Semantics.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
 
 const char* GetSemanticName(Semantics sem)
 {
@@ -42,6 +45,27 @@ const char* GetSemanticName(Semantics sem)
     "SV_PrimitiveID",
     "SV_VertexID"
   };
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if ((unsigned)sem >= sizeof(convert) / sizeof(convert[0]))
+  {
+    throw FrameworkException("Unknown semantic");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
   
   return convert[sem];
 }
+
+bool GetSemanticFromName(const char* name, Semantics& sem)
+{
+  for (int i = SEM_BINORMAL; i <= SEM_SV_VERTEXID; i++)
+  {
+    if (_stricmp(name, GetSemanticName((Semantics)i)) == 0)
+    {
+      sem = (Semantics)i;
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -1,6 +1,7 @@
 #include "private_inc/D3D12/Textures/D3D12_Texture.h"
 #include "private_inc/D3D12/D3D12_Core.h"
 #include "private_inc/D3D12/D3D12_ShaderResourceDescHeap.h"
+#include "Graphics/Textures/BlockCompressor.h"
 #include "private_inc/BuildSettings.h"
 #include "FrameworkException.h"
 
@@ -14,6 +15,10 @@ D3D12_Texture::CreatedTexture D3D12_Texture::Create(const GraphicsCore& graphics
     // D3D12_TextureUploadBuffer relies on a non-zero number of mipmap levels to determine the subresource index
     throw FrameworkException("The number of mipmap levels cannot be 0");
   }
+  if (BlockCompressor::IsBlockCompressed(format) && (width % BlockCompressor::BLOCK_DIM != 0 || height % BlockCompressor::BLOCK_DIM != 0))
+  {
+    throw FrameworkException("The width and height of block compressed textures must be multiples of 4");
+  }
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   const D3D12_Core& core = (const D3D12_Core&)graphics;
@@ -50,7 +55,7 @@ D3D12_Texture::CreatedTexture D3D12_Texture::Create(const GraphicsCore& graphics
   resource_desc.Format             = (DXGI_FORMAT)format;
   resource_desc.SampleDesc.Count   = 1;
   resource_desc.SampleDesc.Quality = 0;
-  resource_desc.Layout             = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+  resource_desc.Layout             = reserved ? D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE : D3D12_TEXTURE_LAYOUT_UNKNOWN;
   resource_desc.Flags              = flags;
 
   D3D12_HEAP_PROPERTIES heap_prop;
@@ -72,7 +77,15 @@ D3D12_Texture::CreatedTexture D3D12_Texture::Create(const GraphicsCore& graphics
   }
 
   ID3D12Resource* buffer;
-  HRESULT rc = device->CreateCommittedResource(&heap_prop, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ, clear_value, __uuidof(ID3D12Resource), (void**)&buffer);
+  HRESULT rc;
+  if (reserved)
+  {
+    rc = device->CreateReservedResource(&resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ, clear_value, __uuidof(ID3D12Resource), (void**)&buffer);
+  }
+  else
+  {
+    rc = device->CreateCommittedResource(&heap_prop, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ, clear_value, __uuidof(ID3D12Resource), (void**)&buffer);
+  }
   delete clear_value;
   if (FAILED(rc))
   {
@@ -136,5 +149,5 @@ D3D12_Texture::CreatedTexture D3D12_Texture::Create(const GraphicsCore& graphics
   }
   device->CreateShaderResourceView(buffer, &src_desc, cpu_handle);
 
-  return { buffer, gpu_handle };
+  return { buffer, gpu_handle, cpu_handle };
 }
@@ -1,15 +1,23 @@
 #include "private_inc/D3D12/Textures/D3D12_Texture2D.h"
 #include "private_inc/D3D12/Textures/D3D12_Texture.h"
+#include "private_inc/D3D12/D3D12_Core.h"
 
 Texture2D* D3D12_Texture2D::Create(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, GraphicsDataFormat format, UINT16 mip_levels)
 {
   D3D12_Texture::CreatedTexture tex = D3D12_Texture::Create(graphics, shader_buffer_heap, width, height, 1, format, D3D12_SRV_DIMENSION_TEXTURE2D, D3D12_RESOURCE_FLAG_NONE, mip_levels);
-  return new D3D12_Texture2D(tex.buffer, tex.gpu_handle, width, height, format, mip_levels);
+  return new D3D12_Texture2D(tex.buffer, tex.gpu_handle, tex.cpu_handle, width, height, format, mip_levels);
 }
 
-D3D12_Texture2D::D3D12_Texture2D(ID3D12Resource* buffer, D3D12_GPU_DESCRIPTOR_HANDLE gpu_mem, UINT width, UINT height, GraphicsDataFormat format, UINT16 num_mip_levels)
+D3D12_Texture2D* D3D12_Texture2D::CreateReserved(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, GraphicsDataFormat format, UINT16 mip_levels)
+{
+  D3D12_Texture::CreatedTexture tex = D3D12_Texture::Create(graphics, shader_buffer_heap, width, height, 1, format, D3D12_SRV_DIMENSION_TEXTURE2D, D3D12_RESOURCE_FLAG_NONE, mip_levels, true);
+  return new D3D12_Texture2D(tex.buffer, tex.gpu_handle, tex.cpu_handle, width, height, format, mip_levels);
+}
+
+D3D12_Texture2D::D3D12_Texture2D(ID3D12Resource* buffer, D3D12_GPU_DESCRIPTOR_HANDLE gpu_mem, D3D12_CPU_DESCRIPTOR_HANDLE cpu_mem, UINT width, UINT height, GraphicsDataFormat format, UINT16 num_mip_levels)
 :m_buffer(buffer),
  m_gpu_mem(gpu_mem),
+ m_cpu_mem(cpu_mem),
  m_width(width),
  m_height(height),
  m_format(format),
@@ -36,3 +44,18 @@ UINT16 D3D12_Texture2D::GetNumMipmapLevels() const
 {
   return m_num_mipmap_levels;
 }
+
+void D3D12_Texture2D::SetMinLOD(const GraphicsCore& graphics, float min_lod)
+{
+  D3D12_SHADER_RESOURCE_VIEW_DESC src_desc;
+  src_desc.Format                        = (DXGI_FORMAT)m_format;
+  src_desc.ViewDimension                 = D3D12_SRV_DIMENSION_TEXTURE2D;
+  src_desc.Shader4ComponentMapping       = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+  src_desc.Texture2D.MostDetailedMip     = 0;
+  src_desc.Texture2D.MipLevels           = m_num_mipmap_levels;
+  src_desc.Texture2D.PlaneSlice          = 0;
+  src_desc.Texture2D.ResourceMinLODClamp = min_lod;
+
+  ID3D12Device* device = ((const D3D12_Core&)graphics).GetDevice();
+  device->CreateShaderResourceView(m_buffer, &src_desc, m_cpu_mem);
+}
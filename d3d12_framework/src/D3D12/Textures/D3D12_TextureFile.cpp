@@ -0,0 +1,289 @@
+#include <sstream>
+#include "private_inc/D3D12/Textures/D3D12_TextureFile.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureUploadBuffer.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture1D.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture2D.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture3D.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture1DArray.h"
+#include "private_inc/D3D12/Textures/D3D12_Texture2DArray.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureCube.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureCubeArray.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Names of the texture types for error messages, indexed by TextureFileType
+/// </summary>
+static const char* TYPE_NAMES[] =
+{
+  "1D texture",
+  "1D texture array",
+  "2D texture",
+  "2D texture array",
+  "3D texture",
+  "texture cube",
+  "texture cube array"
+};
+
+D3D12_TextureFile* D3D12_TextureFile::Open(const char* path)
+{
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ostringstream out;
+    out << "Unable to open \"" << path << "\". Error code: " << GetLastError();
+    throw FrameworkException(out.str());
+  }
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < (LONGLONG)sizeof(UINT))
+  {
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" is not a DDS or KTX2 file";
+    throw FrameworkException(out.str());
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  const UINT8* data = (const UINT8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL)
+  {
+    DWORD err = GetLastError();
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "Unable to map a view of \"" << path << "\". Error code: " << err;
+    throw FrameworkException(out.str());
+  }
+
+  // validate everything up front so the subresources can be copied without further checks
+  TextureFileLayout layout;
+  const char* error = TextureFileFormat::Parse(data, (UINT64)file_size.QuadPart, layout);
+  if (error != NULL)
+  {
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    ostringstream out;
+    out << "\"" << path << "\" " << error;
+    throw FrameworkException(out.str());
+  }
+
+  return new D3D12_TextureFile(file, mapping, data, layout);
+}
+
+D3D12_TextureFile::D3D12_TextureFile(HANDLE file, HANDLE mapping, const UINT8* data, const TextureFileLayout& layout)
+:m_file(file),
+ m_mapping(mapping),
+ m_data(data),
+ m_layout(layout)
+{
+}
+
+D3D12_TextureFile::~D3D12_TextureFile()
+{
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  CloseHandle(m_file);
+}
+
+TextureFileType D3D12_TextureFile::GetType() const
+{
+  return m_layout.type;
+}
+
+GraphicsDataFormat D3D12_TextureFile::GetFormat() const
+{
+  return m_layout.format;
+}
+
+UINT D3D12_TextureFile::GetWidth() const
+{
+  return m_layout.width;
+}
+
+UINT D3D12_TextureFile::GetHeight() const
+{
+  return m_layout.height;
+}
+
+UINT16 D3D12_TextureFile::GetDepth() const
+{
+  return m_layout.depth;
+}
+
+UINT16 D3D12_TextureFile::GetArraySize() const
+{
+  return m_layout.array_size;
+}
+
+UINT16 D3D12_TextureFile::GetNumMipmapLevels() const
+{
+  return m_layout.mip_levels;
+}
+
+TextureFileSubresource D3D12_TextureFile::GetSubresource(UINT index, UINT16 mip_level) const
+{
+  UINT num_slices = (UINT)m_layout.subresources.size() / m_layout.mip_levels;
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= num_slices || mip_level >= m_layout.mip_levels)
+  {
+    ostringstream out;
+    out << "Subresource " << index << ", mipmap level " << mip_level << " is out of range, only " << num_slices << " textures with " << m_layout.mip_levels
+        << " mipmap levels";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return m_layout.subresources[index * m_layout.mip_levels + mip_level];
+}
+
+Texture1D* D3D12_TextureFile::CreateTexture1D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_1D);
+  return Texture1D::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.format, m_layout.mip_levels);
+}
+
+Texture1DArray* D3D12_TextureFile::CreateTexture1DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_1D_ARRAY);
+  return Texture1DArray::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.array_size, m_layout.format, m_layout.mip_levels);
+}
+
+Texture2D* D3D12_TextureFile::CreateTexture2D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_2D);
+  return Texture2D::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.height, m_layout.format, m_layout.mip_levels);
+}
+
+Texture2DArray* D3D12_TextureFile::CreateTexture2DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_2D_ARRAY);
+  return Texture2DArray::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.height, m_layout.array_size, m_layout.format, m_layout.mip_levels);
+}
+
+Texture3D* D3D12_TextureFile::CreateTexture3D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_3D);
+  return Texture3D::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.height, m_layout.depth, m_layout.format, m_layout.mip_levels);
+}
+
+TextureCube* D3D12_TextureFile::CreateTextureCube(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_CUBE);
+  return TextureCube::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.height, m_layout.format, m_layout.mip_levels);
+}
+
+TextureCubeArray* D3D12_TextureFile::CreateTextureCubeArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  CheckType(TEXTURE_FILE_CUBE_ARRAY);
+  return TextureCubeArray::CreateD3D12(graphics, shader_buffer_heap, m_layout.width, m_layout.height, m_layout.array_size, m_layout.format, m_layout.mip_levels);
+}
+
+TextureUploadBuffer* D3D12_TextureFile::CreateUploadBuffer(const GraphicsCore& graphics) const
+{
+  return D3D12_TextureUploadBuffer::CreateForAllSubresources(graphics, GetResourceDesc());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1D& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_Texture1D&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture1DArray& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_Texture1DArray&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2D& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_Texture2D&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture2DArray& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_Texture2DArray&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, Texture3D& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_Texture3D&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCube& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_TextureCube&)texture).GetResource());
+}
+
+void D3D12_TextureFile::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, TextureCubeArray& texture) const
+{
+  PrepUploadInternal(graphics, command_list, upload_buffer, ((D3D12_TextureCubeArray&)texture).GetResource());
+}
+
+void D3D12_TextureFile::CheckType(TextureFileType type) const
+{
+  if (m_layout.type != type)
+  {
+    ostringstream out;
+    out << "Unable to create a " << TYPE_NAMES[type] << " from a texture file that holds a " << TYPE_NAMES[m_layout.type];
+    throw FrameworkException(out.str());
+  }
+}
+
+D3D12_RESOURCE_DESC D3D12_TextureFile::GetResourceDesc() const
+{
+  D3D12_RESOURCE_DESC resource_desc;
+  resource_desc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+  resource_desc.Width              = m_layout.width;
+  resource_desc.Height             = m_layout.height;
+  resource_desc.DepthOrArraySize   = (UINT16)(m_layout.subresources.size() / m_layout.mip_levels);
+  resource_desc.MipLevels          = m_layout.mip_levels;
+  resource_desc.Format             = (DXGI_FORMAT)m_layout.format;
+  resource_desc.SampleDesc.Count   = 1;
+  resource_desc.SampleDesc.Quality = 0;
+  resource_desc.Layout             = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+  resource_desc.Flags              = D3D12_RESOURCE_FLAG_NONE;
+
+  if (m_layout.type == TEXTURE_FILE_1D || m_layout.type == TEXTURE_FILE_1D_ARRAY)
+  {
+    resource_desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE1D;
+  }
+  else if (m_layout.type == TEXTURE_FILE_3D)
+  {
+    resource_desc.Dimension        = D3D12_RESOURCE_DIMENSION_TEXTURE3D;
+    resource_desc.DepthOrArraySize = m_layout.depth;
+  }
+  else
+  {
+    resource_desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+  }
+  return resource_desc;
+}
+
+void D3D12_TextureFile::PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, TextureUploadBuffer& upload_buffer, ID3D12Resource* texture) const
+{
+  D3D12_RESOURCE_DESC file_desc    = GetResourceDesc();
+  D3D12_RESOURCE_DESC texture_desc = texture->GetDesc();
+  if (texture_desc.Dimension != file_desc.Dimension || texture_desc.Width != file_desc.Width || texture_desc.Height != file_desc.Height ||
+      texture_desc.DepthOrArraySize != file_desc.DepthOrArraySize || texture_desc.MipLevels != file_desc.MipLevels || texture_desc.Format != file_desc.Format)
+  {
+    throw FrameworkException("Texture does not match the size, format and mipmap levels of the texture file");
+  }
+
+  ((D3D12_TextureUploadBuffer&)upload_buffer).PrepUploadSubresources(graphics, command_list, texture, m_layout.subresources);
+}
@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <sstream>
+#include "private_inc/D3D12/Textures/D3D12_TextureStreamer.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureUploadBuffer.h"
+#include "private_inc/BuildSettings.h"
+#include "Graphics/Textures/TexelCopy.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Number of bytes in each tile of a reserved resource
+/// </summary>
+static const UINT64 TILE_SIZE = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+
+D3D12_TextureStreamer* D3D12_TextureStreamer::Create(GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget)
+{
+  D3D12_Core& core = (D3D12_Core&)graphics;
+
+  D3D12_FEATURE_DATA_D3D12_OPTIONS options;
+  HRESULT rc = core.GetDevice()->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options));
+  if (FAILED(rc) || options.TiledResourcesTier == D3D12_TILED_RESOURCES_TIER_NOT_SUPPORTED)
+  {
+    throw FrameworkException("Texture streaming needs a device that supports tiled resources");
+  }
+
+  return new D3D12_TextureStreamer(core, shader_buffer_heap, memory_budget, upload_budget);
+}
+
+D3D12_TextureStreamer::D3D12_TextureStreamer(D3D12_Core& core, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget)
+:m_core(core),
+ m_shader_buffer_heap(shader_buffer_heap),
+ m_policy(memory_budget, upload_budget),
+ m_has_prepared(false)
+{
+}
+
+D3D12_TextureStreamer::~D3D12_TextureStreamer()
+{
+  if (m_has_prepared)
+  {
+    ReleaseBatch(m_prepared);
+  }
+  for (deque<Batch>::iterator it = m_in_flight.begin(); it != m_in_flight.end(); ++it)
+  {
+    ReleaseBatch(*it);
+  }
+  for (vector<UploadBuffer>::iterator it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+  {
+    it->resource->Release();
+  }
+
+  for (vector<StreamedTexture>::iterator it = m_textures.begin(); it != m_textures.end(); ++it)
+  {
+    delete it->texture;
+    for (vector<ID3D12Heap*>::iterator heap = it->heaps.begin(); heap != it->heaps.end(); ++heap)
+    {
+      if (*heap != NULL)
+      {
+        (*heap)->Release();
+      }
+    }
+    it->tail_heap->Release();
+  }
+}
+
+UINT D3D12_TextureStreamer::AddTexture(const TextureFile& file)
+{
+  if (file.GetType() != TEXTURE_FILE_2D)
+  {
+    throw FrameworkException("Only 2D textures can be streamed");
+  }
+
+  UINT16           num_levels = file.GetNumMipmapLevels();
+  D3D12_Texture2D* texture    = D3D12_Texture2D::CreateReserved(m_core, m_shader_buffer_heap, file.GetWidth(), file.GetHeight(), file.GetFormat(), num_levels);
+  ID3D12Heap*      tail_heap  = NULL;
+  try
+  {
+    UINT                                num_tiles;
+    D3D12_PACKED_MIP_INFO               packed_mip_info;
+    D3D12_TILE_SHAPE                    tile_shape;
+    UINT                                num_tilings = num_levels;
+    vector<D3D12_SUBRESOURCE_TILING>    tilings(num_levels);
+    m_core.GetDevice()->GetResourceTiling(texture->GetResource(), &num_tiles, &packed_mip_info, &tile_shape, &num_tilings, 0, &tilings[0]);
+
+    // levels too small to be tiled are packed together into the tail.  Without any, the least detailed level is the
+    // tail, so there is always something to sample
+    StreamedTexture streamed;
+    streamed.file         = &file;
+    streamed.texture      = texture;
+    streamed.num_streamed = (packed_mip_info.NumPackedMips > 0) ? packed_mip_info.NumStandardMips : num_levels - 1;
+    UINT tail_tiles       = (packed_mip_info.NumPackedMips > 0) ? packed_mip_info.NumTilesForPackedMips :
+                            tilings[num_levels - 1].WidthInTiles * tilings[num_levels - 1].HeightInTiles * tilings[num_levels - 1].DepthInTiles;
+
+    vector<UINT64> level_sizes(num_levels, 0);
+    for (UINT16 level = 0; level < streamed.num_streamed; level++)
+    {
+      UINT level_tiles = tilings[level].WidthInTiles * tilings[level].HeightInTiles * tilings[level].DepthInTiles;
+      streamed.level_tiles.push_back(level_tiles);
+      level_sizes[level] = level_tiles * TILE_SIZE;
+    }
+    level_sizes[streamed.num_streamed] = tail_tiles * TILE_SIZE;
+    streamed.heaps.resize(streamed.num_streamed, NULL);
+
+    tail_heap = CreateHeap(tail_tiles);
+    MapTiles(texture->GetResource(), streamed.num_streamed, tail_tiles, tail_heap);
+    streamed.tail_heap = tail_heap;
+    texture->SetMinLOD(m_core, streamed.num_streamed);
+
+    UINT index = m_policy.AddTexture(file.GetWidth(), file.GetHeight(), level_sizes, streamed.num_streamed);
+    m_textures.push_back(streamed);
+    for (UINT16 level = streamed.num_streamed; level < num_levels; level++)
+    {
+      MipStreamingAction upload = { index, level };
+      m_tail_uploads.push_back(upload);
+    }
+    return index;
+  }
+  catch (...)
+  {
+    if (tail_heap != NULL)
+    {
+      tail_heap->Release();
+    }
+    delete texture;
+    throw;
+  }
+}
+
+const Texture2D& D3D12_TextureStreamer::GetTexture(UINT texture) const
+{
+  return *m_textures[texture].texture;
+}
+
+MipStreamingPolicy& D3D12_TextureStreamer::GetPolicy()
+{
+  return m_policy;
+}
+
+void D3D12_TextureStreamer::PrepUpdate(CommandList& command_list)
+{
+  if (m_has_prepared)
+  {
+    throw FrameworkException("The previous texture streaming update was not submitted");
+  }
+
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  m_policy.Schedule(uploads, evictions);
+  if (uploads.empty() && evictions.empty() && m_tail_uploads.empty())
+  {
+    return;
+  }
+
+  // the batch holds the heaps and buffer from here on, so they are released even if a later step fails
+  m_prepared.uploads                  = uploads;
+  m_prepared.evicted_heaps.clear();
+  m_prepared.upload_buffer.resource   = NULL;
+  m_prepared.upload_buffer.size       = 0;
+  m_prepared.fence                    = 0;
+  m_has_prepared                      = true;
+
+  // clamping the view before unmapping keeps this frame from sampling the level.  Earlier frames are ahead of the
+  // unmap on the command queue, but may still be using the heap until the batch completes
+  for (vector<MipStreamingAction>::const_iterator it = evictions.begin(); it != evictions.end(); ++it)
+  {
+    StreamedTexture& streamed = m_textures[it->texture];
+    streamed.texture->SetMinLOD(m_core, m_policy.GetResidentLevel(it->texture));
+    MapTiles(streamed.texture->GetResource(), it->mip_level, streamed.level_tiles[it->mip_level], NULL);
+    m_prepared.evicted_heaps.push_back(streamed.heaps[it->mip_level]);
+    streamed.heaps[it->mip_level] = NULL;
+  }
+
+  for (vector<MipStreamingAction>::const_iterator it = uploads.begin(); it != uploads.end(); ++it)
+  {
+    StreamedTexture& streamed = m_textures[it->texture];
+    ID3D12Heap* heap = CreateHeap(streamed.level_tiles[it->mip_level]);
+    streamed.heaps[it->mip_level] = heap;
+    MapTiles(streamed.texture->GetResource(), it->mip_level, streamed.level_tiles[it->mip_level], heap);
+  }
+
+  vector<MipStreamingAction> copies(m_tail_uploads);
+  copies.insert(copies.end(), uploads.begin(), uploads.end());
+  m_tail_uploads.clear();
+  if (copies.empty())
+  {
+    return;
+  }
+
+  ID3D12Device*                             device = m_core.GetDevice();
+  vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(copies.size());
+  vector<UINT>                              num_rows(copies.size());
+  vector<UINT64>                            row_sizes(copies.size());
+  UINT64                                    buffer_size = 0;
+  for (size_t i = 0; i < copies.size(); i++)
+  {
+    D3D12_RESOURCE_DESC desc = m_textures[copies[i].texture].texture->GetResource()->GetDesc();
+    UINT64 num_bytes;
+    device->GetCopyableFootprints(&desc, copies[i].mip_level, 1, 0, &layouts[i], &num_rows[i], &row_sizes[i], &num_bytes);
+
+    buffer_size = (buffer_size + D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT - 1) / D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT * D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+    layouts[i].Offset = buffer_size;
+    buffer_size += num_bytes;
+  }
+
+  m_prepared.upload_buffer = AcquireUploadBuffer(buffer_size);
+  ID3D12Resource* buffer = m_prepared.upload_buffer.resource;
+
+  UINT8* cpu_mem_start;
+  HRESULT rc = buffer->Map(0, NULL, (void**)&cpu_mem_start);
+  if (FAILED(rc))
+  {
+    throw FrameworkException("Failed to map texture streaming upload buffer memory");
+  }
+  for (size_t i = 0; i < copies.size(); i++)
+  {
+    TextureFileSubresource src = m_textures[copies[i].texture].file->GetSubresource(0, copies[i].mip_level);
+    TexelCopy::CopyRows(cpu_mem_start + layouts[i].Offset, layouts[i].Footprint.RowPitch, (SIZE_T)layouts[i].Footprint.RowPitch * num_rows[i], src.data,
+      src.row_pitch, src.slice_pitch, (UINT)row_sizes[i], num_rows[i]);
+  }
+  buffer->Unmap(0, NULL);
+
+  for (size_t i = 0; i < copies.size(); i++)
+  {
+    D3D12_TextureUploadBuffer::RecordUpload(command_list, buffer, m_textures[copies[i].texture].texture->GetResource(), copies[i].mip_level, layouts[i]);
+  }
+}
+
+void D3D12_TextureStreamer::Submit()
+{
+  if (m_has_prepared)
+  {
+    m_prepared.fence = m_core.SignalFence();
+    m_in_flight.push_back(m_prepared);
+    m_has_prepared = false;
+  }
+}
+
+UINT D3D12_TextureStreamer::Poll()
+{
+  UINT64 completed = m_core.GetCompletedFenceValue();
+  UINT   resident  = 0;
+  while (!m_in_flight.empty() && m_in_flight.front().fence <= completed)
+  {
+    // take the batch off the queue before using it, so an exception does not complete it twice
+    Batch batch = m_in_flight.front();
+    m_in_flight.pop_front();
+    for (vector<ID3D12Heap*>::iterator heap = batch.evicted_heaps.begin(); heap != batch.evicted_heaps.end(); ++heap)
+    {
+      (*heap)->Release();
+    }
+    if (batch.upload_buffer.resource != NULL)
+    {
+      m_free_buffers.push_back(batch.upload_buffer);
+    }
+
+    for (vector<MipStreamingAction>::const_iterator it = batch.uploads.begin(); it != batch.uploads.end(); ++it)
+    {
+      m_policy.OnUploaded(*it);
+      m_textures[it->texture].texture->SetMinLOD(m_core, m_policy.GetResidentLevel(it->texture));
+      resident++;
+    }
+  }
+  return resident;
+}
+
+ID3D12Heap* D3D12_TextureStreamer::CreateHeap(UINT num_tiles)
+{
+  D3D12_HEAP_DESC heap_desc;
+  heap_desc.SizeInBytes                     = num_tiles * TILE_SIZE;
+  heap_desc.Properties.Type                 = D3D12_HEAP_TYPE_DEFAULT;
+  heap_desc.Properties.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+  heap_desc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+  heap_desc.Properties.CreationNodeMask     = 0;
+  heap_desc.Properties.VisibleNodeMask      = 0;
+  heap_desc.Alignment                       = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+  heap_desc.Flags                           = D3D12_HEAP_FLAG_DENY_BUFFERS | D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES;
+
+  ID3D12Heap* heap;
+  HRESULT rc = m_core.GetDevice()->CreateHeap(&heap_desc, __uuidof(ID3D12Heap), (void**)&heap);
+  if (FAILED(rc))
+  {
+    ostringstream out;
+    out << "Unable to create texture streaming heap of " << num_tiles << " tiles.  HRESULT = " << rc;
+    throw FrameworkException(out.str());
+  }
+  return heap;
+}
+
+void D3D12_TextureStreamer::MapTiles(ID3D12Resource* texture, UINT subresource, UINT num_tiles, ID3D12Heap* heap)
+{
+  D3D12_TILED_RESOURCE_COORDINATE coordinate;
+  coordinate.X           = 0;
+  coordinate.Y           = 0;
+  coordinate.Z           = 0;
+  coordinate.Subresource = subresource;
+
+  D3D12_TILE_REGION_SIZE region_size;
+  region_size.NumTiles = num_tiles;
+  region_size.UseBox   = FALSE;
+  region_size.Width    = 0;
+  region_size.Height   = 0;
+  region_size.Depth    = 0;
+
+  D3D12_TILE_RANGE_FLAGS range_flags = (heap != NULL) ? D3D12_TILE_RANGE_FLAG_NONE : D3D12_TILE_RANGE_FLAG_NULL;
+  UINT                   heap_offset = 0;
+  m_core.GetCommandQueue()->UpdateTileMappings(texture, 1, &coordinate, &region_size, heap, 1, &range_flags, &heap_offset, &num_tiles,
+    D3D12_TILE_MAPPING_FLAG_NONE);
+}
+
+D3D12_TextureStreamer::UploadBuffer D3D12_TextureStreamer::AcquireUploadBuffer(UINT64 size)
+{
+  vector<UploadBuffer>::iterator best = m_free_buffers.end();
+  for (vector<UploadBuffer>::iterator it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+  {
+    if (it->size >= size && (best == m_free_buffers.end() || it->size < best->size))
+    {
+      best = it;
+    }
+  }
+  if (best != m_free_buffers.end())
+  {
+    UploadBuffer buffer = *best;
+    m_free_buffers.erase(best);
+    return buffer;
+  }
+
+  // every free buffer is too small, so replace them rather than letting the pool grow
+  for (vector<UploadBuffer>::iterator it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+  {
+    it->resource->Release();
+  }
+  m_free_buffers.clear();
+
+  D3D12_RESOURCE_DESC resource_desc;
+  resource_desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
+  resource_desc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+  resource_desc.Width              = (size + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE;
+  resource_desc.Height             = 1;
+  resource_desc.DepthOrArraySize   = 1;
+  resource_desc.MipLevels          = 1;
+  resource_desc.Format             = DXGI_FORMAT_UNKNOWN;
+  resource_desc.SampleDesc.Count   = 1;
+  resource_desc.SampleDesc.Quality = 0;
+  resource_desc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+  resource_desc.Flags              = D3D12_RESOURCE_FLAG_NONE;
+
+  D3D12_HEAP_PROPERTIES heap_prop;
+  heap_prop.Type                 = D3D12_HEAP_TYPE_UPLOAD;
+  heap_prop.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+  heap_prop.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+  heap_prop.CreationNodeMask     = 0;
+  heap_prop.VisibleNodeMask      = 0;
+
+  UploadBuffer buffer;
+  buffer.size = resource_desc.Width;
+  HRESULT rc = m_core.GetDevice()->CreateCommittedResource(&heap_prop, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ, NULL,
+    __uuidof(ID3D12Resource), (void**)&buffer.resource);
+  if (FAILED(rc))
+  {
+    throw FrameworkException("Unable to create texture streaming upload buffer");
+  }
+  return buffer;
+}
+
+void D3D12_TextureStreamer::ReleaseBatch(Batch& batch)
+{
+  for (vector<ID3D12Heap*>::iterator heap = batch.evicted_heaps.begin(); heap != batch.evicted_heaps.end(); ++heap)
+  {
+    (*heap)->Release();
+  }
+  if (batch.upload_buffer.resource != NULL)
+  {
+    batch.upload_buffer.resource->Release();
+  }
+}
@@ -1,3 +1,5 @@
+#include <limits.h>
+#include <sstream>
 #include "private_inc/D3D12/Textures/D3D12_TextureUploadBuffer.h"
 #include "private_inc/D3D12/D3D12_Core.h"
 #include "private_inc/D3D12/D3D12_CommandList.h"
@@ -10,6 +12,8 @@
 #include "private_inc/D3D12/Textures/D3D12_TextureCubeArray.h"
 #include "private_inc/D3D12/D3D12_Core.h"
 #include "private_inc/BuildSettings.h"
+#include "Graphics/Textures/TexelCopy.h"
+#include "Graphics/Textures/BlockCompressor.h"
 #include "FrameworkException.h"
 using namespace std;
 
@@ -56,6 +60,11 @@ TextureUploadBuffer* D3D12_TextureUploadBuffer::Create(const GraphicsCore& graph
   return D3D12_TextureUploadBuffer::CreateInternal(graphics, resource_desc);
 }
 
+TextureUploadBuffer* D3D12_TextureUploadBuffer::CreateForAllSubresources(const GraphicsCore& graphics, const D3D12_RESOURCE_DESC& resource_desc)
+{
+  return D3D12_TextureUploadBuffer::CreateInternal(graphics, resource_desc);
+}
+
 D3D12_TextureUploadBuffer::D3D12_TextureUploadBuffer(ID3D12Resource* buffer)
 :m_buffer(buffer)
 {
@@ -66,7 +75,7 @@ D3D12_TextureUploadBuffer::~D3D12_TextureUploadBuffer()
   m_buffer->Release();
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_Texture1D& tex = (D3D12_Texture1D&)texture;
 
@@ -78,10 +87,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_Texture2D& tex = (D3D12_Texture2D&)texture;
 
@@ -93,10 +102,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_Texture3D& tex = (D3D12_Texture3D&)texture;
 
@@ -108,10 +117,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_Texture1DArray& tex = (D3D12_Texture1DArray&)texture;
   UINT16 num_mip_levels = tex.GetNumMipmapLevels();
@@ -124,10 +133,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_Texture2DArray& tex = (D3D12_Texture2DArray&)texture;
   UINT16 num_mip_levels = tex.GetNumMipmapLevels();
@@ -140,10 +149,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_TextureCube& tex = (D3D12_TextureCube&)texture;
   UINT16 num_mip_levels = tex.GetNumMipmapLevels();
@@ -161,10 +170,10 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, index * num_mip_levels + (UINT)mip_level, data, conversion);
 }
 
-void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const vector<UINT8>& data, UINT16 mip_level)
+void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const vector<UINT8>& data, UINT16 mip_level, TexelConversion conversion)
 {
   D3D12_TextureCubeArray& tex = (D3D12_TextureCubeArray&)texture;
   UINT16 num_mip_levels = tex.GetNumMipmapLevels();
@@ -183,7 +192,126 @@ void D3D12_TextureUploadBuffer::PrepUpload(GraphicsCore& graphics, CommandList&
 #endif /* VALIDATE_FUNCTION_ARGUMENTS */
 
   ID3D12Resource* dst_texture = tex.GetResource();
-  PrepUploadInternal(graphics, command_list, dst_texture, cube_index * subresources_per_cube + side_index * num_mip_levels + (UINT)mip_level, data);
+  PrepUploadInternal(graphics, command_list, dst_texture, cube_index * subresources_per_cube + side_index * num_mip_levels + (UINT)mip_level, data, conversion);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1D& texture, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_Texture1D& tex = (D3D12_Texture1D&)texture;
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), 0, tex.GetNumMipmapLevels(), data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_Texture2D& tex = (D3D12_Texture2D&)texture;
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), 0, tex.GetNumMipmapLevels(), data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture3D& texture, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_Texture3D& tex = (D3D12_Texture3D&)texture;
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), 0, tex.GetNumMipmapLevels(), data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture1DArray& texture, UINT16 index, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_Texture1DArray& tex = (D3D12_Texture1DArray&)texture;
+  UINT16 num_mip_levels = tex.GetNumMipmapLevels();
+
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), index * num_mip_levels, num_mip_levels, data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, Texture2DArray& texture, UINT16 index, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_Texture2DArray& tex = (D3D12_Texture2DArray&)texture;
+  UINT16 num_mip_levels = tex.GetNumMipmapLevels();
+
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), index * num_mip_levels, num_mip_levels, data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCube& texture, UINT16 index, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_TextureCube& tex = (D3D12_TextureCube&)texture;
+  UINT16 num_mip_levels = tex.GetNumMipmapLevels();
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= 6)
+  {
+    throw FrameworkException("Invalid side index, must be in the range [0-5]");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), index * num_mip_levels, num_mip_levels, data, filter, edge_mode);
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMips(GraphicsCore& graphics, CommandList& command_list, TextureCubeArray& texture, UINT16 cube_index, UINT16 side_index, const vector<UINT8>& data, MipFilter filter, MipEdgeMode edge_mode)
+{
+  D3D12_TextureCubeArray& tex = (D3D12_TextureCubeArray&)texture;
+  UINT16 num_mip_levels = tex.GetNumMipmapLevels();
+  UINT16 subresources_per_cube = 6 * num_mip_levels;
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (side_index >= 6)
+  {
+    throw FrameworkException("Invalid side index, must be in the range [0-5]");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  PrepUploadMipsInternal(graphics, command_list, tex.GetResource(), cube_index * subresources_per_cube + side_index * num_mip_levels, num_mip_levels, data, filter, edge_mode);
+}
+
+void* D3D12_TextureUploadBuffer::Map(GraphicsCore& graphics, Texture2D& texture, UINT& row_pitch, UINT16 mip_level)
+{
+  D3D12_Texture2D& tex = (D3D12_Texture2D&)texture;
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (mip_level >= tex.GetNumMipmapLevels())
+  {
+    throw FrameworkException("Requested mipmap level is beyond the number of mipmap levels available in the resource");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  ID3D12Device*       device   = ((D3D12_Core&)graphics).GetDevice();
+  D3D12_RESOURCE_DESC dst_desc = tex.GetResource()->GetDesc();
+  D3D12_PLACED_SUBRESOURCE_FOOTPRINT dst_layout;
+  UINT64 dst_total_bytes;
+  device->GetCopyableFootprints(&dst_desc, mip_level, 1, 0, &dst_layout, NULL, NULL, &dst_total_bytes);
+
+  D3D12_RESOURCE_DESC src_desc = m_buffer->GetDesc();
+  if (src_desc.Width < (dst_total_bytes + dst_layout.Offset))
+  {
+    throw FrameworkException("Upload texture buffer too small for target texture");
+  }
+  else if (!TexelCopy::IsConversionSupported((GraphicsDataFormat)dst_desc.Format, conversion))
+  {
+    ostringstream out;
+    out << "Texel conversion " << conversion << " does not write texels of the target texture's format " << dst_desc.Format;
+    throw FrameworkException(out.str());
+  }
+
+  UINT8* cpu_mem_start;
+  HRESULT rc = m_buffer->Map(0, NULL, (void**)&cpu_mem_start);
+  if (FAILED(rc))
+  {
+    throw FrameworkException("Failed to map texture upload buffer memory");
+  }
+
+  row_pitch = dst_layout.Footprint.RowPitch;
+  return cpu_mem_start + dst_layout.Offset;
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadMapped(GraphicsCore& graphics, CommandList& command_list, Texture2D& texture, UINT16 mip_level)
+{
+  D3D12_Texture2D& tex = (D3D12_Texture2D&)texture;
+  ID3D12Resource*  dst_texture = tex.GetResource();
+
+  ID3D12Device*       device   = ((D3D12_Core&)graphics).GetDevice();
+  D3D12_RESOURCE_DESC dst_desc = dst_texture->GetDesc();
+  D3D12_PLACED_SUBRESOURCE_FOOTPRINT dst_layout;
+  device->GetCopyableFootprints(&dst_desc, mip_level, 1, 0, &dst_layout, NULL, NULL, NULL);
+
+  m_buffer->Unmap(0, NULL);
+  RecordUpload(command_list, m_buffer, dst_texture, mip_level, dst_layout);
 }
 
 TextureUploadBuffer* D3D12_TextureUploadBuffer::CreateInternal(const GraphicsCore& graphics, D3D12_RESOURCE_DESC resource_desc)
@@ -193,9 +321,18 @@ TextureUploadBuffer* D3D12_TextureUploadBuffer::CreateInternal(const GraphicsCor
 
   D3D12_RESOURCE_ALLOCATION_INFO alloc_info = device->GetResourceAllocationInfo(0, 1, &resource_desc);
 
+  // the row pitch and placement alignment of the copy footprints can need more room than the texture itself
+  UINT num_subresources = resource_desc.MipLevels;
+  if (resource_desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE3D)
+  {
+    num_subresources *= resource_desc.DepthOrArraySize;
+  }
+  UINT64 footprint_bytes;
+  device->GetCopyableFootprints(&resource_desc, 0, num_subresources, 0, NULL, NULL, NULL, &footprint_bytes);
+
   resource_desc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
   resource_desc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
-  resource_desc.Width              = alloc_info.SizeInBytes;
+  resource_desc.Width              = max(alloc_info.SizeInBytes, footprint_bytes);
   resource_desc.Height             = 1;
   resource_desc.DepthOrArraySize   = 1;
   resource_desc.MipLevels          = 1;
@@ -222,7 +359,7 @@ TextureUploadBuffer* D3D12_TextureUploadBuffer::CreateInternal(const GraphicsCor
   return new D3D12_TextureUploadBuffer(buffer);
 }
 
-void D3D12_TextureUploadBuffer::PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, const vector<UINT8>& data)
+void D3D12_TextureUploadBuffer::PrepUploadInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, const vector<UINT8>& data, TexelConversion conversion)
 {
   ID3D12Device*       device      = ((D3D12_Core&)graphics).GetDevice();
   D3D12_RESOURCE_DESC dst_desc    = texture->GetDesc();
@@ -232,18 +369,19 @@ void D3D12_TextureUploadBuffer::PrepUploadInternal(GraphicsCore& graphics, Comma
   UINT64 dst_total_bytes;
   device->GetCopyableFootprints(&dst_desc, index, 1, 0, &dst_layout, &dst_num_rows, &dst_row_size_in_bytes, &dst_total_bytes);
 
-  SIZE_T memcpy_size = (SIZE_T)dst_row_size_in_bytes;
-
   D3D12_RESOURCE_DESC src_desc = m_buffer->GetDesc();
   if (src_desc.Width < (dst_total_bytes + dst_layout.Offset))
   {
     throw FrameworkException("Upload texture buffer too small for target texture");
   }
-  else if (dst_row_size_in_bytes != memcpy_size)
+  else if (dst_row_size_in_bytes > UINT_MAX)
   {
     throw FrameworkException("Target texture row size too large for upload texture buffer");
   }
-  else if (data.size() < (memcpy_size * dst_num_rows * dst_layout.Footprint.Depth))
+
+  UINT   dst_row_size = (UINT)dst_row_size_in_bytes;
+  SIZE_T src_row_size = TexelCopy::GetSourceRowSize(dst_row_size, conversion);
+  if (data.size() < (src_row_size * dst_num_rows * dst_layout.Footprint.Depth))
   {
     throw FrameworkException("Insufficient number of bytes for upload texture buffer");
   }
@@ -255,22 +393,19 @@ void D3D12_TextureUploadBuffer::PrepUploadInternal(GraphicsCore& graphics, Comma
     throw FrameworkException("Failed to map texture upload buffer memory");
   }
   cpu_mem_start += dst_layout.Offset;
-  const UINT8* src_mem_start = &(data[0]);
-  for (UINT z = 0; z < dst_layout.Footprint.Depth; z++)
-  {
-    for (UINT row = 0; row < dst_num_rows; row++)
-    {
-      memcpy(cpu_mem_start, src_mem_start, memcpy_size);
-      cpu_mem_start += dst_layout.Footprint.RowPitch;
-      src_mem_start += memcpy_size;
-    }
-  }
+  TexelCopy::CopyRows(cpu_mem_start, dst_layout.Footprint.RowPitch, (SIZE_T)dst_layout.Footprint.RowPitch * dst_num_rows, &(data[0]), src_row_size,
+    src_row_size * dst_num_rows, dst_row_size, dst_num_rows, dst_layout.Footprint.Depth, conversion);
   m_buffer->Unmap(0, NULL);
 
+  RecordUpload(command_list, m_buffer, texture, index, dst_layout);
+}
+
+void D3D12_TextureUploadBuffer::RecordUpload(CommandList& command_list, ID3D12Resource* buffer, ID3D12Resource* texture, UINT index, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout)
+{
   D3D12_TEXTURE_COPY_LOCATION src;
-  src.pResource        = m_buffer;
+  src.pResource        = buffer;
   src.Type             = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-  src.PlacedFootprint  = dst_layout;
+  src.PlacedFootprint  = layout;
 
   D3D12_TEXTURE_COPY_LOCATION dst;
   dst.pResource        = texture;
@@ -298,3 +433,196 @@ void D3D12_TextureUploadBuffer::PrepUploadInternal(GraphicsCore& graphics, Comma
   done_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_GENERIC_READ;
   cmd_list->ResourceBarrier(1, &done_copy);
 }
+
+void D3D12_TextureUploadBuffer::PrepUploadMipsInternal(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, UINT index, UINT16 num_levels, const vector<UINT8>& data,
+  MipFilter filter, MipEdgeMode edge_mode)
+{
+  ID3D12Device*       device   = ((D3D12_Core&)graphics).GetDevice();
+  D3D12_RESOURCE_DESC dst_desc = texture->GetDesc();
+  vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> dst_layouts(num_levels);
+  vector<UINT> dst_num_rows(num_levels);
+  UINT64 dst_total_bytes;
+  device->GetCopyableFootprints(&dst_desc, index, num_levels, 0, &dst_layouts[0], &dst_num_rows[0], NULL, &dst_total_bytes);
+
+  // block compressed levels are generated uncompressed first, then compressed into the upload buffer
+  GraphicsDataFormat format     = (GraphicsDataFormat)dst_desc.Format;
+  bool               compressed = BlockCompressor::IsBlockCompressed(format);
+  GraphicsDataFormat mip_format = compressed ? BlockCompressor::GetSourceFormat(format) : format;
+  UINT width  = (UINT)dst_desc.Width;
+  UINT height = dst_desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE1D ? 1 : dst_desc.Height;
+  UINT depth  = dst_desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? dst_desc.DepthOrArraySize : 1;
+
+  D3D12_RESOURCE_DESC src_desc = m_buffer->GetDesc();
+  if (src_desc.Width < dst_total_bytes)
+  {
+    throw FrameworkException("Upload texture buffer too small for target texture");
+  }
+  else if (compressed && !BlockCompressor::IsFormatSupported(format))
+  {
+    throw FrameworkException("Mipmaps cannot be generated for the block compressed format of the target texture");
+  }
+  else if (data.size() < (size_t)width * height * depth * MipGenerator::GetBytesPerTexel(mip_format))
+  {
+    throw FrameworkException("Insufficient number of bytes for upload texture buffer");
+  }
+
+  vector<vector<UINT8> > uncompressed;
+  if (compressed)
+  {
+    MipGenerator::Generate(data, width, height, depth, mip_format, filter, edge_mode, num_levels, uncompressed);
+  }
+
+  UINT8* cpu_mem_start;
+  HRESULT rc = m_buffer->Map(0, NULL, (void**)&cpu_mem_start);
+  if (FAILED(rc))
+  {
+    throw FrameworkException("Failed to map texture upload buffer memory");
+  }
+
+  // every level is written straight into its footprint in the upload buffer
+  try
+  {
+    if (compressed)
+    {
+      for (UINT16 l = 0; l < num_levels; l++)
+      {
+        UINT level_width  = max(width >> l, 1u);
+        UINT level_height = max(height >> l, 1u);
+        UINT level_depth  = max(depth >> l, 1u);
+        for (UINT z = 0; z < level_depth; z++)
+        {
+          BlockCompressor::Compress(&uncompressed[l][(size_t)z * level_width * level_height * 4], level_width, level_height, level_width * 4, format, BC_QUALITY_NORMAL,
+            cpu_mem_start + dst_layouts[l].Offset + (size_t)z * dst_layouts[l].Footprint.RowPitch * dst_num_rows[l], dst_layouts[l].Footprint.RowPitch);
+        }
+      }
+    }
+    else
+    {
+      vector<MipLevelData> levels(num_levels);
+      for (UINT16 l = 0; l < num_levels; l++)
+      {
+        levels[l].data        = cpu_mem_start + dst_layouts[l].Offset;
+        levels[l].row_pitch   = dst_layouts[l].Footprint.RowPitch;
+        levels[l].slice_pitch = dst_layouts[l].Footprint.RowPitch * dst_num_rows[l];
+      }
+      MipGenerator::Generate(&data[0], width, height, depth, format, filter, edge_mode, num_levels, &levels[0]);
+    }
+  }
+  catch (...)
+  {
+    m_buffer->Unmap(0, NULL);
+    throw;
+  }
+  m_buffer->Unmap(0, NULL);
+
+  ID3D12GraphicsCommandList* cmd_list = ((D3D12_CommandList&)command_list).GetCommandList();
+  for (UINT16 l = 0; l < num_levels; l++)
+  {
+    D3D12_TEXTURE_COPY_LOCATION src;
+    src.pResource        = m_buffer;
+    src.Type             = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+    src.PlacedFootprint  = dst_layouts[l];
+
+    D3D12_TEXTURE_COPY_LOCATION dst;
+    dst.pResource        = texture;
+    dst.Type             = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    dst.SubresourceIndex = index + l;
+
+    D3D12_RESOURCE_BARRIER prep_copy;
+    prep_copy.Type  = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    prep_copy.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    prep_copy.Transition.pResource   = texture;
+    prep_copy.Transition.Subresource = index + l;
+    prep_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_GENERIC_READ;
+    prep_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
+    cmd_list->ResourceBarrier(1, &prep_copy);
+
+    cmd_list->CopyTextureRegion(&dst, 0, 0, 0, &src, NULL);
+
+    D3D12_RESOURCE_BARRIER done_copy;
+    done_copy.Type  = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    done_copy.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    done_copy.Transition.pResource   = texture;
+    done_copy.Transition.Subresource = index + l;
+    done_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
+    done_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_GENERIC_READ;
+    cmd_list->ResourceBarrier(1, &done_copy);
+  }
+}
+
+void D3D12_TextureUploadBuffer::PrepUploadSubresources(GraphicsCore& graphics, CommandList& command_list, ID3D12Resource* texture, const vector<TextureFileSubresource>& subresources)
+{
+  ID3D12Device*       device           = ((D3D12_Core&)graphics).GetDevice();
+  D3D12_RESOURCE_DESC dst_desc         = texture->GetDesc();
+  UINT                num_subresources = (UINT)subresources.size();
+  vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> dst_layouts(num_subresources);
+  vector<UINT>   dst_num_rows(num_subresources);
+  vector<UINT64> dst_row_sizes(num_subresources);
+  UINT64 dst_total_bytes;
+  device->GetCopyableFootprints(&dst_desc, 0, num_subresources, 0, &dst_layouts[0], &dst_num_rows[0], &dst_row_sizes[0], &dst_total_bytes);
+
+  D3D12_RESOURCE_DESC src_desc = m_buffer->GetDesc();
+  if (src_desc.Width < dst_total_bytes)
+  {
+    throw FrameworkException("Upload texture buffer too small for target texture");
+  }
+  for (UINT i = 0; i < num_subresources; i++)
+  {
+    if (subresources[i].row_pitch < dst_row_sizes[i] || subresources[i].slice_pitch < subresources[i].row_pitch * dst_num_rows[i])
+    {
+      throw FrameworkException("Source rows are smaller than the rows of the target texture");
+    }
+  }
+
+  UINT8* cpu_mem_start;
+  HRESULT rc = m_buffer->Map(0, NULL, (void**)&cpu_mem_start);
+  if (FAILED(rc))
+  {
+    throw FrameworkException("Failed to map texture upload buffer memory");
+  }
+  for (UINT i = 0; i < num_subresources; i++)
+  {
+    const D3D12_SUBRESOURCE_FOOTPRINT& footprint = dst_layouts[i].Footprint;
+    const TextureFileSubresource&      src       = subresources[i];
+    UINT8*                             dst_mem   = cpu_mem_start + dst_layouts[i].Offset;
+
+    TexelCopy::CopyRows(dst_mem, footprint.RowPitch, (SIZE_T)footprint.RowPitch * dst_num_rows[i], src.data, src.row_pitch, src.slice_pitch,
+      (UINT)dst_row_sizes[i], dst_num_rows[i], footprint.Depth);
+  }
+  m_buffer->Unmap(0, NULL);
+
+  // every subresource is transitioned together rather than around each copy
+  ID3D12GraphicsCommandList* cmd_list = ((D3D12_CommandList&)command_list).GetCommandList();
+  D3D12_RESOURCE_BARRIER prep_copy;
+  prep_copy.Type  = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  prep_copy.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  prep_copy.Transition.pResource   = texture;
+  prep_copy.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+  prep_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_GENERIC_READ;
+  prep_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
+  cmd_list->ResourceBarrier(1, &prep_copy);
+
+  for (UINT i = 0; i < num_subresources; i++)
+  {
+    D3D12_TEXTURE_COPY_LOCATION src;
+    src.pResource        = m_buffer;
+    src.Type             = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+    src.PlacedFootprint  = dst_layouts[i];
+
+    D3D12_TEXTURE_COPY_LOCATION dst;
+    dst.pResource        = texture;
+    dst.Type             = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    dst.SubresourceIndex = i;
+
+    cmd_list->CopyTextureRegion(&dst, 0, 0, 0, &src, NULL);
+  }
+
+  D3D12_RESOURCE_BARRIER done_copy;
+  done_copy.Type  = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+  done_copy.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+  done_copy.Transition.pResource   = texture;
+  done_copy.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+  done_copy.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
+  done_copy.Transition.StateAfter  = D3D12_RESOURCE_STATE_GENERIC_READ;
+  cmd_list->ResourceBarrier(1, &done_copy);
+}
@@ -0,0 +1,76 @@
+#include "private_inc/DynamicBufferRing.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+
+DynamicBufferRing::DynamicBufferRing(UINT num_versions)
+:m_in_flight(num_versions),
+ m_current(0)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num_versions == 0)
+  {
+    throw FrameworkException("Dynamic buffer must have at least 1 version");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  Range clean = { 0, 0 };
+  m_stale.resize(num_versions, clean);
+  m_current = m_in_flight.Acquire();
+}
+
+void DynamicBufferRing::MarkWritten(UINT start, UINT end)
+{
+  if (start >= end)
+  {
+    return;
+  }
+
+  // the other versions pick up the change when their frame comes around again
+  for (UINT i = 0; i < m_stale.size(); i++)
+  {
+    if (i == m_current)
+    {
+      continue;
+    }
+
+    Range& stale = m_stale[i];
+    if (stale.start >= stale.end)
+    {
+      stale.start = start;
+      stale.end   = end;
+    }
+    else
+    {
+      stale.start = start < stale.start ? start : stale.start;
+      stale.end   = end > stale.end ? end : stale.end;
+    }
+  }
+}
+
+bool DynamicBufferRing::Advance(UINT64 fence_value, UINT64 completed_value)
+{
+  if (m_in_flight.GetNumUntagged() > 0)
+  {
+    m_in_flight.Tag(fence_value);
+  }
+  while (m_in_flight.GetRetired(completed_value) != FenceSlotRing::NO_SLOT)
+  {
+    m_in_flight.ReleaseOldest();
+  }
+
+  UINT next = m_in_flight.Acquire();
+  if (next == FenceSlotRing::NO_SLOT)
+  {
+    return false;
+  }
+  m_current = next;
+  return true;
+}
+
+DynamicBufferRing::Range DynamicBufferRing::TakeStale()
+{
+  Range stale = m_stale[m_current];
+  m_stale[m_current].start = 0;
+  m_stale[m_current].end   = 0;
+  return stale;
+}
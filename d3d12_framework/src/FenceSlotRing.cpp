@@ -0,0 +1,69 @@
+#include "private_inc/FenceSlotRing.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+
+FenceSlotRing::FenceSlotRing(UINT num_slots)
+:m_fence_values(num_slots, 0),
+ m_oldest(0),
+ m_num_in_use(0),
+ m_num_untagged(0)
+{
+}
+
+UINT FenceSlotRing::Acquire()
+{
+  UINT num_slots = (UINT)m_fence_values.size();
+  if (m_num_in_use == num_slots)
+  {
+    return NO_SLOT;
+  }
+
+  UINT slot = (m_oldest + m_num_in_use) % num_slots;
+  m_fence_values[slot] = 0;
+  m_num_in_use++;
+  m_num_untagged++;
+  return slot;
+}
+
+void FenceSlotRing::Tag(UINT64 fence_value)
+{
+  UINT num_slots = (UINT)m_fence_values.size();
+  for (UINT i = m_num_in_use - m_num_untagged; i < m_num_in_use; i++)
+  {
+    m_fence_values[(m_oldest + i) % num_slots] = fence_value;
+  }
+  m_num_untagged = 0;
+}
+
+UINT FenceSlotRing::GetRetired(UINT64 completed_value) const
+{
+  if (m_num_in_use == m_num_untagged || m_fence_values[m_oldest] > completed_value)
+  {
+    return NO_SLOT;
+  }
+  return m_oldest;
+}
+
+void FenceSlotRing::ReleaseOldest()
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (m_num_in_use == m_num_untagged)
+  {
+    throw FrameworkException("Attempting to release a slot that has not been tagged with a fence value");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  m_fence_values[m_oldest] = 0;
+  m_oldest = (m_oldest + 1) % (UINT)m_fence_values.size();
+  m_num_in_use--;
+}
+
+UINT FenceSlotRing::GetNumInUse() const
+{
+  return m_num_in_use;
+}
+
+UINT FenceSlotRing::GetNumUntagged() const
+{
+  return m_num_untagged;
+}
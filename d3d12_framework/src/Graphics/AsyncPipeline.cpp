@@ -0,0 +1,159 @@
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include "Graphics/AsyncPipeline.h"
+#include "Graphics/Pipeline.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// State shared between an AsyncPipeline and the job compiling it
+/// </summary>
+struct AsyncPipelineState
+{
+  AsyncPipelineState()
+  :pipeline(NULL),
+   ready(false),
+   failed(false)
+  {
+  }
+
+  /// <summary>
+  /// compiled pipeline, NULL until the compile succeeds
+  /// </summary>
+  Pipeline* pipeline;
+
+  /// <summary>
+  /// set once the compile has finished.  Writes to the other members happen before this is set
+  /// </summary>
+  atomic<bool> ready;
+
+  /// <summary>
+  /// true if the compile threw
+  /// </summary>
+  bool failed;
+
+  /// <summary>
+  /// message from the exception thrown by a failed compile
+  /// </summary>
+  string error;
+
+  /// <summary>
+  /// guards completion for threads blocked in Wait
+  /// </summary>
+  mutex lock;
+
+  /// <summary>
+  /// signaled when the compile finishes
+  /// </summary>
+  condition_variable done;
+};
+
+AsyncPipeline* AsyncPipeline::Create(const CompileFunction& compile)
+{
+  return Create(compile, ThreadPool::GetDefault());
+}
+
+AsyncPipeline* AsyncPipeline::Create(const CompileFunction& compile, ThreadPool& pool)
+{
+  shared_ptr<AsyncPipelineState> state(new AsyncPipelineState());
+
+  pool.Enqueue([state, compile]()
+  {
+    Pipeline* pipeline = NULL;
+    bool      failed   = false;
+    string    error;
+    try
+    {
+      pipeline = compile();
+      if (pipeline == NULL)
+      {
+        failed = true;
+        error  = "Pipeline compile function returned NULL";
+      }
+    }
+    catch (const FrameworkException& err)
+    {
+      failed = true;
+      error  = err.what();
+    }
+    catch (...)
+    {
+      failed = true;
+      error  = "Unknown error compiling pipeline";
+    }
+
+    lock_guard<mutex> guard(state->lock);
+    state->pipeline = pipeline;
+    state->failed   = failed;
+    state->error    = error;
+    state->ready.store(true);
+    state->done.notify_all();
+  });
+
+  return new AsyncPipeline(state);
+}
+
+AsyncPipeline::AsyncPipeline(const shared_ptr<AsyncPipelineState>& state)
+:m_state(state)
+{
+}
+
+AsyncPipeline::~AsyncPipeline()
+{
+  // the objects the compile function references are typically released right after this, so it must not outlive the
+  // handle
+  {
+    unique_lock<mutex> guard(m_state->lock);
+    while (!m_state->ready.load())
+    {
+      m_state->done.wait(guard);
+    }
+  }
+
+  delete m_state->pipeline;
+}
+
+bool AsyncPipeline::IsReady() const
+{
+  return m_state->ready.load();
+}
+
+Pipeline* AsyncPipeline::GetPipeline() const
+{
+  if (!m_state->ready.load())
+  {
+    return NULL;
+  }
+
+  return m_state->pipeline;
+}
+
+const Pipeline& AsyncPipeline::GetPipelineOrFallback(const Pipeline& fallback) const
+{
+  Pipeline* pipeline = GetPipeline();
+  if (pipeline == NULL)
+  {
+    return fallback;
+  }
+
+  return *pipeline;
+}
+
+Pipeline& AsyncPipeline::Wait() const
+{
+  unique_lock<mutex> guard(m_state->lock);
+  while (!m_state->ready.load())
+  {
+    m_state->done.wait(guard);
+  }
+
+  if (m_state->failed)
+  {
+    throw FrameworkException(m_state->error);
+  }
+
+  return *m_state->pipeline;
+}
@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/DynamicVertexBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_DynamicVertexBuffer.h"
+
+DynamicVertexBuffer* DynamicVertexBuffer::CreateD3D12(GraphicsCore& graphics, UINT num_frames, UINT num, UINT stride, const void* data)
+{
+  return D3D12_DynamicVertexBuffer::Create(graphics, num_frames, num, stride, data);
+}
+
+DynamicVertexBuffer::DynamicVertexBuffer()
+{
+}
+
+DynamicVertexBuffer::~DynamicVertexBuffer()
+{
+}
@@ -2,6 +2,9 @@
 
 IndexBuffer::IndexBuffer()
 {
+  m_view.buffer_location = 0;
+  m_view.size_in_bytes   = 0;
+  m_view.format          = R16_UINT;
 }
 
 IndexBuffer::~IndexBuffer()
@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/IndexBuffer32.h"
+#include "private_inc/D3D12/Buffers/D3D12_IndexBuffer32.h"
+
+IndexBuffer32* IndexBuffer32::CreateD3D12(GraphicsCore& graphics, UINT num, const UINT* data)
+{
+  return D3D12_IndexBuffer32::Create(graphics, num, data);
+}
+
+IndexBuffer32::IndexBuffer32()
+{
+}
+
+IndexBuffer32::~IndexBuffer32()
+{
+}
@@ -0,0 +1,207 @@
+#include <sstream>
+#include "Graphics/Buffers/IndexBufferBuilder.h"
+#include "Graphics/Buffers/IndexBuffer16.h"
+#include "Graphics/Buffers/IndexBuffer32.h"
+#include "Graphics/Buffers/IndexBufferGPU16.h"
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// largest index, or span of indices within a chunk, that can be stored in a 16bit index buffer
+/// </summary>
+static const UINT MAX_16BIT_INDEX = 0xFFFF;
+
+IndexBufferBuilder::IndexBufferBuilder(const UINT* indices, UINT num_indices, UINT indices_per_primitive, bool split)
+:m_num(num_indices),
+ m_16bit(true)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (indices_per_primitive == 0)
+  {
+    throw FrameworkException("Indices per primitive must be at least 1");
+  }
+  if (num_indices % indices_per_primitive != 0)
+  {
+    ostringstream out;
+    out << "Number of indices (" << num_indices << ") is not a multiple of the indices per primitive (" << indices_per_primitive << ")";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  if (FitsIn16Bits(indices, num_indices))
+  {
+    m_data16.resize(num_indices);
+    for (UINT i = 0; i < num_indices; i++)
+    {
+      m_data16[i] = (WORD)indices[i];
+    }
+
+    IndexBufferChunk chunk = { 0, num_indices, 0 };
+    m_chunks.push_back(chunk);
+    return;
+  }
+
+  if (split && Split(indices, num_indices, indices_per_primitive))
+  {
+    m_data16.resize(num_indices);
+    for (vector<IndexBufferChunk>::const_iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+    {
+      for (UINT i = it->first_index; i < it->first_index + it->num_indices; i++)
+      {
+        m_data16[i] = (WORD)(indices[i] - it->base_vertex);
+      }
+    }
+    return;
+  }
+
+  m_16bit = false;
+  m_data32.assign(indices, indices + num_indices);
+
+  IndexBufferChunk chunk = { 0, num_indices, 0 };
+  m_chunks.clear();
+  m_chunks.push_back(chunk);
+}
+
+IndexBufferBuilder::~IndexBufferBuilder()
+{
+}
+
+bool IndexBufferBuilder::FitsIn16Bits(const UINT* indices, UINT num_indices)
+{
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    if (indices[i] > MAX_16BIT_INDEX)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool IndexBufferBuilder::Split(const UINT* indices, UINT num_indices, UINT indices_per_primitive)
+{
+  IndexBufferChunk chunk = { 0, 0, 0 };
+  UINT chunk_max = 0;
+
+  for (UINT prim_start = 0; prim_start < num_indices; prim_start += indices_per_primitive)
+  {
+    UINT prim_min = indices[prim_start];
+    UINT prim_max = indices[prim_start];
+    for (UINT i = prim_start + 1; i < prim_start + indices_per_primitive; i++)
+    {
+      if (indices[i] < prim_min)
+      {
+        prim_min = indices[i];
+      }
+      else if (indices[i] > prim_max)
+      {
+        prim_max = indices[i];
+      }
+    }
+
+    if (prim_max - prim_min > MAX_16BIT_INDEX)
+    {
+      m_chunks.clear();
+      return false;
+    }
+
+    if (chunk.num_indices > 0)
+    {
+      UINT new_min = prim_min < chunk.base_vertex ? prim_min : chunk.base_vertex;
+      UINT new_max = prim_max > chunk_max ? prim_max : chunk_max;
+      if (new_max - new_min <= MAX_16BIT_INDEX)
+      {
+        chunk.base_vertex  = new_min;
+        chunk_max          = new_max;
+        chunk.num_indices += indices_per_primitive;
+        continue;
+      }
+
+      m_chunks.push_back(chunk);
+    }
+
+    chunk.first_index = prim_start;
+    chunk.num_indices = indices_per_primitive;
+    chunk.base_vertex = prim_min;
+    chunk_max         = prim_max;
+  }
+
+  if (chunk.num_indices > 0)
+  {
+    m_chunks.push_back(chunk);
+  }
+
+  return true;
+}
+
+bool IndexBufferBuilder::Is16Bit() const
+{
+  return m_16bit;
+}
+
+UINT IndexBufferBuilder::GetNumIndices() const
+{
+  return m_num;
+}
+
+const WORD* IndexBufferBuilder::Get16BitData() const
+{
+  return m_data16.empty() ? NULL : &m_data16[0];
+}
+
+const UINT* IndexBufferBuilder::Get32BitData() const
+{
+  return m_data32.empty() ? NULL : &m_data32[0];
+}
+
+UINT IndexBufferBuilder::GetNumChunks() const
+{
+  return (UINT)m_chunks.size();
+}
+
+const IndexBufferChunk& IndexBufferBuilder::GetChunk(UINT index) const
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= m_chunks.size())
+  {
+    ostringstream out;
+    out << "Chunk index " << index << " is out of range, only " << m_chunks.size() << " chunks";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return m_chunks[index];
+}
+
+IndexBuffer* IndexBufferBuilder::CreateD3D12(GraphicsCore& graphics) const
+{
+  if (m_16bit)
+  {
+    return IndexBuffer16::CreateD3D12(graphics, m_num, Get16BitData());
+  }
+  return IndexBuffer32::CreateD3D12(graphics, m_num, Get32BitData());
+}
+
+IndexBuffer* IndexBufferBuilder::CreateGPUD3D12(GraphicsCore& graphics) const
+{
+  if (m_16bit)
+  {
+    return IndexBufferGPU16::CreateD3D12(graphics, m_num);
+  }
+  return IndexBufferGPU32::CreateD3D12(graphics, m_num);
+}
+
+void IndexBufferBuilder::PrepUpload(GraphicsCore& graphics, CommandList& command_list, IndexBuffer& src, const IndexBuffer& dst) const
+{
+  if (m_16bit)
+  {
+    ((IndexBuffer16&)src).PrepUpload(graphics, command_list, (const IndexBufferGPU16&)dst);
+  }
+  else
+  {
+    ((IndexBuffer32&)src).PrepUpload(graphics, command_list, (const IndexBufferGPU32&)dst);
+  }
+}
@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+#include "private_inc/D3D12/Buffers/D3D12_IndexBufferGPU32.h"
+
+IndexBufferGPU32* IndexBufferGPU32::CreateD3D12(GraphicsCore& graphics, UINT num)
+{
+  return D3D12_IndexBufferGPU32::Create(graphics, num);
+}
+
+IndexBufferGPU32::IndexBufferGPU32()
+{
+}
+
+IndexBufferGPU32::~IndexBufferGPU32()
+{
+}
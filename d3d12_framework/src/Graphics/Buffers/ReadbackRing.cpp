@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/ReadbackRing.h"
+#include "private_inc/D3D12/Buffers/D3D12_ReadbackRing.h"
+
+ReadbackRing* ReadbackRing::CreateD3D12(GraphicsCore& graphics, UINT num_slots, UINT slot_size)
+{
+  return D3D12_ReadbackRing::Create(graphics, num_slots, slot_size);
+}
+
+ReadbackRing::ReadbackRing()
+{
+}
+
+ReadbackRing::~ReadbackRing()
+{
+}
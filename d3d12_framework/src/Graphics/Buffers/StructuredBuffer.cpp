@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/StructuredBuffer.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBuffer.h"
+
+StructuredBuffer* StructuredBuffer::CreateD3D12(GraphicsCore& graphics, UINT num, UINT stride, const void* data)
+{
+  return D3D12_StructuredBuffer::Create(graphics, num, stride, data);
+}
+
+StructuredBuffer::StructuredBuffer()
+{
+}
+
+StructuredBuffer::~StructuredBuffer()
+{
+}
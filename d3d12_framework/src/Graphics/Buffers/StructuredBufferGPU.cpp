@@ -0,0 +1,15 @@
+#include "Graphics/Buffers/StructuredBufferGPU.h"
+#include "private_inc/D3D12/Buffers/D3D12_StructuredBufferGPU.h"
+
+StructuredBufferGPU* StructuredBufferGPU::CreateD3D12(GraphicsCore& graphics, UINT num, UINT stride)
+{
+  return D3D12_StructuredBufferGPU::Create(graphics, num, stride);
+}
+
+StructuredBufferGPU::StructuredBufferGPU()
+{
+}
+
+StructuredBufferGPU::~StructuredBufferGPU()
+{
+}
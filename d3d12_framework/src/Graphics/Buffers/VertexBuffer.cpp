@@ -2,6 +2,9 @@
 
 VertexBuffer::VertexBuffer()
 {
+  m_view.buffer_location = 0;
+  m_view.size_in_bytes   = 0;
+  m_view.stride_in_bytes = 0;
 }
 
 VertexBuffer::~VertexBuffer()
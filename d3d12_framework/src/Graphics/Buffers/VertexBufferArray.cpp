@@ -1,16 +1,43 @@
+#include <string.h>
 #include "Graphics/Buffers/VertexBufferArray.h"
 #include "private_inc/D3D12/Buffers/D3D12_VertexBufferArray.h"
-#include "log.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
 
 VertexBufferArray* VertexBufferArray::CreateD3D12(UINT num_buffers)
 {
   return new D3D12_VertexBufferArray(num_buffers);
 }
 
-VertexBufferArray::VertexBufferArray()
+VertexBufferArray::VertexBufferArray(UINT num_buffers)
+:m_num(num_buffers)
 {
+  m_views = new VertexBufferView[m_num];
+  memset(m_views, 0, sizeof(VertexBufferView) * m_num);
 }
 
 VertexBufferArray::~VertexBufferArray()
 {
+  delete [] m_views;
+}
+
+void VertexBufferArray::Clear(UINT index)
+{
+  VertexBufferView view;
+  view.buffer_location = 0;
+  view.size_in_bytes   = 0;
+  view.stride_in_bytes = 0;
+  SetView(index, view);
+}
+
+void VertexBufferArray::SetView(UINT index, const VertexBufferView& view)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (index >= m_num)
+  {
+    throw FrameworkException("index beyond number of vertex buffers");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  m_views[index] = view;
 }
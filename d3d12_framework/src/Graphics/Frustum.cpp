@@ -0,0 +1,84 @@
+#include <math.h>
+#include "Graphics/Frustum.h"
+using namespace DirectX;
+
+Frustum::Frustum(const XMFLOAT4X4& view, const XMFLOAT4X4& proj)
+{
+  ExtractPlanes(view, proj);
+}
+
+Frustum::Frustum(FXMMATRIX view, CXMMATRIX proj)
+{
+  XMFLOAT4X4 view_f;
+  XMFLOAT4X4 proj_f;
+  XMStoreFloat4x4(&view_f, view);
+  XMStoreFloat4x4(&proj_f, proj);
+  ExtractPlanes(view_f, proj_f);
+}
+
+void Frustum::ExtractPlanes(const XMFLOAT4X4& view, const XMFLOAT4X4& proj)
+{
+  // combined view-projection matrix, using the row vector convention of DirectXMath
+  float m[4][4];
+  for (UINT r = 0; r < 4; r++)
+  {
+    for (UINT c = 0; c < 4; c++)
+    {
+      m[r][c] = view.m[r][0] * proj.m[0][c] + view.m[r][1] * proj.m[1][c] + view.m[r][2] * proj.m[2][c] + view.m[r][3] * proj.m[3][c];
+    }
+  }
+
+  // planes come from sums of the columns, with clip space z from 0 to w
+  m_planes[0] = XMFLOAT4(m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0]);
+  m_planes[1] = XMFLOAT4(m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0]);
+  m_planes[2] = XMFLOAT4(m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1]);
+  m_planes[3] = XMFLOAT4(m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1]);
+  m_planes[4] = XMFLOAT4(m[0][2], m[1][2], m[2][2], m[3][2]);
+  m_planes[5] = XMFLOAT4(m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2]);
+
+  for (UINT i = 0; i < NUM_PLANES; i++)
+  {
+    XMFLOAT4& plane = m_planes[i];
+    float len = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+    if (len > 0)
+    {
+      plane.x /= len;
+      plane.y /= len;
+      plane.z /= len;
+      plane.w /= len;
+    }
+  }
+}
+
+bool Frustum::IntersectsSphere(const XMFLOAT3& center, float radius) const
+{
+  for (UINT i = 0; i < NUM_PLANES; i++)
+  {
+    const XMFLOAT4& plane = m_planes[i];
+    if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Frustum::IntersectsBox(const XMFLOAT3& center, const XMFLOAT3& extents) const
+{
+  for (UINT i = 0; i < NUM_PLANES; i++)
+  {
+    // distance of the corner furthest along the plane's normal
+    const XMFLOAT4& plane = m_planes[i];
+    float dist = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+    if (dist + fabsf(plane.x) * extents.x + fabsf(plane.y) * extents.y + fabsf(plane.z) * extents.z < 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+const XMFLOAT4& Frustum::GetPlane(UINT index) const
+{
+  return m_planes[index];
+}
@@ -0,0 +1,351 @@
+#include <math.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/FrustumCuller.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+using namespace DirectX;
+
+// The kernels are written once against these wrappers, which use AVX when the compiler targets it (/arch:AVX or
+// /arch:AVX2) and SSE2 otherwise.
+#ifdef __AVX__
+#include <immintrin.h>
+
+/// <summary>
+/// Number of volumes tested by each instruction
+/// </summary>
+static const UINT SIMD_WIDTH = 8;
+
+typedef __m256 SimdFloat;
+
+static inline SimdFloat SimdLoad(const float* src)
+{
+  return _mm256_loadu_ps(src);
+}
+
+static inline SimdFloat SimdSet(float value)
+{
+  return _mm256_set1_ps(value);
+}
+
+static inline SimdFloat SimdAdd(SimdFloat a, SimdFloat b)
+{
+  return _mm256_add_ps(a, b);
+}
+
+static inline SimdFloat SimdSub(SimdFloat a, SimdFloat b)
+{
+  return _mm256_sub_ps(a, b);
+}
+
+static inline SimdFloat SimdMul(SimdFloat a, SimdFloat b)
+{
+  return _mm256_mul_ps(a, b);
+}
+
+static inline SimdFloat SimdGreaterEqual(SimdFloat a, SimdFloat b)
+{
+  return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+}
+
+static inline int SimdMask(SimdFloat a)
+{
+  return _mm256_movemask_ps(a);
+}
+#else
+#include <emmintrin.h>
+
+/// <summary>
+/// Number of volumes tested by each instruction
+/// </summary>
+static const UINT SIMD_WIDTH = 4;
+
+typedef __m128 SimdFloat;
+
+static inline SimdFloat SimdLoad(const float* src)
+{
+  return _mm_loadu_ps(src);
+}
+
+static inline SimdFloat SimdSet(float value)
+{
+  return _mm_set1_ps(value);
+}
+
+static inline SimdFloat SimdAdd(SimdFloat a, SimdFloat b)
+{
+  return _mm_add_ps(a, b);
+}
+
+static inline SimdFloat SimdSub(SimdFloat a, SimdFloat b)
+{
+  return _mm_sub_ps(a, b);
+}
+
+static inline SimdFloat SimdMul(SimdFloat a, SimdFloat b)
+{
+  return _mm_mul_ps(a, b);
+}
+
+static inline SimdFloat SimdGreaterEqual(SimdFloat a, SimdFloat b)
+{
+  return _mm_cmpge_ps(a, b);
+}
+
+static inline int SimdMask(SimdFloat a)
+{
+  return _mm_movemask_ps(a);
+}
+#endif
+
+/// <summary>
+/// Adds the indices of the volumes whose bits are set in a mask to the visible list without branching on each bit
+/// </summary>
+/// <param name="mask">
+/// bit per volume, set if the volume is visible
+/// </param>
+/// <param name="first">
+/// index of the volume in the lowest bit
+/// </param>
+/// <param name="visible">
+/// start of the visible list
+/// </param>
+/// <param name="num_visible">
+/// number of entries in the visible list, updated with the added entries
+/// </param>
+static inline void AppendVisible(int mask, UINT first, UINT* visible, UINT& num_visible)
+{
+  for (UINT k = 0; k < SIMD_WIDTH; k++)
+  {
+    visible[num_visible] = first + k;
+    num_visible += (mask >> k) & 1;
+  }
+}
+
+/// <summary>
+/// Tests a range of spheres against the frustum
+/// </summary>
+/// <param name="frustum">
+/// frustum to test against
+/// </param>
+/// <param name="spheres">
+/// spheres to test
+/// </param>
+/// <param name="begin">
+/// index of the first sphere to test
+/// </param>
+/// <param name="end">
+/// index after the last sphere to test
+/// </param>
+/// <param name="visible">
+/// where to write the indices of the visible spheres.  Must have room for end - begin entries
+/// </param>
+/// <returns>
+/// number of visible spheres
+/// </returns>
+static UINT CullSphereRange(const Frustum& frustum, const BoundingSphereTable& spheres, UINT begin, UINT end, UINT* visible)
+{
+  SimdFloat planes[Frustum::NUM_PLANES][4];
+  for (UINT p = 0; p < Frustum::NUM_PLANES; p++)
+  {
+    const XMFLOAT4& plane = frustum.GetPlane(p);
+    planes[p][0] = SimdSet(plane.x);
+    planes[p][1] = SimdSet(plane.y);
+    planes[p][2] = SimdSet(plane.z);
+    planes[p][3] = SimdSet(plane.w);
+  }
+
+  const float*    center_x = spheres.center_x.data();
+  const float*    center_y = spheres.center_y.data();
+  const float*    center_z = spheres.center_z.data();
+  const float*    radius   = spheres.radius.data();
+  const SimdFloat zero     = SimdSet(0);
+  UINT num_visible = 0;
+  UINT i = begin;
+  for (; i + SIMD_WIDTH <= end; i += SIMD_WIDTH)
+  {
+    SimdFloat x     = SimdLoad(center_x + i);
+    SimdFloat y     = SimdLoad(center_y + i);
+    SimdFloat z     = SimdLoad(center_z + i);
+    SimdFloat neg_r = SimdSub(zero, SimdLoad(radius + i));
+    int       mask  = (1 << SIMD_WIDTH) - 1;
+    for (UINT p = 0; p < Frustum::NUM_PLANES && mask != 0; p++)
+    {
+      SimdFloat dist = SimdAdd(SimdAdd(SimdAdd(SimdMul(planes[p][0], x), SimdMul(planes[p][1], y)), SimdMul(planes[p][2], z)), planes[p][3]);
+      mask &= SimdMask(SimdGreaterEqual(dist, neg_r));
+    }
+    AppendVisible(mask, i, visible, num_visible);
+  }
+
+  for (; i < end; i++)
+  {
+    if (frustum.IntersectsSphere(XMFLOAT3(center_x[i], center_y[i], center_z[i]), radius[i]))
+    {
+      visible[num_visible++] = i;
+    }
+  }
+  return num_visible;
+}
+
+/// <summary>
+/// Tests a range of boxes against the frustum
+/// </summary>
+/// <param name="frustum">
+/// frustum to test against
+/// </param>
+/// <param name="boxes">
+/// boxes to test
+/// </param>
+/// <param name="begin">
+/// index of the first box to test
+/// </param>
+/// <param name="end">
+/// index after the last box to test
+/// </param>
+/// <param name="visible">
+/// where to write the indices of the visible boxes.  Must have room for end - begin entries
+/// </param>
+/// <returns>
+/// number of visible boxes
+/// </returns>
+static UINT CullBoxRange(const Frustum& frustum, const BoundingBoxTable& boxes, UINT begin, UINT end, UINT* visible)
+{
+  // the absolute values of the normal give the distance of the box corner furthest along it
+  SimdFloat planes[Frustum::NUM_PLANES][4];
+  SimdFloat abs_normals[Frustum::NUM_PLANES][3];
+  for (UINT p = 0; p < Frustum::NUM_PLANES; p++)
+  {
+    const XMFLOAT4& plane = frustum.GetPlane(p);
+    planes[p][0]      = SimdSet(plane.x);
+    planes[p][1]      = SimdSet(plane.y);
+    planes[p][2]      = SimdSet(plane.z);
+    planes[p][3]      = SimdSet(plane.w);
+    abs_normals[p][0] = SimdSet(fabsf(plane.x));
+    abs_normals[p][1] = SimdSet(fabsf(plane.y));
+    abs_normals[p][2] = SimdSet(fabsf(plane.z));
+  }
+
+  const float*    center_x = boxes.center_x.data();
+  const float*    center_y = boxes.center_y.data();
+  const float*    center_z = boxes.center_z.data();
+  const float*    extent_x = boxes.extent_x.data();
+  const float*    extent_y = boxes.extent_y.data();
+  const float*    extent_z = boxes.extent_z.data();
+  const SimdFloat zero     = SimdSet(0);
+  UINT num_visible = 0;
+  UINT i = begin;
+  for (; i + SIMD_WIDTH <= end; i += SIMD_WIDTH)
+  {
+    SimdFloat x    = SimdLoad(center_x + i);
+    SimdFloat y    = SimdLoad(center_y + i);
+    SimdFloat z    = SimdLoad(center_z + i);
+    SimdFloat ex   = SimdLoad(extent_x + i);
+    SimdFloat ey   = SimdLoad(extent_y + i);
+    SimdFloat ez   = SimdLoad(extent_z + i);
+    int       mask = (1 << SIMD_WIDTH) - 1;
+    for (UINT p = 0; p < Frustum::NUM_PLANES && mask != 0; p++)
+    {
+      SimdFloat dist = SimdAdd(SimdAdd(SimdAdd(SimdMul(planes[p][0], x), SimdMul(planes[p][1], y)), SimdMul(planes[p][2], z)), planes[p][3]);
+      dist = SimdAdd(SimdAdd(SimdAdd(dist, SimdMul(abs_normals[p][0], ex)), SimdMul(abs_normals[p][1], ey)), SimdMul(abs_normals[p][2], ez));
+      mask &= SimdMask(SimdGreaterEqual(dist, zero));
+    }
+    AppendVisible(mask, i, visible, num_visible);
+  }
+
+  for (; i < end; i++)
+  {
+    if (frustum.IntersectsBox(XMFLOAT3(center_x[i], center_y[i], center_z[i]), XMFLOAT3(extent_x[i], extent_y[i], extent_z[i])))
+    {
+      visible[num_visible++] = i;
+    }
+  }
+  return num_visible;
+}
+
+/// <summary>
+/// Runs a culling kernel over a table, splitting it across the worker threads when it is large, and compacts the
+/// results of each piece into 1 list
+/// </summary>
+/// <param name="num">
+/// number of volumes in the table
+/// </param>
+/// <param name="cull_range">
+/// function that culls a range of the table, writing the visible indices to the pointer it's given
+/// </param>
+/// <param name="visible">
+/// output parameter for the indices of the visible volumes
+/// </param>
+/// <returns>
+/// number of visible volumes
+/// </returns>
+template <class CullRange>
+static UINT CullTable(UINT num, const CullRange& cull_range, vector<UINT>& visible)
+{
+  visible.resize(num);
+  if (num <= FrustumCuller::CHUNK_SIZE)
+  {
+    UINT num_visible = num > 0 ? cull_range(0, num, visible.data()) : 0;
+    visible.resize(num_visible);
+    return num_visible;
+  }
+
+  // each chunk writes its results where its volumes start, then they are moved down next to each other in order
+  UINT         num_chunks = (num + FrustumCuller::CHUNK_SIZE - 1) / FrustumCuller::CHUNK_SIZE;
+  vector<UINT> chunk_visible(num_chunks);
+  UINT*        dst = visible.data();
+  ThreadPool::GetDefault().ParallelFor(num, FrustumCuller::CHUNK_SIZE, [&](UINT begin, UINT end)
+  {
+    chunk_visible[begin / FrustumCuller::CHUNK_SIZE] = cull_range(begin, end, dst + begin);
+  });
+
+  UINT num_visible = chunk_visible[0];
+  for (UINT c = 1; c < num_chunks; c++)
+  {
+    const UINT* chunk_start = dst + c * FrustumCuller::CHUNK_SIZE;
+    copy(chunk_start, chunk_start + chunk_visible[c], dst + num_visible);
+    num_visible += chunk_visible[c];
+  }
+  visible.resize(num_visible);
+  return num_visible;
+}
+
+UINT FrustumCuller::CullSpheres(const Frustum& frustum, const BoundingSphereTable& spheres, vector<UINT>& visible)
+{
+  UINT num = (UINT)spheres.center_x.size();
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (spheres.center_y.size() != num || spheres.center_z.size() != num || spheres.radius.size() != num)
+  {
+    ostringstream out;
+    out << "Bounding sphere table arrays have different sizes (" << num << ", " << spheres.center_y.size() << ", " << spheres.center_z.size() << ", "
+      << spheres.radius.size() << ")";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return CullTable(num, [&](UINT begin, UINT end, UINT* dst)
+  {
+    return CullSphereRange(frustum, spheres, begin, end, dst);
+  }, visible);
+}
+
+UINT FrustumCuller::CullBoxes(const Frustum& frustum, const BoundingBoxTable& boxes, vector<UINT>& visible)
+{
+  UINT num = (UINT)boxes.center_x.size();
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (boxes.center_y.size() != num || boxes.center_z.size() != num || boxes.extent_x.size() != num || boxes.extent_y.size() != num ||
+    boxes.extent_z.size() != num)
+  {
+    ostringstream out;
+    out << "Bounding box table arrays have different sizes (" << num << ", " << boxes.center_y.size() << ", " << boxes.center_z.size() << ", "
+      << boxes.extent_x.size() << ", " << boxes.extent_y.size() << ", " << boxes.extent_z.size() << ")";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return CullTable(num, [&](UINT begin, UINT end, UINT* dst)
+  {
+    return CullBoxRange(frustum, boxes, begin, end, dst);
+  }, visible);
+}
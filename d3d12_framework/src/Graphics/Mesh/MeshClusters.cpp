@@ -0,0 +1,303 @@
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/Mesh/MeshClusters.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+using namespace DirectX;
+
+/// <summary>
+/// Marks a vertex as not being in any cluster yet
+/// </summary>
+static const UINT INVALID_INDEX = 0xFFFFFFFF;
+
+/// <summary>
+/// Checks that the indices form a triangle list using only vertices that exist
+/// </summary>
+/// <exception cref="FrameworkException">
+/// Thrown when the indices are not valid
+/// </exception>
+static void ValidateTriangleList(const UINT* indices, UINT num_indices, UINT num_vertices)
+{
+  if (num_indices % 3 != 0)
+  {
+    ostringstream out;
+    out << "Number of indices (" << num_indices << ") is not a multiple of 3";
+    throw FrameworkException(out.str());
+  }
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    if (indices[i] >= num_vertices)
+    {
+      ostringstream out;
+      out << "Index " << i << " (" << indices[i] << ") is out of range, only " << num_vertices << " vertices";
+      throw FrameworkException(out.str());
+    }
+  }
+}
+
+/// <summary>
+/// Computes the bounding sphere and normal cone of the most recently built cluster and adds it to the table
+/// </summary>
+/// <param name="first_index">
+/// index in the table's indices of the first index of the cluster
+/// </param>
+/// <param name="positions">
+/// position of the first vertex
+/// </param>
+/// <param name="position_stride">
+/// number of bytes between consecutive positions
+/// </param>
+/// <param name="clusters">
+/// table to add the cluster to
+/// </param>
+static void AddCluster(UINT first_index, const UINT8* positions, UINT position_stride, ClusterTable& clusters)
+{
+  const UINT* indices = &clusters.indices[first_index];
+  UINT num_indices = (UINT)clusters.indices.size() - first_index;
+
+  // sphere around the center of the box enclosing the triangles
+  float min_pos[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+  float max_pos[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    const float* pos = (const float*)(positions + indices[i] * (size_t)position_stride);
+    for (UINT j = 0; j < 3; j++)
+    {
+      min_pos[j] = min(min_pos[j], pos[j]);
+      max_pos[j] = max(max_pos[j], pos[j]);
+    }
+  }
+  float center[3] = { (min_pos[0] + max_pos[0]) * 0.5f, (min_pos[1] + max_pos[1]) * 0.5f, (min_pos[2] + max_pos[2]) * 0.5f };
+  float radius_sq = 0;
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    const float* pos = (const float*)(positions + indices[i] * (size_t)position_stride);
+    float dx = pos[0] - center[0];
+    float dy = pos[1] - center[1];
+    float dz = pos[2] - center[2];
+    radius_sq = max(radius_sq, dx * dx + dy * dy + dz * dz);
+  }
+
+  // the unnormalized triangle normals are twice the triangle areas long, so their sum is an area weighted average
+  vector<XMFLOAT3> normals(num_indices / 3);
+  float axis[3] = { 0, 0, 0 };
+  for (UINT i = 0; i < num_indices; i += 3)
+  {
+    const float* p0 = (const float*)(positions + indices[i] * (size_t)position_stride);
+    const float* p1 = (const float*)(positions + indices[i + 1] * (size_t)position_stride);
+    const float* p2 = (const float*)(positions + indices[i + 2] * (size_t)position_stride);
+    float u[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    float v[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    XMFLOAT3& normal = normals[i / 3];
+    normal.x = u[1] * v[2] - u[2] * v[1];
+    normal.y = u[2] * v[0] - u[0] * v[2];
+    normal.z = u[0] * v[1] - u[1] * v[0];
+    axis[0] += normal.x;
+    axis[1] += normal.y;
+    axis[2] += normal.z;
+  }
+
+  float cutoff = 1;
+  float axis_len = sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+  if (axis_len > 0)
+  {
+    axis[0] /= axis_len;
+    axis[1] /= axis_len;
+    axis[2] /= axis_len;
+
+    float min_dot = 1;
+    for (size_t i = 0; i < normals.size(); i++)
+    {
+      const XMFLOAT3& normal = normals[i];
+      float len = sqrtf(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+      if (len > 0)
+      {
+        min_dot = min(min_dot, (normal.x * axis[0] + normal.y * axis[1] + normal.z * axis[2]) / len);
+      }
+    }
+
+    // a cone wider than a hemisphere can always be seen from somewhere
+    if (min_dot > 0)
+    {
+      cutoff = sqrtf(1 - min_dot * min_dot);
+    }
+  }
+  else
+  {
+    axis[2] = 1;
+  }
+
+  clusters.center_x.push_back(center[0]);
+  clusters.center_y.push_back(center[1]);
+  clusters.center_z.push_back(center[2]);
+  clusters.radius.push_back(sqrtf(radius_sq));
+  clusters.cone_axis_x.push_back(axis[0]);
+  clusters.cone_axis_y.push_back(axis[1]);
+  clusters.cone_axis_z.push_back(axis[2]);
+  clusters.cone_cutoff.push_back(cutoff);
+  clusters.first_index.push_back(first_index);
+  clusters.num_indices.push_back(num_indices);
+}
+
+void MeshClusters::Build(const UINT* indices, UINT num_indices, const void* positions, UINT position_stride, UINT num_vertices,
+  ClusterTable& clusters)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  ValidateTriangleList(indices, num_indices, num_vertices);
+  if (positions == NULL && num_vertices > 0)
+  {
+    throw FrameworkException("Positions must be provided to build clusters");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  clusters = ClusterTable();
+  UINT num_tris = num_indices / 3;
+  if (num_tris == 0)
+  {
+    return;
+  }
+
+  // triangles using each vertex
+  vector<UINT> tri_offsets(num_vertices + 1, 0);
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    tri_offsets[indices[i] + 1]++;
+  }
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    tri_offsets[i + 1] += tri_offsets[i];
+  }
+  vector<UINT> vertex_tris(num_indices);
+  vector<UINT> next_slot(tri_offsets.begin(), tri_offsets.end() - 1);
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    vertex_tris[next_slot[indices[i]]++] = i / 3;
+  }
+
+  const UINT8* src = (const UINT8*)positions;
+  vector<bool> emitted(num_tris, false);
+  vector<UINT> vertex_cluster(num_vertices, INVALID_INDEX);
+  vector<UINT> candidates;
+  clusters.indices.reserve(num_indices);
+  UINT num_emitted = 0;
+  UINT next_seed   = 0;
+  UINT cluster     = 0;
+  while (num_emitted < num_tris)
+  {
+    UINT first_index   = (UINT)clusters.indices.size();
+    UINT cluster_verts = 0;
+    UINT cluster_tris  = 0;
+    candidates.clear();
+
+    while (emitted[next_seed])
+    {
+      next_seed++;
+    }
+    UINT tri = next_seed;
+    for (;;)
+    {
+      emitted[tri] = true;
+      num_emitted++;
+      cluster_tris++;
+      for (UINT j = 0; j < 3; j++)
+      {
+        UINT v = indices[tri * 3 + j];
+        clusters.indices.push_back(v);
+        if (vertex_cluster[v] != cluster)
+        {
+          vertex_cluster[v] = cluster;
+          cluster_verts++;
+          for (UINT t = tri_offsets[v]; t < tri_offsets[v + 1]; t++)
+          {
+            if (!emitted[vertex_tris[t]])
+            {
+              candidates.push_back(vertex_tris[t]);
+            }
+          }
+        }
+      }
+      if (cluster_tris == MAX_TRIANGLES)
+      {
+        break;
+      }
+
+      // neighboring triangle that adds the fewest vertices to the cluster
+      UINT best     = INVALID_INDEX;
+      UINT best_new = 4;
+      for (size_t k = 0; k < candidates.size();)
+      {
+        UINT t = candidates[k];
+        if (emitted[t])
+        {
+          candidates[k] = candidates.back();
+          candidates.pop_back();
+          continue;
+        }
+
+        UINT num_new = (vertex_cluster[indices[t * 3]] != cluster ? 1 : 0) + (vertex_cluster[indices[t * 3 + 1]] != cluster ? 1 : 0) +
+          (vertex_cluster[indices[t * 3 + 2]] != cluster ? 1 : 0);
+        if (cluster_verts + num_new <= MAX_VERTICES && num_new < best_new)
+        {
+          best     = t;
+          best_new = num_new;
+          if (num_new == 0)
+          {
+            break;
+          }
+        }
+        k++;
+      }
+      if (best == INVALID_INDEX)
+      {
+        break;
+      }
+      tri = best;
+    }
+
+    AddCluster(first_index, src, position_stride, clusters);
+    cluster++;
+  }
+}
+
+UINT MeshClusters::Cull(const ClusterTable& clusters, const Frustum& frustum, const XMFLOAT3& camera_position, vector<DrawIndexedArgs>& draws)
+{
+  draws.clear();
+
+  UINT num_clusters = (UINT)clusters.first_index.size();
+  UINT num_visible  = 0;
+  for (UINT i = 0; i < num_clusters; i++)
+  {
+    float radius = clusters.radius[i];
+    XMFLOAT3 center(clusters.center_x[i], clusters.center_y[i], clusters.center_z[i]);
+    if (!frustum.IntersectsSphere(center, radius))
+    {
+      continue;
+    }
+
+    // every triangle faces away when the whole sphere is within the cone of view directions they face away from
+    float dx = center.x - camera_position.x;
+    float dy = center.y - camera_position.y;
+    float dz = center.z - camera_position.z;
+    float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+    if (dx * clusters.cone_axis_x[i] + dy * clusters.cone_axis_y[i] + dz * clusters.cone_axis_z[i] >= clusters.cone_cutoff[i] * dist + radius)
+    {
+      continue;
+    }
+
+    num_visible++;
+    UINT first = clusters.first_index[i];
+    if (!draws.empty() && draws.back().index_start_index + draws.back().indices_per_instance == first)
+    {
+      draws.back().indices_per_instance += clusters.num_indices[i];
+    }
+    else
+    {
+      DrawIndexedArgs draw = { clusters.num_indices[i], 1, first, 0, 0 };
+      draws.push_back(draw);
+    }
+  }
+  return num_visible;
+}
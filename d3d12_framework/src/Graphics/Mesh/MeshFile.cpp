@@ -0,0 +1,15 @@
+#include "Graphics/Mesh/MeshFile.h"
+#include "private_inc/D3D12/D3D12_MeshFile.h"
+
+MeshFile* MeshFile::OpenD3D12(const char* path)
+{
+  return D3D12_MeshFile::Open(path);
+}
+
+MeshFile::MeshFile()
+{
+}
+
+MeshFile::~MeshFile()
+{
+}
@@ -0,0 +1,622 @@
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/Mesh/MeshOptimizer.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Size of the LRU cache the vertex cache optimization scores vertices with.  Larger than the hardware cache so the
+/// optimization works well regardless of how the hardware cache behaves
+/// </summary>
+static const UINT FORSYTH_CACHE_SIZE = 32;
+
+/// <summary>
+/// Score of the vertices used by the last triangle.  Less than the next entries in the cache so the optimization
+/// doesn't produce long strips of triangles sharing 2 vertices
+/// </summary>
+static const float FORSYTH_LAST_TRI_SCORE = 0.75f;
+
+/// <summary>
+/// Exponent applied to how far a vertex is from the front of the cache
+/// </summary>
+static const float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+
+/// <summary>
+/// Scale of the bonus given to vertices with few triangles left, so lone triangles are finished off quickly
+/// </summary>
+static const float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+
+/// <summary>
+/// Exponent applied to the number of triangles left using a vertex
+/// </summary>
+static const float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+/// <summary>
+/// Number of entries in the table of precomputed valence scores
+/// </summary>
+static const UINT FORSYTH_MAX_VALENCE = 32;
+
+/// <summary>
+/// Marks a triangle or cache slot as invalid
+/// </summary>
+static const UINT INVALID_INDEX = 0xFFFFFFFF;
+
+/// <summary>
+/// Minimum number of triangles in a cluster created by the overdraw optimization
+/// </summary>
+static const UINT MIN_CLUSTER_TRIANGLES = 16;
+
+/// <summary>
+/// Cluster of triangles that are sorted together by the overdraw optimization
+/// </summary>
+struct OverdrawCluster
+{
+  /// <summary>
+  /// index of the first triangle in the cluster
+  /// </summary>
+  UINT first_tri;
+
+  /// <summary>
+  /// number of triangles in the cluster
+  /// </summary>
+  UINT num_tris;
+
+  /// <summary>
+  /// sort key, larger values are drawn first
+  /// </summary>
+  float sort_key;
+};
+
+/// <summary>
+/// Comparison function for sorting clusters so the ones with the largest sort key come first
+/// </summary>
+static bool ClusterDrawnBefore(const OverdrawCluster& left, const OverdrawCluster& right)
+{
+  return left.sort_key > right.sort_key;
+}
+
+/// <summary>
+/// Checks that a triangle list is valid
+/// </summary>
+/// <param name="indices">
+/// triangle list indices
+/// </param>
+/// <param name="num_indices">
+/// number of entries in indices
+/// </param>
+/// <param name="num_vertices">
+/// number of vertices the indices refer to
+/// </param>
+/// <exception cref="FrameworkException">
+/// Thrown when the indices are not a valid triangle list
+/// </exception>
+static void ValidateTriangleList(const UINT* indices, UINT num_indices, UINT num_vertices)
+{
+  if (num_indices % 3 != 0)
+  {
+    ostringstream out;
+    out << "Number of indices (" << num_indices << ") is not a multiple of 3";
+    throw FrameworkException(out.str());
+  }
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    if (indices[i] >= num_vertices)
+    {
+      ostringstream out;
+      out << "Index " << i << " (" << indices[i] << ") is out of range, only " << num_vertices << " vertices";
+      throw FrameworkException(out.str());
+    }
+  }
+}
+
+/// <summary>
+/// Runs 1 triangle through a simulated FIFO post-transform vertex cache of DEFAULT_CACHE_SIZE entries
+/// </summary>
+/// <param name="tri">
+/// 3 indices of the triangle
+/// </param>
+/// <param name="timestamps">
+/// value of timestamp when each vertex last entered the cache
+/// </param>
+/// <param name="timestamp">
+/// number of vertices that have entered the cache, plus the cache size so unused vertices miss.  Adding the cache size
+/// plus 1 empties the cache
+/// </param>
+/// <returns>
+/// number of the triangle's vertices that missed the cache
+/// </returns>
+static UINT SimulateTriangle(const UINT* tri, UINT* timestamps, UINT& timestamp)
+{
+  UINT misses = 0;
+  for (UINT j = 0; j < 3; j++)
+  {
+    UINT vertex = tri[j];
+    if (timestamp - timestamps[vertex] > MeshOptimizer::DEFAULT_CACHE_SIZE)
+    {
+      timestamps[vertex] = timestamp++;
+      misses++;
+    }
+  }
+  return misses;
+}
+
+/// <summary>
+/// Sorts overdraw clusters so the ones facing away from the center of the mesh are drawn first
+/// </summary>
+/// <param name="clusters">
+/// clusters to sort
+/// </param>
+/// <param name="indices">
+/// triangle list indices the clusters refer to
+/// </param>
+/// <param name="pos_bytes">
+/// position of the first vertex.  Each position is 3 floats
+/// </param>
+/// <param name="position_stride">
+/// number of bytes between 2 consecutive positions
+/// </param>
+static void SortClusters(vector<OverdrawCluster>& clusters, const UINT* indices, const BYTE* pos_bytes, UINT position_stride)
+{
+  // clusters facing away from the center of the mesh are most likely to occlude the rest of the mesh, so they're drawn
+  // first.  Centroids and normals are weighted by triangle area
+  float mesh_centroid[3] = { 0, 0, 0 };
+  float mesh_area        = 0;
+  vector<float> cluster_data(clusters.size() * 7, 0);
+  for (UINT c = 0; c < clusters.size(); c++)
+  {
+    float* centroid = &cluster_data[c * 7];
+    float* normal   = centroid + 3;
+    float& area     = centroid[6];
+    for (UINT t = clusters[c].first_tri; t < clusters[c].first_tri + clusters[c].num_tris; t++)
+    {
+      const float* p0 = (const float*)(pos_bytes + indices[t * 3] * position_stride);
+      const float* p1 = (const float*)(pos_bytes + indices[t * 3 + 1] * position_stride);
+      const float* p2 = (const float*)(pos_bytes + indices[t * 3 + 2] * position_stride);
+
+      float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+      float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+      float n[3]  = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+      float tri_area = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+      for (UINT k = 0; k < 3; k++)
+      {
+        centroid[k] += (p0[k] + p1[k] + p2[k]) / 3 * tri_area;
+        normal[k]   += n[k];
+      }
+      area += tri_area;
+    }
+
+    for (UINT k = 0; k < 3; k++)
+    {
+      mesh_centroid[k] += centroid[k];
+    }
+    mesh_area += area;
+  }
+  for (UINT k = 0; k < 3; k++)
+  {
+    mesh_centroid[k] = mesh_area > 0 ? mesh_centroid[k] / mesh_area : 0;
+  }
+
+  for (UINT c = 0; c < clusters.size(); c++)
+  {
+    const float* centroid = &cluster_data[c * 7];
+    const float* normal   = centroid + 3;
+    float        area     = centroid[6];
+    float        length   = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    if (area <= 0 || length <= 0)
+    {
+      continue;
+    }
+
+    float dot = 0;
+    for (UINT k = 0; k < 3; k++)
+    {
+      dot += (centroid[k] / area - mesh_centroid[k]) * normal[k];
+    }
+    clusters[c].sort_key = dot / length;
+  }
+
+  stable_sort(clusters.begin(), clusters.end(), ClusterDrawnBefore);
+}
+
+/// <summary>
+/// Scores a vertex for the vertex cache optimization
+/// </summary>
+/// <param name="cache_pos">
+/// position of the vertex in the cache, or INVALID_INDEX if it isn't in the cache
+/// </param>
+/// <param name="num_tris_left">
+/// number of triangles using the vertex that haven't been emitted yet
+/// </param>
+/// <param name="cache_scores">
+/// precomputed scores for each cache position
+/// </param>
+/// <param name="valence_scores">
+/// precomputed scores for small numbers of triangles left
+/// </param>
+/// <returns>
+/// score of the vertex, higher scores are emitted sooner
+/// </returns>
+static float ScoreVertex(UINT cache_pos, UINT num_tris_left, const float* cache_scores, const float* valence_scores)
+{
+  if (num_tris_left == 0)
+  {
+    // no triangles left to emit, so the vertex no longer affects anything
+    return -1;
+  }
+
+  float score = cache_pos == INVALID_INDEX ? 0 : cache_scores[cache_pos];
+  if (num_tris_left < FORSYTH_MAX_VALENCE)
+  {
+    score += valence_scores[num_tris_left];
+  }
+  else
+  {
+    score += FORSYTH_VALENCE_BOOST_SCALE * powf((float)num_tris_left, -FORSYTH_VALENCE_BOOST_POWER);
+  }
+  return score;
+}
+
+void MeshOptimizer::OptimizeVertexCache(UINT* indices, UINT num_indices, UINT num_vertices)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  ValidateTriangleList(indices, num_indices, num_vertices);
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  UINT num_tris = num_indices / 3;
+  if (num_tris == 0)
+  {
+    return;
+  }
+
+  float cache_scores[FORSYTH_CACHE_SIZE];
+  for (UINT i = 0; i < FORSYTH_CACHE_SIZE; i++)
+  {
+    if (i < 3)
+    {
+      cache_scores[i] = FORSYTH_LAST_TRI_SCORE;
+    }
+    else
+    {
+      float scaler = 1.0f - (float)(i - 3) / (FORSYTH_CACHE_SIZE - 3);
+      cache_scores[i] = powf(scaler, FORSYTH_CACHE_DECAY_POWER);
+    }
+  }
+  float valence_scores[FORSYTH_MAX_VALENCE];
+  valence_scores[0] = 0;
+  for (UINT i = 1; i < FORSYTH_MAX_VALENCE; i++)
+  {
+    valence_scores[i] = FORSYTH_VALENCE_BOOST_SCALE * powf((float)i, -FORSYTH_VALENCE_BOOST_POWER);
+  }
+
+  // build the list of triangles using each vertex.  The first num_tris_left entries of a vertex's list are the
+  // triangles that haven't been emitted yet
+  vector<UINT> num_tris_left(num_vertices, 0);
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    num_tris_left[indices[i]]++;
+  }
+  vector<UINT> tri_list_start(num_vertices + 1, 0);
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    tri_list_start[i + 1] = tri_list_start[i] + num_tris_left[i];
+  }
+  vector<UINT> tri_lists(num_indices);
+  vector<UINT> tri_list_fill(tri_list_start.begin(), tri_list_start.end() - 1);
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    tri_lists[tri_list_fill[indices[i]]++] = i / 3;
+  }
+
+  vector<UINT>  cache_pos(num_vertices, INVALID_INDEX);
+  vector<float> vertex_scores(num_vertices);
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    vertex_scores[i] = ScoreVertex(INVALID_INDEX, num_tris_left[i], cache_scores, valence_scores);
+  }
+
+  vector<float> tri_scores(num_tris);
+  vector<bool>  emitted(num_tris, false);
+  UINT          best_tri   = 0;
+  float         best_score = -1;
+  for (UINT i = 0; i < num_tris; i++)
+  {
+    tri_scores[i] = vertex_scores[indices[i * 3]] + vertex_scores[indices[i * 3 + 1]] + vertex_scores[indices[i * 3 + 2]];
+    if (tri_scores[i] > best_score)
+    {
+      best_score = tri_scores[i];
+      best_tri   = i;
+    }
+  }
+
+  vector<UINT> output(num_indices);
+  UINT         cache[FORSYTH_CACHE_SIZE + 3];
+  UINT         new_cache[FORSYTH_CACHE_SIZE + 3];
+  UINT         cache_count  = 0;
+  UINT         input_cursor = 0;
+
+  for (UINT out_tri = 0; out_tri < num_tris; out_tri++)
+  {
+    if (best_tri == INVALID_INDEX)
+    {
+      // nothing in the cache has triangles left, so continue with the next triangle that hasn't been emitted
+      while (emitted[input_cursor])
+      {
+        input_cursor++;
+      }
+      best_tri = input_cursor;
+    }
+
+    const UINT* tri = indices + best_tri * 3;
+    output[out_tri * 3]     = tri[0];
+    output[out_tri * 3 + 1] = tri[1];
+    output[out_tri * 3 + 2] = tri[2];
+    emitted[best_tri] = true;
+
+    // remove the triangle from the lists of its vertices, and put the vertices at the front of the cache
+    UINT new_count = 0;
+    for (UINT i = 0; i < 3; i++)
+    {
+      UINT  vertex = tri[i];
+      UINT* list   = &tri_lists[tri_list_start[vertex]];
+      UINT  left   = num_tris_left[vertex];
+      for (UINT j = 0; j < left; j++)
+      {
+        if (list[j] == best_tri)
+        {
+          list[j] = list[left - 1];
+          break;
+        }
+      }
+      num_tris_left[vertex]--;
+
+      if (i == 0 || (tri[i] != tri[0] && (i == 1 || tri[i] != tri[1])))
+      {
+        new_cache[new_count++] = vertex;
+      }
+    }
+    for (UINT i = 0; i < cache_count; i++)
+    {
+      UINT vertex = cache[i];
+      if (vertex != tri[0] && vertex != tri[1] && vertex != tri[2])
+      {
+        new_cache[new_count++] = vertex;
+      }
+    }
+
+    // rescore the vertices whose position in the cache changed, including the ones pushed out of it, and update the
+    // scores of the triangles using them
+    best_tri   = INVALID_INDEX;
+    best_score = -1;
+    for (UINT i = 0; i < new_count; i++)
+    {
+      UINT vertex = new_cache[i];
+      cache_pos[vertex] = i < FORSYTH_CACHE_SIZE ? i : INVALID_INDEX;
+
+      float score = ScoreVertex(cache_pos[vertex], num_tris_left[vertex], cache_scores, valence_scores);
+      float delta = score - vertex_scores[vertex];
+      vertex_scores[vertex] = score;
+
+      const UINT* list = &tri_lists[tri_list_start[vertex]];
+      for (UINT j = 0; j < num_tris_left[vertex]; j++)
+      {
+        tri_scores[list[j]] += delta;
+      }
+    }
+    for (UINT i = 0; i < new_count && i < FORSYTH_CACHE_SIZE; i++)
+    {
+      UINT        vertex = new_cache[i];
+      const UINT* list   = &tri_lists[tri_list_start[vertex]];
+      for (UINT j = 0; j < num_tris_left[vertex]; j++)
+      {
+        if (tri_scores[list[j]] > best_score)
+        {
+          best_score = tri_scores[list[j]];
+          best_tri   = list[j];
+        }
+      }
+    }
+
+    cache_count = new_count < FORSYTH_CACHE_SIZE ? new_count : FORSYTH_CACHE_SIZE;
+    memcpy(cache, new_cache, cache_count * sizeof(UINT));
+  }
+
+  memcpy(indices, &output[0], num_indices * sizeof(UINT));
+}
+
+void MeshOptimizer::OptimizeOverdraw(UINT* indices, UINT num_indices, const void* positions, UINT position_stride, UINT num_vertices,
+  float threshold)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  ValidateTriangleList(indices, num_indices, num_vertices);
+  if (threshold < 1.0f)
+  {
+    throw FrameworkException("Overdraw threshold must be at least 1.0");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  UINT num_tris = num_indices / 3;
+  if (num_tris == 0)
+  {
+    return;
+  }
+
+  // find the hard boundaries, which are where the simulated cache misses all 3 vertices so splitting the mesh there
+  // costs nothing
+  vector<UINT> timestamps(num_vertices, 0);
+  UINT         timestamp    = DEFAULT_CACHE_SIZE + 1;
+  UINT         input_misses = 0;
+  vector<UINT> tri_misses(num_tris);
+  for (UINT i = 0; i < num_tris; i++)
+  {
+    tri_misses[i] = SimulateTriangle(indices + i * 3, &timestamps[0], timestamp);
+    input_misses += tri_misses[i];
+  }
+  float max_acmr = (float)input_misses / num_tris * threshold;
+
+  // sorting changes which vertices are still cached where clusters meet, which the cluster tests can't see, so the
+  // sorted result is measured.  When it is worse than the threshold allows, the soft clusters are given up, and then
+  // the sort altogether
+  vector<OverdrawCluster> clusters;
+  vector<UINT>            output(num_indices);
+  for (UINT attempt = 0; attempt < 2; attempt++)
+  {
+    bool split_soft = attempt == 0;
+    clusters.clear();
+
+    // split each hard cluster further where the cache efficiency so far, simulated from an empty cache, is within the
+    // threshold of the whole hard cluster's
+    UINT hard_start = 0;
+    while (hard_start < num_tris)
+    {
+      UINT hard_end    = hard_start + 1;
+      UINT hard_misses = tri_misses[hard_start];
+      while (hard_end < num_tris && tri_misses[hard_end] < 3)
+      {
+        hard_misses += tri_misses[hard_end];
+        hard_end++;
+      }
+      float hard_acmr = (float)hard_misses / (hard_end - hard_start);
+
+      UINT soft_start  = hard_start;
+      UINT soft_misses = 0;
+      timestamp += DEFAULT_CACHE_SIZE + 1;
+      for (UINT i = hard_start; split_soft && i < hard_end; i++)
+      {
+        soft_misses += SimulateTriangle(indices + i * 3, &timestamps[0], timestamp);
+
+        UINT soft_tris = i + 1 - soft_start;
+        if (soft_tris >= MIN_CLUSTER_TRIANGLES && hard_end - (i + 1) >= MIN_CLUSTER_TRIANGLES &&
+            (float)soft_misses / soft_tris <= hard_acmr * threshold)
+        {
+          OverdrawCluster cluster = { soft_start, soft_tris, 0 };
+          clusters.push_back(cluster);
+          soft_start  = i + 1;
+          soft_misses = 0;
+          timestamp   += DEFAULT_CACHE_SIZE + 1;
+        }
+      }
+      OverdrawCluster cluster = { soft_start, hard_end - soft_start, 0 };
+      clusters.push_back(cluster);
+
+      hard_start = hard_end;
+    }
+    if (clusters.size() < 2)
+    {
+      return;
+    }
+
+    SortClusters(clusters, indices, (const BYTE*)positions, position_stride);
+
+    UINT out_index = 0;
+    for (vector<OverdrawCluster>::const_iterator it = clusters.begin(); it != clusters.end(); ++it)
+    {
+      memcpy(&output[out_index], indices + it->first_tri * 3, it->num_tris * 3 * sizeof(UINT));
+      out_index += it->num_tris * 3;
+    }
+    if (AnalyzeVertexCache(&output[0], num_indices, num_vertices).acmr <= max_acmr)
+    {
+      memcpy(indices, &output[0], num_indices * sizeof(UINT));
+      return;
+    }
+  }
+}
+
+UINT MeshOptimizer::OptimizeVertexFetch(void* vertices, UINT num_vertices, UINT vertex_stride, UINT* indices, UINT num_indices)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    if (indices[i] >= num_vertices)
+    {
+      ostringstream out;
+      out << "Index " << i << " (" << indices[i] << ") is out of range, only " << num_vertices << " vertices";
+      throw FrameworkException(out.str());
+    }
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  vector<UINT> remap(num_vertices, INVALID_INDEX);
+  UINT         num_used = 0;
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    UINT& new_index = remap[indices[i]];
+    if (new_index == INVALID_INDEX)
+    {
+      new_index = num_used++;
+    }
+    indices[i] = new_index;
+  }
+
+  if (num_used > 0)
+  {
+    vector<BYTE> copy((BYTE*)vertices, (BYTE*)vertices + (size_t)num_vertices * vertex_stride);
+    for (UINT i = 0; i < num_vertices; i++)
+    {
+      if (remap[i] != INVALID_INDEX)
+      {
+        memcpy((BYTE*)vertices + (size_t)remap[i] * vertex_stride, &copy[(size_t)i * vertex_stride], vertex_stride);
+      }
+    }
+  }
+
+  return num_used;
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const UINT* indices, UINT num_indices, UINT num_vertices, UINT cache_size)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  ValidateTriangleList(indices, num_indices, num_vertices);
+  if (cache_size == 0)
+  {
+    throw FrameworkException("Cache size must be at least 1");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  VertexCacheStats stats = { 0, 0 };
+  if (num_indices < 3)
+  {
+    return stats;
+  }
+
+  vector<UINT> timestamps(num_vertices, 0);
+  vector<bool> referenced(num_vertices, false);
+  UINT         timestamp      = cache_size + 1;
+  UINT         misses         = 0;
+  UINT         num_referenced = 0;
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    UINT vertex = indices[i];
+    if (timestamp - timestamps[vertex] > cache_size)
+    {
+      timestamps[vertex] = timestamp++;
+      misses++;
+    }
+    if (!referenced[vertex])
+    {
+      referenced[vertex] = true;
+      num_referenced++;
+    }
+  }
+
+  stats.acmr = (float)misses / (num_indices / 3);
+  stats.atvr = (float)misses / num_referenced;
+  return stats;
+}
+
+MeshOptimizationReport MeshOptimizer::Optimize(void* vertices, UINT& num_vertices, UINT vertex_stride, UINT position_offset, UINT* indices,
+  UINT num_indices, float overdraw_threshold)
+{
+  MeshOptimizationReport report;
+  report.before = AnalyzeVertexCache(indices, num_indices, num_vertices);
+
+  OptimizeVertexCache(indices, num_indices, num_vertices);
+  OptimizeOverdraw(indices, num_indices, (const BYTE*)vertices + position_offset, vertex_stride, num_vertices, overdraw_threshold);
+  num_vertices = OptimizeVertexFetch(vertices, num_vertices, vertex_stride, indices, num_indices);
+
+  report.after = AnalyzeVertexCache(indices, num_indices, num_vertices);
+  return report;
+}
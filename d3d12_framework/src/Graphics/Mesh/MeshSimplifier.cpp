@@ -0,0 +1,707 @@
+#include <math.h>
+#include <string.h>
+#include <float.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/Mesh/MeshSimplifier.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+using namespace DirectX;
+
+/// <summary>
+/// Largest number of dimensions a vertex has in the quadric space: position, uv and normal
+/// </summary>
+static const UINT MAX_DIMENSIONS = 8;
+
+/// <summary>
+/// Number of doubles in a quadric with the largest number of dimensions
+/// </summary>
+static const UINT MAX_QUADRIC_SIZE = MAX_DIMENSIONS * (MAX_DIMENSIONS + 1) / 2 + MAX_DIMENSIONS + 2;
+
+/// <summary>
+/// Number of doubles in a quadric of just the position
+/// </summary>
+static const UINT POSITION_QUADRIC_SIZE = 3 * (3 + 1) / 2 + 3 + 2;
+
+/// <summary>
+/// Smallest fraction of the previous level's indices a new level must remove to be added to the chain
+/// </summary>
+static const float MIN_LOD_REDUCTION = 0.05f;
+
+/// <summary>
+/// Candidate edge collapse
+/// </summary>
+struct Collapse
+{
+  /// <summary>
+  /// vertex that is removed
+  /// </summary>
+  UINT from;
+
+  /// <summary>
+  /// vertex the removed vertex is merged into
+  /// </summary>
+  UINT to;
+
+  /// <summary>
+  /// squared error of merging the vertices
+  /// </summary>
+  double cost;
+};
+
+/// <summary>
+/// Comparison function for sorting collapses so the cheapest ones come first
+/// </summary>
+static bool CollapseCheaper(const Collapse& left, const Collapse& right)
+{
+  return left.cost < right.cost;
+}
+
+/// <summary>
+/// Comparison function for sorting vertices by their position
+/// </summary>
+struct PositionLess
+{
+  const float* positions;
+
+  bool operator()(UINT left, UINT right) const
+  {
+    const float* l = positions + left * 3;
+    const float* r = positions + right * 3;
+    if (l[0] != r[0])
+    {
+      return l[0] < r[0];
+    }
+    if (l[1] != r[1])
+    {
+      return l[1] < r[1];
+    }
+    return l[2] < r[2];
+  }
+};
+
+/// <summary>
+/// Checks that the indices form a triangle list using only vertices that exist
+/// </summary>
+/// <exception cref="FrameworkException">
+/// Thrown when the indices are not valid
+/// </exception>
+static void ValidateTriangleList(const UINT* indices, UINT num_indices, UINT num_vertices)
+{
+  if (num_indices % 3 != 0)
+  {
+    ostringstream out;
+    out << "Number of indices (" << num_indices << ") is not a multiple of 3";
+    throw FrameworkException(out.str());
+  }
+  for (UINT i = 0; i < num_indices; i++)
+  {
+    if (indices[i] >= num_vertices)
+    {
+      ostringstream out;
+      out << "Index " << i << " (" << indices[i] << ") is out of range, only " << num_vertices << " vertices";
+      throw FrameworkException(out.str());
+    }
+  }
+}
+
+/// <summary>
+/// Checks that the attributes the layout refers to fit in the vertices
+/// </summary>
+/// <exception cref="FrameworkException">
+/// Thrown when the layout is not valid
+/// </exception>
+static void ValidateLayout(const SimplifierVertexLayout& layout)
+{
+  if (layout.vertices == NULL && layout.num_vertices > 0)
+  {
+    throw FrameworkException("Simplifier vertex layout has no vertices");
+  }
+  if (layout.position_offset + 3 * sizeof(float) > layout.stride)
+  {
+    throw FrameworkException("Position does not fit in the vertex stride");
+  }
+  if (layout.uv_offset != SIMPLIFIER_ATTRIBUTE_NONE && layout.uv_offset + 2 * sizeof(float) > layout.stride)
+  {
+    throw FrameworkException("UV coordinates do not fit in the vertex stride");
+  }
+  if (layout.normal_offset != SIMPLIFIER_ATTRIBUTE_NONE && layout.normal_offset + 3 * sizeof(float) > layout.stride)
+  {
+    throw FrameworkException("Normal does not fit in the vertex stride");
+  }
+}
+
+/// <summary>
+/// Retrieves the number of doubles in a quadric of the specified number of dimensions.  The quadric stores the upper
+/// triangle of the symmetric matrix A row by row, then the vector b, then the constant c, then the total weight of
+/// the quadric.  The error of point x is x'Ax + 2b'x + c.
+/// </summary>
+static UINT QuadricSize(UINT n)
+{
+  return n * (n + 1) / 2 + n + 2;
+}
+
+/// <summary>
+/// Computes the quadric measuring the squared distance to the plane of a triangle in n dimensional space, scaled by
+/// the specified weight
+/// </summary>
+/// <param name="p0">
+/// first corner of the triangle
+/// </param>
+/// <param name="p1">
+/// second corner of the triangle
+/// </param>
+/// <param name="p2">
+/// third corner of the triangle
+/// </param>
+/// <param name="n">
+/// number of dimensions
+/// </param>
+/// <param name="weight">
+/// weight of the triangle
+/// </param>
+/// <param name="q">
+/// where to write the quadric
+/// </param>
+/// <returns>
+/// true if the quadric was computed, false if the triangle is degenerate
+/// </returns>
+static bool TriangleQuadric(const double* p0, const double* p1, const double* p2, UINT n, double weight, double* q)
+{
+  // orthonormal basis of the triangle's plane
+  double e1[MAX_DIMENSIONS];
+  double e2[MAX_DIMENSIONS];
+  double len1 = 0;
+  for (UINT i = 0; i < n; i++)
+  {
+    e1[i] = p1[i] - p0[i];
+    len1 += e1[i] * e1[i];
+  }
+  if (len1 <= 0)
+  {
+    return false;
+  }
+  len1 = sqrt(len1);
+  double dot = 0;
+  for (UINT i = 0; i < n; i++)
+  {
+    e1[i] /= len1;
+    e2[i] = p2[i] - p0[i];
+    dot += e1[i] * e2[i];
+  }
+  double len2 = 0;
+  for (UINT i = 0; i < n; i++)
+  {
+    e2[i] -= dot * e1[i];
+    len2 += e2[i] * e2[i];
+  }
+  if (len2 <= 1e-24)
+  {
+    return false;
+  }
+  len2 = sqrt(len2);
+  double p0e1 = 0;
+  double p0e2 = 0;
+  double p0p0 = 0;
+  for (UINT i = 0; i < n; i++)
+  {
+    e2[i] /= len2;
+    p0e1 += p0[i] * e1[i];
+    p0e2 += p0[i] * e2[i];
+    p0p0 += p0[i] * p0[i];
+  }
+
+  // A = I - e1e1' - e2e2', b = (p0.e1)e1 + (p0.e2)e2 - p0, c = p0.p0 - (p0.e1)^2 - (p0.e2)^2
+  double* a = q;
+  for (UINT r = 0; r < n; r++)
+  {
+    for (UINT c = r; c < n; c++)
+    {
+      *a++ = ((r == c ? 1.0 : 0.0) - e1[r] * e1[c] - e2[r] * e2[c]) * weight;
+    }
+  }
+  double* b = q + n * (n + 1) / 2;
+  for (UINT i = 0; i < n; i++)
+  {
+    b[i] = (p0e1 * e1[i] + p0e2 * e2[i] - p0[i]) * weight;
+  }
+  b[n]     = (p0p0 - p0e1 * p0e1 - p0e2 * p0e2) * weight;
+  b[n + 1] = weight;
+  return true;
+}
+
+/// <summary>
+/// Computes the error of a point with a quadric
+/// </summary>
+static double QuadricError(const double* q, const double* x, UINT n)
+{
+  const double* a = q;
+  double error = 0;
+  for (UINT r = 0; r < n; r++)
+  {
+    double row = *a++ * x[r];
+    for (UINT c = r + 1; c < n; c++)
+    {
+      row += 2 * *a++ * x[c];
+    }
+    error += row * x[r];
+  }
+  const double* b = q + n * (n + 1) / 2;
+  for (UINT i = 0; i < n; i++)
+  {
+    error += 2 * b[i] * x[i];
+  }
+  return error + b[n];
+}
+
+/// <summary>
+/// Computes the unnormalized normal of a triangle from the first 3 dimensions of its corners
+/// </summary>
+static void TriangleNormal(const double* p0, const double* p1, const double* p2, double* normal)
+{
+  double u[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+  double v[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+  normal[0] = u[1] * v[2] - u[2] * v[1];
+  normal[1] = u[2] * v[0] - u[0] * v[2];
+  normal[2] = u[0] * v[1] - u[1] * v[0];
+}
+
+UINT MeshSimplifier::Simplify(const UINT* indices, UINT num_indices, const SimplifierVertexLayout& layout, UINT target_num_indices, float max_error,
+  UINT* dst, float* result_error, float* result_attribute_error)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  ValidateLayout(layout);
+  ValidateTriangleList(indices, num_indices, layout.num_vertices);
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  if (result_error != NULL)
+  {
+    *result_error = 0;
+  }
+  if (result_attribute_error != NULL)
+  {
+    *result_attribute_error = 0;
+  }
+  if (num_indices == 0)
+  {
+    return 0;
+  }
+
+  // gather the positions and find their bounds so the simplification doesn't depend on the size of the mesh
+  UINT num_vertices = layout.num_vertices;
+  const UINT8* src = (const UINT8*)layout.vertices;
+  vector<float> positions(num_vertices * 3);
+  float min_pos[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+  float max_pos[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    memcpy(&positions[i * 3], src + i * (size_t)layout.stride + layout.position_offset, 3 * sizeof(float));
+    for (UINT j = 0; j < 3; j++)
+    {
+      min_pos[j] = min(min_pos[j], positions[i * 3 + j]);
+      max_pos[j] = max(max_pos[j], positions[i * 3 + j]);
+    }
+  }
+  double scale = max(max_pos[0] - min_pos[0], max(max_pos[1] - min_pos[1], max_pos[2] - min_pos[2]));
+  if (scale <= 0)
+  {
+    scale = 1;
+  }
+
+  // build the point of each vertex in quadric space
+  bool has_uv     = layout.uv_offset != SIMPLIFIER_ATTRIBUTE_NONE;
+  bool has_normal = layout.normal_offset != SIMPLIFIER_ATTRIBUTE_NONE;
+  UINT n = 3 + (has_uv ? 2 : 0) + (has_normal ? 3 : 0);
+  vector<double> points(num_vertices * (size_t)n);
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    double* point = &points[i * (size_t)n];
+    for (UINT j = 0; j < 3; j++)
+    {
+      point[j] = (positions[i * 3 + j] - min_pos[j]) / scale;
+    }
+    UINT dim = 3;
+    if (has_uv)
+    {
+      float uv[2];
+      memcpy(uv, src + i * (size_t)layout.stride + layout.uv_offset, sizeof(uv));
+      point[dim++] = uv[0] * layout.uv_weight;
+      point[dim++] = uv[1] * layout.uv_weight;
+    }
+    if (has_normal)
+    {
+      float normal[3];
+      memcpy(normal, src + i * (size_t)layout.stride + layout.normal_offset, sizeof(normal));
+      point[dim++] = normal[0] * layout.normal_weight;
+      point[dim++] = normal[1] * layout.normal_weight;
+      point[dim++] = normal[2] * layout.normal_weight;
+    }
+  }
+
+  // give vertices at the same position the same id, so borders and seams are found by position
+  vector<UINT> by_position(num_vertices);
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    by_position[i] = i;
+  }
+  PositionLess position_less = { &positions[0] };
+  sort(by_position.begin(), by_position.end(), position_less);
+  vector<UINT> position_id(num_vertices);
+  vector<UINT> position_count;
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    if (i == 0 || position_less(by_position[i - 1], by_position[i]))
+    {
+      position_count.push_back(0);
+    }
+    position_id[by_position[i]] = (UINT)position_count.size() - 1;
+    position_count.back()++;
+  }
+
+  // edges used by only 1 triangle are on a border
+  vector<UINT64> edges;
+  edges.reserve(num_indices);
+  for (UINT i = 0; i < num_indices; i += 3)
+  {
+    for (UINT j = 0; j < 3; j++)
+    {
+      UINT a = position_id[indices[i + j]];
+      UINT b = position_id[indices[i + (j + 1) % 3]];
+      if (a != b)
+      {
+        edges.push_back(a < b ? ((UINT64)a << 32) | b : ((UINT64)b << 32) | a);
+      }
+    }
+  }
+  sort(edges.begin(), edges.end());
+  vector<bool> border_position(position_count.size(), false);
+  for (size_t i = 0; i < edges.size();)
+  {
+    size_t end = i + 1;
+    while (end < edges.size() && edges[end] == edges[i])
+    {
+      end++;
+    }
+    if (end - i == 1)
+    {
+      border_position[(UINT)(edges[i] >> 32)]        = true;
+      border_position[(UINT)(edges[i] & 0xFFFFFFFF)] = true;
+    }
+    i = end;
+  }
+
+  vector<bool> locked(num_vertices);
+  for (UINT i = 0; i < num_vertices; i++)
+  {
+    UINT id = position_id[i];
+    locked[i] = border_position[id] || position_count[id] > 1;
+  }
+
+  // each vertex starts with the quadrics of its triangles, weighted by their area.  The full quadrics pick the order
+  // of the collapses, and the position only quadrics measure how far each collapse moves the surface
+  UINT quadric_size = QuadricSize(n);
+  vector<double> quadrics(num_vertices * (size_t)quadric_size, 0.0);
+  vector<double> position_quadrics(num_vertices * (size_t)POSITION_QUADRIC_SIZE, 0.0);
+  double tri_quadric[MAX_QUADRIC_SIZE];
+  for (UINT i = 0; i < num_indices; i += 3)
+  {
+    const double* p0 = &points[indices[i] * (size_t)n];
+    const double* p1 = &points[indices[i + 1] * (size_t)n];
+    const double* p2 = &points[indices[i + 2] * (size_t)n];
+    double normal[3];
+    TriangleNormal(p0, p1, p2, normal);
+    double area = 0.5 * sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    if (area <= 0 || !TriangleQuadric(p0, p1, p2, n, area, tri_quadric))
+    {
+      continue;
+    }
+    for (UINT j = 0; j < 3; j++)
+    {
+      double* q = &quadrics[indices[i + j] * (size_t)quadric_size];
+      for (UINT k = 0; k < quadric_size; k++)
+      {
+        q[k] += tri_quadric[k];
+      }
+    }
+    if (!TriangleQuadric(p0, p1, p2, 3, area, tri_quadric))
+    {
+      continue;
+    }
+    for (UINT j = 0; j < 3; j++)
+    {
+      double* q = &position_quadrics[indices[i + j] * (size_t)POSITION_QUADRIC_SIZE];
+      for (UINT k = 0; k < POSITION_QUADRIC_SIZE; k++)
+      {
+        q[k] += tri_quadric[k];
+      }
+    }
+  }
+
+  double max_cost = max_error >= FLT_MAX ? DBL_MAX : ((double)max_error / scale) * ((double)max_error / scale);
+  double worst_cost = 0;
+  double worst_position_cost = 0;
+
+  vector<UINT> current(indices, indices + num_indices);
+  vector<UINT> tri_offsets(num_vertices + 1);
+  vector<UINT> vertex_tris;
+  vector<double> self_errors(num_vertices);
+  vector<Collapse> collapses;
+  vector<UINT> remap(num_vertices);
+  vector<bool> touched(num_vertices);
+  target_num_indices -= target_num_indices % 3;
+  while (current.size() > target_num_indices)
+  {
+    UINT num_tris = (UINT)current.size() / 3;
+
+    // triangles using each vertex
+    fill(tri_offsets.begin(), tri_offsets.end(), 0);
+    for (size_t i = 0; i < current.size(); i++)
+    {
+      tri_offsets[current[i] + 1]++;
+    }
+    for (UINT i = 0; i < num_vertices; i++)
+    {
+      tri_offsets[i + 1] += tri_offsets[i];
+    }
+    vertex_tris.resize(current.size());
+    for (UINT i = 0; i < num_tris; i++)
+    {
+      for (UINT j = 0; j < 3; j++)
+      {
+        vertex_tris[tri_offsets[current[i * 3 + j]]++] = i;
+      }
+    }
+    for (UINT i = num_vertices; i > 0; i--)
+    {
+      tri_offsets[i] = tri_offsets[i - 1];
+    }
+    tri_offsets[0] = 0;
+
+    // error of each vertex at its own position, which is part of the cost of every collapse into it
+    for (UINT v = 0; v < num_vertices; v++)
+    {
+      if (tri_offsets[v] != tri_offsets[v + 1])
+      {
+        self_errors[v] = QuadricError(&quadrics[v * (size_t)quadric_size], &points[v * (size_t)n], n);
+      }
+    }
+
+    // cheapest collapse of each vertex that can be removed
+    collapses.clear();
+    for (UINT v = 0; v < num_vertices; v++)
+    {
+      if (locked[v] || tri_offsets[v] == tri_offsets[v + 1])
+      {
+        continue;
+      }
+
+      const double* q_from = &quadrics[v * (size_t)quadric_size];
+      Collapse best = { v, v, DBL_MAX };
+      for (UINT t = tri_offsets[v]; t < tri_offsets[v + 1]; t++)
+      {
+        // unlocked vertices are surrounded by triangles, so the vertex after v in each triangle covers every neighbor
+        const UINT* tri = &current[vertex_tris[t] * 3];
+        UINT to = tri[0] == v ? tri[1] : (tri[1] == v ? tri[2] : tri[0]);
+        double weight = q_from[quadric_size - 1] + quadrics[to * (size_t)quadric_size + quadric_size - 1];
+        double cost = QuadricError(q_from, &points[to * (size_t)n], n) + self_errors[to];
+        cost = weight > 0 ? max(cost / weight, 0.0) : 0;
+        if (cost < best.cost)
+        {
+          best.to   = to;
+          best.cost = cost;
+        }
+      }
+      if (best.to != v)
+      {
+        collapses.push_back(best);
+      }
+    }
+    sort(collapses.begin(), collapses.end(), CollapseCheaper);
+
+    // collapse the cheapest vertices that don't share triangles until enough triangles are removed
+    UINT tris_to_remove = num_tris - (UINT)target_num_indices / 3;
+    UINT removed        = 0;
+    UINT num_collapsed  = 0;
+    for (UINT i = 0; i < num_vertices; i++)
+    {
+      remap[i] = i;
+    }
+    fill(touched.begin(), touched.end(), false);
+    for (size_t i = 0; i < collapses.size() && removed < tris_to_remove; i++)
+    {
+      const Collapse& collapse = collapses[i];
+      UINT from = collapse.from;
+      UINT to   = collapse.to;
+      if (touched[from] || touched[to])
+      {
+        continue;
+      }
+
+      // the error limit is a distance, so only the position part of the quadrics counts against it
+      const double* p_from = &position_quadrics[from * (size_t)POSITION_QUADRIC_SIZE];
+      const double* p_to   = &position_quadrics[to * (size_t)POSITION_QUADRIC_SIZE];
+      double p_weight      = p_from[POSITION_QUADRIC_SIZE - 1] + p_to[POSITION_QUADRIC_SIZE - 1];
+      double position_cost = QuadricError(p_from, &points[to * (size_t)n], 3) + QuadricError(p_to, &points[to * (size_t)n], 3);
+      position_cost = p_weight > 0 ? max(position_cost / p_weight, 0.0) : 0;
+      if (position_cost > max_cost)
+      {
+        continue;
+      }
+
+      // reject collapses that would flip a triangle over
+      bool flips   = false;
+      UINT removes = 0;
+      for (UINT t = tri_offsets[from]; t < tri_offsets[from + 1] && !flips; t++)
+      {
+        const UINT* tri = &current[vertex_tris[t] * 3];
+        if (tri[0] == to || tri[1] == to || tri[2] == to)
+        {
+          removes++;
+          continue;
+        }
+
+        const double* corners[3];
+        const double* moved[3];
+        for (UINT j = 0; j < 3; j++)
+        {
+          corners[j] = &points[tri[j] * (size_t)n];
+          moved[j]   = tri[j] == from ? &points[to * (size_t)n] : corners[j];
+        }
+        double before[3];
+        double after[3];
+        TriangleNormal(corners[0], corners[1], corners[2], before);
+        TriangleNormal(moved[0], moved[1], moved[2], after);
+        flips = before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0;
+      }
+      if (flips)
+      {
+        continue;
+      }
+
+      remap[from] = to;
+      double* q_from = &quadrics[from * (size_t)quadric_size];
+      double* q_to   = &quadrics[to * (size_t)quadric_size];
+      for (UINT k = 0; k < quadric_size; k++)
+      {
+        q_to[k] += q_from[k];
+      }
+      double* p_merged = &position_quadrics[to * (size_t)POSITION_QUADRIC_SIZE];
+      for (UINT k = 0; k < POSITION_QUADRIC_SIZE; k++)
+      {
+        p_merged[k] += p_from[k];
+      }
+
+      // the triangles around the removed vertex change, so nothing around it is collapsed again this pass
+      for (UINT t = tri_offsets[from]; t < tri_offsets[from + 1]; t++)
+      {
+        const UINT* tri = &current[vertex_tris[t] * 3];
+        touched[tri[0]] = true;
+        touched[tri[1]] = true;
+        touched[tri[2]] = true;
+      }
+      worst_cost          = max(worst_cost, collapse.cost);
+      worst_position_cost = max(worst_position_cost, position_cost);
+      removed += removes;
+      num_collapsed++;
+    }
+    if (num_collapsed == 0)
+    {
+      break;
+    }
+
+    // apply the collapses and drop the triangles that became degenerate
+    size_t kept = 0;
+    for (size_t i = 0; i < current.size(); i += 3)
+    {
+      UINT a = remap[current[i]];
+      UINT b = remap[current[i + 1]];
+      UINT c = remap[current[i + 2]];
+      if (a != b && b != c && a != c)
+      {
+        current[kept++] = a;
+        current[kept++] = b;
+        current[kept++] = c;
+      }
+    }
+    current.resize(kept);
+  }
+
+  if (!current.empty())
+  {
+    memcpy(dst, &current[0], current.size() * sizeof(UINT));
+  }
+  if (result_error != NULL)
+  {
+    *result_error = (float)(sqrt(worst_position_cost) * scale);
+  }
+  if (result_attribute_error != NULL)
+  {
+    *result_attribute_error = (float)sqrt(worst_cost);
+  }
+  return (UINT)current.size();
+}
+
+void MeshSimplifier::GenerateLODs(const UINT* indices, UINT num_indices, const SimplifierVertexLayout& layout, UINT max_lods, float reduction,
+  float max_error, vector<UINT>& lod_indices, vector<MeshLOD>& lods)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (max_lods == 0)
+  {
+    throw FrameworkException("Must generate at least 1 level of detail");
+  }
+  if (!(reduction > 0 && reduction < 1))
+  {
+    ostringstream out;
+    out << "Level of detail reduction (" << reduction << ") must be between 0 and 1";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  lod_indices.assign(indices, indices + num_indices);
+  lods.clear();
+  MeshLOD full = { 0, num_indices, 0 };
+  lods.push_back(full);
+
+  vector<UINT> simplified(num_indices);
+  while (lods.size() < max_lods)
+  {
+    const MeshLOD& prev = lods.back();
+    UINT target = (UINT)(prev.num_indices * reduction);
+    float error;
+    UINT num = Simplify(&lod_indices[prev.first_index], prev.num_indices, layout, target, max_error, &simplified[0], &error);
+    if (num == 0 || num > prev.num_indices * (1 - MIN_LOD_REDUCTION))
+    {
+      break;
+    }
+
+    // each level is simplified from the previous one, so its errors build on the previous level's
+    MeshLOD lod = { (UINT)lod_indices.size(), num, prev.error + error };
+    lod_indices.insert(lod_indices.end(), simplified.begin(), simplified.begin() + num);
+    lods.push_back(lod);
+  }
+}
+
+UINT MeshSimplifier::SelectLOD(const MeshLOD* lods, UINT num_lods, const XMFLOAT3& center, const XMFLOAT4X4& view, const XMFLOAT4X4& proj,
+  float viewport_height, float max_pixel_error)
+{
+  // view space depth of the center, using the row vector convention of DirectXMath
+  float depth = center.x * view.m[0][2] + center.y * view.m[1][2] + center.z * view.m[2][2] + view.m[3][2];
+  if (depth <= 0)
+  {
+    return 0;
+  }
+
+  // proj._22 is the cotangent of half the vertical field of view
+  float pixels_per_unit = proj.m[1][1] * viewport_height * 0.5f / depth;
+  UINT selected = 0;
+  for (UINT i = 1; i < num_lods; i++)
+  {
+    if (lods[i].error * pixels_per_unit > max_pixel_error)
+    {
+      break;
+    }
+    selected = i;
+  }
+  return selected;
+}
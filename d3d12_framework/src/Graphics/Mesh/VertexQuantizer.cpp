@@ -0,0 +1,275 @@
+#include <float.h>
+#include <stddef.h>
+#include <string.h>
+#include <emmintrin.h>
+#include "Graphics/Mesh/VertexQuantizer.h"
+
+/// <summary>
+/// Loads the 3 floats at an address into the x, y, and z lanes of a vector, with w set to 0
+/// </summary>
+static inline __m128 LoadFloat3(const BYTE* src)
+{
+  const float* f = (const float*)src;
+  return _mm_set_ps(0, f[2], f[1], f[0]);
+}
+
+/// <summary>
+/// Converts 4 floats to half floats, rounding to nearest even.  Each half float is returned in the low 16 bits of a
+/// lane, sign extended so the lanes can be packed with _mm_packs_epi32
+/// </summary>
+static inline __m128i FloatToHalf(__m128 f)
+{
+  const __m128i max_finite     = _mm_set1_epi32((127 + 16) << 23);               // smallest float that rounds to inf
+  const __m128i min_normal     = _mm_set1_epi32((127 - 14) << 23);               // smallest float with a normal half
+  const __m128i subnormal_bias = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+  const __m128i normal_bias    = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+  const __m128i inf            = _mm_set1_epi32(0x7C00);
+  const __m128i nan_bit        = _mm_set1_epi32(0x200);
+
+  __m128  sign     = _mm_and_ps(f, _mm_set1_ps(-0.0f));
+  __m128  abs_f    = _mm_xor_ps(f, sign);
+  __m128i abs_bits = _mm_castps_si128(abs_f);
+
+  // infinity and NaN
+  __m128i is_finite = _mm_cmpgt_epi32(max_finite, abs_bits);
+  __m128i is_nan    = _mm_castps_si128(_mm_cmpunord_ps(abs_f, abs_f));
+  __m128i special   = _mm_or_si128(inf, _mm_and_si128(is_nan, nan_bit));
+
+  // values that are subnormal as half floats are rounded by adding a value that shifts the mantissa into place
+  __m128i is_subnormal = _mm_cmpgt_epi32(min_normal, abs_bits);
+  __m128i subnormal    = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(abs_f, _mm_castsi128_ps(subnormal_bias))), subnormal_bias);
+
+  // normal values rebias the exponent and round the mantissa, rounding up ties when the result would be odd
+  __m128i odd    = _mm_srai_epi32(_mm_slli_epi32(abs_bits, 31 - 13), 31);
+  __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(abs_bits, normal_bias), odd), 13);
+
+  __m128i finite = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+  __m128i result = _mm_or_si128(_mm_and_si128(is_finite, finite), _mm_andnot_si128(is_finite, special));
+  return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+/// <summary>
+/// Maps 4 vectors, stored as a structure of arrays, onto the octahedron and unfolds it into the [-1, 1] square
+/// </summary>
+static inline void OctahedralEncode(__m128 x, __m128 y, __m128 z, __m128& out_x, __m128& out_y)
+{
+  const __m128 sign_mask = _mm_set1_ps(-0.0f);
+  const __m128 one       = _mm_set1_ps(1.0f);
+  const __m128 zero      = _mm_setzero_ps();
+
+  __m128 l1      = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(sign_mask, x), _mm_andnot_ps(sign_mask, y)), _mm_andnot_ps(sign_mask, z));
+  __m128 valid   = _mm_cmpgt_ps(l1, zero);
+  __m128 inv_l1  = _mm_and_ps(valid, _mm_div_ps(one, _mm_or_ps(l1, _mm_andnot_ps(valid, one))));
+  __m128 ox      = _mm_mul_ps(x, inv_l1);
+  __m128 oy      = _mm_mul_ps(y, inv_l1);
+
+  // the lower hemisphere is folded over the diagonals of the square
+  __m128 lower   = _mm_cmplt_ps(z, zero);
+  __m128 fold_x  = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, oy)), _mm_and_ps(ox, sign_mask));
+  __m128 fold_y  = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, ox)), _mm_and_ps(oy, sign_mask));
+  out_x = _mm_or_ps(_mm_and_ps(lower, fold_x), _mm_andnot_ps(lower, ox));
+  out_y = _mm_or_ps(_mm_and_ps(lower, fold_y), _mm_andnot_ps(lower, oy));
+}
+
+/// <summary>
+/// Loads up to 4 strided 3 float vectors as a structure of arrays.  Missing vectors are set to 0
+/// </summary>
+static inline void LoadNormals(const BYTE* src, UINT stride, UINT count, __m128& x, __m128& y, __m128& z)
+{
+  float xs[4] = { 0, 0, 0, 0 };
+  float ys[4] = { 0, 0, 0, 0 };
+  float zs[4] = { 0, 0, 0, 0 };
+  for (UINT i = 0; i < count; i++)
+  {
+    const float* f = (const float*)(src + i * stride);
+    xs[i] = f[0];
+    ys[i] = f[1];
+    zs[i] = f[2];
+  }
+  x = _mm_loadu_ps(xs);
+  y = _mm_loadu_ps(ys);
+  z = _mm_loadu_ps(zs);
+}
+
+QuantizationBounds VertexQuantizer::ComputeBounds(const void* positions, UINT stride, UINT num)
+{
+  QuantizationBounds bounds;
+  if (num == 0)
+  {
+    bounds.center  = DirectX::XMFLOAT3(0, 0, 0);
+    bounds.extents = DirectX::XMFLOAT3(0, 0, 0);
+    return bounds;
+  }
+
+  const BYTE* src   = (const BYTE*)positions;
+  __m128      min_v = _mm_set1_ps(FLT_MAX);
+  __m128      max_v = _mm_set1_ps(-FLT_MAX);
+  for (UINT i = 0; i < num; i++)
+  {
+    __m128 p = LoadFloat3(src + i * stride);
+    min_v = _mm_min_ps(min_v, p);
+    max_v = _mm_max_ps(max_v, p);
+  }
+
+  const __m128 half = _mm_set1_ps(0.5f);
+  float center[4];
+  float extents[4];
+  _mm_storeu_ps(center, _mm_mul_ps(_mm_add_ps(min_v, max_v), half));
+  _mm_storeu_ps(extents, _mm_mul_ps(_mm_sub_ps(max_v, min_v), half));
+
+  bounds.center  = DirectX::XMFLOAT3(center[0], center[1], center[2]);
+  bounds.extents = DirectX::XMFLOAT3(extents[0], extents[1], extents[2]);
+  return bounds;
+}
+
+void VertexQuantizer::EncodePositions(const void* src, UINT src_stride, UINT num, const QuantizationBounds& bounds, void* dst, UINT dst_stride)
+{
+  const BYTE* in  = (const BYTE*)src;
+  BYTE*       out = (BYTE*)dst;
+
+  // w is loaded as 0, so offsetting it by -1 and scaling it by 1 always encodes it as 1
+  const __m128 offset    = _mm_set_ps(-1.0f, bounds.center.z, bounds.center.y, bounds.center.x);
+  const __m128 inv_scale = _mm_set_ps(1.0f,
+                                      bounds.extents.z > 0 ? 1.0f / bounds.extents.z : 0,
+                                      bounds.extents.y > 0 ? 1.0f / bounds.extents.y : 0,
+                                      bounds.extents.x > 0 ? 1.0f / bounds.extents.x : 0);
+  const __m128 lower     = _mm_set1_ps(-1.0f);
+  const __m128 upper     = _mm_set1_ps(1.0f);
+  const __m128 max_snorm = _mm_set1_ps(32767.0f);
+
+  UINT i = 0;
+  for (; i + 2 <= num; i += 2)
+  {
+    __m128 p0 = _mm_mul_ps(_mm_sub_ps(LoadFloat3(in + i * src_stride), offset), inv_scale);
+    __m128 p1 = _mm_mul_ps(_mm_sub_ps(LoadFloat3(in + (i + 1) * src_stride), offset), inv_scale);
+    p0 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(p0, lower), upper), max_snorm);
+    p1 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(p1, lower), upper), max_snorm);
+
+    __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(p0), _mm_cvtps_epi32(p1));
+    _mm_storel_epi64((__m128i*)(out + i * dst_stride), packed);
+    _mm_storel_epi64((__m128i*)(out + (i + 1) * dst_stride), _mm_srli_si128(packed, 8));
+  }
+  if (i < num)
+  {
+    __m128 p = _mm_mul_ps(_mm_sub_ps(LoadFloat3(in + i * src_stride), offset), inv_scale);
+    p = _mm_mul_ps(_mm_min_ps(_mm_max_ps(p, lower), upper), max_snorm);
+    _mm_storel_epi64((__m128i*)(out + i * dst_stride), _mm_packs_epi32(_mm_cvtps_epi32(p), _mm_setzero_si128()));
+  }
+}
+
+void VertexQuantizer::EncodeHalf2(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride)
+{
+  const BYTE* in  = (const BYTE*)src;
+  BYTE*       out = (BYTE*)dst;
+
+  UINT i = 0;
+  for (; i + 2 <= num; i += 2)
+  {
+    const float* a = (const float*)(in + i * src_stride);
+    const float* b = (const float*)(in + (i + 1) * src_stride);
+    __m128i halfs = FloatToHalf(_mm_set_ps(b[1], b[0], a[1], a[0]));
+    halfs = _mm_packs_epi32(halfs, halfs);
+
+    int first  = _mm_cvtsi128_si32(halfs);
+    int second = _mm_cvtsi128_si32(_mm_srli_si128(halfs, 4));
+    memcpy(out + i * dst_stride, &first, sizeof(int));
+    memcpy(out + (i + 1) * dst_stride, &second, sizeof(int));
+  }
+  if (i < num)
+  {
+    const float* a = (const float*)(in + i * src_stride);
+    __m128i halfs = FloatToHalf(_mm_set_ps(0, 0, a[1], a[0]));
+    halfs = _mm_packs_epi32(halfs, halfs);
+
+    int first = _mm_cvtsi128_si32(halfs);
+    memcpy(out + i * dst_stride, &first, sizeof(int));
+  }
+}
+
+void VertexQuantizer::EncodeOctahedralSNORM8(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride)
+{
+  const BYTE*  in        = (const BYTE*)src;
+  BYTE*        out       = (BYTE*)dst;
+  const __m128 max_snorm = _mm_set1_ps(127.0f);
+
+  for (UINT i = 0; i < num; i += 4)
+  {
+    UINT count = num - i < 4 ? num - i : 4;
+
+    __m128 x, y, z, ox, oy;
+    LoadNormals(in + i * src_stride, src_stride, count, x, y, z);
+    OctahedralEncode(x, y, z, ox, oy);
+
+    // interleave x and y so the packed bytes come out as x0 y0 x1 y1 ...
+    __m128i ix     = _mm_cvtps_epi32(_mm_mul_ps(ox, max_snorm));
+    __m128i iy     = _mm_cvtps_epi32(_mm_mul_ps(oy, max_snorm));
+    __m128i words  = _mm_packs_epi32(_mm_unpacklo_epi32(ix, iy), _mm_unpackhi_epi32(ix, iy));
+    __m128i bytes  = _mm_packs_epi16(words, words);
+
+    INT16 pairs[8];
+    _mm_storeu_si128((__m128i*)pairs, bytes);
+    for (UINT j = 0; j < count; j++)
+    {
+      memcpy(out + (i + j) * dst_stride, &pairs[j], sizeof(INT16));
+    }
+  }
+}
+
+void VertexQuantizer::EncodeOctahedral1010102(const void* src, UINT src_stride, UINT num, void* dst, UINT dst_stride)
+{
+  const BYTE*  in        = (const BYTE*)src;
+  BYTE*        out       = (BYTE*)dst;
+  const __m128 half      = _mm_set1_ps(0.5f);
+  const __m128 max_unorm = _mm_set1_ps(1023.0f);
+
+  for (UINT i = 0; i < num; i += 4)
+  {
+    UINT count = num - i < 4 ? num - i : 4;
+
+    __m128 x, y, z, ox, oy;
+    LoadNormals(in + i * src_stride, src_stride, count, x, y, z);
+    OctahedralEncode(x, y, z, ox, oy);
+
+    __m128i ux = _mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ox, half), half), max_unorm));
+    __m128i uy = _mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(oy, half), half), max_unorm));
+
+    UINT packed[4];
+    _mm_storeu_si128((__m128i*)packed, _mm_or_si128(ux, _mm_slli_epi32(uy, 10)));
+    for (UINT j = 0; j < count; j++)
+    {
+      memcpy(out + (i + j) * dst_stride, &packed[j], sizeof(UINT));
+    }
+  }
+}
+
+void VertexQuantizer::Quantize(const Vertex_Position* src, UINT num, const QuantizationBounds& bounds, Vertex_PositionQ* dst)
+{
+  EncodePositions(&src->pos, sizeof(Vertex_Position), num, bounds, dst->pos, sizeof(Vertex_PositionQ));
+}
+
+void VertexQuantizer::Quantize(const Vertex_PositionTextureUV* src, UINT num, const QuantizationBounds& bounds, Vertex_PositionTextureUVQ* dst)
+{
+  EncodePositions(&src->pos, sizeof(Vertex_PositionTextureUV), num, bounds, dst->pos, sizeof(Vertex_PositionTextureUVQ));
+  EncodeHalf2(&src->uv, sizeof(Vertex_PositionTextureUV), num, dst->uv, sizeof(Vertex_PositionTextureUVQ));
+}
+
+void VertexQuantizer::Quantize(const Vertex_PositionTextureUVNormal* src, UINT num, const QuantizationBounds& bounds,
+  Vertex_PositionTextureUVNormalQ8* dst)
+{
+  EncodePositions(&src->pos, sizeof(Vertex_PositionTextureUVNormal), num, bounds, dst->pos, sizeof(Vertex_PositionTextureUVNormalQ8));
+  EncodeHalf2(&src->uv, sizeof(Vertex_PositionTextureUVNormal), num, dst->uv, sizeof(Vertex_PositionTextureUVNormalQ8));
+  EncodeOctahedralSNORM8(&src->normal, sizeof(Vertex_PositionTextureUVNormal), num, dst->normal, sizeof(Vertex_PositionTextureUVNormalQ8));
+  for (UINT i = 0; i < num; i++)
+  {
+    dst[i].padding[0] = 0;
+    dst[i].padding[1] = 0;
+  }
+}
+
+void VertexQuantizer::Quantize(const Vertex_PositionTextureUVNormal* src, UINT num, const QuantizationBounds& bounds,
+  Vertex_PositionTextureUVNormalQ10* dst)
+{
+  EncodePositions(&src->pos, sizeof(Vertex_PositionTextureUVNormal), num, bounds, dst->pos, sizeof(Vertex_PositionTextureUVNormalQ10));
+  EncodeHalf2(&src->uv, sizeof(Vertex_PositionTextureUVNormal), num, dst->uv, sizeof(Vertex_PositionTextureUVNormalQ10));
+  EncodeOctahedral1010102(&src->normal, sizeof(Vertex_PositionTextureUVNormal), num, &dst->normal, sizeof(Vertex_PositionTextureUVNormalQ10));
+}
@@ -39,6 +39,90 @@ Pipeline* Pipeline::CreateD3D12(const GraphicsCore& graphics_core, const InputLa
   return D3D12_Pipeline::Create(graphics_core, input_layout, topology, vertex_shader, stream_output, rtv_config, root_sig);
 }
 
+AsyncPipeline* Pipeline::CreateD3D12Async(const GraphicsCore& graphics_core, const InputLayout& input_layout, Topology topology, const Shader& vertex_shader,
+  const StreamOutputConfig* stream_output, const Shader& pixel_shader, const DepthStencilConfig* depth_stencil_config, const RenderTargetViewConfig& rtv_config, const RootSignature& root_sig,
+  CullMode cull_mode, UINT ms_count, UINT ms_quality, bool wireframe)
+{
+  const GraphicsCore* core = &graphics_core;
+  const InputLayout* layout = &input_layout;
+  const Shader* vs = &vertex_shader;
+  const Shader* ps = &pixel_shader;
+  const RenderTargetViewConfig* rtv = &rtv_config;
+  const RootSignature* root = &root_sig;
+  return AsyncPipeline::Create([=]()
+  {
+    return D3D12_Pipeline::Create(*core, *layout, topology, *vs, stream_output, *ps, depth_stencil_config, *rtv, *root, cull_mode, ms_count, ms_quality, wireframe);
+  });
+}
+
+AsyncPipeline* Pipeline::CreateD3D12Async(const GraphicsCore& graphics_core, const InputLayout& input_layout, Topology topology, const Shader& vertex_shader, const Shader& hull_shader,
+  const Shader& domain_shader, const StreamOutputConfig* stream_output, const Shader& pixel_shader, const DepthStencilConfig* depth_stencil_config, const RenderTargetViewConfig& rtv_config,
+  const RootSignature& root_sig, CullMode cull_mode, UINT ms_count, UINT ms_quality, bool wireframe)
+{
+  const GraphicsCore* core = &graphics_core;
+  const InputLayout* layout = &input_layout;
+  const Shader* vs = &vertex_shader;
+  const Shader* hs = &hull_shader;
+  const Shader* ds = &domain_shader;
+  const Shader* ps = &pixel_shader;
+  const RenderTargetViewConfig* rtv = &rtv_config;
+  const RootSignature* root = &root_sig;
+  return AsyncPipeline::Create([=]()
+  {
+    return D3D12_Pipeline::Create(*core, *layout, topology, *vs, *hs, *ds, stream_output, *ps, depth_stencil_config, *rtv, *root, cull_mode, ms_count, ms_quality, wireframe);
+  });
+}
+
+AsyncPipeline* Pipeline::CreateD3D12Async(const GraphicsCore& graphics_core, const InputLayout& input_layout, Topology topology, const Shader& vertex_shader, const Shader& geometry_shader,
+  const StreamOutputConfig* stream_output, const Shader& pixel_shader, const DepthStencilConfig* depth_stencil_config, const RenderTargetViewConfig& rtv_config, const RootSignature& root_sig,
+  CullMode cull_mode, UINT ms_count, UINT ms_quality, bool wireframe)
+{
+  const GraphicsCore* core = &graphics_core;
+  const InputLayout* layout = &input_layout;
+  const Shader* vs = &vertex_shader;
+  const Shader* gs = &geometry_shader;
+  const Shader* ps = &pixel_shader;
+  const RenderTargetViewConfig* rtv = &rtv_config;
+  const RootSignature* root = &root_sig;
+  return AsyncPipeline::Create([=]()
+  {
+    return D3D12_Pipeline::Create(*core, *layout, topology, *vs, *gs, stream_output, *ps, depth_stencil_config, *rtv, *root, cull_mode, ms_count, ms_quality, wireframe);
+  });
+}
+
+AsyncPipeline* Pipeline::CreateD3D12Async(const GraphicsCore& graphics_core, const InputLayout& input_layout, Topology topology, const Shader& vertex_shader, const Shader& hull_shader,
+  const Shader& domain_shader, const Shader& geometry_shader, const StreamOutputConfig* stream_output, const Shader& pixel_shader, const DepthStencilConfig* depth_stencil_config,
+  const RenderTargetViewConfig& rtv_config, const RootSignature& root_sig, CullMode cull_mode, UINT ms_count, UINT ms_quality, bool wireframe)
+{
+  const GraphicsCore* core = &graphics_core;
+  const InputLayout* layout = &input_layout;
+  const Shader* vs = &vertex_shader;
+  const Shader* hs = &hull_shader;
+  const Shader* ds = &domain_shader;
+  const Shader* gs = &geometry_shader;
+  const Shader* ps = &pixel_shader;
+  const RenderTargetViewConfig* rtv = &rtv_config;
+  const RootSignature* root = &root_sig;
+  return AsyncPipeline::Create([=]()
+  {
+    return D3D12_Pipeline::Create(*core, *layout, topology, *vs, *hs, *ds, *gs, stream_output, *ps, depth_stencil_config, *rtv, *root, cull_mode, ms_count, ms_quality, wireframe);
+  });
+}
+
+AsyncPipeline* Pipeline::CreateD3D12Async(const GraphicsCore& graphics_core, const InputLayout& input_layout, Topology topology, const Shader& vertex_shader,
+  const StreamOutputConfig* stream_output, const RenderTargetViewConfig& rtv_config, const RootSignature& root_sig)
+{
+  const GraphicsCore* core = &graphics_core;
+  const InputLayout* layout = &input_layout;
+  const Shader* vs = &vertex_shader;
+  const RenderTargetViewConfig* rtv = &rtv_config;
+  const RootSignature* root = &root_sig;
+  return AsyncPipeline::Create([=]()
+  {
+    return D3D12_Pipeline::Create(*core, *layout, topology, *vs, stream_output, *rtv, *root);
+  });
+}
+
 Pipeline::Pipeline()
 {
 }
@@ -6,6 +6,11 @@ RootSignatureConfig* RootSignatureConfig::CreateD3D12(UINT num_params, UINT num_
   return new D3D12_RootSignatureConfig(num_params, num_sampler);
 }
 
+RootSignatureConfig* RootSignatureConfig::CreateD3D12(const RootSignatureDesc& desc)
+{
+  return D3D12_RootSignatureConfig::Create(desc);
+}
+
 RootSignatureConfig::RootSignatureConfig()
 {
 }
@@ -0,0 +1,15 @@
+#include "Graphics/ShaderArchive.h"
+#include "private_inc/D3D12/D3D12_ShaderArchive.h"
+
+ShaderArchive* ShaderArchive::OpenD3D12(const char* path)
+{
+  return D3D12_ShaderArchive::Open(path);
+}
+
+ShaderArchive::ShaderArchive()
+{
+}
+
+ShaderArchive::~ShaderArchive()
+{
+}
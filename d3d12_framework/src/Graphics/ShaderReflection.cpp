@@ -0,0 +1,552 @@
+#include <limits.h>
+#include <sstream>
+#include <string.h>
+#include "Graphics/ShaderReflection.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Builds the four character code that identifies a container chunk
+/// </summary>
+static UINT FourCC(char a, char b, char c, char d)
+{
+  return (UINT)(UINT8)a | ((UINT)(UINT8)b << 8) | ((UINT)(UINT8)c << 16) | ((UINT)(UINT8)d << 24);
+}
+
+/// <summary>
+/// Reads a 32-bit value from a chunk, checking that it lies within the chunk
+/// </summary>
+/// <param name="data">
+/// start of the chunk data
+/// </param>
+/// <param name="size">
+/// size of the chunk data, in bytes
+/// </param>
+/// <param name="offset">
+/// offset of the value from the start of the chunk data
+/// </param>
+/// <returns>
+/// the value
+/// </returns>
+/// <exception cref="FrameworkException">
+/// Thrown when the value extends beyond the end of the chunk
+/// </exception>
+static UINT ReadUINT(const UINT8* data, UINT size, UINT64 offset)
+{
+  if (offset + sizeof(UINT) > size)
+  {
+    throw FrameworkException("Shader container chunk is truncated");
+  }
+
+  UINT value;
+  memcpy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+/// <summary>
+/// Reads a 32-bit float from a chunk, checking that it lies within the chunk
+/// </summary>
+static float ReadFloat(const UINT8* data, UINT size, UINT64 offset)
+{
+  UINT bits = ReadUINT(data, size, offset);
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/// <summary>
+/// Reads a null terminated string from a chunk, checking that it lies within the chunk
+/// </summary>
+/// <param name="data">
+/// start of the chunk data
+/// </param>
+/// <param name="size">
+/// size of the chunk data, in bytes
+/// </param>
+/// <param name="offset">
+/// offset of the string from the start of the chunk data
+/// </param>
+/// <returns>
+/// the string
+/// </returns>
+/// <exception cref="FrameworkException">
+/// Thrown when the string is not terminated before the end of the chunk
+/// </exception>
+static string ReadString(const UINT8* data, UINT size, UINT offset)
+{
+  if (offset >= size)
+  {
+    throw FrameworkException("Shader container string is out of range");
+  }
+
+  const char* start = (const char*)data + offset;
+  const void* end = memchr(start, '\0', size - offset);
+  if (end == NULL)
+  {
+    throw FrameworkException("Shader container string is not terminated");
+  }
+  return string(start, (const char*)end);
+}
+
+/// <summary>
+/// Parses an input or output signature chunk
+/// </summary>
+/// <param name="data">
+/// start of the chunk data
+/// </param>
+/// <param name="size">
+/// size of the chunk data, in bytes
+/// </param>
+/// <param name="element_size">
+/// size of each element.  24 for ISGN/OSGN, 28 for OSG5 and 32 for ISG1/OSG1/PSG1
+/// </param>
+/// <param name="elements">
+/// receives the elements
+/// </param>
+static void ParseSignature(const UINT8* data, UINT size, UINT element_size, vector<ShaderSignatureElement>& elements)
+{
+  const UINT num_elements = ReadUINT(data, size, 0);
+  const UINT first        = ReadUINT(data, size, 4);
+
+  // the larger layouts prefix the 24 byte layout with the stream index
+  const UINT base = element_size == 24 ? 0 : 4;
+
+  elements.resize(num_elements);
+  for (UINT i = 0; i < num_elements; i++)
+  {
+    const UINT64 offset = first + (UINT64)i * element_size;
+    if (offset + element_size > size)
+    {
+      throw FrameworkException("Shader signature extends beyond the end of its chunk");
+    }
+
+    ShaderSignatureElement& element = elements[i];
+    element.stream         = base == 0 ? 0 : ReadUINT(data, size, offset);
+    element.semantic_name  = ReadString(data, size, ReadUINT(data, size, offset + base));
+    element.semantic_index = ReadUINT(data, size, offset + base + 4);
+    element.system_value   = ReadUINT(data, size, offset + base + 8);
+    element.component_type = (ShaderComponentType)ReadUINT(data, size, offset + base + 12);
+    element.register_index = ReadUINT(data, size, offset + base + 16);
+    element.mask           = data[offset + base + 20];
+    element.rw_mask        = data[offset + base + 21];
+  }
+}
+
+/// <summary>
+/// Parses the resource definition chunk that fxc writes into DXBC shaders
+/// </summary>
+/// <param name="data">
+/// start of the chunk data
+/// </param>
+/// <param name="size">
+/// size of the chunk data, in bytes
+/// </param>
+/// <param name="constant_buffers">
+/// receives the constant buffers
+/// </param>
+/// <param name="resources">
+/// receives the resource bindings
+/// </param>
+static void ParseResourceDefinitions(const UINT8* data, UINT size, vector<ShaderConstantBufferInfo>& constant_buffers, vector<ShaderResourceBinding>& resources)
+{
+  const UINT num_cbs      = ReadUINT(data, size, 0);
+  const UINT cb_offset    = ReadUINT(data, size, 4);
+  const UINT num_bindings = ReadUINT(data, size, 8);
+  const UINT bind_offset  = ReadUINT(data, size, 12);
+  const UINT version      = ReadUINT(data, size, 16);
+  const UINT minor        = version & 0xff;
+  const UINT major        = (version >> 8) & 0xff;
+
+  // shader model 5.1 added the register space and resource ID to each binding
+  const bool has_space = major > 5 || (major == 5 && minor >= 1);
+  const UINT bind_size = has_space ? 40 : 32;
+
+  constant_buffers.resize(num_cbs);
+  for (UINT i = 0; i < num_cbs; i++)
+  {
+    const UINT64 offset = cb_offset + (UINT64)i * 24;
+    ShaderConstantBufferInfo& cb = constant_buffers[i];
+    cb.name          = ReadString(data, size, ReadUINT(data, size, offset));
+    cb.num_variables = ReadUINT(data, size, offset + 4);
+    cb.size          = ReadUINT(data, size, offset + 12);
+  }
+
+  resources.resize(num_bindings);
+  for (UINT i = 0; i < num_bindings; i++)
+  {
+    const UINT64 offset = bind_offset + (UINT64)i * bind_size;
+    ShaderResourceBinding& binding = resources[i];
+    binding.name       = ReadString(data, size, ReadUINT(data, size, offset));
+    binding.type       = (ShaderResourceType)ReadUINT(data, size, offset + 4);
+    binding.bind_point = ReadUINT(data, size, offset + 20);
+    binding.bind_count = ReadUINT(data, size, offset + 24);
+    binding.space      = has_space ? ReadUINT(data, size, offset + 32) : 0;
+  }
+}
+
+/// <summary>
+/// Parses the resource bindings out of the pipeline state validation chunk that dxc writes into DXIL shaders
+/// </summary>
+/// <param name="data">
+/// start of the chunk data
+/// </param>
+/// <param name="size">
+/// size of the chunk data, in bytes
+/// </param>
+/// <param name="resources">
+/// receives the resource bindings
+/// </param>
+static void ParsePipelineStateValidation(const UINT8* data, UINT size, vector<ShaderResourceBinding>& resources)
+{
+  // maps PSVResourceType to the D3D_SHADER_INPUT_TYPE based enum
+  static const ShaderResourceType convert[] =
+  {
+    SHADER_RESOURCE_CBUFFER,                       // Invalid, skipped below
+    SHADER_RESOURCE_SAMPLER,                       // Sampler
+    SHADER_RESOURCE_CBUFFER,                       // CBV
+    SHADER_RESOURCE_TEXTURE,                       // SRVTyped
+    SHADER_RESOURCE_BYTEADDRESS,                   // SRVRaw
+    SHADER_RESOURCE_STRUCTURED,                    // SRVStructured
+    SHADER_RESOURCE_UAV_RWTYPED,                   // UAVTyped
+    SHADER_RESOURCE_UAV_RWBYTEADDRESS,             // UAVRaw
+    SHADER_RESOURCE_UAV_RWSTRUCTURED,              // UAVStructured
+    SHADER_RESOURCE_UAV_RWSTRUCTURED_WITH_COUNTER  // UAVStructuredWithCounter
+  };
+
+  // runtime info is size prefixed and grows with each validator version, so skip over it
+  const UINT64 runtime_info_size = ReadUINT(data, size, 0);
+  const UINT64 count_offset = 4 + runtime_info_size;
+  const UINT num_resources = ReadUINT(data, size, count_offset);
+  if (num_resources == 0)
+  {
+    return;
+  }
+  const UINT bind_size = ReadUINT(data, size, count_offset + 4);
+  if (bind_size < 16)
+  {
+    throw FrameworkException("Shader pipeline state validation chunk has an unknown resource layout");
+  }
+
+  resources.reserve(num_resources);
+  for (UINT i = 0; i < num_resources; i++)
+  {
+    const UINT64 offset = count_offset + 8 + (UINT64)i * bind_size;
+    const UINT type  = ReadUINT(data, size, offset);
+    const UINT space = ReadUINT(data, size, offset + 4);
+    const UINT lower = ReadUINT(data, size, offset + 8);
+    const UINT upper = ReadUINT(data, size, offset + 12);
+    if (type == 0 || type >= sizeof(convert) / sizeof(convert[0]))
+    {
+      continue;
+    }
+
+    ShaderResourceBinding binding;
+    binding.type       = convert[type];
+    binding.bind_point = lower;
+    binding.bind_count = upper == UINT_MAX ? 0 : upper - lower + 1;
+    binding.space      = space;
+    resources.push_back(binding);
+  }
+}
+
+/// <summary>
+/// Picks the format of an input element from its component type and the components it occupies
+/// </summary>
+/// <param name="element">
+/// element to pick the format for
+/// </param>
+/// <returns>
+/// the format
+/// </returns>
+/// <exception cref="FrameworkException">
+/// Thrown when the element has an unknown component type
+/// </exception>
+static GraphicsDataFormat GetElementFormat(const ShaderSignatureElement& element)
+{
+  static const GraphicsDataFormat formats[3][4] =
+  {
+    { R32_UINT,  R32G32_UINT,  R32G32B32_UINT,  R32G32B32A32_UINT  },
+    { R32_SINT,  R32G32_SINT,  R32G32B32_SINT,  R32G32B32A32_SINT  },
+    { R32_FLOAT, R32G32_FLOAT, R32G32B32_FLOAT, R32G32B32A32_FLOAT }
+  };
+
+  if (element.component_type < SHADER_COMPONENT_UINT32 || element.component_type > SHADER_COMPONENT_FLOAT32)
+  {
+    ostringstream out;
+    out << "Input element " << element.semantic_name << element.semantic_index << " has an unsupported component type";
+    throw FrameworkException(out.str());
+  }
+
+  // the highest component used decides the width, since the element always starts at x in a vertex buffer
+  UINT num_components = 1;
+  for (UINT i = 0; i < 4; i++)
+  {
+    if (element.mask & (1 << i))
+    {
+      num_components = i + 1;
+    }
+  }
+  return formats[element.component_type - SHADER_COMPONENT_UINT32][num_components - 1];
+}
+
+ShaderReflection* ShaderReflection::Parse(const void* bytecode, size_t size)
+{
+  const UINT8* data = (const UINT8*)bytecode;
+  if (data == NULL || size < 32 || size > UINT_MAX || ReadUINT(data, (UINT)size, 0) != FourCC('D', 'X', 'B', 'C'))
+  {
+    throw FrameworkException("Shader bytecode is not a DXBC container");
+  }
+
+  const UINT container_size = (UINT)size;
+  if (ReadUINT(data, container_size, 24) > container_size)
+  {
+    throw FrameworkException("Shader container is truncated");
+  }
+
+  ShaderReflection* reflection = new ShaderReflection();
+  try
+  {
+    bool has_rdef = false;
+    const UINT num_chunks = ReadUINT(data, container_size, 28);
+    for (UINT i = 0; i < num_chunks; i++)
+    {
+      const UINT chunk_offset = ReadUINT(data, container_size, 32 + (UINT64)i * 4);
+      const UINT fourcc       = ReadUINT(data, container_size, chunk_offset);
+      const UINT chunk_size   = ReadUINT(data, container_size, chunk_offset + (UINT64)4);
+      if (chunk_offset + (UINT64)8 + chunk_size > container_size)
+      {
+        throw FrameworkException("Shader container chunk extends beyond the end of the container");
+      }
+      const UINT8* chunk = data + chunk_offset + 8;
+
+      if (fourcc == FourCC('I', 'S', 'G', 'N'))
+      {
+        ParseSignature(chunk, chunk_size, 24, reflection->m_inputs);
+      }
+      else if (fourcc == FourCC('I', 'S', 'G', '1'))
+      {
+        ParseSignature(chunk, chunk_size, 32, reflection->m_inputs);
+      }
+      else if (fourcc == FourCC('O', 'S', 'G', 'N'))
+      {
+        ParseSignature(chunk, chunk_size, 24, reflection->m_outputs);
+      }
+      else if (fourcc == FourCC('O', 'S', 'G', '5'))
+      {
+        ParseSignature(chunk, chunk_size, 28, reflection->m_outputs);
+      }
+      else if (fourcc == FourCC('O', 'S', 'G', '1'))
+      {
+        ParseSignature(chunk, chunk_size, 32, reflection->m_outputs);
+      }
+      else if (fourcc == FourCC('R', 'D', 'E', 'F'))
+      {
+        reflection->m_resources.clear();
+        ParseResourceDefinitions(chunk, chunk_size, reflection->m_constant_buffers, reflection->m_resources);
+        has_rdef = true;
+      }
+      else if (fourcc == FourCC('P', 'S', 'V', '0') && !has_rdef)
+      {
+        // only used when there is no RDEF, since it has no names or constant buffer sizes
+        reflection->m_resources.clear();
+        ParsePipelineStateValidation(chunk, chunk_size, reflection->m_resources);
+      }
+      else if (fourcc == FourCC('R', 'T', 'S', '0'))
+      {
+        reflection->m_root_signature.assign(chunk, chunk + chunk_size);
+      }
+    }
+  }
+  catch (...)
+  {
+    delete reflection;
+    throw;
+  }
+
+  return reflection;
+}
+
+ShaderReflection::ShaderReflection()
+{
+}
+
+ShaderReflection::~ShaderReflection()
+{
+}
+
+const vector<ShaderSignatureElement>& ShaderReflection::GetInputs() const
+{
+  return m_inputs;
+}
+
+const vector<ShaderSignatureElement>& ShaderReflection::GetOutputs() const
+{
+  return m_outputs;
+}
+
+const vector<ShaderConstantBufferInfo>& ShaderReflection::GetConstantBuffers() const
+{
+  return m_constant_buffers;
+}
+
+const vector<ShaderResourceBinding>& ShaderReflection::GetResources() const
+{
+  return m_resources;
+}
+
+bool ShaderReflection::HasRootSignature() const
+{
+  return !m_root_signature.empty();
+}
+
+InputLayout* ShaderReflection::CreateInputLayoutD3D12(UINT input_slot) const
+{
+  // resolve everything first so a bad element does not leak a partially filled layout
+  vector<Semantics> semantics;
+  vector<GraphicsDataFormat> formats;
+  vector<UINT> indices;
+  for (vector<ShaderSignatureElement>::const_iterator it = m_inputs.begin(); it != m_inputs.end(); ++it)
+  {
+    if (it->system_value != 0)
+    {
+      continue;
+    }
+
+    Semantics sem;
+    if (!GetSemanticFromName(it->semantic_name.c_str(), sem))
+    {
+      ostringstream out;
+      out << "Input element " << it->semantic_name << it->semantic_index << " does not use a known semantic";
+      throw FrameworkException(out.str());
+    }
+    semantics.push_back(sem);
+    formats.push_back(GetElementFormat(*it));
+    indices.push_back(it->semantic_index);
+  }
+
+  InputLayout* layout = InputLayout::CreateD3D12((UINT)semantics.size());
+  for (size_t i = 0; i < semantics.size(); i++)
+  {
+    layout->SetNextElement(semantics[i], indices[i], formats[i], input_slot, false);
+  }
+  return layout;
+}
+
+RootSignatureConfig* ShaderReflection::CreateRootSignatureConfigD3D12() const
+{
+  if (m_root_signature.empty())
+  {
+    throw FrameworkException("Shader does not have an embedded root signature");
+  }
+
+  const UINT8* data = &m_root_signature[0];
+  const UINT size = (UINT)m_root_signature.size();
+  const UINT version = ReadUINT(data, size, 0);
+  if (version != 1 && version != 2)
+  {
+    ostringstream out;
+    out << "Unsupported root signature version " << version;
+    throw FrameworkException(out.str());
+  }
+
+  // version 1.1 adds flags to each root descriptor and range
+  const UINT descriptor_size = version == 1 ? 8 : 12;
+  const UINT range_size      = version == 1 ? 20 : 24;
+
+  const UINT num_params     = ReadUINT(data, size, 4);
+  const UINT params_offset  = ReadUINT(data, size, 8);
+  const UINT num_samplers   = ReadUINT(data, size, 12);
+  const UINT sampler_offset = ReadUINT(data, size, 16);
+  const UINT flags          = ReadUINT(data, size, 20);
+
+  RootSignatureConfig* config = RootSignatureConfig::CreateD3D12(num_params, num_samplers);
+  try
+  {
+    config->SetStageAccess((flags & 0x1) != 0, (flags & 0x2) == 0, (flags & 0x4) == 0, (flags & 0x8) == 0, (flags & 0x10) == 0, (flags & 0x20) == 0, (flags & 0x40) != 0);
+
+    for (UINT i = 0; i < num_params; i++)
+    {
+      const UINT64 offset = params_offset + (UINT64)i * 12;
+      const UINT type                    = ReadUINT(data, size, offset);
+      const ShaderVisibility visibility  = (ShaderVisibility)ReadUINT(data, size, offset + 4);
+      const UINT payload                 = ReadUINT(data, size, offset + 8);
+
+      // a table is a range count and offset, and root constants are a register, space and count.  Only root
+      // descriptors grow flags in version 1.1
+      const UINT payload_size = type == 0 ? 8 : (type == 1 ? 12 : descriptor_size);
+      if (payload + (UINT64)payload_size > size)
+      {
+        throw FrameworkException("Root signature parameter extends beyond the end of the chunk");
+      }
+      const RootDescriptorFlags descriptor_flags = type < 2 || version == 1 ? ROOT_FLAGS_VOLATILE : (RootDescriptorFlags)ReadUINT(data, size, payload + (UINT64)8);
+
+      switch (type)
+      {
+        case 0:
+        {
+          const UINT num_ranges    = ReadUINT(data, size, payload);
+          const UINT ranges_offset = ReadUINT(data, size, payload + (UINT64)4);
+          config->SetParamAsDescriptorTable(i, num_ranges, visibility);
+          for (UINT j = 0; j < num_ranges; j++)
+          {
+            const UINT64 range = ranges_offset + (UINT64)j * range_size;
+            const UINT range_type     = ReadUINT(data, size, range);
+            const UINT num            = ReadUINT(data, size, range + 4);
+            const UINT base_register  = ReadUINT(data, size, range + 8);
+            const UINT register_space = ReadUINT(data, size, range + 12);
+            const RootDescriptorFlags range_flags = version == 1 ? ROOT_FLAGS_VOLATILE : (RootDescriptorFlags)ReadUINT(data, size, range + 16);
+            switch (range_type)
+            {
+              case 0:
+                config->SetRangeAsShaderResourceView(i, j, num, base_register, register_space, range_flags);
+                break;
+              case 1:
+                config->SetRangeAsUnorderedAccessView(i, j, num, base_register, register_space, range_flags);
+                break;
+              case 2:
+                config->SetRangeAsConstantBufferView(i, j, num, base_register, register_space, range_flags);
+                break;
+              case 3:
+                config->SetRangeAsSampler(i, j, num, base_register, register_space, range_flags);
+                break;
+              default:
+                throw FrameworkException("Root signature has an unknown descriptor range type");
+            }
+          }
+          break;
+        }
+        case 1:
+          config->SetParamAsConstants(i, ReadUINT(data, size, payload), ReadUINT(data, size, payload + (UINT64)4), ReadUINT(data, size, payload + (UINT64)8), visibility);
+          break;
+        case 2:
+          config->SetParamAsConstantBufferView(i, ReadUINT(data, size, payload), ReadUINT(data, size, payload + (UINT64)4), visibility, descriptor_flags);
+          break;
+        case 3:
+          config->SetParamAsShaderResourceView(i, ReadUINT(data, size, payload), ReadUINT(data, size, payload + (UINT64)4), visibility, descriptor_flags);
+          break;
+        case 4:
+          config->SetParamAsUnorderedAccessView(i, ReadUINT(data, size, payload), ReadUINT(data, size, payload + (UINT64)4), visibility, descriptor_flags);
+          break;
+        default:
+          throw FrameworkException("Root signature has an unknown parameter type");
+      }
+    }
+
+    for (UINT i = 0; i < num_samplers; i++)
+    {
+      const UINT64 offset = sampler_offset + (UINT64)i * 52;
+      config->SetSampler(i, (TextureFilters)ReadUINT(data, size, offset), (TextureAddressMode)ReadUINT(data, size, offset + 4),
+        (TextureAddressMode)ReadUINT(data, size, offset + 8), (TextureAddressMode)ReadUINT(data, size, offset + 12), ReadFloat(data, size, offset + 16),
+        ReadUINT(data, size, offset + 20), (CompareFuncs)ReadUINT(data, size, offset + 24), (TextureBorderColor)ReadUINT(data, size, offset + 28),
+        ReadFloat(data, size, offset + 32), ReadFloat(data, size, offset + 36), ReadUINT(data, size, offset + 40), ReadUINT(data, size, offset + 44),
+        (ShaderVisibility)ReadUINT(data, size, offset + 48));
+    }
+  }
+  catch (...)
+  {
+    delete config;
+    throw;
+  }
+
+  return config;
+}
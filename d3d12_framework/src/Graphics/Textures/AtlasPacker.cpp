@@ -0,0 +1,174 @@
+#include <limits.h>
+#include <algorithm>
+#include "Graphics/Textures/AtlasPacker.h"
+using namespace std;
+
+/// <summary>
+/// Checks if a rectangle is inside of another one
+/// </summary>
+/// <param name="inner">
+/// rectangle that may be inside
+/// </param>
+/// <param name="outer">
+/// rectangle that may contain it
+/// </param>
+/// <returns>
+/// true if inner is inside of outer, including when they are the same
+/// </returns>
+static bool Contains(const AtlasRect& outer, const AtlasRect& inner)
+{
+  return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+AtlasPacker::AtlasPacker(UINT width, UINT height)
+:m_width(width),
+ m_height(height)
+{
+  Reset();
+}
+
+AtlasPacker::~AtlasPacker()
+{
+}
+
+bool AtlasPacker::Insert(UINT width, UINT height, AtlasRect& rect)
+{
+  if (width == 0 || height == 0)
+  {
+    rect.x      = 0;
+    rect.y      = 0;
+    rect.width  = width;
+    rect.height = height;
+    return true;
+  }
+
+  // best short side fit, with the long side leftover breaking ties
+  size_t best       = m_free.size();
+  UINT   best_short = UINT_MAX;
+  UINT   best_long  = UINT_MAX;
+  for (size_t i = 0; i < m_free.size(); i++)
+  {
+    const AtlasRect& free_rect = m_free[i];
+    if (free_rect.width < width || free_rect.height < height)
+    {
+      continue;
+    }
+
+    UINT leftover_x = free_rect.width - width;
+    UINT leftover_y = free_rect.height - height;
+    UINT short_side = min(leftover_x, leftover_y);
+    UINT long_side  = max(leftover_x, leftover_y);
+    if (short_side < best_short || (short_side == best_short && long_side < best_long))
+    {
+      best       = i;
+      best_short = short_side;
+      best_long  = long_side;
+    }
+  }
+  if (best == m_free.size())
+  {
+    return false;
+  }
+
+  rect.x      = m_free[best].x;
+  rect.y      = m_free[best].y;
+  rect.width  = width;
+  rect.height = height;
+
+  vector<AtlasRect> split;
+  SplitFreeRects(rect, split);
+  AddSplitRects(split);
+  m_used_area += (UINT64)width * height;
+  return true;
+}
+
+void AtlasPacker::Reset()
+{
+  AtlasRect page = { 0, 0, m_width, m_height };
+  m_free.assign(1, page);
+  m_used_area = 0;
+}
+
+UINT AtlasPacker::GetWidth() const
+{
+  return m_width;
+}
+
+UINT AtlasPacker::GetHeight() const
+{
+  return m_height;
+}
+
+float AtlasPacker::GetOccupancy() const
+{
+  return (float)((double)m_used_area / ((double)m_width * m_height));
+}
+
+void AtlasPacker::SplitFreeRects(const AtlasRect& used, vector<AtlasRect>& split)
+{
+  UINT used_right  = used.x + used.width;
+  UINT used_bottom = used.y + used.height;
+
+  size_t i = 0;
+  while (i < m_free.size())
+  {
+    AtlasRect free_rect   = m_free[i];
+    UINT      free_right  = free_rect.x + free_rect.width;
+    UINT      free_bottom = free_rect.y + free_rect.height;
+    if (used.x >= free_right || used_right <= free_rect.x || used.y >= free_bottom || used_bottom <= free_rect.y)
+    {
+      i++;
+      continue;
+    }
+
+    // each side of the free rectangle that the used one does not reach keeps a maximal strip of free space
+    if (used.x > free_rect.x)
+    {
+      AtlasRect left = { free_rect.x, free_rect.y, used.x - free_rect.x, free_rect.height };
+      split.push_back(left);
+    }
+    if (used_right < free_right)
+    {
+      AtlasRect right = { used_right, free_rect.y, free_right - used_right, free_rect.height };
+      split.push_back(right);
+    }
+    if (used.y > free_rect.y)
+    {
+      AtlasRect top = { free_rect.x, free_rect.y, free_rect.width, used.y - free_rect.y };
+      split.push_back(top);
+    }
+    if (used_bottom < free_bottom)
+    {
+      AtlasRect bottom = { free_rect.x, used_bottom, free_rect.width, free_bottom - used_bottom };
+      split.push_back(bottom);
+    }
+
+    m_free[i] = m_free.back();
+    m_free.pop_back();
+  }
+}
+
+void AtlasPacker::AddSplitRects(const vector<AtlasRect>& split)
+{
+  size_t num_unsplit = m_free.size();
+  for (size_t i = 0; i < split.size(); i++)
+  {
+    bool contained = false;
+    for (size_t j = 0; j < num_unsplit && !contained; j++)
+    {
+      contained = Contains(m_free[j], split[i]);
+    }
+
+    // of 2 identical rectangles, only the first is kept
+    for (size_t j = 0; j < split.size() && !contained; j++)
+    {
+      contained = (j != i) && Contains(split[j], split[i]) && (j < i || !Contains(split[i], split[j]));
+    }
+
+    if (!contained)
+    {
+      m_free.push_back(split[i]);
+    }
+  }
+}
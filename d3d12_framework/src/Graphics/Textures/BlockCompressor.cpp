@@ -0,0 +1,1457 @@
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+#include <emmintrin.h>
+#include "Graphics/Textures/BlockCompressor.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Number of texels in each block
+/// </summary>
+static const UINT TEXELS_PER_BLOCK = 16;
+
+/// <summary>
+/// Approximate number of blocks each job on a worker thread encodes
+/// </summary>
+static const UINT BLOCKS_PER_JOB = 64;
+
+/// <summary>
+/// How the low bit of BC7 endpoints is stored
+/// </summary>
+enum PBitMode
+{
+  /// <summary>
+  /// no low bit, the endpoint bits are expanded as is
+  /// </summary>
+  PBIT_NONE,
+
+  /// <summary>
+  /// each endpoint has its own low bit
+  /// </summary>
+  PBIT_UNIQUE,
+
+  /// <summary>
+  /// both endpoints of a subset share 1 low bit
+  /// </summary>
+  PBIT_SHARED
+};
+
+/// <summary>
+/// Texels of a block as floats in [0, 255].  Stored channel by channel so 4 texels load at once
+/// </summary>
+struct TexelBlock
+{
+  /// <summary>
+  /// value of each channel of each texel, in row major texel order
+  /// </summary>
+  float channels[4][TEXELS_PER_BLOCK];
+};
+
+/// <summary>
+/// Quantized endpoints of 1 BC7 subset
+/// </summary>
+struct BC7Endpoints
+{
+  /// <summary>
+  /// bits of each channel of each endpoint, without the p-bit
+  /// </summary>
+  UINT8 values[2][4];
+
+  /// <summary>
+  /// p-bit of each endpoint.  Both are the same for shared p-bits
+  /// </summary>
+  UINT8 pbits[2];
+};
+
+/// <summary>
+/// Which subset each texel belongs to for each 2 subset BC7 partition, 1 bit per texel with texel 0 in the lowest bit
+/// </summary>
+static const UINT16 BC7_PARTITIONS_2[64] =
+{
+  0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+  0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+  0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+  0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+
+/// <summary>
+/// Texel whose index has an implied high bit of 0 in the second subset of each 2 subset BC7 partition
+/// </summary>
+static const UINT8 BC7_ANCHORS_2[64] =
+{
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+  15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+   6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+};
+
+/// <summary>
+/// Squared error of a BC7 block, summed over its texels and channels, above which NORMAL quality tries splitting it
+/// into 2 subsets.  About what noise of a few levels in each color channel, as photos have, leaves after mode 5, which
+/// splitting does little for
+/// </summary>
+static const float BC7_SPLIT_ERROR = 200;
+
+/// <summary>
+/// BC7 interpolation weights out of 64 for 2, 3 and 4 bit indices
+/// </summary>
+static const UINT8 BC7_WEIGHTS_2[4]  = { 0, 21, 43, 64 };
+static const UINT8 BC7_WEIGHTS_3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const UINT8 BC7_WEIGHTS_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+/// <summary>
+/// Writes the fields of a block, starting at the lowest bit of the first byte
+/// </summary>
+struct BitWriter
+{
+  BitWriter(UINT8* dst, UINT num_bytes)
+  :m_dst(dst),
+   m_pos(0)
+  {
+    memset(dst, 0, num_bytes);
+  }
+
+  void Write(UINT value, UINT num_bits)
+  {
+    for (UINT i = 0; i < num_bits; i++, m_pos++)
+    {
+      m_dst[m_pos >> 3] |= (UINT8)(((value >> i) & 1) << (m_pos & 7));
+    }
+  }
+
+  UINT8* m_dst;
+  UINT   m_pos;
+};
+
+/// <summary>
+/// Reads a block of texels, repeating the edge texels where the block extends past the image
+/// </summary>
+static void LoadBlock(const UINT8* src, UINT width, UINT height, UINT row_pitch, UINT block_x, UINT block_y, TexelBlock& block)
+{
+  for (UINT y = 0; y < BlockCompressor::BLOCK_DIM; y++)
+  {
+    const UINT8* row = src + (size_t)min(block_y * BlockCompressor::BLOCK_DIM + y, height - 1) * row_pitch;
+    for (UINT x = 0; x < BlockCompressor::BLOCK_DIM; x++)
+    {
+      const UINT8* texel = row + min(block_x * BlockCompressor::BLOCK_DIM + x, width - 1) * 4;
+      for (UINT c = 0; c < 4; c++)
+      {
+        block.channels[c][y * BlockCompressor::BLOCK_DIM + x] = texel[c];
+      }
+    }
+  }
+}
+
+/// <summary>
+/// Finds the nearest palette entry for each texel, 4 texels at a time
+/// </summary>
+/// <param name="block">
+/// texels to match
+/// </param>
+/// <param name="texel_weights">
+/// how much the error of each texel counts, 0 to leave it out.  NULL to count every texel fully
+/// </param>
+/// <param name="first_channel">
+/// first channel to compare
+/// </param>
+/// <param name="num_channels">
+/// number of channels to compare
+/// </param>
+/// <param name="palette">
+/// values each texel can take
+/// </param>
+/// <param name="num_entries">
+/// number of entries in the palette
+/// </param>
+/// <param name="indices">
+/// output parameter for the palette entry of each texel
+/// </param>
+/// <returns>
+/// sum of the squared errors of every texel
+/// </returns>
+static float SelectIndices(const TexelBlock& block, const float* texel_weights, UINT first_channel, UINT num_channels, const float (*palette)[4],
+  UINT num_entries, UINT8* indices)
+{
+  float total = 0;
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t += 4)
+  {
+    __m128 best_error = _mm_set1_ps(FLT_MAX);
+    __m128 best_index = _mm_setzero_ps();
+    for (UINT e = 0; e < num_entries; e++)
+    {
+      __m128 error = _mm_setzero_ps();
+      for (UINT c = first_channel; c < first_channel + num_channels; c++)
+      {
+        __m128 diff = _mm_sub_ps(_mm_loadu_ps(&block.channels[c][t]), _mm_set1_ps(palette[e][c]));
+        error = _mm_add_ps(error, _mm_mul_ps(diff, diff));
+      }
+      __m128 closer = _mm_cmplt_ps(error, best_error);
+      best_error = _mm_min_ps(error, best_error);
+      best_index = _mm_or_ps(_mm_and_ps(closer, _mm_set1_ps((float)e)), _mm_andnot_ps(closer, best_index));
+    }
+    if (texel_weights != NULL)
+    {
+      best_error = _mm_mul_ps(best_error, _mm_loadu_ps(texel_weights + t));
+    }
+
+    float errors[4];
+    float index[4];
+    _mm_storeu_ps(errors, best_error);
+    _mm_storeu_ps(index, best_index);
+    for (UINT i = 0; i < 4; i++)
+    {
+      indices[t + i] = (UINT8)index[i];
+      total += errors[i];
+    }
+  }
+  return total;
+}
+
+/// <summary>
+/// Finds the line that best fits a set of texels, as the 2 points on it that bound the texels
+/// </summary>
+/// <param name="block">
+/// texels to fit
+/// </param>
+/// <param name="texel_weights">
+/// 1 for texels to include, 0 for texels to leave out.  NULL to include every texel
+/// </param>
+/// <param name="first_channel">
+/// first channel to fit
+/// </param>
+/// <param name="num_channels">
+/// number of channels to fit
+/// </param>
+/// <param name="endpoints">
+/// output parameter for the ends of the line
+/// </param>
+static void FitLine(const TexelBlock& block, const float* texel_weights, UINT first_channel, UINT num_channels, float endpoints[2][4])
+{
+  float count = 0;
+  float mean[4] = { 0, 0, 0, 0 };
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    float weight = texel_weights != NULL ? texel_weights[t] : 1;
+    count += weight;
+    for (UINT c = 0; c < num_channels; c++)
+    {
+      mean[c] += weight * block.channels[first_channel + c][t];
+    }
+  }
+  if (count == 0)
+  {
+    memset(endpoints, 0, sizeof(float) * 2 * 4);
+    return;
+  }
+  for (UINT c = 0; c < num_channels; c++)
+  {
+    mean[c] /= count;
+  }
+
+  float cov[4][4] = {};
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    float weight = texel_weights != NULL ? texel_weights[t] : 1;
+    for (UINT i = 0; i < num_channels; i++)
+    {
+      float di = block.channels[first_channel + i][t] - mean[i];
+      for (UINT j = i; j < num_channels; j++)
+      {
+        cov[i][j] += weight * di * (block.channels[first_channel + j][t] - mean[j]);
+      }
+    }
+  }
+
+  // power iteration for the principal axis, starting from the channel with the most variance so the start is
+  // never perpendicular to the answer
+  UINT largest = 0;
+  for (UINT i = 0; i < num_channels; i++)
+  {
+    for (UINT j = 0; j < i; j++)
+    {
+      cov[i][j] = cov[j][i];
+    }
+    if (cov[i][i] > cov[largest][largest])
+    {
+      largest = i;
+    }
+  }
+  float axis[4] = { 0, 0, 0, 0 };
+  for (UINT i = 0; i < num_channels; i++)
+  {
+    axis[i] = cov[largest][i];
+  }
+  for (UINT iter = 0; iter < 8; iter++)
+  {
+    float next[4] = { 0, 0, 0, 0 };
+    float len     = 0;
+    for (UINT i = 0; i < num_channels; i++)
+    {
+      for (UINT j = 0; j < num_channels; j++)
+      {
+        next[i] += cov[i][j] * axis[j];
+      }
+      len = max(len, fabsf(next[i]));
+    }
+    if (len == 0)
+    {
+      break;
+    }
+    for (UINT i = 0; i < num_channels; i++)
+    {
+      axis[i] = next[i] / len;
+    }
+  }
+
+  float len_sq = 0;
+  for (UINT i = 0; i < num_channels; i++)
+  {
+    len_sq += axis[i] * axis[i];
+  }
+  float min_t = 0;
+  float max_t = 0;
+  if (len_sq > 0)
+  {
+    min_t = FLT_MAX;
+    max_t = -FLT_MAX;
+    for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+    {
+      if (texel_weights != NULL && texel_weights[t] == 0)
+      {
+        continue;
+      }
+      float proj = 0;
+      for (UINT c = 0; c < num_channels; c++)
+      {
+        proj += (block.channels[first_channel + c][t] - mean[c]) * axis[c];
+      }
+      proj /= len_sq;
+      min_t = min(min_t, proj);
+      max_t = max(max_t, proj);
+    }
+  }
+  for (UINT c = 0; c < num_channels; c++)
+  {
+    endpoints[0][first_channel + c] = min(max(mean[c] + min_t * axis[c], 0.0f), 255.0f);
+    endpoints[1][first_channel + c] = min(max(mean[c] + max_t * axis[c], 0.0f), 255.0f);
+  }
+}
+
+/// <summary>
+/// Solves for the endpoints that best fit the texels by least squares, keeping the palette entry of each texel
+/// </summary>
+/// <param name="block">
+/// texels to fit
+/// </param>
+/// <param name="texel_weights">
+/// 1 for texels to include, 0 for texels to leave out.  NULL to include every texel
+/// </param>
+/// <param name="first_channel">
+/// first channel to fit
+/// </param>
+/// <param name="num_channels">
+/// number of channels to fit
+/// </param>
+/// <param name="indices">
+/// palette entry of each texel
+/// </param>
+/// <param name="index_weights">
+/// how far each palette entry is from the first endpoint to the second, from 0 to 1
+/// </param>
+/// <param name="endpoints">
+/// output parameter for the new endpoints
+/// </param>
+/// <returns>
+/// true if the endpoints were updated
+/// false if every texel uses the same palette entry, so there is no unique answer
+/// </returns>
+static bool RefineEndpoints(const TexelBlock& block, const float* texel_weights, UINT first_channel, UINT num_channels, const UINT8* indices,
+  const float* index_weights, float endpoints[2][4])
+{
+  float aa = 0;
+  float ab = 0;
+  float bb = 0;
+  float ap[4] = { 0, 0, 0, 0 };
+  float bp[4] = { 0, 0, 0, 0 };
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    float weight = texel_weights != NULL ? texel_weights[t] : 1;
+    float b      = index_weights[indices[t]];
+    float a      = 1 - b;
+    aa += weight * a * a;
+    ab += weight * a * b;
+    bb += weight * b * b;
+    for (UINT c = 0; c < num_channels; c++)
+    {
+      ap[c] += weight * a * block.channels[first_channel + c][t];
+      bp[c] += weight * b * block.channels[first_channel + c][t];
+    }
+  }
+
+  float det = aa * bb - ab * ab;
+  if (fabsf(det) < 1e-6f)
+  {
+    return false;
+  }
+  for (UINT c = 0; c < num_channels; c++)
+  {
+    endpoints[0][first_channel + c] = min(max((bb * ap[c] - ab * bp[c]) / det, 0.0f), 255.0f);
+    endpoints[1][first_channel + c] = min(max((aa * bp[c] - ab * ap[c]) / det, 0.0f), 255.0f);
+  }
+  return true;
+}
+
+/// <summary>
+/// Number of fit and refine passes for each quality
+/// </summary>
+static UINT GetNumPasses(BlockCompressionQuality quality)
+{
+  return quality == BC_QUALITY_FAST ? 1 : quality == BC_QUALITY_NORMAL ? 2 : 4;
+}
+
+/// <summary>
+/// Converts a color to 5:6:5 bits
+/// </summary>
+static UINT16 QuantizeRGB565(const float color[4])
+{
+  UINT r = (UINT)(color[0] * (31 / 255.0f) + 0.5f);
+  UINT g = (UINT)(color[1] * (63 / 255.0f) + 0.5f);
+  UINT b = (UINT)(color[2] * (31 / 255.0f) + 0.5f);
+  return (UINT16)((r << 11) | (g << 5) | b);
+}
+
+/// <summary>
+/// Converts 5:6:5 bits to a color
+/// </summary>
+static void UnquantizeRGB565(UINT16 bits, float color[4])
+{
+  UINT r = (bits >> 11) & 0x1F;
+  UINT g = (bits >> 5) & 0x3F;
+  UINT b = bits & 0x1F;
+  color[0] = (float)((r << 3) | (r >> 2));
+  color[1] = (float)((g << 2) | (g >> 4));
+  color[2] = (float)((b << 3) | (b >> 2));
+  color[3] = 255;
+}
+
+/// <summary>
+/// Encodes the color part of a BC1 or BC3 block
+/// </summary>
+/// <param name="block">
+/// texels to encode
+/// </param>
+/// <param name="allow_transparent">
+/// true for BC1, so texels with alpha below 128 are encoded as transparent black
+/// false for BC3, which always uses 4 colors
+/// </param>
+/// <param name="quality">
+/// number of refinement passes to make
+/// </param>
+/// <param name="dst">
+/// where to write the 8 bytes of the block
+/// </param>
+static void EncodeColorBlock(const TexelBlock& block, bool allow_transparent, BlockCompressionQuality quality, UINT8* dst)
+{
+  static const float FOUR_COLOR_WEIGHTS[4]  = { 0, 1, 1 / 3.0f, 2 / 3.0f };
+  static const float THREE_COLOR_WEIGHTS[4] = { 0, 1, 0.5f, 0 };
+
+  float texel_weights[TEXELS_PER_BLOCK];
+  bool  three_color = false;
+  bool  any_opaque  = false;
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    bool transparent = allow_transparent && block.channels[3][t] < 128;
+    texel_weights[t] = transparent ? 0.0f : 1.0f;
+    three_color     |= transparent;
+    any_opaque      |= !transparent;
+  }
+
+  UINT16 best_colors[2]  = { 0, 0 };
+  UINT8  best_indices[TEXELS_PER_BLOCK] = {};
+  if (any_opaque)
+  {
+    const float* index_weights = three_color ? THREE_COLOR_WEIGHTS : FOUR_COLOR_WEIGHTS;
+    float endpoints[2][4];
+    FitLine(block, texel_weights, 0, 3, endpoints);
+
+    float best_error = FLT_MAX;
+    UINT  num_passes = GetNumPasses(quality);
+    for (UINT pass = 0; pass < num_passes; pass++)
+    {
+      // 4 color blocks need the first color larger, 3 color blocks the second
+      UINT16 colors[2] = { QuantizeRGB565(endpoints[0]), QuantizeRGB565(endpoints[1]) };
+      if ((colors[0] < colors[1]) != three_color)
+      {
+        swap(colors[0], colors[1]);
+        swap(endpoints[0], endpoints[1]);
+      }
+
+      float palette[4][4];
+      UnquantizeRGB565(colors[0], palette[0]);
+      UnquantizeRGB565(colors[1], palette[1]);
+      for (UINT c = 0; c < 3; c++)
+      {
+        if (three_color)
+        {
+          palette[2][c] = floorf((palette[0][c] + palette[1][c]) / 2);
+        }
+        else
+        {
+          palette[2][c] = floorf((2 * palette[0][c] + palette[1][c]) / 3);
+          palette[3][c] = floorf((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+      }
+
+      UINT8 indices[TEXELS_PER_BLOCK];
+      float error = SelectIndices(block, texel_weights, 0, 3, palette, three_color ? 3 : 4, indices);
+      if (colors[0] == colors[1])
+      {
+        // equal colors decode as 3 color mode, where only the first entry is still the same color
+        memset(indices, 0, sizeof(indices));
+      }
+      if (error < best_error)
+      {
+        best_error     = error;
+        best_colors[0] = colors[0];
+        best_colors[1] = colors[1];
+        memcpy(best_indices, indices, sizeof(indices));
+      }
+
+      if (pass + 1 < num_passes && !RefineEndpoints(block, texel_weights, 0, 3, indices, index_weights, endpoints))
+      {
+        break;
+      }
+    }
+  }
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    if (texel_weights[t] == 0)
+    {
+      best_indices[t] = 3;
+    }
+  }
+
+  BitWriter writer(dst, 8);
+  writer.Write(best_colors[0], 16);
+  writer.Write(best_colors[1], 16);
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    writer.Write(best_indices[t], 2);
+  }
+}
+
+/// <summary>
+/// Encodes 1 channel as a BC4 block, which is also the alpha part of BC3 and each half of BC5
+/// </summary>
+/// <param name="block">
+/// texels to encode
+/// </param>
+/// <param name="channel">
+/// channel to encode
+/// </param>
+/// <param name="quality">
+/// number of refinement passes to make
+/// </param>
+/// <param name="dst">
+/// where to write the 8 bytes of the block
+/// </param>
+static void EncodeChannelBlock(const TexelBlock& block, UINT channel, BlockCompressionQuality quality, UINT8* dst)
+{
+  static const float INDEX_WEIGHTS[8] = { 0, 1, 1 / 7.0f, 2 / 7.0f, 3 / 7.0f, 4 / 7.0f, 5 / 7.0f, 6 / 7.0f };
+
+  __m128 low  = _mm_loadu_ps(block.channels[channel]);
+  __m128 high = low;
+  for (UINT t = 4; t < TEXELS_PER_BLOCK; t += 4)
+  {
+    low  = _mm_min_ps(low, _mm_loadu_ps(block.channels[channel] + t));
+    high = _mm_max_ps(high, _mm_loadu_ps(block.channels[channel] + t));
+  }
+  low  = _mm_min_ps(low, _mm_shuffle_ps(low, low, _MM_SHUFFLE(1, 0, 3, 2)));
+  low  = _mm_min_ps(low, _mm_shuffle_ps(low, low, _MM_SHUFFLE(2, 3, 0, 1)));
+  high = _mm_max_ps(high, _mm_shuffle_ps(high, high, _MM_SHUFFLE(1, 0, 3, 2)));
+  high = _mm_max_ps(high, _mm_shuffle_ps(high, high, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  // the first endpoint being larger selects the mode with 6 interpolated values
+  float endpoints[2][4];
+  endpoints[0][channel] = _mm_cvtss_f32(high);
+  endpoints[1][channel] = _mm_cvtss_f32(low);
+
+  UINT8 best_values[2]                  = { (UINT8)endpoints[0][channel], (UINT8)endpoints[0][channel] };
+  UINT8 best_indices[TEXELS_PER_BLOCK] = {};
+  float best_error = FLT_MAX;
+  UINT  num_passes = GetNumPasses(quality);
+  for (UINT pass = 0; pass < num_passes && endpoints[0][channel] != endpoints[1][channel]; pass++)
+  {
+    UINT8 values[2] = { (UINT8)(endpoints[0][channel] + 0.5f), (UINT8)(endpoints[1][channel] + 0.5f) };
+    if (values[0] < values[1])
+    {
+      swap(values[0], values[1]);
+      swap(endpoints[0][channel], endpoints[1][channel]);
+    }
+    if (values[0] == values[1])
+    {
+      break;
+    }
+
+    float palette[8][4];
+    palette[0][channel] = values[0];
+    palette[1][channel] = values[1];
+    for (UINT i = 2; i < 8; i++)
+    {
+      palette[i][channel] = ((8 - i) * values[0] + (i - 1) * values[1]) / 7.0f;
+    }
+
+    UINT8 indices[TEXELS_PER_BLOCK];
+    float error = SelectIndices(block, NULL, channel, 1, palette, 8, indices);
+    if (error < best_error)
+    {
+      best_error     = error;
+      best_values[0] = values[0];
+      best_values[1] = values[1];
+      memcpy(best_indices, indices, sizeof(indices));
+    }
+
+    if (pass + 1 < num_passes && !RefineEndpoints(block, NULL, channel, 1, indices, INDEX_WEIGHTS, endpoints))
+    {
+      break;
+    }
+  }
+
+  BitWriter writer(dst, 8);
+  writer.Write(best_values[0], 8);
+  writer.Write(best_values[1], 8);
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    writer.Write(best_indices[t], 3);
+  }
+}
+
+/// <summary>
+/// Expands a quantized BC7 endpoint channel, including its p-bit if it has one, to 8 bits
+/// </summary>
+static UINT UnquantizeBC7(UINT value, UINT num_bits)
+{
+  value <<= 8 - num_bits;
+  return value | (value >> num_bits);
+}
+
+/// <summary>
+/// Quantizes 1 channel of a BC7 endpoint
+/// </summary>
+/// <param name="value">
+/// value to quantize, from 0 to 255
+/// </param>
+/// <param name="num_bits">
+/// number of bits stored for the channel, without the p-bit
+/// </param>
+/// <param name="pbit">
+/// p-bit the channel is stored with, or -1 for none
+/// </param>
+static UINT QuantizeBC7(float value, UINT num_bits, int pbit)
+{
+  UINT max_value = (1u << num_bits) - 1;
+  float scaled;
+  if (pbit < 0)
+  {
+    scaled = value * max_value / 255;
+  }
+  else
+  {
+    scaled = (value * ((max_value << 1) | 1) / 255 - pbit) / 2;
+  }
+  return (UINT)min(max(scaled + 0.5f, 0.0f), (float)max_value);
+}
+
+/// <summary>
+/// Quantizes the endpoints of a BC7 subset, picking the p-bits that keep the endpoints closest
+/// </summary>
+/// <param name="endpoints">
+/// endpoints to quantize
+/// </param>
+/// <param name="first_channel">
+/// first channel to quantize
+/// </param>
+/// <param name="num_channels">
+/// number of channels to quantize
+/// </param>
+/// <param name="num_bits">
+/// number of bits stored for each channel, without the p-bit
+/// </param>
+/// <param name="pbit_mode">
+/// how the p-bits are stored
+/// </param>
+/// <param name="quantized">
+/// output parameter for the stored endpoints
+/// </param>
+/// <param name="decoded">
+/// output parameter for the endpoints as the hardware decodes them
+/// </param>
+static void QuantizeBC7Endpoints(const float endpoints[2][4], UINT first_channel, UINT num_channels, UINT num_bits, PBitMode pbit_mode,
+  BC7Endpoints& quantized, UINT decoded[2][4])
+{
+  int  num_options = pbit_mode == PBIT_NONE ? 1 : 2;
+  UINT total_bits  = pbit_mode == PBIT_NONE ? num_bits : num_bits + 1;
+  float best_error[2] = { FLT_MAX, FLT_MAX };
+  for (int option = 0; option < num_options; option++)
+  {
+    int   pbit = pbit_mode == PBIT_NONE ? -1 : option;
+    float error[2];
+    UINT  values[2][4];
+    UINT  unquantized[2][4];
+    for (UINT e = 0; e < 2; e++)
+    {
+      error[e] = 0;
+      for (UINT c = first_channel; c < first_channel + num_channels; c++)
+      {
+        values[e][c]      = QuantizeBC7(endpoints[e][c], num_bits, pbit);
+        unquantized[e][c] = UnquantizeBC7(pbit < 0 ? values[e][c] : (values[e][c] << 1) | pbit, total_bits);
+        float diff = unquantized[e][c] - endpoints[e][c];
+        error[e] += diff * diff;
+      }
+    }
+
+    // unique p-bits are picked for each endpoint on its own, shared ones for both together
+    for (UINT e = 0; e < 2; e++)
+    {
+      bool better = pbit_mode == PBIT_UNIQUE ? error[e] < best_error[e] : error[0] + error[1] < best_error[0] + best_error[1];
+      if (!better)
+      {
+        continue;
+      }
+      for (UINT c = first_channel; c < first_channel + num_channels; c++)
+      {
+        quantized.values[e][c] = (UINT8)values[e][c];
+        decoded[e][c]          = unquantized[e][c];
+      }
+      quantized.pbits[e] = (UINT8)max(pbit, 0);
+    }
+    if (pbit_mode == PBIT_UNIQUE)
+    {
+      best_error[0] = min(best_error[0], error[0]);
+      best_error[1] = min(best_error[1], error[1]);
+    }
+    else if (error[0] + error[1] < best_error[0] + best_error[1])
+    {
+      best_error[0] = error[0];
+      best_error[1] = error[1];
+    }
+  }
+}
+
+/// <summary>
+/// Fits the endpoints of 1 BC7 subset, or of the color or alpha part of a mode 5 block
+/// </summary>
+/// <param name="block">
+/// texels to fit
+/// </param>
+/// <param name="texel_weights">
+/// 1 for texels in the subset, 0 for the others.  NULL when every texel is in the subset
+/// </param>
+/// <param name="first_channel">
+/// first channel to fit
+/// </param>
+/// <param name="num_channels">
+/// number of channels to fit
+/// </param>
+/// <param name="num_bits">
+/// number of bits stored for each channel, without the p-bit
+/// </param>
+/// <param name="pbit_mode">
+/// how the p-bits are stored
+/// </param>
+/// <param name="weights">
+/// interpolation weights out of 64 for each index
+/// </param>
+/// <param name="num_weights">
+/// number of possible indices
+/// </param>
+/// <param name="num_passes">
+/// number of fit and refine passes
+/// </param>
+/// <param name="endpoints">
+/// output parameter for the quantized endpoints
+/// </param>
+/// <param name="indices">
+/// output parameter for the index of each texel.  Only meaningful for texels in the subset
+/// </param>
+/// <returns>
+/// sum of the squared errors of the texels in the subset
+/// </returns>
+static float FitBC7Subset(const TexelBlock& block, const float* texel_weights, UINT first_channel, UINT num_channels, UINT num_bits, PBitMode pbit_mode,
+  const UINT8* weights, UINT num_weights, UINT num_passes, BC7Endpoints& endpoints, UINT8* indices)
+{
+  float index_weights[16];
+  for (UINT i = 0; i < num_weights; i++)
+  {
+    index_weights[i] = weights[i] / 64.0f;
+  }
+
+  float fit[2][4];
+  FitLine(block, texel_weights, first_channel, num_channels, fit);
+
+  float best_error = FLT_MAX;
+  for (UINT pass = 0; pass < num_passes; pass++)
+  {
+    BC7Endpoints quantized;
+    UINT         decoded[2][4];
+    QuantizeBC7Endpoints(fit, first_channel, num_channels, num_bits, pbit_mode, quantized, decoded);
+
+    float palette[16][4];
+    for (UINT i = 0; i < num_weights; i++)
+    {
+      for (UINT c = first_channel; c < first_channel + num_channels; c++)
+      {
+        palette[i][c] = (float)(((64 - weights[i]) * decoded[0][c] + weights[i] * decoded[1][c] + 32) >> 6);
+      }
+    }
+
+    UINT8 pass_indices[TEXELS_PER_BLOCK];
+    float error = SelectIndices(block, texel_weights, first_channel, num_channels, palette, num_weights, pass_indices);
+    if (error < best_error)
+    {
+      best_error = error;
+      endpoints  = quantized;
+      memcpy(indices, pass_indices, sizeof(pass_indices));
+    }
+
+    if (pass + 1 < num_passes && !RefineEndpoints(block, texel_weights, first_channel, num_channels, pass_indices, index_weights, fit))
+    {
+      break;
+    }
+  }
+  return best_error;
+}
+
+/// <summary>
+/// Swaps the endpoints of a subset if the index of its anchor texel uses the high bit, which the format leaves out
+/// </summary>
+/// <param name="endpoints">
+/// endpoints of the subset
+/// </param>
+/// <param name="indices">
+/// index of each texel
+/// </param>
+/// <param name="num_weights">
+/// number of possible indices
+/// </param>
+/// <param name="anchor">
+/// anchor texel of the subset
+/// </param>
+/// <param name="subset_mask">
+/// bit set for each texel in the subset
+/// </param>
+static void FixAnchor(BC7Endpoints& endpoints, UINT8* indices, UINT num_weights, UINT anchor, UINT subset_mask)
+{
+  if (indices[anchor] < num_weights / 2)
+  {
+    return;
+  }
+  for (UINT c = 0; c < 4; c++)
+  {
+    swap(endpoints.values[0][c], endpoints.values[1][c]);
+  }
+  swap(endpoints.pbits[0], endpoints.pbits[1]);
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    if (subset_mask & (1 << t))
+    {
+      indices[t] = (UINT8)(num_weights - 1 - indices[t]);
+    }
+  }
+}
+
+/// <summary>
+/// Writes the indices of a BC7 block, leaving out the high bit of each anchor texel
+/// </summary>
+static void WriteBC7Indices(BitWriter& writer, const UINT8* indices, UINT num_bits, UINT anchor_0, UINT anchor_1)
+{
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    writer.Write(indices[t], t == anchor_0 || t == anchor_1 ? num_bits - 1 : num_bits);
+  }
+}
+
+/// <summary>
+/// Encodes a BC7 mode 6 block: 1 subset, 7 bit RGBA endpoints with unique p-bits and 4 bit indices
+/// </summary>
+/// <returns>
+/// sum of the squared errors of every texel
+/// </returns>
+static float EncodeBC7Mode6(const TexelBlock& block, UINT num_passes, UINT8* dst)
+{
+  BC7Endpoints endpoints;
+  UINT8        indices[TEXELS_PER_BLOCK];
+  float error = FitBC7Subset(block, NULL, 0, 4, 7, PBIT_UNIQUE, BC7_WEIGHTS_4, 16, num_passes, endpoints, indices);
+  FixAnchor(endpoints, indices, 16, 0, 0xFFFF);
+
+  BitWriter writer(dst, 16);
+  writer.Write(1 << 6, 7);
+  for (UINT c = 0; c < 4; c++)
+  {
+    writer.Write(endpoints.values[0][c], 7);
+    writer.Write(endpoints.values[1][c], 7);
+  }
+  writer.Write(endpoints.pbits[0], 1);
+  writer.Write(endpoints.pbits[1], 1);
+  WriteBC7Indices(writer, indices, 4, 0, 0);
+  return error;
+}
+
+/// <summary>
+/// Encodes a BC7 mode 1 block for an opaque block: 2 subsets, 6 bit RGB endpoints with a shared p-bit per subset and
+/// 3 bit indices
+/// </summary>
+/// <returns>
+/// sum of the squared errors of every texel
+/// </returns>
+static float EncodeBC7Mode1(const TexelBlock& block, UINT partition, UINT num_passes, UINT8* dst)
+{
+  UINT16       mask = BC7_PARTITIONS_2[partition];
+  BC7Endpoints endpoints[2];
+  UINT8        indices[2][TEXELS_PER_BLOCK];
+  float        error = 0;
+  for (UINT s = 0; s < 2; s++)
+  {
+    float texel_weights[TEXELS_PER_BLOCK];
+    for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+    {
+      texel_weights[t] = ((mask >> t) & 1) == s ? 1.0f : 0.0f;
+    }
+    error += FitBC7Subset(block, texel_weights, 0, 3, 6, PBIT_SHARED, BC7_WEIGHTS_3, 8, num_passes, endpoints[s], indices[s]);
+  }
+  FixAnchor(endpoints[0], indices[0], 8, 0, ~mask & 0xFFFF);
+  FixAnchor(endpoints[1], indices[1], 8, BC7_ANCHORS_2[partition], mask);
+
+  UINT8 merged[TEXELS_PER_BLOCK];
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    merged[t] = indices[(mask >> t) & 1][t];
+  }
+
+  BitWriter writer(dst, 16);
+  writer.Write(1 << 1, 2);
+  writer.Write(partition, 6);
+  for (UINT c = 0; c < 3; c++)
+  {
+    for (UINT s = 0; s < 2; s++)
+    {
+      writer.Write(endpoints[s].values[0][c], 6);
+      writer.Write(endpoints[s].values[1][c], 6);
+    }
+  }
+  writer.Write(endpoints[0].pbits[0], 1);
+  writer.Write(endpoints[1].pbits[0], 1);
+  WriteBC7Indices(writer, merged, 3, 0, BC7_ANCHORS_2[partition]);
+  return error;
+}
+
+/// <summary>
+/// Encodes a BC7 mode 5 block: 1 subset with separate color and alpha, 7 bit RGB and 8 bit alpha endpoints, 2 bit
+/// indices for each, and a channel swapped with alpha
+/// </summary>
+/// <param name="rotation">
+/// 0 for no swap, or 1, 2 or 3 to swap alpha with red, green or blue
+/// </param>
+/// <returns>
+/// sum of the squared errors of every texel
+/// </returns>
+static float EncodeBC7Mode5(const TexelBlock& block, UINT rotation, UINT num_passes, UINT8* dst)
+{
+  TexelBlock rotated = block;
+  if (rotation != 0)
+  {
+    memcpy(rotated.channels[3], block.channels[rotation - 1], sizeof(rotated.channels[3]));
+    memcpy(rotated.channels[rotation - 1], block.channels[3], sizeof(rotated.channels[3]));
+  }
+
+  BC7Endpoints color;
+  BC7Endpoints alpha;
+  UINT8        color_indices[TEXELS_PER_BLOCK];
+  UINT8        alpha_indices[TEXELS_PER_BLOCK];
+  float error = FitBC7Subset(rotated, NULL, 0, 3, 7, PBIT_NONE, BC7_WEIGHTS_2, 4, num_passes, color, color_indices);
+  error += FitBC7Subset(rotated, NULL, 3, 1, 8, PBIT_NONE, BC7_WEIGHTS_2, 4, num_passes, alpha, alpha_indices);
+  FixAnchor(color, color_indices, 4, 0, 0xFFFF);
+  FixAnchor(alpha, alpha_indices, 4, 0, 0xFFFF);
+
+  BitWriter writer(dst, 16);
+  writer.Write(1 << 5, 6);
+  writer.Write(rotation, 2);
+  for (UINT c = 0; c < 3; c++)
+  {
+    writer.Write(color.values[0][c], 7);
+    writer.Write(color.values[1][c], 7);
+  }
+  writer.Write(alpha.values[0][3], 8);
+  writer.Write(alpha.values[1][3], 8);
+  WriteBC7Indices(writer, color_indices, 2, 0, 0);
+  WriteBC7Indices(writer, alpha_indices, 2, 0, 0);
+  return error;
+}
+
+/// <summary>
+/// Sums of the colors and products of color channels of a set of texels, which are enough to find how far the texels
+/// spread from their principal axis
+/// </summary>
+struct ColorMoments
+{
+  /// <summary>
+  /// number of texels, then the sums of r, g, b, rr, rg, rb, gg, gb and bb
+  /// </summary>
+  float sums[10];
+};
+
+/// <summary>
+/// Computes the moments of each texel on its own and of the whole block
+/// </summary>
+static void ComputeTexelMoments(const TexelBlock& block, ColorMoments moments[TEXELS_PER_BLOCK], ColorMoments& total)
+{
+  memset(&total, 0, sizeof(total));
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    float r = block.channels[0][t];
+    float g = block.channels[1][t];
+    float b = block.channels[2][t];
+    float values[10] = { 1, r, g, b, r * r, r * g, r * b, g * g, g * b, b * b };
+    memcpy(moments[t].sums, values, sizeof(values));
+    for (UINT i = 0; i < 10; i++)
+    {
+      total.sums[i] += values[i];
+    }
+  }
+}
+
+/// <summary>
+/// Picks between 2 sets of lanes
+/// </summary>
+/// <param name="mask">
+/// all bits set in the lanes to take from if_set, clear in the others
+/// </param>
+/// <param name="if_set">
+/// lanes used where mask is set
+/// </param>
+/// <param name="if_clear">
+/// lanes used where mask is clear
+/// </param>
+/// <returns>
+/// combined lanes
+/// </returns>
+static inline __m128 Select(__m128 mask, __m128 if_set, __m128 if_clear)
+{
+  return _mm_or_ps(_mm_and_ps(mask, if_set), _mm_andnot_ps(mask, if_clear));
+}
+
+/// <summary>
+/// Finds how much of the spread of 3 channels is left after removing their largest principal component, which is
+/// about the squared error of fitting a line to them.  Works on 4 sets of texels at once, 1 in each lane
+/// </summary>
+/// <param name="cov">
+/// covariance of the channels, scaled by the number of texels
+/// </param>
+/// <returns>
+/// spread left in each set, scaled the same way as cov
+/// </returns>
+static __m128 GetOffAxisVariance(const __m128 cov[3][3])
+{
+  const __m128 zero  = _mm_setzero_ps();
+  __m128       trace = _mm_add_ps(_mm_add_ps(cov[0][0], cov[1][1]), cov[2][2]);
+  __m128       valid = _mm_cmpgt_ps(trace, zero);
+
+  // power iteration for the largest eigenvalue, starting from the channel with the most variance so the start is
+  // never perpendicular to the answer.  Dividing by the trace keeps a few steps in range without normalizing each
+  // one, as the largest eigenvalue is between a third of the trace and all of it
+  __m128 scale = _mm_and_ps(valid, _mm_div_ps(_mm_set1_ps(1), _mm_or_ps(trace, _mm_andnot_ps(valid, _mm_set1_ps(1)))));
+  __m128 scaled[3][3];
+  for (UINT i = 0; i < 3; i++)
+  {
+    for (UINT j = 0; j < 3; j++)
+    {
+      scaled[i][j] = _mm_mul_ps(cov[i][j], scale);
+    }
+  }
+  __m128 second_largest = _mm_cmpgt_ps(cov[1][1], cov[0][0]);
+  __m128 third_largest  = _mm_cmpgt_ps(cov[2][2], _mm_max_ps(cov[0][0], cov[1][1]));
+  __m128 axis[3];
+  for (UINT i = 0; i < 3; i++)
+  {
+    axis[i] = Select(third_largest, scaled[2][i], Select(second_largest, scaled[1][i], scaled[0][i]));
+  }
+  __m128 next[3];
+  for (UINT iter = 0; iter < 4; iter++)
+  {
+    if (iter > 0)
+    {
+      memcpy(axis, next, sizeof(axis));
+    }
+    for (UINT i = 0; i < 3; i++)
+    {
+      next[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(scaled[i][0], axis[0]), _mm_mul_ps(scaled[i][1], axis[1])),
+                           _mm_mul_ps(scaled[i][2], axis[2]));
+    }
+  }
+
+  // the Rayleigh quotient of the last step
+  __m128 len_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(axis[0], axis[0]), _mm_mul_ps(axis[1], axis[1])), _mm_mul_ps(axis[2], axis[2]));
+  __m128 dot    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(next[0], axis[0]), _mm_mul_ps(next[1], axis[1])), _mm_mul_ps(next[2], axis[2]));
+  __m128 nonzero    = _mm_cmpgt_ps(len_sq, zero);
+  __m128 eigenvalue = _mm_and_ps(nonzero, _mm_div_ps(dot, _mm_or_ps(len_sq, _mm_andnot_ps(nonzero, _mm_set1_ps(1)))));
+  return _mm_and_ps(valid, _mm_max_ps(_mm_mul_ps(trace, _mm_sub_ps(_mm_set1_ps(1), eigenvalue)), zero));
+}
+
+/// <summary>
+/// Estimates the squared error of fitting a line to each of 4 sets of texels, from the variance left after removing
+/// the largest principal component
+/// </summary>
+/// <param name="moments">
+/// sums of the moments of the texels, as in ColorMoments, with each set in its own lane
+/// </param>
+static __m128 EstimateLineError(const __m128 moments[10])
+{
+  // empty sets have no spread
+  __m128 count = _mm_max_ps(moments[0], _mm_set1_ps(1));
+  __m128 mean[3];
+  for (UINT i = 0; i < 3; i++)
+  {
+    mean[i] = _mm_div_ps(moments[1 + i], count);
+  }
+  __m128 cov[3][3];
+  cov[0][0] = _mm_sub_ps(moments[4], _mm_mul_ps(mean[0], moments[1]));
+  cov[0][1] = _mm_sub_ps(moments[5], _mm_mul_ps(mean[0], moments[2]));
+  cov[0][2] = _mm_sub_ps(moments[6], _mm_mul_ps(mean[0], moments[3]));
+  cov[1][1] = _mm_sub_ps(moments[7], _mm_mul_ps(mean[1], moments[2]));
+  cov[1][2] = _mm_sub_ps(moments[8], _mm_mul_ps(mean[1], moments[3]));
+  cov[2][2] = _mm_sub_ps(moments[9], _mm_mul_ps(mean[2], moments[3]));
+  cov[1][0] = cov[0][1];
+  cov[2][0] = cov[0][2];
+  cov[2][1] = cov[1][2];
+  return GetOffAxisVariance(cov);
+}
+
+/// <summary>
+/// Estimates how well 4 consecutive 2 subset partitions can be encoded from the spread of each subset away from its
+/// principal axis
+/// </summary>
+/// <param name="texel_moments">
+/// moments of each texel
+/// </param>
+/// <param name="total">
+/// moments of the whole block
+/// </param>
+/// <param name="first_partition">
+/// partition estimated in the first lane
+/// </param>
+/// <returns>
+/// estimated error of each partition
+/// </returns>
+static __m128 EstimatePartitionErrors(const ColorMoments texel_moments[TEXELS_PER_BLOCK], const ColorMoments& total, UINT first_partition)
+{
+  const __m128i masks = _mm_setr_epi32(BC7_PARTITIONS_2[first_partition], BC7_PARTITIONS_2[first_partition + 1],
+                                       BC7_PARTITIONS_2[first_partition + 2], BC7_PARTITIONS_2[first_partition + 3]);
+  __m128 subsets[2][10];
+  for (UINT i = 0; i < 10; i++)
+  {
+    subsets[1][i] = _mm_setzero_ps();
+  }
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    __m128i bit       = _mm_set1_epi32(1 << t);
+    __m128  in_subset = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(masks, bit), bit));
+    for (UINT i = 0; i < 10; i++)
+    {
+      subsets[1][i] = _mm_add_ps(subsets[1][i], _mm_and_ps(in_subset, _mm_set1_ps(texel_moments[t].sums[i])));
+    }
+  }
+
+  // the first subset is whatever the second leaves
+  for (UINT i = 0; i < 10; i++)
+  {
+    subsets[0][i] = _mm_sub_ps(_mm_set1_ps(total.sums[i]), subsets[1][i]);
+  }
+  return _mm_add_ps(EstimateLineError(subsets[0]), EstimateLineError(subsets[1]));
+}
+
+/// <summary>
+/// Picks the mode 5 rotation likely to encode a block best, the one that gives the channel that varies most apart from
+/// the others its own endpoints and indices
+/// </summary>
+/// <returns>
+/// 0 to keep alpha apart, or 1, 2 or 3 to keep red, green or blue apart
+/// </returns>
+static UINT EstimateBestRotation(const TexelBlock& block)
+{
+  float mean[4] = { 0, 0, 0, 0 };
+  for (UINT c = 0; c < 4; c++)
+  {
+    for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+    {
+      mean[c] += block.channels[c][t];
+    }
+    mean[c] /= TEXELS_PER_BLOCK;
+  }
+  float cov[4][4] = {};
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    for (UINT i = 0; i < 4; i++)
+    {
+      for (UINT j = i; j < 4; j++)
+      {
+        cov[i][j] += (block.channels[i][t] - mean[i]) * (block.channels[j][t] - mean[j]);
+      }
+    }
+  }
+
+  // the color endpoints are fit to the 3 channels left after the one moved into alpha, with each rotation in its own
+  // lane
+  float color_cov[3][3][4];
+  for (UINT rotation = 0; rotation < 4; rotation++)
+  {
+    UINT apart = rotation == 0 ? 3 : rotation - 1;
+    UINT kept[3];
+    for (UINT c = 0, k = 0; c < 4; c++)
+    {
+      if (c != apart)
+      {
+        kept[k++] = c;
+      }
+    }
+    for (UINT i = 0; i < 3; i++)
+    {
+      for (UINT j = 0; j < 3; j++)
+      {
+        color_cov[i][j][rotation] = cov[min(kept[i], kept[j])][max(kept[i], kept[j])];
+      }
+    }
+  }
+  __m128 lanes[3][3];
+  for (UINT i = 0; i < 3; i++)
+  {
+    for (UINT j = 0; j < 3; j++)
+    {
+      lanes[i][j] = _mm_loadu_ps(color_cov[i][j]);
+    }
+  }
+  float errors[4];
+  _mm_storeu_ps(errors, GetOffAxisVariance(lanes));
+
+  UINT best_rotation = 0;
+  for (UINT rotation = 1; rotation < 4; rotation++)
+  {
+    if (errors[rotation] < errors[best_rotation])
+    {
+      best_rotation = rotation;
+    }
+  }
+  return best_rotation;
+}
+
+/// <summary>
+/// Encodes a BC7 block, trying more modes and partitions at higher qualities
+/// </summary>
+static void EncodeBC7Block(const TexelBlock& block, BlockCompressionQuality quality, UINT8* dst)
+{
+  UINT  num_passes = GetNumPasses(quality) + 1;
+  float best_error = EncodeBC7Mode6(block, num_passes, dst);
+  if (quality == BC_QUALITY_FAST || best_error == 0)
+  {
+    return;
+  }
+
+  bool opaque = true;
+  for (UINT t = 0; t < TEXELS_PER_BLOCK; t++)
+  {
+    opaque &= block.channels[3][t] == 255;
+  }
+
+  // mode 5 keeps 1 channel apart from the others, which suits blocks where alpha or a color channel varies on its own,
+  // including the noise in photos.  Below HIGH only the rotation that looks best is encoded
+  UINT8 candidate[16];
+  UINT  first_rotation = quality == BC_QUALITY_HIGH ? 0 : EstimateBestRotation(block);
+  UINT  last_rotation  = quality == BC_QUALITY_HIGH ? 3 : first_rotation;
+  for (UINT rotation = first_rotation; rotation <= last_rotation; rotation++)
+  {
+    float error = EncodeBC7Mode5(block, rotation, num_passes, candidate);
+    if (error < best_error)
+    {
+      best_error = error;
+      memcpy(dst, candidate, sizeof(candidate));
+    }
+  }
+
+  // mode 1 splits opaque blocks that no single line fits, such as hard edges.  It always decodes alpha as 255, so its
+  // color error compares directly with the error of the other modes.  Ranking the partitions costs about as much as
+  // encoding mode 6 twice, so below HIGH it is only done for blocks left with more error than noise leaves, and only
+  // the best ranked partition is encoded
+  if (!opaque || (quality != BC_QUALITY_HIGH && best_error <= BC7_SPLIT_ERROR))
+  {
+    return;
+  }
+  ColorMoments texel_moments[TEXELS_PER_BLOCK];
+  ColorMoments total;
+  ComputeTexelMoments(block, texel_moments, total);
+
+  pair<float, UINT> ranked[64];
+  for (UINT p = 0; p < 64; p += 4)
+  {
+    float errors[4];
+    _mm_storeu_ps(errors, EstimatePartitionErrors(texel_moments, total, p));
+    for (UINT i = 0; i < 4; i++)
+    {
+      ranked[p + i] = make_pair(errors[i], p + i);
+    }
+  }
+  UINT num_tried = quality == BC_QUALITY_HIGH ? 16 : 1;
+  partial_sort(ranked, ranked + num_tried, ranked + 64);
+  for (UINT i = 0; i < num_tried; i++)
+  {
+    float error = EncodeBC7Mode1(block, ranked[i].second, num_passes, candidate);
+    if (error < best_error)
+    {
+      best_error = error;
+      memcpy(dst, candidate, sizeof(candidate));
+    }
+  }
+}
+
+/// <summary>
+/// Encodes 1 block of a supported format
+/// </summary>
+static void EncodeBlock(const TexelBlock& block, GraphicsDataFormat format, BlockCompressionQuality quality, UINT8* dst)
+{
+  switch (format)
+  {
+    case BC1_UNORM:
+    case BC1_UNORM_SRGB:
+      EncodeColorBlock(block, true, quality, dst);
+      break;
+    case BC3_UNORM:
+    case BC3_UNORM_SRGB:
+      EncodeChannelBlock(block, 3, quality, dst);
+      EncodeColorBlock(block, false, quality, dst + 8);
+      break;
+    case BC4_UNORM:
+      EncodeChannelBlock(block, 0, quality, dst);
+      break;
+    case BC5_UNORM:
+      EncodeChannelBlock(block, 0, quality, dst);
+      EncodeChannelBlock(block, 1, quality, dst + 8);
+      break;
+    default:
+      EncodeBC7Block(block, quality, dst);
+      break;
+  }
+}
+
+bool BlockCompressor::IsBlockCompressed(GraphicsDataFormat format)
+{
+  switch (format)
+  {
+    case BC1_UNORM:
+    case BC1_UNORM_SRGB:
+    case BC2_UNORM:
+    case BC2_UNORM_SRGB:
+    case BC3_UNORM:
+    case BC3_UNORM_SRGB:
+    case BC4_UNORM:
+    case BC4_SNORM:
+    case BC5_UNORM:
+    case BC5_SNORM:
+    case BC6H_UF16:
+    case BC6H_SF16:
+    case BC7_UNORM:
+    case BC7_UNORM_SRGB:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool BlockCompressor::IsFormatSupported(GraphicsDataFormat format)
+{
+  switch (format)
+  {
+    case BC1_UNORM:
+    case BC1_UNORM_SRGB:
+    case BC3_UNORM:
+    case BC3_UNORM_SRGB:
+    case BC4_UNORM:
+    case BC5_UNORM:
+    case BC7_UNORM:
+    case BC7_UNORM_SRGB:
+      return true;
+    default:
+      return false;
+  }
+}
+
+UINT BlockCompressor::GetBytesPerBlock(GraphicsDataFormat format)
+{
+  if (!IsBlockCompressed(format))
+  {
+    ostringstream out;
+    out << "Format " << (UINT)format << " is not block compressed";
+    throw FrameworkException(out.str());
+  }
+  return format == BC1_UNORM || format == BC1_UNORM_SRGB || format == BC4_UNORM || format == BC4_SNORM ? 8 : 16;
+}
+
+GraphicsDataFormat BlockCompressor::GetSourceFormat(GraphicsDataFormat format)
+{
+  return format == BC1_UNORM_SRGB || format == BC3_UNORM_SRGB || format == BC7_UNORM_SRGB ? R8G8B8A8_UNORM_SRGB : R8B8G8A8_UNORM;
+}
+
+size_t BlockCompressor::GetCompressedSize(GraphicsDataFormat format, UINT width, UINT height)
+{
+  return (size_t)((width + BLOCK_DIM - 1) / BLOCK_DIM) * ((height + BLOCK_DIM - 1) / BLOCK_DIM) * GetBytesPerBlock(format);
+}
+
+void BlockCompressor::Compress(const void* src, UINT width, UINT height, UINT src_row_pitch, GraphicsDataFormat format, BlockCompressionQuality quality,
+  void* dst, UINT dst_row_pitch)
+{
+  if (!IsFormatSupported(format))
+  {
+    ostringstream out;
+    out << "Cannot compress to format " << (UINT)format;
+    throw FrameworkException(out.str());
+  }
+  if (width == 0 || height == 0)
+  {
+    return;
+  }
+
+  UINT bytes_per_block = GetBytesPerBlock(format);
+  UINT num_blocks_x    = (width + BLOCK_DIM - 1) / BLOCK_DIM;
+  UINT num_blocks_y    = (height + BLOCK_DIM - 1) / BLOCK_DIM;
+  ThreadPool::GetDefault().ParallelFor(num_blocks_y, max(1u, BLOCKS_PER_JOB / num_blocks_x), [&](UINT begin, UINT end)
+  {
+    TexelBlock block;
+    for (UINT block_y = begin; block_y < end; block_y++)
+    {
+      UINT8* dst_row = (UINT8*)dst + (size_t)block_y * dst_row_pitch;
+      for (UINT block_x = 0; block_x < num_blocks_x; block_x++)
+      {
+        LoadBlock((const UINT8*)src, width, height, src_row_pitch, block_x, block_y, block);
+        EncodeBlock(block, format, quality, dst_row + block_x * bytes_per_block);
+      }
+    }
+  });
+}
+
+void BlockCompressor::Compress(const vector<UINT8>& src, UINT width, UINT height, GraphicsDataFormat format, BlockCompressionQuality quality,
+  vector<UINT8>& dst)
+{
+  if (src.size() < (size_t)width * height * 4)
+  {
+    ostringstream out;
+    out << "Texture data is " << src.size() << " bytes, which is too small for a " << width << "x" << height << " image";
+    throw FrameworkException(out.str());
+  }
+
+  dst.resize(GetCompressedSize(format, width, height));
+  if (!dst.empty())
+  {
+    Compress(&src[0], width, height, width * 4, format, quality, &dst[0], ((width + BLOCK_DIM - 1) / BLOCK_DIM) * GetBytesPerBlock(format));
+  }
+}
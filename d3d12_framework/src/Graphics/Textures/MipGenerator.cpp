@@ -0,0 +1,768 @@
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+#include <emmintrin.h>
+#include "Graphics/Textures/MipGenerator.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// How each channel of a format is stored
+/// </summary>
+enum ChannelType
+{
+  CHANNEL_UNORM8,
+  CHANNEL_FLOAT16,
+  CHANNEL_FLOAT32
+};
+
+/// <summary>
+/// Layout of the texels of a supported format
+/// </summary>
+struct FormatInfo
+{
+  /// <summary>
+  /// how each channel is stored
+  /// </summary>
+  ChannelType type;
+
+  /// <summary>
+  /// number of channels in each texel
+  /// </summary>
+  UINT num_channels;
+
+  /// <summary>
+  /// true if the first 3 channels are sRGB encoded
+  /// </summary>
+  bool srgb;
+};
+
+/// <summary>
+/// Radius of the Kaiser and Lanczos filters, in texels of the smaller level
+/// </summary>
+static const float FILTER_RADIUS = 3;
+
+/// <summary>
+/// Shape parameter of the Kaiser window.  Larger values trade sharpness for less ringing
+/// </summary>
+static const float KAISER_ALPHA = 4;
+
+/// <summary>
+/// Approximate number of texels each job on a worker thread processes
+/// </summary>
+static const UINT TEXELS_PER_JOB = 16384;
+
+static const float PI = 3.14159265358979f;
+
+/// <summary>
+/// Lookup tables for converting 8-bit sRGB values to and from linear floats
+/// </summary>
+struct SRGBTables
+{
+  SRGBTables()
+  {
+    for (UINT i = 0; i < 256; i++)
+    {
+      to_linear[i] = ToLinear(i / 255.0);
+    }
+    for (UINT i = 0; i < 255; i++)
+    {
+      thresholds[i] = ToLinear((i + 0.5) / 255.0);
+    }
+    UINT8 value = 0;
+    for (UINT i = 0; i < NUM_BUCKETS; i++)
+    {
+      while (value < 255 && thresholds[value] <= i / (float)(NUM_BUCKETS - 1))
+      {
+        value++;
+      }
+      buckets[i] = value;
+    }
+  }
+
+  /// <summary>
+  /// Converts a linear value to 8-bit sRGB, rounding in sRGB space
+  /// </summary>
+  UINT8 ToSRGB(float linear) const
+  {
+    if (!(linear > 0))
+    {
+      return 0;
+    }
+    if (linear >= 1)
+    {
+      return 255;
+    }
+
+    // the bucket is within 1 of the answer since buckets are narrower than the gaps between thresholds
+    UINT8 value = buckets[(UINT)(linear * (NUM_BUCKETS - 1))];
+    if (value < 255 && linear >= thresholds[value])
+    {
+      value++;
+    }
+    return value;
+  }
+
+  static float ToLinear(double c)
+  {
+    return (float)(c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4));
+  }
+
+  /// <summary>
+  /// linear value of each 8-bit sRGB value
+  /// </summary>
+  float to_linear[256];
+
+  /// <summary>
+  /// linear value halfway between each pair of consecutive 8-bit sRGB values, so encoding rounds in sRGB space
+  /// </summary>
+  float thresholds[255];
+
+  /// <summary>
+  /// number of evenly spaced linear values with a precomputed sRGB value
+  /// </summary>
+  static const UINT NUM_BUCKETS = 4096;
+
+  /// <summary>
+  /// sRGB value at the start of each bucket
+  /// </summary>
+  UINT8 buckets[NUM_BUCKETS];
+};
+
+/// <summary>
+/// Gets the sRGB tables, building them on first use
+/// </summary>
+static const SRGBTables& GetSRGBTables()
+{
+  static const SRGBTables tables;
+  return tables;
+}
+
+/// <summary>
+/// Looks up the layout of a format
+/// </summary>
+/// <returns>
+/// true if the format is supported
+/// false otherwise
+/// </returns>
+static bool GetFormatInfo(GraphicsDataFormat format, FormatInfo& info)
+{
+  info.srgb = false;
+  switch (format)
+  {
+    case R8_UNORM:            info.type = CHANNEL_UNORM8;  info.num_channels = 1; return true;
+    case R8G8_UNORM:          info.type = CHANNEL_UNORM8;  info.num_channels = 2; return true;
+    case R8B8G8A8_UNORM:
+    case B8G8R8A8_UNORM:      info.type = CHANNEL_UNORM8;  info.num_channels = 4; return true;
+    case R8G8B8A8_UNORM_SRGB:
+    case B8G8R8A8_UNORM_SRGB: info.type = CHANNEL_UNORM8;  info.num_channels = 4; info.srgb = true; return true;
+    case R16G16_FLOAT:        info.type = CHANNEL_FLOAT16; info.num_channels = 2; return true;
+    case R16G16B16A16_FLOAT:  info.type = CHANNEL_FLOAT16; info.num_channels = 4; return true;
+    case R32_FLOAT:           info.type = CHANNEL_FLOAT32; info.num_channels = 1; return true;
+    case R32G32_FLOAT:        info.type = CHANNEL_FLOAT32; info.num_channels = 2; return true;
+    case R32G32B32A32_FLOAT:  info.type = CHANNEL_FLOAT32; info.num_channels = 4; return true;
+    default:                  return false;
+  }
+}
+
+/// <summary>
+/// Gets the layout of a format, failing if it is not supported
+/// </summary>
+/// <exception cref="FrameworkException">
+/// Thrown when the format is not supported
+/// </exception>
+static FormatInfo GetSupportedFormatInfo(GraphicsDataFormat format)
+{
+  FormatInfo info;
+  if (!GetFormatInfo(format, info))
+  {
+    ostringstream out;
+    out << "Mipmaps cannot be generated for format " << (UINT)format;
+    throw FrameworkException(out.str());
+  }
+  return info;
+}
+
+/// <summary>
+/// Converts a 16-bit float to a 32-bit float
+/// </summary>
+static float HalfToFloat(UINT16 half)
+{
+  UINT32 sign     = (UINT32)(half & 0x8000) << 16;
+  UINT32 exponent = (half >> 10) & 0x1F;
+  UINT32 mantissa = half & 0x3FF;
+  UINT32 bits;
+  if (exponent == 0x1F)
+  {
+    bits = sign | 0x7F800000 | (mantissa << 13);
+  }
+  else if (exponent != 0)
+  {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+  else
+  {
+    // subnormal halfs are normal floats
+    float value = mantissa / 16777216.0f;
+    return sign != 0 ? -value : value;
+  }
+
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/// <summary>
+/// Converts a 32-bit float to a 16-bit float, rounding to nearest even
+/// </summary>
+static UINT16 FloatToHalf(float value)
+{
+  UINT32 bits;
+  memcpy(&bits, &value, sizeof(bits));
+  UINT16 sign     = (UINT16)((bits >> 16) & 0x8000);
+  UINT32 abs_bits = bits & 0x7FFFFFFF;
+  if (abs_bits >= 0x7F800000)
+  {
+    return sign | 0x7C00 | (abs_bits > 0x7F800000 ? 0x200 : 0);
+  }
+  if (abs_bits >= 0x477FF000)
+  {
+    return sign | 0x7C00;
+  }
+  if (abs_bits < 0x38800000)
+  {
+    // subnormal half, scaled so the hardware rounding gives the mantissa
+    float abs_value;
+    memcpy(&abs_value, &abs_bits, sizeof(abs_value));
+    return sign | (UINT16)lrintf(abs_value * 16777216.0f);
+  }
+  UINT32 rounded = abs_bits + 0xFFF + ((abs_bits >> 13) & 1) - ((127 - 15) << 23);
+  return sign | (UINT16)(rounded >> 13);
+}
+
+/// <summary>
+/// Normalized sinc function
+/// </summary>
+static float Sinc(float x)
+{
+  if (fabsf(x) < 1e-6f)
+  {
+    return 1;
+  }
+  x *= PI;
+  return sinf(x) / x;
+}
+
+/// <summary>
+/// Modified Bessel function of the first kind of order 0, used by the Kaiser window
+/// </summary>
+static float BesselI0(float x)
+{
+  float sum  = 1;
+  float term = 1;
+  float half_x_sq = x * x * 0.25f;
+  for (UINT k = 1; term > sum * 1e-8f; k++)
+  {
+    term *= half_x_sq / (float)(k * k);
+    sum  += term;
+  }
+  return sum;
+}
+
+/// <summary>
+/// Evaluates a windowed sinc filter
+/// </summary>
+/// <param name="filter">
+/// MIP_FILTER_KAISER or MIP_FILTER_LANCZOS
+/// </param>
+/// <param name="x">
+/// distance from the center of the filter, in texels of the smaller level
+/// </param>
+static float KernelWeight(MipFilter filter, float x)
+{
+  if (fabsf(x) >= FILTER_RADIUS)
+  {
+    return 0;
+  }
+  if (filter == MIP_FILTER_LANCZOS)
+  {
+    return Sinc(x) * Sinc(x / FILTER_RADIUS);
+  }
+
+  float t = x / FILTER_RADIUS;
+  return Sinc(x) * BesselI0(KAISER_ALPHA * sqrtf(1 - t * t)) / BesselI0(KAISER_ALPHA);
+}
+
+/// <summary>
+/// Source texels and weights that make up each texel of the smaller level along 1 axis
+/// </summary>
+struct AxisFilter
+{
+  /// <summary>
+  /// index in indices and weights of the first tap of each smaller texel, plus the total number of taps at the end
+  /// </summary>
+  vector<UINT> offsets;
+
+  /// <summary>
+  /// index of the source texel of each tap
+  /// </summary>
+  vector<UINT> indices;
+
+  /// <summary>
+  /// weight of each tap.  The weights of each smaller texel add up to 1
+  /// </summary>
+  vector<float> weights;
+};
+
+/// <summary>
+/// Computes the taps that shrink 1 axis of a level
+/// </summary>
+/// <param name="src_size">
+/// number of texels along the axis in the larger level
+/// </param>
+/// <param name="dst_size">
+/// number of texels along the axis in the smaller level
+/// </param>
+/// <param name="filter">
+/// filter to shrink with
+/// </param>
+/// <param name="edge_mode">
+/// how to read texels beyond the edges
+/// </param>
+/// <param name="axis">
+/// output parameter for the taps
+/// </param>
+static void BuildAxisFilter(UINT src_size, UINT dst_size, MipFilter filter, MipEdgeMode edge_mode, AxisFilter& axis)
+{
+  float scale = src_size / (float)dst_size;
+  axis.offsets.assign(1, 0);
+  axis.indices.clear();
+  axis.weights.clear();
+  for (UINT dst = 0; dst < dst_size; dst++)
+  {
+    if (filter == MIP_FILTER_BOX)
+    {
+      // how much of each source texel the smaller texel covers
+      float start = dst * scale;
+      float end   = (dst + 1) * scale;
+      for (UINT src = (UINT)start; src < src_size && src < end; src++)
+      {
+        float weight = min(end, (float)(src + 1)) - max(start, (float)src);
+        if (weight > 0)
+        {
+          axis.indices.push_back(src);
+          axis.weights.push_back(weight);
+        }
+      }
+    }
+    else
+    {
+      float center = (dst + 0.5f) * scale - 0.5f;
+      float radius = FILTER_RADIUS * scale;
+      int   first  = (int)ceilf(center - radius);
+      int   last   = (int)floorf(center + radius);
+      for (int src = first; src <= last; src++)
+      {
+        float weight = KernelWeight(filter, (src - center) / scale);
+        if (weight == 0)
+        {
+          continue;
+        }
+
+        int index = src;
+        if (edge_mode == MIP_EDGE_WRAP)
+        {
+          index = ((src % (int)src_size) + (int)src_size) % (int)src_size;
+        }
+        else
+        {
+          index = min(max(src, 0), (int)src_size - 1);
+        }
+        axis.indices.push_back((UINT)index);
+        axis.weights.push_back(weight);
+      }
+    }
+
+    float total = 0;
+    for (size_t i = axis.offsets.back(); i < axis.weights.size(); i++)
+    {
+      total += axis.weights[i];
+    }
+    for (size_t i = axis.offsets.back(); i < axis.weights.size(); i++)
+    {
+      axis.weights[i] /= total;
+    }
+    axis.offsets.push_back((UINT)axis.weights.size());
+  }
+}
+
+/// <summary>
+/// Number of rows of a given length to give each job on a worker thread
+/// </summary>
+static UINT RowsPerJob(size_t row_texels)
+{
+  return (UINT)max((size_t)1, TEXELS_PER_JOB / max(row_texels, (size_t)1));
+}
+
+/// <summary>
+/// Shrinks the rows of an image along x
+/// </summary>
+/// <param name="read_row">
+/// function taking a row index and a scratch vector, returning the 4 floats per texel of that row of the larger image
+/// </param>
+/// <param name="src_width">
+/// width of the larger image
+/// </param>
+/// <param name="num_rows">
+/// number of rows in the image, across every slice
+/// </param>
+/// <param name="axis">
+/// taps along x
+/// </param>
+/// <param name="dst_width">
+/// width of the smaller image
+/// </param>
+/// <param name="dst">
+/// output parameter for 4 floats per texel of the image with narrower rows
+/// </param>
+template <typename ReadRow>
+static void FilterRows(ReadRow read_row, UINT src_width, UINT num_rows, const AxisFilter& axis, UINT dst_width, float* dst)
+{
+  ThreadPool::GetDefault().ParallelFor(num_rows, RowsPerJob(src_width), [&](UINT begin, UINT end)
+  {
+    vector<float> row_scratch;
+    for (UINT row = begin; row < end; row++)
+    {
+      const float* in  = read_row(row, row_scratch);
+      float*       out = dst + (size_t)row * dst_width * 4;
+      for (UINT x = 0; x < dst_width; x++)
+      {
+        __m128 sum = _mm_setzero_ps();
+        for (UINT tap = axis.offsets[x]; tap < axis.offsets[x + 1]; tap++)
+        {
+          sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(axis.weights[tap]), _mm_loadu_ps(in + axis.indices[tap] * 4)));
+        }
+        _mm_storeu_ps(out + x * 4, sum);
+      }
+    }
+  });
+}
+
+/// <summary>
+/// Shrinks an image along y or z by combining whole lines of texels.  Shrinking along y uses rows as lines and slices
+/// as groups, shrinking along z uses slices as lines and the whole image as 1 group
+/// </summary>
+/// <param name="src">
+/// 4 floats per texel of the larger image
+/// </param>
+/// <param name="line_texels">
+/// number of texels in each line
+/// </param>
+/// <param name="num_groups">
+/// number of groups of lines that are shrunk separately
+/// </param>
+/// <param name="src_lines">
+/// number of lines in each group of the larger image
+/// </param>
+/// <param name="axis">
+/// taps along the axis
+/// </param>
+/// <param name="dst_lines">
+/// number of lines in each group of the smaller image
+/// </param>
+/// <param name="dst">
+/// output parameter for 4 floats per texel of the smaller image
+/// </param>
+static void FilterLines(const float* src, size_t line_texels, UINT num_groups, UINT src_lines, const AxisFilter& axis, UINT dst_lines, float* dst)
+{
+  size_t line_floats = line_texels * 4;
+  ThreadPool::GetDefault().ParallelFor(num_groups * dst_lines, RowsPerJob(line_texels), [&](UINT begin, UINT end)
+  {
+    for (UINT line = begin; line < end; line++)
+    {
+      UINT         group = line / dst_lines;
+      UINT         index = line % dst_lines;
+      const float* in    = src + (size_t)group * src_lines * line_floats;
+      float*       out   = dst + (size_t)line * line_floats;
+
+      UINT   tap     = axis.offsets[index];
+      __m128 weight  = _mm_set1_ps(axis.weights[tap]);
+      const float* src_line = in + axis.indices[tap] * line_floats;
+      for (size_t i = 0; i < line_floats; i += 4)
+      {
+        _mm_storeu_ps(out + i, _mm_mul_ps(weight, _mm_loadu_ps(src_line + i)));
+      }
+      for (tap++; tap < axis.offsets[index + 1]; tap++)
+      {
+        weight   = _mm_set1_ps(axis.weights[tap]);
+        src_line = in + axis.indices[tap] * line_floats;
+        for (size_t i = 0; i < line_floats; i += 4)
+        {
+          _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(weight, _mm_loadu_ps(src_line + i))));
+        }
+      }
+    }
+  });
+}
+
+/// <summary>
+/// Converts a row of texels to 4 linear floats per texel.  Missing channels are 0
+/// </summary>
+static void DecodeRow(const UINT8* src, UINT width, const FormatInfo& info, float* dst)
+{
+  if (info.type == CHANNEL_UNORM8 && info.num_channels == 4 && !info.srgb)
+  {
+    const __m128  scale = _mm_set1_ps(1 / 255.0f);
+    const __m128i zero  = _mm_setzero_si128();
+    for (UINT x = 0; x < width; x++)
+    {
+      INT32 bytes;
+      memcpy(&bytes, src + x * 4, sizeof(bytes));
+      __m128i ints = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+      _mm_storeu_ps(dst + x * 4, _mm_mul_ps(_mm_cvtepi32_ps(ints), scale));
+    }
+    return;
+  }
+
+  const SRGBTables& srgb = GetSRGBTables();
+  for (UINT x = 0; x < width; x++)
+  {
+    float texel[4] = { 0, 0, 0, 0 };
+    switch (info.type)
+    {
+      case CHANNEL_UNORM8:
+        for (UINT c = 0; c < info.num_channels; c++)
+        {
+          texel[c] = info.srgb && c < 3 ? srgb.to_linear[src[c]] : src[c] / 255.0f;
+        }
+        src += info.num_channels;
+        break;
+      case CHANNEL_FLOAT16:
+        for (UINT c = 0; c < info.num_channels; c++)
+        {
+          UINT16 half;
+          memcpy(&half, src + c * sizeof(half), sizeof(half));
+          texel[c] = HalfToFloat(half);
+        }
+        src += info.num_channels * sizeof(UINT16);
+        break;
+      case CHANNEL_FLOAT32:
+        memcpy(texel, src, info.num_channels * sizeof(float));
+        src += info.num_channels * sizeof(float);
+        break;
+    }
+    _mm_storeu_ps(dst + x * 4, _mm_loadu_ps(texel));
+  }
+}
+
+/// <summary>
+/// Converts a row of 4 linear floats per texel to the format
+/// </summary>
+static void EncodeRow(const float* src, UINT width, const FormatInfo& info, UINT8* dst)
+{
+  if (info.type == CHANNEL_UNORM8)
+  {
+    const SRGBTables& srgb  = GetSRGBTables();
+    const __m128      zero  = _mm_setzero_ps();
+    const __m128      one   = _mm_set1_ps(1);
+    const __m128      scale = _mm_set1_ps(255);
+    const __m128      half  = _mm_set1_ps(0.5f);
+    for (UINT x = 0; x < width; x++)
+    {
+      __m128  texel = _mm_loadu_ps(src + x * 4);
+      __m128i ints  = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(texel, zero), one), scale), half));
+      UINT32  bytes = (UINT32)_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(ints, ints), ints));
+      if (info.srgb)
+      {
+        // the color channels round in sRGB space, alpha stays linear
+        float color[4];
+        _mm_storeu_ps(color, texel);
+        bytes &= 0xFF000000;
+        for (UINT c = 0; c < 3; c++)
+        {
+          bytes |= (UINT32)srgb.ToSRGB(color[c]) << (c * 8);
+        }
+      }
+      memcpy(dst, &bytes, info.num_channels);
+      dst += info.num_channels;
+    }
+  }
+  else if (info.type == CHANNEL_FLOAT16)
+  {
+    for (UINT x = 0; x < width; x++)
+    {
+      for (UINT c = 0; c < info.num_channels; c++)
+      {
+        UINT16 half = FloatToHalf(src[x * 4 + c]);
+        memcpy(dst, &half, sizeof(half));
+        dst += sizeof(half);
+      }
+    }
+  }
+  else
+  {
+    for (UINT x = 0; x < width; x++)
+    {
+      memcpy(dst, src + x * 4, info.num_channels * sizeof(float));
+      dst += info.num_channels * sizeof(float);
+    }
+  }
+}
+
+bool MipGenerator::IsFormatSupported(GraphicsDataFormat format)
+{
+  FormatInfo info;
+  return GetFormatInfo(format, info);
+}
+
+UINT MipGenerator::GetBytesPerTexel(GraphicsDataFormat format)
+{
+  FormatInfo info = GetSupportedFormatInfo(format);
+  UINT channel_size = info.type == CHANNEL_UNORM8 ? 1 : info.type == CHANNEL_FLOAT16 ? 2 : 4;
+  return channel_size * info.num_channels;
+}
+
+UINT16 MipGenerator::GetNumLevels(UINT width, UINT height, UINT depth)
+{
+  UINT   largest    = max(width, max(height, depth));
+  UINT16 num_levels = 1;
+  while (largest > 1)
+  {
+    largest >>= 1;
+    num_levels++;
+  }
+  return num_levels;
+}
+
+void MipGenerator::Generate(const void* src, UINT width, UINT height, UINT depth, GraphicsDataFormat format, MipFilter filter,
+  MipEdgeMode edge_mode, UINT num_levels, const MipLevelData* levels)
+{
+  FormatInfo info = GetSupportedFormatInfo(format);
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (width == 0 || height == 0 || depth == 0)
+  {
+    throw FrameworkException("Cannot generate mipmaps for an empty texture");
+  }
+  if (num_levels == 0 || num_levels > GetNumLevels(width, height, depth))
+  {
+    ostringstream out;
+    out << "Cannot generate " << num_levels << " mipmap levels for a " << width << "x" << height << "x" << depth << " texture";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  // top level is copied as is
+  UINT         src_row_size = width * GetBytesPerTexel(format);
+  const UINT8* src_bytes    = (const UINT8*)src;
+  for (UINT z = 0; z < depth; z++)
+  {
+    for (UINT y = 0; y < height; y++)
+    {
+      memcpy((UINT8*)levels[0].data + (size_t)z * levels[0].slice_pitch + (size_t)y * levels[0].row_pitch,
+        src_bytes + ((size_t)z * height + y) * src_row_size, src_row_size);
+    }
+  }
+  if (num_levels == 1)
+  {
+    return;
+  }
+
+  // each level is shrunk 1 axis at a time, skipping axes that are already 1 texel.  The top level is decoded as its
+  // rows are read, and always goes through the x pass so there is a float copy of it to read along y and z
+  vector<float> level;
+  vector<float> scratch;
+  vector<float> next;
+  AxisFilter    axis;
+  for (UINT l = 1; l < num_levels; l++)
+  {
+    UINT next_width  = max(width >> 1, 1u);
+    UINT next_height = max(height >> 1, 1u);
+    UINT next_depth  = max(depth >> 1, 1u);
+
+    const float* curr = level.data();
+    if (l == 1)
+    {
+      BuildAxisFilter(width, next_width, filter, edge_mode, axis);
+      scratch.resize((size_t)next_width * height * depth * 4);
+      UINT src_width = width;
+      FilterRows([&](UINT row, vector<float>& row_scratch) -> const float*
+      {
+        row_scratch.resize(src_width * 4);
+        DecodeRow(src_bytes + (size_t)row * src_row_size, src_width, info, row_scratch.data());
+        return row_scratch.data();
+      }, width, height * depth, axis, next_width, scratch.data());
+      curr = scratch.data();
+    }
+    else if (next_width != width)
+    {
+      BuildAxisFilter(width, next_width, filter, edge_mode, axis);
+      scratch.resize((size_t)next_width * height * depth * 4);
+      size_t row_floats = (size_t)width * 4;
+      FilterRows([&](UINT row, vector<float>&) -> const float*
+      {
+        return curr + row * row_floats;
+      }, width, height * depth, axis, next_width, scratch.data());
+      curr = scratch.data();
+    }
+    if (next_height != height)
+    {
+      BuildAxisFilter(height, next_height, filter, edge_mode, axis);
+      next.resize((size_t)next_width * next_height * depth * 4);
+      FilterLines(curr, next_width, depth, height, axis, next_height, next.data());
+      curr = next.data();
+    }
+    if (next_depth != depth)
+    {
+      BuildAxisFilter(depth, next_depth, filter, edge_mode, axis);
+      vector<float>& dst = curr == next.data() ? scratch : next;
+      dst.resize((size_t)next_width * next_height * next_depth * 4);
+      FilterLines(curr, (size_t)next_width * next_height, 1, depth, axis, next_depth, dst.data());
+      curr = dst.data();
+    }
+
+    const MipLevelData& dst_level = levels[l];
+    ThreadPool::GetDefault().ParallelFor(next_height * next_depth, RowsPerJob(next_width), [&](UINT begin, UINT end)
+    {
+      for (UINT row = begin; row < end; row++)
+      {
+        UINT8* dst_row = (UINT8*)dst_level.data + (size_t)(row / next_height) * dst_level.slice_pitch + (size_t)(row % next_height) * dst_level.row_pitch;
+        EncodeRow(curr + (size_t)row * next_width * 4, next_width, info, dst_row);
+      }
+    });
+
+    level.swap(curr == scratch.data() ? scratch : next);
+    width  = next_width;
+    height = next_height;
+    depth  = next_depth;
+  }
+}
+
+void MipGenerator::Generate(const vector<UINT8>& src, UINT width, UINT height, UINT depth, GraphicsDataFormat format, MipFilter filter,
+  MipEdgeMode edge_mode, UINT num_levels, vector<vector<UINT8> >& levels)
+{
+  UINT bytes_per_texel = GetBytesPerTexel(format);
+  if (src.size() < (size_t)width * height * depth * bytes_per_texel)
+  {
+    ostringstream out;
+    out << "Texture data is " << src.size() << " bytes, which is too small for a " << width << "x" << height << "x" << depth << " texture";
+    throw FrameworkException(out.str());
+  }
+
+  levels.resize(num_levels);
+  vector<MipLevelData> level_data(num_levels);
+  for (UINT l = 0; l < num_levels; l++)
+  {
+    UINT level_width  = max(width >> l, 1u);
+    UINT level_height = max(height >> l, 1u);
+    UINT level_depth  = max(depth >> l, 1u);
+    levels[l].resize((size_t)level_width * level_height * level_depth * bytes_per_texel);
+    level_data[l].data        = levels[l].data();
+    level_data[l].row_pitch   = level_width * bytes_per_texel;
+    level_data[l].slice_pitch = level_width * level_height * bytes_per_texel;
+  }
+
+  Generate(src.empty() ? NULL : &src[0], width, height, depth, format, filter, edge_mode, num_levels, level_data.data());
+}
@@ -0,0 +1,312 @@
+#include <limits.h>
+#include <math.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/Textures/MipStreamingPolicy.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+MipStreamingPolicy::MipStreamingPolicy(UINT64 memory_budget, UINT64 upload_budget)
+:m_memory_budget(memory_budget),
+ m_upload_budget(upload_budget),
+ m_resident_bytes(0)
+{
+}
+
+MipStreamingPolicy::~MipStreamingPolicy()
+{
+}
+
+UINT16 MipStreamingPolicy::GetLevelForScreenSize(UINT width, UINT height, UINT16 num_levels, float screen_size)
+{
+  UINT16 last_level = num_levels - 1;
+  if (screen_size <= 0)
+  {
+    return last_level;
+  }
+
+  // each level halves the size, so the level is how many times the texture can be halved and still cover the pixels
+  float texels_per_pixel = max(width, height) / screen_size;
+  if (texels_per_pixel <= 1)
+  {
+    return 0;
+  }
+  float level = floorf(log2f(texels_per_pixel));
+  return (level >= last_level) ? last_level : (UINT16)level;
+}
+
+float MipStreamingPolicy::GetScreenSizeAtDistance(float radius, float distance, float fov_y, float viewport_height)
+{
+  if (distance <= radius)
+  {
+    // the camera is inside of the object, which covers the screen
+    return viewport_height;
+  }
+  return radius * viewport_height / (distance * tanf(fov_y / 2));
+}
+
+UINT MipStreamingPolicy::AddTexture(UINT width, UINT height, const vector<UINT64>& level_sizes, UINT16 num_streamed_levels)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (level_sizes.empty())
+  {
+    throw FrameworkException("A streamed texture needs at least 1 mipmap level");
+  }
+  if (num_streamed_levels >= level_sizes.size())
+  {
+    ostringstream out;
+    out << num_streamed_levels << " streamed levels leaves no tail out of " << level_sizes.size() << " mipmap levels";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  TextureState state;
+  state.width        = width;
+  state.height       = height;
+  state.level_sizes  = level_sizes;
+  state.num_levels   = (UINT16)level_sizes.size();
+  state.num_streamed = num_streamed_levels;
+  state.resident     = num_streamed_levels;
+  state.desired      = state.num_levels - 1;
+  state.uploading    = false;
+  state.screen_size  = 0;
+  m_textures.push_back(state);
+
+  for (UINT16 level = num_streamed_levels; level < state.num_levels; level++)
+  {
+    m_resident_bytes += level_sizes[level];
+  }
+
+  return (UINT)m_textures.size() - 1;
+}
+
+void MipStreamingPolicy::SetScreenSize(UINT texture, float screen_size)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (texture >= m_textures.size())
+  {
+    ostringstream out;
+    out << "Texture index " << texture << " is out of range, only " << m_textures.size() << " textures";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  TextureState& state = m_textures[texture];
+  state.screen_size = screen_size;
+  state.desired     = GetLevelForScreenSize(state.width, state.height, state.num_levels, screen_size);
+}
+
+void MipStreamingPolicy::SetMemoryBudget(UINT64 memory_budget)
+{
+  m_memory_budget = memory_budget;
+}
+
+void MipStreamingPolicy::SetUploadBudget(UINT64 upload_budget)
+{
+  m_upload_budget = upload_budget;
+}
+
+UINT MipStreamingPolicy::GetNumTextures() const
+{
+  return (UINT)m_textures.size();
+}
+
+UINT16 MipStreamingPolicy::GetResidentLevel(UINT texture) const
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (texture >= m_textures.size())
+  {
+    ostringstream out;
+    out << "Texture index " << texture << " is out of range, only " << m_textures.size() << " textures";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return m_textures[texture].resident;
+}
+
+UINT16 MipStreamingPolicy::GetDesiredLevel(UINT texture) const
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (texture >= m_textures.size())
+  {
+    ostringstream out;
+    out << "Texture index " << texture << " is out of range, only " << m_textures.size() << " textures";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return m_textures[texture].desired;
+}
+
+UINT64 MipStreamingPolicy::GetResidentBytes() const
+{
+  return m_resident_bytes;
+}
+
+void MipStreamingPolicy::Schedule(vector<MipStreamingAction>& uploads, vector<MipStreamingAction>& evictions)
+{
+  uploads.clear();
+  evictions.clear();
+
+  // a texture that gives up a level does not upload in the same call, so levels are not evicted only to come back
+  vector<bool> evicted(m_textures.size(), false);
+
+  // the budget may have been lowered
+  while (m_resident_bytes > m_memory_budget)
+  {
+    UINT victim = FindVictim(UINT_MAX);
+    if (victim == UINT_MAX)
+    {
+      break;
+    }
+    Evict(victim, evictions);
+    evicted[victim] = true;
+  }
+
+  vector<UINT> candidates;
+  for (UINT i = 0; i < m_textures.size(); i++)
+  {
+    if (!evicted[i] && !m_textures[i].uploading && m_textures[i].desired < m_textures[i].resident)
+    {
+      candidates.push_back(i);
+    }
+  }
+  stable_sort(candidates.begin(), candidates.end(), [this](UINT a, UINT b)
+  {
+    const TextureState& state_a = m_textures[a];
+    const TextureState& state_b = m_textures[b];
+    int missing_a = state_a.resident - state_a.desired;
+    int missing_b = state_b.resident - state_b.desired;
+    if (missing_a != missing_b)
+    {
+      return missing_a > missing_b;
+    }
+    return state_a.screen_size > state_b.screen_size;
+  });
+
+  UINT64 upload_bytes = 0;
+  for (vector<UINT>::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+  {
+    if (evicted[*it])
+    {
+      continue;
+    }
+
+    TextureState& state = m_textures[*it];
+    UINT16 level = state.resident - 1;
+    UINT64 size  = state.level_sizes[level];
+    if (upload_bytes != 0 && upload_bytes + size > m_upload_budget)
+    {
+      continue;
+    }
+
+    // only evict once it is known that enough can be evicted, so a failed upload does not cost any levels
+    vector<UINT> victims;
+    UINT64 freed = 0;
+    bool fits = true;
+    while (m_resident_bytes - freed + size > m_memory_budget)
+    {
+      UINT victim = FindVictim(*it);
+      if (victim == UINT_MAX)
+      {
+        fits = false;
+        break;
+      }
+
+      // evicting the level on paper lets FindVictim consider the victim's next level
+      freed += m_textures[victim].level_sizes[m_textures[victim].resident];
+      m_textures[victim].resident++;
+      victims.push_back(victim);
+    }
+    for (vector<UINT>::const_reverse_iterator victim = victims.rbegin(); victim != victims.rend(); ++victim)
+    {
+      m_textures[*victim].resident--;
+    }
+    if (!fits)
+    {
+      continue;
+    }
+
+    for (vector<UINT>::const_iterator victim = victims.begin(); victim != victims.end(); ++victim)
+    {
+      Evict(*victim, evictions);
+      evicted[*victim] = true;
+    }
+
+    MipStreamingAction upload = { *it, level };
+    uploads.push_back(upload);
+    state.uploading   = true;
+    upload_bytes     += size;
+    m_resident_bytes += size;
+  }
+}
+
+void MipStreamingPolicy::OnUploaded(const MipStreamingAction& upload)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (upload.texture >= m_textures.size())
+  {
+    ostringstream out;
+    out << "Texture index " << upload.texture << " is out of range, only " << m_textures.size() << " textures";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  TextureState& state = m_textures[upload.texture];
+  if (!state.uploading || upload.mip_level + 1 != state.resident)
+  {
+    ostringstream out;
+    out << "Mipmap level " << upload.mip_level << " of texture " << upload.texture << " was not being uploaded";
+    throw FrameworkException(out.str());
+  }
+
+  state.resident  = upload.mip_level;
+  state.uploading = false;
+}
+
+UINT MipStreamingPolicy::FindVictim(UINT candidate) const
+{
+  // levels the candidate is missing, which a victim must still be missing fewer of after giving up a level
+  int candidate_missing = INT_MAX;
+  if (candidate != UINT_MAX)
+  {
+    candidate_missing = m_textures[candidate].resident - m_textures[candidate].desired;
+  }
+
+  UINT victim = UINT_MAX;
+  int victim_missing = INT_MAX;
+  for (UINT i = 0; i < m_textures.size(); i++)
+  {
+    const TextureState& state = m_textures[i];
+    if (i == candidate || state.uploading || state.resident >= state.num_streamed)
+    {
+      continue;
+    }
+
+    int missing = state.resident + 1 - state.desired;
+    if (missing >= candidate_missing)
+    {
+      continue;
+    }
+    if (victim == UINT_MAX || missing < victim_missing ||
+        (missing == victim_missing && state.screen_size < m_textures[victim].screen_size))
+    {
+      victim = i;
+      victim_missing = missing;
+    }
+  }
+
+  return victim;
+}
+
+void MipStreamingPolicy::Evict(UINT texture, vector<MipStreamingAction>& evictions)
+{
+  TextureState& state = m_textures[texture];
+  MipStreamingAction eviction = { texture, state.resident };
+  evictions.push_back(eviction);
+
+  m_resident_bytes -= state.level_sizes[state.resident];
+  state.resident++;
+}
@@ -0,0 +1,662 @@
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <emmintrin.h>
+#include "lodepng/lodepng.h"
+#include "Graphics/Textures/PngDecoder.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// number of bytes in the signature and IHDR chunk at the start of every PNG file
+/// </summary>
+const size_t PNG_HEADER_SIZE = 33;
+
+/// <summary>
+/// number of bytes in a chunk besides its data, for the length, type and CRC
+/// </summary>
+const size_t PNG_CHUNK_OVERHEAD = 12;
+
+/// <summary>
+/// Throws the description of a lodepng error
+/// </summary>
+/// <param name="error">
+/// lodepng error code
+/// </param>
+/// <exception cref="FrameworkException">
+/// Always thrown
+/// </exception>
+static void ThrowLodepngError(unsigned error)
+{
+  ostringstream out;
+  out << "Unable to decode PNG: " << lodepng_error_text(error);
+  throw FrameworkException(out.str());
+}
+
+/// <summary>
+/// Reads the header of a PNG file
+/// </summary>
+/// <param name="png">
+/// contents of the PNG file
+/// </param>
+/// <param name="size">
+/// number of bytes in png
+/// </param>
+/// <param name="width">
+/// output parameter for the width of the image in texels
+/// </param>
+/// <param name="height">
+/// output parameter for the height of the image in texels
+/// </param>
+/// <param name="color_type">
+/// output parameter for the color type of the image
+/// </param>
+/// <param name="bit_depth">
+/// output parameter for the number of bits per channel
+/// </param>
+/// <param name="interlaced">
+/// output parameter for if the image is interlaced
+/// </param>
+/// <exception cref="FrameworkException">
+/// Thrown when the header is not valid
+/// </exception>
+static void Inspect(const void* png, size_t size, UINT& width, UINT& height, LodePNGColorType& color_type,
+  UINT& bit_depth, bool& interlaced)
+{
+  LodePNGState state;
+  lodepng_state_init(&state);
+
+  unsigned w;
+  unsigned h;
+  unsigned error = lodepng_inspect(&w, &h, &state, (const unsigned char*)png, size);
+  if (error == 0)
+  {
+    width = w;
+    height = h;
+    color_type = state.info_png.color.colortype;
+    bit_depth = state.info_png.color.bitdepth;
+    interlaced = state.info_png.interlace_method != 0;
+  }
+  lodepng_state_cleanup(&state);
+
+  if (error != 0)
+  {
+    ThrowLodepngError(error);
+  }
+}
+
+/// <summary>
+/// Predictor of the Paeth filter
+/// </summary>
+/// <param name="a">
+/// byte to the left
+/// </param>
+/// <param name="b">
+/// byte above
+/// </param>
+/// <param name="c">
+/// byte above and to the left
+/// </param>
+/// <returns>
+/// whichever of a, b and c is closest to a + b - c
+/// </returns>
+static inline UINT8 PaethPredictor(int a, int b, int c)
+{
+  int pa = abs(b - c);
+  int pb = abs(a - c);
+  int pc = abs(a + b - 2 * c);
+  if (pa <= pb && pa <= pc)
+  {
+    return (UINT8)a;
+  }
+  return (UINT8)(pb <= pc ? b : c);
+}
+
+/// <summary>
+/// Loads 1 RGBA texel into the low 4 16-bit lanes
+/// </summary>
+/// <param name="src">
+/// texel to load
+/// </param>
+/// <returns>
+/// zero extended texel
+/// </returns>
+static inline __m128i LoadTexel(const UINT8* src)
+{
+  int texel;
+  memcpy(&texel, src, sizeof(texel));
+  return _mm_unpacklo_epi8(_mm_cvtsi32_si128(texel), _mm_setzero_si128());
+}
+
+/// <summary>
+/// Stores the low 4 16-bit lanes as 1 RGBA texel
+/// </summary>
+/// <param name="dst">
+/// where to store the texel
+/// </param>
+/// <param name="texel">
+/// texel to store, each lane holding 1 channel from 0 to 255
+/// </param>
+static inline void StoreTexel(UINT8* dst, __m128i texel)
+{
+  int packed = _mm_cvtsi128_si32(_mm_packus_epi16(texel, texel));
+  memcpy(dst, &packed, sizeof(packed));
+}
+
+/// <summary>
+/// Picks lanes from 2 vectors
+/// </summary>
+/// <param name="mask">
+/// all 1s in lanes to take from if_set, all 0s in lanes to take from if_clear
+/// </param>
+/// <param name="if_set">
+/// lanes used where mask is set
+/// </param>
+/// <param name="if_clear">
+/// lanes used where mask is clear
+/// </param>
+/// <returns>
+/// combined lanes
+/// </returns>
+static inline __m128i Select(__m128i mask, __m128i if_set, __m128i if_clear)
+{
+  return _mm_or_si128(_mm_and_si128(mask, if_set), _mm_andnot_si128(mask, if_clear));
+}
+
+/// <summary>
+/// Reverses the sub, average and paeth filters of a scanline of RGBA texels with SSE2, 1 texel at a time, since each
+/// texel depends on the one to its left
+/// </summary>
+/// <param name="filter">
+/// filter type, 1, 3 or 4
+/// </param>
+/// <param name="src">
+/// filtered bytes of the scanline, after the filter type
+/// </param>
+/// <param name="prev">
+/// unfiltered previous scanline, which is all 0 for the first scanline
+/// </param>
+/// <param name="dst">
+/// where to write the unfiltered scanline
+/// </param>
+/// <param name="width">
+/// number of texels in the scanline
+/// </param>
+static void UnfilterRGBA(UINT8 filter, const UINT8* src, const UINT8* prev, UINT8* dst, UINT width)
+{
+  __m128i zero = _mm_setzero_si128();
+  __m128i a = zero;
+  __m128i c = zero;
+  for (UINT i = 0; i < width; i++, src += 4, prev += 4, dst += 4)
+  {
+    __m128i x = LoadTexel(src);
+    __m128i b = LoadTexel(prev);
+    __m128i predicted;
+    if (filter == 1)
+    {
+      predicted = a;
+    }
+    else if (filter == 3)
+    {
+      predicted = _mm_srli_epi16(_mm_add_epi16(a, b), 1);
+    }
+    else
+    {
+      // pick whichever of a, b and c is closest to a + b - c, preferring a, then b
+      __m128i pa = _mm_sub_epi16(b, c);
+      __m128i pb = _mm_sub_epi16(a, c);
+      __m128i pc = _mm_add_epi16(pa, pb);
+      pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+      pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+      pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+      __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+      predicted = Select(_mm_cmpeq_epi16(smallest, pc), c, b);
+      predicted = Select(_mm_cmpeq_epi16(smallest, pb), b, predicted);
+      predicted = Select(_mm_cmpeq_epi16(smallest, pa), a, predicted);
+    }
+
+    a = _mm_and_si128(_mm_add_epi16(x, predicted), _mm_set1_epi16(0xFF));
+    c = b;
+    StoreTexel(dst, a);
+  }
+}
+
+/// <summary>
+/// Reverses the filter of 1 scanline
+/// </summary>
+/// <param name="filter">
+/// filter type from the start of the scanline
+/// </param>
+/// <param name="src">
+/// filtered bytes of the scanline, after the filter type
+/// </param>
+/// <param name="prev">
+/// unfiltered previous scanline
+/// NULL for the first scanline
+/// </param>
+/// <param name="dst">
+/// where to write the unfiltered scanline
+/// </param>
+/// <param name="row_bytes">
+/// number of bytes in the scanline
+/// </param>
+/// <param name="bpp">
+/// number of bytes per texel
+/// </param>
+/// <param name="zero_row">
+/// row_bytes of 0, used for prev on the first scanline of RGBA images
+/// </param>
+/// <returns>
+/// true if the filter type is valid
+/// false otherwise
+/// </returns>
+static bool Unfilter(UINT8 filter, const UINT8* src, const UINT8* prev, UINT8* dst, UINT row_bytes, UINT bpp,
+  const UINT8* zero_row)
+{
+  if (bpp == 4 && (filter == 1 || filter == 3 || filter == 4))
+  {
+    UnfilterRGBA(filter, src, prev == NULL ? zero_row : prev, dst, row_bytes / 4);
+    return true;
+  }
+
+  switch (filter)
+  {
+    case 0: // none
+      memcpy(dst, src, row_bytes);
+      break;
+
+    case 1: // sub
+      memcpy(dst, src, bpp);
+      for (UINT i = bpp; i < row_bytes; i++)
+      {
+        dst[i] = (UINT8)(src[i] + dst[i - bpp]);
+      }
+      break;
+
+    case 2: // up
+      if (prev == NULL)
+      {
+        memcpy(dst, src, row_bytes);
+      }
+      else
+      {
+        for (UINT i = 0; i < row_bytes; i++)
+        {
+          dst[i] = (UINT8)(src[i] + prev[i]);
+        }
+      }
+      break;
+
+    case 3: // average
+      if (prev == NULL)
+      {
+        memcpy(dst, src, bpp);
+        for (UINT i = bpp; i < row_bytes; i++)
+        {
+          dst[i] = (UINT8)(src[i] + (dst[i - bpp] >> 1));
+        }
+      }
+      else
+      {
+        for (UINT i = 0; i < bpp; i++)
+        {
+          dst[i] = (UINT8)(src[i] + (prev[i] >> 1));
+        }
+        for (UINT i = bpp; i < row_bytes; i++)
+        {
+          dst[i] = (UINT8)(src[i] + ((dst[i - bpp] + prev[i]) >> 1));
+        }
+      }
+      break;
+
+    case 4: // paeth, which is the same as sub on the first scanline
+      if (prev == NULL)
+      {
+        memcpy(dst, src, bpp);
+        for (UINT i = bpp; i < row_bytes; i++)
+        {
+          dst[i] = (UINT8)(src[i] + dst[i - bpp]);
+        }
+      }
+      else
+      {
+        for (UINT i = 0; i < bpp; i++)
+        {
+          dst[i] = (UINT8)(src[i] + prev[i]);
+        }
+        for (UINT i = bpp; i < row_bytes; i++)
+        {
+          dst[i] = (UINT8)(src[i] + PaethPredictor(dst[i - bpp], prev[i], prev[i - bpp]));
+        }
+      }
+      break;
+
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+/// <summary>
+/// Converts 1 unfiltered scanline to RGBA
+/// </summary>
+/// <param name="src">
+/// unfiltered scanline
+/// </param>
+/// <param name="dst">
+/// where to write the RGBA texels
+/// </param>
+/// <param name="width">
+/// number of texels in the scanline
+/// </param>
+/// <param name="color_type">
+/// PNG color type of src
+/// </param>
+static void ExpandToRGBA(const UINT8* src, UINT8* dst, UINT width, LodePNGColorType color_type)
+{
+  switch (color_type)
+  {
+    case LCT_RGB:
+      for (UINT i = 0; i < width; i++, src += 3, dst += 4)
+      {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = 255;
+      }
+      break;
+
+    case LCT_GREY:
+      for (UINT i = 0; i < width; i++, src += 1, dst += 4)
+      {
+        dst[0] = dst[1] = dst[2] = src[0];
+        dst[3] = 255;
+      }
+      break;
+
+    case LCT_GREY_ALPHA:
+      for (UINT i = 0; i < width; i++, src += 2, dst += 4)
+      {
+        dst[0] = dst[1] = dst[2] = src[0];
+        dst[3] = src[1];
+      }
+      break;
+
+    default:
+      memcpy(dst, src, width * 4);
+      break;
+  }
+}
+
+/// <summary>
+/// Decodes an image with lodepng and copies its rows to the destination
+/// </summary>
+/// <param name="png">
+/// contents of the PNG file
+/// </param>
+/// <param name="size">
+/// number of bytes in png
+/// </param>
+/// <param name="dst">
+/// where to write the rows
+/// </param>
+/// <exception cref="FrameworkException">
+/// Thrown when the image cannot be decoded
+/// </exception>
+static void DecodeWithLodepng(const void* png, size_t size, const PngDestination& dst)
+{
+  unsigned char* image;
+  unsigned width;
+  unsigned height;
+  unsigned error = lodepng_decode_memory(&image, &width, &height, (const unsigned char*)png, size, LCT_RGBA, 8);
+  if (error != 0)
+  {
+    ThrowLodepngError(error);
+  }
+
+  const UINT8* src = image;
+  UINT8* dst_row = (UINT8*)dst.data;
+  for (UINT y = 0; y < height; y++, src += width * 4, dst_row += dst.row_pitch)
+  {
+    memcpy(dst_row, src, width * 4);
+  }
+  free(image);
+}
+
+/// <summary>
+/// Reads a file
+/// </summary>
+/// <param name="path">
+/// path of the file
+/// </param>
+/// <param name="contents">
+/// output parameter for the contents of the file
+/// </param>
+/// <returns>
+/// description of the problem
+/// empty if the file was read
+/// </returns>
+static string LoadFile(const string& path, vector<UINT8>& contents)
+{
+  ifstream in(path, ios_base::in | ios_base::binary);
+  if (!in.good())
+  {
+    ostringstream out;
+    out << "Unable to open \"" << path << '\"';
+    return out.str();
+  }
+
+  in.seekg(0, ios_base::end);
+  streampos len = in.tellg();
+  in.seekg(0, ios_base::beg);
+
+  contents.resize((size_t)len);
+  in.read((char*)contents.data(), len);
+  if (!in.good())
+  {
+    ostringstream out;
+    out << "Unable to read \"" << path << '\"';
+    return out.str();
+  }
+
+  return string();
+}
+
+void PngDecoder::ReadHeader(const void* png, size_t size, UINT& width, UINT& height)
+{
+  LodePNGColorType color_type;
+  UINT bit_depth;
+  bool interlaced;
+  Inspect(png, size, width, height, color_type, bit_depth, interlaced);
+}
+
+void PngDecoder::Decode(const void* png, size_t size, const PngDestination& dst)
+{
+  UINT width;
+  UINT height;
+  LodePNGColorType color_type;
+  UINT bit_depth;
+  bool interlaced;
+  Inspect(png, size, width, height, color_type, bit_depth, interlaced);
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (dst.data == NULL)
+  {
+    throw FrameworkException("dst.data is NULL");
+  }
+  if (dst.row_pitch < width * 4)
+  {
+    ostringstream out;
+    out << "dst.row_pitch of " << dst.row_pitch << " is less than the " << (width * 4) << " bytes in a row";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  // gather the compressed data, and look for a color key, which the direct path does not apply
+  const UINT8* start = (const UINT8*)png;
+  const UINT8* end = start + size;
+  vector<UINT8> compressed;
+  bool has_color_key = false;
+  for (const UINT8* chunk = start + PNG_HEADER_SIZE; end - chunk >= (ptrdiff_t)PNG_CHUNK_OVERHEAD;
+       chunk = lodepng_chunk_next_const(chunk))
+  {
+    UINT length = lodepng_chunk_length(chunk);
+    if ((size_t)(end - chunk) - PNG_CHUNK_OVERHEAD < length)
+    {
+      throw FrameworkException("Unable to decode PNG: a chunk extends past the end of the file");
+    }
+
+    if (lodepng_chunk_type_equals(chunk, "IDAT"))
+    {
+      const UINT8* data = lodepng_chunk_data_const(chunk);
+      compressed.insert(compressed.end(), data, data + length);
+    }
+    else if (lodepng_chunk_type_equals(chunk, "tRNS"))
+    {
+      has_color_key = true;
+    }
+    else if (lodepng_chunk_type_equals(chunk, "IEND"))
+    {
+      break;
+    }
+  }
+
+  bool direct = bit_depth == 8 && !interlaced &&
+    (color_type == LCT_RGBA || color_type == LCT_GREY_ALPHA ||
+     ((color_type == LCT_RGB || color_type == LCT_GREY) && !has_color_key));
+  if (!direct)
+  {
+    DecodeWithLodepng(png, size, dst);
+    return;
+  }
+
+  // lodepng only inflates whole buffers, so the filtered scanlines are inflated together and unfiltered a row at a
+  // time
+  UINT bpp = color_type == LCT_RGBA ? 4 : color_type == LCT_RGB ? 3 : color_type == LCT_GREY_ALPHA ? 2 : 1;
+  UINT row_bytes = width * bpp;
+  unsigned char* raw = NULL;
+  size_t raw_size = 0;
+  unsigned error = lodepng_zlib_decompress(&raw, &raw_size, compressed.data(), compressed.size(),
+    &lodepng_default_decompress_settings);
+  if (error != 0)
+  {
+    free(raw);
+    ThrowLodepngError(error);
+  }
+  if (raw_size < (size_t)height * (row_bytes + 1))
+  {
+    free(raw);
+    throw FrameworkException("Unable to decode PNG: the image data is too short");
+  }
+
+  // upload memory is write combined, so the previous row is kept in a scratch row instead of being read back from dst,
+  // and each row of dst is written once in order
+  vector<UINT8> scratch(row_bytes * 3);
+  const UINT8* zero_row = scratch.data() + row_bytes * 2;
+  vector<UINT8> expanded(color_type == LCT_RGBA ? 0 : width * 4);
+  UINT8* curr = scratch.data();
+  UINT8* prev = NULL;
+  const UINT8* src = raw;
+  UINT8* dst_row = (UINT8*)dst.data;
+  for (UINT y = 0; y < height; y++, src += row_bytes + 1, dst_row += dst.row_pitch)
+  {
+    if (!Unfilter(src[0], src + 1, prev, curr, row_bytes, bpp, zero_row))
+    {
+      free(raw);
+      throw FrameworkException("Unable to decode PNG: invalid filter type");
+    }
+
+    if (color_type == LCT_RGBA)
+    {
+      memcpy(dst_row, curr, row_bytes);
+    }
+    else
+    {
+      ExpandToRGBA(curr, expanded.data(), width, color_type);
+      memcpy(dst_row, expanded.data(), width * 4);
+    }
+
+    prev = curr;
+    curr = (curr == scratch.data()) ? scratch.data() + row_bytes : scratch.data();
+  }
+  free(raw);
+}
+
+void PngDecoder::DecodeFiles(const vector<string>& paths, const DestinationCallback& get_destination)
+{
+  UINT num_files = (UINT)paths.size();
+  vector<vector<UINT8> > files(num_files);
+  vector<string> errors(num_files);
+  UINT num_read = 0;
+  mutex lock;
+  condition_variable file_read;
+
+  // files are read in order on their own thread, so reading the next file overlaps decoding the previous ones
+  thread reader([&]()
+  {
+    for (UINT i = 0; i < num_files; i++)
+    {
+      vector<UINT8> contents;
+      string error = LoadFile(paths[i], contents);
+
+      {
+        lock_guard<mutex> guard(lock);
+        files[i].swap(contents);
+        errors[i] = error;
+        num_read = i + 1;
+      }
+      file_read.notify_all();
+    }
+  });
+
+  ThreadPool::GetDefault().ParallelFor(num_files, 1, [&](UINT begin, UINT end)
+  {
+    for (UINT i = begin; i < end; i++)
+    {
+      vector<UINT8> contents;
+      {
+        unique_lock<mutex> guard(lock);
+        file_read.wait(guard, [&]() { return num_read > i; });
+        if (!errors[i].empty())
+        {
+          continue;
+        }
+        contents.swap(files[i]);
+      }
+
+      try
+      {
+        UINT width;
+        UINT height;
+        ReadHeader(contents.data(), contents.size(), width, height);
+        PngDestination dst = get_destination(i, width, height);
+        Decode(contents.data(), contents.size(), dst);
+      }
+      catch (const exception& err)
+      {
+        ostringstream out;
+        out << "\"" << paths[i] << "\" " << err.what();
+
+        lock_guard<mutex> guard(lock);
+        errors[i] = out.str();
+      }
+    }
+  });
+  reader.join();
+
+  for (UINT i = 0; i < num_files; i++)
+  {
+    if (!errors[i].empty())
+    {
+      throw FrameworkException(errors[i]);
+    }
+  }
+}
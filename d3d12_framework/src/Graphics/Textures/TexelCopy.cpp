@@ -0,0 +1,464 @@
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+#include "Graphics/Textures/TexelCopy.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "FrameworkException.h"
+using namespace std;
+
+// The kernels are written once against these wrappers, which use AVX2 when the compiler targets it (/arch:AVX2) and
+// SSE2 otherwise.  /arch:AVX on its own keeps 16 byte steps but lets the RGB expansion use a byte shuffle.
+#ifdef __AVX2__
+#include <immintrin.h>
+
+/// <summary>
+/// Number of destination bytes written by each instruction
+/// </summary>
+static const UINT SIMD_WIDTH = 32;
+
+typedef __m256i SimdInt;
+
+static inline SimdInt SimdLoad(const UINT8* src)
+{
+  return _mm256_loadu_si256((const __m256i*)src);
+}
+
+static inline void SimdStore(UINT8* dst, SimdInt value)
+{
+  _mm256_storeu_si256((__m256i*)dst, value);
+}
+
+static inline void SimdStream(UINT8* dst, SimdInt value)
+{
+  _mm256_stream_si256((__m256i*)dst, value);
+}
+
+static inline SimdInt SimdSet(UINT32 value)
+{
+  return _mm256_set1_epi32((int)value);
+}
+
+static inline SimdInt SimdAnd(SimdInt a, SimdInt b)
+{
+  return _mm256_and_si256(a, b);
+}
+
+static inline SimdInt SimdOr(SimdInt a, SimdInt b)
+{
+  return _mm256_or_si256(a, b);
+}
+
+static inline SimdInt SimdShiftLeft16(SimdInt a)
+{
+  return _mm256_slli_epi32(a, 16);
+}
+
+static inline SimdInt SimdShiftRight16(SimdInt a)
+{
+  return _mm256_srli_epi32(a, 16);
+}
+#else
+#ifdef __AVX__
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+/// <summary>
+/// Number of destination bytes written by each instruction
+/// </summary>
+static const UINT SIMD_WIDTH = 16;
+
+typedef __m128i SimdInt;
+
+static inline SimdInt SimdLoad(const UINT8* src)
+{
+  return _mm_loadu_si128((const __m128i*)src);
+}
+
+static inline void SimdStore(UINT8* dst, SimdInt value)
+{
+  _mm_storeu_si128((__m128i*)dst, value);
+}
+
+static inline void SimdStream(UINT8* dst, SimdInt value)
+{
+  _mm_stream_si128((__m128i*)dst, value);
+}
+
+static inline SimdInt SimdSet(UINT32 value)
+{
+  return _mm_set1_epi32((int)value);
+}
+
+static inline SimdInt SimdAnd(SimdInt a, SimdInt b)
+{
+  return _mm_and_si128(a, b);
+}
+
+static inline SimdInt SimdOr(SimdInt a, SimdInt b)
+{
+  return _mm_or_si128(a, b);
+}
+
+static inline SimdInt SimdShiftLeft16(SimdInt a)
+{
+  return _mm_slli_epi32(a, 16);
+}
+
+static inline SimdInt SimdShiftRight16(SimdInt a)
+{
+  return _mm_srli_epi32(a, 16);
+}
+#endif
+
+// F16C comes with every AVX2 processor, but only MSVC enables it along with /arch:AVX2
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define TEXEL_COPY_F16C
+#include <immintrin.h>
+#endif
+
+/// <summary>
+/// Number of bytes a copy must have before it is split across the thread pool
+/// </summary>
+static const size_t PARALLEL_BYTES = 1 << 20;
+
+/// <summary>
+/// Number of bytes each job of a split copy writes
+/// </summary>
+static const size_t BYTES_PER_JOB = 256 << 10;
+
+/// <summary>
+/// Copies 1 step of bytes as they are
+/// </summary>
+struct CopyKernel
+{
+  /// <summary>
+  /// number of source bytes that convert to 1 step of destination bytes
+  /// </summary>
+  static const UINT SRC_BYTES = SIMD_WIDTH;
+
+  /// <summary>
+  /// number of source bytes read by 1 step, which can be more than it converts
+  /// </summary>
+  static const UINT LOAD_BYTES = SIMD_WIDTH;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+    return SimdLoad(src);
+  }
+};
+
+/// <summary>
+/// Swaps the first and third bytes of each 4 byte texel of 1 step
+/// </summary>
+struct SwapRBKernel
+{
+  static const UINT SRC_BYTES  = SIMD_WIDTH;
+  static const UINT LOAD_BYTES = SIMD_WIDTH;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+    SimdInt texels = SimdLoad(src);
+    SimdInt green_alpha = SimdAnd(texels, SimdSet(0xFF00FF00));
+    SimdInt red         = SimdAnd(SimdShiftLeft16(texels), SimdSet(0x00FF0000));
+    SimdInt blue        = SimdShiftRight16(SimdAnd(texels, SimdSet(0x00FF0000)));
+    return SimdOr(green_alpha, SimdOr(red, blue));
+  }
+};
+
+/// <summary>
+/// Expands the 3 byte texels of 1 step to 4 bytes with an alpha of 255
+/// </summary>
+struct ExpandRGBKernel
+{
+  static const UINT SRC_BYTES = SIMD_WIDTH / 4 * 3;
+
+#if defined(__AVX2__)
+  static const UINT LOAD_BYTES = SIMD_WIDTH;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+    // move the second 4 texels up to the high lane, so each lane shuffles its own 4 texels
+    __m256i texels = _mm256_permutevar8x32_epi32(SimdLoad(src), _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6));
+    __m256i expand = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    return SimdOr(_mm256_shuffle_epi8(texels, expand), SimdSet(0xFF000000));
+  }
+#elif defined(__AVX__)
+  static const UINT LOAD_BYTES = SIMD_WIDTH;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+    __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    return SimdOr(_mm_shuffle_epi8(SimdLoad(src), expand), SimdSet(0xFF000000));
+  }
+#else
+  static const UINT LOAD_BYTES = SRC_BYTES + 1;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+    // SSE2 has no byte shuffle, so each texel is read with the first byte of the next one, which the alpha replaces.
+    // The texels are combined in registers, since reloading them from memory would stall on store forwarding
+    UINT32 texels[4];
+    for (UINT i = 0; i < 4; i++)
+    {
+      memcpy(&texels[i], src + i * 3, sizeof(texels[i]));
+    }
+    __m128i low  = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int)texels[0]), _mm_cvtsi32_si128((int)texels[1]));
+    __m128i high = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int)texels[2]), _mm_cvtsi32_si128((int)texels[3]));
+    return SimdOr(_mm_unpacklo_epi64(low, high), SimdSet(0xFF000000));
+  }
+#endif
+};
+
+#ifndef TEXEL_COPY_F16C
+/// <summary>
+/// Converts 4 32-bit floats to 16-bit floats, rounding to nearest even, the same way MipGenerator does
+/// </summary>
+/// <param name="src">
+/// floats to convert
+/// </param>
+/// <returns>
+/// the 16-bit floats in the low half of each 32-bit lane
+/// </returns>
+static inline __m128i FloatToHalf4(const UINT8* src)
+{
+  __m128i bits     = _mm_loadu_si128((const __m128i*)src);
+  __m128i sign     = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+  __m128i abs_bits = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+  // rebias the exponent and round the mantissa to 10 bits
+  __m128i odd     = _mm_and_si128(_mm_srli_epi32(abs_bits, 13), _mm_set1_epi32(1));
+  __m128i rounded = _mm_add_epi32(abs_bits, _mm_add_epi32(_mm_set1_epi32(0xFFF - ((127 - 15) << 23)), odd));
+  __m128i result  = _mm_srli_epi32(rounded, 13);
+
+  // subnormal halfs are scaled so the hardware rounding gives the mantissa
+  __m128i subnormal = _mm_cmplt_epi32(abs_bits, _mm_set1_epi32(0x38800000));
+  __m128i scaled    = _mm_cvtps_epi32(_mm_mul_ps(_mm_castsi128_ps(abs_bits), _mm_set1_ps(16777216.0f)));
+  result = _mm_or_si128(_mm_andnot_si128(subnormal, result), _mm_and_si128(subnormal, scaled));
+
+  // too large for a half becomes infinity, and NaN stays NaN
+  __m128i overflow = _mm_cmpgt_epi32(abs_bits, _mm_set1_epi32(0x477FEFFF));
+  __m128i nan      = _mm_and_si128(_mm_cmpgt_epi32(abs_bits, _mm_set1_epi32(0x7F800000)), _mm_set1_epi32(0x200));
+  result = _mm_or_si128(_mm_andnot_si128(overflow, result), _mm_and_si128(overflow, _mm_or_si128(_mm_set1_epi32(0x7C00), nan)));
+
+  return _mm_or_si128(result, sign);
+}
+#endif
+
+/// <summary>
+/// Converts 8 32-bit floats to 16-bit floats, rounding to nearest even
+/// </summary>
+/// <param name="src">
+/// floats to convert
+/// </param>
+/// <returns>
+/// the 16-bit floats
+/// </returns>
+static inline __m128i FloatToHalf8(const UINT8* src)
+{
+#ifdef TEXEL_COPY_F16C
+  return _mm256_cvtps_ph(_mm256_loadu_ps((const float*)src), 0);
+#else
+  // sign extending the halfs first keeps the signed saturation of the pack from changing them
+  __m128i low  = _mm_srai_epi32(_mm_slli_epi32(FloatToHalf4(src), 16), 16);
+  __m128i high = _mm_srai_epi32(_mm_slli_epi32(FloatToHalf4(src + 16), 16), 16);
+  return _mm_packs_epi32(low, high);
+#endif
+}
+
+/// <summary>
+/// Converts the 32-bit floats of 1 step to 16-bit floats
+/// </summary>
+struct FloatToHalfKernel
+{
+  static const UINT SRC_BYTES  = SIMD_WIDTH * 2;
+  static const UINT LOAD_BYTES = SIMD_WIDTH * 2;
+
+  static inline SimdInt Convert(const UINT8* src)
+  {
+#ifdef __AVX2__
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(FloatToHalf8(src)), FloatToHalf8(src + 32), 1);
+#else
+    return FloatToHalf8(src);
+#endif
+  }
+};
+
+/// <summary>
+/// Converts 1 row, streaming whole steps to the destination when it is aligned.  Steps that would read past the end of
+/// the source or write past the end of the row go through a scratch step instead
+/// </summary>
+/// <param name="dst">
+/// where to write the row
+/// </param>
+/// <param name="src">
+/// row to read
+/// </param>
+/// <param name="dst_row_size">
+/// number of bytes to write
+/// </param>
+template <class Kernel>
+static void ConvertRow(UINT8* dst, const UINT8* src, size_t dst_row_size)
+{
+  size_t num_steps = dst_row_size / SIMD_WIDTH;
+  size_t src_size  = dst_row_size / SIMD_WIDTH * Kernel::SRC_BYTES + dst_row_size % SIMD_WIDTH * Kernel::SRC_BYTES / SIMD_WIDTH;
+  size_t num_safe  = (src_size < Kernel::LOAD_BYTES) ? 0 : min(num_steps, (src_size - Kernel::LOAD_BYTES) / Kernel::SRC_BYTES + 1);
+
+  bool   aligned = ((size_t)dst & (SIMD_WIDTH - 1)) == 0;
+  size_t step    = 0;
+  if (aligned)
+  {
+    for (; step < num_safe; step++)
+    {
+      SimdStream(dst + step * SIMD_WIDTH, Kernel::Convert(src + step * Kernel::SRC_BYTES));
+    }
+  }
+  else
+  {
+    for (; step < num_safe; step++)
+    {
+      SimdStore(dst + step * SIMD_WIDTH, Kernel::Convert(src + step * Kernel::SRC_BYTES));
+    }
+  }
+
+  // whole steps are still written straight to the destination, since mixing normal stores into lines that were just
+  // streamed flushes them early
+  for (size_t dst_offset = step * SIMD_WIDTH; dst_offset < dst_row_size; dst_offset += SIMD_WIDTH)
+  {
+    size_t src_offset = dst_offset / SIMD_WIDTH * Kernel::SRC_BYTES;
+    UINT8  src_scratch[Kernel::LOAD_BYTES] = { 0 };
+    memcpy(src_scratch, src + src_offset, min((size_t)Kernel::SRC_BYTES, src_size - src_offset));
+    SimdInt converted = Kernel::Convert(src_scratch);
+
+    if (dst_row_size - dst_offset < SIMD_WIDTH)
+    {
+      UINT8 dst_scratch[SIMD_WIDTH];
+      SimdStore(dst_scratch, converted);
+      memcpy(dst + dst_offset, dst_scratch, dst_row_size - dst_offset);
+    }
+    else if (aligned)
+    {
+      SimdStream(dst + dst_offset, converted);
+    }
+    else
+    {
+      SimdStore(dst + dst_offset, converted);
+    }
+  }
+}
+
+UINT TexelCopy::GetSourceRowSize(UINT dst_row_size, TexelConversion conversion)
+{
+  UINT dst_unit;
+  UINT src_unit;
+  switch (conversion)
+  {
+    case TEXEL_CONVERSION_NONE:
+      return dst_row_size;
+
+    case TEXEL_CONVERSION_RGB8_TO_RGBA8:
+      dst_unit = 4;
+      src_unit = 3;
+      break;
+
+    case TEXEL_CONVERSION_SWAP_RB8:
+      dst_unit = 4;
+      src_unit = 4;
+      break;
+
+    case TEXEL_CONVERSION_FLOAT_TO_HALF:
+      dst_unit = 2;
+      src_unit = 4;
+      break;
+
+    default:
+    {
+      ostringstream out;
+      out << "Unknown texel conversion " << conversion;
+      throw FrameworkException(out.str());
+    }
+  }
+
+  if (dst_row_size % dst_unit != 0)
+  {
+    ostringstream out;
+    out << "Row of " << dst_row_size << " bytes is not a whole number of " << dst_unit << " byte texels for texel conversion " << conversion;
+    throw FrameworkException(out.str());
+  }
+  return dst_row_size / dst_unit * src_unit;
+}
+
+bool TexelCopy::IsConversionSupported(GraphicsDataFormat dst_format, TexelConversion conversion)
+{
+  switch (conversion)
+  {
+    case TEXEL_CONVERSION_NONE:
+      return true;
+
+    // the alpha of 255 is only opaque for unsigned formats, and the channels stay in RGB order
+    case TEXEL_CONVERSION_RGB8_TO_RGBA8:
+      return dst_format == R8B8G8A8_UNORM || dst_format == R8G8B8A8_UNORM_SRGB;
+
+    case TEXEL_CONVERSION_SWAP_RB8:
+      return dst_format == R8B8G8A8_UNORM || dst_format == R8G8B8A8_UNORM_SRGB || dst_format == R8G8B8A8_SNORM ||
+             dst_format == B8G8R8A8_UNORM || dst_format == B8G8R8A8_UNORM_SRGB;
+
+    case TEXEL_CONVERSION_FLOAT_TO_HALF:
+      return dst_format == R16G16B16A16_FLOAT || dst_format == R16G16_FLOAT;
+
+    default:
+      return false;
+  }
+}
+
+void TexelCopy::CopyRows(void* dst, SIZE_T dst_row_pitch, SIZE_T dst_slice_pitch, const void* src, SIZE_T src_row_pitch, SIZE_T src_slice_pitch,
+  UINT dst_row_size, UINT num_rows, UINT depth, TexelConversion conversion)
+{
+  GetSourceRowSize(dst_row_size, conversion);
+
+  void (*convert_row)(UINT8*, const UINT8*, size_t);
+  switch (conversion)
+  {
+    case TEXEL_CONVERSION_RGB8_TO_RGBA8:
+      convert_row = ConvertRow<ExpandRGBKernel>;
+      break;
+
+    case TEXEL_CONVERSION_SWAP_RB8:
+      convert_row = ConvertRow<SwapRBKernel>;
+      break;
+
+    case TEXEL_CONVERSION_FLOAT_TO_HALF:
+      convert_row = ConvertRow<FloatToHalfKernel>;
+      break;
+
+    default:
+      convert_row = ConvertRow<CopyKernel>;
+      break;
+  }
+
+  UINT8*       dst_mem  = (UINT8*)dst;
+  const UINT8* src_mem  = (const UINT8*)src;
+  UINT         num_jobs = num_rows * depth;
+  ThreadPool::RangeJob copy = [&](UINT begin, UINT end)
+  {
+    for (UINT row = begin; row < end; row++)
+    {
+      UINT z = row / num_rows;
+      UINT y = row % num_rows;
+      convert_row(dst_mem + z * dst_slice_pitch + y * dst_row_pitch, src_mem + z * src_slice_pitch + y * src_row_pitch, dst_row_size);
+    }
+
+    // streaming stores are weakly ordered, so they are fenced before anything else can see the rows
+    _mm_sfence();
+  };
+
+  if ((size_t)dst_row_size * num_jobs < PARALLEL_BYTES)
+  {
+    copy(0, num_jobs);
+  }
+  else
+  {
+    ThreadPool::GetDefault().ParallelFor(num_jobs, (UINT)max((size_t)1, BYTES_PER_JOB / max((size_t)dst_row_size, (size_t)1)), copy);
+  }
+}
@@ -0,0 +1,274 @@
+#include <limits.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <sstream>
+#include "Graphics/Textures/TextureAtlas.h"
+#include "Graphics/Textures/MipGenerator.h"
+#include "private_inc/Threading/ThreadPool.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Number of images each job fills the cells of
+/// </summary>
+static const UINT IMAGES_PER_JOB = 16;
+
+/// <summary>
+/// Rounds a size up to a multiple of an alignment
+/// </summary>
+/// <param name="size">
+/// size to round
+/// </param>
+/// <param name="alignment">
+/// alignment to round to
+/// </param>
+/// <returns>
+/// rounded size
+/// </returns>
+static UINT AlignUp(UINT size, UINT alignment)
+{
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+TextureAtlas::TextureAtlas(UINT page_width, UINT page_height, GraphicsDataFormat format, UINT padding, UINT16 num_mip_levels)
+:m_page_width(page_width),
+ m_page_height(page_height),
+ m_format(format),
+ m_padding(padding),
+ m_num_mip_levels(num_mip_levels),
+ m_cell_alignment(1)
+{
+  if (!MipGenerator::IsFormatSupported(format))
+  {
+    ostringstream out;
+    out << "Texture atlas format " << format << " is not supported";
+    throw FrameworkException(out.str());
+  }
+  m_texel_size = MipGenerator::GetBytesPerTexel(format);
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  // Texture2D::CreateD3D12 takes 0 as a full chain, which would align every cell to the whole page
+  if (num_mip_levels == 0 || num_mip_levels > MipGenerator::GetNumLevels(page_width, page_height))
+  {
+    ostringstream out;
+    out << "Texture atlas pages of " << page_width << "x" << page_height << " can't have " << num_mip_levels << " mipmap levels";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+  m_cell_alignment = 1 << (max(num_mip_levels, (UINT16)1) - 1);
+
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (page_width == 0 || page_height == 0 || page_width % m_cell_alignment != 0 || page_height % m_cell_alignment != 0)
+  {
+    ostringstream out;
+    out << "Texture atlas pages of " << page_width << "x" << page_height << " must be a non-zero multiple of " << m_cell_alignment
+        << " texels for " << num_mip_levels << " mipmap levels";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+UINT TextureAtlas::Add(const void* data, UINT width, UINT height, UINT row_pitch)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (width == 0 || height == 0)
+  {
+    ostringstream out;
+    out << "Texture atlas image of " << width << "x" << height << " texels is empty";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  m_images.push_back(Image());
+  Image& image = m_images.back();
+  image.width  = width;
+  image.height = height;
+
+  size_t row_size = (size_t)width * m_texel_size;
+  image.texels.resize(row_size * height);
+  const UINT8* src = (const UINT8*)data;
+  for (UINT y = 0; y < height; y++)
+  {
+    memcpy(&image.texels[y * row_size], src + (size_t)y * row_pitch, row_size);
+  }
+
+  return (UINT)m_images.size() - 1;
+}
+
+void TextureAtlas::Pack()
+{
+  // largest first, since big images are the hardest to fit once the pages fill up
+  vector<UINT> order(m_images.size());
+  vector<AtlasRect> cells(m_images.size());
+  for (UINT i = 0; i < m_images.size(); i++)
+  {
+    order[i]        = i;
+    cells[i].width  = AlignUp(m_images[i].width + 2 * m_padding, m_cell_alignment);
+    cells[i].height = AlignUp(m_images[i].height + 2 * m_padding, m_cell_alignment);
+    if (cells[i].width > m_page_width || cells[i].height > m_page_height)
+    {
+      ostringstream out;
+      out << "Texture atlas image " << i << " of " << m_images[i].width << "x" << m_images[i].height << " texels with its gutter does not fit in a "
+          << m_page_width << "x" << m_page_height << " page";
+      throw FrameworkException(out.str());
+    }
+  }
+  stable_sort(order.begin(), order.end(), [&cells](UINT a, UINT b)
+  {
+    UINT side_a = max(cells[a].width, cells[a].height);
+    UINT side_b = max(cells[b].width, cells[b].height);
+    if (side_a != side_b)
+    {
+      return side_a > side_b;
+    }
+    return (UINT64)cells[a].width * cells[a].height > (UINT64)cells[b].width * cells[b].height;
+  });
+
+  // every cell size is a multiple of the alignment, and every free rectangle starts at the page's edge or a cell's,
+  // so every cell starts on a multiple of the alignment too
+  deque<AtlasPacker> packers;
+  vector<UINT16>     pages(m_images.size());
+  for (vector<UINT>::const_iterator it = order.begin(); it != order.end(); ++it)
+  {
+    AtlasRect& cell = cells[*it];
+    UINT16 page = 0;
+    while (page < packers.size() && !packers[page].Insert(cell.width, cell.height, cell))
+    {
+      page++;
+    }
+    if (page == packers.size())
+    {
+      if (packers.size() == USHRT_MAX)
+      {
+        throw FrameworkException("Texture atlas needs more than 65535 pages");
+      }
+      packers.emplace_back(m_page_width, m_page_height);
+      packers.back().Insert(cell.width, cell.height, cell);
+    }
+    pages[*it] = page;
+  }
+
+  m_regions.resize(m_images.size());
+  for (UINT i = 0; i < m_images.size(); i++)
+  {
+    AtlasRegion& region = m_regions[i];
+    region.page        = pages[i];
+    region.rect.x      = cells[i].x + m_padding;
+    region.rect.y      = cells[i].y + m_padding;
+    region.rect.width  = m_images[i].width;
+    region.rect.height = m_images[i].height;
+    region.u0          = (float)region.rect.x / m_page_width;
+    region.v0          = (float)region.rect.y / m_page_height;
+    region.u1          = (float)(region.rect.x + region.rect.width) / m_page_width;
+    region.v1          = (float)(region.rect.y + region.rect.height) / m_page_height;
+  }
+
+  m_pages.assign(packers.size(), vector<UINT8>());
+  for (size_t page = 0; page < m_pages.size(); page++)
+  {
+    m_pages[page].resize((size_t)m_page_width * m_page_height * m_texel_size, 0);
+  }
+
+  // the cells do not overlap, so they can be filled in any order
+  ThreadPool::GetDefault().ParallelFor((UINT)m_images.size(), IMAGES_PER_JOB, [&](UINT begin, UINT end)
+  {
+    for (UINT i = begin; i < end; i++)
+    {
+      FillCell(i, cells[i]);
+    }
+  });
+}
+
+UINT TextureAtlas::GetNumImages() const
+{
+  return (UINT)m_images.size();
+}
+
+UINT16 TextureAtlas::GetNumPages() const
+{
+  return (UINT16)m_pages.size();
+}
+
+const AtlasRegion& TextureAtlas::GetRegion(UINT image) const
+{
+  return m_regions[image];
+}
+
+const vector<UINT8>& TextureAtlas::GetPage(UINT16 page) const
+{
+  return m_pages[page];
+}
+
+float TextureAtlas::GetOccupancy() const
+{
+  if (m_pages.empty())
+  {
+    return 0;
+  }
+
+  UINT64 image_area = 0;
+  for (vector<Image>::const_iterator it = m_images.begin(); it != m_images.end(); ++it)
+  {
+    image_area += (UINT64)it->width * it->height;
+  }
+  return (float)((double)image_area / ((double)m_page_width * m_page_height * m_pages.size()));
+}
+
+Texture2D* TextureAtlas::CreateTexture2D(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  return Texture2D::CreateD3D12(graphics, shader_buffer_heap, m_page_width, m_page_height, m_format, m_num_mip_levels);
+}
+
+Texture2DArray* TextureAtlas::CreateTexture2DArray(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap) const
+{
+  if (m_pages.empty())
+  {
+    throw FrameworkException("Texture atlas has no pages to create a texture array for");
+  }
+  return Texture2DArray::CreateD3D12(graphics, shader_buffer_heap, m_page_width, m_page_height, (UINT16)m_pages.size(), m_format, m_num_mip_levels);
+}
+
+void TextureAtlas::FillCell(UINT image, const AtlasRect& cell)
+{
+  const Image& src        = m_images[image];
+  UINT8*       page       = &m_pages[m_regions[image].page][0];
+  size_t       page_pitch = (size_t)m_page_width * m_texel_size;
+  size_t       src_pitch  = (size_t)src.width * m_texel_size;
+  size_t       cell_pitch = (size_t)cell.width * m_texel_size;
+  UINT         right      = m_padding + src.width;
+
+  // the image's rows, with their first and last texels repeated out to the sides of the cell
+  UINT8* cell_start = page + cell.y * page_pitch + (size_t)cell.x * m_texel_size;
+  for (UINT y = 0; y < src.height; y++)
+  {
+    UINT8*       dst = cell_start + (m_padding + y) * page_pitch;
+    const UINT8* row = &src.texels[y * src_pitch];
+    for (UINT x = 0; x < m_padding; x++)
+    {
+      memcpy(dst + (size_t)x * m_texel_size, row, m_texel_size);
+    }
+    memcpy(dst + (size_t)m_padding * m_texel_size, row, src_pitch);
+    for (UINT x = right; x < cell.width; x++)
+    {
+      memcpy(dst + (size_t)x * m_texel_size, row + src_pitch - m_texel_size, m_texel_size);
+    }
+  }
+
+  // then the first and last rows repeated out to the top and bottom of the cell
+  const UINT8* first_row = cell_start + m_padding * page_pitch;
+  const UINT8* last_row  = cell_start + (m_padding + src.height - 1) * page_pitch;
+  for (UINT y = 0; y < m_padding; y++)
+  {
+    memcpy(cell_start + y * page_pitch, first_row, cell_pitch);
+  }
+  for (UINT y = m_padding + src.height; y < cell.height; y++)
+  {
+    memcpy(cell_start + y * page_pitch, last_row, cell_pitch);
+  }
+}
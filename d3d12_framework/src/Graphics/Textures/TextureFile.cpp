@@ -0,0 +1,15 @@
+#include "Graphics/Textures/TextureFile.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureFile.h"
+
+TextureFile* TextureFile::OpenD3D12(const char* path)
+{
+  return D3D12_TextureFile::Open(path);
+}
+
+TextureFile::TextureFile()
+{
+}
+
+TextureFile::~TextureFile()
+{
+}
@@ -0,0 +1,15 @@
+#include "Graphics/Textures/TextureStreamer.h"
+#include "private_inc/D3D12/Textures/D3D12_TextureStreamer.h"
+
+TextureStreamer* TextureStreamer::CreateD3D12(GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT64 memory_budget, UINT64 upload_budget)
+{
+  return D3D12_TextureStreamer::Create(graphics, shader_buffer_heap, memory_budget, upload_budget);
+}
+
+TextureStreamer::TextureStreamer()
+{
+}
+
+TextureStreamer::~TextureStreamer()
+{
+}
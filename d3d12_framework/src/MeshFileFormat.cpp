@@ -0,0 +1,294 @@
+#include <stddef.h>
+#include <string.h>
+#include "private_inc/MeshFileFormat.h"
+#include "Graphics/GraphicsDataFormat.h"
+#include "Graphics/Semantics.h"
+using namespace std;
+
+/// <summary>
+/// Size of a format that can be used for a vertex element
+/// </summary>
+struct ElementFormatInfo
+{
+  /// <summary>
+  /// format of the element
+  /// </summary>
+  GraphicsDataFormat format;
+
+  /// <summary>
+  /// number of bytes in the element
+  /// </summary>
+  uint32_t size;
+};
+
+/// <summary>
+/// Every format that can be used for a vertex element.  Elements are a multiple of 4 bytes, so the 1 and 2 byte
+/// formats are left out
+/// </summary>
+static const ElementFormatInfo ELEMENT_FORMATS[] =
+{
+  { R32G32B32A32_FLOAT,  16 },
+  { R32G32B32A32_UINT,   16 },
+  { R32G32B32A32_SINT,   16 },
+  { R32G32B32_FLOAT,     12 },
+  { R32G32B32_UINT,      12 },
+  { R32G32B32_SINT,      12 },
+  { R16G16B16A16_FLOAT,   8 },
+  { R16G16B16A16_SNORM,   8 },
+  { R32G32_FLOAT,         8 },
+  { R32G32_UINT,          8 },
+  { R32G32_SINT,          8 },
+  { R10G10B10A2_UNORM,    4 },
+  { R8B8G8A8_UNORM,       4 },
+  { R8G8B8A8_UNORM_SRGB,  4 },
+  { R8G8B8A8_SNORM,       4 },
+  { R16G16_FLOAT,         4 },
+  { R16G16_SNORM,         4 },
+  { R32_FLOAT,            4 },
+  { R32_UINT,             4 },
+  { R32_SINT,             4 },
+  { B8G8R8A8_UNORM,       4 },
+  { B8G8R8A8_UNORM_SRGB,  4 }
+};
+
+uint32_t MeshFileFormat::GetElementSize(uint32_t format)
+{
+  for (uint32_t i = 0; i < sizeof(ELEMENT_FORMATS) / sizeof(ELEMENT_FORMATS[0]); i++)
+  {
+    if ((uint32_t)ELEMENT_FORMATS[i].format == format)
+    {
+      return ELEMENT_FORMATS[i].size;
+    }
+  }
+  return 0;
+}
+
+const char* MeshFileFormat::Validate(const uint8_t* data, uint64_t size)
+{
+  if (size < sizeof(MeshFileHeader))
+  {
+    return "is not a mesh file";
+  }
+
+  const MeshFileHeader* header = (const MeshFileHeader*)data;
+  if (header->magic != MESH_FILE_MAGIC)
+  {
+    return "is not a mesh file";
+  }
+  if (header->version != MESH_FILE_VERSION)
+  {
+    return "has an unsupported mesh file version";
+  }
+  if (header->index_size != sizeof(uint16_t) && header->index_size != sizeof(uint32_t))
+  {
+    return "has an unsupported index size";
+  }
+  if (header->num_elements == 0 || header->vertex_stride == 0)
+  {
+    return "has no vertex elements";
+  }
+  if (header->elements_offset % sizeof(uint32_t) != 0 ||
+      header->elements_offset + (uint64_t)header->num_elements * sizeof(MeshFileElement) > size)
+  {
+    return "has element descriptions that extend beyond the end of the file";
+  }
+  if (header->submeshes_offset % sizeof(uint32_t) != 0 ||
+      header->submeshes_offset + (uint64_t)header->num_submeshes * sizeof(MeshFileSubmesh) > size)
+  {
+    return "has submeshes that extend beyond the end of the file";
+  }
+  if (header->vertices_offset % MESH_FILE_ALIGNMENT != 0 ||
+      header->vertices_offset + (uint64_t)header->num_vertices * header->vertex_stride > size)
+  {
+    return "has vertex data that extends beyond the end of the file";
+  }
+  if (header->indices_offset % MESH_FILE_ALIGNMENT != 0 ||
+      header->indices_offset + (uint64_t)header->num_indices * header->index_size > size)
+  {
+    return "has index data that extends beyond the end of the file";
+  }
+
+  // the input layout appends each element after the previous one, so the elements must be packed the same way, and
+  // each element must be exactly as big as its format or the ones after it would be read from the wrong offset
+  const MeshFileElement* elements = (const MeshFileElement*)(data + header->elements_offset);
+  uint64_t offset = 0;
+  for (uint32_t i = 0; i < header->num_elements; i++)
+  {
+    uint32_t format_size = GetElementSize(elements[i].format);
+    if (format_size == 0)
+    {
+      return "has a vertex element with an unsupported format";
+    }
+    if (elements[i].semantic > SEM_SV_VERTEXID)
+    {
+      return "has a vertex element with an unsupported semantic";
+    }
+    if (elements[i].size != format_size)
+    {
+      return "has a vertex element whose size does not match its format";
+    }
+    if (elements[i].byte_offset != offset)
+    {
+      return "has vertex elements that are not packed in order";
+    }
+    offset += elements[i].size;
+  }
+  if (offset != header->vertex_stride)
+  {
+    return "has vertex elements that do not fill the vertex stride";
+  }
+
+  const MeshFileSubmesh* submeshes = (const MeshFileSubmesh*)(data + header->submeshes_offset);
+  for (uint32_t i = 0; i < header->num_submeshes; i++)
+  {
+    if (submeshes[i].first_index + (uint64_t)submeshes[i].num_indices > header->num_indices)
+    {
+      return "has a submesh that extends beyond the end of the indices";
+    }
+  }
+  return NULL;
+}
+
+/// <summary>
+/// Rounds an offset in a mesh file up to MESH_FILE_ALIGNMENT
+/// </summary>
+static uint64_t AlignMeshFileOffset(uint64_t offset)
+{
+  return (offset + MESH_FILE_ALIGNMENT - 1) / MESH_FILE_ALIGNMENT * MESH_FILE_ALIGNMENT;
+}
+
+const char* MeshFileFormat::Pack(vector<MeshFileElement>& elements, const void* vertices, uint32_t num_vertices,
+  const vector<uint32_t>& indices, vector<MeshFileSubmesh>& submeshes, vector<uint8_t>& file)
+{
+  file.clear();
+  if (elements.empty())
+  {
+    return "has no vertex elements";
+  }
+
+  // elements are packed in order, and the first 3 float position is where the bounds come from
+  uint32_t stride          = 0;
+  uint32_t position_offset = 0;
+  bool     has_position    = false;
+  for (size_t i = 0; i < elements.size(); i++)
+  {
+    uint32_t size = GetElementSize(elements[i].format);
+    if (size == 0)
+    {
+      return "has a vertex element with an unsupported format";
+    }
+    if (elements[i].semantic > SEM_SV_VERTEXID)
+    {
+      return "has a vertex element with an unsupported semantic";
+    }
+    if (!has_position && elements[i].semantic == SEM_POSITION && elements[i].semantic_index == 0 &&
+        (elements[i].format == R32G32B32_FLOAT || elements[i].format == R32G32B32A32_FLOAT))
+    {
+      has_position    = true;
+      position_offset = stride;
+    }
+    elements[i].byte_offset = stride;
+    elements[i].size        = size;
+    stride += size;
+  }
+
+  for (size_t i = 0; i < indices.size(); i++)
+  {
+    if (indices[i] >= num_vertices)
+    {
+      return "has an index beyond the end of the vertices";
+    }
+  }
+
+  // bounds of each submesh, and of the whole mesh from the submeshes that have any triangles
+  MeshFileHeader header;
+  memset(&header, 0, sizeof(header));
+  bool has_bounds = false;
+  const uint8_t* vertex_bytes = (const uint8_t*)vertices;
+  for (size_t i = 0; i < submeshes.size(); i++)
+  {
+    MeshFileSubmesh& submesh = submeshes[i];
+    if (submesh.first_index + (uint64_t)submesh.num_indices > indices.size())
+    {
+      return "has a submesh that extends beyond the end of the indices";
+    }
+    memset(submesh.bounds_min, 0, sizeof(submesh.bounds_min));
+    memset(submesh.bounds_max, 0, sizeof(submesh.bounds_max));
+    if (!has_position || submesh.num_indices == 0)
+    {
+      continue;
+    }
+
+    const uint8_t* positions = vertex_bytes + position_offset;
+    memcpy(submesh.bounds_min, positions + (uint64_t)indices[submesh.first_index] * stride, sizeof(submesh.bounds_min));
+    memcpy(submesh.bounds_max, submesh.bounds_min, sizeof(submesh.bounds_max));
+    for (uint32_t j = submesh.first_index + 1; j < submesh.first_index + submesh.num_indices; j++)
+    {
+      float pos[3];
+      memcpy(pos, positions + (uint64_t)indices[j] * stride, sizeof(pos));
+      for (int k = 0; k < 3; k++)
+      {
+        submesh.bounds_min[k] = pos[k] < submesh.bounds_min[k] ? pos[k] : submesh.bounds_min[k];
+        submesh.bounds_max[k] = pos[k] > submesh.bounds_max[k] ? pos[k] : submesh.bounds_max[k];
+      }
+    }
+    for (int k = 0; k < 3; k++)
+    {
+      header.bounds_min[k] = !has_bounds || submesh.bounds_min[k] < header.bounds_min[k] ? submesh.bounds_min[k] : header.bounds_min[k];
+      header.bounds_max[k] = !has_bounds || submesh.bounds_max[k] > header.bounds_max[k] ? submesh.bounds_max[k] : header.bounds_max[k];
+    }
+    has_bounds = true;
+  }
+
+  // header, elements and submeshes first, then the aligned vertex and index data
+  const bool indices_16bit = num_vertices <= 0x10000;
+  header.magic         = MESH_FILE_MAGIC;
+  header.version       = MESH_FILE_VERSION;
+  header.num_elements  = (uint32_t)elements.size();
+  header.num_submeshes = (uint32_t)submeshes.size();
+  header.num_vertices  = num_vertices;
+  header.vertex_stride = stride;
+  header.num_indices   = (uint32_t)indices.size();
+  header.index_size    = indices_16bit ? sizeof(uint16_t) : sizeof(uint32_t);
+
+  uint64_t offset = sizeof(MeshFileHeader);
+  header.elements_offset  = (uint32_t)offset;
+  offset += elements.size() * sizeof(MeshFileElement);
+  header.submeshes_offset = (uint32_t)offset;
+  offset += submeshes.size() * sizeof(MeshFileSubmesh);
+  offset  = AlignMeshFileOffset(offset);
+  header.vertices_offset  = (uint32_t)offset;
+  offset += (uint64_t)num_vertices * stride;
+  offset  = AlignMeshFileOffset(offset);
+  header.indices_offset   = (uint32_t)offset;
+  offset += (uint64_t)indices.size() * header.index_size;
+  if (offset > 0xffffffffu)
+  {
+    return "would be larger than 4GB";
+  }
+
+  file.assign((size_t)offset, 0);
+  memcpy(&file[0], &header, sizeof(header));
+  memcpy(&file[header.elements_offset], &elements[0], elements.size() * sizeof(MeshFileElement));
+  if (!submeshes.empty())
+  {
+    memcpy(&file[header.submeshes_offset], &submeshes[0], submeshes.size() * sizeof(MeshFileSubmesh));
+  }
+  if (num_vertices > 0)
+  {
+    memcpy(&file[header.vertices_offset], vertices, (size_t)num_vertices * stride);
+  }
+  if (indices_16bit)
+  {
+    uint16_t* dst = (uint16_t*)&file[header.indices_offset];
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+      dst[i] = (uint16_t)indices[i];
+    }
+  }
+  else if (!indices.empty())
+  {
+    memcpy(&file[header.indices_offset], &indices[0], indices.size() * sizeof(uint32_t));
+  }
+  return NULL;
+}
@@ -0,0 +1,137 @@
+#include <string.h>
+#include <algorithm>
+#include "private_inc/ShaderArchiveFormat.h"
+using namespace std;
+
+/// <summary>
+/// Orders shaders by the hash of their name, then by name
+/// </summary>
+static bool CompareShaders(const ShaderArchiveShader& lhs, const ShaderArchiveShader& rhs)
+{
+  uint64_t lhs_hash = ShaderArchiveHash(lhs.name.c_str(), lhs.name.size());
+  uint64_t rhs_hash = ShaderArchiveHash(rhs.name.c_str(), rhs.name.size());
+  if (lhs_hash != rhs_hash)
+  {
+    return lhs_hash < rhs_hash;
+  }
+  return lhs.name < rhs.name;
+}
+
+const char* ShaderArchiveFormat::Pack(vector<ShaderArchiveShader>& shaders, vector<uint8_t>& archive)
+{
+  sort(shaders.begin(), shaders.end(), CompareShaders);
+
+  archive.assign(sizeof(ShaderArchiveHeader) + shaders.size() * sizeof(ShaderArchiveEntry), 0);
+  vector<ShaderArchiveEntry> entries(shaders.size());
+  for (size_t i = 0; i < shaders.size(); i++)
+  {
+    entries[i].name_hash   = ShaderArchiveHash(shaders[i].name.c_str(), shaders[i].name.size());
+    entries[i].name_offset = (uint32_t)archive.size();
+    entries[i].name_length = (uint32_t)shaders[i].name.size();
+    archive.insert(archive.end(), shaders[i].name.begin(), shaders[i].name.end());
+    archive.push_back('\0');
+  }
+  for (size_t i = 0; i < shaders.size(); i++)
+  {
+    archive.resize((archive.size() + SHADER_ARCHIVE_ALIGNMENT - 1) / SHADER_ARCHIVE_ALIGNMENT * SHADER_ARCHIVE_ALIGNMENT, 0);
+    entries[i].data_offset = (uint32_t)archive.size();
+    entries[i].data_size   = (uint32_t)shaders[i].bytecode.size();
+    archive.insert(archive.end(), shaders[i].bytecode.begin(), shaders[i].bytecode.end());
+  }
+  if (archive.size() > 0xffffffffu)
+  {
+    archive.clear();
+    return "would be larger than 4GB";
+  }
+
+  ShaderArchiveHeader header;
+  header.magic        = SHADER_ARCHIVE_MAGIC;
+  header.version      = SHADER_ARCHIVE_VERSION;
+  header.num_entries  = (uint32_t)shaders.size();
+  header.index_offset = sizeof(ShaderArchiveHeader);
+  memcpy(&archive[0], &header, sizeof(header));
+  if (!entries.empty())
+  {
+    memcpy(&archive[header.index_offset], &entries[0], entries.size() * sizeof(ShaderArchiveEntry));
+  }
+  return NULL;
+}
+
+const char* ShaderArchiveFormat::Validate(const uint8_t* data, uint64_t size)
+{
+  if (size < sizeof(ShaderArchiveHeader))
+  {
+    return "is not a shader archive";
+  }
+
+  const ShaderArchiveHeader* header = (const ShaderArchiveHeader*)data;
+  if (header->magic != SHADER_ARCHIVE_MAGIC)
+  {
+    return "is not a shader archive";
+  }
+  if (header->version != SHADER_ARCHIVE_VERSION)
+  {
+    return "has an unsupported shader archive version";
+  }
+  if (header->index_offset % sizeof(uint64_t) != 0 || header->index_offset + (uint64_t)header->num_entries * sizeof(ShaderArchiveEntry) > size)
+  {
+    return "has an index that extends beyond the end of the file";
+  }
+
+  const ShaderArchiveEntry* entries = (const ShaderArchiveEntry*)(data + header->index_offset);
+  for (uint32_t i = 0; i < header->num_entries; i++)
+  {
+    const ShaderArchiveEntry& entry = entries[i];
+    if (entry.name_offset + (uint64_t)entry.name_length >= size || data[entry.name_offset + entry.name_length] != '\0')
+    {
+      return "has a corrupt name entry";
+    }
+    if (entry.data_offset % SHADER_ARCHIVE_ALIGNMENT != 0 || entry.data_offset + (uint64_t)entry.data_size > size)
+    {
+      return "has a corrupt bytecode entry";
+    }
+    if (i > 0 && entries[i - 1].name_hash > entry.name_hash)
+    {
+      return "has an unsorted index";
+    }
+  }
+
+  return NULL;
+}
+
+const ShaderArchiveEntry* ShaderArchiveFormat::Find(const uint8_t* data, const char* name)
+{
+  const ShaderArchiveHeader* header = (const ShaderArchiveHeader*)data;
+  const ShaderArchiveEntry* entries = (const ShaderArchiveEntry*)(data + header->index_offset);
+  const uint32_t num_entries = header->num_entries;
+  const size_t length = strlen(name);
+  const uint64_t hash = ShaderArchiveHash(name, length);
+
+  // find the first entry with a hash that is not less than the one being searched for
+  uint32_t low = 0;
+  uint32_t high = num_entries;
+  while (low < high)
+  {
+    uint32_t mid = low + (high - low) / 2;
+    if (entries[mid].name_hash < hash)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  // compare names of every entry with the hash in case of collisions
+  for (uint32_t i = low; i < num_entries && entries[i].name_hash == hash; i++)
+  {
+    const ShaderArchiveEntry& entry = entries[i];
+    if (entry.name_length == length && memcmp(data + entry.name_offset, name, length) == 0)
+    {
+      return &entry;
+    }
+  }
+
+  return NULL;
+}
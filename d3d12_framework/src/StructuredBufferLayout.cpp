@@ -0,0 +1,47 @@
+#include <sstream>
+#include "private_inc/StructuredBufferLayout.h"
+#include "private_inc/BuildSettings.h"
+#include "FrameworkException.h"
+using namespace std;
+
+UINT64 StructuredBufferLayout::GetSize(UINT num, UINT stride)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (num == 0)
+  {
+    throw FrameworkException("Structured buffer must have at least 1 element");
+  }
+  if (stride == 0 || stride % 4 != 0)
+  {
+    throw FrameworkException("Structured buffer stride must be a non-zero multiple of 4 bytes");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return num * (UINT64)stride;
+}
+
+UINT64 StructuredBufferLayout::GetElementOffset(UINT num, UINT stride, UINT element_offset)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if (element_offset >= num)
+  {
+    ostringstream out;
+    out << "Element offset " << element_offset << " is beyond the end of the " << num << " element structured buffer";
+    throw FrameworkException(out.str());
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return element_offset * (UINT64)stride;
+}
+
+UINT64 StructuredBufferLayout::GetUploadOffset(UINT num, UINT stride, UINT start_element, UINT num_elements)
+{
+#ifdef VALIDATE_FUNCTION_ARGUMENTS
+  if ((UINT64)start_element + num_elements > num)
+  {
+    throw FrameworkException("Attempting to upload beyond the end of the structured buffer");
+  }
+#endif /* VALIDATE_FUNCTION_ARGUMENTS */
+
+  return start_element * (UINT64)stride;
+}
@@ -0,0 +1,641 @@
+#include <algorithm>
+#include <string.h>
+#include "private_inc/TextureFileFormat.h"
+#include "Graphics/Textures/MipGenerator.h"
+using namespace std;
+
+/// <summary>
+/// largest width or height of a texture
+/// </summary>
+static const UINT MAX_DIMENSION = 16384;
+
+/// <summary>
+/// largest depth of a 3D texture, or number of slices in a texture array
+/// </summary>
+static const UINT MAX_DEPTH_OR_ARRAY_SIZE = 2048;
+
+/// <summary>
+/// Builds a little endian FourCC code
+/// </summary>
+#define FOURCC(a, b, c, d) ((uint32_t)(UINT8)(a) | ((uint32_t)(UINT8)(b) << 8) | ((uint32_t)(UINT8)(c) << 16) | ((uint32_t)(UINT8)(d) << 24))
+
+/// <summary>
+/// Size of the texels of a format that can be loaded from a file
+/// </summary>
+struct FileFormatInfo
+{
+  /// <summary>
+  /// format the entry describes
+  /// </summary>
+  GraphicsDataFormat format;
+
+  /// <summary>
+  /// number of bytes in 1 texel, or in 1 4x4 block for block compressed formats
+  /// </summary>
+  UINT bytes;
+
+  /// <summary>
+  /// true if the format stores 4x4 blocks
+  /// </summary>
+  bool block_compressed;
+};
+
+/// <summary>
+/// Every format that can be loaded from a file
+/// </summary>
+static const FileFormatInfo FILE_FORMATS[] =
+{
+  { R32G32B32A32_FLOAT,  16, false },
+  { R32G32B32A32_UINT,   16, false },
+  { R32G32B32A32_SINT,   16, false },
+  { R32G32B32_FLOAT,     12, false },
+  { R32G32B32_UINT,      12, false },
+  { R32G32B32_SINT,      12, false },
+  { R16G16B16A16_FLOAT,   8, false },
+  { R16G16B16A16_SNORM,   8, false },
+  { R32G32_FLOAT,         8, false },
+  { R32G32_UINT,          8, false },
+  { R32G32_SINT,          8, false },
+  { R10G10B10A2_UNORM,    4, false },
+  { R8B8G8A8_UNORM,       4, false },
+  { R8G8B8A8_UNORM_SRGB,  4, false },
+  { R8G8B8A8_SNORM,       4, false },
+  { R16G16_FLOAT,         4, false },
+  { R16G16_SNORM,         4, false },
+  { R32_FLOAT,            4, false },
+  { R32_UINT,             4, false },
+  { R32_SINT,             4, false },
+  { R8G8_UNORM,           2, false },
+  { R8G8_SNORM,           2, false },
+  { R16_UINT,             2, false },
+  { R8_UNORM,             1, false },
+  { B8G8R8A8_UNORM,       4, false },
+  { B8G8R8A8_UNORM_SRGB,  4, false },
+  { BC1_UNORM,            8, true  },
+  { BC1_UNORM_SRGB,       8, true  },
+  { BC2_UNORM,           16, true  },
+  { BC2_UNORM_SRGB,      16, true  },
+  { BC3_UNORM,           16, true  },
+  { BC3_UNORM_SRGB,      16, true  },
+  { BC4_UNORM,            8, true  },
+  { BC4_SNORM,            8, true  },
+  { BC5_UNORM,           16, true  },
+  { BC5_SNORM,           16, true  },
+  { BC6H_UF16,           16, true  },
+  { BC6H_SF16,           16, true  },
+  { BC7_UNORM,           16, true  },
+  { BC7_UNORM_SRGB,      16, true  }
+};
+
+/// <summary>
+/// Maps a Vulkan format from a KTX2 header to a GraphicsDataFormat
+/// </summary>
+struct VkFormatMapping
+{
+  /// <summary>
+  /// VkFormat value
+  /// </summary>
+  uint32_t vk_format;
+
+  /// <summary>
+  /// equivalent format
+  /// </summary>
+  GraphicsDataFormat format;
+};
+
+/// <summary>
+/// Every Vulkan format with an equivalent in FILE_FORMATS
+/// </summary>
+static const VkFormatMapping VK_FORMATS[] =
+{
+  {   9, R8_UNORM            },
+  {  16, R8G8_UNORM          },
+  {  17, R8G8_SNORM          },
+  {  37, R8B8G8A8_UNORM      },
+  {  38, R8G8B8A8_SNORM      },
+  {  43, R8G8B8A8_UNORM_SRGB },
+  {  44, B8G8R8A8_UNORM      },
+  {  50, B8G8R8A8_UNORM_SRGB },
+  {  64, R10G10B10A2_UNORM   },
+  {  74, R16_UINT            },
+  {  78, R16G16_SNORM        },
+  {  83, R16G16_FLOAT        },
+  {  92, R16G16B16A16_SNORM  },
+  {  97, R16G16B16A16_FLOAT  },
+  {  98, R32_UINT            },
+  {  99, R32_SINT            },
+  { 100, R32_FLOAT           },
+  { 101, R32G32_UINT         },
+  { 102, R32G32_SINT         },
+  { 103, R32G32_FLOAT        },
+  { 104, R32G32B32_UINT      },
+  { 105, R32G32B32_SINT      },
+  { 106, R32G32B32_FLOAT     },
+  { 107, R32G32B32A32_UINT   },
+  { 108, R32G32B32A32_SINT   },
+  { 109, R32G32B32A32_FLOAT  },
+  { 131, BC1_UNORM           },
+  { 132, BC1_UNORM_SRGB      },
+  { 133, BC1_UNORM           },
+  { 134, BC1_UNORM_SRGB      },
+  { 135, BC2_UNORM           },
+  { 136, BC2_UNORM_SRGB      },
+  { 137, BC3_UNORM           },
+  { 138, BC3_UNORM_SRGB      },
+  { 139, BC4_UNORM           },
+  { 140, BC4_SNORM           },
+  { 141, BC5_UNORM           },
+  { 142, BC5_SNORM           },
+  { 143, BC6H_UF16           },
+  { 144, BC6H_SF16           },
+  { 145, BC7_UNORM           },
+  { 146, BC7_UNORM_SRGB      }
+};
+
+/// <summary>
+/// Looks up the size of a format's texels
+/// </summary>
+/// <param name="format">
+/// format to look up
+/// </param>
+/// <returns>
+/// the format's entry in FILE_FORMATS
+/// NULL if the format cannot be loaded from a file
+/// </returns>
+static const FileFormatInfo* FindFormat(GraphicsDataFormat format)
+{
+  for (UINT i = 0; i < sizeof(FILE_FORMATS) / sizeof(FILE_FORMATS[0]); i++)
+  {
+    if (FILE_FORMATS[i].format == format)
+    {
+      return &FILE_FORMATS[i];
+    }
+  }
+  return NULL;
+}
+
+/// <summary>
+/// Works out the format of a DDS file that does not have a DX10 header from its legacy pixel format
+/// </summary>
+/// <param name="ddspf">
+/// pixel format from the header
+/// </param>
+/// <param name="format">
+/// output parameter for the format
+/// </param>
+/// <returns>
+/// true if the pixel format has an equivalent GraphicsDataFormat
+/// false otherwise
+/// </returns>
+static bool GetLegacyDDSFormat(const DDSPixelFormat& ddspf, GraphicsDataFormat& format)
+{
+  if (ddspf.flags & DDS_PF_FOURCC)
+  {
+    switch (ddspf.four_cc)
+    {
+      case FOURCC('D', 'X', 'T', '1'):
+        format = BC1_UNORM;
+        return true;
+      case FOURCC('D', 'X', 'T', '2'):
+      case FOURCC('D', 'X', 'T', '3'):
+        format = BC2_UNORM;
+        return true;
+      case FOURCC('D', 'X', 'T', '4'):
+      case FOURCC('D', 'X', 'T', '5'):
+        format = BC3_UNORM;
+        return true;
+      case FOURCC('A', 'T', 'I', '1'):
+      case FOURCC('B', 'C', '4', 'U'):
+        format = BC4_UNORM;
+        return true;
+      case FOURCC('B', 'C', '4', 'S'):
+        format = BC4_SNORM;
+        return true;
+      case FOURCC('A', 'T', 'I', '2'):
+      case FOURCC('B', 'C', '5', 'U'):
+        format = BC5_UNORM;
+        return true;
+      case FOURCC('B', 'C', '5', 'S'):
+        format = BC5_SNORM;
+        return true;
+
+      // D3DFORMAT values stored in place of a FourCC
+      case 110:
+        format = R16G16B16A16_SNORM;
+        return true;
+      case 112:
+        format = R16G16_FLOAT;
+        return true;
+      case 113:
+        format = R16G16B16A16_FLOAT;
+        return true;
+      case 114:
+        format = R32_FLOAT;
+        return true;
+      case 115:
+        format = R32G32_FLOAT;
+        return true;
+      case 116:
+        format = R32G32B32A32_FLOAT;
+        return true;
+    }
+    return false;
+  }
+
+  if (ddspf.flags & DDS_PF_RGB)
+  {
+    if (ddspf.rgb_bit_count != 32)
+    {
+      return false;
+    }
+    if (ddspf.r_mask == 0x000000FF && ddspf.g_mask == 0x0000FF00 && ddspf.b_mask == 0x00FF0000 && ddspf.a_mask == 0xFF000000)
+    {
+      format = R8B8G8A8_UNORM;
+      return true;
+    }
+    if (ddspf.r_mask == 0x00FF0000 && ddspf.g_mask == 0x0000FF00 && ddspf.b_mask == 0x000000FF && ddspf.a_mask == 0xFF000000)
+    {
+      format = B8G8R8A8_UNORM;
+      return true;
+    }
+    if (ddspf.r_mask == 0x000003FF && ddspf.g_mask == 0x000FFC00 && ddspf.b_mask == 0x3FF00000 && ddspf.a_mask == 0xC0000000)
+    {
+      format = R10G10B10A2_UNORM;
+      return true;
+    }
+    if (ddspf.r_mask == 0xFFFFFFFF && ddspf.g_mask == 0 && ddspf.b_mask == 0 && ddspf.a_mask == 0)
+    {
+      format = R32_FLOAT;
+      return true;
+    }
+    return false;
+  }
+
+  if (ddspf.flags & DDS_PF_LUMINANCE)
+  {
+    if (ddspf.rgb_bit_count == 8 && ddspf.r_mask == 0xFF)
+    {
+      format = R8_UNORM;
+      return true;
+    }
+    if (ddspf.rgb_bit_count == 16 && (ddspf.flags & DDS_PF_ALPHAPIXELS) && ddspf.r_mask == 0xFF && ddspf.a_mask == 0xFF00)
+    {
+      format = R8G8_UNORM;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// <summary>
+/// Checks the size and type of a parsed texture and sizes its subresource list
+/// </summary>
+/// <param name="layout">
+/// description of the texture, with everything but subresources filled in
+/// </param>
+/// <returns>
+/// description of the first problem found
+/// NULL if the texture is valid
+/// </returns>
+static const char* ValidateLayout(TextureFileLayout& layout)
+{
+  if (layout.width == 0 || layout.height == 0 || layout.depth == 0 || layout.array_size == 0)
+  {
+    return "has a size of 0";
+  }
+  if (layout.width > MAX_DIMENSION || layout.height > MAX_DIMENSION || layout.depth > MAX_DEPTH_OR_ARRAY_SIZE)
+  {
+    return "is larger than the largest texture size";
+  }
+  if (layout.mip_levels > MipGenerator::GetNumLevels(layout.width, layout.height, layout.depth))
+  {
+    return "has more mipmap levels than a full chain";
+  }
+
+  UINT num_slices = layout.array_size;
+  if (layout.type == TEXTURE_FILE_CUBE || layout.type == TEXTURE_FILE_CUBE_ARRAY)
+  {
+    if (layout.width != layout.height)
+    {
+      return "is a cube map with faces that are not square";
+    }
+    num_slices *= 6;
+  }
+  if (num_slices > MAX_DEPTH_OR_ARRAY_SIZE)
+  {
+    return "has more array slices than the largest texture array";
+  }
+
+  layout.subresources.resize(num_slices * layout.mip_levels);
+  return NULL;
+}
+
+/// <summary>
+/// Fills in the pitches of a subresource
+/// </summary>
+/// <param name="info">
+/// size of the texels
+/// </param>
+/// <param name="width">
+/// width of the subresource in texels
+/// </param>
+/// <param name="height">
+/// height of the subresource in texels
+/// </param>
+/// <param name="subresource">
+/// output parameter for the pitches
+/// </param>
+static void GetPitches(const FileFormatInfo& info, UINT width, UINT height, TextureFileSubresource& subresource)
+{
+  if (info.block_compressed)
+  {
+    subresource.row_pitch   = ((width + 3) / 4) * info.bytes;
+    subresource.slice_pitch = subresource.row_pitch * ((height + 3) / 4);
+  }
+  else
+  {
+    subresource.row_pitch   = width * info.bytes;
+    subresource.slice_pitch = subresource.row_pitch * height;
+  }
+}
+
+/// <summary>
+/// Parses a DDS file
+/// </summary>
+/// <param name="data">
+/// start of the file
+/// </param>
+/// <param name="size">
+/// number of bytes in the file
+/// </param>
+/// <param name="layout">
+/// output parameter for the description of the texture
+/// </param>
+/// <returns>
+/// description of the first problem found
+/// NULL if the file is valid
+/// </returns>
+static const char* ParseDDS(const UINT8* data, UINT64 size, TextureFileLayout& layout)
+{
+  UINT64 offset = sizeof(uint32_t) + sizeof(DDSHeader);
+  if (size < offset)
+  {
+    return "is too small for a DDS header";
+  }
+
+  const DDSHeader* header = (const DDSHeader*)(data + sizeof(uint32_t));
+  if (header->size != sizeof(DDSHeader) || header->ddspf.size != sizeof(DDSPixelFormat))
+  {
+    return "has an invalid DDS header";
+  }
+
+  layout.width      = header->width;
+  layout.height     = header->height;
+  layout.depth      = 1;
+  layout.array_size = 1;
+  layout.mip_levels = header->mip_map_count == 0 ? 1 : (UINT16)min(header->mip_map_count, 0xFFFFu);
+
+  if ((header->ddspf.flags & DDS_PF_FOURCC) && header->ddspf.four_cc == FOURCC('D', 'X', '1', '0'))
+  {
+    if (size < offset + sizeof(DDSHeaderDX10))
+    {
+      return "is too small for a DX10 header";
+    }
+    const DDSHeaderDX10* dx10 = (const DDSHeaderDX10*)(data + offset);
+    offset += sizeof(DDSHeaderDX10);
+
+    layout.format = (GraphicsDataFormat)dx10->dxgi_format;
+    if (dx10->array_size > MAX_DEPTH_OR_ARRAY_SIZE)
+    {
+      return "has more array slices than the largest texture array";
+    }
+    layout.array_size = (UINT16)dx10->array_size;
+
+    switch (dx10->resource_dimension)
+    {
+      case DDS_DIMENSION_TEXTURE1D:
+        layout.type   = layout.array_size > 1 ? TEXTURE_FILE_1D_ARRAY : TEXTURE_FILE_1D;
+        layout.height = 1;
+        break;
+      case DDS_DIMENSION_TEXTURE2D:
+        if (dx10->misc_flag & DDS_MISC_TEXTURECUBE)
+        {
+          layout.type = layout.array_size > 1 ? TEXTURE_FILE_CUBE_ARRAY : TEXTURE_FILE_CUBE;
+        }
+        else
+        {
+          layout.type = layout.array_size > 1 ? TEXTURE_FILE_2D_ARRAY : TEXTURE_FILE_2D;
+        }
+        break;
+      case DDS_DIMENSION_TEXTURE3D:
+        if (layout.array_size != 1)
+        {
+          return "is a 3D texture array, which is not supported";
+        }
+        layout.type = TEXTURE_FILE_3D;
+        break;
+      default:
+        return "has an unsupported resource dimension";
+    }
+  }
+  else
+  {
+    if (!GetLegacyDDSFormat(header->ddspf, layout.format))
+    {
+      return "has an unsupported pixel format";
+    }
+
+    if (header->caps2 & DDS_CAPS2_CUBEMAP)
+    {
+      if ((header->caps2 & DDS_CAPS2_CUBEMAP_ALL_FACES) != DDS_CAPS2_CUBEMAP_ALL_FACES)
+      {
+        return "is a cube map without all 6 faces, which is not supported";
+      }
+      layout.type = TEXTURE_FILE_CUBE;
+    }
+    else if (header->caps2 & DDS_CAPS2_VOLUME)
+    {
+      layout.type = TEXTURE_FILE_3D;
+    }
+    else
+    {
+      layout.type = TEXTURE_FILE_2D;
+    }
+  }
+
+  if (layout.type == TEXTURE_FILE_3D)
+  {
+    if (header->depth > MAX_DEPTH_OR_ARRAY_SIZE)
+    {
+      return "is larger than the largest texture size";
+    }
+    layout.depth = (UINT16)header->depth;
+  }
+
+  const FileFormatInfo* info = FindFormat(layout.format);
+  if (info == NULL)
+  {
+    return "has an unsupported format";
+  }
+  const char* error = ValidateLayout(layout);
+  if (error != NULL)
+  {
+    return error;
+  }
+
+  // each array slice holds its whole mipmap chain, which is the D3D12 subresource order
+  for (size_t i = 0; i < layout.subresources.size(); i++)
+  {
+    UINT16 level  = (UINT16)(i % layout.mip_levels);
+    UINT   width  = max(layout.width >> level, 1u);
+    UINT   height = max(layout.height >> level, 1u);
+    UINT   depth  = max((UINT)layout.depth >> level, 1u);
+
+    TextureFileSubresource& subresource = layout.subresources[i];
+    GetPitches(*info, width, height, subresource);
+    subresource.data = data + offset;
+
+    offset += (UINT64)subresource.slice_pitch * depth;
+    if (offset > size)
+    {
+      return "has texel data that extends beyond the end of the file";
+    }
+  }
+  return NULL;
+}
+
+/// <summary>
+/// Parses a KTX2 file
+/// </summary>
+/// <param name="data">
+/// start of the file
+/// </param>
+/// <param name="size">
+/// number of bytes in the file
+/// </param>
+/// <param name="layout">
+/// output parameter for the description of the texture
+/// </param>
+/// <returns>
+/// description of the first problem found
+/// NULL if the file is valid
+/// </returns>
+static const char* ParseKTX2(const UINT8* data, UINT64 size, TextureFileLayout& layout)
+{
+  if (size < sizeof(KTX2Header))
+  {
+    return "is too small for a KTX2 header";
+  }
+
+  const KTX2Header* header = (const KTX2Header*)data;
+  if (header->supercompression_scheme != 0)
+  {
+    return "is supercompressed, which is not supported";
+  }
+
+  const FileFormatInfo* info = NULL;
+  for (UINT i = 0; i < sizeof(VK_FORMATS) / sizeof(VK_FORMATS[0]); i++)
+  {
+    if (VK_FORMATS[i].vk_format == header->vk_format)
+    {
+      layout.format = VK_FORMATS[i].format;
+      info          = FindFormat(layout.format);
+      break;
+    }
+  }
+  if (info == NULL)
+  {
+    return "has an unsupported format";
+  }
+
+  if (header->layer_count > MAX_DEPTH_OR_ARRAY_SIZE || header->pixel_depth > MAX_DEPTH_OR_ARRAY_SIZE)
+  {
+    return "is larger than the largest texture size";
+  }
+  if (header->face_count != 1 && header->face_count != 6)
+  {
+    return "has an invalid number of faces";
+  }
+
+  bool is_array     = header->layer_count > 0;
+  layout.width      = header->pixel_width;
+  layout.height     = max(header->pixel_height, 1u);
+  layout.depth      = (UINT16)max(header->pixel_depth, 1u);
+  layout.array_size = (UINT16)max(header->layer_count, 1u);
+  layout.mip_levels = (UINT16)min(max(header->level_count, 1u), 0xFFFFu);
+
+  if (header->face_count == 6)
+  {
+    if (header->pixel_height == 0 || header->pixel_depth != 0)
+    {
+      return "is a cube map that is not 2D";
+    }
+    layout.type = is_array ? TEXTURE_FILE_CUBE_ARRAY : TEXTURE_FILE_CUBE;
+  }
+  else if (header->pixel_depth != 0)
+  {
+    if (is_array)
+    {
+      return "is a 3D texture array, which is not supported";
+    }
+    layout.type = TEXTURE_FILE_3D;
+  }
+  else if (header->pixel_height == 0)
+  {
+    layout.type = is_array ? TEXTURE_FILE_1D_ARRAY : TEXTURE_FILE_1D;
+  }
+  else
+  {
+    layout.type = is_array ? TEXTURE_FILE_2D_ARRAY : TEXTURE_FILE_2D;
+  }
+
+  const char* error = ValidateLayout(layout);
+  if (error != NULL)
+  {
+    return error;
+  }
+
+  if (sizeof(KTX2Header) + (UINT64)layout.mip_levels * sizeof(KTX2LevelIndex) > size)
+  {
+    return "has a level index that extends beyond the end of the file";
+  }
+  const KTX2LevelIndex* levels = (const KTX2LevelIndex*)(data + sizeof(KTX2Header));
+
+  // each level holds every layer and face, so the subresources are gathered out of the D3D12 order
+  UINT num_images = (UINT)layout.subresources.size() / layout.mip_levels;
+  for (UINT16 level = 0; level < layout.mip_levels; level++)
+  {
+    UINT width  = max(layout.width >> level, 1u);
+    UINT height = max(layout.height >> level, 1u);
+    UINT depth  = max((UINT)layout.depth >> level, 1u);
+
+    TextureFileSubresource subresource;
+    GetPitches(*info, width, height, subresource);
+    UINT64 image_size = (UINT64)subresource.slice_pitch * depth;
+    if (levels[level].byte_length < image_size * num_images || levels[level].byte_offset > size ||
+        levels[level].byte_length > size - levels[level].byte_offset)
+    {
+      return "has texel data that extends beyond the end of the file";
+    }
+
+    for (UINT image = 0; image < num_images; image++)
+    {
+      subresource.data = data + levels[level].byte_offset + image * image_size;
+      layout.subresources[image * layout.mip_levels + level] = subresource;
+    }
+  }
+  return NULL;
+}
+
+const char* TextureFileFormat::Parse(const UINT8* data, UINT64 size, TextureFileLayout& layout)
+{
+  if (size >= sizeof(KTX2_IDENTIFIER) && memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)
+  {
+    return ParseKTX2(data, size, layout);
+  }
+  if (size >= sizeof(uint32_t) && *(const uint32_t*)data == DDS_MAGIC)
+  {
+    return ParseDDS(data, size, layout);
+  }
+  return "is not a DDS or KTX2 file";
+}
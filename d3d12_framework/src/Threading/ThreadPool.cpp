@@ -0,0 +1,194 @@
+#include <atomic>
+#include <memory>
+#include "private_inc/Threading/ThreadPool.h"
+using namespace std;
+
+/// <summary>
+/// Progress of a ParallelFor loop, shared with the jobs queued for it.  Jobs that start after every chunk was taken
+/// return without touching the loop's function, so it does not need to outlive the call
+/// </summary>
+struct ParallelForState
+{
+  /// <summary>
+  /// function to run on each chunk
+  /// </summary>
+  const ThreadPool::RangeJob* job;
+
+  /// <summary>
+  /// number of items in the loop
+  /// </summary>
+  UINT num;
+
+  /// <summary>
+  /// number of items in each chunk
+  /// </summary>
+  UINT chunk_size;
+
+  /// <summary>
+  /// number of chunks in the loop
+  /// </summary>
+  UINT num_chunks;
+
+  /// <summary>
+  /// index of the next chunk to run
+  /// </summary>
+  atomic<UINT> next_chunk;
+
+  /// <summary>
+  /// number of chunks that have finished
+  /// </summary>
+  atomic<UINT> num_done;
+
+  /// <summary>
+  /// guards waiting on and signaling done
+  /// </summary>
+  mutex lock;
+
+  /// <summary>
+  /// signaled when the last chunk finishes
+  /// </summary>
+  condition_variable done;
+};
+
+/// <summary>
+/// Runs chunks of a ParallelFor loop until there are none left
+/// </summary>
+/// <param name="state">
+/// progress of the loop
+/// </param>
+static void RunChunks(ParallelForState& state)
+{
+  for (;;)
+  {
+    UINT chunk = state.next_chunk++;
+    if (chunk >= state.num_chunks)
+    {
+      return;
+    }
+
+    UINT begin = chunk * state.chunk_size;
+    UINT end   = state.num - begin > state.chunk_size ? begin + state.chunk_size : state.num;
+    (*state.job)(begin, end);
+
+    if (++state.num_done == state.num_chunks)
+    {
+      lock_guard<mutex> guard(state.lock);
+      state.done.notify_all();
+    }
+  }
+}
+
+ThreadPool& ThreadPool::GetDefault()
+{
+  static ThreadPool pool(thread::hardware_concurrency() > 1 ? thread::hardware_concurrency() - 1 : 1);
+  return pool;
+}
+
+ThreadPool::ThreadPool(UINT num_threads)
+:m_shutdown(false)
+{
+  if (num_threads == 0)
+  {
+    num_threads = 1;
+  }
+
+  m_threads.reserve(num_threads);
+  for (UINT i = 0; i < num_threads; i++)
+  {
+    m_threads.push_back(thread(&ThreadPool::WorkerMain, this));
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    lock_guard<mutex> guard(m_lock);
+    m_shutdown = true;
+  }
+  m_job_available.notify_all();
+
+  vector<thread>::iterator it = m_threads.begin();
+  while (it != m_threads.end())
+  {
+    it->join();
+    ++it;
+  }
+}
+
+void ThreadPool::Enqueue(const Job& job)
+{
+  {
+    lock_guard<mutex> guard(m_lock);
+    m_jobs.push_back(job);
+  }
+  m_job_available.notify_one();
+}
+
+void ThreadPool::ParallelFor(UINT num, UINT chunk_size, const RangeJob& job)
+{
+  if (chunk_size == 0)
+  {
+    chunk_size = 1;
+  }
+  UINT num_chunks = num / chunk_size + (num % chunk_size != 0 ? 1 : 0);
+  if (num_chunks <= 1)
+  {
+    if (num > 0)
+    {
+      job(0, num);
+    }
+    return;
+  }
+
+  shared_ptr<ParallelForState> state = make_shared<ParallelForState>();
+  state->job        = &job;
+  state->num        = num;
+  state->chunk_size = chunk_size;
+  state->num_chunks = num_chunks;
+  state->next_chunk = 0;
+  state->num_done   = 0;
+
+  UINT num_jobs = num_chunks - 1 < GetNumThreads() ? num_chunks - 1 : GetNumThreads();
+  for (UINT i = 0; i < num_jobs; i++)
+  {
+    Enqueue([state]() { RunChunks(*state); });
+  }
+  RunChunks(*state);
+
+  unique_lock<mutex> guard(state->lock);
+  while (state->num_done < num_chunks)
+  {
+    state->done.wait(guard);
+  }
+}
+
+UINT ThreadPool::GetNumThreads() const
+{
+  return (UINT)m_threads.size();
+}
+
+void ThreadPool::WorkerMain()
+{
+  for (;;)
+  {
+    Job job;
+    {
+      unique_lock<mutex> guard(m_lock);
+      while (m_jobs.empty() && !m_shutdown)
+      {
+        m_job_available.wait(guard);
+      }
+
+      // drain the queue before honouring a shutdown request
+      if (m_jobs.empty())
+      {
+        return;
+      }
+
+      job = m_jobs.front();
+      m_jobs.pop_front();
+    }
+
+    job();
+  }
+}
@@ -1,12 +1,24 @@
 #include <sstream>
 #include <iomanip>
 #include "FPSMonitor.h"
-#include "Graphics/Textures/TextureUploadBuffer.h"
+#include "Graphics/Textures/BlockCompressor.h"
+#include "Graphics/Textures/PngDecoder.h"
+#include "Graphics/RootSignatureLayout.h"
 #include "FrameworkException.h"
 #include "log.h"
 using namespace DirectX;
 using namespace std;
 
+/// <summary>
+/// Root signature layout used to draw the text.  Parameter 0 is the font texture, parameter 1 the character lookup
+/// table.  Both are uploaded once at creation, so they are marked as static.  The font is only ever sampled at its top
+/// level
+/// </summary>
+typedef RootSig<RootTable<SHADER_VISIBILITY_PIXEL, RangeSRV<0, 1, 0, ROOT_FLAGS_DATA_STATIC> >,
+                RootCBV<0, SHADER_VISIBILITY_VERTEX, 0, ROOT_FLAGS_DATA_STATIC>,
+                StaticSampler<0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, SHADER_VISIBILITY_PIXEL, 0, 1, COMPARISON_FUNC_NEVER,
+                  BORDER_COLOR_TRANSPARENT_BLACK, 0> > FPSMonitorRootSig;
+
 FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char, vector<float> >& lookup_table, UINT width, UINT height, const vector<UINT8>& bytes, UINT char_width, UINT char_height)
 :m_next_sample_index(0),
  m_char_width_px(char_width),
@@ -14,17 +26,111 @@ FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char,
 {
   m_samples.resize(sample_size, 0);
 
+  CommandList* command_list = CreateResources(graphics, lookup_table);
+
+  // compress the font to a quarter of its size when it is made of whole blocks
+  GraphicsDataFormat   font_format = R8B8G8A8_UNORM;
+  vector<UINT8>        compressed;
+  const vector<UINT8>* font_bytes  = &bytes;
+  if (width % BlockCompressor::BLOCK_DIM == 0 && height % BlockCompressor::BLOCK_DIM == 0)
+  {
+    try
+    {
+      BlockCompressor::Compress(bytes, width, height, BC7_UNORM, BC_QUALITY_NORMAL, compressed);
+      font_bytes  = &compressed;
+      font_format = BC7_UNORM;
+    }
+    catch (const FrameworkException& err)
+    {
+      ostringstream out;
+      out << "Unable to compress texture:\n" << err.what();
+      log_print(out.str().c_str());
+      exit(1);
+    }
+  }
+
+  // create the texture
   try
   {
-    RootSignatureConfig* config = RootSignatureConfig::CreateD3D12(2, 1);
-    config->SetStageAccess(true, true, false, false, false, true, false);
-    config->SetParamAsDescriptorTable(0, 1, SHADER_VISIBILITY_PIXEL);
-    config->SetRangeAsShaderResourceView(0, 0, 1, 0, 0);
-    config->SetParamAsConstantBufferView(1, 0, 0, SHADER_VISIBILITY_VERTEX);
-    config->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0, 1, COMPARISON_FUNC_NEVER, BORDER_COLOR_TRANSPARENT_BLACK,
-      0, 0, 0, 0, SHADER_VISIBILITY_PIXEL);
-    m_root_sig = RootSignature::CreateD3D12(graphics, *config);
-    delete config;
+    m_font = Texture2D::CreateD3D12(graphics, *m_shader_buffer_heap, width, height, font_format);
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to create texture:\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
+  TextureUploadBuffer* upload_texture;
+  try
+  {
+    upload_texture = TextureUploadBuffer::CreateD3D12(graphics, *m_font);
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to create texture upload buffer:\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
+
+  // start uploading the texture
+  try
+  {
+    upload_texture->PrepUpload(graphics, *command_list, *m_font, *font_bytes);
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to upload texture:\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
+
+  FinishUpload(graphics, command_list, upload_texture);
+}
+
+FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char, vector<float> >& lookup_table, const string& font_path, UINT char_width, UINT char_height)
+:m_next_sample_index(0),
+ m_char_width_px(char_width),
+ m_char_height_px(char_height)
+{
+  m_samples.resize(sample_size, 0);
+
+  CommandList* command_list = CreateResources(graphics, lookup_table);
+
+  // decode the font straight into the upload buffer at the footprint's row pitch.  The texture is created once the
+  // header has given its size
+  TextureUploadBuffer* upload_texture = NULL;
+  try
+  {
+    PngDecoder::DecodeFiles(vector<string>(1, font_path), [&](UINT index, UINT width, UINT height) -> PngDestination
+    {
+      m_font         = Texture2D::CreateD3D12(graphics, *m_shader_buffer_heap, width, height, R8B8G8A8_UNORM);
+      upload_texture = TextureUploadBuffer::CreateD3D12(graphics, *m_font);
+
+      PngDestination dst;
+      dst.data = upload_texture->Map(graphics, *m_font, dst.row_pitch);
+      return dst;
+    });
+    upload_texture->PrepUploadMapped(graphics, *command_list, *m_font);
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to load font \"" << font_path << "\":\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
+
+  FinishUpload(graphics, command_list, upload_texture);
+}
+
+CommandList* FPSMonitor::CreateResources(GraphicsCore& graphics, const map<char, vector<float> >& lookup_table)
+{
+  try
+  {
+    m_root_sig = FPSMonitorRootSig::CreateD3D12(graphics, true, true, false, false, false, true, false);
   }
   catch (const FrameworkException& err)
   {
@@ -100,8 +206,8 @@ FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char,
   m_scissor_rect = ViewportToScissorRect(graphics.GetDefaultViewport());
 
   // compute clip space char width and height
-  m_char_width  = char_width  / full_viewport.width;
-  m_char_height = char_height / full_viewport.height;
+  m_char_width  = m_char_width_px  / full_viewport.width;
+  m_char_height = m_char_height_px / full_viewport.height;
 
   CommandList* command_list;
   try
@@ -129,7 +235,7 @@ FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char,
   }
   try
   {
-    m_verts = VertexBuffer_Custom::CreateD3D12(graphics, VERTS_PER_CHAR * num_chars, sizeof(VertexBufferEntry), m_vertex_buffer_data);
+    m_verts = DynamicVertexBuffer::CreateD3D12(graphics, FRAMES_IN_FLIGHT, VERTS_PER_CHAR * num_chars, sizeof(VertexBufferEntry), m_vertex_buffer_data);
   }
   catch (const FrameworkException& err)
   {
@@ -240,44 +346,11 @@ FPSMonitor::FPSMonitor(GraphicsCore& graphics, UINT sample_size, const map<char,
     exit(1);
   }
 
-  // create the texture
-  try
-  {
-    m_font = Texture2D::CreateD3D12(graphics, *m_shader_buffer_heap, width, height, R8B8G8A8_UNORM);
-  }
-  catch (const FrameworkException& err)
-  {
-    ostringstream out;
-    out << "Unable to create texture:\n" << err.what();
-    log_print(out.str().c_str());
-    exit(1);
-  }
-  TextureUploadBuffer* upload_texture;
-  try
-  {
-    upload_texture = TextureUploadBuffer::CreateD3D12(graphics, *m_font);
-  }
-  catch (const FrameworkException& err)
-  {
-    ostringstream out;
-    out << "Unable to create texture upload buffer:\n" << err.what();
-    log_print(out.str().c_str());
-    exit(1);
-  }
-
-  // start uploading the texture
-  try
-  {
-    upload_texture->PrepUpload(graphics, *command_list, *m_font, bytes);
-  }
-  catch (const FrameworkException& err)
-  {
-    ostringstream out;
-    out << "Unable to upload texture:\n" << err.what();
-    log_print(out.str().c_str());
-    exit(1);
-  }
+  return command_list;
+}
 
+void FPSMonitor::FinishUpload(GraphicsCore& graphics, CommandList* command_list, TextureUploadBuffer* upload_texture)
+{
   // finish uploading the textures
   try
   {
@@ -372,18 +445,26 @@ void FPSMonitor::Update(UINT ms)
   }
   string tmp = out.str();
   const char* buffer = tmp.c_str();
-  for (UINT i = 0; i < num_chars; i++)
-  {
-    UINT index = m_key_to_index.at(buffer[i]);
-    m_vertex_buffer_data[i * VERTS_PER_CHAR    ].lookup_index = index;
-    m_vertex_buffer_data[i * VERTS_PER_CHAR + 1].lookup_index = index;
-    m_vertex_buffer_data[i * VERTS_PER_CHAR + 2].lookup_index = index;
-    m_vertex_buffer_data[i * VERTS_PER_CHAR + 3].lookup_index = index;
-  }
 
   try
   {
-    m_verts->Upload(0, m_vertex_buffer_data, sizeof(VertexBufferEntry) * num_chars * VERTS_PER_CHAR);
+    // only the characters that changed are written to this frame's version of the vertex buffer
+    m_verts->NextFrame();
+    for (UINT i = 0; i < num_chars; i++)
+    {
+      UINT index = m_key_to_index.at(buffer[i]);
+      if (m_vertex_buffer_data[i * VERTS_PER_CHAR].lookup_index == index)
+      {
+        continue;
+      }
+
+      m_vertex_buffer_data[i * VERTS_PER_CHAR    ].lookup_index = index;
+      m_vertex_buffer_data[i * VERTS_PER_CHAR + 1].lookup_index = index;
+      m_vertex_buffer_data[i * VERTS_PER_CHAR + 2].lookup_index = index;
+      m_vertex_buffer_data[i * VERTS_PER_CHAR + 3].lookup_index = index;
+      m_verts->Upload(sizeof(VertexBufferEntry) * i * VERTS_PER_CHAR, &m_vertex_buffer_data[i * VERTS_PER_CHAR], sizeof(VertexBufferEntry) * VERTS_PER_CHAR);
+    }
+    m_vert_array->Set(0, *m_verts);
   }
   catch (const FrameworkException& err)
   {
@@ -405,8 +486,8 @@ void FPSMonitor::Draw(GraphicsCore& graphics, CommandList* command_list) const
     command_list->RSSetScissorRect(m_scissor_rect);
 
     command_list->SetHeapArray(*m_heap_array);
-    command_list->SetTextureAsStartOfDescriptorTable(0, *m_font);
-    command_list->SetConstantBuffer(1, *m_lookup_table);
+    FPSMonitorRootSig::SetTable<0>(*command_list, *m_font);
+    FPSMonitorRootSig::SetConstantBuffer<1>(*command_list, *m_lookup_table);
 
     command_list->OMSetRenderTarget(current_render_target);
 
@@ -445,4 +526,16 @@ void FPSMonitor::Resize(GraphicsCore& graphics)
     m_vertex_buffer_data[i * VERTS_PER_CHAR + 2].pos = XMFLOAT2(-1 + x + m_char_width, y - m_char_height);
     m_vertex_buffer_data[i * VERTS_PER_CHAR + 3].pos = XMFLOAT2(-1 + x + m_char_width, y);
   }
+
+  try
+  {
+    m_verts->Upload(0, m_vertex_buffer_data, sizeof(VertexBufferEntry) * num_chars * VERTS_PER_CHAR);
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to update vertex buffer:\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
 }
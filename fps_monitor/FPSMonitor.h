@@ -2,11 +2,14 @@
 #define FPS_MONITOR_H
 
 #include <map>
+#include <string>
 #include <vector>
 #include <directxmath.h>
 #include "Graphics/Textures/Texture2D.h"
 #include "Graphics/Buffers/ConstantBuffer.h"
 #include "Graphics/Buffers/IndexBuffer16.h"
+#include "Graphics/Buffers/DynamicVertexBuffer.h"
+#include "Graphics/Textures/TextureUploadBuffer.h"
 
 class FPSMonitor
 {
@@ -41,6 +44,32 @@ class FPSMonitor
     FPSMonitor(GraphicsCore& graphics, UINT sample_size, const std::map<char, std::vector<float> >& lookup_table, UINT width, UINT height, const std::vector<UINT8>& bytes, UINT char_width,
       UINT char_height);
 
+    /// <summary>
+    /// Creates a monitor using the font in a PNG file.  The file is decoded by PngDecoder straight into the texture's
+    /// upload buffer, so there is no copy of the image in CPU memory.  The texture keeps the R8B8G8A8 format, since
+    /// compressing it would need that copy
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="sample_size">
+    /// number of samples to use when computing the FPS
+    /// </param>
+    /// <param name="lookup_table">
+    /// map of characters to their uv coordinates in the order of left, right, top, bottom
+    /// </param>
+    /// <param name="font_path">
+    /// path of the PNG file to use as the font
+    /// </param>
+    /// <param name="char_width">
+    /// width of a character in pixels
+    /// </param>
+    /// <param name="char_height">
+    /// height of a character in pixels
+    /// </param>
+    FPSMonitor(GraphicsCore& graphics, UINT sample_size, const std::map<char, std::vector<float> >& lookup_table, const std::string& font_path, UINT char_width,
+      UINT char_height);
+
     ~FPSMonitor();
 
     /// <summary>
@@ -73,12 +102,41 @@ class FPSMonitor
     FPSMonitor(const FPSMonitor& cpy);
     FPSMonitor& operator=(const FPSMonitor& cpy);
 
+    /// <summary>
+    /// Creates everything but the font texture
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="lookup_table">
+    /// map of characters to their uv coordinates in the order of left, right, top, bottom
+    /// </param>
+    /// <returns>
+    /// command list to upload the font texture with
+    /// </returns>
+    CommandList* CreateResources(GraphicsCore& graphics, const std::map<char, std::vector<float> >& lookup_table);
+
+    /// <summary>
+    /// Executes the command list that uploads the font texture and waits for it to finish
+    /// </summary>
+    /// <param name="graphics">
+    /// core graphics interface
+    /// </param>
+    /// <param name="command_list">
+    /// command list returned by CreateResources, which is deleted
+    /// </param>
+    /// <param name="upload_texture">
+    /// upload buffer of the font texture, which is deleted
+    /// </param>
+    void FinishUpload(GraphicsCore& graphics, CommandList* command_list, TextureUploadBuffer* upload_texture);
+
     enum
     {
       VERTS_PER_CHAR   = 4,
       INDICES_PER_CHAR = 6,
       CHARS_PER_ROW    = 9,
       NUM_ROWS         = 3,
+      FRAMES_IN_FLIGHT = 2,
     };
 
     struct VertexBufferEntry
@@ -159,9 +217,9 @@ class FPSMonitor
     VertexBufferArray* m_vert_array;
 
     /// <summary>
-    /// vertex buffer for displaying the FPS values
+    /// vertex buffer for displaying the FPS values, with a version for each frame in flight
     /// </summary>
-    VertexBuffer_Custom* m_verts;
+    DynamicVertexBuffer* m_verts;
 
     /// <summary>
     /// index buffer for displaying the FPS values
@@ -2,7 +2,7 @@
 #define TEST_MODEL_H
 
 #include "Graphics/GraphicsCore.h"
-#include "Graphics/Buffers/VertexBuffer_PositionColor.h"
+#include "Graphics/Buffers/TypedVertexBuffer.h"
 
 class TestModel
 {
@@ -0,0 +1,173 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Pipeline.h"
+#include "Graphics/AsyncPipeline.h"
+#include "private_inc/Threading/ThreadPool.h"
+using namespace std;
+
+/// <summary>
+/// Pipeline returned by the simulated compiler, which counts how many are still alive
+/// </summary>
+class FakePipeline : public Pipeline
+{
+  public:
+    FakePipeline(atomic<int>& num_alive)
+    :m_num_alive(num_alive)
+    {
+      m_num_alive++;
+    }
+
+    ~FakePipeline()
+    {
+      m_num_alive--;
+    }
+
+  private:
+    atomic<int>& m_num_alive;
+};
+
+/// <summary>
+/// Gate a simulated compile waits on, so a test decides when it finishes
+/// </summary>
+class CompileGate
+{
+  public:
+    CompileGate()
+    :m_open(false)
+    {
+    }
+
+    void Open()
+    {
+      lock_guard<mutex> guard(m_lock);
+      m_open = true;
+      m_opened.notify_all();
+    }
+
+    void WaitUntilOpen()
+    {
+      unique_lock<mutex> guard(m_lock);
+      while (!m_open)
+      {
+        m_opened.wait(guard);
+      }
+    }
+
+  private:
+    mutex              m_lock;
+    condition_variable m_opened;
+    bool               m_open;
+};
+
+TEST(AsyncPipelineDoesNotBlockOnSlowCompile)
+{
+  ThreadPool  pool(1);
+  atomic<int> num_alive(0);
+  CompileGate gate;
+  FakePipeline fallback(num_alive);
+
+  AsyncPipeline* pending = AsyncPipeline::Create([&]() -> Pipeline*
+  {
+    gate.WaitUntilOpen();
+    return new FakePipeline(num_alive);
+  }, pool);
+
+  CHECK(!pending->IsReady());
+  CHECK(pending->GetPipeline() == NULL);
+  CHECK(&pending->GetPipelineOrFallback(fallback) == &fallback);
+
+  gate.Open();
+  Pipeline& compiled = pending->Wait();
+  CHECK(pending->IsReady());
+  CHECK(pending->GetPipeline() == &compiled);
+  CHECK(&pending->GetPipelineOrFallback(fallback) == &compiled);
+  CHECK(num_alive == 2);
+
+  delete pending;
+  CHECK(num_alive == 1);
+}
+
+TEST(AsyncPipelineRethrowsCompileErrors)
+{
+  ThreadPool pool(1);
+
+  AsyncPipeline* failed = AsyncPipeline::Create([]() -> Pipeline*
+  {
+    throw FrameworkException("simulated compile error");
+  }, pool);
+  CHECK_THROWS(failed->Wait());
+  CHECK(failed->IsReady());
+  CHECK(failed->GetPipeline() == NULL);
+  delete failed;
+
+  AsyncPipeline* null_result = AsyncPipeline::Create([]() -> Pipeline*
+  {
+    return NULL;
+  }, pool);
+  CHECK_THROWS(null_result->Wait());
+  delete null_result;
+}
+
+TEST(AsyncPipelineDestructorWaitsForCompile)
+{
+  ThreadPool  pool(1);
+  atomic<int> num_alive(0);
+  atomic<bool> finished(false);
+
+  AsyncPipeline* pending = AsyncPipeline::Create([&]() -> Pipeline*
+  {
+    this_thread::sleep_for(chrono::milliseconds(50));
+    finished = true;
+    return new FakePipeline(num_alive);
+  }, pool);
+  delete pending;
+
+  CHECK(finished);
+  CHECK(num_alive == 0);
+}
+
+TEST(AsyncPipelineCompilesRunConcurrentlyOnThePool)
+{
+  const UINT  NUM_THREADS  = 3;
+  const UINT  NUM_COMPILES = 12;
+  ThreadPool  pool(NUM_THREADS);
+  atomic<int> num_alive(0);
+  atomic<int> num_running(0);
+  atomic<int> max_running(0);
+
+  // each simulated compile is slow enough that the others have started by the time it finishes
+  vector<AsyncPipeline*> pending;
+  for (UINT i = 0; i < NUM_COMPILES; i++)
+  {
+    pending.push_back(AsyncPipeline::Create([&]() -> Pipeline*
+    {
+      int running = ++num_running;
+      int seen    = max_running;
+      while (running > seen && !max_running.compare_exchange_weak(seen, running))
+      {
+      }
+      this_thread::sleep_for(chrono::milliseconds(30));
+      num_running--;
+      return new FakePipeline(num_alive);
+    }, pool));
+  }
+
+  for (UINT i = 0; i < NUM_COMPILES; i++)
+  {
+    pending[i]->Wait();
+  }
+  CHECK(num_alive == (int)NUM_COMPILES);
+  CHECK(max_running > 1);
+  CHECK(max_running <= (int)NUM_THREADS);
+
+  for (UINT i = 0; i < NUM_COMPILES; i++)
+  {
+    delete pending[i];
+  }
+  CHECK(num_alive == 0);
+}
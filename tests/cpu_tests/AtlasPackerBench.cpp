@@ -0,0 +1,183 @@
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Textures/AtlasPacker.h"
+#include "Graphics/Textures/TextureAtlas.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Makes the sizes of sprite-like rectangles, mostly small with a few large ones, sorted the way TextureAtlas inserts
+/// them, longest side first
+/// </summary>
+static vector<AtlasRect> MakeRectSizes(UINT count, UINT max_side)
+{
+  uint32_t state = 12345;
+  vector<AtlasRect> rects(count);
+  for (UINT i = 0; i < count; i++)
+  {
+    float scale = NextFixtureRandom(state);
+    scale = scale * scale * scale;
+    rects[i].x      = 0;
+    rects[i].y      = 0;
+    rects[i].width  = 4 + (UINT)(scale * (max_side - 4) * (0.5f + NextFixtureRandom(state) * 0.5f));
+    rects[i].height = 4 + (UINT)(scale * (max_side - 4) * (0.5f + NextFixtureRandom(state) * 0.5f));
+  }
+  stable_sort(rects.begin(), rects.end(), [](const AtlasRect& a, const AtlasRect& b)
+  {
+    return max(a.width, a.height) > max(b.width, b.height);
+  });
+  return rects;
+}
+
+/// <summary>
+/// Packs rectangles into pages with shelves: rows as tall as their first rectangle, filled left to right.  This is the
+/// usual simple alternative to MaxRects, and the baseline it is compared against
+/// </summary>
+/// <returns>
+/// number of pages used
+/// </returns>
+static UINT PackShelves(const vector<AtlasRect>& rects, UINT page_size)
+{
+  UINT pages    = 1;
+  UINT shelf_y  = 0;
+  UINT shelf_h  = 0;
+  UINT cursor_x = 0;
+  for (size_t i = 0; i < rects.size(); i++)
+  {
+    if (cursor_x + rects[i].width > page_size)
+    {
+      shelf_y  += shelf_h;
+      shelf_h  = 0;
+      cursor_x = 0;
+    }
+    if (shelf_y + rects[i].height > page_size)
+    {
+      pages++;
+      shelf_y  = 0;
+      shelf_h  = 0;
+      cursor_x = 0;
+    }
+    cursor_x += rects[i].width;
+    shelf_h  = max(shelf_h, rects[i].height);
+  }
+  return pages;
+}
+
+/// <summary>
+/// Packs rectangles into pages with AtlasPacker, opening a page whenever 1 does not fit in the existing ones, as
+/// TextureAtlas::Pack does
+/// </summary>
+/// <returns>
+/// number of pages used
+/// </returns>
+static UINT PackMaxRects(const vector<AtlasRect>& rects, UINT page_size, vector<AtlasPacker*>& packers)
+{
+  UINT pages = 0;
+  for (size_t i = 0; i < rects.size(); i++)
+  {
+    AtlasRect rect;
+    UINT page = 0;
+    while (page < pages && !packers[page]->Insert(rects[i].width, rects[i].height, rect))
+    {
+      page++;
+    }
+    if (page == pages)
+    {
+      if (pages == packers.size())
+      {
+        packers.push_back(new AtlasPacker(page_size, page_size));
+      }
+      packers[pages++]->Insert(rects[i].width, rects[i].height, rect);
+    }
+  }
+  return pages;
+}
+
+BENCHMARK(AtlasPackerVersusShelves)
+{
+  // 20000 sprite sized rectangles on 2048x2048 pages.  Fewer pages is the point of MaxRects, so the page count and
+  // occupancy are reported with the time
+  const UINT PAGE  = 2048;
+  const UINT COUNT = 20000;
+  vector<AtlasRect> rects = MakeRectSizes(COUNT, 256);
+  UINT64 area = 0;
+  for (size_t i = 0; i < rects.size(); i++)
+  {
+    area += (UINT64)rects[i].width * rects[i].height;
+  }
+
+  double best_maxrects = 1e30;
+  double best_shelves  = 1e30;
+  UINT   maxrects_pages = 0;
+  UINT   shelf_pages    = 0;
+  vector<AtlasPacker*> packers;
+  for (int run = 0; run < RUNS; run++)
+  {
+    for (size_t i = 0; i < packers.size(); i++)
+    {
+      packers[i]->Reset();
+    }
+    double start = BenchSeconds();
+    maxrects_pages = PackMaxRects(rects, PAGE, packers);
+    double time = BenchSeconds() - start;
+    best_maxrects = time < best_maxrects ? time : best_maxrects;
+
+    start = BenchSeconds();
+    shelf_pages = PackShelves(rects, PAGE);
+    time = BenchSeconds() - start;
+    best_shelves = time < best_shelves ? time : best_shelves;
+  }
+  for (size_t i = 0; i < packers.size(); i++)
+  {
+    delete packers[i];
+  }
+  CHECK(maxrects_pages <= shelf_pages);
+
+  double page_area = (double)PAGE * PAGE;
+  ReportBenchmark("MaxRects, 20000 rects", best_maxrects * 1e3, "ms");
+  ReportBenchmark("MaxRects, pages", maxrects_pages, "");
+  ReportBenchmark("MaxRects, occupancy", 100.0 * area / (page_area * maxrects_pages), "%");
+  ReportBenchmark("shelves, 20000 rects", best_shelves * 1e3, "ms");
+  ReportBenchmark("shelves, pages", shelf_pages, "");
+  ReportBenchmark("shelves, occupancy", 100.0 * area / (page_area * shelf_pages), "%");
+}
+
+BENCHMARK(TextureAtlasPack)
+{
+  // 8000 RGBA8 sprites packed into 2048x2048 pages with a 1 texel gutter and a 4 level chain, including filling the
+  // pages' texels on the default pool
+  const UINT PAGE  = 2048;
+  const UINT COUNT = 8000;
+  vector<AtlasRect> sizes = MakeRectSizes(COUNT, 128);
+  vector<UINT8> texels(128 * 128 * 4, 0x7F);
+
+  double best = 1e30;
+  UINT16 pages = 0;
+  float occupancy = 0;
+  for (int run = 0; run < RUNS; run++)
+  {
+    TextureAtlas atlas(PAGE, PAGE, R8B8G8A8_UNORM, 1, 4);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+      atlas.Add(&texels[0], sizes[i].width, sizes[i].height, 128 * 4);
+    }
+    double start = BenchSeconds();
+    atlas.Pack();
+    double time = BenchSeconds() - start;
+    best = time < best ? time : best;
+    pages = atlas.GetNumPages();
+    occupancy = atlas.GetOccupancy();
+  }
+
+  ReportBenchmark("8000 sprites, Pack", best * 1e3, "ms");
+  ReportBenchmark("8000 sprites, pages", pages, "");
+  ReportBenchmark("8000 sprites, occupancy", 100.0 * occupancy, "%");
+}
@@ -0,0 +1,81 @@
+#include <stdint.h>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Textures/AtlasPacker.h"
+using namespace std;
+
+/// <summary>
+/// Checks that every rectangle is inside the page and that no 2 overlap
+/// </summary>
+static bool RectsArePacked(const vector<AtlasRect>& rects, UINT width, UINT height)
+{
+  for (size_t i = 0; i < rects.size(); i++)
+  {
+    const AtlasRect& a = rects[i];
+    if (a.x + a.width > width || a.y + a.height > height)
+    {
+      return false;
+    }
+    for (size_t j = i + 1; j < rects.size(); j++)
+    {
+      const AtlasRect& b = rects[j];
+      if (a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+TEST(AtlasPackerFillsAPageExactly)
+{
+  // 16 64x64 squares tile a 256x256 page with nothing left over, and a 17th doesn't fit
+  AtlasPacker packer(256, 256);
+  vector<AtlasRect> rects(16);
+  for (size_t i = 0; i < rects.size(); i++)
+  {
+    CHECK(packer.Insert(64, 64, rects[i]));
+  }
+  CHECK(RectsArePacked(rects, 256, 256));
+  CHECK_CLOSE(packer.GetOccupancy(), 1.0f, 1e-6f);
+
+  AtlasRect extra;
+  CHECK(!packer.Insert(1, 1, extra));
+  CHECK(packer.Insert(0, 0, extra));
+
+  packer.Reset();
+  CHECK(packer.GetOccupancy() == 0);
+  CHECK(packer.Insert(256, 256, extra));
+  CHECK(extra.x == 0 && extra.y == 0);
+}
+
+TEST(AtlasPackerPacksMixedSizesWithoutOverlap)
+{
+  AtlasPacker packer(512, 512);
+  uint32_t state = 7;
+  vector<AtlasRect> rects;
+  UINT64 area = 0;
+  for (UINT i = 0; i < 400; i++)
+  {
+    UINT width  = 4 + (UINT)(NextFixtureRandom(state) * 60);
+    UINT height = 4 + (UINT)(NextFixtureRandom(state) * 60);
+    AtlasRect rect;
+    if (packer.Insert(width, height, rect))
+    {
+      CHECK(rect.width == width && rect.height == height);
+      rects.push_back(rect);
+      area += (UINT64)width * height;
+    }
+  }
+  CHECK(RectsArePacked(rects, 512, 512));
+  CHECK_CLOSE(packer.GetOccupancy(), (float)((double)area / (512.0 * 512.0)), 1e-5f);
+  CHECK(packer.GetOccupancy() > 0.8f);
+
+  // a rectangle that doesn't fit leaves the page as it was
+  float occupancy = packer.GetOccupancy();
+  AtlasRect rect;
+  CHECK(!packer.Insert(513, 1, rect));
+  CHECK(packer.GetOccupancy() == occupancy);
+}
@@ -0,0 +1,53 @@
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "BlockDecoderFixture.h"
+#include "ImageFixture.h"
+#include "Graphics/Textures/BlockCompressor.h"
+using namespace std;
+
+BENCHMARK(BlockCompressorSpeedAndQuality)
+{
+  // about a megapixel, the size of a typical albedo or UI texture
+  const UINT WIDTH  = 1280;
+  const UINT HEIGHT = 800;
+  vector<UINT8> opaque;
+  vector<UINT8> translucent;
+  MakeFixtureImage(WIDTH, HEIGHT, false, opaque);
+  MakeFixtureImage(WIDTH, HEIGHT, true, translucent);
+  double num_mpix = (double)WIDTH * HEIGHT / 1e6;
+
+  // BC7 tries different modes on opaque blocks, so it is measured on both images
+  const GraphicsDataFormat formats[]  = { BC1_UNORM, BC3_UNORM, BC4_UNORM, BC5_UNORM, BC7_UNORM, BC7_UNORM };
+  const char*              names[]    = { "BC1", "BC3", "BC4", "BC5", "BC7", "BC7 opaque" };
+  const UINT               channels[] = { 3, 4, 1, 2, 4, 3 };
+  const BlockCompressionQuality qualities[] = { BC_QUALITY_FAST, BC_QUALITY_NORMAL, BC_QUALITY_HIGH };
+  const char*              quality_names[]  = { "fast", "normal", "high" };
+
+  for (UINT f = 0; f < 6; f++)
+  {
+    const vector<UINT8>& src = channels[f] == 4 ? translucent : opaque;
+    for (UINT q = 0; q < 3; q++)
+    {
+      vector<UINT8> blocks;
+      double best = 1e30;
+      for (int run = 0; run < 2; run++)
+      {
+        double start = BenchSeconds();
+        BlockCompressor::Compress(src, WIDTH, HEIGHT, formats[f], qualities[q], blocks);
+        double time = BenchSeconds() - start;
+        best = time < best ? time : best;
+      }
+
+      // quality is measured with the reference decoder, over the channels the format stores
+      vector<UINT8> decoded;
+      UINT mode_counts[9] = {};
+      DecodeFixtureImage(blocks, WIDTH, HEIGHT, formats[f], decoded, mode_counts);
+      CHECK(mode_counts[8] == 0);
+
+      string label = string(names[f]) + " " + quality_names[q] + ", ";
+      ReportBenchmark((label + "encode").c_str(), num_mpix / best, "Mpix/s");
+      ReportBenchmark((label + "PSNR").c_str(), ComputePSNR(src, decoded, 0, channels[f]), "dB");
+    }
+  }
+}
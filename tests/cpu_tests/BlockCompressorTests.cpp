@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <vector>
+#include "TestHarness.h"
+#include "BlockDecoderFixture.h"
+#include "ImageFixture.h"
+#include "Graphics/Textures/BlockCompressor.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Format, the channels it stores, the quality its round trip has to reach on the fixture image and how much better
+/// normal quality has to be than fast
+/// </summary>
+struct RoundTripCase
+{
+  GraphicsDataFormat format;
+  UINT               first_channel;
+  UINT               num_channels;
+  double             min_psnr;
+  double             min_normal_gain;
+};
+
+TEST(BlockCompressorRoundTripsThroughReferenceDecoder)
+{
+  // BC7 adds modes 5 and 1 at normal quality, which fast never tries, so normal has to be clearly better there
+  const RoundTripCase cases[] =
+  {
+    { BC1_UNORM,      0, 3, 29, 0 },
+    { BC3_UNORM,      0, 4, 30, 0 },
+    { BC4_UNORM,      0, 1, 38, 0 },
+    { BC5_UNORM,      0, 2, 38, 0 },
+    { BC7_UNORM,      0, 4, 29, 2.5 },
+    { BC7_UNORM_SRGB, 0, 3, 31, 4 }
+  };
+  const BlockCompressionQuality qualities[] = { BC_QUALITY_FAST, BC_QUALITY_NORMAL };
+
+  // not a multiple of the block size, so the last blocks repeat the edge texels
+  const UINT WIDTH  = 61;
+  const UINT HEIGHT = 45;
+  vector<UINT8> opaque;
+  vector<UINT8> translucent;
+  MakeFixtureImage(WIDTH, HEIGHT, false, opaque);
+  MakeFixtureImage(WIDTH, HEIGHT, true, translucent);
+
+  for (UINT c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+  {
+    const vector<UINT8>& src = cases[c].num_channels == 4 ? translucent : opaque;
+    double fast_psnr = 0;
+    for (UINT q = 0; q < 2; q++)
+    {
+      vector<UINT8> blocks;
+      BlockCompressor::Compress(src, WIDTH, HEIGHT, cases[c].format, qualities[q], blocks);
+      CHECK(blocks.size() == BlockCompressor::GetCompressedSize(cases[c].format, WIDTH, HEIGHT));
+      CHECK(blocks.size() == 16 * 12 * BlockCompressor::GetBytesPerBlock(cases[c].format));
+
+      vector<UINT8> decoded;
+      UINT mode_counts[9] = {};
+      DecodeFixtureImage(blocks, WIDTH, HEIGHT, cases[c].format, decoded, mode_counts);
+      double psnr = ComputePSNR(src, decoded, cases[c].first_channel, cases[c].num_channels);
+      CHECK(psnr > cases[c].min_psnr);
+      CHECK(q == 0 || psnr >= fast_psnr + cases[c].min_normal_gain);
+      fast_psnr = psnr;
+
+      // the compressor only writes modes 1, 5 and 6
+      CHECK(mode_counts[0] == 0 && mode_counts[2] == 0 && mode_counts[3] == 0);
+      CHECK(mode_counts[4] == 0 && mode_counts[7] == 0 && mode_counts[8] == 0);
+    }
+  }
+}
+
+TEST(BlockCompressorKeepsSolidBlocks)
+{
+  // BC7 endpoints have 8 bits per channel counting the p-bit, but a p-bit is shared by all of an endpoint's channels,
+  // so a solid block can be off by 1.  BC4 stores the value as an endpoint, so it is exact
+  vector<UINT8> src(8 * 4 * 4);
+  for (size_t i = 0; i < src.size(); i += 4)
+  {
+    src[i]     = 37;
+    src[i + 1] = 201;
+    src[i + 2] = 90;
+    src[i + 3] = i < src.size() / 2 ? 255 : 128;
+  }
+
+  vector<UINT8> blocks;
+  vector<UINT8> decoded;
+  BlockCompressor::Compress(src, 8, 4, BC7_UNORM, BC_QUALITY_FAST, blocks);
+  DecodeFixtureImage(blocks, 8, 4, BC7_UNORM, decoded);
+  CHECK(decoded.size() == src.size());
+  for (size_t i = 0; i < src.size() && i < decoded.size(); i++)
+  {
+    CHECK(abs((int)decoded[i] - (int)src[i]) <= 1);
+  }
+
+  BlockCompressor::Compress(src, 8, 4, BC4_UNORM, BC_QUALITY_FAST, blocks);
+  DecodeFixtureImage(blocks, 8, 4, BC4_UNORM, decoded);
+  CHECK(decoded[0] == 37 && decoded[4 * 31] == 37);
+}
+
+TEST(BlockCompressorMakesBC1AlphaTransparent)
+{
+  // the left half is transparent and the right half opaque, so every block uses 3 colors and transparent black
+  vector<UINT8> src(8 * 8 * 4);
+  for (UINT t = 0; t < 64; t++)
+  {
+    src[t * 4]     = (UINT8)(t * 4);
+    src[t * 4 + 1] = 128;
+    src[t * 4 + 2] = (UINT8)(255 - t * 4);
+    src[t * 4 + 3] = (t & 7) < 2 ? 0 : 255;
+  }
+
+  vector<UINT8> blocks;
+  vector<UINT8> decoded;
+  BlockCompressor::Compress(src, 8, 8, BC1_UNORM, BC_QUALITY_NORMAL, blocks);
+  DecodeFixtureImage(blocks, 8, 8, BC1_UNORM, decoded);
+  for (UINT t = 0; t < 64; t++)
+  {
+    CHECK(decoded[t * 4 + 3] == src[t * 4 + 3]);
+  }
+}
+
+TEST(BlockCompressorRejectsBadArguments)
+{
+  vector<UINT8> src(8 * 8 * 4);
+  vector<UINT8> blocks;
+  CHECK(!BlockCompressor::IsFormatSupported(BC6H_UF16));
+  CHECK(BlockCompressor::IsBlockCompressed(BC6H_UF16));
+  CHECK_THROWS(BlockCompressor::Compress(src, 8, 8, BC6H_UF16, BC_QUALITY_FAST, blocks));
+  CHECK_THROWS(BlockCompressor::Compress(src, 8, 9, BC1_UNORM, BC_QUALITY_FAST, blocks));
+  CHECK_THROWS(BlockCompressor::GetBytesPerBlock(R8B8G8A8_UNORM));
+}
@@ -0,0 +1,401 @@
+#ifndef BLOCK_DECODER_FIXTURE_H
+#define BLOCK_DECODER_FIXTURE_H
+
+#include <windows.h>
+#include <vector>
+#include "Graphics/GraphicsDataFormat.h"
+
+// Decodes block compressed data the way the D3D11 functional specification describes, so the compressor's output can
+// be checked against a decoder that shares no code or rounding with it.  sRGB formats decode to their stored sRGB
+// values.
+
+/// <summary>
+/// Expands a 5 or 6 bit BC1 color channel to 8 bits
+/// </summary>
+inline UINT8 ExpandFixtureBits(UINT value, UINT num_bits)
+{
+  return (UINT8)((value << (8 - num_bits)) | (value >> (2 * num_bits - 8)));
+}
+
+/// <summary>
+/// Decodes the 8 byte color half of a BC1, BC2 or BC3 block
+/// </summary>
+/// <param name="src">
+/// bytes of the color block
+/// </param>
+/// <param name="allow_transparent">
+/// true for BC1, where the endpoint order selects 3 colors and transparent black
+/// false for BC2 and BC3, which always use 4 colors
+/// </param>
+/// <param name="texels">
+/// where to write the 16 RGBA texels of the block, in rows
+/// </param>
+inline void DecodeFixtureColorBlock(const UINT8* src, bool allow_transparent, UINT8 texels[16][4])
+{
+  UINT color_bits[2] = { (UINT)(src[0] | (src[1] << 8)), (UINT)(src[2] | (src[3] << 8)) };
+  UINT palette[4][4];
+  for (UINT e = 0; e < 2; e++)
+  {
+    palette[e][0] = ExpandFixtureBits(color_bits[e] >> 11, 5);
+    palette[e][1] = ExpandFixtureBits((color_bits[e] >> 5) & 0x3F, 6);
+    palette[e][2] = ExpandFixtureBits(color_bits[e] & 0x1F, 5);
+    palette[e][3] = 255;
+  }
+  bool four_color = !allow_transparent || color_bits[0] > color_bits[1];
+  for (UINT c = 0; c < 3; c++)
+  {
+    if (four_color)
+    {
+      palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+      palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+    }
+    else
+    {
+      palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+      palette[3][c] = 0;
+    }
+  }
+  palette[2][3] = 255;
+  palette[3][3] = four_color ? 255 : 0;
+
+  UINT indices = src[4] | (src[5] << 8) | (src[6] << 16) | ((UINT)src[7] << 24);
+  for (UINT t = 0; t < 16; t++)
+  {
+    UINT index = (indices >> (2 * t)) & 3;
+    for (UINT c = 0; c < 4; c++)
+    {
+      texels[t][c] = (UINT8)palette[index][c];
+    }
+  }
+}
+
+/// <summary>
+/// Decodes an 8 byte BC4 style block into 1 channel of the texels
+/// </summary>
+/// <param name="src">
+/// bytes of the channel block
+/// </param>
+/// <param name="channel">
+/// channel of the texels to write
+/// </param>
+/// <param name="texels">
+/// where to write the channel of the 16 texels of the block, in rows
+/// </param>
+inline void DecodeFixtureChannelBlock(const UINT8* src, UINT channel, UINT8 texels[16][4])
+{
+  UINT palette[8];
+  palette[0] = src[0];
+  palette[1] = src[1];
+  if (palette[0] > palette[1])
+  {
+    for (UINT i = 1; i < 7; i++)
+    {
+      palette[i + 1] = ((7 - i) * palette[0] + i * palette[1] + 3) / 7;
+    }
+  }
+  else
+  {
+    for (UINT i = 1; i < 5; i++)
+    {
+      palette[i + 1] = ((5 - i) * palette[0] + i * palette[1] + 2) / 5;
+    }
+    palette[6] = 0;
+    palette[7] = 255;
+  }
+
+  UINT64 indices = 0;
+  for (UINT b = 0; b < 6; b++)
+  {
+    indices |= (UINT64)src[2 + b] << (8 * b);
+  }
+  for (UINT t = 0; t < 16; t++)
+  {
+    texels[t][channel] = (UINT8)palette[(indices >> (3 * t)) & 7];
+  }
+}
+
+/// <summary>
+/// Reads a BC7 block's fields from its lowest bit up
+/// </summary>
+class FixtureBitReader
+{
+  public:
+    FixtureBitReader(const UINT8* src)
+    :m_src(src),
+     m_pos(0)
+    {
+    }
+
+    UINT Read(UINT num_bits)
+    {
+      UINT value = 0;
+      for (UINT b = 0; b < num_bits; b++, m_pos++)
+      {
+        value |= ((m_src[m_pos >> 3] >> (m_pos & 7)) & 1u) << b;
+      }
+      return value;
+    }
+
+    UINT GetPos() const
+    {
+      return m_pos;
+    }
+
+  private:
+    const UINT8* m_src;
+    UINT         m_pos;
+};
+
+/// <summary>
+/// Decodes a 16 byte BC7 block.  Every mode but the 2 with 3 subsets is handled, as the framework's compressor only
+/// writes modes 1, 5 and 6
+/// </summary>
+/// <param name="src">
+/// bytes of the block
+/// </param>
+/// <param name="texels">
+/// where to write the 16 RGBA texels of the block, in rows
+/// </param>
+/// <returns>
+/// mode of the block, or -1 if it is a 3 subset mode or a reserved mode, which decode to transparent black
+/// </returns>
+inline int DecodeFixtureBC7Block(const UINT8* src, UINT8 texels[16][4])
+{
+  // 2 subset partitions and the second subset's anchor texel, from the specification
+  static const UINT16 PARTITIONS[64] =
+  {
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+  };
+  static const UINT8 ANCHORS[64] =
+  {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+     6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+  };
+  static const UINT WEIGHTS_2[4]  = { 0, 21, 43, 64 };
+  static const UINT WEIGHTS_3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+  static const UINT WEIGHTS_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+  // subsets, partition bits, rotation bits, index selection bits, color bits, alpha bits, endpoint p-bits, shared
+  // p-bits, index bits and secondary index bits of each mode
+  static const UINT MODES[8][10] =
+  {
+    { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+    { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+    { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+    { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+    { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+    { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+    { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+    { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+  };
+
+  FixtureBitReader reader(src);
+  int mode = 0;
+  while (mode < 8 && reader.Read(1) == 0)
+  {
+    mode++;
+  }
+  if (mode == 8 || MODES[mode][0] == 3)
+  {
+    for (UINT t = 0; t < 16; t++)
+    {
+      texels[t][0] = texels[t][1] = texels[t][2] = texels[t][3] = 0;
+    }
+    return -1;
+  }
+
+  const UINT* info         = MODES[mode];
+  UINT        num_subsets  = info[0];
+  UINT        partition    = reader.Read(info[1]);
+  UINT        rotation     = reader.Read(info[2]);
+  UINT        index_select = reader.Read(info[3]);
+  UINT        color_bits   = info[4];
+  UINT        alpha_bits   = info[5];
+
+  UINT endpoints[2][2][4];
+  for (UINT c = 0; c < 4; c++)
+  {
+    UINT num_bits = c < 3 ? color_bits : alpha_bits;
+    for (UINT s = 0; s < num_subsets; s++)
+    {
+      for (UINT e = 0; e < 2; e++)
+      {
+        endpoints[s][e][c] = reader.Read(num_bits);
+      }
+    }
+  }
+
+  UINT pbits[2][2] = { { 0, 0 }, { 0, 0 } };
+  for (UINT s = 0; s < num_subsets; s++)
+  {
+    if (info[6])
+    {
+      pbits[s][0] = reader.Read(1);
+      pbits[s][1] = reader.Read(1);
+    }
+  }
+  for (UINT s = 0; s < num_subsets; s++)
+  {
+    if (info[7])
+    {
+      pbits[s][0] = pbits[s][1] = reader.Read(1);
+    }
+  }
+
+  bool has_pbits = info[6] || info[7];
+  for (UINT s = 0; s < num_subsets; s++)
+  {
+    for (UINT e = 0; e < 2; e++)
+    {
+      for (UINT c = 0; c < 4; c++)
+      {
+        UINT num_bits = c < 3 ? color_bits : alpha_bits;
+        if (num_bits == 0)
+        {
+          endpoints[s][e][c] = 255;
+          continue;
+        }
+        UINT value = endpoints[s][e][c];
+        if (has_pbits)
+        {
+          value = (value << 1) | pbits[s][e];
+          num_bits++;
+        }
+        value <<= 8 - num_bits;
+        endpoints[s][e][c] = value | (value >> num_bits);
+      }
+    }
+  }
+
+  UINT16 mask   = num_subsets == 2 ? PARTITIONS[partition] : 0;
+  UINT   anchor = num_subsets == 2 ? ANCHORS[partition] : 0;
+  UINT   indices[2][16] = {};
+  UINT   index_bits[2]  = { info[8], info[9] };
+  for (UINT set = 0; set < 2; set++)
+  {
+    if (index_bits[set] == 0)
+    {
+      continue;
+    }
+    for (UINT t = 0; t < 16; t++)
+    {
+      bool is_anchor = t == 0 || (num_subsets == 2 && t == anchor);
+      indices[set][t] = reader.Read(is_anchor ? index_bits[set] - 1 : index_bits[set]);
+    }
+  }
+
+  for (UINT t = 0; t < 16; t++)
+  {
+    UINT subset = (mask >> t) & 1;
+    UINT color_set = index_bits[1] != 0 && index_select ? 1 : 0;
+    UINT alpha_set = index_bits[1] != 0 && !index_select ? 1 : 0;
+    const UINT* color_weights = index_bits[color_set] == 2 ? WEIGHTS_2 : (index_bits[color_set] == 3 ? WEIGHTS_3 : WEIGHTS_4);
+    const UINT* alpha_weights = index_bits[alpha_set] == 2 ? WEIGHTS_2 : (index_bits[alpha_set] == 3 ? WEIGHTS_3 : WEIGHTS_4);
+    for (UINT c = 0; c < 4; c++)
+    {
+      UINT weight = c < 3 ? color_weights[indices[color_set][t]] : alpha_weights[indices[alpha_set][t]];
+      texels[t][c] = (UINT8)(((64 - weight) * endpoints[subset][0][c] + weight * endpoints[subset][1][c] + 32) >> 6);
+    }
+    if (rotation != 0)
+    {
+      UINT8 swap = texels[t][3];
+      texels[t][3] = texels[t][rotation - 1];
+      texels[t][rotation - 1] = swap;
+    }
+  }
+  return mode;
+}
+
+/// <summary>
+/// Decodes a block compressed image into RGBA8 texels
+/// </summary>
+/// <param name="src">
+/// rows of blocks with no padding between them
+/// </param>
+/// <param name="width">
+/// width of the image in texels
+/// </param>
+/// <param name="height">
+/// height of the image in texels
+/// </param>
+/// <param name="format">
+/// BC1, BC3, BC4, BC5 or BC7 format of the blocks.  BC4 fills red and BC5 red and green, with the other channels 0
+/// and alpha 255
+/// </param>
+/// <param name="rgba">
+/// filled in with 4 bytes per texel, with no padding between rows
+/// </param>
+/// <param name="mode_counts">
+/// optional output parameter for the number of BC7 blocks using each mode, with undecodable blocks counted at index 8
+/// </param>
+inline void DecodeFixtureImage(const std::vector<UINT8>& src, UINT width, UINT height, GraphicsDataFormat format,
+  std::vector<UINT8>& rgba, UINT* mode_counts = NULL)
+{
+  bool bc1   = format == BC1_UNORM || format == BC1_UNORM_SRGB;
+  bool bc3   = format == BC3_UNORM || format == BC3_UNORM_SRGB;
+  bool bc7   = format == BC7_UNORM || format == BC7_UNORM_SRGB;
+  UINT bytes = bc1 || format == BC4_UNORM ? 8 : 16;
+  UINT num_blocks_x = (width + 3) / 4;
+  UINT num_blocks_y = (height + 3) / 4;
+
+  rgba.assign((size_t)width * height * 4, 0);
+  for (UINT block_y = 0; block_y < num_blocks_y; block_y++)
+  {
+    for (UINT block_x = 0; block_x < num_blocks_x; block_x++)
+    {
+      const UINT8* block = &src[((size_t)block_y * num_blocks_x + block_x) * bytes];
+      UINT8 texels[16][4];
+      if (bc1)
+      {
+        DecodeFixtureColorBlock(block, true, texels);
+      }
+      else if (bc3)
+      {
+        DecodeFixtureColorBlock(block + 8, false, texels);
+        DecodeFixtureChannelBlock(block, 3, texels);
+      }
+      else if (bc7)
+      {
+        int mode = DecodeFixtureBC7Block(block, texels);
+        if (mode_counts != NULL)
+        {
+          mode_counts[mode < 0 ? 8 : mode]++;
+        }
+      }
+      else
+      {
+        for (UINT t = 0; t < 16; t++)
+        {
+          texels[t][0] = texels[t][1] = texels[t][2] = 0;
+          texels[t][3] = 255;
+        }
+        DecodeFixtureChannelBlock(block, 0, texels);
+        if (format == BC5_UNORM)
+        {
+          DecodeFixtureChannelBlock(block + 8, 1, texels);
+        }
+      }
+
+      for (UINT t = 0; t < 16; t++)
+      {
+        UINT x = block_x * 4 + (t & 3);
+        UINT y = block_y * 4 + (t >> 2);
+        if (x < width && y < height)
+        {
+          UINT8* dst = &rgba[((size_t)y * width + x) * 4];
+          dst[0] = texels[t][0];
+          dst[1] = texels[t][1];
+          dst[2] = texels[t][2];
+          dst[3] = texels[t][3];
+        }
+      }
+    }
+  }
+}
+
+#endif /* BLOCK_DECODER_FIXTURE_H */
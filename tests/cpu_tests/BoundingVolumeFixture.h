@@ -0,0 +1,69 @@
+#ifndef BOUNDING_VOLUME_FIXTURE_H
+#define BOUNDING_VOLUME_FIXTURE_H
+
+#include <windows.h>
+#include <stdint.h>
+#include "Graphics/FrustumCuller.h"
+#include "RandomFixture.h"
+
+/// <summary>
+/// Scatters spheres through a cube around the origin
+/// </summary>
+/// <param name="num">
+/// number of spheres
+/// </param>
+/// <param name="half_size">
+/// half of the width of the cube the centers are in
+/// </param>
+/// <param name="spheres">
+/// filled in with the spheres
+/// </param>
+inline void MakeSphereTable(UINT num, float half_size, BoundingSphereTable& spheres)
+{
+  uint32_t state = 12345;
+  spheres.center_x.resize(num);
+  spheres.center_y.resize(num);
+  spheres.center_z.resize(num);
+  spheres.radius.resize(num);
+  for (UINT i = 0; i < num; i++)
+  {
+    spheres.center_x[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    spheres.center_y[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    spheres.center_z[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    spheres.radius[i]   = 0.1f + NextFixtureRandom(state) * 2;
+  }
+}
+
+/// <summary>
+/// Scatters boxes through a cube around the origin
+/// </summary>
+/// <param name="num">
+/// number of boxes
+/// </param>
+/// <param name="half_size">
+/// half of the width of the cube the centers are in
+/// </param>
+/// <param name="boxes">
+/// filled in with the boxes
+/// </param>
+inline void MakeBoxTable(UINT num, float half_size, BoundingBoxTable& boxes)
+{
+  uint32_t state = 54321;
+  boxes.center_x.resize(num);
+  boxes.center_y.resize(num);
+  boxes.center_z.resize(num);
+  boxes.extent_x.resize(num);
+  boxes.extent_y.resize(num);
+  boxes.extent_z.resize(num);
+  for (UINT i = 0; i < num; i++)
+  {
+    boxes.center_x[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    boxes.center_y[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    boxes.center_z[i] = (NextFixtureRandom(state) * 2 - 1) * half_size;
+    boxes.extent_x[i] = 0.1f + NextFixtureRandom(state) * 2;
+    boxes.extent_y[i] = 0.1f + NextFixtureRandom(state) * 2;
+    boxes.extent_z[i] = 0.1f + NextFixtureRandom(state) * 2;
+  }
+}
+
+#endif /* BOUNDING_VOLUME_FIXTURE_H */
@@ -0,0 +1,77 @@
+#ifndef CAMERA_FIXTURE_H
+#define CAMERA_FIXTURE_H
+
+#include <math.h>
+#include <directxmath.h>
+
+/// <summary>
+/// Builds the same view matrix as XMMatrixLookAtLH, which the Linux stand in for DirectXMath doesn't have
+/// </summary>
+/// <param name="eye">
+/// position of the camera
+/// </param>
+/// <param name="at">
+/// point the camera looks at
+/// </param>
+/// <returns>
+/// view matrix, using the row vector convention of DirectXMath
+/// </returns>
+inline DirectX::XMFLOAT4X4 MakeLookAtLH(const DirectX::XMFLOAT3& eye, const DirectX::XMFLOAT3& at)
+{
+  float z[3] = { at.x - eye.x, at.y - eye.y, at.z - eye.z };
+  float z_len = sqrtf(z[0] * z[0] + z[1] * z[1] + z[2] * z[2]);
+  z[0] /= z_len;
+  z[1] /= z_len;
+  z[2] /= z_len;
+
+  // up is +y, unless the camera looks straight along it
+  float up[3] = { 0, 1, 0 };
+  if (fabsf(z[1]) > 0.999f)
+  {
+    up[1] = 0;
+    up[2] = 1;
+  }
+  float x[3] = { up[1] * z[2] - up[2] * z[1], up[2] * z[0] - up[0] * z[2], up[0] * z[1] - up[1] * z[0] };
+  float x_len = sqrtf(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+  x[0] /= x_len;
+  x[1] /= x_len;
+  x[2] /= x_len;
+  float y[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+
+  return DirectX::XMFLOAT4X4(x[0], y[0], z[0], 0,
+                             x[1], y[1], z[1], 0,
+                             x[2], y[2], z[2], 0,
+                             -(x[0] * eye.x + x[1] * eye.y + x[2] * eye.z),
+                             -(y[0] * eye.x + y[1] * eye.y + y[2] * eye.z),
+                             -(z[0] * eye.x + z[1] * eye.y + z[2] * eye.z), 1);
+}
+
+/// <summary>
+/// Builds the same projection matrix as XMMatrixPerspectiveFovLH
+/// </summary>
+/// <param name="fov_y">
+/// vertical field of view in radians
+/// </param>
+/// <param name="aspect">
+/// width divided by height
+/// </param>
+/// <param name="near_z">
+/// distance to the near plane
+/// </param>
+/// <param name="far_z">
+/// distance to the far plane
+/// </param>
+/// <returns>
+/// projection matrix, using the row vector convention of DirectXMath
+/// </returns>
+inline DirectX::XMFLOAT4X4 MakePerspectiveFovLH(float fov_y, float aspect, float near_z, float far_z)
+{
+  float h     = 1 / tanf(fov_y / 2);
+  float range = far_z / (far_z - near_z);
+  return DirectX::XMFLOAT4X4(h / aspect, 0, 0, 0,
+                             0, h, 0, 0,
+                             0, 0, range, 1,
+                             0, 0, -range * near_z, 0);
+}
+
+#endif /* CAMERA_FIXTURE_H */
@@ -0,0 +1,114 @@
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "FenceFixture.h"
+#include "RandomFixture.h"
+#include "private_inc/DynamicBufferRing.h"
+#include "FrameworkException.h"
+using namespace std;
+
+TEST(DynamicBufferRingKeepsVersionsUpToDateAndOutOfFlight)
+{
+  // versions in plain memory, brought up to date and written the way D3D12_DynamicVertexBuffer does, with the GPU
+  // falling between 0 and 4 frames behind so the CPU sometimes has to wait for it
+  const UINT NUM_VERSIONS = 3;
+  const UINT SIZE         = 64;
+  const UINT NUM_FRAMES   = 2000;
+
+  DynamicBufferRing      ring(NUM_VERSIONS);
+  MockFence              fence;
+  vector<UINT8>          shadow(SIZE, 0);
+  vector<vector<UINT8> > versions(NUM_VERSIONS, shadow);
+  vector<UINT64>         released_by(NUM_VERSIONS, 0);
+  uint32_t               state = 38;
+  UINT                   num_waits  = 0;
+  UINT64                 num_copied = 0;
+
+  for (UINT frame = 0; frame < NUM_FRAMES; frame++)
+  {
+    UINT   previous    = ring.GetCurrent();
+    UINT64 fence_value = fence.Signal();
+    fence.Complete((frame / 11) % 5);
+    released_by[previous] = fence_value;
+    while (!ring.Advance(fence_value, fence.GetCompleted()))
+    {
+      // what WaitOnFence does
+      CHECK(ring.GetCurrent() == previous);
+      fence.Complete(0);
+      num_waits++;
+    }
+
+    // versions are used in ring order, and only once the GPU is done with them
+    UINT current = ring.GetCurrent();
+    CHECK(current == (previous + 1) % NUM_VERSIONS);
+    CHECK(released_by[current] <= fence.GetCompleted());
+
+    DynamicBufferRing::Range stale = ring.TakeStale();
+    if (stale.start < stale.end)
+    {
+      memcpy(&versions[current][stale.start], &shadow[stale.start], stale.end - stale.start);
+      num_copied += stale.end - stale.start;
+    }
+    CHECK(versions[current] == shadow);
+
+    // up to 2 small writes a frame, and none on some frames
+    UINT num_writes = (UINT)(NextFixtureRandom(state) * 3);
+    for (UINT w = 0; w < num_writes; w++)
+    {
+      UINT start = (UINT)(NextFixtureRandom(state) * (SIZE - 8));
+      UINT end   = start + 1 + (UINT)(NextFixtureRandom(state) * 8);
+      for (UINT i = start; i < end; i++)
+      {
+        shadow[i] = (UINT8)(NextFixtureRandom(state) * 256);
+        versions[current][i] = shadow[i];
+      }
+      ring.MarkWritten(start, end);
+    }
+  }
+
+  CHECK(num_waits > 0);
+  CHECK(num_waits < NUM_FRAMES);
+  CHECK(num_copied < (UINT64)NUM_FRAMES * SIZE);
+}
+
+TEST(DynamicBufferRingWaitsForTheGPU)
+{
+  CHECK_THROWS(DynamicBufferRing(0));
+
+  DynamicBufferRing ring(2);
+  CHECK(ring.GetCurrent() == 0);
+  CHECK(ring.GetNumVersions() == 2);
+  ring.MarkWritten(4, 8);
+  ring.MarkWritten(6, 6);
+
+  // version 1 was never used, so it is free right away and picks up the write
+  CHECK(ring.Advance(1, 0));
+  CHECK(ring.GetCurrent() == 1);
+  DynamicBufferRing::Range stale = ring.TakeStale();
+  CHECK(stale.start == 4 && stale.end == 8);
+  stale = ring.TakeStale();
+  CHECK(stale.start >= stale.end);
+
+  // version 0 is released by fence value 1, and the fence value of a call that has to wait is kept for the retries
+  CHECK(!ring.Advance(2, 0));
+  CHECK(ring.GetCurrent() == 1);
+  CHECK(!ring.Advance(3, 0));
+  CHECK(ring.Advance(3, 1));
+  CHECK(ring.GetCurrent() == 0);
+  stale = ring.TakeStale();
+  CHECK(stale.start >= stale.end);
+
+  // writes to version 0 merge into 1 range for version 1, which fence value 2 released
+  ring.MarkWritten(10, 12);
+  ring.MarkWritten(2, 3);
+  CHECK(ring.Advance(4, 2));
+  CHECK(ring.GetCurrent() == 1);
+  stale = ring.TakeStale();
+  CHECK(stale.start == 2 && stale.end == 12);
+
+  // a single version is only reused once the GPU has finished with it
+  DynamicBufferRing single(1);
+  CHECK(!single.Advance(1, 0));
+  CHECK(single.Advance(1, 1));
+  CHECK(single.GetCurrent() == 0);
+}
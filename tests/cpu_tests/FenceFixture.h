@@ -0,0 +1,44 @@
+#ifndef FENCE_FIXTURE_H
+#define FENCE_FIXTURE_H
+
+#include <windows.h>
+
+/// <summary>
+/// Stands in for a GPU fence.  Every submit signals the next value, and the GPU finishes them a few submits late
+/// </summary>
+class MockFence
+{
+  public:
+    MockFence()
+    :m_signaled(0),
+     m_completed(0)
+    {
+    }
+
+    UINT64 Signal()
+    {
+      return ++m_signaled;
+    }
+
+    /// <summary>
+    /// Lets the GPU catch up to within the given number of submits of the CPU
+    /// </summary>
+    void Complete(UINT64 lag)
+    {
+      if (m_signaled > lag && m_signaled - lag > m_completed)
+      {
+        m_completed = m_signaled - lag;
+      }
+    }
+
+    UINT64 GetCompleted() const
+    {
+      return m_completed;
+    }
+
+  private:
+    UINT64 m_signaled;
+    UINT64 m_completed;
+};
+
+#endif /* FENCE_FIXTURE_H */
@@ -0,0 +1,110 @@
+#include <deque>
+#include <vector>
+#include "TestHarness.h"
+#include "FenceFixture.h"
+#include "private_inc/FenceSlotRing.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Slot handed out by the ring along with the fence value it was tagged with
+/// </summary>
+struct InFlightSlot
+{
+  UINT   slot;
+  UINT64 fence_value;
+};
+
+TEST(FenceSlotRingRetiresInOrderOverManyFrames)
+{
+  const UINT NUM_SLOTS  = 3;
+  const UINT NUM_FRAMES = 1000;
+
+  FenceSlotRing       ring(NUM_SLOTS);
+  MockFence           fence;
+  deque<InFlightSlot> in_flight;
+  vector<bool>        in_use(NUM_SLOTS, false);
+  UINT                num_acquired = 0;
+  UINT                num_skipped  = 0;
+  UINT                num_retired  = 0;
+
+  for (UINT frame = 0; frame < NUM_FRAMES; frame++)
+  {
+    // 1 or 2 readbacks a frame, with the GPU falling between 0 and 4 frames behind, so the ring is sometimes empty
+    // and sometimes full
+    UINT num_requests = 1 + (frame % 7 == 0 ? 1 : 0);
+    for (UINT r = 0; r < num_requests; r++)
+    {
+      UINT slot = ring.Acquire();
+      if (slot == FenceSlotRing::NO_SLOT)
+      {
+        CHECK(ring.GetNumInUse() == NUM_SLOTS);
+        num_skipped++;
+        continue;
+      }
+
+      CHECK(slot < NUM_SLOTS);
+      CHECK(!in_use[slot]);
+      in_use[slot] = true;
+      InFlightSlot entry = { slot, 0 };
+      in_flight.push_back(entry);
+      num_acquired++;
+    }
+
+    UINT64 fence_value = fence.Signal();
+    if (ring.GetNumUntagged() > 0)
+    {
+      ring.Tag(fence_value);
+      for (size_t i = 0; i < in_flight.size(); i++)
+      {
+        if (in_flight[i].fence_value == 0)
+        {
+          in_flight[i].fence_value = fence_value;
+        }
+      }
+    }
+    CHECK(ring.GetNumUntagged() == 0);
+
+    fence.Complete((frame / 13) % 5);
+    UINT64 completed = fence.GetCompleted();
+    for (UINT slot = ring.GetRetired(completed); slot != FenceSlotRing::NO_SLOT; slot = ring.GetRetired(completed))
+    {
+      CHECK(!in_flight.empty());
+      CHECK(slot == in_flight.front().slot);
+      CHECK(in_flight.front().fence_value <= completed);
+      in_use[slot] = false;
+      in_flight.pop_front();
+      ring.ReleaseOldest();
+      num_retired++;
+    }
+
+    // anything left is waiting on a fence value the GPU has not reached
+    CHECK(ring.GetNumInUse() == in_flight.size());
+    CHECK(in_flight.empty() || in_flight.front().fence_value > completed);
+  }
+
+  CHECK(num_acquired + num_skipped == NUM_FRAMES + (NUM_FRAMES + 6) / 7);
+  CHECK(num_skipped > 0);
+  CHECK(num_retired + ring.GetNumInUse() == num_acquired);
+}
+
+TEST(FenceSlotRingHoldsUntaggedSlots)
+{
+  FenceSlotRing ring(2);
+  CHECK(ring.Acquire() == 0);
+  CHECK(ring.GetRetired(~(UINT64)0) == FenceSlotRing::NO_SLOT);
+  CHECK_THROWS(ring.ReleaseOldest());
+
+  ring.Tag(5);
+  CHECK(ring.Acquire() == 1);
+  CHECK(ring.Acquire() == FenceSlotRing::NO_SLOT);
+  CHECK(ring.GetRetired(4) == FenceSlotRing::NO_SLOT);
+  CHECK(ring.GetRetired(5) == 0);
+  ring.ReleaseOldest();
+
+  // the second slot was acquired after the tag, so it is not retired by the first slot's fence value
+  CHECK(ring.GetRetired(5) == FenceSlotRing::NO_SLOT);
+  CHECK(ring.Acquire() == 0);
+  ring.Tag(6);
+  CHECK(ring.GetRetired(6) == 1);
+}
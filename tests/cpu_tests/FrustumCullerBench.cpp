@@ -0,0 +1,112 @@
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "BoundingVolumeFixture.h"
+#include "CameraFixture.h"
+#include "private_inc/Threading/ThreadPool.h"
+using namespace std;
+using namespace DirectX;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+BENCHMARK(FrustumCullerSpheresAndBoxes)
+{
+  Frustum frustum(MakeLookAtLH(XMFLOAT3(0, 0, -60), XMFLOAT3(0, 0, 0)), MakePerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+
+  const UINT sizes[] = { 100000, 1000000 };
+  for (UINT s = 0; s < 2; s++)
+  {
+    UINT num = sizes[s];
+    BoundingSphereTable spheres;
+    BoundingBoxTable    boxes;
+    MakeSphereTable(num, 50, spheres);
+    MakeBoxTable(num, 50, boxes);
+    vector<UINT> visible;
+    visible.reserve(num);
+
+    double best_scalar = 1e30;
+    double best_spheres = 1e30;
+    double best_boxes = 1e30;
+    UINT   num_scalar = 0;
+    UINT   num_spheres = 0;
+    for (int run = 0; run < RUNS; run++)
+    {
+      // what a caller without the culler would write: 1 Frustum test per object into the same output list
+      double start = BenchSeconds();
+      visible.clear();
+      for (UINT i = 0; i < num; i++)
+      {
+        if (frustum.IntersectsSphere(XMFLOAT3(spheres.center_x[i], spheres.center_y[i], spheres.center_z[i]), spheres.radius[i]))
+        {
+          visible.push_back(i);
+        }
+      }
+      double scalar = BenchSeconds() - start;
+      best_scalar = scalar < best_scalar ? scalar : best_scalar;
+      num_scalar = (UINT)visible.size();
+
+      start = BenchSeconds();
+      num_spheres = FrustumCuller::CullSpheres(frustum, spheres, visible);
+      double sphere_time = BenchSeconds() - start;
+      best_spheres = sphere_time < best_spheres ? sphere_time : best_spheres;
+
+      start = BenchSeconds();
+      FrustumCuller::CullBoxes(frustum, boxes, visible);
+      double box_time = BenchSeconds() - start;
+      best_boxes = box_time < best_boxes ? box_time : best_boxes;
+    }
+
+    string label = to_string(num) + " objects, ";
+    ReportBenchmark((label + "visible").c_str(), 100.0 * num_spheres / num, "%");
+    ReportBenchmark((label + "scalar Frustum loop").c_str(), best_scalar * 1e3, "ms");
+    ReportBenchmark((label + "CullSpheres").c_str(), best_spheres * 1e3, "ms");
+    ReportBenchmark((label + "CullBoxes").c_str(), best_boxes * 1e3, "ms");
+    ReportBenchmark((label + "CullSpheres speedup").c_str(), best_scalar / best_spheres, "x");
+    CHECK(num_scalar == num_spheres);
+  }
+}
+
+BENCHMARK(FrustumCullerParallelForScaling)
+{
+  // the same per object test split into the culler's chunks on pools of increasing size.  The pools stop scaling at
+  // the number of hardware threads, which is reported with the results
+  const UINT NUM = 1000000;
+  BoundingSphereTable spheres;
+  MakeSphereTable(NUM, 50, spheres);
+  Frustum frustum(MakeLookAtLH(XMFLOAT3(0, 0, -60), XMFLOAT3(0, 0, 0)), MakePerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+  vector<UINT8> flags(NUM);
+
+  ReportBenchmark("hardware threads", thread::hardware_concurrency(), "");
+  double single = 0;
+  const UINT pool_sizes[] = { 1, 2, 4 };
+  for (UINT p = 0; p < 3; p++)
+  {
+    ThreadPool pool(pool_sizes[p]);
+    double best = 1e30;
+    for (int run = 0; run < RUNS; run++)
+    {
+      double start = BenchSeconds();
+      pool.ParallelFor(NUM, FrustumCuller::CHUNK_SIZE, [&](UINT begin, UINT end)
+      {
+        for (UINT i = begin; i < end; i++)
+        {
+          flags[i] = frustum.IntersectsSphere(XMFLOAT3(spheres.center_x[i], spheres.center_y[i], spheres.center_z[i]), spheres.radius[i]);
+        }
+      });
+      double time = BenchSeconds() - start;
+      best = time < best ? time : best;
+    }
+    if (p == 0)
+    {
+      single = best;
+    }
+
+    string label = to_string(pool_sizes[p]) + " worker(s) + caller, ";
+    ReportBenchmark((label + "1M spheres").c_str(), best * 1e3, "ms");
+    ReportBenchmark((label + "speedup over 1 worker").c_str(), single / best, "x");
+  }
+}
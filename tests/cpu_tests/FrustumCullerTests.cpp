@@ -0,0 +1,78 @@
+#include <vector>
+#include "TestHarness.h"
+#include "BoundingVolumeFixture.h"
+#include "CameraFixture.h"
+#include "FrameworkException.h"
+using namespace std;
+using namespace DirectX;
+
+/// <summary>
+/// Frustum looking into the middle of the fixture volumes, so about half of them are visible
+/// </summary>
+static Frustum MakeFixtureFrustum()
+{
+  return Frustum(MakeLookAtLH(XMFLOAT3(0, 0, -60), XMFLOAT3(0, 0, 0)), MakePerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+}
+
+TEST(FrustumCullerSpheresMatchScalarTests)
+{
+  // 2 full chunks and a tail that is not a multiple of the SIMD width, so the work is split across threads and both
+  // the SIMD and scalar paths run
+  const UINT NUM = FrustumCuller::CHUNK_SIZE * 2 + 13;
+  BoundingSphereTable spheres;
+  MakeSphereTable(NUM, 50, spheres);
+  Frustum frustum = MakeFixtureFrustum();
+
+  vector<UINT> expected;
+  for (UINT i = 0; i < NUM; i++)
+  {
+    if (frustum.IntersectsSphere(XMFLOAT3(spheres.center_x[i], spheres.center_y[i], spheres.center_z[i]), spheres.radius[i]))
+    {
+      expected.push_back(i);
+    }
+  }
+  CHECK(expected.size() > NUM / 10 && expected.size() < NUM * 9 / 10);
+
+  vector<UINT> visible(3, 7);
+  UINT num_visible = FrustumCuller::CullSpheres(frustum, spheres, visible);
+  CHECK(num_visible == expected.size());
+  CHECK(visible == expected);
+}
+
+TEST(FrustumCullerBoxesMatchScalarTests)
+{
+  const UINT NUM = FrustumCuller::CHUNK_SIZE * 2 + 13;
+  BoundingBoxTable boxes;
+  MakeBoxTable(NUM, 50, boxes);
+  Frustum frustum = MakeFixtureFrustum();
+
+  vector<UINT> expected;
+  for (UINT i = 0; i < NUM; i++)
+  {
+    if (frustum.IntersectsBox(XMFLOAT3(boxes.center_x[i], boxes.center_y[i], boxes.center_z[i]),
+      XMFLOAT3(boxes.extent_x[i], boxes.extent_y[i], boxes.extent_z[i])))
+    {
+      expected.push_back(i);
+    }
+  }
+  CHECK(expected.size() > NUM / 10 && expected.size() < NUM * 9 / 10);
+
+  vector<UINT> visible;
+  UINT num_visible = FrustumCuller::CullBoxes(frustum, boxes, visible);
+  CHECK(num_visible == expected.size());
+  CHECK(visible == expected);
+}
+
+TEST(FrustumCullerRejectsMismatchedTables)
+{
+  BoundingSphereTable spheres;
+  MakeSphereTable(10, 50, spheres);
+  spheres.radius.pop_back();
+  vector<UINT> visible;
+  CHECK_THROWS(FrustumCuller::CullSpheres(MakeFixtureFrustum(), spheres, visible));
+
+  BoundingBoxTable boxes;
+  MakeBoxTable(10, 50, boxes);
+  boxes.extent_z.pop_back();
+  CHECK_THROWS(FrustumCuller::CullBoxes(MakeFixtureFrustum(), boxes, visible));
+}
@@ -0,0 +1,117 @@
+#ifndef IMAGE_FIXTURE_H
+#define IMAGE_FIXTURE_H
+
+#include <windows.h>
+#include <math.h>
+#include <vector>
+#include "RandomFixture.h"
+
+/// <summary>
+/// Builds an RGBA8 image with the mix of content a photo has: smooth gradients, hard edged shapes, fine detail and a
+/// little noise, so compression and decoding costs and errors are in the range they would be for real textures
+/// </summary>
+/// <param name="width">
+/// width of the image in texels
+/// </param>
+/// <param name="height">
+/// height of the image in texels
+/// </param>
+/// <param name="with_alpha">
+/// true to fill alpha with soft and hard edged shapes
+/// false to make the image opaque
+/// </param>
+/// <param name="rgba">
+/// filled in with 4 bytes per texel, with no padding between rows
+/// </param>
+inline void MakeFixtureImage(UINT width, UINT height, bool with_alpha, std::vector<UINT8>& rgba)
+{
+  rgba.resize((size_t)width * height * 4);
+  uint32_t state = 2024;
+  for (UINT y = 0; y < height; y++)
+  {
+    float v = (float)y / height;
+    for (UINT x = 0; x < width; x++)
+    {
+      float u = (float)x / width;
+      float color[4];
+      color[0] = 0.5f + 0.4f * sinf(u * 6.1f + v * 2.3f);
+      color[1] = 0.5f + 0.4f * sinf(u * 3.7f - v * 5.2f + 1.0f);
+      color[2] = 0.5f + 0.4f * cosf((u - 0.3f) * (v + 0.2f) * 14.0f);
+
+      // a hard edged disc and stripes of fine detail
+      float dx = u - 0.62f;
+      float dy = v - 0.4f;
+      if (dx * dx + dy * dy < 0.04f)
+      {
+        color[0] = 0.9f;
+        color[1] = 0.2f;
+        color[2] = 0.1f;
+      }
+      if (u < 0.25f && v > 0.6f)
+      {
+        float stripe = ((x / 3 + y / 5) & 1) ? 0.15f : -0.15f;
+        color[0] += stripe;
+        color[1] += stripe;
+        color[2] += stripe;
+      }
+
+      color[3] = 1.0f;
+      if (with_alpha)
+      {
+        color[3] = 0.5f + 0.5f * sinf(u * 9.0f) * cosf(v * 7.0f);
+        if (u > 0.75f && v < 0.3f)
+        {
+          color[3] = 0;
+        }
+      }
+
+      UINT8* texel = &rgba[((size_t)y * width + x) * 4];
+      for (UINT c = 0; c < 4; c++)
+      {
+        float noise = c < 3 ? (NextFixtureRandom(state) - 0.5f) * 0.03f : 0;
+        float value = (color[c] + noise) * 255 + 0.5f;
+        texel[c] = (UINT8)(value < 0 ? 0 : (value > 255 ? 255 : value));
+      }
+    }
+  }
+}
+
+/// <summary>
+/// Measures how close 2 RGBA8 images are
+/// </summary>
+/// <param name="a">
+/// first image, 4 bytes per texel
+/// </param>
+/// <param name="b">
+/// second image, the same size as a
+/// </param>
+/// <param name="first_channel">
+/// first channel to compare
+/// </param>
+/// <param name="num_channels">
+/// number of channels to compare, starting at first_channel
+/// </param>
+/// <returns>
+/// peak signal to noise ratio in dB.  100 for identical images
+/// </returns>
+inline double ComputePSNR(const std::vector<UINT8>& a, const std::vector<UINT8>& b, UINT first_channel, UINT num_channels)
+{
+  double sum = 0;
+  size_t count = 0;
+  for (size_t i = 0; i + 3 < a.size() && i + 3 < b.size(); i += 4)
+  {
+    for (UINT c = first_channel; c < first_channel + num_channels; c++)
+    {
+      double diff = (double)a[i + c] - b[i + c];
+      sum += diff * diff;
+      count++;
+    }
+  }
+  if (sum == 0 || count == 0)
+  {
+    return 100;
+  }
+  return 10 * log10(255.0 * 255.0 * count / sum);
+}
+
+#endif /* IMAGE_FIXTURE_H */
@@ -0,0 +1,147 @@
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Buffers/IndexBufferBuilder.h"
+using namespace std;
+
+/// <summary>
+/// Checks that the chunks of a builder cover every index in order, on primitive boundaries, and that every 16bit index
+/// plus the base vertex of its chunk gives back the original index
+/// </summary>
+static bool ChunksRebuildIndices(const IndexBufferBuilder& builder, const vector<UINT>& indices, UINT indices_per_primitive)
+{
+  UINT next_index = 0;
+  for (UINT c = 0; c < builder.GetNumChunks(); c++)
+  {
+    const IndexBufferChunk& chunk = builder.GetChunk(c);
+    if (chunk.first_index != next_index || chunk.num_indices == 0 || chunk.num_indices % indices_per_primitive != 0)
+    {
+      return false;
+    }
+    for (UINT i = chunk.first_index; i < chunk.first_index + chunk.num_indices; i++)
+    {
+      if (indices[i] < chunk.base_vertex || builder.Get16BitData()[i] + chunk.base_vertex != indices[i])
+      {
+        return false;
+      }
+    }
+    next_index += chunk.num_indices;
+  }
+  return next_index == indices.size();
+}
+
+TEST(IndexBufferBuilderFitsIn16Bits)
+{
+  const UINT small[] = { 0, 1, 0xFFFE, 0xFFFF };
+  const UINT large[] = { 0, 1, 0x10000 };
+
+  CHECK(IndexBufferBuilder::FitsIn16Bits(NULL, 0));
+  CHECK(IndexBufferBuilder::FitsIn16Bits(small, 4));
+  CHECK(!IndexBufferBuilder::FitsIn16Bits(large, 3));
+  CHECK(IndexBufferBuilder::FitsIn16Bits(large, 2));
+}
+
+TEST(IndexBufferBuilderKeeps16BitIndicesInOneChunk)
+{
+  const UINT indices[] = { 0, 1, 2, 2, 1, 0xFFFF };
+  IndexBufferBuilder builder(indices, 6);
+
+  CHECK(builder.Is16Bit());
+  CHECK(builder.GetNumIndices() == 6);
+  CHECK(builder.Get32BitData() == NULL);
+  CHECK(builder.GetNumChunks() == 1);
+  CHECK(builder.GetChunk(0).first_index == 0 && builder.GetChunk(0).num_indices == 6 && builder.GetChunk(0).base_vertex == 0);
+  for (UINT i = 0; i < 6; i++)
+  {
+    CHECK(builder.Get16BitData()[i] == indices[i]);
+  }
+  CHECK_THROWS(builder.GetChunk(1));
+}
+
+TEST(IndexBufferBuilderSplitsAtChunkBoundaries)
+{
+  const UINT indices_array[] =
+  {
+    // 0..0xFFFF is exactly the span a 16bit chunk can hold
+    0, 1, 2,
+    0xFFFD, 0xFFFE, 0xFFFF,
+    // 1 past the span starts a new chunk at index 6
+    0x10000, 0x10000, 0x10000,
+    0x10001, 70000, 70001,
+    // lowers the base vertex of the chunk, while the span stays within 16bits
+    60000, 60001, 60002,
+    // too far below the new base vertex, so it starts the third chunk at index 15
+    10, 11, 12,
+    5, 6, 7
+  };
+  const vector<UINT> indices(indices_array, indices_array + sizeof(indices_array) / sizeof(indices_array[0]));
+  IndexBufferBuilder builder(&indices[0], (UINT)indices.size());
+
+  CHECK(builder.Is16Bit());
+  CHECK(builder.Get32BitData() == NULL);
+  CHECK(builder.GetNumChunks() == 3);
+  CHECK(builder.GetChunk(0).first_index == 0 && builder.GetChunk(0).num_indices == 6 && builder.GetChunk(0).base_vertex == 0);
+  CHECK(builder.GetChunk(1).first_index == 6 && builder.GetChunk(1).num_indices == 9 && builder.GetChunk(1).base_vertex == 60000);
+  CHECK(builder.GetChunk(2).first_index == 15 && builder.GetChunk(2).num_indices == 6 && builder.GetChunk(2).base_vertex == 5);
+  CHECK(ChunksRebuildIndices(builder, indices, 3));
+
+  // rebased to the final base vertex of the chunk, not the one it had when the index was added
+  CHECK(builder.Get16BitData()[6] == 0x10000 - 60000);
+  CHECK(builder.Get16BitData()[12] == 0);
+}
+
+TEST(IndexBufferBuilderSplitsLargeMeshes)
+{
+  // a strip of quads over 200000 vertices, as 2 triangles each, with lines of 2 indices over the same vertices
+  vector<UINT> triangles;
+  vector<UINT> lines;
+  for (UINT v = 0; v + 3 < 200000; v += 2)
+  {
+    const UINT quad[] = { v, v + 1, v + 2, v + 2, v + 1, v + 3 };
+    triangles.insert(triangles.end(), quad, quad + 6);
+    lines.push_back(v);
+    lines.push_back(v + 3);
+  }
+
+  IndexBufferBuilder triangle_builder(&triangles[0], (UINT)triangles.size());
+  CHECK(triangle_builder.Is16Bit());
+  CHECK(triangle_builder.GetNumChunks() == 4);
+  CHECK(ChunksRebuildIndices(triangle_builder, triangles, 3));
+
+  IndexBufferBuilder line_builder(&lines[0], (UINT)lines.size(), 2);
+  CHECK(line_builder.Is16Bit());
+  CHECK(line_builder.GetNumChunks() == 4);
+  CHECK(ChunksRebuildIndices(line_builder, lines, 2));
+}
+
+TEST(IndexBufferBuilderFallsBackTo32Bits)
+{
+  // a single triangle spans more than 16bits, so no chunking can help
+  const UINT wide[] = { 0, 1, 2, 0, 70000, 1 };
+  IndexBufferBuilder wide_builder(wide, 6);
+  CHECK(!wide_builder.Is16Bit());
+  CHECK(wide_builder.Get16BitData() == NULL);
+  CHECK(wide_builder.GetNumChunks() == 1);
+  CHECK(wide_builder.GetChunk(0).first_index == 0 && wide_builder.GetChunk(0).num_indices == 6 && wide_builder.GetChunk(0).base_vertex == 0);
+  for (UINT i = 0; i < 6; i++)
+  {
+    CHECK(wide_builder.Get32BitData()[i] == wide[i]);
+  }
+
+  // could be split, but splitting was not allowed
+  const UINT splittable[] = { 0, 1, 2, 70000, 70001, 70002 };
+  IndexBufferBuilder unsplit_builder(splittable, 6, 3, false);
+  CHECK(!unsplit_builder.Is16Bit());
+  CHECK(unsplit_builder.GetNumChunks() == 1);
+  CHECK(unsplit_builder.Get32BitData()[3] == 70000);
+
+  IndexBufferBuilder split_builder(splittable, 6);
+  CHECK(split_builder.Is16Bit());
+  CHECK(split_builder.GetNumChunks() == 2);
+}
+
+TEST(IndexBufferBuilderRejectsPartialPrimitives)
+{
+  const UINT indices[] = { 0, 1, 2, 3 };
+  CHECK_THROWS(IndexBufferBuilder(indices, 4));
+  CHECK_THROWS(IndexBufferBuilder(indices, 4, 0));
+}
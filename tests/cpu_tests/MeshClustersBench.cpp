@@ -0,0 +1,72 @@
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "CameraFixture.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshClusters.h"
+using namespace std;
+using namespace DirectX;
+
+BENCHMARK(MeshClustersBuildAndCull)
+{
+  // a dense sphere, so about half of the clusters face away from any camera outside of it
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeSphereMesh(256, 512, vertices, indices);
+  UINT   num_indices = (UINT)indices.size();
+  double num_tris    = num_indices / 3.0;
+
+  const int BUILD_RUNS = 3;
+  ClusterTable clusters;
+  double best_build = 1e30;
+  for (int run = 0; run < BUILD_RUNS; run++)
+  {
+    double start = BenchSeconds();
+    MeshClusters::Build(&indices[0], num_indices, &vertices[0].pos, sizeof(FixtureMeshVertex), (UINT)vertices.size(), clusters);
+    double build = BenchSeconds() - start;
+    best_build = build < best_build ? build : best_build;
+  }
+  UINT num_clusters = (UINT)clusters.first_index.size();
+
+  ReportBenchmark("triangles", num_tris, "");
+  ReportBenchmark("clusters", num_clusters, "");
+  ReportBenchmark("triangles per cluster", num_tris / num_clusters, "");
+  ReportBenchmark("build", best_build * 1e9 / num_tris, "ns/triangle");
+
+  // the whole sphere in view, then close enough that the frustum only covers part of it
+  XMFLOAT4X4 proj = MakePerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+  const XMFLOAT3 eyes[] = { XMFLOAT3(0, 0, -4), XMFLOAT3(0.5f, 0.3f, -1.3f) };
+  const XMFLOAT3 ats[]  = { XMFLOAT3(0, 0, 0), XMFLOAT3(1, 0.3f, 0) };
+  const char* labels[]  = { "whole sphere in view, ", "close up on the edge, " };
+  for (UINT view = 0; view < 2; view++)
+  {
+    Frustum frustum(MakeLookAtLH(eyes[view], ats[view]), proj);
+    vector<DrawIndexedArgs> draws;
+
+    const int PASSES = 200;
+    UINT num_visible = 0;
+    double best_cull = 1e30;
+    for (int run = 0; run < 3; run++)
+    {
+      double start = BenchSeconds();
+      for (int pass = 0; pass < PASSES; pass++)
+      {
+        num_visible = MeshClusters::Cull(clusters, frustum, eyes[view], draws);
+      }
+      double cull = (BenchSeconds() - start) / PASSES;
+      best_cull = cull < best_cull ? cull : best_cull;
+    }
+
+    UINT num_drawn = 0;
+    for (size_t i = 0; i < draws.size(); i++)
+    {
+      num_drawn += draws[i].indices_per_instance;
+    }
+    string label = labels[view];
+    ReportBenchmark((label + "visible clusters").c_str(), 100.0 * num_visible / num_clusters, "%");
+    ReportBenchmark((label + "triangles submitted").c_str(), 100.0 * num_drawn / num_indices, "%");
+    ReportBenchmark((label + "draws after merging").c_str(), (double)draws.size(), "");
+    ReportBenchmark((label + "cull").c_str(), best_cull * 1e6, "us");
+    ReportBenchmark((label + "cull per cluster").c_str(), best_cull * 1e9 / num_clusters, "ns");
+  }
+}
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <vector>
+#include "TestHarness.h"
+#include "CameraFixture.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshClusters.h"
+using namespace std;
+using namespace DirectX;
+
+TEST(MeshClustersStayWithinTheLimits)
+{
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeSphereMesh(32, 64, vertices, indices);
+
+  ClusterTable clusters;
+  MeshClusters::Build(&indices[0], (UINT)indices.size(), &vertices[0].pos, sizeof(FixtureMeshVertex), (UINT)vertices.size(), clusters);
+
+  // the clusters cover every triangle exactly once, back to back
+  CHECK(clusters.indices.size() == indices.size());
+  UINT next_index = 0;
+  for (size_t c = 0; c < clusters.first_index.size(); c++)
+  {
+    CHECK(clusters.first_index[c] == next_index);
+    CHECK(clusters.num_indices[c] > 0 && clusters.num_indices[c] <= MeshClusters::MAX_TRIANGLES * 3);
+
+    vector<UINT> used(clusters.indices.begin() + clusters.first_index[c],
+      clusters.indices.begin() + clusters.first_index[c] + clusters.num_indices[c]);
+    sort(used.begin(), used.end());
+    CHECK(unique(used.begin(), used.end()) - used.begin() <= (ptrdiff_t)MeshClusters::MAX_VERTICES);
+
+    // every vertex of the cluster is inside its bounding sphere
+    for (UINT i = 0; i < clusters.num_indices[c]; i++)
+    {
+      const XMFLOAT3& pos = vertices[clusters.indices[clusters.first_index[c] + i]].pos;
+      float dx = pos.x - clusters.center_x[c];
+      float dy = pos.y - clusters.center_y[c];
+      float dz = pos.z - clusters.center_z[c];
+      CHECK(dx * dx + dy * dy + dz * dz <= clusters.radius[c] * clusters.radius[c] * 1.0001f);
+    }
+    next_index += clusters.num_indices[c];
+  }
+  CHECK(next_index == indices.size());
+
+  vector<UINT> sorted_in = indices;
+  vector<UINT> sorted_out = clusters.indices;
+  sort(sorted_in.begin(), sorted_in.end());
+  sort(sorted_out.begin(), sorted_out.end());
+  CHECK(sorted_in == sorted_out);
+}
+
+TEST(MeshClustersCullBackfacingAndOutsideClusters)
+{
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeSphereMesh(64, 128, vertices, indices);
+  ClusterTable clusters;
+  MeshClusters::Build(&indices[0], (UINT)indices.size(), &vertices[0].pos, sizeof(FixtureMeshVertex), (UINT)vertices.size(), clusters);
+  UINT num_clusters = (UINT)clusters.first_index.size();
+
+  XMFLOAT4X4 proj = MakePerspectiveFovLH(1.0f, 1.0f, 0.1f, 100.0f);
+  vector<DrawIndexedArgs> draws;
+
+  // from 5 units away 40% of the sphere faces the camera.  Clusters are only culled when none of their triangles can
+  // face it, so somewhat more of them stay visible
+  XMFLOAT3 eye(0, 0, -5);
+  Frustum facing(MakeLookAtLH(eye, XMFLOAT3(0, 0, 0)), proj);
+  UINT num_visible = MeshClusters::Cull(clusters, facing, eye, draws);
+  CHECK(num_visible > num_clusters / 3 && num_visible < num_clusters * 3 / 4);
+
+  // the draws add up to the visible clusters, and don't overlap
+  UINT num_drawn = 0;
+  for (size_t i = 0; i < draws.size(); i++)
+  {
+    CHECK(draws[i].instance_cnt == 1);
+    CHECK(i == 0 || draws[i].index_start_index > draws[i - 1].index_start_index + draws[i - 1].indices_per_instance);
+    num_drawn += draws[i].indices_per_instance;
+  }
+  UINT num_visible_indices = 0;
+  for (UINT c = 0; c < num_clusters; c++)
+  {
+    for (size_t i = 0; i < draws.size(); i++)
+    {
+      if (clusters.first_index[c] >= draws[i].index_start_index &&
+          clusters.first_index[c] < draws[i].index_start_index + draws[i].indices_per_instance)
+      {
+        num_visible_indices += clusters.num_indices[c];
+      }
+    }
+  }
+  CHECK(num_drawn == num_visible_indices);
+
+  // every triangle facing the camera is in a visible cluster
+  for (UINT c = 0; c < num_clusters; c++)
+  {
+    bool drawn = false;
+    for (size_t i = 0; i < draws.size(); i++)
+    {
+      drawn = drawn || (clusters.first_index[c] >= draws[i].index_start_index &&
+                        clusters.first_index[c] < draws[i].index_start_index + draws[i].indices_per_instance);
+    }
+    for (UINT i = clusters.first_index[c]; i < clusters.first_index[c] + clusters.num_indices[c] && !drawn; i += 3)
+    {
+      const XMFLOAT3& p0 = vertices[clusters.indices[i]].pos;
+      const XMFLOAT3& p1 = vertices[clusters.indices[i + 1]].pos;
+      const XMFLOAT3& p2 = vertices[clusters.indices[i + 2]].pos;
+      float u[3] = { p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+      float v[3] = { p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+      float n[3] = { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0] };
+      CHECK(n[0] * (p0.x - eye.x) + n[1] * (p0.y - eye.y) + n[2] * (p0.z - eye.z) >= 0);
+    }
+  }
+
+  // looking away from the sphere, nothing is visible
+  Frustum away(MakeLookAtLH(eye, XMFLOAT3(0, 0, -10)), proj);
+  CHECK(MeshClusters::Cull(clusters, away, eye, draws) == 0);
+  CHECK(draws.empty());
+}
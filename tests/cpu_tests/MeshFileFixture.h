@@ -0,0 +1,65 @@
+#ifndef MESH_FILE_FIXTURE_H
+#define MESH_FILE_FIXTURE_H
+
+#include <vector>
+#include "private_inc/MeshFileFormat.h"
+#include "Graphics/GraphicsDataFormat.h"
+#include "Graphics/Semantics.h"
+
+/// <summary>
+/// Packs a mesh file the way tools/obj_to_mesh does, with position, uv and normal elements and zeroed vertex and
+/// index data
+/// </summary>
+/// <param name="num_vertices">
+/// number of vertices
+/// </param>
+/// <param name="num_indices">
+/// number of indices, split evenly between the submeshes
+/// </param>
+/// <param name="num_submeshes">
+/// number of submeshes
+/// </param>
+/// <returns>
+/// bytes of the file.  The vector's storage is aligned enough for the header
+/// </returns>
+inline std::vector<uint8_t> BuildMeshFile(uint32_t num_vertices, uint32_t num_indices, uint32_t num_submeshes)
+{
+  MeshFileElement position = { SEM_POSITION, 0, R32G32B32_FLOAT, 0, 0 };
+  MeshFileElement uv       = { SEM_TEXCOORD, 0, R32G32_FLOAT,    0, 0 };
+  MeshFileElement normal   = { SEM_NORMAL,   0, R32G32B32_FLOAT, 0, 0 };
+  std::vector<MeshFileElement> elements;
+  elements.push_back(position);
+  elements.push_back(uv);
+  elements.push_back(normal);
+
+  std::vector<MeshFileSubmesh> submeshes(num_submeshes);
+  for (uint32_t i = 0; i < num_submeshes; i++)
+  {
+    submeshes[i].first_index = (uint32_t)((uint64_t)num_indices * i / num_submeshes);
+    submeshes[i].num_indices = (uint32_t)((uint64_t)num_indices * (i + 1) / num_submeshes) - submeshes[i].first_index;
+  }
+
+  std::vector<uint8_t>  vertices((size_t)num_vertices * 32, 0);
+  std::vector<uint32_t> indices(num_indices, 0);
+  std::vector<uint8_t>  file;
+  MeshFileFormat::Pack(elements, vertices.empty() ? NULL : &vertices[0], num_vertices, indices, submeshes, file);
+  return file;
+}
+
+/// <summary>
+/// Gets the header of a mesh file built by BuildMeshFile
+/// </summary>
+inline MeshFileHeader* GetMeshFileHeader(std::vector<uint8_t>& file)
+{
+  return (MeshFileHeader*)&file[0];
+}
+
+/// <summary>
+/// Gets an element description of a mesh file built by BuildMeshFile
+/// </summary>
+inline MeshFileElement* GetMeshFileElement(std::vector<uint8_t>& file, uint32_t index)
+{
+  return (MeshFileElement*)&file[GetMeshFileHeader(file)->elements_offset + index * sizeof(MeshFileElement)];
+}
+
+#endif /* MESH_FILE_FIXTURE_H */
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "TestHarness.h"
+#include "MeshFileFixture.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each load is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Alignment of each upload buffer in the staging memory, the placement alignment of D3D12 buffers
+/// </summary>
+static const size_t STAGING_ALIGNMENT = 65536;
+
+/// <summary>
+/// Read only mapping of a whole file, opened the way D3D12_MeshFile::OpenD3D12 does on Windows
+/// </summary>
+class MappedMeshFile
+{
+  public:
+    MappedMeshFile(const char* path)
+    :m_data(NULL),
+     m_size(0)
+    {
+#ifdef _WIN32
+      m_file    = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+      m_mapping = NULL;
+      LARGE_INTEGER size;
+      if (m_file != INVALID_HANDLE_VALUE && GetFileSizeEx(m_file, &size))
+      {
+        m_size    = (uint64_t)size.QuadPart;
+        m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        m_data    = m_mapping != NULL ? (const uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+      }
+#else
+      m_file = open(path, O_RDONLY);
+      struct stat info;
+      if (m_file >= 0 && fstat(m_file, &info) == 0)
+      {
+        m_size = (uint64_t)info.st_size;
+        void* data = mmap(NULL, (size_t)m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+        m_data = data != MAP_FAILED ? (const uint8_t*)data : NULL;
+      }
+#endif
+    }
+
+    ~MappedMeshFile()
+    {
+#ifdef _WIN32
+      if (m_data != NULL)
+      {
+        UnmapViewOfFile(m_data);
+      }
+      if (m_mapping != NULL)
+      {
+        CloseHandle(m_mapping);
+      }
+      if (m_file != INVALID_HANDLE_VALUE)
+      {
+        CloseHandle(m_file);
+      }
+#else
+      if (m_data != NULL)
+      {
+        munmap((void*)m_data, (size_t)m_size);
+      }
+      if (m_file >= 0)
+      {
+        close(m_file);
+      }
+#endif
+    }
+
+    const uint8_t* GetData() const
+    {
+      return m_data;
+    }
+
+    uint64_t GetSize() const
+    {
+      return m_size;
+    }
+
+  private:
+#ifdef _WIN32
+    HANDLE m_file;
+    HANDLE m_mapping;
+#else
+    int m_file;
+#endif
+    const uint8_t* m_data;
+    uint64_t       m_size;
+};
+
+/// <summary>
+/// Validates a mesh file and copies its vertex and index data into their upload buffers in the staging memory, each
+/// starting on its own STAGING_ALIGNMENT boundary the way separate buffers are placed
+/// </summary>
+/// <returns>
+/// true if the file was valid
+/// </returns>
+static bool StageMeshFile(const uint8_t* data, uint64_t size, vector<uint8_t>& staging)
+{
+  if (data == NULL || MeshFileFormat::Validate(data, size) != NULL)
+  {
+    return false;
+  }
+  const MeshFileHeader* header = (const MeshFileHeader*)data;
+  size_t vertex_bytes = (size_t)header->num_vertices * header->vertex_stride;
+  size_t index_start  = (vertex_bytes + STAGING_ALIGNMENT - 1) / STAGING_ALIGNMENT * STAGING_ALIGNMENT;
+  memcpy(&staging[0], data + header->vertices_offset, vertex_bytes);
+  memcpy(&staging[index_start], data + header->indices_offset, (size_t)header->num_indices * header->index_size);
+  return true;
+}
+
+BENCHMARK(MeshFileLoad)
+{
+  // a detailed mesh with many materials, written to disk and loaded the way MeshFile::OpenD3D12 and
+  // CreateVertexBuffer/CreateIndexBuffer do, against reading the whole file into memory first the way the other
+  // loaders in the framework read their files.  The file was just written, so both read it from the OS file cache
+  const uint32_t NUM_VERTICES  = 1 << 20;
+  const uint32_t NUM_INDICES   = 6 << 20;
+  const uint32_t NUM_SUBMESHES = 256;
+  const char*    PATH          = "MeshFileLoadBench.mesh";
+  vector<uint8_t> file = BuildMeshFile(NUM_VERTICES, NUM_INDICES, NUM_SUBMESHES);
+  {
+    ofstream out(PATH, ios_base::out | ios_base::binary | ios_base::trunc);
+    out.write((const char*)&file[0], file.size());
+  }
+  const MeshFileHeader* header = GetMeshFileHeader(file);
+  size_t vertex_bytes = (size_t)header->num_vertices * header->vertex_stride;
+  size_t index_bytes  = (size_t)header->num_indices * header->index_size;
+  vector<uint8_t> staging((vertex_bytes + STAGING_ALIGNMENT - 1) / STAGING_ALIGNMENT * STAGING_ALIGNMENT + index_bytes, 1);
+
+  double best_mapped = 1e30;
+  double best_read   = 1e30;
+  bool   loaded      = true;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    {
+      MappedMeshFile mapped(PATH);
+      loaded = StageMeshFile(mapped.GetData(), mapped.GetSize(), staging) && loaded;
+    }
+    double time = BenchSeconds() - start;
+    best_mapped = time < best_mapped ? time : best_mapped;
+
+    start = BenchSeconds();
+    {
+      ifstream in(PATH, ios_base::in | ios_base::binary);
+      in.seekg(0, ios_base::end);
+      vector<uint8_t> read((size_t)in.tellg());
+      in.seekg(0, ios_base::beg);
+      in.read((char*)&read[0], read.size());
+      loaded = StageMeshFile(&read[0], read.size(), staging) && loaded;
+    }
+    time = BenchSeconds() - start;
+    best_read = time < best_read ? time : best_read;
+  }
+  remove(PATH);
+  CHECK(loaded);
+  CHECK(staging[0] == 0 && staging[staging.size() - 1] == 0);
+
+  // validation on its own, which only reads the header, elements and submeshes
+  const int VALIDATE_PASSES = 100000;
+  size_t num_valid = 0;
+  double start = BenchSeconds();
+  for (int pass = 0; pass < VALIDATE_PASSES; pass++)
+  {
+    num_valid += MeshFileFormat::Validate(&file[0], file.size()) == NULL;
+  }
+  double validate = (BenchSeconds() - start) / VALIDATE_PASSES;
+  CHECK(num_valid == (size_t)VALIDATE_PASSES);
+
+  double gb = file.size() / 1e9;
+  ReportBenchmark("file size", file.size() / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("map + validate + stage", best_mapped * 1e3, "ms");
+  ReportBenchmark("map + validate + stage", gb / best_mapped, "GB/s");
+  ReportBenchmark("ifstream read + validate + stage", best_read * 1e3, "ms");
+  ReportBenchmark("ifstream read + validate + stage", gb / best_read, "GB/s");
+  ReportBenchmark("validate, 3 elements + 256 submeshes", validate * 1e9, "ns");
+}
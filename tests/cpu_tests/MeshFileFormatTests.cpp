@@ -0,0 +1,163 @@
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "MeshFileFixture.h"
+#include "FrameworkException.h"
+using namespace std;
+
+TEST(MeshFileFormatAcceptsObjToMeshLayout)
+{
+  vector<uint8_t> file = BuildMeshFile(100, 300, 3);
+  CHECK(MeshFileFormat::Validate(&file[0], file.size()) == NULL);
+
+  // more than 64k vertices switches to 32 bit indices
+  file = BuildMeshFile(70000, 30, 1);
+  CHECK(GetMeshFileHeader(file)->index_size == 4);
+  CHECK(MeshFileFormat::Validate(&file[0], file.size()) == NULL);
+}
+
+TEST(MeshFileFormatRejectsBadHeaders)
+{
+  vector<uint8_t> file = BuildMeshFile(100, 300, 3);
+  CHECK(MeshFileFormat::Validate(&file[0], sizeof(MeshFileHeader) - 1) != NULL);
+  CHECK(MeshFileFormat::Validate(&file[0], file.size() - 1) != NULL);
+
+  vector<uint8_t> bad = file;
+  GetMeshFileHeader(bad)->magic++;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  GetMeshFileHeader(bad)->version++;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  GetMeshFileHeader(bad)->index_size = 1;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  GetMeshFileHeader(bad)->vertices_offset += 4;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  GetMeshFileHeader(bad)->num_vertices = 0xFFFFFFFF;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  MeshFileSubmesh* last = (MeshFileSubmesh*)&bad[GetMeshFileHeader(bad)->submeshes_offset + 2 * sizeof(MeshFileSubmesh)];
+  last->num_indices++;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+}
+
+TEST(MeshFileFormatChecksElementFormatsAgainstTheirSizes)
+{
+  vector<uint8_t> file = BuildMeshFile(100, 300, 1);
+
+  // a uv declared as 3 floats, which would shift where the normal is read from
+  vector<uint8_t> bad = file;
+  GetMeshFileElement(bad, 1)->format = R32G32B32_FLOAT;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  // formats a vertex can't hold
+  const uint32_t unsupported[] = { BC1_UNORM, D32_FLOAT, R8G8_UNORM, 0, 12345 };
+  for (size_t i = 0; i < sizeof(unsupported) / sizeof(unsupported[0]); i++)
+  {
+    bad = file;
+    GetMeshFileElement(bad, 2)->format = unsupported[i];
+    CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+  }
+
+  // a smaller format with a matching size is fine as long as the stride still adds up
+  bad = file;
+  GetMeshFileElement(bad, 2)->format = R10G10B10A2_UNORM;
+  GetMeshFileElement(bad, 2)->size   = 4;
+  GetMeshFileHeader(bad)->vertex_stride = 24;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) == NULL);
+
+  // elements must be packed in order and fill the stride
+  bad = file;
+  GetMeshFileElement(bad, 1)->byte_offset = 16;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+  bad = file;
+  GetMeshFileHeader(bad)->vertex_stride = 36;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  CHECK(MeshFileFormat::GetElementSize(R32G32B32A32_FLOAT) == 16);
+  CHECK(MeshFileFormat::GetElementSize(R16G16_FLOAT) == 4);
+  CHECK(MeshFileFormat::GetElementSize(BC7_UNORM) == 0);
+}
+
+TEST(MeshFileFormatRejectsUnknownSemantics)
+{
+  // the semantic is handed to GetSemanticName when the input layout is built, which indexes its name table with it
+  vector<uint8_t> file = BuildMeshFile(100, 300, 1);
+  vector<uint8_t> bad = file;
+  GetMeshFileElement(bad, 2)->semantic = SEM_SV_VERTEXID + 1;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+  GetMeshFileElement(bad, 2)->semantic = 0xFFFFFFFF;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) != NULL);
+
+  bad = file;
+  GetMeshFileElement(bad, 2)->semantic = SEM_SV_VERTEXID;
+  CHECK(MeshFileFormat::Validate(&bad[0], bad.size()) == NULL);
+  CHECK_THROWS(GetSemanticName((Semantics)(SEM_SV_VERTEXID + 1)));
+}
+
+TEST(MeshFileFormatPacksWhatValidateAccepts)
+{
+  // 2 triangles sharing an edge, each its own submesh, with a uv after the position
+  const float vertices[] =
+  {
+    -1, 2, 3,    0, 0,
+     4, 0, -2,   1, 0,
+     0, -5, 1,   0, 1,
+     2, 7, 0,    1, 1
+  };
+  vector<MeshFileElement> elements(2);
+  elements[0].semantic = SEM_POSITION;
+  elements[0].semantic_index = 0;
+  elements[0].format = R32G32B32_FLOAT;
+  elements[1].semantic = SEM_TEXCOORD;
+  elements[1].semantic_index = 0;
+  elements[1].format = R32G32_FLOAT;
+  const uint32_t triangles[] = { 0, 1, 2, 2, 1, 3 };
+  vector<uint32_t> indices(triangles, triangles + 6);
+  vector<MeshFileSubmesh> submeshes(2);
+  submeshes[0].first_index = 0;
+  submeshes[0].num_indices = 3;
+  submeshes[1].first_index = 3;
+  submeshes[1].num_indices = 3;
+
+  vector<uint8_t> file;
+  CHECK(MeshFileFormat::Pack(elements, vertices, 4, indices, submeshes, file) == NULL);
+  CHECK(MeshFileFormat::Validate(&file[0], file.size()) == NULL);
+
+  const MeshFileHeader* header = GetMeshFileHeader(file);
+  CHECK(header->vertex_stride == 20);
+  CHECK(header->index_size == 2);
+  CHECK(GetMeshFileElement(file, 1)->byte_offset == 12 && GetMeshFileElement(file, 1)->size == 8);
+  CHECK(memcmp(&file[header->vertices_offset], vertices, sizeof(vertices)) == 0);
+  const uint16_t* packed = (const uint16_t*)&file[header->indices_offset];
+  CHECK(packed[0] == 0 && packed[3] == 2 && packed[5] == 3);
+
+  // bounds of each submesh only cover its own triangles, and the mesh covers both
+  const MeshFileSubmesh* packed_submeshes = (const MeshFileSubmesh*)&file[header->submeshes_offset];
+  CHECK(packed_submeshes[0].bounds_min[0] == -1 && packed_submeshes[0].bounds_min[1] == -5 && packed_submeshes[0].bounds_min[2] == -2);
+  CHECK(packed_submeshes[0].bounds_max[0] == 4 && packed_submeshes[0].bounds_max[1] == 2 && packed_submeshes[0].bounds_max[2] == 3);
+  CHECK(packed_submeshes[1].bounds_min[0] == 0 && packed_submeshes[1].bounds_max[1] == 7 && packed_submeshes[1].bounds_max[2] == 1);
+  CHECK(header->bounds_min[1] == -5 && header->bounds_max[1] == 7 && header->bounds_max[2] == 3);
+
+  // problems Validate would reject leave the file empty
+  vector<uint32_t> bad_indices = indices;
+  bad_indices[4] = 4;
+  CHECK(MeshFileFormat::Pack(elements, vertices, 4, bad_indices, submeshes, file) != NULL);
+  CHECK(file.empty());
+  vector<MeshFileSubmesh> bad_submeshes = submeshes;
+  bad_submeshes[1].num_indices = 4;
+  CHECK(MeshFileFormat::Pack(elements, vertices, 4, indices, bad_submeshes, file) != NULL);
+  vector<MeshFileElement> bad_elements = elements;
+  bad_elements[1].semantic = SEM_SV_VERTEXID + 1;
+  CHECK(MeshFileFormat::Pack(bad_elements, vertices, 4, indices, submeshes, file) != NULL);
+  bad_elements = elements;
+  bad_elements[1].format = BC1_UNORM;
+  CHECK(MeshFileFormat::Pack(bad_elements, vertices, 4, indices, submeshes, file) != NULL);
+}
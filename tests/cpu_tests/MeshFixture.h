@@ -0,0 +1,172 @@
+#ifndef MESH_FIXTURE_H
+#define MESH_FIXTURE_H
+
+#include <windows.h>
+#include <math.h>
+#include <stddef.h>
+#include <vector>
+#include <directxmath.h>
+#include "Graphics/Mesh/MeshSimplifier.h"
+
+/// <summary>
+/// Vertex of the fixture meshes, laid out like the framework's position, texture coordinate and normal vertices
+/// </summary>
+struct FixtureMeshVertex
+{
+  DirectX::XMFLOAT3 pos;
+  DirectX::XMFLOAT2 uv;
+  DirectX::XMFLOAT3 normal;
+};
+
+/// <summary>
+/// Builds a square grid of quads spanning -1 to 1 in the xz plane, gently curved in y so neighbouring triangles are not
+/// coplanar
+/// </summary>
+/// <param name="size">
+/// number of quads along each side
+/// </param>
+/// <param name="height">
+/// amplitude of the curve in y.  0 gives a flat grid
+/// </param>
+/// <param name="vertices">
+/// filled in with (size + 1) squared vertices, row by row
+/// </param>
+/// <param name="indices">
+/// filled in with 2 triangles per quad, row by row
+/// </param>
+inline void MakeGridMesh(UINT size, std::vector<FixtureMeshVertex>& vertices, std::vector<UINT>& indices, float height = 0.25f)
+{
+  vertices.resize((size + 1) * (size + 1));
+  for (UINT z = 0; z <= size; z++)
+  {
+    for (UINT x = 0; x <= size; x++)
+    {
+      FixtureMeshVertex& vertex = vertices[z * (size + 1) + x];
+      float u = (float)x / size;
+      float v = (float)z / size;
+      vertex.pos    = DirectX::XMFLOAT3(u * 2 - 1, height * sinf(u * 3.0f) * cosf(v * 2.0f), v * 2 - 1);
+      vertex.uv     = DirectX::XMFLOAT2(u, v);
+      vertex.normal = DirectX::XMFLOAT3(0, 1, 0);
+    }
+  }
+
+  indices.clear();
+  indices.reserve(size * size * 6);
+  for (UINT z = 0; z < size; z++)
+  {
+    for (UINT x = 0; x < size; x++)
+    {
+      UINT corner = z * (size + 1) + x;
+      indices.push_back(corner);
+      indices.push_back(corner + size + 1);
+      indices.push_back(corner + 1);
+      indices.push_back(corner + 1);
+      indices.push_back(corner + size + 1);
+      indices.push_back(corner + size + 2);
+    }
+  }
+}
+
+/// <summary>
+/// Builds a unit sphere centered on the origin out of rings of quads, with triangles facing outwards
+/// </summary>
+/// <param name="rings">
+/// number of rings of quads from pole to pole
+/// </param>
+/// <param name="segments">
+/// number of quads around each ring
+/// </param>
+/// <param name="vertices">
+/// filled in with (rings + 1) * (segments + 1) vertices, ring by ring
+/// </param>
+/// <param name="indices">
+/// filled in with 2 triangles per quad, ring by ring.  The quads at the poles have a degenerate triangle
+/// </param>
+inline void MakeSphereMesh(UINT rings, UINT segments, std::vector<FixtureMeshVertex>& vertices, std::vector<UINT>& indices)
+{
+  const float PI = 3.14159265f;
+  vertices.resize((rings + 1) * (segments + 1));
+  for (UINT r = 0; r <= rings; r++)
+  {
+    float polar = PI * r / rings;
+    for (UINT s = 0; s <= segments; s++)
+    {
+      float azimuth = 2 * PI * s / segments;
+      FixtureMeshVertex& vertex = vertices[r * (segments + 1) + s];
+      vertex.pos    = DirectX::XMFLOAT3(sinf(polar) * cosf(azimuth), cosf(polar), sinf(polar) * sinf(azimuth));
+      vertex.uv     = DirectX::XMFLOAT2((float)s / segments, (float)r / rings);
+      vertex.normal = vertex.pos;
+    }
+  }
+
+  indices.clear();
+  indices.reserve(rings * segments * 6);
+  for (UINT r = 0; r < rings; r++)
+  {
+    for (UINT s = 0; s < segments; s++)
+    {
+      UINT corner = r * (segments + 1) + s;
+      indices.push_back(corner);
+      indices.push_back(corner + 1);
+      indices.push_back(corner + segments + 1);
+      indices.push_back(corner + 1);
+      indices.push_back(corner + segments + 2);
+      indices.push_back(corner + segments + 1);
+    }
+  }
+}
+
+/// <summary>
+/// Shuffles the triangles of a triangle list with a fixed seed, which is what an exporter that ignores the vertex cache
+/// produces in the worst case
+/// </summary>
+/// <param name="indices">
+/// triangle list indices to shuffle in place
+/// </param>
+inline void ShuffleTriangles(std::vector<UINT>& indices)
+{
+  UINT num_tris = (UINT)indices.size() / 3;
+  UINT state    = 12345;
+  for (UINT i = num_tris; i > 1; i--)
+  {
+    state = state * 1664525 + 1013904223;
+    UINT j = (state >> 8) % i;
+    for (UINT k = 0; k < 3; k++)
+    {
+      UINT temp = indices[(i - 1) * 3 + k];
+      indices[(i - 1) * 3 + k] = indices[j * 3 + k];
+      indices[j * 3 + k] = temp;
+    }
+  }
+}
+
+/// <summary>
+/// Describes the fixture mesh vertices to the mesh simplifier
+/// </summary>
+/// <param name="vertices">
+/// vertices of the mesh
+/// </param>
+/// <param name="uv_weight">
+/// weight of the uvs, or 0 to leave them out
+/// </param>
+/// <param name="normal_weight">
+/// weight of the normals, or 0 to leave them out
+/// </param>
+/// <returns>
+/// layout of the vertices
+/// </returns>
+inline SimplifierVertexLayout MakeFixtureLayout(const std::vector<FixtureMeshVertex>& vertices, float uv_weight, float normal_weight)
+{
+  SimplifierVertexLayout layout;
+  layout.vertices        = &vertices[0];
+  layout.num_vertices    = (UINT)vertices.size();
+  layout.stride          = sizeof(FixtureMeshVertex);
+  layout.position_offset = offsetof(FixtureMeshVertex, pos);
+  layout.uv_offset       = uv_weight > 0 ? offsetof(FixtureMeshVertex, uv) : SIMPLIFIER_ATTRIBUTE_NONE;
+  layout.normal_offset   = normal_weight > 0 ? offsetof(FixtureMeshVertex, normal) : SIMPLIFIER_ATTRIBUTE_NONE;
+  layout.uv_weight       = uv_weight;
+  layout.normal_weight   = normal_weight;
+  return layout;
+}
+
+#endif /* MESH_FIXTURE_H */
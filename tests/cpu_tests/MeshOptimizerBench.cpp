@@ -0,0 +1,69 @@
+#include <vector>
+#include "TestHarness.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshOptimizer.h"
+using namespace std;
+
+BENCHMARK(MeshOptimizerStages)
+{
+  // a dense mesh with shuffled triangles, about the size of a detailed character or prop
+  const UINT GRID_SIZE = 256;
+  vector<FixtureMeshVertex> source_vertices;
+  vector<UINT> source_indices;
+  MakeGridMesh(GRID_SIZE, source_vertices, source_indices);
+  ShuffleTriangles(source_indices);
+  UINT num_indices = (UINT)source_indices.size();
+
+  // best of a few runs, since each stage is timed once per run
+  const int RUNS = 5;
+  double best_cache = 1e30, best_overdraw = 1e30, best_fetch = 1e30;
+  VertexCacheStats before = { 0, 0 }, after_cache = { 0, 0 }, after = { 0, 0 };
+  for (int run = 0; run < RUNS; run++)
+  {
+    vector<FixtureMeshVertex> vertices = source_vertices;
+    vector<UINT> indices = source_indices;
+    UINT num_vertices = (UINT)vertices.size();
+    before = MeshOptimizer::AnalyzeVertexCache(&indices[0], num_indices, num_vertices);
+
+    double start = BenchSeconds();
+    MeshOptimizer::OptimizeVertexCache(&indices[0], num_indices, num_vertices);
+    double cache = BenchSeconds() - start;
+    after_cache = MeshOptimizer::AnalyzeVertexCache(&indices[0], num_indices, num_vertices);
+
+    start = BenchSeconds();
+    MeshOptimizer::OptimizeOverdraw(&indices[0], num_indices, &vertices[0].pos, sizeof(FixtureMeshVertex), num_vertices);
+    double overdraw = BenchSeconds() - start;
+
+    start = BenchSeconds();
+    num_vertices = MeshOptimizer::OptimizeVertexFetch(&vertices[0], num_vertices, sizeof(FixtureMeshVertex), &indices[0], num_indices);
+    double fetch = BenchSeconds() - start;
+    after = MeshOptimizer::AnalyzeVertexCache(&indices[0], num_indices, num_vertices);
+    CHECK(num_vertices == source_vertices.size());
+
+    best_cache    = cache < best_cache ? cache : best_cache;
+    best_overdraw = overdraw < best_overdraw ? overdraw : best_overdraw;
+    best_fetch    = fetch < best_fetch ? fetch : best_fetch;
+  }
+
+  const int ANALYZE_PASSES = 20;
+  double start = BenchSeconds();
+  float sum = 0;
+  for (int pass = 0; pass < ANALYZE_PASSES; pass++)
+  {
+    sum += MeshOptimizer::AnalyzeVertexCache(&source_indices[0], num_indices, (UINT)source_vertices.size()).acmr;
+  }
+  double analyze = (BenchSeconds() - start) / ANALYZE_PASSES;
+  CHECK(sum > 0);
+
+  double num_tris = num_indices / 3.0;
+  ReportBenchmark("triangles", num_tris, "");
+  ReportBenchmark("ACMR as provided", before.acmr, "");
+  ReportBenchmark("ACMR after vertex cache", after_cache.acmr, "");
+  ReportBenchmark("ACMR after overdraw and fetch", after.acmr, "");
+  ReportBenchmark("ATVR as provided", before.atvr, "");
+  ReportBenchmark("ATVR after", after.atvr, "");
+  ReportBenchmark("vertex cache", best_cache * 1e9 / num_tris, "ns/triangle");
+  ReportBenchmark("overdraw", best_overdraw * 1e9 / num_tris, "ns/triangle");
+  ReportBenchmark("vertex fetch", best_fetch * 1e9 / num_tris, "ns/triangle");
+  ReportBenchmark("analyze", analyze * 1e9 / num_tris, "ns/triangle");
+}
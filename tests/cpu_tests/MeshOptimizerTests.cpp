@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <vector>
+#include "TestHarness.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshOptimizer.h"
+using namespace std;
+
+/// <summary>
+/// Gets the triangles of a mesh as sorted corner keys, in sorted order, so meshes can be compared regardless of the
+/// order of their triangles, corners or vertices
+/// </summary>
+static vector<vector<UINT> > SortedTriangles(const vector<UINT>& indices, const vector<FixtureMeshVertex>& vertices)
+{
+  vector<vector<UINT> > tris;
+  for (size_t i = 0; i < indices.size(); i += 3)
+  {
+    // identify corners by texture coordinate, which is unique per grid vertex and survives the vertex remap
+    vector<UINT> tri(3);
+    for (UINT k = 0; k < 3; k++)
+    {
+      const FixtureMeshVertex& vertex = vertices[indices[i + k]];
+      tri[k] = (UINT)(vertex.uv.x * 1000 + 0.5f) * 10000 + (UINT)(vertex.uv.y * 1000 + 0.5f);
+    }
+    sort(tri.begin(), tri.end());
+    tris.push_back(tri);
+  }
+  sort(tris.begin(), tris.end());
+  return tris;
+}
+
+TEST(MeshOptimizerAnalyzesACachelessMesh)
+{
+  // every triangle uses new vertices, so every vertex is a miss
+  const UINT indices[] = { 0, 1, 2, 3, 4, 5 };
+  VertexCacheStats stats = MeshOptimizer::AnalyzeVertexCache(indices, 6, 6);
+  CHECK_CLOSE(stats.acmr, 3.0, 1e-6);
+  CHECK_CLOSE(stats.atvr, 1.0, 1e-6);
+
+  // a quad shares 2 of its 4 vertices
+  const UINT quad[] = { 0, 1, 2, 2, 1, 3 };
+  stats = MeshOptimizer::AnalyzeVertexCache(quad, 6, 4);
+  CHECK_CLOSE(stats.acmr, 2.0, 1e-6);
+  CHECK_CLOSE(stats.atvr, 1.0, 1e-6);
+}
+
+TEST(MeshOptimizerRejectsOutOfRangeIndices)
+{
+  const UINT indices[] = { 0, 1, 2, 2, 1, 4 };
+  vector<UINT> copy(indices, indices + 6);
+
+  CHECK_THROWS(MeshOptimizer::AnalyzeVertexCache(indices, 6, 4));
+  CHECK_THROWS(MeshOptimizer::AnalyzeVertexCache(indices, 5, 5));
+  CHECK_THROWS(MeshOptimizer::AnalyzeVertexCache(indices, 6, 5, 0));
+  CHECK_THROWS(MeshOptimizer::OptimizeVertexCache(&copy[0], 6, 4));
+  CHECK_THROWS(MeshOptimizer::OptimizeVertexFetch(NULL, 4, 12, &copy[0], 6));
+  CHECK(copy == vector<UINT>(indices, indices + 6));
+}
+
+TEST(MeshOptimizerImprovesAShuffledGrid)
+{
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeGridMesh(32, vertices, indices);
+  ShuffleTriangles(indices);
+  vector<vector<UINT> > expected = SortedTriangles(indices, vertices);
+  UINT num_vertices = (UINT)vertices.size();
+
+  MeshOptimizationReport report = MeshOptimizer::Optimize(vertices, indices);
+
+  // a 16 entry FIFO can't reach the 0.5 limit of an infinite grid, but it comes well under 1
+  CHECK(report.before.acmr > 2.0f);
+  CHECK(report.after.acmr < 0.9f);
+  CHECK(report.after.atvr < report.before.atvr);
+  CHECK(vertices.size() == num_vertices);
+  CHECK(SortedTriangles(indices, vertices) == expected);
+
+  // after the fetch remap every vertex is first used in order
+  UINT next_new = 0;
+  for (size_t i = 0; i < indices.size(); i++)
+  {
+    CHECK(indices[i] <= next_new);
+    if (indices[i] == next_new)
+    {
+      next_new++;
+    }
+  }
+  CHECK(next_new == vertices.size());
+}
+
+TEST(MeshOptimizerKeepsOverdrawSortingWithinTheThreshold)
+{
+  // a grid and a sphere, cache optimized, then sorted at thresholds from keeping the ACMR to giving up half of it
+  vector<FixtureMeshVertex> grid_vertices, sphere_vertices;
+  vector<UINT> grid_indices, sphere_indices;
+  MakeGridMesh(64, grid_vertices, grid_indices);
+  MakeSphereMesh(48, 64, sphere_vertices, sphere_indices);
+  const vector<FixtureMeshVertex>* vertices[] = { &grid_vertices, &sphere_vertices };
+  vector<UINT>* meshes[] = { &grid_indices, &sphere_indices };
+  const float thresholds[] = { 1.0f, 1.05f, 1.5f };
+
+  for (UINT m = 0; m < 2; m++)
+  {
+    vector<UINT>& source       = *meshes[m];
+    UINT          num_indices  = (UINT)source.size();
+    UINT          num_vertices = (UINT)vertices[m]->size();
+    ShuffleTriangles(source);
+    MeshOptimizer::OptimizeVertexCache(&source[0], num_indices, num_vertices);
+    float input_acmr = MeshOptimizer::AnalyzeVertexCache(&source[0], num_indices, num_vertices).acmr;
+
+    // triangles are moved whole, so their corners stay in order
+    vector<vector<UINT> > expected;
+    for (UINT i = 0; i < num_indices; i += 3)
+    {
+      expected.push_back(vector<UINT>(&source[i], &source[i] + 3));
+    }
+    sort(expected.begin(), expected.end());
+
+    for (UINT t = 0; t < 3; t++)
+    {
+      vector<UINT> indices = source;
+      MeshOptimizer::OptimizeOverdraw(&indices[0], num_indices, &(*vertices[m])[0].pos, sizeof(FixtureMeshVertex), num_vertices,
+        thresholds[t]);
+      CHECK(MeshOptimizer::AnalyzeVertexCache(&indices[0], num_indices, num_vertices).acmr <= input_acmr * thresholds[t]);
+
+      vector<vector<UINT> > actual;
+      for (UINT i = 0; i < num_indices; i += 3)
+      {
+        actual.push_back(vector<UINT>(&indices[i], &indices[i] + 3));
+      }
+      sort(actual.begin(), actual.end());
+      CHECK(actual == expected);
+
+      // a loose threshold leaves room to sort, so the order must change
+      if (thresholds[t] == 1.5f)
+      {
+        CHECK(indices != source);
+      }
+    }
+  }
+}
+
+TEST(MeshOptimizerDropsUnreferencedVertices)
+{
+  float vertices[] = { 10, 11, 12, 13, 14 };
+  UINT indices[] = { 4, 2, 0, 0, 2, 4 };
+
+  UINT num_used = MeshOptimizer::OptimizeVertexFetch(vertices, 5, sizeof(float), indices, 6);
+
+  CHECK(num_used == 3);
+  CHECK(vertices[0] == 14 && vertices[1] == 12 && vertices[2] == 10);
+  const UINT expected[] = { 0, 1, 2, 2, 1, 0 };
+  CHECK(vector<UINT>(indices, indices + 6) == vector<UINT>(expected, expected + 6));
+}
@@ -0,0 +1,66 @@
+#include <float.h>
+#include <vector>
+#include "TestHarness.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshSimplifier.h"
+using namespace std;
+
+BENCHMARK(MeshSimplifierSimplifyAndLODs)
+{
+  const UINT GRID_SIZE = 128;
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeGridMesh(GRID_SIZE, vertices, indices);
+  UINT num_indices = (UINT)indices.size();
+  double num_tris  = num_indices / 3.0;
+
+  // errors are reported as a percentage of the grid's width of 2 units, which is also what the attribute quadric error
+  // is relative to
+  const double PERCENT_PER_UNIT = 100 / 2.0;
+
+  SimplifierVertexLayout position_only = MakeFixtureLayout(vertices, 0, 0);
+  SimplifierVertexLayout with_attributes = MakeFixtureLayout(vertices, 1, 1);
+
+  // best of a few runs, since each one takes a while
+  const int RUNS = 3;
+  vector<UINT> simplified(num_indices);
+  double best_position = 1e30, best_attributes = 1e30, best_lods = 1e30;
+  UINT   num_position = 0, num_attributes = 0;
+  float  position_error = 0, attribute_error = 0, attribute_quadric_error = 0;
+  vector<UINT> lod_indices;
+  vector<MeshLOD> lods;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    num_position = MeshSimplifier::Simplify(&indices[0], num_indices, position_only, num_indices / 4, FLT_MAX, &simplified[0],
+      &position_error);
+    double position = BenchSeconds() - start;
+
+    start = BenchSeconds();
+    num_attributes = MeshSimplifier::Simplify(&indices[0], num_indices, with_attributes, num_indices / 4, FLT_MAX, &simplified[0],
+      &attribute_error, &attribute_quadric_error);
+    double attributes = BenchSeconds() - start;
+
+    start = BenchSeconds();
+    MeshSimplifier::GenerateLODs(&indices[0], num_indices, with_attributes, 6, 0.5f, 0.05f, lod_indices, lods);
+    double lod_time = BenchSeconds() - start;
+
+    best_position   = position < best_position ? position : best_position;
+    best_attributes = attributes < best_attributes ? attributes : best_attributes;
+    best_lods       = lod_time < best_lods ? lod_time : best_lods;
+  }
+  CHECK(num_position > 0 && num_attributes > 0 && !lods.empty());
+
+  ReportBenchmark("input triangles", num_tris, "");
+  ReportBenchmark("to 25%, position only", best_position * 1e3, "ms");
+  ReportBenchmark("  throughput", num_tris / best_position / 1e6, "Mtri/s");
+  ReportBenchmark("  position error", position_error * PERCENT_PER_UNIT, "% of size");
+  ReportBenchmark("to 25%, uv + normal", best_attributes * 1e3, "ms");
+  ReportBenchmark("  throughput", num_tris / best_attributes / 1e6, "Mtri/s");
+  ReportBenchmark("  position error", attribute_error * PERCENT_PER_UNIT, "% of size");
+  ReportBenchmark("  attribute quadric error", attribute_quadric_error * 100, "% of size");
+  ReportBenchmark("6 LODs at half each, uv + normal", best_lods * 1e3, "ms");
+  ReportBenchmark("  levels generated", (double)lods.size(), "");
+  ReportBenchmark("  last level triangles", lods.back().num_indices / 3.0, "");
+  ReportBenchmark("  last level error", lods.back().error * PERCENT_PER_UNIT, "% of size");
+}
@@ -0,0 +1,105 @@
+#include <float.h>
+#include <math.h>
+#include <vector>
+#include "TestHarness.h"
+#include "MeshFixture.h"
+#include "Graphics/Mesh/MeshSimplifier.h"
+using namespace std;
+using namespace DirectX;
+
+TEST(MeshSimplifierIgnoresAttributesInThePositionError)
+{
+  // a flat grid can lose every interior vertex without moving its surface, however much its normals vary
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeGridMesh(16, vertices, indices, 0);
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    float angle = vertices[i].uv.x * 5 + vertices[i].uv.y * 3;
+    vertices[i].normal = XMFLOAT3(0.5f * sinf(angle), 1, 0.5f * cosf(angle));
+  }
+  SimplifierVertexLayout layout = MakeFixtureLayout(vertices, 1, 4);
+
+  vector<UINT> simplified(indices.size());
+  float position_error  = -1;
+  float attribute_error = -1;
+  UINT num = MeshSimplifier::Simplify(&indices[0], (UINT)indices.size(), layout, (UINT)indices.size() / 4, FLT_MAX, &simplified[0],
+    &position_error, &attribute_error);
+
+  CHECK(num > 0 && num <= indices.size() / 4);
+  CHECK(position_error < 1e-5f);
+  CHECK(attribute_error > 1e-3f);
+}
+
+TEST(MeshSimplifierKeepsThePositionErrorUnderTheLimit)
+{
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeGridMesh(32, vertices, indices);
+
+  // heavily weighted uvs change which collapses happen first, but not what the limit means
+  const float weights[] = { 0, 1, 50 };
+  const float MAX_ERROR = 0.004f;
+  for (UINT w = 0; w < 3; w++)
+  {
+    SimplifierVertexLayout layout = MakeFixtureLayout(vertices, weights[w], 0);
+    vector<UINT> simplified(indices.size());
+    float error = -1;
+    UINT num = MeshSimplifier::Simplify(&indices[0], (UINT)indices.size(), layout, 0, MAX_ERROR, &simplified[0], &error);
+
+    CHECK(num < indices.size());
+    CHECK(error > 0 && error <= MAX_ERROR);
+
+    // every remaining vertex is an original vertex, so the surface can only have moved between them.  Check the
+    // simplified triangles still sit close to the curve at their centroids
+    for (UINT i = 0; i < num; i += 3)
+    {
+      const XMFLOAT3& a = vertices[simplified[i]].pos;
+      const XMFLOAT3& b = vertices[simplified[i + 1]].pos;
+      const XMFLOAT3& c = vertices[simplified[i + 2]].pos;
+      float x = (a.x + b.x + c.x) / 3;
+      float z = (a.z + b.z + c.z) / 3;
+      float y = (a.y + b.y + c.y) / 3;
+      float u = (x + 1) / 2;
+      float v = (z + 1) / 2;
+      CHECK(fabsf(y - 0.25f * sinf(u * 3.0f) * cosf(v * 2.0f)) < 0.05f);
+    }
+  }
+}
+
+TEST(MeshSimplifierGeneratesGeometricLODErrors)
+{
+  vector<FixtureMeshVertex> vertices;
+  vector<UINT> indices;
+  MakeGridMesh(32, vertices, indices);
+  SimplifierVertexLayout layout = MakeFixtureLayout(vertices, 10, 1);
+
+  vector<UINT> lod_indices;
+  vector<MeshLOD> lods;
+  MeshSimplifier::GenerateLODs(&indices[0], (UINT)indices.size(), layout, 4, 0.5f, 0.02f, lod_indices, lods);
+
+  CHECK(lods.size() >= 2);
+  CHECK(lods[0].first_index == 0 && lods[0].num_indices == indices.size() && lods[0].error == 0);
+  for (size_t i = 1; i < lods.size(); i++)
+  {
+    CHECK(lods[i].first_index == lods[i - 1].first_index + lods[i - 1].num_indices);
+    CHECK(lods[i].num_indices < lods[i - 1].num_indices);
+    CHECK(lods[i].error >= lods[i - 1].error && lods[i].error - lods[i - 1].error <= 0.02f);
+  }
+  CHECK(lods.back().first_index + lods.back().num_indices == lod_indices.size());
+}
+
+TEST(MeshSimplifierSelectsLODsByScreenError)
+{
+  const MeshLOD lods[] = { { 0, 300, 0 }, { 300, 150, 0.01f }, { 450, 60, 0.1f } };
+
+  // identity view looking down +z, and a projection whose vertical cotangent is 1
+  XMFLOAT4X4 view(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1);
+  XMFLOAT4X4 proj(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0);
+
+  // at depth 10 on a 1000 pixel viewport 1 unit covers 50 pixels
+  CHECK(MeshSimplifier::SelectLOD(lods, 3, XMFLOAT3(0, 0, 10), view, proj, 1000) == 1);
+  CHECK(MeshSimplifier::SelectLOD(lods, 3, XMFLOAT3(0, 0, 10), view, proj, 1000, 5) == 2);
+  CHECK(MeshSimplifier::SelectLOD(lods, 3, XMFLOAT3(0, 0, 1), view, proj, 1000) == 0);
+  CHECK(MeshSimplifier::SelectLOD(lods, 3, XMFLOAT3(0, 0, -10), view, proj, 1000) == 0);
+}
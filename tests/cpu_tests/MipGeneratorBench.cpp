@@ -0,0 +1,81 @@
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Textures/MipGenerator.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each chain is generated.  The fastest is reported
+/// </summary>
+static const int RUNS = 3;
+
+/// <summary>
+/// Times generating a full 2D chain into tightly packed levels, the way PrepUploadMips writes them into the upload
+/// buffer
+/// </summary>
+/// <param name="label">
+/// what the chain is, for the report
+/// </param>
+/// <param name="size">
+/// width and height of the top level
+/// </param>
+/// <param name="format">
+/// format of the texels
+/// </param>
+/// <param name="filter">
+/// filter to shrink each level with
+/// </param>
+static void BenchChain(const char* label, UINT size, GraphicsDataFormat format, MipFilter filter)
+{
+  UINT bytes_per_texel = MipGenerator::GetBytesPerTexel(format);
+  vector<UINT8> src((size_t)size * size * bytes_per_texel);
+  uint32_t state = 777;
+  for (size_t i = 0; i < src.size(); i++)
+  {
+    src[i] = (UINT8)(NextFixtureRandom(state) * 256);
+  }
+  if (format == R32G32B32A32_FLOAT)
+  {
+    float* texels = (float*)&src[0];
+    for (size_t i = 0; i < src.size() / sizeof(float); i++)
+    {
+      texels[i] = NextFixtureRandom(state);
+    }
+  }
+
+  UINT num_levels = MipGenerator::GetNumLevels(size, size);
+  vector<vector<UINT8> > storage(num_levels);
+  vector<MipLevelData>   levels(num_levels);
+  for (UINT l = 0; l < num_levels; l++)
+  {
+    UINT level_size = size >> l > 0 ? size >> l : 1;
+    storage[l].resize((size_t)level_size * level_size * bytes_per_texel);
+    levels[l].data        = &storage[l][0];
+    levels[l].row_pitch   = level_size * bytes_per_texel;
+    levels[l].slice_pitch = levels[l].row_pitch * level_size;
+  }
+
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    MipGenerator::Generate(&src[0], size, size, 1, format, filter, MIP_EDGE_CLAMP, num_levels, &levels[0]);
+    double time = BenchSeconds() - start;
+    best = time < best ? time : best;
+  }
+
+  string prefix = label;
+  ReportBenchmark((prefix + ", full chain").c_str(), best * 1e3, "ms");
+  ReportBenchmark((prefix + ", top level texels").c_str(), (double)size * size / best / 1e6, "Mtexel/s");
+}
+
+BENCHMARK(MipGeneratorFullChains)
+{
+  BenchChain("4096^2 RGBA8 box", 4096, R8B8G8A8_UNORM, MIP_FILTER_BOX);
+  BenchChain("4096^2 RGBA8 Kaiser", 4096, R8B8G8A8_UNORM, MIP_FILTER_KAISER);
+  BenchChain("4096^2 RGBA8 Lanczos", 4096, R8B8G8A8_UNORM, MIP_FILTER_LANCZOS);
+  BenchChain("4096^2 RGBA8 sRGB box", 4096, R8G8B8A8_UNORM_SRGB, MIP_FILTER_BOX);
+  BenchChain("4096^2 RGBA8 sRGB Kaiser", 4096, R8G8B8A8_UNORM_SRGB, MIP_FILTER_KAISER);
+  BenchChain("2048^2 RGBA32F box", 2048, R32G32B32A32_FLOAT, MIP_FILTER_BOX);
+}
@@ -0,0 +1,299 @@
+#include <math.h>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Textures/MipGenerator.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Windowed sinc weight of a tap, evaluated in double precision straight from the filter definitions
+/// </summary>
+static double ReferenceWeight(MipFilter filter, double x)
+{
+  const double RADIUS = 3;
+  const double PI     = 3.14159265358979323846;
+  if (fabs(x) >= RADIUS)
+  {
+    return 0;
+  }
+  double sinc = fabs(x) < 1e-9 ? 1 : sin(PI * x) / (PI * x);
+  if (filter == MIP_FILTER_LANCZOS)
+  {
+    double y = x / RADIUS;
+    return sinc * (fabs(y) < 1e-9 ? 1 : sin(PI * y) / (PI * y));
+  }
+
+  // Kaiser window with alpha 4, with I0 summed as a power series
+  double t = x / RADIUS;
+  double window = 0;
+  double norm   = 0;
+  for (int pass = 0; pass < 2; pass++)
+  {
+    double arg  = pass == 0 ? 4 * sqrt(1 - t * t) : 4;
+    double sum  = 1;
+    double term = 1;
+    for (int k = 1; k < 40; k++)
+    {
+      term *= (arg * arg / 4) / (k * k);
+      sum  += term;
+    }
+    (pass == 0 ? window : norm) = sum;
+  }
+  return sinc * window / norm;
+}
+
+/// <summary>
+/// Shrinks a 2D image of 4 doubles per texel with a windowed sinc filter, 1 texel at a time over the whole 2D
+/// footprint, as the reference for the separable SSE2 passes
+/// </summary>
+static vector<double> ReferenceShrink(const vector<double>& src, UINT width, UINT height, MipFilter filter, MipEdgeMode edge_mode)
+{
+  UINT dst_width  = width > 1 ? width / 2 : 1;
+  UINT dst_height = height > 1 ? height / 2 : 1;
+  vector<double> dst((size_t)dst_width * dst_height * 4, 0);
+  for (UINT y = 0; y < dst_height; y++)
+  {
+    for (UINT x = 0; x < dst_width; x++)
+    {
+      double scale_x  = width / (double)dst_width;
+      double scale_y  = height / (double)dst_height;
+      double center_x = (x + 0.5) * scale_x - 0.5;
+      double center_y = (y + 0.5) * scale_y - 0.5;
+      double total    = 0;
+      double sum[4]   = { 0, 0, 0, 0 };
+      for (int sy = (int)floor(center_y - 3 * scale_y); sy <= (int)ceil(center_y + 3 * scale_y); sy++)
+      {
+        // an axis that isn't shrunk is copied as is
+        double wy = height == dst_height ? (sy == (int)y ? 1 : 0) : ReferenceWeight(filter, (sy - center_y) / scale_y);
+        for (int sx = (int)floor(center_x - 3 * scale_x); sx <= (int)ceil(center_x + 3 * scale_x); sx++)
+        {
+          double wx = width == dst_width ? (sx == (int)x ? 1 : 0) : ReferenceWeight(filter, (sx - center_x) / scale_x);
+          double weight = wx * wy;
+          if (weight == 0)
+          {
+            continue;
+          }
+          int ix = edge_mode == MIP_EDGE_WRAP ? ((sx % (int)width) + (int)width) % (int)width : min(max(sx, 0), (int)width - 1);
+          int iy = edge_mode == MIP_EDGE_WRAP ? ((sy % (int)height) + (int)height) % (int)height : min(max(sy, 0), (int)height - 1);
+          for (UINT c = 0; c < 4; c++)
+          {
+            sum[c] += weight * src[((size_t)iy * width + ix) * 4 + c];
+          }
+          total += weight;
+        }
+      }
+      for (UINT c = 0; c < 4; c++)
+      {
+        dst[((size_t)y * dst_width + x) * 4 + c] = sum[c] / total;
+      }
+    }
+  }
+  return dst;
+}
+
+TEST(MipGeneratorCountsLevels)
+{
+  CHECK(MipGenerator::GetNumLevels(1) == 1);
+  CHECK(MipGenerator::GetNumLevels(4096, 4096) == 13);
+  CHECK(MipGenerator::GetNumLevels(640, 480) == 10);
+  CHECK(MipGenerator::GetNumLevels(8, 2, 32) == 6);
+  CHECK(MipGenerator::GetBytesPerTexel(R8B8G8A8_UNORM) == 4);
+  CHECK(MipGenerator::GetBytesPerTexel(R32G32B32A32_FLOAT) == 16);
+  CHECK(!MipGenerator::IsFormatSupported(BC1_UNORM));
+}
+
+TEST(MipGeneratorBoxAveragesEachQuad)
+{
+  // 4x2 RGBA8 image, so level 1 is 2x1 and each of its texels is the average of 1 2x2 quad
+  const UINT8 texels[] =
+  {
+    0,   10,  20,  255,   100, 110, 120, 255,   1, 2, 3, 4,   5, 6, 7, 8,
+    200, 210, 220, 255,   100, 110, 120, 255,   9, 8, 7, 6,   5, 4, 3, 2
+  };
+  vector<UINT8> src(texels, texels + sizeof(texels));
+  vector<vector<UINT8> > levels;
+  MipGenerator::Generate(src, 4, 2, 1, R8B8G8A8_UNORM, MIP_FILTER_BOX, MIP_EDGE_CLAMP, 3, levels);
+
+  CHECK(levels.size() == 3);
+  CHECK(levels[0] == src);
+  CHECK(levels[1].size() == 2 * 4);
+  CHECK(levels[2].size() == 4);
+  const UINT8 expected[] = { 100, 110, 120, 255, 5, 5, 5, 5 };
+  for (UINT i = 0; i < 8 && levels[1].size() == 8; i++)
+  {
+    CHECK(levels[1][i] == expected[i]);
+  }
+}
+
+TEST(MipGeneratorBoxAveragesEachVolume)
+{
+  // 4x4x4 shrinks along every axis at once, and 2x2x8 reaches 1x1 first and then only shrinks along z, so both the
+  // z pass after x and y and the z pass on its own run, with the ping-pong between the scratch levels
+  const UINT sizes[2][3] = { { 4, 4, 4 }, { 2, 2, 8 } };
+  uint32_t state = 44;
+  for (UINT s = 0; s < 2; s++)
+  {
+    UINT width  = sizes[s][0];
+    UINT height = sizes[s][1];
+    UINT depth  = sizes[s][2];
+    vector<float> texels((size_t)width * height * depth * 4);
+    for (size_t i = 0; i < texels.size(); i++)
+    {
+      texels[i] = NextFixtureRandom(state);
+    }
+    vector<UINT8> src((UINT8*)&texels[0], (UINT8*)&texels[0] + texels.size() * sizeof(float));
+    UINT num_levels = MipGenerator::GetNumLevels(width, height, depth);
+    vector<vector<UINT8> > levels;
+    MipGenerator::Generate(src, width, height, depth, R32G32B32A32_FLOAT, MIP_FILTER_BOX, MIP_EDGE_CLAMP, num_levels, levels);
+    CHECK(levels.size() == 3 || levels.size() == 4);
+
+    // each texel of a level is the plain average of the block of top level texels under it
+    for (UINT l = 1; l < num_levels; l++)
+    {
+      UINT level_width  = max(width >> l, 1u);
+      UINT level_height = max(height >> l, 1u);
+      UINT level_depth  = max(depth >> l, 1u);
+      UINT block_width  = width / level_width;
+      UINT block_height = height / level_height;
+      UINT block_depth  = depth / level_depth;
+      CHECK(levels[l].size() == (size_t)level_width * level_height * level_depth * 16);
+      if (levels[l].size() != (size_t)level_width * level_height * level_depth * 16)
+      {
+        continue;
+      }
+
+      const float* level = (const float*)&levels[l][0];
+      double max_error = 0;
+      for (UINT z = 0; z < level_depth; z++)
+      {
+        for (UINT y = 0; y < level_height; y++)
+        {
+          for (UINT x = 0; x < level_width; x++)
+          {
+            for (UINT c = 0; c < 4; c++)
+            {
+              double sum = 0;
+              for (UINT bz = 0; bz < block_depth; bz++)
+              {
+                for (UINT by = 0; by < block_height; by++)
+                {
+                  for (UINT bx = 0; bx < block_width; bx++)
+                  {
+                    size_t texel = (((size_t)z * block_depth + bz) * height + y * block_height + by) * width + x * block_width + bx;
+                    sum += texels[texel * 4 + c];
+                  }
+                }
+              }
+              double expected = sum / (block_width * block_height * block_depth);
+              double actual   = level[(((size_t)z * level_height + y) * level_width + x) * 4 + c];
+              max_error = max(max_error, fabs(actual - expected));
+            }
+          }
+        }
+      }
+      CHECK_CLOSE(max_error, 0, 1e-5);
+    }
+  }
+}
+
+TEST(MipGeneratorWindowedSincMatchesScalarReference)
+{
+  // 13x7 doesn't halve evenly, so the taps are off the texel grid and each level sits at a different phase.  Every
+  // level of the chain is checked against the reference shrinking the reference's previous level
+  const UINT WIDTH  = 13;
+  const UINT HEIGHT = 7;
+  uint32_t state = 2044;
+  vector<float> texels(WIDTH * HEIGHT * 4);
+  for (size_t i = 0; i < texels.size(); i++)
+  {
+    texels[i] = NextFixtureRandom(state);
+  }
+  vector<UINT8> src((UINT8*)&texels[0], (UINT8*)&texels[0] + texels.size() * sizeof(float));
+
+  const MipFilter filters[] = { MIP_FILTER_KAISER, MIP_FILTER_LANCZOS };
+  for (UINT f = 0; f < 2; f++)
+  {
+    for (UINT edge = 0; edge < 2; edge++)
+    {
+      MipEdgeMode edge_mode = edge == 0 ? MIP_EDGE_CLAMP : MIP_EDGE_WRAP;
+      UINT num_levels = MipGenerator::GetNumLevels(WIDTH, HEIGHT);
+      vector<vector<UINT8> > levels;
+      MipGenerator::Generate(src, WIDTH, HEIGHT, 1, R32G32B32A32_FLOAT, filters[f], edge_mode, num_levels, levels);
+      CHECK(levels.size() == 4);
+
+      vector<double> reference(texels.begin(), texels.end());
+      UINT width  = WIDTH;
+      UINT height = HEIGHT;
+      for (UINT l = 1; l < levels.size(); l++)
+      {
+        reference = ReferenceShrink(reference, width, height, filters[f], edge_mode);
+        width  = max(width / 2, 1u);
+        height = max(height / 2, 1u);
+        CHECK(levels[l].size() == reference.size() * sizeof(float));
+        if (levels[l].size() != reference.size() * sizeof(float))
+        {
+          break;
+        }
+
+        const float* level = (const float*)&levels[l][0];
+        double max_error = 0;
+        for (size_t i = 0; i < reference.size(); i++)
+        {
+          max_error = max(max_error, fabs(level[i] - reference[i]));
+        }
+        CHECK_CLOSE(max_error, 0, 1e-4);
+      }
+    }
+  }
+}
+
+TEST(MipGeneratorFiltersSrgbInLinearSpace)
+{
+  // black and white average to half the light, which is 188 in sRGB rather than 128, while alpha stays linear
+  const UINT8 texels[] =
+  {
+    0,   0,   0,   0,     255, 255, 255, 255,
+    255, 255, 255, 255,   0,   0,   0,   0
+  };
+  vector<UINT8> src(texels, texels + sizeof(texels));
+  vector<vector<UINT8> > levels;
+  MipGenerator::Generate(src, 2, 2, 1, R8G8B8A8_UNORM_SRGB, MIP_FILTER_BOX, MIP_EDGE_CLAMP, 2, levels);
+
+  CHECK(levels[1].size() == 4);
+  CHECK(levels[1][0] == 188 && levels[1][1] == 188 && levels[1][2] == 188);
+  CHECK(levels[1][3] == 128);
+}
+
+TEST(MipGeneratorKeepsConstantImages)
+{
+  // every filter weights sum to 1, so a flat image stays flat at every level with either edge mode
+  const UINT SIZE = 37;
+  vector<float> texels(SIZE * SIZE * 4, 0.25f);
+  vector<UINT8> src((UINT8*)&texels[0], (UINT8*)&texels[0] + texels.size() * sizeof(float));
+  const MipFilter filters[] = { MIP_FILTER_BOX, MIP_FILTER_KAISER, MIP_FILTER_LANCZOS };
+  for (UINT f = 0; f < 3; f++)
+  {
+    for (UINT edge = 0; edge < 2; edge++)
+    {
+      vector<vector<UINT8> > levels;
+      MipGenerator::Generate(src, SIZE, SIZE, 1, R32G32B32A32_FLOAT, filters[f], edge == 0 ? MIP_EDGE_CLAMP : MIP_EDGE_WRAP,
+        MipGenerator::GetNumLevels(SIZE, SIZE), levels);
+      CHECK(levels.size() == 6);
+      const vector<UINT8>& last = levels[levels.size() - 1];
+      CHECK(last.size() == 16);
+      const float* value = (const float*)&last[0];
+      CHECK_CLOSE(value[0], 0.25f, 1e-5);
+      CHECK_CLOSE(value[3], 0.25f, 1e-5);
+    }
+  }
+}
+
+TEST(MipGeneratorRejectsBadArguments)
+{
+  vector<UINT8> src(4 * 4 * 4);
+  vector<vector<UINT8> > levels;
+  CHECK_THROWS(MipGenerator::Generate(src, 4, 4, 1, BC1_UNORM, MIP_FILTER_BOX, MIP_EDGE_CLAMP, 1, levels));
+  CHECK_THROWS(MipGenerator::Generate(src, 4, 4, 1, R8B8G8A8_UNORM, MIP_FILTER_BOX, MIP_EDGE_CLAMP, 4, levels));
+  CHECK_THROWS(MipGenerator::Generate(src, 8, 4, 1, R8B8G8A8_UNORM, MIP_FILTER_BOX, MIP_EDGE_CLAMP, 1, levels));
+}
@@ -0,0 +1,253 @@
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Textures/MipStreamingPolicy.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Number of levels of each test texture kept in memory at all times, 32x32 down to 1x1
+/// </summary>
+static const UINT16 NUM_TAIL_LEVELS = 6;
+
+/// <summary>
+/// Gets the size of each level of a square RGBA8 texture with a full mipmap chain
+/// </summary>
+static vector<UINT64> MakeLevelSizes(UINT size)
+{
+  vector<UINT64> sizes;
+  for (; size > 0; size /= 2)
+  {
+    sizes.push_back((UINT64)size * size * 4);
+  }
+  return sizes;
+}
+
+/// <summary>
+/// Adds a square RGBA8 texture whose tail is 32x32 and smaller
+/// </summary>
+static UINT AddSquareTexture(MipStreamingPolicy& policy, UINT size)
+{
+  vector<UINT64> sizes = MakeLevelSizes(size);
+  return policy.AddTexture(size, size, sizes, (UINT16)(sizes.size() - NUM_TAIL_LEVELS));
+}
+
+/// <summary>
+/// Schedules and completes uploads until the policy has nothing left to do
+/// </summary>
+static void StreamUntilSettled(MipStreamingPolicy& policy)
+{
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  for (UINT frame = 0; frame < 100; frame++)
+  {
+    policy.Schedule(uploads, evictions);
+    if (uploads.empty() && evictions.empty())
+    {
+      return;
+    }
+    for (size_t i = 0; i < uploads.size(); i++)
+    {
+      policy.OnUploaded(uploads[i]);
+    }
+  }
+}
+
+/// <summary>
+/// Checks if a list of actions holds a level of a texture
+/// </summary>
+static bool HasAction(const vector<MipStreamingAction>& actions, UINT texture, UINT16 mip_level)
+{
+  for (size_t i = 0; i < actions.size(); i++)
+  {
+    if (actions[i].texture == texture && actions[i].mip_level == mip_level)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST(MipStreamingPolicyPicksLevelsForScreenSize)
+{
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 1024, 11, 1024) == 0);
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 1024, 11, 2000) == 0);
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 1024, 11, 600) == 0);
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 512, 11, 128) == 3);
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 1024, 11, 0.5f) == 10);
+  CHECK(MipStreamingPolicy::GetLevelForScreenSize(1024, 1024, 11, 0) == 10);
+}
+
+TEST(MipStreamingPolicyUploadsTheBiggestGapFirst)
+{
+  MipStreamingPolicy policy(1ull << 40, 1ull << 40);
+  UINT small_gap = AddSquareTexture(policy, 1024);
+  UINT big_gap   = AddSquareTexture(policy, 1024);
+  UINT tie       = AddSquareTexture(policy, 1024);
+
+  // 1024 on screen wants level 0, 5 levels away.  128 wants level 3, 2 levels away.  The tie breaks on screen size
+  policy.SetScreenSize(small_gap, 128);
+  policy.SetScreenSize(big_gap, 1024);
+  policy.SetScreenSize(tie, 2048);
+  CHECK(policy.GetDesiredLevel(small_gap) == 3);
+  CHECK(policy.GetDesiredLevel(big_gap) == 0);
+  CHECK(policy.GetResidentLevel(big_gap) == 5);
+
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  policy.Schedule(uploads, evictions);
+  CHECK(evictions.empty());
+  CHECK(uploads.size() == 3);
+  if (uploads.size() == 3)
+  {
+    CHECK(uploads[0].texture == tie && uploads[0].mip_level == 4);
+    CHECK(uploads[1].texture == big_gap && uploads[1].mip_level == 4);
+    CHECK(uploads[2].texture == small_gap && uploads[2].mip_level == 4);
+  }
+
+  // a level in flight is not scheduled again
+  vector<MipStreamingAction> next_uploads;
+  policy.Schedule(next_uploads, evictions);
+  CHECK(next_uploads.empty());
+  for (size_t i = 0; i < uploads.size(); i++)
+  {
+    policy.OnUploaded(uploads[i]);
+  }
+
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(small_gap) == 3);
+  CHECK(policy.GetResidentLevel(big_gap) == 0);
+  CHECK(policy.GetResidentLevel(tie) == 0);
+}
+
+TEST(MipStreamingPolicyAllowsALevelLargerThanTheUploadBudget)
+{
+  // the budget is smaller than any streamed level, so only the first upload of each frame fits
+  MipStreamingPolicy policy(1ull << 40, 1024);
+  UINT a = AddSquareTexture(policy, 1024);
+  UINT b = AddSquareTexture(policy, 1024);
+  policy.SetScreenSize(a, 1024);
+  policy.SetScreenSize(b, 512);
+
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  policy.Schedule(uploads, evictions);
+  CHECK(uploads.size() == 1);
+  CHECK(HasAction(uploads, a, 4));
+  policy.OnUploaded(uploads[0]);
+
+  policy.Schedule(uploads, evictions);
+  CHECK(uploads.size() == 1);
+  policy.OnUploaded(uploads[0]);
+
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(a) == 0);
+  CHECK(policy.GetResidentLevel(b) == 1);
+}
+
+TEST(MipStreamingPolicyEvictsUnneededLevelsUnderPressure)
+{
+  // room for the tails and 1 texture at full detail
+  vector<UINT64> sizes = MakeLevelSizes(1024);
+  UINT64 tail = 0;
+  UINT64 full = 0;
+  for (size_t level = 0; level < sizes.size(); level++)
+  {
+    full += sizes[level];
+    tail += level >= sizes.size() - NUM_TAIL_LEVELS ? sizes[level] : 0;
+  }
+  MipStreamingPolicy policy(full + tail, 1ull << 40);
+  UINT near_object = AddSquareTexture(policy, 1024);
+  UINT far_object  = AddSquareTexture(policy, 1024);
+
+  policy.SetScreenSize(near_object, 1024);
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(near_object) == 0);
+  CHECK(policy.GetResidentBytes() == full + tail);
+
+  // the objects swap places.  The far texture's top level has to come out before the near one's can go in, and the
+  // far texture does not get an upload in the frame it gives up a level
+  policy.SetScreenSize(near_object, 1);
+  policy.SetScreenSize(far_object, 1024);
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  policy.Schedule(uploads, evictions);
+  CHECK(HasAction(evictions, near_object, 0));
+  CHECK(HasAction(uploads, far_object, 4));
+  CHECK(!HasAction(uploads, near_object, 4));
+  CHECK(policy.GetResidentBytes() <= full + tail);
+  for (size_t i = 0; i < uploads.size(); i++)
+  {
+    policy.OnUploaded(uploads[i]);
+  }
+
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(far_object) == 0);
+  CHECK(policy.GetResidentLevel(near_object) == 5);
+  CHECK(policy.GetResidentBytes() <= full + tail);
+
+  // a third texture that wants full detail takes levels from the far one only while it is further behind, so the 2
+  // end up within a level of each other
+  UINT third = AddSquareTexture(policy, 1024);
+  policy.SetScreenSize(third, 1024);
+  policy.Schedule(uploads, evictions);
+  CHECK(HasAction(evictions, far_object, 0));
+  CHECK(HasAction(uploads, third, 4));
+  for (size_t i = 0; i < uploads.size(); i++)
+  {
+    policy.OnUploaded(uploads[i]);
+  }
+
+  StreamUntilSettled(policy);
+  int far_missing   = policy.GetResidentLevel(far_object) - policy.GetDesiredLevel(far_object);
+  int third_missing = policy.GetResidentLevel(third) - policy.GetDesiredLevel(third);
+  CHECK(far_missing > 0 && third_missing > 0);
+  CHECK(far_missing - third_missing <= 1 && third_missing - far_missing <= 1);
+  CHECK(policy.GetResidentBytes() <= full + tail);
+}
+
+TEST(MipStreamingPolicyEvictsWhenTheBudgetDrops)
+{
+  vector<UINT64> sizes = MakeLevelSizes(1024);
+  MipStreamingPolicy policy(1ull << 40, 1ull << 40);
+  UINT texture = AddSquareTexture(policy, 1024);
+  policy.SetScreenSize(texture, 1024);
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(texture) == 0);
+
+  // only room for levels 3 and down, so the 3 most detailed levels go, most detailed first
+  UINT64 budget = policy.GetResidentBytes() - sizes[0] - sizes[1] - sizes[2];
+  policy.SetMemoryBudget(budget);
+  vector<MipStreamingAction> uploads;
+  vector<MipStreamingAction> evictions;
+  policy.Schedule(uploads, evictions);
+  CHECK(uploads.empty());
+  CHECK(evictions.size() == 3);
+  if (evictions.size() == 3)
+  {
+    CHECK(evictions[0].mip_level == 0 && evictions[1].mip_level == 1 && evictions[2].mip_level == 2);
+  }
+  CHECK(policy.GetResidentLevel(texture) == 3);
+  CHECK(policy.GetResidentBytes() == budget);
+
+  // the tail is never evicted, even when the budget can't hold it
+  policy.SetMemoryBudget(0);
+  StreamUntilSettled(policy);
+  CHECK(policy.GetResidentLevel(texture) == 5);
+}
+
+TEST(MipStreamingPolicyRejectsInvalidArguments)
+{
+  MipStreamingPolicy policy(1ull << 30, 1ull << 20);
+  CHECK_THROWS(policy.AddTexture(4, 4, vector<UINT64>(), 0));
+  CHECK_THROWS(policy.AddTexture(4, 4, MakeLevelSizes(4), 3));
+
+  UINT texture = AddSquareTexture(policy, 64);
+  CHECK_THROWS(policy.SetScreenSize(texture + 1, 64));
+  CHECK_THROWS(policy.GetResidentLevel(texture + 1));
+  CHECK_THROWS(policy.GetDesiredLevel(texture + 1));
+
+  MipStreamingAction bad_index = { texture + 1, 0 };
+  CHECK_THROWS(policy.OnUploaded(bad_index));
+  MipStreamingAction not_uploading = { texture, 0 };
+  CHECK_THROWS(policy.OnUploaded(not_uploading));
+}
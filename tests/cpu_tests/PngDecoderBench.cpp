@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "ImageFixture.h"
+#include "PngFixture.h"
+#include "Graphics/Textures/PngDecoder.h"
+#include "private_inc/Threading/ThreadPool.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Row pitch alignment of an upload buffer footprint, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT
+/// </summary>
+static const UINT PITCH_ALIGNMENT = 256;
+
+BENCHMARK(PngDecoderThroughput)
+{
+  // a 2048x2048 photo-like image in each color type the decoder handles itself, decoded into upload footprint rows.
+  // The baseline is what loading did before: lodepng decodes to an unpitched image, which is then copied to the rows
+  const UINT SIZE  = 2048;
+  const UINT PITCH = (SIZE * 4 + PITCH_ALIGNMENT - 1) / PITCH_ALIGNMENT * PITCH_ALIGNMENT;
+  vector<UINT8> rgba;
+  MakeFixtureImage(SIZE, SIZE, true, rgba);
+  vector<UINT8> dst((size_t)PITCH * SIZE);
+  PngDestination destination = { &dst[0], PITCH };
+
+  const LodePNGColorType color_types[] = { LCT_RGBA, LCT_RGB, LCT_GREY, LCT_GREY_ALPHA };
+  const char* names[] = { "RGBA", "RGB", "grey", "grey + alpha" };
+  for (UINT t = 0; t < 4; t++)
+  {
+    vector<UINT8> png;
+    vector<UINT8> expected;
+    CHECK(EncodeFixturePng(rgba, SIZE, SIZE, color_types[t], png, expected));
+
+    double best_decoder = 1e30;
+    double best_lodepng = 1e30;
+    for (int run = 0; run < RUNS; run++)
+    {
+      double start = BenchSeconds();
+      PngDecoder::Decode(&png[0], png.size(), destination);
+      double time = BenchSeconds() - start;
+      best_decoder = time < best_decoder ? time : best_decoder;
+
+      start = BenchSeconds();
+      unsigned char* image = NULL;
+      unsigned width = 0;
+      unsigned height = 0;
+      unsigned error = lodepng_decode_memory(&image, &width, &height, &png[0], png.size(), LCT_RGBA, 8);
+      for (UINT y = 0; error == 0 && y < height; y++)
+      {
+        memcpy(&dst[(size_t)y * PITCH], image + (size_t)y * width * 4, width * 4);
+      }
+      free(image);
+      time = BenchSeconds() - start;
+      best_lodepng = time < best_lodepng ? time : best_lodepng;
+      CHECK(error == 0);
+    }
+    CHECK(memcmp(&dst[(size_t)PITCH * (SIZE - 1)], &expected[(size_t)SIZE * (SIZE - 1) * 4], SIZE * 4) == 0);
+
+    double mpix = (double)SIZE * SIZE / 1e6;
+    string label = string(names[t]) + ", ";
+    ReportBenchmark((label + "PngDecoder::Decode").c_str(), mpix / best_decoder, "Mpix/s");
+    ReportBenchmark((label + "lodepng decode + pitched copy").c_str(), mpix / best_lodepng, "Mpix/s");
+  }
+}
+
+BENCHMARK(PngDecoderCoreScaling)
+{
+  // 16 1024x1024 images decoded 1 per job on pools of increasing size, then the same files through DecodeFiles, which
+  // also reads them on its own thread.  The pools stop scaling at the number of hardware threads, which is reported
+  // with the results
+  const UINT NUM_IMAGES = 16;
+  const UINT SIZE       = 1024;
+  vector<UINT8> rgba;
+  MakeFixtureImage(SIZE, SIZE, true, rgba);
+  vector<UINT8> png;
+  vector<UINT8> expected;
+  CHECK(EncodeFixturePng(rgba, SIZE, SIZE, LCT_RGBA, png, expected));
+  vector<vector<UINT8> > images(NUM_IMAGES, vector<UINT8>((size_t)SIZE * SIZE * 4));
+
+  ReportBenchmark("hardware threads", thread::hardware_concurrency(), "");
+  double single = 0;
+  const UINT pool_sizes[] = { 1, 2, 4 };
+  for (UINT p = 0; p < 3; p++)
+  {
+    ThreadPool pool(pool_sizes[p]);
+    double best = 1e30;
+    for (int run = 0; run < RUNS; run++)
+    {
+      double start = BenchSeconds();
+      pool.ParallelFor(NUM_IMAGES, 1, [&](UINT begin, UINT end)
+      {
+        for (UINT i = begin; i < end; i++)
+        {
+          PngDestination dst = { &images[i][0], SIZE * 4 };
+          PngDecoder::Decode(&png[0], png.size(), dst);
+        }
+      });
+      double time = BenchSeconds() - start;
+      best = time < best ? time : best;
+    }
+    if (p == 0)
+    {
+      single = best;
+    }
+
+    string label = to_string(pool_sizes[p]) + " worker(s) + caller, ";
+    ReportBenchmark((label + "16 x 1024x1024").c_str(), best * 1e3, "ms");
+    ReportBenchmark((label + "speedup over 1 worker").c_str(), single / best, "x");
+  }
+  CHECK(images[NUM_IMAGES - 1] == expected);
+
+  vector<string> paths;
+  for (UINT i = 0; i < NUM_IMAGES; i++)
+  {
+    paths.push_back("png_decoder_bench_" + to_string(i) + ".png");
+    ofstream out(paths[i].c_str(), ios_base::out | ios_base::binary);
+    out.write((const char*)&png[0], png.size());
+  }
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    PngDecoder::DecodeFiles(paths, [&](UINT index, UINT width, UINT height) -> PngDestination
+    {
+      PngDestination dst = { &images[index][0], width * 4 };
+      return dst;
+    });
+    double time = BenchSeconds() - start;
+    best = time < best ? time : best;
+  }
+  for (UINT i = 0; i < NUM_IMAGES; i++)
+  {
+    remove(paths[i].c_str());
+  }
+  ReportBenchmark("DecodeFiles on the default pool, 16 x 1024x1024", best * 1e3, "ms");
+  CHECK(images[0] == expected);
+}
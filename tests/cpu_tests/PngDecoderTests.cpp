@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "ImageFixture.h"
+#include "PngFixture.h"
+#include "Graphics/Textures/PngDecoder.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Byte the padding at the end of each destination row is filled with, which decoding must leave alone
+/// </summary>
+static const UINT8 PADDING = 0xCD;
+
+/// <summary>
+/// Checks that the rows of a pitched destination hold an image and that the padding after each row is untouched
+/// </summary>
+static bool RowsMatch(const vector<UINT8>& dst, UINT row_pitch, const vector<UINT8>& expected, UINT width, UINT height)
+{
+  for (UINT y = 0; y < height; y++)
+  {
+    const UINT8* row = &dst[(size_t)y * row_pitch];
+    if (memcmp(row, &expected[(size_t)y * width * 4], width * 4) != 0)
+    {
+      return false;
+    }
+    for (UINT i = width * 4; i < row_pitch; i++)
+    {
+      if (row[i] != PADDING)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+TEST(PngDecoderDecodesEachColorTypeIntoPitchedRows)
+{
+  // an odd size, so rows don't line up with the filters' or the pitch's alignment
+  const UINT WIDTH  = 61;
+  const UINT HEIGHT = 45;
+  const UINT PITCH  = 256;
+  vector<UINT8> rgba;
+  MakeFixtureImage(WIDTH, HEIGHT, true, rgba);
+
+  const LodePNGColorType color_types[] = { LCT_RGBA, LCT_RGB, LCT_GREY, LCT_GREY_ALPHA };
+  for (UINT t = 0; t < 4; t++)
+  {
+    vector<UINT8> png;
+    vector<UINT8> expected;
+    CHECK(EncodeFixturePng(rgba, WIDTH, HEIGHT, color_types[t], png, expected));
+
+    UINT width = 0;
+    UINT height = 0;
+    PngDecoder::ReadHeader(&png[0], png.size(), width, height);
+    CHECK(width == WIDTH && height == HEIGHT);
+
+    vector<UINT8> dst((size_t)PITCH * HEIGHT, PADDING);
+    PngDestination destination = { &dst[0], PITCH };
+    PngDecoder::Decode(&png[0], png.size(), destination);
+    CHECK(RowsMatch(dst, PITCH, expected, WIDTH, HEIGHT));
+  }
+}
+
+TEST(PngDecoderRejectsInvalidFiles)
+{
+  vector<UINT8> rgba;
+  MakeFixtureImage(16, 16, false, rgba);
+  vector<UINT8> png;
+  vector<UINT8> expected;
+  CHECK(EncodeFixturePng(rgba, 16, 16, LCT_RGBA, png, expected));
+
+  vector<UINT8> dst(16 * 64);
+  PngDestination destination = { &dst[0], 64 };
+  UINT width;
+  UINT height;
+
+  // too short for the header, and not a PNG
+  CHECK_THROWS(PngDecoder::ReadHeader(&png[0], 20, width, height));
+  vector<UINT8> bad = png;
+  bad[1] = 'J';
+  CHECK_THROWS(PngDecoder::ReadHeader(&bad[0], bad.size(), width, height));
+
+  // a chunk that runs past the end of the file
+  CHECK_THROWS(PngDecoder::Decode(&png[0], png.size() - 20, destination));
+
+  // rows too small for the image
+  PngDestination narrow = { &dst[0], 60 };
+  CHECK_THROWS(PngDecoder::Decode(&png[0], png.size(), narrow));
+}
+
+TEST(PngDecoderDecodeFilesReportsFailuresAfterDecodingTheRest)
+{
+  const UINT SIZE = 32;
+  vector<UINT8> rgba;
+  MakeFixtureImage(SIZE, SIZE, true, rgba);
+  vector<UINT8> png;
+  vector<UINT8> expected;
+  CHECK(EncodeFixturePng(rgba, SIZE, SIZE, LCT_RGBA, png, expected));
+
+  vector<string> paths;
+  paths.push_back("png_decoder_test_0.png");
+  paths.push_back("png_decoder_test_missing.png");
+  paths.push_back("png_decoder_test_2.png");
+  for (UINT i = 0; i < 3; i += 2)
+  {
+    ofstream out(paths[i].c_str(), ios_base::out | ios_base::binary);
+    out.write((const char*)&png[0], png.size());
+  }
+
+  vector<vector<UINT8> > images(3);
+  bool thrown = false;
+  try
+  {
+    PngDecoder::DecodeFiles(paths, [&](UINT index, UINT width, UINT height) -> PngDestination
+    {
+      images[index].assign((size_t)width * height * 4, PADDING);
+      PngDestination dst = { &images[index][0], width * 4 };
+      return dst;
+    });
+  }
+  catch (const FrameworkException&)
+  {
+    thrown = true;
+  }
+  remove(paths[0].c_str());
+  remove(paths[2].c_str());
+
+  CHECK(thrown);
+  CHECK(images[0] == expected);
+  CHECK(images[1].empty());
+  CHECK(images[2] == expected);
+}
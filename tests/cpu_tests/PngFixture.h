@@ -0,0 +1,90 @@
+#ifndef PNG_FIXTURE_H
+#define PNG_FIXTURE_H
+
+#include <windows.h>
+#include <stdlib.h>
+#include <vector>
+#include "lodepng/lodepng.h"
+
+/// <summary>
+/// Number of bytes per texel of the 8-bit color types PngDecoder decodes without lodepng
+/// </summary>
+inline UINT GetFixturePngBytesPerTexel(LodePNGColorType color_type)
+{
+  return color_type == LCT_RGBA ? 4 : color_type == LCT_RGB ? 3 : color_type == LCT_GREY_ALPHA ? 2 : 1;
+}
+
+/// <summary>
+/// Encodes an RGBA8 image as a PNG with fewer channels, and works out the RGBA8 image decoding it should give
+/// </summary>
+/// <param name="rgba">
+/// image to encode, 4 bytes per texel
+/// </param>
+/// <param name="width">
+/// width of the image in texels
+/// </param>
+/// <param name="height">
+/// height of the image in texels
+/// </param>
+/// <param name="color_type">
+/// LCT_RGBA, LCT_RGB, LCT_GREY or LCT_GREY_ALPHA.  Greyscale keeps the red channel
+/// </param>
+/// <param name="png">
+/// output parameter for the PNG file
+/// </param>
+/// <param name="expected">
+/// output parameter for the RGBA8 image the PNG holds
+/// </param>
+/// <returns>
+/// true if the image was encoded
+/// false otherwise
+/// </returns>
+inline bool EncodeFixturePng(const std::vector<UINT8>& rgba, UINT width, UINT height, LodePNGColorType color_type,
+  std::vector<UINT8>& png, std::vector<UINT8>& expected)
+{
+  UINT bpp = GetFixturePngBytesPerTexel(color_type);
+  std::vector<UINT8> texels((size_t)width * height * bpp);
+  expected.resize((size_t)width * height * 4);
+  for (size_t i = 0; i < (size_t)width * height; i++)
+  {
+    const UINT8* src = &rgba[i * 4];
+    UINT8* dst = &expected[i * 4];
+    bool grey  = color_type == LCT_GREY || color_type == LCT_GREY_ALPHA;
+    bool alpha = color_type == LCT_RGBA || color_type == LCT_GREY_ALPHA;
+    dst[0] = src[0];
+    dst[1] = grey ? src[0] : src[1];
+    dst[2] = grey ? src[0] : src[2];
+    dst[3] = alpha ? src[3] : 255;
+
+    UINT8* packed = &texels[i * bpp];
+    packed[0] = src[0];
+    if (grey)
+    {
+      if (alpha)
+      {
+        packed[1] = src[3];
+      }
+    }
+    else
+    {
+      packed[1] = src[1];
+      packed[2] = src[2];
+      if (alpha)
+      {
+        packed[3] = src[3];
+      }
+    }
+  }
+
+  unsigned char* encoded = NULL;
+  size_t size = 0;
+  unsigned error = lodepng_encode_memory(&encoded, &size, &texels[0], width, height, color_type, 8);
+  if (error == 0)
+  {
+    png.assign(encoded, encoded + size);
+  }
+  free(encoded);
+  return error == 0;
+}
+
+#endif /* PNG_FIXTURE_H */
@@ -0,0 +1,21 @@
+#ifndef RANDOM_FIXTURE_H
+#define RANDOM_FIXTURE_H
+
+#include <stdint.h>
+
+/// <summary>
+/// Small deterministic random number generator, so the generated data is the same on every platform
+/// </summary>
+/// <param name="state">
+/// state of the generator, updated by each call
+/// </param>
+/// <returns>
+/// value in [0, 1)
+/// </returns>
+inline float NextFixtureRandom(uint32_t& state)
+{
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) * (1.0f / 16777216.0f);
+}
+
+#endif /* RANDOM_FIXTURE_H */
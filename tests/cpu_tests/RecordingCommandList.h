@@ -0,0 +1,105 @@
+#ifndef RECORDING_COMMAND_LIST_H
+#define RECORDING_COMMAND_LIST_H
+
+// Command list that records what is set on it instead of sending it to a device, so the values the framework's binders
+// encode can be checked on the CPU.  Only the root constants are recorded; every other command is ignored.
+
+#include <string.h>
+#include <vector>
+#include "Graphics/CommandList.h"
+
+/// <summary>
+/// Root constants recorded by one SetRootConstants call
+/// </summary>
+struct RecordedRootConstants
+{
+  UINT slot;
+  UINT dest_offset;
+  std::vector<UINT> values;
+};
+
+class RecordingCommandList : public CommandList
+{
+  public:
+    RecordingCommandList()
+    {
+    }
+
+    /// <summary>
+    /// Records the 32-bit values exactly as SetGraphicsRoot32BitConstants would copy them into the root arguments
+    /// </summary>
+    void SetRootConstants(UINT slot, UINT num_32bit_values, const void* data, UINT dest_offset)
+    {
+      RecordedRootConstants recorded;
+      recorded.slot = slot;
+      recorded.dest_offset = dest_offset;
+      recorded.values.resize(num_32bit_values);
+      if (num_32bit_values > 0)
+      {
+        memcpy(&recorded.values[0], data, num_32bit_values * sizeof(UINT));
+      }
+      root_constants.push_back(recorded);
+    }
+
+    // the override above hides the templated version from the base class
+    using CommandList::SetRootConstants;
+
+    /// <summary>
+    /// root constants in the order they were set
+    /// </summary>
+    std::vector<RecordedRootConstants> root_constants;
+
+    void Reset(Pipeline* pipeline) {}
+    void Close() {}
+    void SetPipeline(const Pipeline& pipeline) {}
+    void SetRootSignature(const RootSignature& sig) {}
+    void SetHeapArray(const HeapArray& heap_array) {}
+    void SetConstantBuffer(UINT slot, const ConstantBuffer& constant_buffer) {}
+    void SetShaderResourceView(UINT slot, const StructuredBuffer& buffer, UINT element_offset) {}
+    void SetShaderResourceView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset) {}
+    void SetUnorderedAccessView(UINT slot, const StructuredBufferGPU& buffer, UINT element_offset) {}
+    void StructuredBufferToUnorderedAccess(const StructuredBufferGPU& buffer) {}
+    void UnorderedAccessToStructuredBuffer(const StructuredBufferGPU& buffer) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture1D& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture2D& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture2DRenderTarget& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture3D& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture1DArray& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const Texture2DArray& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const TextureCube& texture) {}
+    void SetTextureAsStartOfDescriptorTable(UINT slot, const TextureCubeArray& texture) {}
+    void IASetTopology(IATopology topology) {}
+    void IASetVertexBuffers(const VertexBufferArray& buffers) {}
+    void IASetIndexBuffer(const IndexBuffer& buffer) {}
+    void SOSetBuffers(const StreamOutputBufferArray& buffers) {}
+    void SOBufferToVertexBuffer(const StreamOutputBuffer& buffer) {}
+    void SOVertexBufferToStreamOutputBuffer(const StreamOutputBuffer& buffer) {}
+    void RSSetViewport(const Viewport& viewport) {}
+    void RSSetViewports(const Viewports& viewports) {}
+    void RSSetViewports(const Viewports& viewports, UINT start, UINT num) {}
+    void RSSetScissorRect(const RECT& rect) {}
+    void RSSetScissorRects(const std::vector<RECT>& rects) {}
+    void RSSetScissorRects(const std::vector<RECT>& rects, UINT start, UINT num) {}
+    void PrepRenderTarget(const RenderTarget& target) {}
+    void PrepRenderTarget(const RenderTargetMSAA& target) {}
+    void RenderTargetToPresent(const RenderTarget& target) {}
+    void RenderTargetResolvedToPresent(const RenderTarget& target) {}
+    void RenderTargetToResolved(const RenderTargetMSAA& src, const RenderTarget& dst) {}
+    void TextureToRenderTarget(const Texture2DRenderTarget& texture) {}
+    void RenderTargetToTexture(const RenderTarget& target) {}
+    void ClearRenderTarget(const RenderTarget& target, const float clear_color[4]) {}
+    void ClearRenderTarget(const RenderTargetMSAA& target, const float clear_color[4]) {}
+    void ClearDepthStencil(const DepthStencil& depth_stencil, float depth_clear_value) {}
+    void ClearDepthStencil(const DepthStencilMSAA& depth_stencil, float depth_clear_value) {}
+    void OMSetRenderTarget(const RenderTarget& target) {}
+    void OMSetRenderTarget(const RenderTarget& target, const DepthStencil& depth_stencil) {}
+    void OMSetRenderTarget(const RenderTargetMSAA& target, const DepthStencilMSAA& depth_stencil) {}
+    void DrawIndexedInstanced(UINT indices_per_instance, UINT instance_cnt, UINT instance_start_index) {}
+    void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, UINT instance_cnt, UINT instance_start_index) {}
+    void DrawIndexedInstanced(UINT indices_per_instance, UINT index_start_index, INT base_vertex, UINT instance_cnt, UINT instance_start_index) {}
+    void DrawIndexedInstanced(const DrawIndexedArgs* draws, UINT num_draws) {}
+    void DrawInstanced(UINT vertices_per_instance, UINT instance_cnt, UINT instance_start_index) {}
+    void DrawInstanced(UINT vertices_per_instance, UINT vertex_start_index, UINT instance_cnt, UINT instance_start_index) {}
+};
+
+#endif /* RECORDING_COMMAND_LIST_H */
@@ -0,0 +1,273 @@
+#include <float.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/RootSignatureConfig.h"
+#include "private_inc/D3D12/D3D12_RootSignatureConfig.h"
+using namespace std;
+
+/// <summary>
+/// Builds the config most samples use: a constant buffer, a table of textures, and 1 static sampler
+/// </summary>
+/// <returns>
+/// config built through the setters
+/// </returns>
+static RootSignatureConfig* CreateTypicalConfig()
+{
+  RootSignatureConfig* config = RootSignatureConfig::CreateD3D12(3, 1);
+  config->SetStageAccess(true, true, false, false, false, true, false);
+  config->SetParamAsConstantBufferView(0, 0, 0, SHADER_VISIBILITY_VERTEX);
+  config->SetParamAsDescriptorTable(1, 2, SHADER_VISIBILITY_PIXEL);
+  config->SetRangeAsShaderResourceView(1, 0, 4, 0, 0, ROOT_FLAGS_DATA_STATIC);
+  config->SetRangeAsUnorderedAccessView(1, 1, 1, 0, 0);
+  config->SetParamAsConstants(2, 1, 0, 4, SHADER_VISIBILITY_ALL);
+  config->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0.0f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL);
+  return config;
+}
+
+TEST(RootSignatureConfigIdenticalConfigsAreEquivalent)
+{
+  unique_ptr<RootSignatureConfig> a(CreateTypicalConfig());
+  unique_ptr<RootSignatureConfig> b(CreateTypicalConfig());
+
+  CHECK(a->IsEquivalent(*b));
+  CHECK(b->IsEquivalent(*a));
+  CHECK(a->IsEquivalent(*a));
+  CHECK(a->GetHash() == b->GetHash());
+}
+
+TEST(RootSignatureConfigHashIsStableAcrossCalls)
+{
+  unique_ptr<RootSignatureConfig> config(CreateTypicalConfig());
+  UINT64 hash = config->GetHash();
+
+  CHECK(hash == config->GetHash());
+
+  // setting a field to the value it already has must not change anything
+  config->SetParamAsConstants(2, 1, 0, 4, SHADER_VISIBILITY_ALL);
+  CHECK(hash == config->GetHash());
+}
+
+TEST(RootSignatureConfigDescMatchesSetters)
+{
+  RootParamDesc params[3];
+  RootRangeDesc ranges[2];
+  RootSamplerDesc sampler;
+
+  ranges[0].type                 = ROOT_RANGE_SRV;
+  ranges[0].num_descriptors      = 4;
+  ranges[0].base_shader_register = 0;
+  ranges[0].register_space       = 0;
+  ranges[0].flags                = ROOT_FLAGS_DATA_STATIC;
+  ranges[1].type                 = ROOT_RANGE_UAV;
+  ranges[1].num_descriptors      = 1;
+  ranges[1].base_shader_register = 0;
+  ranges[1].register_space       = 0;
+  ranges[1].flags                = ROOT_FLAGS_VOLATILE;
+
+  params[0].type             = ROOT_PARAM_CBV;
+  params[0].shader_register  = 0;
+  params[0].register_space   = 0;
+  params[0].num_32bit_values = 0;
+  params[0].num_ranges       = 0;
+  params[0].ranges           = NULL;
+  params[0].flags            = ROOT_FLAGS_VOLATILE;
+  params[0].shaders          = SHADER_VISIBILITY_VERTEX;
+
+  params[1].type             = ROOT_PARAM_DESCRIPTOR_TABLE;
+  params[1].shader_register  = 0;
+  params[1].register_space   = 0;
+  params[1].num_32bit_values = 0;
+  params[1].num_ranges       = 2;
+  params[1].ranges           = ranges;
+  params[1].flags            = ROOT_FLAGS_VOLATILE;
+  params[1].shaders          = SHADER_VISIBILITY_PIXEL;
+
+  params[2].type             = ROOT_PARAM_CONSTANTS;
+  params[2].shader_register  = 1;
+  params[2].register_space   = 0;
+  params[2].num_32bit_values = 4;
+  params[2].num_ranges       = 0;
+  params[2].ranges           = NULL;
+  params[2].flags            = ROOT_FLAGS_VOLATILE;
+  params[2].shaders          = SHADER_VISIBILITY_ALL;
+
+  sampler.filter          = TEXTURE_FILTER_MIN_MAG_MIP_LINEAR;
+  sampler.address_u       = TEXTURE_ADDRESS_MODE_WRAP;
+  sampler.address_v       = TEXTURE_ADDRESS_MODE_WRAP;
+  sampler.address_w       = TEXTURE_ADDRESS_MODE_WRAP;
+  sampler.mip_lod_bias    = 0.0f;
+  sampler.max_anisotropy  = 1;
+  sampler.compare_func    = COMPARISON_FUNC_NEVER;
+  sampler.border_color    = BORDER_COLOR_OPAQUE_BLACK;
+  sampler.min_lod         = 0.0f;
+  sampler.max_lod         = FLT_MAX;
+  sampler.shader_register = 0;
+  sampler.register_space  = 0;
+  sampler.shaders         = SHADER_VISIBILITY_PIXEL;
+
+  RootSignatureDesc desc;
+  desc.num_params   = 3;
+  desc.params       = params;
+  desc.num_samplers = 1;
+  desc.samplers     = &sampler;
+  desc.ia           = true;
+  desc.vs           = true;
+  desc.hs           = false;
+  desc.ds           = false;
+  desc.gs           = false;
+  desc.ps           = true;
+  desc.so           = false;
+
+  unique_ptr<RootSignatureConfig> from_desc(RootSignatureConfig::CreateD3D12(desc));
+  unique_ptr<RootSignatureConfig> from_setters(CreateTypicalConfig());
+  CHECK(from_desc->IsEquivalent(*from_setters));
+  CHECK(from_desc->GetHash() == from_setters->GetHash());
+}
+
+TEST(RootSignatureConfigEveryFieldChangesTheKey)
+{
+  unique_ptr<RootSignatureConfig> base(CreateTypicalConfig());
+
+  // each variant differs from the typical config in exactly 1 field
+  vector<RootSignatureConfig*> variants;
+  for (int i = 0; i < 14; i++)
+  {
+    variants.push_back(CreateTypicalConfig());
+  }
+  variants[0]->SetStageAccess(true, true, false, false, false, true, true);
+  variants[1]->SetStageAccess(false, true, false, false, false, true, false);
+  variants[2]->SetParamAsConstantBufferView(0, 1, 0, SHADER_VISIBILITY_VERTEX);
+  variants[3]->SetParamAsConstantBufferView(0, 0, 1, SHADER_VISIBILITY_VERTEX);
+  variants[4]->SetParamAsConstantBufferView(0, 0, 0, SHADER_VISIBILITY_ALL);
+  variants[5]->SetParamAsConstantBufferView(0, 0, 0, SHADER_VISIBILITY_VERTEX, ROOT_FLAGS_DATA_STATIC);
+  variants[6]->SetParamAsShaderResourceView(0, 0, 0, SHADER_VISIBILITY_VERTEX);
+  variants[7]->SetRangeAsShaderResourceView(1, 0, 5, 0, 0, ROOT_FLAGS_DATA_STATIC);
+  variants[8]->SetRangeAsShaderResourceView(1, 0, 4, 0, 0, ROOT_FLAGS_VOLATILE);
+  variants[9]->SetRangeAsConstantBufferView(1, 0, 4, 0, 0, ROOT_FLAGS_DATA_STATIC);
+  variants[10]->SetParamAsConstants(2, 1, 0, 5, SHADER_VISIBILITY_ALL);
+  variants[11]->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0.0f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, 0.0f, 0, 0, SHADER_VISIBILITY_PIXEL);
+  variants[12]->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_POINT, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0.0f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL);
+  variants[13]->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_CLAMP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0.0f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL);
+
+  for (size_t i = 0; i < variants.size(); i++)
+  {
+    CHECK(!base->IsEquivalent(*variants[i]));
+    CHECK(!variants[i]->IsEquivalent(*base));
+    CHECK(base->GetHash() != variants[i]->GetHash());
+    for (size_t j = i + 1; j < variants.size(); j++)
+    {
+      CHECK(!variants[i]->IsEquivalent(*variants[j]));
+    }
+  }
+
+  for (size_t i = 0; i < variants.size(); i++)
+  {
+    delete variants[i];
+  }
+}
+
+TEST(RootSignatureConfigSizeChangesTheKey)
+{
+  // a config with an extra, otherwise identical sampler must not collide with the original
+  unique_ptr<RootSignatureConfig> one(CreateTypicalConfig());
+  unique_ptr<RootSignatureConfig> two(RootSignatureConfig::CreateD3D12(3, 2));
+  two->SetStageAccess(true, true, false, false, false, true, false);
+  two->SetParamAsConstantBufferView(0, 0, 0, SHADER_VISIBILITY_VERTEX);
+  two->SetParamAsDescriptorTable(1, 2, SHADER_VISIBILITY_PIXEL);
+  two->SetRangeAsShaderResourceView(1, 0, 4, 0, 0, ROOT_FLAGS_DATA_STATIC);
+  two->SetRangeAsUnorderedAccessView(1, 1, 1, 0, 0);
+  two->SetParamAsConstants(2, 1, 0, 4, SHADER_VISIBILITY_ALL);
+  for (UINT i = 0; i < 2; i++)
+  {
+    two->SetSampler(i, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0.0f,
+      1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL);
+  }
+
+  CHECK(!one->IsEquivalent(*two));
+  CHECK(one->GetHash() != two->GetHash());
+}
+
+TEST(RootSignatureConfigSamplerRangesDropDataFlags)
+{
+  // samplers have no data, so only the descriptor volatility of their ranges reaches the key
+  unique_ptr<RootSignatureConfig> a(RootSignatureConfig::CreateD3D12(1, 0));
+  unique_ptr<RootSignatureConfig> b(RootSignatureConfig::CreateD3D12(1, 0));
+  a->SetStageAccess(false, true, false, false, false, true, false);
+  b->SetStageAccess(false, true, false, false, false, true, false);
+  a->SetParamAsDescriptorTable(0, 1, SHADER_VISIBILITY_PIXEL);
+  b->SetParamAsDescriptorTable(0, 1, SHADER_VISIBILITY_PIXEL);
+  a->SetRangeAsSampler(0, 0, 2, 0, 0, ROOT_FLAGS_VOLATILE);
+  b->SetRangeAsSampler(0, 0, 2, 0, 0, ROOT_FLAGS_DESCRIPTORS_VOLATILE);
+
+  CHECK(a->IsEquivalent(*b));
+  CHECK(a->GetHash() == b->GetHash());
+}
+
+TEST(RootSignatureConfigNegativeZeroSamplerFieldsShareAKey)
+{
+  // -0 and 0 compare equal and make the same sampler, so they must not split the cache
+  unique_ptr<RootSignatureConfig> positive(CreateTypicalConfig());
+  unique_ptr<RootSignatureConfig> negative(CreateTypicalConfig());
+  negative->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, -0.0f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, -0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL);
+
+  CHECK(positive->IsEquivalent(*negative));
+  CHECK(positive->GetHash() == negative->GetHash());
+}
+
+TEST(RootSignatureConfigVersion1_0DropsFlags)
+{
+  unique_ptr<RootSignatureConfig> config(CreateTypicalConfig());
+  const D3D12_RootSignatureConfig& d3d12_config = (const D3D12_RootSignatureConfig&)*config;
+
+  D3D12_ROOT_SIGNATURE_DESC desc;
+  vector<D3D12_ROOT_PARAMETER> params;
+  vector<D3D12_DESCRIPTOR_RANGE> ranges;
+  d3d12_config.GetDescVersion1_0(desc, params, ranges);
+
+  CHECK(desc.NumParameters == 3);
+  CHECK(desc.NumStaticSamplers == 1);
+  CHECK(desc.Flags == d3d12_config.GetDesc().Flags);
+  CHECK(ranges.size() == 2);
+  CHECK(desc.pParameters[0].ParameterType == D3D12_ROOT_PARAMETER_TYPE_CBV);
+  CHECK(desc.pParameters[0].ShaderVisibility == D3D12_SHADER_VISIBILITY_VERTEX);
+  CHECK(desc.pParameters[1].DescriptorTable.NumDescriptorRanges == 2);
+  CHECK(desc.pParameters[1].DescriptorTable.pDescriptorRanges == &ranges[0]);
+  CHECK(ranges[0].RangeType == D3D12_DESCRIPTOR_RANGE_TYPE_SRV);
+  CHECK(ranges[0].NumDescriptors == 4);
+  CHECK(ranges[1].RangeType == D3D12_DESCRIPTOR_RANGE_TYPE_UAV);
+  CHECK(desc.pParameters[2].Constants.Num32BitValues == 4);
+}
+
+TEST(RootSignatureConfigRejectsOutOfRangeIndices)
+{
+  unique_ptr<RootSignatureConfig> config(RootSignatureConfig::CreateD3D12(1, 1));
+  CHECK_THROWS(config->SetParamAsConstants(1, 0, 0, 1, SHADER_VISIBILITY_ALL));
+  CHECK_THROWS(config->SetSampler(1, TEXTURE_FILTER_MIN_MAG_MIP_POINT, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP,
+    0.0f, 1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_ALL));
+
+  config->SetParamAsConstants(0, 0, 0, 1, SHADER_VISIBILITY_ALL);
+  CHECK_THROWS(config->SetRangeAsShaderResourceView(0, 0, 1, 0, 0));
+  CHECK_THROWS(config->SetParamAsConstantBufferView(0, 0, 0, SHADER_VISIBILITY_ALL, (RootDescriptorFlags)(ROOT_FLAGS_DATA_STATIC | ROOT_FLAGS_DATA_VOLATILE)));
+}
+
+TEST(RootSignatureConfigRejectsVolatileDescriptorsOverStaticData)
+{
+  unique_ptr<RootSignatureConfig> config(RootSignatureConfig::CreateD3D12(2, 0));
+  config->SetParamAsDescriptorTable(0, 1, SHADER_VISIBILITY_PIXEL);
+  config->SetParamAsDescriptorTable(1, 1, SHADER_VISIBILITY_PIXEL);
+  RootDescriptorFlags volatile_static = (RootDescriptorFlags)(ROOT_FLAGS_DESCRIPTORS_VOLATILE | ROOT_FLAGS_DATA_STATIC);
+  CHECK_THROWS(config->SetRangeAsShaderResourceView(0, 0, 1, 0, 0, volatile_static));
+  CHECK_THROWS(config->SetRangeAsConstantBufferView(0, 0, 1, 0, 0, volatile_static));
+  CHECK_THROWS(config->SetRangeAsUnorderedAccessView(0, 0, 1, 0, 0, volatile_static));
+
+  // data that is only static while set is fine with volatile descriptors, and samplers have no data to be static
+  config->SetRangeAsShaderResourceView(0, 0, 1, 0, 0, (RootDescriptorFlags)(ROOT_FLAGS_DESCRIPTORS_VOLATILE | ROOT_FLAGS_DATA_STATIC_WHILE_SET_AT_EXECUTE));
+  config->SetRangeAsSampler(1, 0, 1, 0, 0, volatile_static);
+}
@@ -0,0 +1,122 @@
+#include <float.h>
+#include <memory>
+#include <string.h>
+#include "TestHarness.h"
+#include "Graphics/RootSignatureLayout.h"
+#include "RecordingCommandList.h"
+using namespace std;
+
+/// <summary>
+/// Layout fps_monitor uses to draw its text
+/// </summary>
+typedef RootSig<RootTable<SHADER_VISIBILITY_PIXEL, RangeSRV<0, 1, 0, ROOT_FLAGS_DATA_STATIC> >,
+                RootCBV<0, SHADER_VISIBILITY_VERTEX, 0, ROOT_FLAGS_DATA_STATIC>,
+                StaticSampler<0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, SHADER_VISIBILITY_PIXEL, 0, 1, COMPARISON_FUNC_NEVER,
+                  BORDER_COLOR_TRANSPARENT_BLACK, 0> > FPSMonitorRootSig;
+
+/// <summary>
+/// Builds the config fps_monitor used to build through the setters, before it had a compile time layout
+/// </summary>
+/// <param name="max_lod">
+/// max LOD of the static sampler
+/// </param>
+static RootSignatureConfig* CreateFPSMonitorConfig(float max_lod)
+{
+  RootSignatureConfig* config = RootSignatureConfig::CreateD3D12(2, 1);
+  config->SetStageAccess(true, true, false, false, false, true, false);
+  config->SetParamAsDescriptorTable(0, 1, SHADER_VISIBILITY_PIXEL);
+  config->SetRangeAsShaderResourceView(0, 0, 1, 0, 0, ROOT_FLAGS_DATA_STATIC);
+  config->SetParamAsConstantBufferView(1, 0, 0, SHADER_VISIBILITY_VERTEX, ROOT_FLAGS_DATA_STATIC);
+  config->SetSampler(0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_WRAP, 0, 1,
+    COMPARISON_FUNC_NEVER, BORDER_COLOR_TRANSPARENT_BLACK, 0, max_lod, 0, 0, SHADER_VISIBILITY_PIXEL);
+  return config;
+}
+
+TEST(RootSignatureLayoutMatchesHandBuiltConfig)
+{
+  unique_ptr<RootSignatureConfig> layout(FPSMonitorRootSig::CreateConfigD3D12(true, true, false, false, false, true, false));
+  unique_ptr<RootSignatureConfig> top_level_only(CreateFPSMonitorConfig(0));
+  unique_ptr<RootSignatureConfig> every_level(CreateFPSMonitorConfig(FLT_MAX));
+
+  CHECK(FPSMonitorRootSig::cost == 3);
+  CHECK(FPSMonitorRootSig::num_params == 2);
+  CHECK(FPSMonitorRootSig::num_samplers == 1);
+  CHECK(layout->IsEquivalent(*top_level_only));
+  CHECK(!layout->IsEquivalent(*every_level));
+}
+
+TEST(RootSignatureLayoutStaticSamplerMaxLOD)
+{
+  RootSamplerDesc samplers[3];
+  UINT next_param = 0;
+  UINT next_sampler = 0;
+  StaticSampler<0, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_CLAMP>::Describe(NULL, next_param, samplers, next_sampler);
+  StaticSampler<1, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_CLAMP, SHADER_VISIBILITY_ALL, 0, 1, COMPARISON_FUNC_NEVER,
+    BORDER_COLOR_TRANSPARENT_BLACK, 0>::Describe(NULL, next_param, samplers, next_sampler);
+  StaticSampler<2, TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_CLAMP, SHADER_VISIBILITY_ALL, 0, 1, COMPARISON_FUNC_NEVER,
+    BORDER_COLOR_TRANSPARENT_BLACK, 4>::Describe(NULL, next_param, samplers, next_sampler);
+
+  CHECK(next_param == 0 && next_sampler == 3);
+  CHECK(samplers[0].max_lod == FLT_MAX);
+  CHECK(samplers[1].max_lod == 0);
+  CHECK(samplers[2].max_lod == 4 && samplers[2].shader_register == 2);
+  CHECK(samplers[0].min_lod == 0 && samplers[0].mip_lod_bias == 0);
+}
+
+/// <summary>
+/// Per draw constants of a layout with a constant buffer followed by root constants
+/// </summary>
+struct DrawConstants
+{
+  float tint[3];
+  UINT instance_base;
+  INT depth_bias;
+};
+
+typedef RootSig<RootCBV<0, SHADER_VISIBILITY_VERTEX>, RootConstants<1, 6, SHADER_VISIBILITY_ALL> > DrawConstantsRootSig;
+
+/// <summary>
+/// Bit pattern of a float as it lands in a 32-bit root constant
+/// </summary>
+static UINT FloatBits(float value)
+{
+  UINT bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+TEST(RootSignatureLayoutSetConstantsEncodesValues)
+{
+  RecordingCommandList command_list;
+  const DrawConstants constants = { { 0.25f, -1.5f, 3.0e-8f }, 4096, -7 };
+  DrawConstantsRootSig::SetConstants<1>(command_list, constants);
+
+  CHECK(command_list.root_constants.size() == 1);
+  const RecordedRootConstants& recorded = command_list.root_constants[0];
+  CHECK(recorded.slot == 1);
+  CHECK(recorded.dest_offset == 0);
+  CHECK(recorded.values.size() == 5);
+  CHECK(recorded.values[0] == FloatBits(0.25f));
+  CHECK(recorded.values[1] == FloatBits(-1.5f));
+  CHECK(recorded.values[2] == FloatBits(3.0e-8f));
+  CHECK(recorded.values[3] == 4096);
+  CHECK(recorded.values[4] == 0xfffffff9);
+}
+
+TEST(CommandListSetRootConstantsEncodesValuesAtOffset)
+{
+  RecordingCommandList command_list;
+  const UINT raw[] = { 1, 0x80000000, 0xdeadbeef };
+  command_list.SetRootConstants(2, 3, raw, 5);
+  const float scale = 0.5f;
+  command_list.SetRootConstants(2, scale, 8);
+
+  CHECK(command_list.root_constants.size() == 2);
+  CHECK(command_list.root_constants[0].slot == 2 && command_list.root_constants[0].dest_offset == 5);
+  CHECK(command_list.root_constants[0].values.size() == 3);
+  CHECK(command_list.root_constants[0].values[0] == 1);
+  CHECK(command_list.root_constants[0].values[1] == 0x80000000);
+  CHECK(command_list.root_constants[0].values[2] == 0xdeadbeef);
+  CHECK(command_list.root_constants[1].slot == 2 && command_list.root_constants[1].dest_offset == 8);
+  CHECK(command_list.root_constants[1].values.size() == 1 && command_list.root_constants[1].values[0] == FloatBits(0.5f));
+}
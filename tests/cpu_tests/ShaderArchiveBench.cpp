@@ -0,0 +1,75 @@
+#include <string.h>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "ShaderArchiveFixture.h"
+using namespace std;
+
+BENCHMARK(ShaderArchiveValidateAndFind)
+{
+  // roughly the size of a game's shader set, with bytecode around the size of a typical compiled shader
+  const unsigned NUM_SHADERS = 4096;
+  vector<ShaderArchiveShader> shaders;
+  for (unsigned i = 0; i < NUM_SHADERS; i++)
+  {
+    shaders.push_back(MakeFixtureShader(i, 1024 + (i % 8) * 512));
+  }
+  vector<uint8_t> archive = BuildShaderArchive(shaders);
+
+  vector<string> names(NUM_SHADERS);
+  for (unsigned i = 0; i < NUM_SHADERS; i++)
+  {
+    names[i] = MakeFixtureShader((i * 2654435761u) % NUM_SHADERS, 0).name;
+  }
+
+  const int VALIDATE_PASSES = 200;
+  double start = BenchSeconds();
+  size_t num_valid = 0;
+  for (int pass = 0; pass < VALIDATE_PASSES; pass++)
+  {
+    num_valid += ShaderArchiveFormat::Validate(&archive[0], archive.size()) == NULL;
+  }
+  double validate = (BenchSeconds() - start) / VALIDATE_PASSES;
+
+  const int FIND_PASSES = 200;
+  start = BenchSeconds();
+  size_t num_found = 0;
+  for (int pass = 0; pass < FIND_PASSES; pass++)
+  {
+    for (unsigned i = 0; i < NUM_SHADERS; i++)
+    {
+      num_found += ShaderArchiveFormat::Find(&archive[0], names[i].c_str()) != NULL;
+    }
+  }
+  double find = (BenchSeconds() - start) / ((double)FIND_PASSES * NUM_SHADERS);
+
+  // baseline: what a linear scan by name costs on the same index
+  const ShaderArchiveEntry* entries = (const ShaderArchiveEntry*)&archive[sizeof(ShaderArchiveHeader)];
+  const int SCAN_PASSES = 2;
+  start = BenchSeconds();
+  size_t num_scanned = 0;
+  for (int pass = 0; pass < SCAN_PASSES; pass++)
+  {
+    for (unsigned i = 0; i < NUM_SHADERS; i++)
+    {
+      for (unsigned j = 0; j < NUM_SHADERS; j++)
+      {
+        if (strcmp((const char*)&archive[entries[j].name_offset], names[i].c_str()) == 0)
+        {
+          num_scanned++;
+          break;
+        }
+      }
+    }
+  }
+  double scan = (BenchSeconds() - start) / ((double)SCAN_PASSES * NUM_SHADERS);
+
+  CHECK(num_valid == (size_t)VALIDATE_PASSES);
+  CHECK(num_found == (size_t)FIND_PASSES * NUM_SHADERS);
+  CHECK(num_scanned == (size_t)SCAN_PASSES * NUM_SHADERS);
+
+  ReportBenchmark("archive size", archive.size() / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("validate 4096 entry index", validate * 1e6, "us");
+  ReportBenchmark("find, hash + binary search", find * 1e9, "ns/lookup");
+  ReportBenchmark("find, linear scan by name (baseline)", scan * 1e9, "ns/lookup");
+}
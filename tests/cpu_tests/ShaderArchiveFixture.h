@@ -0,0 +1,47 @@
+#ifndef SHADER_ARCHIVE_FIXTURE_H
+#define SHADER_ARCHIVE_FIXTURE_H
+
+#include <stdio.h>
+#include <vector>
+#include "private_inc/ShaderArchiveFormat.h"
+
+/// <summary>
+/// Packs shaders into an in memory archive with the packing tools/shader_archive_builder uses
+/// </summary>
+/// <param name="shaders">
+/// shaders to pack.  Sorted into index order
+/// </param>
+/// <returns>
+/// bytes of the archive.  The vector's storage is aligned enough for the index entries
+/// </returns>
+inline std::vector<uint8_t> BuildShaderArchive(std::vector<ShaderArchiveShader>& shaders)
+{
+  std::vector<uint8_t> archive;
+  ShaderArchiveFormat::Pack(shaders, archive);
+  return archive;
+}
+
+/// <summary>
+/// Makes a shader with a recognizable name and bytecode
+/// </summary>
+/// <param name="index">
+/// number of the shader
+/// </param>
+/// <param name="size">
+/// number of bytes of bytecode
+/// </param>
+/// <returns>
+/// shader named shader_<index>.cso whose bytecode bytes are all the low byte of index
+/// </returns>
+inline ShaderArchiveShader MakeFixtureShader(unsigned index, size_t size)
+{
+  char name[32];
+  snprintf(name, sizeof(name), "shader_%u.cso", index);
+
+  ShaderArchiveShader shader;
+  shader.name = name;
+  shader.bytecode.assign(size, (uint8_t)index);
+  return shader;
+}
+
+#endif /* SHADER_ARCHIVE_FIXTURE_H */
@@ -0,0 +1,133 @@
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "ShaderArchiveFixture.h"
+using namespace std;
+
+TEST(ShaderArchiveFindsEveryShader)
+{
+  vector<ShaderArchiveShader> shaders;
+  for (unsigned i = 0; i < 100; i++)
+  {
+    shaders.push_back(MakeFixtureShader(i, 1 + i * 7));
+  }
+  vector<uint8_t> archive = BuildShaderArchive(shaders);
+
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) == NULL);
+  for (unsigned i = 0; i < 100; i++)
+  {
+    ShaderArchiveShader expected = MakeFixtureShader(i, 1 + i * 7);
+    const ShaderArchiveEntry* entry = ShaderArchiveFormat::Find(&archive[0], expected.name.c_str());
+    CHECK(entry != NULL);
+    if (entry != NULL)
+    {
+      CHECK(entry->data_offset % SHADER_ARCHIVE_ALIGNMENT == 0);
+      CHECK(entry->data_size == expected.bytecode.size());
+      CHECK(memcmp(&archive[entry->data_offset], &expected.bytecode[0], entry->data_size) == 0);
+    }
+  }
+
+  CHECK(ShaderArchiveFormat::Find(&archive[0], "shader_100.cso") == NULL);
+  CHECK(ShaderArchiveFormat::Find(&archive[0], "shader_1") == NULL);
+  CHECK(ShaderArchiveFormat::Find(&archive[0], "") == NULL);
+}
+
+TEST(ShaderArchivePackingDoesNotDependOnListOrder)
+{
+  // directory listings come back in any order, and the archive must come out the same
+  vector<ShaderArchiveShader> forward;
+  vector<ShaderArchiveShader> backward;
+  for (unsigned i = 0; i < 20; i++)
+  {
+    forward.push_back(MakeFixtureShader(i, 5 + i));
+    backward.push_back(MakeFixtureShader(19 - i, 24 - i));
+  }
+  vector<uint8_t> forward_archive = BuildShaderArchive(forward);
+  vector<uint8_t> backward_archive = BuildShaderArchive(backward);
+
+  CHECK(forward_archive == backward_archive);
+  const ShaderArchiveHeader* header = (const ShaderArchiveHeader*)&forward_archive[0];
+  CHECK(header->magic == SHADER_ARCHIVE_MAGIC && header->num_entries == 20);
+}
+
+TEST(ShaderArchiveEmptyIsValid)
+{
+  vector<ShaderArchiveShader> shaders;
+  vector<uint8_t> archive = BuildShaderArchive(shaders);
+
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) == NULL);
+  CHECK(ShaderArchiveFormat::Find(&archive[0], "shader_0.cso") == NULL);
+}
+
+TEST(ShaderArchiveComparesNamesOnHashCollisions)
+{
+  vector<ShaderArchiveShader> shaders;
+  shaders.push_back(MakeFixtureShader(1, 16));
+  shaders.push_back(MakeFixtureShader(2, 16));
+  shaders.push_back(MakeFixtureShader(3, 16));
+  vector<uint8_t> archive = BuildShaderArchive(shaders);
+
+  // give every entry the hash of the middle one, which keeps the index sorted, so only the name comparison can pick
+  // the right entry out of the run
+  ShaderArchiveEntry* entries = (ShaderArchiveEntry*)&archive[sizeof(ShaderArchiveHeader)];
+  const uint64_t hash = ShaderArchiveHash("shader_2.cso", strlen("shader_2.cso"));
+  for (int i = 0; i < 3; i++)
+  {
+    entries[i].name_hash = hash;
+  }
+
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) == NULL);
+  const ShaderArchiveEntry* entry = ShaderArchiveFormat::Find(&archive[0], "shader_2.cso");
+  CHECK(entry != NULL && archive[entry->data_offset] == 2);
+  CHECK(ShaderArchiveFormat::Find(&archive[0], "shader_1.cso") == NULL);
+}
+
+TEST(ShaderArchiveRejectsCorruptFiles)
+{
+  vector<ShaderArchiveShader> shaders;
+  shaders.push_back(MakeFixtureShader(1, 64));
+  shaders.push_back(MakeFixtureShader(2, 64));
+  const vector<uint8_t> valid = BuildShaderArchive(shaders);
+
+  CHECK(ShaderArchiveFormat::Validate(&valid[0], sizeof(ShaderArchiveHeader) - 1) != NULL);
+  CHECK(ShaderArchiveFormat::Validate(&valid[0], valid.size() - 1) != NULL);
+
+  vector<uint8_t> archive = valid;
+  ShaderArchiveHeader* header = (ShaderArchiveHeader*)&archive[0];
+  ShaderArchiveEntry* entries = (ShaderArchiveEntry*)&archive[sizeof(ShaderArchiveHeader)];
+
+  header->magic = 0;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  header->version = SHADER_ARCHIVE_VERSION + 1;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  header->num_entries = 0x10000000;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  header->index_offset += 4;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  archive[entries[0].name_offset + entries[0].name_length] = 'x';
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  entries[1].name_offset = (uint32_t)archive.size();
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  entries[0].data_offset += 1;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  entries[1].data_size += SHADER_ARCHIVE_ALIGNMENT;
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+
+  archive = valid;
+  swap(entries[0].name_hash, entries[1].name_hash);
+  CHECK(ShaderArchiveFormat::Validate(&archive[0], archive.size()) != NULL);
+}
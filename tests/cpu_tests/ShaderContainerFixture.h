@@ -0,0 +1,410 @@
+#ifndef SHADER_CONTAINER_FIXTURE_H
+#define SHADER_CONTAINER_FIXTURE_H
+
+// Builds DXBC containers in memory with the chunk layouts fxc and dxc write.  The repo does not keep compiled shaders,
+// since they are build outputs of the sample projects, so tests describe the chunks of those shaders with these
+// builders instead.
+
+#include <limits.h>
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include <windows.h>
+#include "Graphics/RootSignatureDesc.h"
+
+/// <summary>
+/// Builds the four character code that identifies a container chunk
+/// </summary>
+inline UINT FixtureFourCC(const char* code)
+{
+  return (UINT)(UINT8)code[0] | ((UINT)(UINT8)code[1] << 8) | ((UINT)(UINT8)code[2] << 16) | ((UINT)(UINT8)code[3] << 24);
+}
+
+/// <summary>
+/// Little endian byte writer with a string table that is appended after the fixed size part of a chunk
+/// </summary>
+class ChunkWriter
+{
+  public:
+    void WriteUINT(UINT value)
+    {
+      m_data.insert(m_data.end(), (const UINT8*)&value, (const UINT8*)&value + sizeof(value));
+    }
+
+    void WriteFloat(float value)
+    {
+      UINT bits;
+      memcpy(&bits, &value, sizeof(bits));
+      WriteUINT(bits);
+    }
+
+    void WriteBytes(UINT8 a, UINT8 b, UINT8 c, UINT8 d)
+    {
+      m_data.push_back(a);
+      m_data.push_back(b);
+      m_data.push_back(c);
+      m_data.push_back(d);
+    }
+
+    /// <summary>
+    /// Writes a placeholder for the offset of a string, which Finish fills in once the strings are placed
+    /// </summary>
+    void WriteStringOffset(const std::string& value)
+    {
+      m_strings.push_back(std::make_pair(m_data.size(), value));
+      WriteUINT(0);
+    }
+
+    /// <summary>
+    /// Overwrites a value written earlier, for offsets that are only known later
+    /// </summary>
+    void PatchUINT(size_t offset, UINT value)
+    {
+      memcpy(&m_data[offset], &value, sizeof(value));
+    }
+
+    size_t GetSize() const
+    {
+      return m_data.size();
+    }
+
+    /// <summary>
+    /// Appends the strings and fills in their offsets
+    /// </summary>
+    std::vector<UINT8> Finish()
+    {
+      for (size_t i = 0; i < m_strings.size(); i++)
+      {
+        PatchUINT(m_strings[i].first, (UINT)m_data.size());
+        m_data.insert(m_data.end(), m_strings[i].second.begin(), m_strings[i].second.end());
+        m_data.push_back('\0');
+      }
+      while (m_data.size() % 4 != 0)
+      {
+        m_data.push_back(0xAB);
+      }
+      m_strings.clear();
+      return m_data;
+    }
+
+  private:
+    std::vector<UINT8> m_data;
+    std::vector<std::pair<size_t, std::string> > m_strings;
+};
+
+/// <summary>
+/// Element of an input or output signature chunk
+/// </summary>
+struct FixtureSignatureElement
+{
+  const char* semantic_name;
+  UINT semantic_index;
+  UINT system_value;
+  UINT component_type;
+  UINT register_index;
+  UINT8 mask;
+  UINT8 rw_mask;
+  UINT stream;
+};
+
+/// <summary>
+/// Builds an ISGN/OSGN chunk (24 byte elements), OSG5 chunk (28 byte elements) or ISG1/OSG1 chunk (32 byte elements)
+/// </summary>
+inline std::vector<UINT8> BuildSignatureChunk(const FixtureSignatureElement* elements, UINT num_elements, UINT element_size)
+{
+  ChunkWriter writer;
+  writer.WriteUINT(num_elements);
+  writer.WriteUINT(8);
+  for (UINT i = 0; i < num_elements; i++)
+  {
+    const FixtureSignatureElement& element = elements[i];
+    if (element_size != 24)
+    {
+      writer.WriteUINT(element.stream);
+    }
+    writer.WriteStringOffset(element.semantic_name);
+    writer.WriteUINT(element.semantic_index);
+    writer.WriteUINT(element.system_value);
+    writer.WriteUINT(element.component_type);
+    writer.WriteUINT(element.register_index);
+    writer.WriteBytes(element.mask, element.rw_mask, 0, 0);
+    if (element_size == 32)
+    {
+      writer.WriteUINT(0);
+    }
+  }
+  return writer.Finish();
+}
+
+/// <summary>
+/// Constant buffer of a resource definition chunk
+/// </summary>
+struct FixtureConstantBuffer
+{
+  const char* name;
+  UINT num_variables;
+  UINT size;
+};
+
+/// <summary>
+/// Resource binding of a resource definition chunk
+/// </summary>
+struct FixtureBinding
+{
+  const char* name;
+  UINT type;
+  UINT bind_point;
+  UINT bind_count;
+  UINT space;
+};
+
+/// <summary>
+/// Builds an RDEF chunk the way fxc writes it for the shader model in version, which is major << 8 | minor with the
+/// shader type in the upper 16 bits.  5.1 and later have 40 byte bindings with a register space
+/// </summary>
+inline std::vector<UINT8> BuildResourceDefinitionChunk(const FixtureConstantBuffer* cbs, UINT num_cbs, const FixtureBinding* bindings, UINT num_bindings,
+  UINT version)
+{
+  const bool has_space = (version & 0xffff) >= 0x0501;
+
+  ChunkWriter writer;
+  writer.WriteUINT(num_cbs);
+  const size_t cb_offset = writer.GetSize();
+  writer.WriteUINT(0);
+  writer.WriteUINT(num_bindings);
+  const size_t bind_offset = writer.GetSize();
+  writer.WriteUINT(0);
+  writer.WriteUINT(version);
+  writer.WriteUINT(0x100);
+  writer.WriteStringOffset("Microsoft (R) HLSL Shader Compiler 10.1");
+
+  // shader model 5 headers carry the RD11 extension, which the parser skips
+  writer.WriteUINT(FixtureFourCC("RD11"));
+  for (int i = 0; i < 7; i++)
+  {
+    writer.WriteUINT(i == 0 ? 60 : 0);
+  }
+
+  writer.PatchUINT(bind_offset, (UINT)writer.GetSize());
+  for (UINT i = 0; i < num_bindings; i++)
+  {
+    writer.WriteStringOffset(bindings[i].name);
+    writer.WriteUINT(bindings[i].type);
+    writer.WriteUINT(bindings[i].type == 2 ? 5 : 0);
+    writer.WriteUINT(bindings[i].type == 2 ? 4 : 0);
+    writer.WriteUINT(bindings[i].type == 2 ? UINT_MAX : 0);
+    writer.WriteUINT(bindings[i].bind_point);
+    writer.WriteUINT(bindings[i].bind_count);
+    writer.WriteUINT(bindings[i].type == 2 ? 0xc : 0);
+    if (has_space)
+    {
+      writer.WriteUINT(bindings[i].space);
+      writer.WriteUINT(i);
+    }
+  }
+
+  writer.PatchUINT(cb_offset, (UINT)writer.GetSize());
+  for (UINT i = 0; i < num_cbs; i++)
+  {
+    writer.WriteStringOffset(cbs[i].name);
+    writer.WriteUINT(cbs[i].num_variables);
+    writer.WriteUINT(0);
+    writer.WriteUINT(cbs[i].size);
+    writer.WriteUINT(0);
+    writer.WriteUINT(0);
+  }
+  return writer.Finish();
+}
+
+/// <summary>
+/// Resource record of a PSV0 chunk
+/// </summary>
+struct FixturePSVResource
+{
+  UINT type;
+  UINT space;
+  UINT lower;
+  UINT upper;
+};
+
+/// <summary>
+/// Builds a PSV0 chunk the way dxc writes it, with runtime info of the given size and records of bind_size bytes
+/// </summary>
+inline std::vector<UINT8> BuildPipelineStateValidationChunk(const FixturePSVResource* resources, UINT num_resources, UINT runtime_info_size, UINT bind_size)
+{
+  ChunkWriter writer;
+  writer.WriteUINT(runtime_info_size);
+  for (UINT i = 0; i < runtime_info_size / 4; i++)
+  {
+    writer.WriteUINT(0xCDCDCDCD);
+  }
+  writer.WriteUINT(num_resources);
+  if (num_resources > 0)
+  {
+    writer.WriteUINT(bind_size);
+  }
+  for (UINT i = 0; i < num_resources; i++)
+  {
+    writer.WriteUINT(resources[i].type);
+    writer.WriteUINT(resources[i].space);
+    writer.WriteUINT(resources[i].lower);
+    writer.WriteUINT(resources[i].upper);
+    for (UINT j = 16; j < bind_size; j += 4)
+    {
+      writer.WriteUINT(0);
+    }
+  }
+  return writer.Finish();
+}
+
+/// <summary>
+/// Builds the RTS0 chunk of a root signature as version 1 (1.0) or 2 (1.1).  Every descriptor range is written right
+/// after the parameter array and the parameter payloads after that, so when there are no static samplers the payload of
+/// the last parameter ends exactly at the end of the chunk
+/// </summary>
+inline std::vector<UINT8> BuildRootSignatureChunk(const RootSignatureDesc& desc, UINT version)
+{
+  ChunkWriter writer;
+  writer.WriteUINT(version);
+  writer.WriteUINT(desc.num_params);
+  writer.WriteUINT(24);
+  writer.WriteUINT(desc.num_samplers);
+  const size_t sampler_offset = writer.GetSize();
+  writer.WriteUINT(0);
+  UINT flags = (desc.ia ? 0x1 : 0) | (desc.vs ? 0 : 0x2) | (desc.hs ? 0 : 0x4) | (desc.ds ? 0 : 0x8) | (desc.gs ? 0 : 0x10) | (desc.ps ? 0 : 0x20) |
+    (desc.so ? 0x40 : 0);
+  writer.WriteUINT(flags);
+
+  std::vector<size_t> payload_offsets(desc.num_params);
+  for (UINT i = 0; i < desc.num_params; i++)
+  {
+    writer.WriteUINT(desc.params[i].type);
+    writer.WriteUINT(desc.params[i].shaders);
+    payload_offsets[i] = writer.GetSize();
+    writer.WriteUINT(0);
+  }
+
+  std::vector<UINT> range_offsets(desc.num_params, 0);
+  for (UINT i = 0; i < desc.num_params; i++)
+  {
+    const RootParamDesc& param = desc.params[i];
+    if (param.type != ROOT_PARAM_DESCRIPTOR_TABLE)
+    {
+      continue;
+    }
+    range_offsets[i] = (UINT)writer.GetSize();
+    for (UINT j = 0; j < param.num_ranges; j++)
+    {
+      writer.WriteUINT(param.ranges[j].type);
+      writer.WriteUINT(param.ranges[j].num_descriptors);
+      writer.WriteUINT(param.ranges[j].base_shader_register);
+      writer.WriteUINT(param.ranges[j].register_space);
+      if (version != 1)
+      {
+        writer.WriteUINT(param.ranges[j].flags);
+      }
+      writer.WriteUINT(UINT_MAX);
+    }
+  }
+
+  for (UINT i = 0; i < desc.num_params; i++)
+  {
+    const RootParamDesc& param = desc.params[i];
+    writer.PatchUINT(payload_offsets[i], (UINT)writer.GetSize());
+    switch (param.type)
+    {
+      case ROOT_PARAM_DESCRIPTOR_TABLE:
+        writer.WriteUINT(param.num_ranges);
+        writer.WriteUINT(range_offsets[i]);
+        break;
+      case ROOT_PARAM_CONSTANTS:
+        writer.WriteUINT(param.shader_register);
+        writer.WriteUINT(param.register_space);
+        writer.WriteUINT(param.num_32bit_values);
+        break;
+      default:
+        writer.WriteUINT(param.shader_register);
+        writer.WriteUINT(param.register_space);
+        if (version != 1)
+        {
+          writer.WriteUINT(param.flags);
+        }
+        break;
+    }
+  }
+
+  writer.PatchUINT(sampler_offset, (UINT)writer.GetSize());
+  for (UINT i = 0; i < desc.num_samplers; i++)
+  {
+    const RootSamplerDesc& sampler = desc.samplers[i];
+    writer.WriteUINT(sampler.filter);
+    writer.WriteUINT(sampler.address_u);
+    writer.WriteUINT(sampler.address_v);
+    writer.WriteUINT(sampler.address_w);
+    writer.WriteFloat(sampler.mip_lod_bias);
+    writer.WriteUINT(sampler.max_anisotropy);
+    writer.WriteUINT(sampler.compare_func);
+    writer.WriteUINT(sampler.border_color);
+    writer.WriteFloat(sampler.min_lod);
+    writer.WriteFloat(sampler.max_lod);
+    writer.WriteUINT(sampler.shader_register);
+    writer.WriteUINT(sampler.register_space);
+    writer.WriteUINT(sampler.shaders);
+  }
+  return writer.Finish();
+}
+
+/// <summary>
+/// Chunk to put in a container
+/// </summary>
+struct FixtureChunk
+{
+  FixtureChunk(const char* fourcc, const std::vector<UINT8>& data)
+  :fourcc(FixtureFourCC(fourcc)),
+   data(data)
+  {
+  }
+
+  UINT fourcc;
+  std::vector<UINT8> data;
+};
+
+/// <summary>
+/// Builds a DXBC container around chunks.  The hash is left zero since the framework does not check it
+/// </summary>
+inline std::vector<UINT8> BuildShaderContainer(const std::vector<FixtureChunk>& chunks)
+{
+  ChunkWriter writer;
+  writer.WriteUINT(FixtureFourCC("DXBC"));
+  for (int i = 0; i < 4; i++)
+  {
+    writer.WriteUINT(0);
+  }
+  writer.WriteUINT(1);
+  const size_t size_offset = writer.GetSize();
+  writer.WriteUINT(0);
+  writer.WriteUINT((UINT)chunks.size());
+
+  const size_t table_offset = writer.GetSize();
+  for (size_t i = 0; i < chunks.size(); i++)
+  {
+    writer.WriteUINT(0);
+  }
+  for (size_t i = 0; i < chunks.size(); i++)
+  {
+    writer.PatchUINT(table_offset + i * 4, (UINT)writer.GetSize());
+    writer.WriteUINT(chunks[i].fourcc);
+    writer.WriteUINT((UINT)chunks[i].data.size());
+    for (size_t j = 0; j < chunks[i].data.size(); j += 4)
+    {
+      UINT value = 0;
+      memcpy(&value, &chunks[i].data[j], chunks[i].data.size() - j < 4 ? chunks[i].data.size() - j : 4);
+      writer.WriteUINT(value);
+    }
+  }
+  writer.PatchUINT(size_offset, (UINT)writer.GetSize());
+  return writer.Finish();
+}
+
+#endif /* SHADER_CONTAINER_FIXTURE_H */
@@ -0,0 +1,499 @@
+#include <float.h>
+#include <memory>
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "ShaderContainerFixture.h"
+#include "Graphics/RootSignatureConfig.h"
+#include "Graphics/ShaderReflection.h"
+#include "private_inc/D3D12/D3D12_InputLayout.h"
+using namespace std;
+
+/// <summary>
+/// D3D_REGISTER_COMPONENT_TYPE values
+/// </summary>
+static const UINT COMPONENT_UINT32  = 1;
+static const UINT COMPONENT_FLOAT32 = 3;
+
+/// <summary>
+/// D3D_NAME values fxc writes as the system value of signature elements
+/// </summary>
+static const UINT NAME_POSITION = 1;
+static const UINT NAME_TARGET   = 64;
+
+/// <summary>
+/// D3D_SHADER_INPUT_TYPE values
+/// </summary>
+static const UINT INPUT_CBUFFER = 0;
+static const UINT INPUT_TEXTURE = 2;
+static const UINT INPUT_SAMPLER = 3;
+
+/// <summary>
+/// Version of the RDEF chunk of vs_5_0, ps_5_0 and ps_5_1 shaders
+/// </summary>
+static const UINT RDEF_VS_5_0 = 0xFFFE0500;
+static const UINT RDEF_PS_5_0 = 0xFFFF0500;
+static const UINT RDEF_PS_5_1 = 0xFFFF0501;
+
+/// <summary>
+/// Builds the container fxc writes for fps_monitor/fps_monitor_vs.hlsl compiled as vs_5_0
+/// </summary>
+static vector<UINT8> BuildFpsMonitorVertexShader()
+{
+  const FixtureSignatureElement inputs[] =
+  {
+    { "POSITION", 0, 0, COMPONENT_FLOAT32, 0, 0x3, 0x3, 0 },
+    { "TEXCOORD", 0, 0, COMPONENT_FLOAT32, 1, 0x3, 0x3, 0 },
+    { "TEXCOORD", 1, 0, COMPONENT_UINT32,  2, 0x1, 0x1, 0 }
+  };
+  const FixtureSignatureElement outputs[] =
+  {
+    { "SV_POSITION", 0, NAME_POSITION, COMPONENT_FLOAT32, 0, 0xf, 0x0, 0 },
+    { "TEXCOORD",    0, 0,             COMPONENT_FLOAT32, 1, 0x3, 0xc, 0 }
+  };
+  const FixtureConstantBuffer cbs[] =
+  {
+    { "LOOKUP_TABLE", 1, 24 * 16 }
+  };
+  const FixtureBinding bindings[] =
+  {
+    { "LOOKUP_TABLE", INPUT_CBUFFER, 0, 1, 0 }
+  };
+
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("RDEF", BuildResourceDefinitionChunk(cbs, 1, bindings, 1, RDEF_VS_5_0)));
+  chunks.push_back(FixtureChunk("ISGN", BuildSignatureChunk(inputs, 3, 24)));
+  chunks.push_back(FixtureChunk("OSGN", BuildSignatureChunk(outputs, 2, 24)));
+  chunks.push_back(FixtureChunk("SHEX", vector<UINT8>(64, 0)));
+  chunks.push_back(FixtureChunk("STAT", vector<UINT8>(148, 0)));
+  return BuildShaderContainer(chunks);
+}
+
+/// <summary>
+/// Builds the container fxc writes for fps_monitor/fps_monitor_ps.hlsl compiled as ps_5_0
+/// </summary>
+static vector<UINT8> BuildFpsMonitorPixelShader()
+{
+  const FixtureSignatureElement inputs[] =
+  {
+    { "SV_POSITION", 0, NAME_POSITION, COMPONENT_FLOAT32, 0, 0xf, 0x0, 0 },
+    { "TEXCOORD",    0, 0,             COMPONENT_FLOAT32, 1, 0x3, 0x3, 0 }
+  };
+  const FixtureSignatureElement outputs[] =
+  {
+    { "SV_Target", 0, NAME_TARGET, COMPONENT_FLOAT32, 0, 0xf, 0x0, 0 }
+  };
+  const FixtureBinding bindings[] =
+  {
+    { "tex_sampler", INPUT_SAMPLER, 0, 1, 0 },
+    { "tex",         INPUT_TEXTURE, 0, 1, 0 }
+  };
+
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("RDEF", BuildResourceDefinitionChunk(NULL, 0, bindings, 2, RDEF_PS_5_0)));
+  chunks.push_back(FixtureChunk("ISGN", BuildSignatureChunk(inputs, 2, 24)));
+  chunks.push_back(FixtureChunk("OSGN", BuildSignatureChunk(outputs, 1, 24)));
+  chunks.push_back(FixtureChunk("SHEX", vector<UINT8>(64, 0)));
+  return BuildShaderContainer(chunks);
+}
+
+TEST(ShaderReflectionParsesFpsMonitorVertexShader)
+{
+  vector<UINT8> bytecode = BuildFpsMonitorVertexShader();
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  const vector<ShaderSignatureElement>& inputs = reflection->GetInputs();
+  CHECK(inputs.size() == 3);
+  if (inputs.size() == 3)
+  {
+    CHECK(inputs[0].semantic_name == "POSITION" && inputs[0].semantic_index == 0 && inputs[0].mask == 0x3);
+    CHECK(inputs[1].semantic_name == "TEXCOORD" && inputs[1].semantic_index == 0 && inputs[1].register_index == 1);
+    CHECK(inputs[2].semantic_name == "TEXCOORD" && inputs[2].semantic_index == 1 && inputs[2].component_type == SHADER_COMPONENT_UINT32);
+  }
+
+  const vector<ShaderSignatureElement>& outputs = reflection->GetOutputs();
+  CHECK(outputs.size() == 2);
+  if (outputs.size() == 2)
+  {
+    CHECK(outputs[0].semantic_name == "SV_POSITION" && outputs[0].system_value == NAME_POSITION && outputs[0].mask == 0xf);
+    CHECK(outputs[1].semantic_name == "TEXCOORD" && outputs[1].rw_mask == 0xc && outputs[1].stream == 0);
+  }
+
+  const vector<ShaderConstantBufferInfo>& cbs = reflection->GetConstantBuffers();
+  CHECK(cbs.size() == 1);
+  if (cbs.size() == 1)
+  {
+    CHECK(cbs[0].name == "LOOKUP_TABLE" && cbs[0].size == 384 && cbs[0].num_variables == 1);
+  }
+
+  const vector<ShaderResourceBinding>& resources = reflection->GetResources();
+  CHECK(resources.size() == 1);
+  if (resources.size() == 1)
+  {
+    CHECK(resources[0].name == "LOOKUP_TABLE" && resources[0].type == SHADER_RESOURCE_CBUFFER);
+    CHECK(resources[0].bind_point == 0 && resources[0].bind_count == 1 && resources[0].space == 0);
+  }
+
+  CHECK(!reflection->HasRootSignature());
+  CHECK_THROWS(reflection->CreateRootSignatureConfigD3D12());
+}
+
+TEST(ShaderReflectionBuildsFpsMonitorInputLayout)
+{
+  vector<UINT8> bytecode = BuildFpsMonitorVertexShader();
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+  unique_ptr<InputLayout> layout(reflection->CreateInputLayoutD3D12(1));
+
+  // matches the layout FPSMonitor builds by hand
+  const D3D12_InputLayout& d3d12_layout = (const D3D12_InputLayout&)*layout;
+  CHECK(d3d12_layout.GetNum() == 3 && d3d12_layout.GetNextIndex() == 3);
+  const D3D12_INPUT_ELEMENT_DESC* elements = d3d12_layout.GetLayout();
+  CHECK(strcmp(elements[0].SemanticName, "POSITION") == 0 && elements[0].SemanticIndex == 0 && elements[0].Format == R32G32_FLOAT);
+  CHECK(strcmp(elements[1].SemanticName, "TEXCOORD") == 0 && elements[1].SemanticIndex == 0 && elements[1].Format == R32G32_FLOAT);
+  CHECK(strcmp(elements[2].SemanticName, "TEXCOORD") == 0 && elements[2].SemanticIndex == 1 && elements[2].Format == R32_UINT);
+  for (int i = 0; i < 3; i++)
+  {
+    CHECK(elements[i].InputSlot == 1);
+    CHECK(elements[i].InputSlotClass == D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA);
+  }
+}
+
+TEST(ShaderReflectionParsesFpsMonitorPixelShader)
+{
+  vector<UINT8> bytecode = BuildFpsMonitorPixelShader();
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  CHECK(reflection->GetInputs().size() == 2);
+  CHECK(reflection->GetOutputs().size() == 1 && reflection->GetOutputs()[0].system_value == NAME_TARGET);
+  CHECK(reflection->GetConstantBuffers().empty());
+
+  const vector<ShaderResourceBinding>& resources = reflection->GetResources();
+  CHECK(resources.size() == 2);
+  if (resources.size() == 2)
+  {
+    CHECK(resources[0].name == "tex_sampler" && resources[0].type == SHADER_RESOURCE_SAMPLER && resources[0].bind_point == 0);
+    CHECK(resources[1].name == "tex" && resources[1].type == SHADER_RESOURCE_TEXTURE && resources[1].bind_point == 0);
+  }
+
+  // system values are filled in by the pipeline, so only TEXCOORD ends up in a layout
+  unique_ptr<InputLayout> layout(reflection->CreateInputLayoutD3D12());
+  CHECK(((const D3D12_InputLayout&)*layout).GetNum() == 1);
+}
+
+TEST(ShaderReflectionReadsRegisterSpacesFromShaderModel51)
+{
+  const FixtureBinding bindings[] =
+  {
+    { "materials", INPUT_TEXTURE, 4, 8, 2 },
+    { "samplers",  INPUT_SAMPLER, 0, 2, 1 }
+  };
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("RDEF", BuildResourceDefinitionChunk(NULL, 0, bindings, 2, RDEF_PS_5_1)));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  const vector<ShaderResourceBinding>& resources = reflection->GetResources();
+  CHECK(resources.size() == 2);
+  if (resources.size() == 2)
+  {
+    CHECK(resources[0].name == "materials" && resources[0].bind_point == 4 && resources[0].bind_count == 8 && resources[0].space == 2);
+    CHECK(resources[1].name == "samplers" && resources[1].bind_count == 2 && resources[1].space == 1);
+  }
+}
+
+TEST(ShaderReflectionReadsStreamsAndDxilSignatures)
+{
+  // a geometry shader writing 2 streams, as fxc writes it, and a dxc shader with the 32 byte layouts
+  const FixtureSignatureElement streams[] =
+  {
+    { "SV_POSITION", 0, NAME_POSITION, COMPONENT_FLOAT32, 0, 0xf, 0x0, 0 },
+    { "TEXCOORD",    0, 0,             COMPONENT_FLOAT32, 0, 0x7, 0x8, 1 }
+  };
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("ISG1", BuildSignatureChunk(streams, 1, 32)));
+  chunks.push_back(FixtureChunk("OSG5", BuildSignatureChunk(streams, 2, 28)));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  CHECK(reflection->GetInputs().size() == 1 && reflection->GetInputs()[0].semantic_name == "SV_POSITION");
+  const vector<ShaderSignatureElement>& outputs = reflection->GetOutputs();
+  CHECK(outputs.size() == 2);
+  if (outputs.size() == 2)
+  {
+    CHECK(outputs[0].stream == 0 && outputs[0].semantic_name == "SV_POSITION");
+    CHECK(outputs[1].stream == 1 && outputs[1].semantic_name == "TEXCOORD" && outputs[1].mask == 0x7 && outputs[1].rw_mask == 0x8);
+  }
+}
+
+TEST(ShaderReflectionReadsDxilResourcesWithoutNames)
+{
+  // PSVResourceType: 1 sampler, 2 CBV, 3 typed SRV, 7 raw UAV, 0 invalid
+  const FixturePSVResource resources[] =
+  {
+    { 2, 0, 0, 0 },
+    { 3, 1, 4, UINT_MAX },
+    { 0, 0, 0, 0 },
+    { 1, 0, 2, 3 },
+    { 7, 3, 1, 1 }
+  };
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("PSV0", BuildPipelineStateValidationChunk(resources, 5, 52, 24)));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  const vector<ShaderResourceBinding>& bindings = reflection->GetResources();
+  CHECK(bindings.size() == 4);
+  if (bindings.size() == 4)
+  {
+    CHECK(bindings[0].type == SHADER_RESOURCE_CBUFFER && bindings[0].bind_point == 0 && bindings[0].bind_count == 1);
+    CHECK(bindings[1].type == SHADER_RESOURCE_TEXTURE && bindings[1].bind_point == 4 && bindings[1].bind_count == 0 && bindings[1].space == 1);
+    CHECK(bindings[2].type == SHADER_RESOURCE_SAMPLER && bindings[2].bind_point == 2 && bindings[2].bind_count == 2);
+    CHECK(bindings[3].type == SHADER_RESOURCE_UAV_RWBYTEADDRESS && bindings[3].space == 3);
+  }
+}
+
+TEST(ShaderReflectionPrefersResourceDefinitions)
+{
+  const FixtureBinding named[] =
+  {
+    { "tex", INPUT_TEXTURE, 5, 1, 0 }
+  };
+  const FixturePSVResource unnamed[] =
+  {
+    { 3, 0, 5, 5 },
+    { 1, 0, 0, 0 }
+  };
+
+  // the names in RDEF win whichever order the chunks are in
+  for (int rdef_first = 0; rdef_first < 2; rdef_first++)
+  {
+    vector<FixtureChunk> chunks;
+    chunks.push_back(FixtureChunk("PSV0", BuildPipelineStateValidationChunk(unnamed, 2, 24, 16)));
+    chunks.insert(rdef_first ? chunks.begin() : chunks.end(), FixtureChunk("RDEF", BuildResourceDefinitionChunk(NULL, 0, named, 1, RDEF_PS_5_0)));
+    vector<UINT8> bytecode = BuildShaderContainer(chunks);
+    unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+    CHECK(reflection->GetResources().size() == 1 && reflection->GetResources()[0].name == "tex");
+  }
+}
+
+TEST(ShaderReflectionDetectsEmbeddedRootSignatures)
+{
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("RTS0", vector<UINT8>(24, 0)));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  CHECK(reflection->HasRootSignature());
+}
+
+TEST(ShaderReflectionRejectsMalformedContainers)
+{
+  const vector<UINT8> valid = BuildFpsMonitorVertexShader();
+
+  CHECK_THROWS(ShaderReflection::Parse(NULL, valid.size()));
+  CHECK_THROWS(ShaderReflection::Parse(&valid[0], 16));
+
+  vector<UINT8> bytecode = valid;
+  bytecode[0] = 'X';
+  CHECK_THROWS(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  // container size larger than the bytecode
+  CHECK_THROWS(ShaderReflection::Parse(&valid[0], valid.size() - 4));
+
+  // chunk that extends beyond the container
+  bytecode = valid;
+  UINT first_chunk;
+  memcpy(&first_chunk, &bytecode[32], sizeof(first_chunk));
+  UINT huge = 0x7fffffff;
+  memcpy(&bytecode[first_chunk + 4], &huge, sizeof(huge));
+  CHECK_THROWS(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  // signature elements that extend beyond their chunk
+  const FixtureSignatureElement element = { "POSITION", 0, 0, COMPONENT_FLOAT32, 0, 0x3, 0x3, 0 };
+  vector<UINT8> signature = BuildSignatureChunk(&element, 1, 24);
+  signature[0] = 200;
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("ISGN", signature));
+  bytecode = BuildShaderContainer(chunks);
+  CHECK_THROWS(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+
+  // semantic name with no terminator before the end of the chunk
+  signature = BuildSignatureChunk(&element, 1, 24);
+  signature.resize(signature.size() - 4);
+  while (signature.back() != 'N')
+  {
+    signature.pop_back();
+  }
+  chunks.clear();
+  chunks.push_back(FixtureChunk("ISGN", signature));
+  bytecode = BuildShaderContainer(chunks);
+  CHECK_THROWS(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+}
+
+TEST(ShaderReflectionRejectsInputsWithoutAVertexFormat)
+{
+  const FixtureSignatureElement unknown_semantic = { "BONES", 0, 0, COMPONENT_FLOAT32, 0, 0xf, 0xf, 0 };
+  const FixtureSignatureElement unknown_type     = { "POSITION", 0, 0, 0, 0, 0xf, 0xf, 0 };
+
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("ISGN", BuildSignatureChunk(&unknown_semantic, 1, 24)));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+  CHECK_THROWS(delete reflection->CreateInputLayoutD3D12());
+
+  chunks.clear();
+  chunks.push_back(FixtureChunk("ISGN", BuildSignatureChunk(&unknown_type, 1, 24)));
+  bytecode = BuildShaderContainer(chunks);
+  reflection.reset(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+  CHECK_THROWS(delete reflection->CreateInputLayoutD3D12());
+}
+
+/// <summary>
+/// Wraps an RTS0 chunk in a container and builds the config of its root signature
+/// </summary>
+static RootSignatureConfig* CreateEmbeddedRootSignature(const vector<UINT8>& rts0)
+{
+  vector<FixtureChunk> chunks;
+  chunks.push_back(FixtureChunk("RTS0", rts0));
+  vector<UINT8> bytecode = BuildShaderContainer(chunks);
+  unique_ptr<ShaderReflection> reflection(ShaderReflection::Parse(&bytecode[0], bytecode.size()));
+  return reflection->CreateRootSignatureConfigD3D12();
+}
+
+/// <summary>
+/// Root signature with every parameter type and a static sampler, with flags other than the defaults on the ranges and
+/// root descriptors so versions 1.0 and 1.1 decode differently
+/// </summary>
+static const RootRangeDesc EMBEDDED_RANGES[] =
+{
+  { ROOT_RANGE_SRV, 4, 0, 0, ROOT_FLAGS_DATA_STATIC },
+  { ROOT_RANGE_UAV, 1, 0, 1, ROOT_FLAGS_NONE }
+};
+
+static RootSignatureDesc GetEmbeddedRootSignatureDesc(RootParamDesc* params, RootSamplerDesc* sampler)
+{
+  const RootParamDesc table     = { ROOT_PARAM_DESCRIPTOR_TABLE, 0, 0, 0, 2, EMBEDDED_RANGES, ROOT_FLAGS_VOLATILE, SHADER_VISIBILITY_PIXEL };
+  const RootParamDesc cbv       = { ROOT_PARAM_CBV, 1, 0, 0, 0, NULL, ROOT_FLAGS_DATA_STATIC, SHADER_VISIBILITY_VERTEX };
+  const RootParamDesc srv       = { ROOT_PARAM_SRV, 2, 3, 0, 0, NULL, ROOT_FLAGS_NONE, SHADER_VISIBILITY_ALL };
+  const RootParamDesc uav       = { ROOT_PARAM_UAV, 1, 0, 0, 0, NULL, ROOT_FLAGS_DATA_VOLATILE, SHADER_VISIBILITY_PIXEL };
+  const RootParamDesc constants = { ROOT_PARAM_CONSTANTS, 3, 0, 4, 0, NULL, ROOT_FLAGS_VOLATILE, SHADER_VISIBILITY_ALL };
+  params[0] = table;
+  params[1] = cbv;
+  params[2] = srv;
+  params[3] = uav;
+  params[4] = constants;
+
+  const RootSamplerDesc linear = { TEXTURE_FILTER_MIN_MAG_MIP_LINEAR, TEXTURE_ADDRESS_MODE_WRAP, TEXTURE_ADDRESS_MODE_CLAMP, TEXTURE_ADDRESS_MODE_WRAP, 0.5f,
+    1, COMPARISON_FUNC_NEVER, BORDER_COLOR_OPAQUE_BLACK, 0.0f, FLT_MAX, 0, 0, SHADER_VISIBILITY_PIXEL };
+  *sampler = linear;
+
+  const RootSignatureDesc desc = { 5, params, 1, sampler, true, true, false, false, false, true, false };
+  return desc;
+}
+
+TEST(ShaderReflectionKeepsVersion11RootSignatureFlags)
+{
+  RootParamDesc params[5];
+  RootSamplerDesc sampler;
+  const RootSignatureDesc desc = GetEmbeddedRootSignatureDesc(params, &sampler);
+
+  unique_ptr<RootSignatureConfig> embedded(CreateEmbeddedRootSignature(BuildRootSignatureChunk(desc, 2)));
+  unique_ptr<RootSignatureConfig> expected(RootSignatureConfig::CreateD3D12(desc));
+
+  CHECK(embedded->IsEquivalent(*expected));
+}
+
+TEST(ShaderReflectionTreatsVersion10RootSignaturesAsVolatile)
+{
+  RootParamDesc params[5];
+  RootSamplerDesc sampler;
+  const RootSignatureDesc desc = GetEmbeddedRootSignatureDesc(params, &sampler);
+  unique_ptr<RootSignatureConfig> embedded(CreateEmbeddedRootSignature(BuildRootSignatureChunk(desc, 1)));
+
+  // version 1.0 has no flags, and the runtime treats everything as volatile
+  RootRangeDesc volatile_ranges[2] = { EMBEDDED_RANGES[0], EMBEDDED_RANGES[1] };
+  volatile_ranges[0].flags = ROOT_FLAGS_VOLATILE;
+  volatile_ranges[1].flags = ROOT_FLAGS_VOLATILE;
+  params[0].ranges = volatile_ranges;
+  for (UINT i = 0; i < 5; i++)
+  {
+    params[i].flags = ROOT_FLAGS_VOLATILE;
+  }
+  unique_ptr<RootSignatureConfig> expected(RootSignatureConfig::CreateD3D12(desc));
+  CHECK(embedded->IsEquivalent(*expected));
+
+  unique_ptr<RootSignatureConfig> with_flags(CreateEmbeddedRootSignature(BuildRootSignatureChunk(GetEmbeddedRootSignatureDesc(params, &sampler), 2)));
+  CHECK(!embedded->IsEquivalent(*with_flags));
+}
+
+TEST(ShaderReflectionParsesEachPayloadTypeAtTheEndOfTheChunk)
+{
+  // with no samplers the payload of the last parameter ends the chunk, so each parameter type is only given the bytes
+  // its payload actually has
+  const RootParamDesc last_params[] =
+  {
+    { ROOT_PARAM_DESCRIPTOR_TABLE, 0, 0, 0, 2, EMBEDDED_RANGES, ROOT_FLAGS_VOLATILE, SHADER_VISIBILITY_PIXEL },
+    { ROOT_PARAM_CONSTANTS, 3, 1, 16, 0, NULL, ROOT_FLAGS_VOLATILE, SHADER_VISIBILITY_VERTEX },
+    { ROOT_PARAM_CBV, 1, 0, 0, 0, NULL, ROOT_FLAGS_DATA_STATIC, SHADER_VISIBILITY_ALL },
+    { ROOT_PARAM_SRV, 2, 0, 0, 0, NULL, ROOT_FLAGS_NONE, SHADER_VISIBILITY_ALL },
+    { ROOT_PARAM_UAV, 0, 2, 0, 0, NULL, ROOT_FLAGS_DATA_VOLATILE, SHADER_VISIBILITY_ALL }
+  };
+  const UINT expected_sizes[] = { 8, 12, 12, 12, 12 };
+  for (UINT version = 1; version <= 2; version++)
+  {
+    for (UINT i = 0; i < sizeof(last_params) / sizeof(last_params[0]); i++)
+    {
+      const RootSignatureDesc desc = { 1, &last_params[i], 0, NULL, true, true, true, true, true, true, false };
+      const vector<UINT8> rts0 = BuildRootSignatureChunk(desc, version);
+      UINT payload;
+      memcpy(&payload, &rts0[32], sizeof(payload));
+      const UINT payload_size = version == 1 && i >= 2 ? 8 : expected_sizes[i];
+      CHECK(payload + payload_size == rts0.size());
+
+      unique_ptr<RootSignatureConfig> embedded(CreateEmbeddedRootSignature(rts0));
+      if (version == 2)
+      {
+        unique_ptr<RootSignatureConfig> expected(RootSignatureConfig::CreateD3D12(desc));
+        CHECK(embedded->IsEquivalent(*expected));
+      }
+
+      // one byte short of the payload
+      vector<UINT8> truncated = rts0;
+      truncated.pop_back();
+      CHECK_THROWS(delete CreateEmbeddedRootSignature(truncated));
+    }
+  }
+}
+
+TEST(ShaderReflectionRejectsMalformedRootSignatures)
+{
+  RootParamDesc params[5];
+  RootSamplerDesc sampler;
+  const RootSignatureDesc desc = GetEmbeddedRootSignatureDesc(params, &sampler);
+  const vector<UINT8> valid = BuildRootSignatureChunk(desc, 2);
+
+  vector<UINT8> rts0 = valid;
+  rts0[0] = 3;
+  CHECK_THROWS(delete CreateEmbeddedRootSignature(rts0));
+
+  // version 1.1 blob labelled as 1.0 reads its ranges with the wrong stride
+  rts0 = valid;
+  rts0[0] = 1;
+  CHECK_THROWS(delete CreateEmbeddedRootSignature(rts0));
+
+  // parameter array beyond the end of the chunk
+  rts0 = valid;
+  rts0[8] = 0xf0;
+  CHECK_THROWS(delete CreateEmbeddedRootSignature(rts0));
+
+  // unknown parameter type
+  rts0 = valid;
+  rts0[24] = 5;
+  CHECK_THROWS(delete CreateEmbeddedRootSignature(rts0));
+
+  // static sampler cut off
+  rts0 = valid;
+  rts0.resize(rts0.size() - 4);
+  CHECK_THROWS(delete CreateEmbeddedRootSignature(rts0));
+}
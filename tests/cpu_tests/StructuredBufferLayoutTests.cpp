@@ -0,0 +1,52 @@
+#include "TestHarness.h"
+#include "private_inc/StructuredBufferLayout.h"
+
+/// <summary>
+/// Per instance element of a typical instanced draw: a 4x3 world matrix and a color
+/// </summary>
+struct InstanceData
+{
+  float world[12];
+  float color[4];
+};
+
+TEST(StructuredBufferLayoutSizes)
+{
+  CHECK(StructuredBufferLayout::GetSize(1, 4) == 4);
+  CHECK(StructuredBufferLayout::GetSize(1024, sizeof(InstanceData)) == 1024 * 64);
+  CHECK(StructuredBufferLayout::GetSize(3, 12) == 36);
+
+  // would wrap if it was calculated in 32 bits
+  CHECK(StructuredBufferLayout::GetSize(0x10000000, 32) == 0x200000000ULL);
+
+  CHECK_THROWS(StructuredBufferLayout::GetSize(0, 4));
+  CHECK_THROWS(StructuredBufferLayout::GetSize(16, 0));
+  CHECK_THROWS(StructuredBufferLayout::GetSize(16, 6));
+}
+
+TEST(StructuredBufferLayoutElementOffsets)
+{
+  const UINT stride = sizeof(InstanceData);
+  CHECK(StructuredBufferLayout::GetElementOffset(100, stride, 0) == 0);
+  CHECK(StructuredBufferLayout::GetElementOffset(100, stride, 1) == 64);
+  CHECK(StructuredBufferLayout::GetElementOffset(100, stride, 99) == 99 * 64);
+  CHECK(StructuredBufferLayout::GetElementOffset(100, 12, 7) == 84);
+  CHECK(StructuredBufferLayout::GetElementOffset(0x10000000, 32, 0x0fffffff) == 0x1ffffffe0ULL);
+
+  CHECK_THROWS(StructuredBufferLayout::GetElementOffset(100, stride, 100));
+  CHECK_THROWS(StructuredBufferLayout::GetElementOffset(100, stride, 0xffffffff));
+}
+
+TEST(StructuredBufferLayoutUploadRanges)
+{
+  const UINT stride = sizeof(InstanceData);
+  CHECK(StructuredBufferLayout::GetUploadOffset(100, stride, 0, 100) == 0);
+  CHECK(StructuredBufferLayout::GetUploadOffset(100, stride, 40, 60) == 40 * 64);
+  CHECK(StructuredBufferLayout::GetUploadOffset(100, stride, 100, 0) == 100 * 64);
+
+  CHECK_THROWS(StructuredBufferLayout::GetUploadOffset(100, stride, 40, 61));
+  CHECK_THROWS(StructuredBufferLayout::GetUploadOffset(100, stride, 101, 0));
+
+  // start + count wraps in 32 bits
+  CHECK_THROWS(StructuredBufferLayout::GetUploadOffset(100, stride, 0xffffffff, 2));
+}
@@ -0,0 +1,130 @@
+#ifndef TEST_HARNESS_H
+#define TEST_HARNESS_H
+
+#include <math.h>
+#include "FrameworkException.h"
+
+/// <summary>
+/// Function that runs a test or benchmark
+/// </summary>
+typedef void (*TestFunction)();
+
+/// <summary>
+/// Adds a test or benchmark to the list main runs.  Instances are created by the TEST and BENCHMARK macros
+/// </summary>
+class TestRegistration
+{
+  public:
+    /// <summary>
+    /// Adds a test or benchmark to the list main runs
+    /// </summary>
+    /// <param name="name">
+    /// name of the test, which is also used to pick it on the command line
+    /// </param>
+    /// <param name="function">
+    /// function that runs it
+    /// </param>
+    /// <param name="benchmark">
+    /// true if it is a benchmark, which only runs with --bench
+    /// </param>
+    TestRegistration(const char* name, TestFunction function, bool benchmark);
+};
+
+/// <summary>
+/// Records a failed check in the current test
+/// </summary>
+/// <param name="file">
+/// source file of the check
+/// </param>
+/// <param name="line">
+/// line of the check
+/// </param>
+/// <param name="expression">
+/// text of the check that failed
+/// </param>
+void ReportFailure(const char* file, int line, const char* expression);
+
+/// <summary>
+/// Gets a monotonic time for benchmarks
+/// </summary>
+/// <returns>
+/// number of seconds since an arbitrary point
+/// </returns>
+double BenchSeconds();
+
+/// <summary>
+/// Prints 1 result of the current benchmark
+/// </summary>
+/// <param name="label">
+/// what was measured
+/// </param>
+/// <param name="value">
+/// measured value
+/// </param>
+/// <param name="unit">
+/// unit of the value
+/// </param>
+void ReportBenchmark(const char* label, double value, const char* unit);
+
+/// <summary>
+/// Defines a test, which runs by default
+/// </summary>
+#define TEST(name) \
+  static void name(); \
+  static TestRegistration name##_registration(#name, name, false); \
+  static void name()
+
+/// <summary>
+/// Defines a benchmark, which runs with --bench
+/// </summary>
+#define BENCHMARK(name) \
+  static void name(); \
+  static TestRegistration name##_registration(#name, name, true); \
+  static void name()
+
+/// <summary>
+/// Fails the current test, and keeps running it, if the expression is false
+/// </summary>
+#define CHECK(expression) \
+  do \
+  { \
+    if (!(expression)) \
+    { \
+      ReportFailure(__FILE__, __LINE__, #expression); \
+    } \
+  } while (0)
+
+/// <summary>
+/// Fails the current test, and keeps running it, if 2 values differ by more than a tolerance
+/// </summary>
+#define CHECK_CLOSE(actual, expected, tolerance) \
+  do \
+  { \
+    if (!(fabs((double)(actual) - (double)(expected)) <= (double)(tolerance))) \
+    { \
+      ReportFailure(__FILE__, __LINE__, #actual " is close to " #expected); \
+    } \
+  } while (0)
+
+/// <summary>
+/// Fails the current test, and keeps running it, if the statement does not throw a FrameworkException
+/// </summary>
+#define CHECK_THROWS(statement) \
+  do \
+  { \
+    bool thrown = false; \
+    try \
+    { \
+      statement; \
+    } \
+    catch (const FrameworkException&) \
+    { \
+      thrown = true; \
+    } \
+    if (!thrown) \
+    { \
+      ReportFailure(__FILE__, __LINE__, #statement " throws"); \
+    } \
+  } while (0)
+
+#endif /* TEST_HARNESS_H */
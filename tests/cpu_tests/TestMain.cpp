@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <exception>
+#include <vector>
+#include "TestHarness.h"
+using namespace std;
+
+// Runs the CPU side tests, which need no device, so they build and run on Linux as well as Windows.
+//
+//   cpu_tests                   runs every test
+//   cpu_tests name ...          runs the named tests
+//   cpu_tests --bench           runs every benchmark
+//   cpu_tests --bench name ...  runs the named benchmarks
+
+/// <summary>
+/// Test or benchmark registered by TEST or BENCHMARK
+/// </summary>
+struct RegisteredTest
+{
+  /// <summary>
+  /// name of the test
+  /// </summary>
+  const char* name;
+
+  /// <summary>
+  /// function that runs it
+  /// </summary>
+  TestFunction function;
+
+  /// <summary>
+  /// true if it is a benchmark
+  /// </summary>
+  bool benchmark;
+};
+
+/// <summary>
+/// Gets the registered tests.  A function local keeps it constructed before the registrations in other files use it
+/// </summary>
+/// <returns>
+/// every registered test and benchmark
+/// </returns>
+static vector<RegisteredTest>& GetTests()
+{
+  static vector<RegisteredTest> tests;
+  return tests;
+}
+
+/// <summary>
+/// number of failed checks in the current test
+/// </summary>
+static unsigned s_num_failures = 0;
+
+TestRegistration::TestRegistration(const char* name, TestFunction function, bool benchmark)
+{
+  RegisteredTest test = { name, function, benchmark };
+  GetTests().push_back(test);
+}
+
+void ReportFailure(const char* file, int line, const char* expression)
+{
+  printf("  %s(%d): check failed: %s\n", file, line, expression);
+  s_num_failures++;
+}
+
+double BenchSeconds()
+{
+  return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ReportBenchmark(const char* label, double value, const char* unit)
+{
+  printf("  %-56s %12.2f %s\n", label, value, unit);
+}
+
+int main(int argc, char** argv)
+{
+  bool benchmarks = argc > 1 && strcmp(argv[1], "--bench") == 0;
+  int  first_name = benchmarks ? 2 : 1;
+
+  unsigned num_run    = 0;
+  unsigned num_failed = 0;
+  vector<RegisteredTest>& tests = GetTests();
+  for (vector<RegisteredTest>::const_iterator it = tests.begin(); it != tests.end(); ++it)
+  {
+    if (it->benchmark != benchmarks)
+    {
+      continue;
+    }
+
+    bool selected = first_name == argc;
+    for (int i = first_name; i < argc && !selected; i++)
+    {
+      selected = strcmp(argv[i], it->name) == 0;
+    }
+    if (!selected)
+    {
+      continue;
+    }
+
+    printf("%s\n", it->name);
+    fflush(stdout);
+    s_num_failures = 0;
+    try
+    {
+      it->function();
+    }
+    catch (const exception& err)
+    {
+      ReportFailure(__FILE__, __LINE__, err.what());
+    }
+
+    num_run++;
+    if (s_num_failures > 0)
+    {
+      printf("  FAILED\n");
+      num_failed++;
+    }
+  }
+
+  printf("%u of %u %s passed\n", num_run - num_failed, num_run, benchmarks ? "benchmarks" : "tests");
+  return num_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Textures/TexelCopy.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Row pitch alignment of an upload buffer footprint, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT
+/// </summary>
+static const UINT PITCH_ALIGNMENT = 256;
+
+/// <summary>
+/// Converts a float to a half with plain integer code, rounding to nearest even.  Denormal results flush to 0, which
+/// none of the benchmark's values produce
+/// </summary>
+static uint16_t FloatToHalfScalar(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint32_t sign     = (bits >> 16) & 0x8000;
+  int      exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+  uint32_t mantissa = bits & 0x7FFFFF;
+  if (exponent <= 0)
+  {
+    return (uint16_t)sign;
+  }
+  if (exponent >= 31)
+  {
+    return (uint16_t)(sign | 0x7C00);
+  }
+  uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+  uint32_t rest = mantissa & 0x1FFF;
+  half += rest > 0x1000 || (rest == 0x1000 && (half & 1)) ? 1 : 0;
+  return (uint16_t)(sign | half);
+}
+
+/// <summary>
+/// Copies pitched rows the way uploads did before TexelCopy: memcpy for plain copies and a loop per texel otherwise
+/// </summary>
+static void CopyRowsScalar(UINT8* dst, SIZE_T dst_row_pitch, const UINT8* src, SIZE_T src_row_pitch, UINT dst_row_size, UINT num_rows,
+  TexelConversion conversion)
+{
+  for (UINT y = 0; y < num_rows; y++)
+  {
+    UINT8*       dst_row = dst + y * dst_row_pitch;
+    const UINT8* src_row = src + y * src_row_pitch;
+    switch (conversion)
+    {
+      case TEXEL_CONVERSION_RGB8_TO_RGBA8:
+        for (UINT i = 0; i < dst_row_size / 4; i++)
+        {
+          dst_row[i * 4 + 0] = src_row[i * 3 + 0];
+          dst_row[i * 4 + 1] = src_row[i * 3 + 1];
+          dst_row[i * 4 + 2] = src_row[i * 3 + 2];
+          dst_row[i * 4 + 3] = 255;
+        }
+        break;
+
+      case TEXEL_CONVERSION_SWAP_RB8:
+        for (UINT i = 0; i < dst_row_size / 4; i++)
+        {
+          dst_row[i * 4 + 0] = src_row[i * 4 + 2];
+          dst_row[i * 4 + 1] = src_row[i * 4 + 1];
+          dst_row[i * 4 + 2] = src_row[i * 4 + 0];
+          dst_row[i * 4 + 3] = src_row[i * 4 + 3];
+        }
+        break;
+
+      case TEXEL_CONVERSION_FLOAT_TO_HALF:
+        for (UINT i = 0; i < dst_row_size / 2; i++)
+        {
+          float    value;
+          uint16_t half;
+          memcpy(&value, src_row + i * 4, sizeof(value));
+          half = FloatToHalfScalar(value);
+          memcpy(dst_row + i * 2, &half, sizeof(half));
+        }
+        break;
+
+      default:
+        memcpy(dst_row, src_row, dst_row_size);
+        break;
+    }
+  }
+}
+
+BENCHMARK(TexelCopyThroughput)
+{
+  // NxN 4 byte texels for each conversion, written to rows with the footprint's 256 byte pitch and to rows 4 bytes
+  // further apart, which leaves most of them misaligned for streaming stores.  Throughput is in bytes written, and the
+  // baseline is memcpy for plain copies and a loop per texel for conversions
+  const TexelConversion conversions[] = { TEXEL_CONVERSION_NONE, TEXEL_CONVERSION_RGB8_TO_RGBA8, TEXEL_CONVERSION_SWAP_RB8,
+    TEXEL_CONVERSION_FLOAT_TO_HALF };
+  const char* names[] = { "copy", "rgb->rgba", "swap rb", "f->half" };
+  const UINT  sizes[] = { 256, 1024, 4096 };
+  for (UINT c = 0; c < 4; c++)
+  {
+    for (UINT s = 0; s < 3; s++)
+    {
+      UINT   size          = sizes[s];
+      UINT   dst_row_size  = size * 4;
+      UINT   src_row_size  = TexelCopy::GetSourceRowSize(dst_row_size, conversions[c]);
+      SIZE_T aligned_pitch = (dst_row_size + PITCH_ALIGNMENT - 1) / PITCH_ALIGNMENT * PITCH_ALIGNMENT;
+      vector<UINT8> src((size_t)src_row_size * size);
+      for (size_t i = 0; i < src.size(); i += 4)
+      {
+        // floats between 1 and 2 for the half conversion, and ordinary bytes for the rest
+        UINT32 value = 0x3F800000 | (UINT32)(i * 2654435761u >> 9);
+        memcpy(&src[i], &value, sizeof(value));
+      }
+      vector<UINT8> dst((aligned_pitch + 4) * size + 64);
+      UINT8* dst_start = (UINT8*)(((uintptr_t)&dst[0] + 63) & ~(uintptr_t)63);
+
+      const SIZE_T pitches[] = { aligned_pitch, aligned_pitch + 4 };
+      for (UINT p = 0; p < 2; p++)
+      {
+        double best_copy   = 1e30;
+        double best_scalar = 1e30;
+        for (int run = 0; run < RUNS; run++)
+        {
+          double start = BenchSeconds();
+          TexelCopy::CopyRows(dst_start, pitches[p], pitches[p] * size, &src[0], src_row_size, src.size(), dst_row_size, size, 1, conversions[c]);
+          double time = BenchSeconds() - start;
+          best_copy = time < best_copy ? time : best_copy;
+
+          start = BenchSeconds();
+          CopyRowsScalar(dst_start, pitches[p], &src[0], src_row_size, dst_row_size, size, conversions[c]);
+          time = BenchSeconds() - start;
+          best_scalar = time < best_scalar ? time : best_scalar;
+        }
+
+        double gb    = (double)dst_row_size * size / 1e9;
+        string label = string(names[c]) + " " + to_string(size) + (p == 0 ? ", aligned pitch, " : ", pitch + 4, ");
+        ReportBenchmark((label + "TexelCopy").c_str(), gb / best_copy, "GB/s");
+        ReportBenchmark((label + (c == 0 ? "memcpy" : "scalar")).c_str(), gb / best_scalar, "GB/s");
+      }
+    }
+  }
+}
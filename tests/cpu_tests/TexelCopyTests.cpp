@@ -0,0 +1,174 @@
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Textures/TexelCopy.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Byte the destination is filled with before a copy, which must be left alone outside of each row's bytes
+/// </summary>
+static const UINT8 PADDING = 0xCD;
+
+/// <summary>
+/// Makes random bytes
+/// </summary>
+static vector<UINT8> MakeRandomBytes(size_t size, uint32_t seed)
+{
+  vector<UINT8> bytes(size);
+  for (size_t i = 0; i < size; i++)
+  {
+    bytes[i] = (UINT8)(NextFixtureRandom(seed) * 256);
+  }
+  return bytes;
+}
+
+/// <summary>
+/// Converts the texels of 1 row with plain loops, for comparing against the kernels
+/// </summary>
+static void ConvertRowScalar(UINT8* dst, const UINT8* src, UINT dst_row_size, TexelConversion conversion)
+{
+  switch (conversion)
+  {
+    case TEXEL_CONVERSION_RGB8_TO_RGBA8:
+      for (UINT i = 0; i < dst_row_size / 4; i++)
+      {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = 255;
+      }
+      break;
+
+    case TEXEL_CONVERSION_SWAP_RB8:
+      for (UINT i = 0; i < dst_row_size / 4; i++)
+      {
+        dst[i * 4 + 0] = src[i * 4 + 2];
+        dst[i * 4 + 1] = src[i * 4 + 1];
+        dst[i * 4 + 2] = src[i * 4 + 0];
+        dst[i * 4 + 3] = src[i * 4 + 3];
+      }
+      break;
+
+    default:
+      memcpy(dst, src, dst_row_size);
+      break;
+  }
+}
+
+/// <summary>
+/// Copies pitched slices with TexelCopy and with plain loops, and checks that they match and that the padding after
+/// each row is untouched
+/// </summary>
+static bool CopyMatchesScalar(UINT dst_row_size, UINT num_rows, UINT depth, SIZE_T dst_row_pitch, SIZE_T dst_offset,
+  TexelConversion conversion)
+{
+  UINT   src_row_size   = TexelCopy::GetSourceRowSize(dst_row_size, conversion);
+  SIZE_T src_row_pitch  = src_row_size + 5;
+  SIZE_T src_slice_pitch = src_row_pitch * num_rows;
+  SIZE_T dst_slice_pitch = dst_row_pitch * num_rows;
+  vector<UINT8> src = MakeRandomBytes(src_slice_pitch * depth, dst_row_size * 31 + num_rows);
+
+  vector<UINT8> actual(dst_offset + dst_slice_pitch * depth, PADDING);
+  vector<UINT8> expected(actual.size(), PADDING);
+  TexelCopy::CopyRows(&actual[dst_offset], dst_row_pitch, dst_slice_pitch, &src[0], src_row_pitch, src_slice_pitch, dst_row_size, num_rows,
+    depth, conversion);
+  for (UINT z = 0; z < depth; z++)
+  {
+    for (UINT y = 0; y < num_rows; y++)
+    {
+      ConvertRowScalar(&expected[dst_offset + z * dst_slice_pitch + y * dst_row_pitch], &src[z * src_slice_pitch + y * src_row_pitch],
+        dst_row_size, conversion);
+    }
+  }
+  return actual == expected;
+}
+
+TEST(TexelCopyConvertsPitchedRows)
+{
+  // row sizes that leave a tail after the SIMD steps, destinations that are and aren't aligned, and a 2 slice copy
+  const TexelConversion conversions[] = { TEXEL_CONVERSION_NONE, TEXEL_CONVERSION_RGB8_TO_RGBA8, TEXEL_CONVERSION_SWAP_RB8 };
+  const UINT row_sizes[] = { 4, 60, 256, 1028 };
+  for (UINT c = 0; c < 3; c++)
+  {
+    for (UINT r = 0; r < 4; r++)
+    {
+      SIZE_T pitch = (row_sizes[r] + 255) / 256 * 256;
+      CHECK(CopyMatchesScalar(row_sizes[r], 7, 1, pitch, 0, conversions[c]));
+      CHECK(CopyMatchesScalar(row_sizes[r], 7, 2, pitch + 12, 4, conversions[c]));
+    }
+  }
+}
+
+TEST(TexelCopyConvertsFloatsToHalves)
+{
+  // exact values, the largest half, a value past it, and ties that round to the even neighbour
+  const float    floats[] = { 0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, 1e6f, 1.0f + 1.0f / 2048, 1.0f + 3.0f / 2048, -0.0f, 0.25f };
+  const uint16_t halves[] = { 0x0000, 0x3C00, 0xC000, 0x3800, 0x7BFF, 0x7C00, 0x3C00, 0x3C02, 0x8000, 0x3400 };
+  const UINT NUM_VALUES = 10;
+
+  // enough rows of the values to fill a few SIMD steps and a tail
+  const UINT PER_ROW = 30;
+  vector<float> src(PER_ROW * 3);
+  for (size_t i = 0; i < src.size(); i++)
+  {
+    src[i] = floats[i % NUM_VALUES];
+  }
+  const UINT PITCH = 128;
+  vector<UINT8> dst(PITCH * 3, PADDING);
+  TexelCopy::CopyRows(&dst[0], PITCH, PITCH * 3, &src[0], PER_ROW * sizeof(float), PER_ROW * 3 * sizeof(float), PER_ROW * 2, 3, 1,
+    TEXEL_CONVERSION_FLOAT_TO_HALF);
+
+  bool converted = true;
+  bool padded    = true;
+  for (UINT y = 0; y < 3; y++)
+  {
+    for (UINT i = 0; i < PER_ROW; i++)
+    {
+      uint16_t half;
+      memcpy(&half, &dst[y * PITCH + i * 2], sizeof(half));
+      converted = converted && half == halves[(y * PER_ROW + i) % NUM_VALUES];
+    }
+    for (UINT i = PER_ROW * 2; i < PITCH; i++)
+    {
+      padded = padded && dst[y * PITCH + i] == PADDING;
+    }
+  }
+  CHECK(converted);
+  CHECK(padded);
+}
+
+TEST(TexelCopySplitsLargeCopiesAcrossThePool)
+{
+  // 2 MB, past the size where the copy is split into jobs
+  CHECK(CopyMatchesScalar(2048, 1024, 1, 2048, 0, TEXEL_CONVERSION_NONE));
+  CHECK(CopyMatchesScalar(4096, 256, 2, 4096 + 256, 0, TEXEL_CONVERSION_SWAP_RB8));
+}
+
+TEST(TexelCopyChecksConversionsAgainstFormats)
+{
+  CHECK(TexelCopy::GetSourceRowSize(64, TEXEL_CONVERSION_NONE) == 64);
+  CHECK(TexelCopy::GetSourceRowSize(64, TEXEL_CONVERSION_RGB8_TO_RGBA8) == 48);
+  CHECK(TexelCopy::GetSourceRowSize(64, TEXEL_CONVERSION_FLOAT_TO_HALF) == 128);
+  CHECK_THROWS(TexelCopy::GetSourceRowSize(6, TEXEL_CONVERSION_SWAP_RB8));
+  CHECK_THROWS(TexelCopy::GetSourceRowSize(3, TEXEL_CONVERSION_FLOAT_TO_HALF));
+
+  CHECK(TexelCopy::IsConversionSupported(BC7_UNORM, TEXEL_CONVERSION_NONE));
+  CHECK(TexelCopy::IsConversionSupported(R8B8G8A8_UNORM, TEXEL_CONVERSION_RGB8_TO_RGBA8));
+  CHECK(TexelCopy::IsConversionSupported(B8G8R8A8_UNORM_SRGB, TEXEL_CONVERSION_SWAP_RB8));
+  CHECK(TexelCopy::IsConversionSupported(R16G16B16A16_FLOAT, TEXEL_CONVERSION_FLOAT_TO_HALF));
+  CHECK(TexelCopy::IsConversionSupported(R16G16_FLOAT, TEXEL_CONVERSION_FLOAT_TO_HALF));
+
+  // output texels of the wrong size or type, and block compressed formats, which no conversion writes
+  CHECK(!TexelCopy::IsConversionSupported(R8B8G8A8_UNORM, TEXEL_CONVERSION_FLOAT_TO_HALF));
+  CHECK(!TexelCopy::IsConversionSupported(R16G16B16A16_SNORM, TEXEL_CONVERSION_FLOAT_TO_HALF));
+  CHECK(!TexelCopy::IsConversionSupported(R32G32B32A32_FLOAT, TEXEL_CONVERSION_FLOAT_TO_HALF));
+  CHECK(!TexelCopy::IsConversionSupported(R8G8B8A8_SNORM, TEXEL_CONVERSION_RGB8_TO_RGBA8));
+  CHECK(!TexelCopy::IsConversionSupported(B8G8R8A8_UNORM, TEXEL_CONVERSION_RGB8_TO_RGBA8));
+  CHECK(!TexelCopy::IsConversionSupported(R32_UINT, TEXEL_CONVERSION_SWAP_RB8));
+  CHECK(!TexelCopy::IsConversionSupported(BC1_UNORM, TEXEL_CONVERSION_RGB8_TO_RGBA8));
+  CHECK(!TexelCopy::IsConversionSupported(BC7_UNORM, TEXEL_CONVERSION_SWAP_RB8));
+  CHECK(!TexelCopy::IsConversionSupported(BC6H_UF16, TEXEL_CONVERSION_FLOAT_TO_HALF));
+}
@@ -0,0 +1,131 @@
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Textures/TextureAtlas.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Makes an RGBA8 image whose texels each hold the image's number, and their own x and y
+/// </summary>
+static vector<UINT8> MakeTaggedImage(UINT tag, UINT width, UINT height)
+{
+  vector<UINT8> texels((size_t)width * height * 4);
+  for (UINT y = 0; y < height; y++)
+  {
+    for (UINT x = 0; x < width; x++)
+    {
+      UINT8* texel = &texels[((size_t)y * width + x) * 4];
+      texel[0] = (UINT8)tag;
+      texel[1] = (UINT8)x;
+      texel[2] = (UINT8)y;
+      texel[3] = 255;
+    }
+  }
+  return texels;
+}
+
+/// <summary>
+/// Gets a texel of an RGBA8 atlas page
+/// </summary>
+static const UINT8* GetPageTexel(const TextureAtlas& atlas, UINT16 page, UINT page_width, UINT x, UINT y)
+{
+  return &atlas.GetPage(page)[((size_t)y * page_width + x) * 4];
+}
+
+TEST(TextureAtlasPlacesImagesWithGutters)
+{
+  const UINT PAGE    = 64;
+  const UINT PADDING = 2;
+  TextureAtlas atlas(PAGE, PAGE, R8B8G8A8_UNORM, PADDING);
+
+  // the first image is added with padding at the end of its rows, which must not be copied
+  const UINT sizes[][2] = { { 5, 3 }, { 20, 12 }, { 9, 30 } };
+  vector<vector<UINT8> > images;
+  for (UINT i = 0; i < 3; i++)
+  {
+    images.push_back(MakeTaggedImage(i + 1, sizes[i][0], sizes[i][1]));
+  }
+  vector<UINT8> pitched(64 * sizes[0][1], 0xCD);
+  for (UINT y = 0; y < sizes[0][1]; y++)
+  {
+    memcpy(&pitched[y * 64], &images[0][y * sizes[0][0] * 4], sizes[0][0] * 4);
+  }
+  CHECK(atlas.Add(&pitched[0], sizes[0][0], sizes[0][1], 64) == 0);
+  CHECK(atlas.Add(&images[1][0], sizes[1][0], sizes[1][1], sizes[1][0] * 4) == 1);
+  CHECK(atlas.Add(&images[2][0], sizes[2][0], sizes[2][1], sizes[2][0] * 4) == 2);
+  atlas.Pack();
+  CHECK(atlas.GetNumImages() == 3);
+  CHECK(atlas.GetNumPages() == 1);
+
+  UINT64 area = 0;
+  for (UINT i = 0; i < 3; i++)
+  {
+    const AtlasRegion& region = atlas.GetRegion(i);
+    CHECK(region.page == 0);
+    CHECK(region.rect.width == sizes[i][0] && region.rect.height == sizes[i][1]);
+    CHECK(region.rect.x >= PADDING && region.rect.y >= PADDING);
+    CHECK(region.rect.x + region.rect.width + PADDING <= PAGE && region.rect.y + region.rect.height + PADDING <= PAGE);
+    CHECK_CLOSE(region.u0, (float)region.rect.x / PAGE, 1e-6f);
+    CHECK_CLOSE(region.v1, (float)(region.rect.y + region.rect.height) / PAGE, 1e-6f);
+    area += (UINT64)sizes[i][0] * sizes[i][1];
+
+    // the image itself, then its corners and edges repeated out into the gutter
+    UINT left   = region.rect.x;
+    UINT top    = region.rect.y;
+    UINT right  = left + region.rect.width - 1;
+    UINT bottom = top + region.rect.height - 1;
+    bool copied = true;
+    for (UINT y = 0; y < region.rect.height; y++)
+    {
+      copied = copied && memcmp(GetPageTexel(atlas, 0, PAGE, left, top + y), &images[i][y * sizes[i][0] * 4], sizes[i][0] * 4) == 0;
+    }
+    CHECK(copied);
+    CHECK(memcmp(GetPageTexel(atlas, 0, PAGE, left - PADDING, top - PADDING), GetPageTexel(atlas, 0, PAGE, left, top), 4) == 0);
+    CHECK(memcmp(GetPageTexel(atlas, 0, PAGE, right + PADDING, bottom + PADDING), GetPageTexel(atlas, 0, PAGE, right, bottom), 4) == 0);
+    CHECK(memcmp(GetPageTexel(atlas, 0, PAGE, left - 1, top + 1), GetPageTexel(atlas, 0, PAGE, left, top + 1), 4) == 0);
+    CHECK(memcmp(GetPageTexel(atlas, 0, PAGE, left + 1, bottom + 1), GetPageTexel(atlas, 0, PAGE, left + 1, bottom), 4) == 0);
+  }
+  CHECK_CLOSE(atlas.GetOccupancy(), (float)((double)area / (PAGE * PAGE)), 1e-6f);
+}
+
+TEST(TextureAtlasAlignsCellsToTheMipChainAndOpensPages)
+{
+  // 3 levels align each cell to 4 texels, so 1 padded 14x14 image takes a 16x16 cell and 16 of them fill a page
+  const UINT PAGE = 64;
+  TextureAtlas atlas(PAGE, PAGE, R8B8G8A8_UNORM, 1, 3);
+  vector<UINT8> image = MakeTaggedImage(1, 14, 14);
+  for (UINT i = 0; i < 17; i++)
+  {
+    atlas.Add(&image[0], 14, 14, 14 * 4);
+  }
+  atlas.Pack();
+  CHECK(atlas.GetNumPages() == 2);
+
+  UINT on_second_page = 0;
+  for (UINT i = 0; i < 17; i++)
+  {
+    const AtlasRegion& region = atlas.GetRegion(i);
+    CHECK((region.rect.x - 1) % 4 == 0 && (region.rect.y - 1) % 4 == 0);
+    on_second_page += region.page == 1 ? 1 : 0;
+  }
+  CHECK(on_second_page == 1);
+}
+
+TEST(TextureAtlasRejectsInvalidArguments)
+{
+  // unsupported formats, page sizes that aren't a multiple of the cell alignment, and mipmap level counts of 0, which
+  // Texture2D would take as a full chain, or more than the page has
+  CHECK_THROWS(TextureAtlas(64, 64, BC1_UNORM));
+  CHECK_THROWS(TextureAtlas(0, 64, R8B8G8A8_UNORM));
+  CHECK_THROWS(TextureAtlas(60, 64, R8B8G8A8_UNORM, 1, 4));
+  CHECK_THROWS(TextureAtlas(64, 64, R8B8G8A8_UNORM, 1, 0));
+  CHECK_THROWS(TextureAtlas(64, 64, R8B8G8A8_UNORM, 1, 8));
+  TextureAtlas full_chain(64, 64, R8B8G8A8_UNORM, 1, 7);
+
+  TextureAtlas atlas(64, 64, R8B8G8A8_UNORM, 1);
+  vector<UINT8> image = MakeTaggedImage(1, 64, 64);
+  CHECK_THROWS(atlas.Add(&image[0], 0, 4, 0));
+  atlas.Add(&image[0], 63, 4, 64 * 4);
+  CHECK_THROWS(atlas.Pack());
+}
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "ImageFixture.h"
+#include "TextureFileFixture.h"
+#include "lodepng/lodepng.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each load is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Row pitch and subresource alignments of an upload buffer footprint, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT and
+/// D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+/// </summary>
+static const size_t PITCH_ALIGNMENT     = 256;
+static const size_t PLACEMENT_ALIGNMENT = 512;
+
+/// <summary>
+/// Copies every subresource of a parsed file into the footprints it would have in an upload buffer, which is what
+/// loading a TextureFile does after mapping it
+/// </summary>
+/// <param name="layout">
+/// parsed file
+/// </param>
+/// <param name="staging">
+/// upload buffer memory, or NULL to only work out how much is needed
+/// </param>
+/// <returns>
+/// number of bytes of upload buffer memory used
+/// </returns>
+static size_t CopyToStaging(const TextureFileLayout& layout, UINT8* staging)
+{
+  size_t offset = 0;
+  for (size_t i = 0; i < layout.subresources.size(); i++)
+  {
+    const TextureFileSubresource& subresource = layout.subresources[i];
+    UINT   level     = (UINT)(i % layout.mip_levels);
+    UINT   depth     = layout.depth >> level ? layout.depth >> level : 1;
+    UINT   num_rows  = subresource.slice_pitch / subresource.row_pitch * depth;
+    size_t dst_pitch = (subresource.row_pitch + PITCH_ALIGNMENT - 1) / PITCH_ALIGNMENT * PITCH_ALIGNMENT;
+
+    offset = (offset + PLACEMENT_ALIGNMENT - 1) / PLACEMENT_ALIGNMENT * PLACEMENT_ALIGNMENT;
+    if (staging != NULL)
+    {
+      const UINT8* src = (const UINT8*)subresource.data;
+      for (UINT row = 0; row < num_rows; row++)
+      {
+        memcpy(staging + offset + row * dst_pitch, src + (size_t)row * subresource.row_pitch, subresource.row_pitch);
+      }
+    }
+    offset += dst_pitch * num_rows;
+  }
+  return offset;
+}
+
+/// <summary>
+/// Times parsing a texture file and copying it into upload buffer footprints
+/// </summary>
+/// <returns>
+/// fastest time in seconds
+/// </returns>
+static double TimeFileLoad(const vector<UINT8>& file)
+{
+  TextureFileLayout layout;
+  if (TextureFileFormat::Parse(&file[0], file.size(), layout) != NULL)
+  {
+    return 0;
+  }
+  vector<UINT8> staging(CopyToStaging(layout, NULL));
+
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    TextureFileFormat::Parse(&file[0], file.size(), layout);
+    CopyToStaging(layout, &staging[0]);
+    double time = BenchSeconds() - start;
+    best = time < best ? time : best;
+  }
+  return best;
+}
+
+BENCHMARK(TextureFileVersusPng)
+{
+  // a 2048x2048 photo-like texture.  Files are read from memory, so only the CPU cost after the read is measured
+  const UINT SIZE   = 2048;
+  const UINT LEVELS = 12;
+  vector<UINT8> rgba;
+  MakeFixtureImage(SIZE, SIZE, true, rgba);
+
+  unsigned char* png = NULL;
+  size_t png_size = 0;
+  CHECK(lodepng_encode32(&png, &png_size, &rgba[0], SIZE, SIZE) == 0);
+
+  // the PNG path: decode to an unpitched image, then copy its rows into the upload buffer footprint
+  size_t dst_pitch = (SIZE * 4 + PITCH_ALIGNMENT - 1) / PITCH_ALIGNMENT * PITCH_ALIGNMENT;
+  vector<UINT8> staging(dst_pitch * SIZE);
+  double best_png = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    unsigned char* decoded = NULL;
+    unsigned width = 0;
+    unsigned height = 0;
+    unsigned error = lodepng_decode32(&decoded, &width, &height, png, png_size);
+    if (error == 0)
+    {
+      for (UINT row = 0; row < height; row++)
+      {
+        memcpy(&staging[row * dst_pitch], decoded + (size_t)row * width * 4, width * 4);
+      }
+    }
+    free(decoded);
+    double time = BenchSeconds() - start;
+    best_png = time < best_png ? time : best_png;
+    CHECK(error == 0);
+  }
+  CHECK(memcmp(&staging[dst_pitch * (SIZE - 1)], &rgba[(size_t)SIZE * (SIZE - 1) * 4], SIZE * 4) == 0);
+  free(png);
+
+  vector<UINT8> dds_top   = BuildDDS(R8B8G8A8_UNORM, false, TEXTURE_FILE_2D, SIZE, SIZE, 1, 1, 1);
+  vector<UINT8> dds_chain = BuildDDS(R8B8G8A8_UNORM, false, TEXTURE_FILE_2D, SIZE, SIZE, 1, 1, LEVELS);
+  vector<UINT8> ktx2_bc7  = BuildKTX2(BC7_UNORM, SIZE, SIZE, 0, 0, 1, LEVELS);
+  double dds_top_time   = TimeFileLoad(dds_top);
+  double dds_chain_time = TimeFileLoad(dds_chain);
+  double ktx2_bc7_time  = TimeFileLoad(ktx2_bc7);
+  CHECK(dds_top_time > 0 && dds_chain_time > 0 && ktx2_bc7_time > 0);
+
+  ReportBenchmark("PNG file size", png_size / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("DDS RGBA8 1 level file size", dds_top.size() / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("DDS RGBA8 12 levels file size", dds_chain.size() / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("KTX2 BC7 12 levels file size", ktx2_bc7.size() / (1024.0 * 1024.0), "MB");
+  ReportBenchmark("PNG decode + pitched copy, 1 level", best_png * 1e3, "ms");
+  ReportBenchmark("DDS RGBA8 parse + pitched copy, 1 level", dds_top_time * 1e3, "ms");
+  ReportBenchmark("DDS RGBA8 parse + pitched copy, 12 levels", dds_chain_time * 1e3, "ms");
+  ReportBenchmark("KTX2 BC7 parse + pitched copy, 12 levels", ktx2_bc7_time * 1e3, "ms");
+  ReportBenchmark("DDS 1 level speedup over PNG", best_png / dds_top_time, "x");
+}
@@ -0,0 +1,254 @@
+#ifndef TEXTURE_FILE_FIXTURE_H
+#define TEXTURE_FILE_FIXTURE_H
+
+#include <string.h>
+#include <vector>
+#include "private_inc/TextureFileFormat.h"
+
+/// <summary>
+/// Gets the number of bytes in 1 tightly packed depth slice of a subresource.  Handles the formats the fixtures write:
+/// R8B8G8A8_UNORM, BC1_UNORM, BC3_UNORM and BC7_UNORM
+/// </summary>
+inline UINT GetFixtureSliceSize(GraphicsDataFormat format, UINT width, UINT height)
+{
+  if (format == R8B8G8A8_UNORM)
+  {
+    return width * height * 4;
+  }
+  UINT block_bytes = format == BC1_UNORM ? 8 : 16;
+  return ((width + 3) / 4) * ((height + 3) / 4) * block_bytes;
+}
+
+/// <summary>
+/// Gets the number of bytes in 1 tightly packed subresource
+/// </summary>
+inline UINT64 GetFixtureSubresourceSize(GraphicsDataFormat format, UINT width, UINT height, UINT depth, UINT level)
+{
+  UINT level_width  = width >> level ? width >> level : 1;
+  UINT level_height = height >> level ? height >> level : 1;
+  UINT level_depth  = depth >> level ? depth >> level : 1;
+  return (UINT64)GetFixtureSliceSize(format, level_width, level_height) * level_depth;
+}
+
+/// <summary>
+/// Lays out a DDS file the way texture tools write them.  Every byte of a subresource is its D3D12 subresource index
+/// + 1, so tests can tell which subresource a pointer lands in
+/// </summary>
+/// <param name="format">
+/// format of the texels, one of the formats GetFixtureSliceSize handles
+/// </param>
+/// <param name="dx10">
+/// true to describe the texture with a DX10 header
+/// false to use a legacy pixel format, which can't describe arrays
+/// </param>
+/// <param name="type">
+/// type of texture.  1D textures need a DX10 header
+/// </param>
+/// <param name="width">
+/// width of the top level in texels
+/// </param>
+/// <param name="height">
+/// height of the top level in texels
+/// </param>
+/// <param name="depth">
+/// depth of the top level of a 3D texture, 1 otherwise
+/// </param>
+/// <param name="array_size">
+/// number of textures, or number of cubes for cube maps
+/// </param>
+/// <param name="mip_levels">
+/// number of mipmap levels
+/// </param>
+/// <returns>
+/// bytes of the file.  The vector's storage is aligned enough for the headers
+/// </returns>
+inline std::vector<UINT8> BuildDDS(GraphicsDataFormat format, bool dx10, TextureFileType type, UINT width, UINT height,
+  UINT depth, UINT array_size, UINT mip_levels)
+{
+  DDSHeader header;
+  memset(&header, 0, sizeof(header));
+  header.size          = sizeof(DDSHeader);
+  header.flags         = 0x1007;
+  header.width         = width;
+  header.height        = height;
+  header.depth         = depth;
+  header.mip_map_count = mip_levels;
+  header.caps          = 0x1000;
+  header.ddspf.size    = sizeof(DDSPixelFormat);
+
+  bool cube = type == TEXTURE_FILE_CUBE || type == TEXTURE_FILE_CUBE_ARRAY;
+  DDSHeaderDX10 header_dx10;
+  memset(&header_dx10, 0, sizeof(header_dx10));
+  if (dx10)
+  {
+    header.ddspf.flags   = DDS_PF_FOURCC;
+    header.ddspf.four_cc = '0' << 24 | '1' << 16 | 'X' << 8 | 'D';
+    header_dx10.dxgi_format = format;
+    header_dx10.array_size  = array_size;
+    header_dx10.misc_flag   = cube ? DDS_MISC_TEXTURECUBE : 0;
+    if (type == TEXTURE_FILE_1D || type == TEXTURE_FILE_1D_ARRAY)
+    {
+      header_dx10.resource_dimension = DDS_DIMENSION_TEXTURE1D;
+    }
+    else if (type == TEXTURE_FILE_3D)
+    {
+      header_dx10.resource_dimension = DDS_DIMENSION_TEXTURE3D;
+    }
+    else
+    {
+      header_dx10.resource_dimension = DDS_DIMENSION_TEXTURE2D;
+    }
+  }
+  else
+  {
+    if (format == R8B8G8A8_UNORM)
+    {
+      header.ddspf.flags         = DDS_PF_RGB | DDS_PF_ALPHAPIXELS;
+      header.ddspf.rgb_bit_count = 32;
+      header.ddspf.r_mask        = 0x000000FF;
+      header.ddspf.g_mask        = 0x0000FF00;
+      header.ddspf.b_mask        = 0x00FF0000;
+      header.ddspf.a_mask        = 0xFF000000;
+    }
+    else
+    {
+      header.ddspf.flags   = DDS_PF_FOURCC;
+      header.ddspf.four_cc = (format == BC1_UNORM ? '1' : '5') << 24 | 'T' << 16 | 'X' << 8 | 'D';
+    }
+    if (cube)
+    {
+      header.caps2 = DDS_CAPS2_CUBEMAP | DDS_CAPS2_CUBEMAP_ALL_FACES;
+    }
+    else if (type == TEXTURE_FILE_3D)
+    {
+      header.caps2 = DDS_CAPS2_VOLUME;
+    }
+  }
+
+  UINT   num_slices = cube ? array_size * 6 : array_size;
+  UINT64 size      = sizeof(uint32_t) + sizeof(DDSHeader) + (dx10 ? sizeof(DDSHeaderDX10) : 0);
+  size_t data_start = (size_t)size;
+  for (UINT level = 0; level < mip_levels; level++)
+  {
+    size += GetFixtureSubresourceSize(format, width, height, depth, level) * num_slices;
+  }
+
+  std::vector<UINT8> file((size_t)size);
+  memcpy(&file[0], &DDS_MAGIC, sizeof(DDS_MAGIC));
+  memcpy(&file[sizeof(uint32_t)], &header, sizeof(header));
+  if (dx10)
+  {
+    memcpy(&file[sizeof(uint32_t) + sizeof(DDSHeader)], &header_dx10, sizeof(header_dx10));
+  }
+
+  size_t offset = data_start;
+  for (UINT slice = 0; slice < num_slices; slice++)
+  {
+    for (UINT level = 0; level < mip_levels; level++)
+    {
+      size_t subresource_size = (size_t)GetFixtureSubresourceSize(format, width, height, depth, level);
+      memset(&file[offset], (UINT8)(slice * mip_levels + level + 1), subresource_size);
+      offset += subresource_size;
+    }
+  }
+  return file;
+}
+
+/// <summary>
+/// Gets the header of a DDS file built by BuildDDS
+/// </summary>
+inline DDSHeader* GetDDSHeader(std::vector<UINT8>& file)
+{
+  return (DDSHeader*)&file[sizeof(uint32_t)];
+}
+
+/// <summary>
+/// Lays out a KTX2 file the way texture tools write them, with the smallest level first.  Every byte of a subresource
+/// is its D3D12 subresource index + 1, so tests can tell which subresource a pointer lands in
+/// </summary>
+/// <param name="format">
+/// format of the texels, one of the formats GetFixtureSliceSize handles
+/// </param>
+/// <param name="width">
+/// width of the top level in texels
+/// </param>
+/// <param name="height">
+/// height of the top level in texels, 0 for 1D textures
+/// </param>
+/// <param name="depth">
+/// depth of the top level of a 3D texture, 0 otherwise
+/// </param>
+/// <param name="layer_count">
+/// number of textures in the array, 0 when the texture is not an array
+/// </param>
+/// <param name="face_count">
+/// 6 for cube maps, 1 otherwise
+/// </param>
+/// <param name="level_count">
+/// number of mipmap levels
+/// </param>
+/// <returns>
+/// bytes of the file.  The vector's storage is aligned enough for the headers
+/// </returns>
+inline std::vector<UINT8> BuildKTX2(GraphicsDataFormat format, UINT width, UINT height, UINT depth, UINT layer_count,
+  UINT face_count, UINT level_count)
+{
+  KTX2Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER));
+  header.vk_format    = format == R8B8G8A8_UNORM ? 37 : (format == BC1_UNORM ? 131 : (format == BC3_UNORM ? 137 : 145));
+  header.type_size    = 1;
+  header.pixel_width  = width;
+  header.pixel_height = height;
+  header.pixel_depth  = depth;
+  header.layer_count  = layer_count;
+  header.face_count   = face_count;
+  header.level_count  = level_count;
+
+  UINT num_images = (layer_count ? layer_count : 1) * face_count;
+  UINT height_1   = height ? height : 1;
+  UINT depth_1    = depth ? depth : 1;
+
+  std::vector<KTX2LevelIndex> levels(level_count);
+  UINT64 offset = sizeof(KTX2Header) + level_count * sizeof(KTX2LevelIndex);
+  for (UINT level = level_count; level-- > 0;)
+  {
+    offset = (offset + 15) & ~15ull;
+    levels[level].byte_offset = offset;
+    levels[level].byte_length = GetFixtureSubresourceSize(format, width, height_1, depth_1, level) * num_images;
+    levels[level].uncompressed_byte_length = levels[level].byte_length;
+    offset += levels[level].byte_length;
+  }
+
+  std::vector<UINT8> file((size_t)offset, 0);
+  memcpy(&file[0], &header, sizeof(header));
+  for (UINT level = 0; level < level_count; level++)
+  {
+    memcpy(&file[sizeof(KTX2Header) + level * sizeof(KTX2LevelIndex)], &levels[level], sizeof(KTX2LevelIndex));
+    size_t image_size = (size_t)GetFixtureSubresourceSize(format, width, height_1, depth_1, level);
+    for (UINT image = 0; image < num_images; image++)
+    {
+      memset(&file[(size_t)levels[level].byte_offset + image * image_size], (UINT8)(image * level_count + level + 1),
+        image_size);
+    }
+  }
+  return file;
+}
+
+/// <summary>
+/// Gets the header of a KTX2 file built by BuildKTX2
+/// </summary>
+inline KTX2Header* GetKTX2Header(std::vector<UINT8>& file)
+{
+  return (KTX2Header*)&file[0];
+}
+
+/// <summary>
+/// Gets the level index of a KTX2 file built by BuildKTX2
+/// </summary>
+inline KTX2LevelIndex* GetKTX2Level(std::vector<UINT8>& file, UINT level)
+{
+  return (KTX2LevelIndex*)&file[sizeof(KTX2Header) + level * sizeof(KTX2LevelIndex)];
+}
+
+#endif /* TEXTURE_FILE_FIXTURE_H */
@@ -0,0 +1,243 @@
+#include <vector>
+#include "TestHarness.h"
+#include "TextureFileFixture.h"
+using namespace std;
+
+/// <summary>
+/// Checks the pitches of a parsed subresource and that its first and last bytes are the ones the fixtures wrote for it
+/// </summary>
+/// <param name="layout">
+/// parsed file
+/// </param>
+/// <param name="index">
+/// D3D12 subresource index
+/// </param>
+/// <param name="row_pitch">
+/// expected bytes per row
+/// </param>
+/// <param name="slice_pitch">
+/// expected bytes per depth slice
+/// </param>
+/// <param name="depth">
+/// number of depth slices in the subresource
+/// </param>
+static bool SubresourceIs(const TextureFileLayout& layout, UINT index, UINT row_pitch, UINT slice_pitch, UINT depth)
+{
+  if (index >= layout.subresources.size())
+  {
+    return false;
+  }
+  const TextureFileSubresource& subresource = layout.subresources[index];
+  const UINT8* data = (const UINT8*)subresource.data;
+  UINT8 expected = (UINT8)(index + 1);
+  return subresource.row_pitch == row_pitch && subresource.slice_pitch == slice_pitch && data[0] == expected &&
+         data[(size_t)slice_pitch * depth - 1] == expected;
+}
+
+TEST(TextureFileFormatParsesLegacyDDS)
+{
+  // DXT1 with a full chain: 16x8, 8x4, 4x2, 2x1, 1x1
+  vector<UINT8> file = BuildDDS(BC1_UNORM, false, TEXTURE_FILE_2D, 16, 8, 1, 1, 5);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_2D);
+  CHECK(layout.format == BC1_UNORM);
+  CHECK(layout.width == 16 && layout.height == 8 && layout.depth == 1 && layout.array_size == 1);
+  CHECK(layout.mip_levels == 5);
+  CHECK(layout.subresources.size() == 5);
+  CHECK(SubresourceIs(layout, 0, 32, 64, 1));
+  CHECK(SubresourceIs(layout, 1, 16, 16, 1));
+  CHECK(SubresourceIs(layout, 2, 8, 8, 1));
+  CHECK(SubresourceIs(layout, 4, 8, 8, 1));
+
+  // 8 bit RGBA described by masks, with a mip count of 0 meaning 1 level
+  file = BuildDDS(R8B8G8A8_UNORM, false, TEXTURE_FILE_2D, 8, 4, 1, 1, 1);
+  GetDDSHeader(file)->mip_map_count = 0;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.format == R8B8G8A8_UNORM);
+  CHECK(layout.mip_levels == 1);
+  CHECK(SubresourceIs(layout, 0, 32, 128, 1));
+}
+
+TEST(TextureFileFormatParsesDX10Arrays)
+{
+  // 3 BC7 slices of 12x12, 6x6, 3x3 and 1x1, each slice holding its whole chain
+  vector<UINT8> file = BuildDDS(BC7_UNORM, true, TEXTURE_FILE_2D_ARRAY, 12, 12, 1, 3, 4);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_2D_ARRAY);
+  CHECK(layout.format == BC7_UNORM);
+  CHECK(layout.array_size == 3 && layout.mip_levels == 4);
+  CHECK(layout.subresources.size() == 12);
+  for (UINT slice = 0; slice < 3; slice++)
+  {
+    CHECK(SubresourceIs(layout, slice * 4 + 0, 48, 144, 1));
+    CHECK(SubresourceIs(layout, slice * 4 + 1, 32, 64, 1));
+    CHECK(SubresourceIs(layout, slice * 4 + 2, 16, 16, 1));
+    CHECK(SubresourceIs(layout, slice * 4 + 3, 16, 16, 1));
+  }
+
+  // 1D array, where the height in the header is ignored
+  file = BuildDDS(R8B8G8A8_UNORM, true, TEXTURE_FILE_1D_ARRAY, 16, 1, 1, 2, 2);
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_1D_ARRAY);
+  CHECK(layout.height == 1 && layout.array_size == 2);
+  CHECK(SubresourceIs(layout, 3, 32, 32, 1));
+}
+
+TEST(TextureFileFormatParsesCubeMaps)
+{
+  // legacy cube, each face holding its whole chain
+  vector<UINT8> file = BuildDDS(R8B8G8A8_UNORM, false, TEXTURE_FILE_CUBE, 8, 8, 1, 1, 4);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_CUBE);
+  CHECK(layout.array_size == 1 && layout.mip_levels == 4);
+  CHECK(layout.subresources.size() == 24);
+  for (UINT face = 0; face < 6; face++)
+  {
+    CHECK(SubresourceIs(layout, face * 4 + 0, 32, 256, 1));
+    CHECK(SubresourceIs(layout, face * 4 + 3, 4, 4, 1));
+  }
+
+  // a cube without every face can't be loaded as a cube
+  vector<UINT8> partial = file;
+  GetDDSHeader(partial)->caps2 &= ~0x8000u;
+  CHECK(TextureFileFormat::Parse(&partial[0], partial.size(), layout) != NULL);
+
+  // 2 cubes through a DX10 header
+  file = BuildDDS(BC1_UNORM, true, TEXTURE_FILE_CUBE_ARRAY, 8, 8, 1, 2, 2);
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_CUBE_ARRAY);
+  CHECK(layout.array_size == 2);
+  CHECK(layout.subresources.size() == 24);
+  CHECK(SubresourceIs(layout, 23, 8, 8, 1));
+}
+
+TEST(TextureFileFormatParsesVolumes)
+{
+  // 8x4x4, 4x2x2 and 2x1x1, each level holding all of its depth slices
+  vector<UINT8> file = BuildDDS(R8B8G8A8_UNORM, false, TEXTURE_FILE_3D, 8, 4, 4, 1, 3);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_3D);
+  CHECK(layout.depth == 4 && layout.mip_levels == 3);
+  CHECK(layout.subresources.size() == 3);
+  CHECK(SubresourceIs(layout, 0, 32, 128, 4));
+  CHECK(SubresourceIs(layout, 1, 16, 32, 2));
+  CHECK(SubresourceIs(layout, 2, 8, 8, 1));
+
+  file = BuildDDS(BC1_UNORM, true, TEXTURE_FILE_3D, 8, 8, 2, 1, 2);
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_3D);
+  CHECK(SubresourceIs(layout, 0, 16, 32, 2));
+}
+
+TEST(TextureFileFormatParsesKTX2Arrays)
+{
+  // KTX2 stores every layer of a level together, which has to be gathered back into D3D12 order
+  vector<UINT8> file = BuildKTX2(R8B8G8A8_UNORM, 8, 8, 0, 3, 1, 3);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_2D_ARRAY);
+  CHECK(layout.format == R8B8G8A8_UNORM);
+  CHECK(layout.array_size == 3 && layout.mip_levels == 3);
+  CHECK(layout.subresources.size() == 9);
+  for (UINT layer = 0; layer < 3; layer++)
+  {
+    CHECK(SubresourceIs(layout, layer * 3 + 0, 32, 256, 1));
+    CHECK(SubresourceIs(layout, layer * 3 + 1, 16, 64, 1));
+    CHECK(SubresourceIs(layout, layer * 3 + 2, 8, 16, 1));
+  }
+
+  // a layer count of 0 is a single texture
+  file = BuildKTX2(BC7_UNORM, 16, 16, 0, 0, 1, 5);
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_2D);
+  CHECK(layout.format == BC7_UNORM);
+  CHECK(SubresourceIs(layout, 0, 64, 256, 1));
+  CHECK(SubresourceIs(layout, 4, 16, 16, 1));
+}
+
+TEST(TextureFileFormatParsesKTX2CubeArrays)
+{
+  // 2 cubes of BC1, where image = layer * 6 + face
+  vector<UINT8> file = BuildKTX2(BC1_UNORM, 8, 8, 0, 2, 6, 2);
+  TextureFileLayout layout;
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_CUBE_ARRAY);
+  CHECK(layout.format == BC1_UNORM);
+  CHECK(layout.array_size == 2 && layout.mip_levels == 2);
+  CHECK(layout.subresources.size() == 24);
+  for (UINT image = 0; image < 12; image++)
+  {
+    CHECK(SubresourceIs(layout, image * 2 + 0, 16, 32, 1));
+    CHECK(SubresourceIs(layout, image * 2 + 1, 8, 8, 1));
+  }
+
+  file = BuildKTX2(BC1_UNORM, 8, 8, 0, 0, 6, 1);
+  CHECK(TextureFileFormat::Parse(&file[0], file.size(), layout) == NULL);
+  CHECK(layout.type == TEXTURE_FILE_CUBE);
+  CHECK(layout.subresources.size() == 6);
+}
+
+TEST(TextureFileFormatRejectsInvalidFiles)
+{
+  TextureFileLayout layout;
+  vector<UINT8> dds  = BuildDDS(BC1_UNORM, false, TEXTURE_FILE_2D, 16, 8, 1, 1, 5);
+  vector<UINT8> ktx2 = BuildKTX2(R8B8G8A8_UNORM, 8, 8, 0, 3, 1, 3);
+
+  // truncated texel data and headers
+  CHECK(TextureFileFormat::Parse(&dds[0], dds.size() - 1, layout) != NULL);
+  CHECK(TextureFileFormat::Parse(&dds[0], 64, layout) != NULL);
+  CHECK(TextureFileFormat::Parse(&ktx2[0], ktx2.size() - 1, layout) != NULL);
+  CHECK(TextureFileFormat::Parse(&ktx2[0], sizeof(KTX2Header) + 8, layout) != NULL);
+  CHECK(TextureFileFormat::Parse(&dds[0], 2, layout) != NULL);
+
+  // neither container
+  vector<UINT8> bad = dds;
+  bad[3] = 'X';
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = ktx2;
+  bad[5] = '3';
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+
+  // more levels than a full chain of 16x8
+  bad = dds;
+  GetDDSHeader(bad)->mip_map_count = 6;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = ktx2;
+  GetKTX2Header(bad)->level_count = 5;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+
+  // supercompressed KTX2
+  bad = ktx2;
+  GetKTX2Header(bad)->supercompression_scheme = 2;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+
+  // a level shorter than the layers it has to hold, and one that starts past the end
+  bad = ktx2;
+  GetKTX2Level(bad, 1)->byte_length -= 1;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = ktx2;
+  GetKTX2Level(bad, 0)->byte_offset = 0xFFFFFFFFFFFFFF00ull;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+
+  // 3D arrays, non-square cubes and face counts that aren't a cube or a single face
+  bad = BuildKTX2(R8B8G8A8_UNORM, 4, 4, 4, 2, 1, 1);
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = BuildDDS(R8B8G8A8_UNORM, true, TEXTURE_FILE_3D, 4, 4, 4, 2, 1);
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = BuildKTX2(R8B8G8A8_UNORM, 8, 4, 0, 0, 6, 1);
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = BuildKTX2(R8B8G8A8_UNORM, 8, 8, 0, 0, 2, 1);
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+
+  // formats that can't be loaded
+  bad = dds;
+  GetDDSHeader(bad)->ddspf.four_cc = 0x31545858;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+  bad = ktx2;
+  GetKTX2Header(bad)->vk_format = 1000;
+  CHECK(TextureFileFormat::Parse(&bad[0], bad.size(), layout) != NULL);
+}
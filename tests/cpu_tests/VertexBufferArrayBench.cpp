@@ -0,0 +1,162 @@
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Buffers/VertexBufferArray.h"
+#include "private_inc/D3D12/Buffers/D3D12_VertexBufferArray.h"
+#include "FrameworkException.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Number of slots bound on each pass, as many as a large input layout uses
+/// </summary>
+static const UINT SLOTS = 12;
+
+/// <summary>
+/// Number of times every slot is bound on each pass
+/// </summary>
+static const UINT REPEATS = 2000000;
+
+/// <summary>
+/// Vertex buffer with a made up view, since no device creates the GPU memory
+/// </summary>
+class BenchVertexBuffer : public VertexBuffer
+{
+  public:
+    BenchVertexBuffer(UINT slot)
+    {
+      m_view.buffer_location = 0x10000 * (slot + 1);
+      m_view.size_in_bytes   = 4096;
+      m_view.stride_in_bytes = 16 + slot * 4;
+    }
+};
+
+/// <summary>
+/// Binds a vertex buffer the way the array did before VertexBuffer carried its view: a virtual overload per vertex
+/// format, each checking the index and copying the view into the D3D12 array
+/// </summary>
+class VirtualSetArray
+{
+  public:
+    virtual ~VirtualSetArray()
+    {
+    }
+
+    virtual void Set(UINT index, const BenchVertexBuffer& buffer) = 0;
+};
+
+/// <summary>
+/// Implementation of the per-format overload for the virtual baseline
+/// </summary>
+class D3D12_VirtualSetArray : public VirtualSetArray
+{
+  public:
+    D3D12_VirtualSetArray(UINT num_buffers)
+    :m_views(num_buffers)
+    {
+    }
+
+    void Set(UINT index, const BenchVertexBuffer& buffer)
+    {
+      if (index >= m_views.size())
+      {
+        throw FrameworkException("index beyond number of vertex buffers");
+      }
+      const VertexBufferView& view = buffer.GetView();
+      m_views[index].BufferLocation = view.buffer_location;
+      m_views[index].SizeInBytes    = view.size_in_bytes;
+      m_views[index].StrideInBytes  = view.stride_in_bytes;
+    }
+
+    vector<D3D12_VERTEX_BUFFER_VIEW> m_views;
+};
+
+/// <summary>
+/// Creates the virtual baseline out of sight of the benchmark loop, so the compiler can't call the overload directly
+/// </summary>
+static VirtualSetArray* (*volatile CreateVirtualSetArray)(UINT num_buffers) = [](UINT num_buffers) -> VirtualSetArray*
+{
+  return new D3D12_VirtualSetArray(num_buffers);
+};
+
+BENCHMARK(VertexBufferArraySet)
+{
+  // 2M binds of all 12 slots through VertexBufferArray::Set, the per-format virtual overloads it replaced, and plain
+  // stores of the views as the floor
+  vector<BenchVertexBuffer*> buffers;
+  for (UINT i = 0; i < SLOTS; i++)
+  {
+    buffers.push_back(new BenchVertexBuffer(i));
+  }
+  VertexBufferArray*               array         = VertexBufferArray::CreateD3D12(SLOTS);
+  VirtualSetArray*                 virtual_array = CreateVirtualSetArray(SLOTS);
+  vector<D3D12_VERTEX_BUFFER_VIEW> raw(SLOTS);
+
+  double best_set     = 1e30;
+  double best_virtual = 1e30;
+  double best_raw     = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    for (UINT r = 0; r < REPEATS; r++)
+    {
+      for (UINT i = 0; i < SLOTS; i++)
+      {
+        array->Set(i, *buffers[i]);
+      }
+    }
+    double time = BenchSeconds() - start;
+    best_set = time < best_set ? time : best_set;
+
+    start = BenchSeconds();
+    for (UINT r = 0; r < REPEATS; r++)
+    {
+      for (UINT i = 0; i < SLOTS; i++)
+      {
+        virtual_array->Set(i, *buffers[i]);
+      }
+    }
+    time = BenchSeconds() - start;
+    best_virtual = time < best_virtual ? time : best_virtual;
+
+    start = BenchSeconds();
+    for (UINT r = 0; r < REPEATS; r++)
+    {
+      for (UINT i = 0; i < SLOTS; i++)
+      {
+        const VertexBufferView& view = buffers[i]->GetView();
+        raw[i].BufferLocation = view.buffer_location;
+        raw[i].SizeInBytes    = view.size_in_bytes;
+        raw[i].StrideInBytes  = view.stride_in_bytes;
+      }
+    }
+    time = BenchSeconds() - start;
+    best_raw = time < best_raw ? time : best_raw;
+  }
+
+  // every path must have bound the same views
+  const D3D12_VERTEX_BUFFER_VIEW* views = ((D3D12_VertexBufferArray*)array)->GetArray();
+  const vector<D3D12_VERTEX_BUFFER_VIEW>& virtual_views = ((D3D12_VirtualSetArray*)virtual_array)->m_views;
+  bool bound = true;
+  for (UINT i = 0; i < SLOTS; i++)
+  {
+    bound = bound && views[i].BufferLocation == raw[i].BufferLocation && views[i].StrideInBytes == raw[i].StrideInBytes;
+    bound = bound && virtual_views[i].BufferLocation == raw[i].BufferLocation && virtual_views[i].SizeInBytes == raw[i].SizeInBytes;
+  }
+  CHECK(bound);
+
+  delete array;
+  delete virtual_array;
+  for (UINT i = 0; i < SLOTS; i++)
+  {
+    delete buffers[i];
+  }
+
+  double sets = (double)REPEATS * SLOTS;
+  ReportBenchmark("VertexBufferArray::Set", best_set * 1e9 / sets, "ns/Set");
+  ReportBenchmark("virtual per-format Set", best_virtual * 1e9 / sets, "ns/Set");
+  ReportBenchmark("plain view stores", best_raw * 1e9 / sets, "ns/Set");
+}
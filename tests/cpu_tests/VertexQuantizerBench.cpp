@@ -0,0 +1,172 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "RandomFixture.h"
+#include "Graphics/Mesh/VertexQuantizer.h"
+using namespace std;
+
+/// <summary>
+/// Number of times each pass is timed.  The fastest is reported
+/// </summary>
+static const int RUNS = 5;
+
+/// <summary>
+/// Number of vertices encoded on each pass, about as many as a detailed level of a large mesh
+/// </summary>
+static const UINT NUM_VERTICES = 1 << 20;
+
+/// <summary>
+/// Converts a float to a half with plain integer code, rounding to nearest even.  Denormal results flush to 0, which
+/// none of the benchmark's uvs produce
+/// </summary>
+static UINT16 FloatToHalfScalar(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint32_t sign     = (bits >> 16) & 0x8000;
+  int      exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+  uint32_t mantissa = bits & 0x7FFFFF;
+  if (exponent <= 0)
+  {
+    return (UINT16)sign;
+  }
+  if (exponent >= 31)
+  {
+    return (UINT16)(sign | 0x7C00);
+  }
+  uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+  uint32_t rest = mantissa & 0x1FFF;
+  half += rest > 0x1000 || (rest == 0x1000 && (half & 1)) ? 1 : 0;
+  return (UINT16)(sign | half);
+}
+
+/// <summary>
+/// Quantizes vertices 1 at a time with plain float code, the way the encoders would be written without SSE2
+/// </summary>
+static void QuantizeScalar(const Vertex_PositionTextureUVNormal* src, UINT num, const QuantizationBounds& bounds,
+  Vertex_PositionTextureUVNormalQ8* dst)
+{
+  const float center[3]    = { bounds.center.x, bounds.center.y, bounds.center.z };
+  const float inv_scale[3] = { bounds.extents.x > 0 ? 1 / bounds.extents.x : 0, bounds.extents.y > 0 ? 1 / bounds.extents.y : 0,
+                               bounds.extents.z > 0 ? 1 / bounds.extents.z : 0 };
+  for (UINT i = 0; i < num; i++)
+  {
+    const float* pos = &src[i].pos.x;
+    for (UINT k = 0; k < 3; k++)
+    {
+      float p = (pos[k] - center[k]) * inv_scale[k];
+      p = p < -1 ? -1 : (p > 1 ? 1 : p);
+      dst[i].pos[k] = (INT16)lrintf(p * 32767);
+    }
+    dst[i].pos[3] = 32767;
+
+    dst[i].uv[0] = FloatToHalfScalar(src[i].uv.x);
+    dst[i].uv[1] = FloatToHalfScalar(src[i].uv.y);
+
+    const DirectX::XMFLOAT3& n = src[i].normal;
+    float l1 = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+    float ox = l1 > 0 ? n.x / l1 : 0;
+    float oy = l1 > 0 ? n.y / l1 : 0;
+    if (n.z < 0)
+    {
+      float fold_x = (1 - fabsf(oy)) * (ox >= 0 ? 1 : -1);
+      float fold_y = (1 - fabsf(ox)) * (oy >= 0 ? 1 : -1);
+      ox = fold_x;
+      oy = fold_y;
+    }
+    dst[i].normal[0]  = (INT8)lrintf(ox * 127);
+    dst[i].normal[1]  = (INT8)lrintf(oy * 127);
+    dst[i].padding[0] = 0;
+    dst[i].padding[1] = 0;
+  }
+}
+
+/// <summary>
+/// Times a pass, keeping the fastest of RUNS
+/// </summary>
+template <class TPass>
+static double TimeBest(TPass pass)
+{
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++)
+  {
+    double start = BenchSeconds();
+    pass();
+    double time = BenchSeconds() - start;
+    best = time < best ? time : best;
+  }
+  return best;
+}
+
+BENCHMARK(VertexQuantizerThroughput)
+{
+  // 1M random position, uv and normal vertices, encoded 1 attribute at a time straight out of the interleaved
+  // vertices, then as whole vertices with both normal encodings and with a scalar loop as the baseline
+  uint32_t state = 2024;
+  vector<Vertex_PositionTextureUVNormal> src(NUM_VERTICES);
+  for (UINT i = 0; i < NUM_VERTICES; i++)
+  {
+    src[i].pos    = DirectX::XMFLOAT3(NextFixtureRandom(state) * 200 - 100, NextFixtureRandom(state) * 50, NextFixtureRandom(state) * 200 - 100);
+    src[i].uv     = DirectX::XMFLOAT2(NextFixtureRandom(state) * 4, NextFixtureRandom(state) * 4);
+    src[i].normal = DirectX::XMFLOAT3(NextFixtureRandom(state) * 2 - 1, NextFixtureRandom(state) * 2 - 1, NextFixtureRandom(state) * 2 - 1);
+  }
+  QuantizationBounds bounds = VertexQuantizer::ComputeBounds(&src[0].pos, sizeof(Vertex_PositionTextureUVNormal), NUM_VERTICES);
+  vector<Vertex_PositionTextureUVNormalQ8>  q8(NUM_VERTICES);
+  vector<Vertex_PositionTextureUVNormalQ10> q10(NUM_VERTICES);
+  vector<Vertex_PositionTextureUVNormalQ8>  scalar(NUM_VERTICES);
+  const UINT SRC_STRIDE = sizeof(Vertex_PositionTextureUVNormal);
+  const UINT Q8_STRIDE  = sizeof(Vertex_PositionTextureUVNormalQ8);
+
+  double bounds_time = TimeBest([&]()
+  {
+    bounds = VertexQuantizer::ComputeBounds(&src[0].pos, SRC_STRIDE, NUM_VERTICES);
+  });
+  double positions = TimeBest([&]()
+  {
+    VertexQuantizer::EncodePositions(&src[0].pos, SRC_STRIDE, NUM_VERTICES, bounds, q8[0].pos, Q8_STRIDE);
+  });
+  double uvs = TimeBest([&]()
+  {
+    VertexQuantizer::EncodeHalf2(&src[0].uv, SRC_STRIDE, NUM_VERTICES, q8[0].uv, Q8_STRIDE);
+  });
+  double normals8 = TimeBest([&]()
+  {
+    VertexQuantizer::EncodeOctahedralSNORM8(&src[0].normal, SRC_STRIDE, NUM_VERTICES, q8[0].normal, Q8_STRIDE);
+  });
+  double normals10 = TimeBest([&]()
+  {
+    VertexQuantizer::EncodeOctahedral1010102(&src[0].normal, SRC_STRIDE, NUM_VERTICES, &q10[0].normal, sizeof(Vertex_PositionTextureUVNormalQ10));
+  });
+  double quantize8 = TimeBest([&]()
+  {
+    VertexQuantizer::Quantize(&src[0], NUM_VERTICES, bounds, &q8[0]);
+  });
+  double quantize10 = TimeBest([&]()
+  {
+    VertexQuantizer::Quantize(&src[0], NUM_VERTICES, bounds, &q10[0]);
+  });
+  double quantize_scalar = TimeBest([&]()
+  {
+    QuantizeScalar(&src[0], NUM_VERTICES, bounds, &scalar[0]);
+  });
+
+  // the scalar loop rounds the same way, so apart from ties it must produce the same vertices
+  UINT mismatched = 0;
+  for (UINT i = 0; i < NUM_VERTICES; i++)
+  {
+    mismatched += memcmp(&q8[i], &scalar[i], sizeof(Vertex_PositionTextureUVNormalQ8)) != 0 ? 1 : 0;
+  }
+  CHECK(mismatched < NUM_VERTICES / 1000);
+
+  double millions = NUM_VERTICES / 1e6;
+  ReportBenchmark("ComputeBounds", millions / bounds_time, "M vertices/s");
+  ReportBenchmark("EncodePositions", millions / positions, "M vertices/s");
+  ReportBenchmark("EncodeHalf2", millions / uvs, "M vertices/s");
+  ReportBenchmark("EncodeOctahedralSNORM8", millions / normals8, "M vertices/s");
+  ReportBenchmark("EncodeOctahedral1010102", millions / normals10, "M vertices/s");
+  ReportBenchmark("Quantize, 8bit normals", millions / quantize8, "M vertices/s");
+  ReportBenchmark("Quantize, 10bit normals", millions / quantize10, "M vertices/s");
+  ReportBenchmark("scalar loop, 8bit normals", millions / quantize_scalar, "M vertices/s");
+}
@@ -0,0 +1,244 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "TestHarness.h"
+#include "Graphics/Mesh/VertexQuantizer.h"
+using namespace std;
+
+/// <summary>
+/// Encodes 1 float as a half float through EncodeHalf2
+/// </summary>
+static UINT16 EncodeHalf(float value)
+{
+  float pair[2] = { value, 0 };
+  UINT16 halfs[2];
+  VertexQuantizer::EncodeHalf2(pair, sizeof(pair), 1, halfs, sizeof(halfs));
+  return halfs[0];
+}
+
+/// <summary>
+/// Decodes a finite half float exactly
+/// </summary>
+static double DecodeHalf(UINT16 half)
+{
+  int    exponent = (half >> 10) & 0x1F;
+  int    mantissa = half & 0x3FF;
+  double value    = exponent == 0 ? ldexp((double)mantissa, -24) : ldexp((double)(mantissa | 0x400), exponent - 25);
+  return (half & 0x8000) ? -value : value;
+}
+
+/// <summary>
+/// Makes a float from its bits
+/// </summary>
+static float FloatFromBits(uint32_t bits)
+{
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/// <summary>
+/// Decodes an octahedral normal the way the shaders in Vertex_Quantized.h do, and returns the angle in degrees between
+/// it and the unit vector it was encoded from
+/// </summary>
+static double OctahedralAngle(float ox, float oy, const float* expected)
+{
+  float v[3] = { ox, oy, 1 - fabsf(ox) - fabsf(oy) };
+  float t    = -v[2] < 0 ? 0 : -v[2];
+  v[0] += v[0] >= 0 ? -t : t;
+  v[1] += v[1] >= 0 ? -t : t;
+  double length = sqrt((double)v[0] * v[0] + (double)v[1] * v[1] + (double)v[2] * v[2]);
+  double cosine = (v[0] * expected[0] + v[1] * expected[1] + v[2] * expected[2]) / length;
+  return acos(cosine > 1 ? 1 : cosine) * 180 / 3.14159265358979;
+}
+
+/// <summary>
+/// Spreads unit vectors evenly over the sphere with a Fibonacci spiral, plus the axes and the octahedron's edges and
+/// corners, which are where the folding is most likely to go wrong
+/// </summary>
+static vector<float> MakeUnitVectors(UINT num_spiral)
+{
+  vector<float> vectors;
+  for (UINT i = 0; i < num_spiral; i++)
+  {
+    float z     = 1 - 2 * (i + 0.5f) / num_spiral;
+    float r     = sqrtf(1 - z * z);
+    float angle = i * 2.39996323f;
+    vectors.push_back(r * cosf(angle));
+    vectors.push_back(r * sinf(angle));
+    vectors.push_back(z);
+  }
+  const float s = 0.70710678f;
+  const float t = 0.57735027f;
+  const float special[][3] =
+  {
+    { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+    { s, s, 0 }, { -s, s, 0 }, { s, -s, 0 }, { -s, -s, 0 }, { s, 0, -s }, { 0, -s, -s },
+    { t, t, t }, { -t, t, -t }, { t, -t, -t }, { -t, -t, -t }
+  };
+  for (UINT i = 0; i < sizeof(special) / sizeof(special[0]); i++)
+  {
+    vectors.insert(vectors.end(), special[i], special[i] + 3);
+  }
+  return vectors;
+}
+
+TEST(VertexQuantizerHalfRoundsToNearestEven)
+{
+  CHECK(EncodeHalf(0.0f) == 0x0000);
+  CHECK(EncodeHalf(-0.0f) == 0x8000);
+  CHECK(EncodeHalf(1.0f) == 0x3C00);
+  CHECK(EncodeHalf(-2.0f) == 0xC000);
+  CHECK(EncodeHalf(65504.0f) == 0x7BFF);
+
+  // halfway between 2 halfs rounds to the one with an even mantissa
+  CHECK(EncodeHalf(1.0f + ldexpf(1, -11)) == 0x3C00);
+  CHECK(EncodeHalf(1.0f + 3 * ldexpf(1, -11)) == 0x3C02);
+  CHECK(EncodeHalf(-(1.0f + 3 * ldexpf(1, -11))) == 0xBC02);
+  CHECK(EncodeHalf(ldexpf(1, -25)) == 0x0000);
+  CHECK(EncodeHalf(3 * ldexpf(1, -25)) == 0x0002);
+  CHECK(EncodeHalf(ldexpf(1, -24)) == 0x0001);
+
+  // past the largest half, including the tie with the next power of 2, is infinity
+  CHECK(EncodeHalf(65519.0f) == 0x7BFF);
+  CHECK(EncodeHalf(65520.0f) == 0x7C00);
+  CHECK(EncodeHalf(-1e10f) == 0xFC00);
+  CHECK(EncodeHalf(FloatFromBits(0x7F800000)) == 0x7C00);
+  CHECK((EncodeHalf(FloatFromBits(0x7FC00000)) & 0x7FFF) > 0x7C00);
+
+  // every 4099th float from the smallest subnormal half's neighbourhood up to the largest half rounds to the nearest
+  // half, and ties to the even one
+  UINT num_wrong = 0;
+  for (uint32_t bits = 0x32000000; bits <= 0x477FE000; bits += 4099)
+  {
+    double value   = FloatFromBits(bits);
+    UINT16 half    = EncodeHalf((float)value);
+    double error   = fabs(DecodeHalf(half) - value);
+    double below   = half > 0 ? fabs(DecodeHalf((UINT16)(half - 1)) - value) : 1e30;
+    double above   = half < 0x7BFF ? fabs(DecodeHalf((UINT16)(half + 1)) - value) : 1e30;
+    bool   nearest = error < below && error < above;
+    bool   tie     = (error == below || error == above) && (half & 1) == 0;
+    num_wrong += !(nearest || tie);
+  }
+  CHECK(num_wrong == 0);
+}
+
+TEST(VertexQuantizerHalfKeepsStrideAndTail)
+{
+  // 3 pairs in the middle of 20 byte vertices, so both the paired loop and the tail run
+  BYTE src[60];
+  BYTE dst[3 * 8];
+  memset(dst, 0xAB, sizeof(dst));
+  for (UINT i = 0; i < 3; i++)
+  {
+    float uv[2] = { 0.5f * i, -0.25f * i };
+    memcpy(src + i * 20 + 12, uv, sizeof(uv));
+  }
+  VertexQuantizer::EncodeHalf2(src + 12, 20, 3, dst + 2, 8);
+
+  for (UINT i = 0; i < 3; i++)
+  {
+    UINT16 pair[2];
+    memcpy(pair, dst + i * 8 + 2, sizeof(pair));
+    CHECK(DecodeHalf(pair[0]) == 0.5 * i);
+    CHECK(DecodeHalf(pair[1]) == -0.25 * i);
+    CHECK(dst[i * 8] == 0xAB && dst[i * 8 + 1] == 0xAB && dst[i * 8 + 6] == 0xAB && dst[i * 8 + 7] == 0xAB);
+  }
+}
+
+TEST(VertexQuantizerOctahedralErrorIsBounded)
+{
+  // the 8 bit grid steps by 1/127, which the octahedral mapping stretches to at most about 1 degree on the sphere.
+  // The 10 bit grid steps by 2/1023, about 4 times finer
+  const double MAX_DEGREES_8  = 1.0;
+  const double MAX_DEGREES_10 = 0.25;
+
+  vector<float> normals = MakeUnitVectors(20000);
+  UINT num = (UINT)normals.size() / 3;
+  vector<INT8> encoded8(num * 2);
+  vector<UINT> encoded10(num);
+  VertexQuantizer::EncodeOctahedralSNORM8(&normals[0], 3 * sizeof(float), num, &encoded8[0], 2);
+  VertexQuantizer::EncodeOctahedral1010102(&normals[0], 3 * sizeof(float), num, &encoded10[0], sizeof(UINT));
+
+  double worst8  = 0;
+  double worst10 = 0;
+  for (UINT i = 0; i < num; i++)
+  {
+    double angle8 = OctahedralAngle(encoded8[i * 2] / 127.0f, encoded8[i * 2 + 1] / 127.0f, &normals[i * 3]);
+    worst8 = angle8 > worst8 ? angle8 : worst8;
+
+    float  x10     = (encoded10[i] & 0x3FF) / 1023.0f * 2 - 1;
+    float  y10     = ((encoded10[i] >> 10) & 0x3FF) / 1023.0f * 2 - 1;
+    double angle10 = OctahedralAngle(x10, y10, &normals[i * 3]);
+    worst10 = angle10 > worst10 ? angle10 : worst10;
+
+    CHECK((encoded10[i] >> 20) == 0);
+  }
+  CHECK(worst8 <= MAX_DEGREES_8);
+  CHECK(worst10 <= MAX_DEGREES_10);
+
+  // encoding doesn't need normalized input
+  float long_normal[3] = { 0, 0, -5 };
+  INT8 pole[2];
+  VertexQuantizer::EncodeOctahedralSNORM8(long_normal, sizeof(long_normal), 1, pole, sizeof(pole));
+  const float down[3] = { 0, 0, -1 };
+  CHECK(OctahedralAngle(pole[0] / 127.0f, pole[1] / 127.0f, down) <= MAX_DEGREES_8);
+}
+
+TEST(VertexQuantizerPositionsCoverTheBounds)
+{
+  const float positions[][3] =
+  {
+    { -1, 2, 10 }, { 3, 6, 10 }, { 1, 4, 10 }, { 2, 5, 10 }, { -5, 100, 10 }
+  };
+  QuantizationBounds bounds = VertexQuantizer::ComputeBounds(positions, sizeof(positions[0]), 4);
+  CHECK(bounds.center.x == 1 && bounds.center.y == 4 && bounds.center.z == 10);
+  CHECK(bounds.extents.x == 2 && bounds.extents.y == 2 && bounds.extents.z == 0);
+
+  INT16 encoded[5][4];
+  VertexQuantizer::EncodePositions(positions, sizeof(positions[0]), 5, bounds, encoded, sizeof(encoded[0]));
+
+  // corners of the box map to the ends of the SNORM range, the center to 0 and w is always 1
+  CHECK(encoded[0][0] == -32767 && encoded[0][1] == -32767);
+  CHECK(encoded[1][0] == 32767 && encoded[1][1] == 32767);
+  CHECK(encoded[2][0] == 0 && encoded[2][1] == 0);
+  CHECK(encoded[3][0] == 16384 && encoded[3][1] == 16384);
+  for (UINT i = 0; i < 5; i++)
+  {
+    // a flat axis encodes as 0 rather than dividing by 0
+    CHECK(encoded[i][2] == 0);
+    CHECK(encoded[i][3] == 32767);
+  }
+
+  // positions outside the box clamp to it instead of wrapping
+  CHECK(encoded[4][0] == -32767 && encoded[4][1] == 32767);
+}
+
+TEST(VertexQuantizerPositionsRoundTripWithinHalfAStep)
+{
+  vector<float> positions;
+  for (UINT i = 0; i < 1001; i++)
+  {
+    positions.push_back(sinf(i * 0.37f) * 50 - 20);
+    positions.push_back(cosf(i * 0.11f) * 0.01f);
+    positions.push_back(i * 0.5f);
+  }
+  UINT num = (UINT)positions.size() / 3;
+  QuantizationBounds bounds = VertexQuantizer::ComputeBounds(&positions[0], 3 * sizeof(float), num);
+  vector<INT16> encoded(num * 4);
+  VertexQuantizer::EncodePositions(&positions[0], 3 * sizeof(float), num, bounds, &encoded[0], 4 * sizeof(INT16));
+
+  const float* center  = &bounds.center.x;
+  const float* extents = &bounds.extents.x;
+  for (UINT i = 0; i < num; i++)
+  {
+    for (UINT k = 0; k < 3; k++)
+    {
+      // half a step, plus the float error of the encode and decode
+      double step    = extents[k] / 32767.0;
+      double decoded = encoded[i * 4 + k] / 32767.0 * extents[k] + center[k];
+      CHECK_CLOSE(decoded, positions[i * 3 + k], step * 0.5 + fabs(center[k] + extents[k]) * 1e-6);
+    }
+  }
+}
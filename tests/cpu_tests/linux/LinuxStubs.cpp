@@ -0,0 +1,95 @@
+#include "Graphics/CommandList.h"
+#include "Graphics/Pipeline.h"
+#include "Graphics/Buffers/IndexBuffer16.h"
+#include "Graphics/Buffers/IndexBuffer32.h"
+#include "Graphics/Buffers/IndexBufferGPU16.h"
+#include "Graphics/Buffers/IndexBufferGPU32.h"
+#include "Graphics/Textures/Texture2D.h"
+#include "Graphics/Textures/Texture2DArray.h"
+#include "private_inc/D3D12/Buffers/D3D12_VertexBufferArray.h"
+#include "FrameworkException.h"
+
+// Definitions the framework keeps in translation units that need the D3D12 headers, which the Linux build does not
+// compile.  Only device independent code is tested, so these are never more than the trivial bodies of the originals,
+// and factories that would need a device throw.
+
+Pipeline::Pipeline()
+{
+}
+
+Pipeline::~Pipeline()
+{
+}
+
+CommandList::CommandList()
+{
+}
+
+CommandList::~CommandList()
+{
+}
+
+IndexBuffer16* IndexBuffer16::CreateD3D12(GraphicsCore& graphics, UINT num, const WORD* data)
+{
+  throw FrameworkException("Index buffers need a device");
+}
+
+IndexBuffer16::IndexBuffer16()
+{
+}
+
+IndexBuffer16::~IndexBuffer16()
+{
+}
+
+IndexBuffer32* IndexBuffer32::CreateD3D12(GraphicsCore& graphics, UINT num, const UINT* data)
+{
+  throw FrameworkException("Index buffers need a device");
+}
+
+IndexBuffer32::IndexBuffer32()
+{
+}
+
+IndexBuffer32::~IndexBuffer32()
+{
+}
+
+IndexBufferGPU16* IndexBufferGPU16::CreateD3D12(GraphicsCore& graphics, UINT num)
+{
+  throw FrameworkException("Index buffers need a device");
+}
+
+IndexBufferGPU32* IndexBufferGPU32::CreateD3D12(GraphicsCore& graphics, UINT num)
+{
+  throw FrameworkException("Index buffers need a device");
+}
+
+Texture2D* Texture2D::CreateD3D12(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, GraphicsDataFormat format, UINT16 mip_levels)
+{
+  throw FrameworkException("Textures need a device");
+}
+
+Texture2DArray* Texture2DArray::CreateD3D12(const GraphicsCore& graphics, ShaderResourceDescHeap& shader_buffer_heap, UINT width, UINT height, UINT16 length, GraphicsDataFormat format, UINT16 mip_levels)
+{
+  throw FrameworkException("Textures need a device");
+}
+
+D3D12_VertexBufferArray::D3D12_VertexBufferArray(UINT num_buffers)
+:VertexBufferArray(num_buffers)
+{
+}
+
+D3D12_VertexBufferArray::~D3D12_VertexBufferArray()
+{
+}
+
+void D3D12_VertexBufferArray::Set(UINT index, const StreamOutputBuffer& buffer)
+{
+  throw FrameworkException("Stream output buffers need a device");
+}
+
+const D3D12_VERTEX_BUFFER_VIEW* D3D12_VertexBufferArray::GetArray() const
+{
+  return (const D3D12_VERTEX_BUFFER_VIEW*)GetViews();
+}
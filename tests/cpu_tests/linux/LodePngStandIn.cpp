@@ -0,0 +1,241 @@
+#include <stdlib.h>
+#include <string.h>
+#include <png.h>
+#include <zlib.h>
+#include "lodepng/lodepng.h"
+
+// Stands in for the lodepng library, which is only checked in as a Windows .lib, when the CPU tests are built on
+// Linux.  Only the functions the framework and the tests call are defined, with the same contracts as lodepng, on top
+// of the system's libpng and zlib.  Error codes are lodepng's where there is an equivalent and 1 otherwise.
+
+const LodePNGDecompressSettings lodepng_default_decompress_settings = { 0, 0, 0, 0 };
+
+/// <summary>
+/// PNG signature and the length and type of the IHDR chunk that has to follow it
+/// </summary>
+static const unsigned char PNG_START[16] = { 137, 80, 78, 71, 13, 10, 26, 10, 0, 0, 0, 13, 'I', 'H', 'D', 'R' };
+
+/// <summary>
+/// Reads a big endian 32-bit value
+/// </summary>
+static unsigned ReadBigEndian(const unsigned char* src)
+{
+  return ((unsigned)src[0] << 24) | ((unsigned)src[1] << 16) | ((unsigned)src[2] << 8) | src[3];
+}
+
+const char* lodepng_error_text(unsigned code)
+{
+  switch (code)
+  {
+    case 0:
+      return "no error";
+    case 27:
+      return "PNG file is smaller than a PNG header";
+    case 28:
+      return "incorrect PNG signature";
+    case 29:
+      return "first chunk is not the header chunk";
+    case 53:
+      return "invalid zlib data";
+    case 83:
+      return "memory allocation failed";
+    default:
+      return "unable to decode or encode the PNG";
+  }
+}
+
+void lodepng_state_init(LodePNGState* state)
+{
+  state->info_png.color.colortype = LCT_RGBA;
+  state->info_png.color.bitdepth  = 8;
+  state->info_png.color.palette   = NULL;
+  state->info_png.interlace_method = 0;
+  state->error = 0;
+}
+
+void lodepng_state_cleanup(LodePNGState* state)
+{
+}
+
+unsigned lodepng_inspect(unsigned* w, unsigned* h, LodePNGState* state, const unsigned char* in, size_t insize)
+{
+  if (insize < 33)
+  {
+    return state->error = 27;
+  }
+  if (memcmp(in, PNG_START, 8) != 0)
+  {
+    return state->error = 28;
+  }
+  if (memcmp(in + 8, PNG_START + 8, 8) != 0)
+  {
+    return state->error = 29;
+  }
+
+  *w = ReadBigEndian(in + 16);
+  *h = ReadBigEndian(in + 20);
+  state->info_png.color.bitdepth   = in[24];
+  state->info_png.color.colortype  = (LodePNGColorType)in[25];
+  state->info_png.interlace_method = in[28];
+  return state->error = 0;
+}
+
+/// <summary>
+/// Gets the libpng simplified API format of an 8-bit lodepng color type
+/// </summary>
+static bool GetPngImageFormat(LodePNGColorType colortype, unsigned bitdepth, png_uint_32& format)
+{
+  if (bitdepth != 8)
+  {
+    return false;
+  }
+  switch (colortype)
+  {
+    case LCT_GREY:
+      format = PNG_FORMAT_GRAY;
+      return true;
+    case LCT_GREY_ALPHA:
+      format = PNG_FORMAT_GA;
+      return true;
+    case LCT_RGB:
+      format = PNG_FORMAT_RGB;
+      return true;
+    case LCT_RGBA:
+      format = PNG_FORMAT_RGBA;
+      return true;
+    default:
+      return false;
+  }
+}
+
+unsigned lodepng_decode_memory(unsigned char** out, unsigned* w, unsigned* h, const unsigned char* in, size_t insize,
+  LodePNGColorType colortype, unsigned bitdepth)
+{
+  *out = NULL;
+  png_image image;
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  png_uint_32 format;
+  if (!GetPngImageFormat(colortype, bitdepth, format) || !png_image_begin_read_from_memory(&image, in, insize))
+  {
+    png_image_free(&image);
+    return 1;
+  }
+
+  // begin_read sets the format of the file, which is converted to the one asked for
+  image.format = format;
+
+  *out = (unsigned char*)malloc(PNG_IMAGE_SIZE(image));
+  if (*out == NULL)
+  {
+    png_image_free(&image);
+    return 83;
+  }
+  if (!png_image_finish_read(&image, NULL, *out, 0, NULL))
+  {
+    free(*out);
+    *out = NULL;
+    return 1;
+  }
+  *w = image.width;
+  *h = image.height;
+  return 0;
+}
+
+unsigned lodepng_decode32(unsigned char** out, unsigned* w, unsigned* h, const unsigned char* in, size_t insize)
+{
+  return lodepng_decode_memory(out, w, h, in, insize, LCT_RGBA, 8);
+}
+
+unsigned lodepng_encode_memory(unsigned char** out, size_t* outsize, const unsigned char* image, unsigned w, unsigned h,
+  LodePNGColorType colortype, unsigned bitdepth)
+{
+  *out     = NULL;
+  *outsize = 0;
+  png_image png;
+  memset(&png, 0, sizeof(png));
+  png.version = PNG_IMAGE_VERSION;
+  png.width   = w;
+  png.height  = h;
+  if (!GetPngImageFormat(colortype, bitdepth, png.format))
+  {
+    return 1;
+  }
+
+  png_alloc_size_t size = 0;
+  if (!png_image_write_to_memory(&png, NULL, &size, 0, image, 0, NULL))
+  {
+    return 1;
+  }
+  *out = (unsigned char*)malloc(size);
+  if (*out == NULL)
+  {
+    return 83;
+  }
+  if (!png_image_write_to_memory(&png, *out, &size, 0, image, 0, NULL))
+  {
+    free(*out);
+    *out = NULL;
+    return 1;
+  }
+  *outsize = size;
+  return 0;
+}
+
+unsigned lodepng_encode32(unsigned char** out, size_t* outsize, const unsigned char* image, unsigned w, unsigned h)
+{
+  return lodepng_encode_memory(out, outsize, image, w, h, LCT_RGBA, 8);
+}
+
+unsigned lodepng_chunk_length(const unsigned char* chunk)
+{
+  return ReadBigEndian(chunk);
+}
+
+unsigned char lodepng_chunk_type_equals(const unsigned char* chunk, const char* type)
+{
+  return strlen(type) == 4 && memcmp(chunk + 4, type, 4) == 0;
+}
+
+const unsigned char* lodepng_chunk_data_const(const unsigned char* chunk)
+{
+  return chunk + 8;
+}
+
+const unsigned char* lodepng_chunk_next_const(const unsigned char* chunk)
+{
+  return chunk + 12 + lodepng_chunk_length(chunk);
+}
+
+unsigned lodepng_zlib_decompress(unsigned char** out, size_t* outsize, const unsigned char* in, size_t insize,
+  const LodePNGDecompressSettings* settings)
+{
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  if (inflateInit(&stream) != Z_OK)
+  {
+    return 83;
+  }
+  stream.next_in  = (Bytef*)in;
+  stream.avail_in = (uInt)insize;
+
+  size_t capacity = *outsize + insize * 4 + 1024;
+  int    result   = Z_OK;
+  while (result == Z_OK)
+  {
+    unsigned char* grown = (unsigned char*)realloc(*out, capacity);
+    if (grown == NULL)
+    {
+      inflateEnd(&stream);
+      return 83;
+    }
+    *out = grown;
+    stream.next_out  = *out + *outsize;
+    stream.avail_out = (uInt)(capacity - *outsize);
+    result = inflate(&stream, Z_NO_FLUSH);
+    *outsize = capacity - stream.avail_out;
+    capacity *= 2;
+  }
+  inflateEnd(&stream);
+  return result == Z_STREAM_END ? 0 : 53;
+}
@@ -0,0 +1,230 @@
+#ifndef CPU_TESTS_LINUX_D3D12_H
+#define CPU_TESTS_LINUX_D3D12_H
+
+// Stands in for the D3D12 header when the CPU tests are built on Linux.  Only the plain structures and enums of the
+// descriptions the framework builds on the CPU are declared, with the same layout and values as the Windows SDK, so the
+// code that fills them in can be tested without a device.  Nothing here can create or talk to a device.
+
+#include <windows.h>
+
+#define DEFINE_ENUM_FLAG_OPERATORS(type) \
+  inline type operator|(type a, type b) { return (type)((UINT)a | (UINT)b); } \
+  inline type& operator|=(type& a, type b) { a = a | b; return a; } \
+  inline type operator&(type a, type b) { return (type)((UINT)a & (UINT)b); } \
+  inline type& operator&=(type& a, type b) { a = a & b; return a; } \
+  inline type operator~(type a) { return (type)~(UINT)a; }
+
+enum D3D_ROOT_SIGNATURE_VERSION
+{
+  D3D_ROOT_SIGNATURE_VERSION_1   = 0x1,
+  D3D_ROOT_SIGNATURE_VERSION_1_0 = 0x1,
+  D3D_ROOT_SIGNATURE_VERSION_1_1 = 0x2
+};
+
+enum D3D12_SHADER_VISIBILITY
+{
+  D3D12_SHADER_VISIBILITY_ALL      = 0,
+  D3D12_SHADER_VISIBILITY_VERTEX   = 1,
+  D3D12_SHADER_VISIBILITY_HULL     = 2,
+  D3D12_SHADER_VISIBILITY_DOMAIN   = 3,
+  D3D12_SHADER_VISIBILITY_GEOMETRY = 4,
+  D3D12_SHADER_VISIBILITY_PIXEL    = 5
+};
+
+enum D3D12_ROOT_PARAMETER_TYPE
+{
+  D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE = 0,
+  D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS  = 1,
+  D3D12_ROOT_PARAMETER_TYPE_CBV              = 2,
+  D3D12_ROOT_PARAMETER_TYPE_SRV              = 3,
+  D3D12_ROOT_PARAMETER_TYPE_UAV              = 4
+};
+
+enum D3D12_DESCRIPTOR_RANGE_TYPE
+{
+  D3D12_DESCRIPTOR_RANGE_TYPE_SRV     = 0,
+  D3D12_DESCRIPTOR_RANGE_TYPE_UAV     = 1,
+  D3D12_DESCRIPTOR_RANGE_TYPE_CBV     = 2,
+  D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER = 3
+};
+
+#define D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND 0xffffffff
+
+enum D3D12_DESCRIPTOR_RANGE_FLAGS
+{
+  D3D12_DESCRIPTOR_RANGE_FLAG_NONE                                         = 0,
+  D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE                         = 0x1,
+  D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE                                = 0x2,
+  D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE             = 0x4,
+  D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC                                  = 0x8
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_DESCRIPTOR_RANGE_FLAGS)
+
+enum D3D12_ROOT_DESCRIPTOR_FLAGS
+{
+  D3D12_ROOT_DESCRIPTOR_FLAG_NONE                             = 0,
+  D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE                    = 0x2,
+  D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE = 0x4,
+  D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC                      = 0x8
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_ROOT_DESCRIPTOR_FLAGS)
+
+enum D3D12_ROOT_SIGNATURE_FLAGS
+{
+  D3D12_ROOT_SIGNATURE_FLAG_NONE                               = 0,
+  D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT = 0x1,
+  D3D12_ROOT_SIGNATURE_FLAG_DENY_VERTEX_SHADER_ROOT_ACCESS     = 0x2,
+  D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS       = 0x4,
+  D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS     = 0x8,
+  D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS   = 0x10,
+  D3D12_ROOT_SIGNATURE_FLAG_DENY_PIXEL_SHADER_ROOT_ACCESS      = 0x20,
+  D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT                = 0x40
+};
+DEFINE_ENUM_FLAG_OPERATORS(D3D12_ROOT_SIGNATURE_FLAGS)
+
+typedef int D3D12_FILTER;
+typedef int D3D12_TEXTURE_ADDRESS_MODE;
+typedef int D3D12_COMPARISON_FUNC;
+typedef int D3D12_STATIC_BORDER_COLOR;
+
+struct D3D12_DESCRIPTOR_RANGE
+{
+  D3D12_DESCRIPTOR_RANGE_TYPE RangeType;
+  UINT NumDescriptors;
+  UINT BaseShaderRegister;
+  UINT RegisterSpace;
+  UINT OffsetInDescriptorsFromTableStart;
+};
+
+struct D3D12_DESCRIPTOR_RANGE1
+{
+  D3D12_DESCRIPTOR_RANGE_TYPE RangeType;
+  UINT NumDescriptors;
+  UINT BaseShaderRegister;
+  UINT RegisterSpace;
+  D3D12_DESCRIPTOR_RANGE_FLAGS Flags;
+  UINT OffsetInDescriptorsFromTableStart;
+};
+
+struct D3D12_ROOT_DESCRIPTOR_TABLE
+{
+  UINT NumDescriptorRanges;
+  const D3D12_DESCRIPTOR_RANGE* pDescriptorRanges;
+};
+
+struct D3D12_ROOT_DESCRIPTOR_TABLE1
+{
+  UINT NumDescriptorRanges;
+  const D3D12_DESCRIPTOR_RANGE1* pDescriptorRanges;
+};
+
+struct D3D12_ROOT_CONSTANTS
+{
+  UINT ShaderRegister;
+  UINT RegisterSpace;
+  UINT Num32BitValues;
+};
+
+struct D3D12_ROOT_DESCRIPTOR
+{
+  UINT ShaderRegister;
+  UINT RegisterSpace;
+};
+
+struct D3D12_ROOT_DESCRIPTOR1
+{
+  UINT ShaderRegister;
+  UINT RegisterSpace;
+  D3D12_ROOT_DESCRIPTOR_FLAGS Flags;
+};
+
+struct D3D12_ROOT_PARAMETER
+{
+  D3D12_ROOT_PARAMETER_TYPE ParameterType;
+  union
+  {
+    D3D12_ROOT_DESCRIPTOR_TABLE DescriptorTable;
+    D3D12_ROOT_CONSTANTS Constants;
+    D3D12_ROOT_DESCRIPTOR Descriptor;
+  };
+  D3D12_SHADER_VISIBILITY ShaderVisibility;
+};
+
+struct D3D12_ROOT_PARAMETER1
+{
+  D3D12_ROOT_PARAMETER_TYPE ParameterType;
+  union
+  {
+    D3D12_ROOT_DESCRIPTOR_TABLE1 DescriptorTable;
+    D3D12_ROOT_CONSTANTS Constants;
+    D3D12_ROOT_DESCRIPTOR1 Descriptor;
+  };
+  D3D12_SHADER_VISIBILITY ShaderVisibility;
+};
+
+struct D3D12_STATIC_SAMPLER_DESC
+{
+  D3D12_FILTER Filter;
+  D3D12_TEXTURE_ADDRESS_MODE AddressU;
+  D3D12_TEXTURE_ADDRESS_MODE AddressV;
+  D3D12_TEXTURE_ADDRESS_MODE AddressW;
+  FLOAT MipLODBias;
+  UINT MaxAnisotropy;
+  D3D12_COMPARISON_FUNC ComparisonFunc;
+  D3D12_STATIC_BORDER_COLOR BorderColor;
+  FLOAT MinLOD;
+  FLOAT MaxLOD;
+  UINT ShaderRegister;
+  UINT RegisterSpace;
+  D3D12_SHADER_VISIBILITY ShaderVisibility;
+};
+
+struct D3D12_ROOT_SIGNATURE_DESC
+{
+  UINT NumParameters;
+  const D3D12_ROOT_PARAMETER* pParameters;
+  UINT NumStaticSamplers;
+  const D3D12_STATIC_SAMPLER_DESC* pStaticSamplers;
+  D3D12_ROOT_SIGNATURE_FLAGS Flags;
+};
+
+struct D3D12_ROOT_SIGNATURE_DESC1
+{
+  UINT NumParameters;
+  const D3D12_ROOT_PARAMETER1* pParameters;
+  UINT NumStaticSamplers;
+  const D3D12_STATIC_SAMPLER_DESC* pStaticSamplers;
+  D3D12_ROOT_SIGNATURE_FLAGS Flags;
+};
+
+typedef int DXGI_FORMAT;
+
+#define D3D12_APPEND_ALIGNED_ELEMENT 0xffffffff
+
+enum D3D12_INPUT_CLASSIFICATION
+{
+  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA   = 0,
+  D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA = 1
+};
+
+struct D3D12_INPUT_ELEMENT_DESC
+{
+  const char* SemanticName;
+  UINT SemanticIndex;
+  DXGI_FORMAT Format;
+  UINT InputSlot;
+  UINT AlignedByteOffset;
+  D3D12_INPUT_CLASSIFICATION InputSlotClass;
+  UINT InstanceDataStepRate;
+};
+
+typedef UINT64 D3D12_GPU_VIRTUAL_ADDRESS;
+
+struct D3D12_VERTEX_BUFFER_VIEW
+{
+  D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
+  UINT SizeInBytes;
+  UINT StrideInBytes;
+};
+
+#endif /* CPU_TESTS_LINUX_D3D12_H */
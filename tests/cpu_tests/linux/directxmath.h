@@ -0,0 +1,86 @@
+#ifndef CPU_TESTS_LINUX_DIRECTXMATH_H
+#define CPU_TESTS_LINUX_DIRECTXMATH_H
+
+// Stands in for DirectXMath when the CPU tests are built on Linux.  Only the storage types are declared, matching the
+// layout and constructors of the real ones, since the code under test does its own math on them.  XMMATRIX is just
+// enough for the overloads that take one to compile and store it.
+
+#include <stddef.h>
+#include <string.h>
+
+namespace DirectX
+{
+  struct XMFLOAT2
+  {
+    float x;
+    float y;
+
+    XMFLOAT2() {}
+    XMFLOAT2(float _x, float _y) : x(_x), y(_y) {}
+    explicit XMFLOAT2(const float* array) : x(array[0]), y(array[1]) {}
+  };
+
+  struct XMFLOAT3
+  {
+    float x;
+    float y;
+    float z;
+
+    XMFLOAT3() {}
+    XMFLOAT3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) {}
+    explicit XMFLOAT3(const float* array) : x(array[0]), y(array[1]), z(array[2]) {}
+  };
+
+  struct XMFLOAT4
+  {
+    float x;
+    float y;
+    float z;
+    float w;
+
+    XMFLOAT4() {}
+    XMFLOAT4(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) {}
+    explicit XMFLOAT4(const float* array) : x(array[0]), y(array[1]), z(array[2]), w(array[3]) {}
+  };
+
+  struct XMFLOAT4X4
+  {
+    union
+    {
+      struct
+      {
+        float _11, _12, _13, _14;
+        float _21, _22, _23, _24;
+        float _31, _32, _33, _34;
+        float _41, _42, _43, _44;
+      };
+      float m[4][4];
+    };
+
+    XMFLOAT4X4() {}
+    XMFLOAT4X4(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23,
+      float m30, float m31, float m32, float m33)
+    : _11(m00), _12(m01), _13(m02), _14(m03), _21(m10), _22(m11), _23(m12), _24(m13), _31(m20), _32(m21), _33(m22), _34(m23), _41(m30), _42(m31),
+      _43(m32), _44(m33)
+    {
+    }
+
+    float operator()(size_t row, size_t column) const { return m[row][column]; }
+    float& operator()(size_t row, size_t column) { return m[row][column]; }
+  };
+
+  struct XMMATRIX
+  {
+    float m[4][4];
+  };
+
+  typedef const XMMATRIX& FXMMATRIX;
+  typedef const XMMATRIX& CXMMATRIX;
+
+  inline void XMStoreFloat4x4(XMFLOAT4X4* destination, FXMMATRIX m)
+  {
+    memcpy(destination->m, m.m, sizeof(m.m));
+  }
+}
+
+#endif /* CPU_TESTS_LINUX_DIRECTXMATH_H */
@@ -0,0 +1 @@
+#include "windows.h"
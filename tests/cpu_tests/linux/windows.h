@@ -0,0 +1,52 @@
+#ifndef CPU_TESTS_LINUX_WINDOWS_H
+#define CPU_TESTS_LINUX_WINDOWS_H
+
+// Stands in for the Windows SDK header when the CPU tests are built on Linux.  Only the basic types the framework's
+// device independent headers use are declared, so code that needs more than that does not belong in these tests.
+// d3d12.h likewise only declares the plain description structures.
+// linux/case_aliases holds the differently cased names some headers use, since a Windows checkout cannot hold both
+// spellings in 1 directory.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int8_t    INT8;
+typedef int16_t   INT16;
+typedef int32_t   INT32;
+typedef int64_t   INT64;
+typedef uint8_t   UINT8;
+typedef uint16_t  UINT16;
+typedef uint32_t  UINT32;
+typedef uint64_t  UINT64;
+typedef int       INT;
+typedef unsigned  UINT;
+typedef int       BOOL;
+typedef uint8_t   BYTE;
+typedef uint16_t  WORD;
+typedef uint32_t  DWORD;
+typedef long      LONG;
+typedef uint32_t  ULONG;
+typedef int64_t   LONGLONG;
+typedef uint64_t  ULONGLONG;
+typedef float     FLOAT;
+typedef char      CHAR;
+typedef size_t    SIZE_T;
+typedef void*     HANDLE;
+typedef void*     HWND;
+typedef void*     HINSTANCE;
+typedef long      HRESULT;
+
+#ifndef TRUE
+#define TRUE  1
+#define FALSE 0
+#endif
+
+struct RECT
+{
+  LONG left;
+  LONG top;
+  LONG right;
+  LONG bottom;
+};
+
+#endif /* CPU_TESTS_LINUX_WINDOWS_H */
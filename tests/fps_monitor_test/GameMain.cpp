@@ -7,7 +7,6 @@
 #include "GameMain.h"
 #include "FrameworkException.h"
 #include "log.h"
-#include "lodepng/lodepng.h"
 using namespace DirectX;
 using namespace std;
 
@@ -226,22 +225,7 @@ void GameMain::CreateFPSMonitor()
     lookup_table.insert(make_pair(key, uv));
   }
 
-  unsigned char* image_data = NULL;
-  unsigned width = 0;
-  unsigned height = 0;
-  if (lodepng_decode32_file(&image_data, &width, &height, "fps_font.png"))
-  {
-    ostringstream out;
-    out << "Failed to load fps_font.ping\n";
-    log_print(out.str().c_str());
-    exit(1);
-  }
-
+  // the font is decoded straight into its texture's upload buffer
   GraphicsCore& graphics = GetGraphics();
-  const UINT num_bytes = width * height * sizeof(UINT);
-  vector<UINT8> bytes(num_bytes);
-  memcpy(&(bytes[0]), image_data, num_bytes);
-
-  m_fps = new FPSMonitor(graphics, FPS_MONITOR_NUM_SAMPLES, lookup_table, width, height, bytes, char_width, char_height);
-  free(image_data);
+  m_fps = new FPSMonitor(graphics, FPS_MONITOR_NUM_SAMPLES, lookup_table, "fps_font.png", char_width, char_height);
 }
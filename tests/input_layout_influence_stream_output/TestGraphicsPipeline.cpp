@@ -175,12 +175,12 @@ TestGraphicsPipeline::TestGraphicsPipeline(GraphicsCore& graphics)
 
   try
   {
-    m_readback = ReadbackBuffer::CreateD3D12(graphics, (UINT)(sizeof(UINT64) * m_so_buffers.size()));
+    m_readback = ReadbackRing::CreateD3D12(graphics, 3, (UINT)(sizeof(UINT64) * m_so_buffers.size()));
   }
   catch (const FrameworkException& err)
   {
     ostringstream out;
-    out << "Unable to create readback buffer:\n" << err.what();
+    out << "Unable to create readback ring:\n" << err.what();
     log_print(out.str().c_str());
     exit(1);
   }
@@ -290,23 +290,22 @@ void TestGraphicsPipeline::Draw(GraphicsCore& graphics)
     m_command_list->SOSetBuffers(*m_so_array);
 
     m_command_list->DrawInstanced(m_model->GetVertexBuffer()->GetNumVertices(), 1, 0);
-    m_command_list->Close();
-    graphics.ExecuteCommandList(*m_command_list);
-    graphics.WaitOnFence();
-
-    // determine the number of vertices written to the stream output buffer
-    vector<UINT> num_verts;
-    StreamOutputBuffer::GetNumVerticesWrittenD3D12(graphics, *m_command_list, m_so_buffers, *m_readback, num_verts);
 
-    ostringstream debug_log;
-    debug_log << "Stream output buffer num verts: " << num_verts[0] << '\n';
-    log_print(debug_log.str().c_str());
+    // read back the number of vertices written to the stream output buffer without waiting on the GPU.  It is
+    // logged once the GPU has finished this frame's commands
+    m_readback->PrepNumVerticesWritten(*m_command_list, m_so_buffers, [](const vector<UINT>& num_verts)
+    {
+      ostringstream debug_log;
+      debug_log << "Stream output buffer num verts: " << num_verts[0] << '\n';
+      log_print(debug_log.str().c_str());
+    });
 
-    m_command_list->Reset(NULL);
     m_command_list->RenderTargetToPresent(current_render_target);
     m_command_list->Close();
 
     graphics.ExecuteCommandList(*m_command_list);
+    m_readback->Submit();
+    m_readback->Poll();
 
     graphics.Swap();
   }
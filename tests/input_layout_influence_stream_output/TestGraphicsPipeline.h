@@ -9,6 +9,7 @@
 #include "Graphics/CommandListBundle.h"
 #include "Graphics/ShaderResourceDescHeap.h"
 #include "Graphics/Buffers/ConstantBuffer.h"
+#include "Graphics/Buffers/ReadbackRing.h"
 #include "Graphics/HeapArray.h"
 #include "TestModel.h"
 #include "Camera.h"
@@ -152,9 +153,9 @@ class TestGraphicsPipeline
     std::vector<StreamOutputBuffer*> m_so_buffers;
 
     /// <summary>
-    /// readback buffer for determining how many vertices were written to the stream output buffer
+    /// readback slots for determining how many vertices were written to the stream output buffer
     /// </summary>
-    ReadbackBuffer* m_readback;
+    ReadbackRing* m_readback;
 
     /// <summary>
     /// array of stream output buffers
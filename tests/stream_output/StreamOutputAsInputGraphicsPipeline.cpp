@@ -7,7 +7,8 @@ using namespace DirectX;
 using namespace std;
 
 StreamOutputAsInputGraphicsPipeline::StreamOutputAsInputGraphicsPipeline(GraphicsCore& graphics, TestGraphicsPipeline& normal_pipeline)
-:m_camera(NULL)
+:m_camera(NULL),
+ m_num_verts(0)
 {
   try
   {
@@ -73,14 +74,27 @@ StreamOutputAsInputGraphicsPipeline::StreamOutputAsInputGraphicsPipeline(Graphic
     log_print(out.str().c_str());
     exit(1);
   }
+  // both passes are in the same command list, so this pass needs its own matrix rather than overwriting the one the
+  // stream output pass has yet to read
   try
   {
-    m_readback = ReadbackBuffer::CreateD3D12(graphics, (UINT)(sizeof(UINT64) * normal_pipeline.m_so_buffers.size()));
+    m_constant_buffer = ConstantBuffer::CreateD3D12(graphics, *normal_pipeline.m_shader_buffer_heap, sizeof(XMMATRIX));
   }
   catch (const FrameworkException& err)
   {
     ostringstream out;
-    out << "Unable to create readback buffer:\n" << err.what();
+    out << "Unable to create constant buffer:\n" << err.what();
+    log_print(out.str().c_str());
+    exit(1);
+  }
+  try
+  {
+    m_readback = ReadbackRing::CreateD3D12(graphics, 3, (UINT)(sizeof(UINT64) * normal_pipeline.m_so_buffers.size()));
+  }
+  catch (const FrameworkException& err)
+  {
+    ostringstream out;
+    out << "Unable to create readback ring:\n" << err.what();
     log_print(out.str().c_str());
     exit(1);
   }
@@ -89,13 +103,13 @@ StreamOutputAsInputGraphicsPipeline::StreamOutputAsInputGraphicsPipeline(Graphic
   m_so_buffers      = normal_pipeline.m_so_buffers;
   m_scissor_rect    = normal_pipeline.m_scissor_rect;
   m_depth_stencil   = normal_pipeline.m_depth_stencil;
-  m_constant_buffer = normal_pipeline.m_constant_buffer;
   m_heap_array      = normal_pipeline.m_heap_array;
 }
 
 StreamOutputAsInputGraphicsPipeline::~StreamOutputAsInputGraphicsPipeline()
 {
   delete m_readback;
+  delete m_constant_buffer;
   delete m_so_vert_array;
   delete m_so_vertex_shader;
   delete m_so_pipeline;
@@ -113,16 +127,20 @@ void StreamOutputAsInputGraphicsPipeline::Draw(GraphicsCore& graphics)
   {
     const RenderTarget& current_render_target = graphics.GetBackBuffer().GetCurrentRenderTarget();
 
-    // determine the number of vertices written to the stream output buffer
-    vector<UINT> num_verts;
-    StreamOutputBuffer::GetNumVerticesWrittenD3D12(graphics, *m_command_list, m_so_buffers, *m_readback, num_verts);
+    // read back the number of vertices written to the stream output buffer without waiting on the GPU.  D3D12 has no
+    // DrawAuto, so the copy is drawn with the count of an earlier frame, which matches this frame's since the model
+    // and tessellation don't change.  Nothing is drawn until the first count arrives a couple of frames in
+    m_readback->PrepNumVerticesWritten(*m_command_list, m_so_buffers, [this](const vector<UINT>& num_verts)
+    {
+      m_num_verts = num_verts[0];
 
-    ostringstream debug_log;
-    debug_log << "Stream output buffer num verts: " << num_verts[0] << '\n';
-    log_print(debug_log.str().c_str());
+      ostringstream debug_log;
+      debug_log << "Stream output buffer num verts: " << num_verts[0] << '\n';
+      log_print(debug_log.str().c_str());
+    });
 
-    // draw using the stream output buffer as input
-    m_command_list->Reset(m_so_pipeline);
+    // draw using the stream output buffer as input, continuing the command list TestGraphicsPipeline::Draw recorded
+    m_command_list->SetPipeline(*m_so_pipeline);
     m_command_list->SetRootSignature(*m_so_root_sig);
     m_command_list->RSSetViewport(graphics.GetDefaultViewport());
     m_command_list->RSSetScissorRect(m_scissor_rect);
@@ -144,13 +162,15 @@ void StreamOutputAsInputGraphicsPipeline::Draw(GraphicsCore& graphics)
     m_command_list->SOBufferToVertexBuffer(*(m_so_buffers[0]));
     m_command_list->IASetTopology(IA_TOPOLOGY_TRIANGLE_LIST);
     m_command_list->IASetVertexBuffers(*m_so_vert_array);
-    m_command_list->DrawInstanced(num_verts[0], 0, 1, 0);
+    m_command_list->DrawInstanced(m_num_verts, 0, 1, 0);
     m_command_list->SOVertexBufferToStreamOutputBuffer(*(m_so_buffers[0]));
 
     m_command_list->RenderTargetToPresent(current_render_target);
     m_command_list->Close();
 
     graphics.ExecuteCommandList(*m_command_list);
+    m_readback->Submit();
+    m_readback->Poll();
 
     graphics.Swap();
   }
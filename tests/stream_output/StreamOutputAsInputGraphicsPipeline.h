@@ -12,6 +12,7 @@ class TestGraphicsPipeline;
 #include "Graphics/ShaderResourceDescHeap.h"
 #include "Graphics/Buffers/ConstantBuffer.h"
 #include "Graphics/HeapArray.h"
+#include "Graphics/Buffers/ReadbackRing.h"
 #include "TestModel.h"
 #include "Camera.h"
 #include "TestGraphicsPipeline.h"
@@ -31,7 +32,8 @@ class StreamOutputAsInputGraphicsPipeline
     void SetCamera(const Camera* cam);
 
     /// <summary>
-    /// Draws the current frame
+    /// Finishes the frame TestGraphicsPipeline::Draw started by drawing its stream output buffer, then submits and
+    /// presents it
     /// </summary>
     /// <param name="graphics">
     /// core graphics interface
@@ -81,9 +83,14 @@ class StreamOutputAsInputGraphicsPipeline
     Pipeline* m_so_pipeline;
 
     /// <summary>
-    /// readback buffer for determining how many vertices were written to the stream output buffer
+    /// readback ring for determining how many vertices were written to the stream output buffer
     /// </summary>
-    ReadbackBuffer* m_readback;
+    ReadbackRing* m_readback;
+
+    /// <summary>
+    /// number of vertices written to the stream output buffer in the most recent frame whose count has been read back
+    /// </summary>
+    UINT m_num_verts;
 
     /// <summary>
     /// command list to draw with
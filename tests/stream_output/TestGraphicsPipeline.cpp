@@ -175,7 +175,8 @@ TestGraphicsPipeline::TestGraphicsPipeline(GraphicsCore& graphics)
   // create the descriptor heap
   try
   {
-    m_shader_buffer_heap = ShaderResourceDescHeap::CreateD3D12(graphics, 2);
+    // 1 more than this pipeline uses for StreamOutputAsInputGraphicsPipeline's constant buffer
+    m_shader_buffer_heap = ShaderResourceDescHeap::CreateD3D12(graphics, 3);
   }
   catch (const FrameworkException& err)
   {
@@ -322,10 +323,9 @@ void TestGraphicsPipeline::Draw(GraphicsCore& graphics)
     m_command_list->SOSetBuffers(*m_so_array);
 
     m_command_list->DrawIndexedInstanced(index_buffer->GetNumIndices(), 1, 0);
-    m_command_list->Close();
-    graphics.ExecuteCommandList(*m_command_list);
-    graphics.WaitOnFence();
 
+    // the command list is left open for StreamOutputAsInputGraphicsPipeline to draw the stream output buffer and
+    // submit the frame, so the GPU never has to finish this pass before the next one is recorded
   }
   catch (const FrameworkException& err)
   {
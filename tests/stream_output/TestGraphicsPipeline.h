@@ -55,7 +55,8 @@ class TestGraphicsPipeline
     void SetCamera(const Camera* cam);
 
     /// <summary>
-    /// Draws the current frame
+    /// Records the draw of the current frame that writes to the stream output buffer.  The command list is left open
+    /// for StreamOutputAsInputGraphicsPipeline::Draw, which finishes and submits the frame
     /// </summary>
     /// <param name="graphics">
     /// core graphics interface
@@ -0,0 +1,429 @@
+// Converts a Wavefront OBJ file into a binary mesh file that can be opened with MeshFile::OpenD3D12.
+//
+// usage: obj_to_mesh <input obj> <output mesh>
+//
+// Faces are triangulated as fans and each unique position/uv/normal combination becomes 1 vertex.  Vertices have a
+// POSITION element, then TEXCOORD and NORMAL elements if the file has any uvs or normals, matching the order of
+// Vertex_PositionTextureUVNormal.  OBJ files are right handed with counter clockwise front faces and uvs starting at
+// the bottom, so z is negated and v is flipped to get the left handed, clockwise, top down convention the framework
+// uses.  Each "o", "g" or "usemtl" line starts a new submesh.
+//
+// Only standard C++ is used, so the tool can also be run as part of a non-Windows content build.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "private_inc/MeshFileFormat.h"
+#include "public_inc/Graphics/Semantics.h"
+#include "public_inc/Graphics/GraphicsDataFormat.h"
+using namespace std;
+
+/// <summary>
+/// Indices of the position, uv and normal of a face corner.  The uv and normal are -1 when the corner doesn't have
+/// one
+/// </summary>
+struct CornerKey
+{
+  int position;
+  int uv;
+  int normal;
+
+  bool operator==(const CornerKey& rhs) const
+  {
+    return position == rhs.position && uv == rhs.uv && normal == rhs.normal;
+  }
+};
+
+/// <summary>
+/// Hash function for finding corners that were already turned into vertices
+/// </summary>
+struct CornerKeyHash
+{
+  size_t operator()(const CornerKey& key) const
+  {
+    uint64_t hash = (uint64_t)(uint32_t)key.position * 0x9E3779B97F4A7C15ULL;
+    hash ^= ((uint64_t)(uint32_t)key.uv + (hash << 6) + (hash >> 2)) * 0xC2B2AE3D27D4EB4FULL;
+    hash ^= ((uint64_t)(uint32_t)key.normal + (hash << 6) + (hash >> 2)) * 0x165667B19E3779F9ULL;
+    return (size_t)(hash ^ (hash >> 32));
+  }
+};
+
+/// <summary>
+/// Contents of the OBJ file, converted into indexed triangles
+/// </summary>
+struct ObjMesh
+{
+  /// <summary>
+  /// x, y, z of each position in the file
+  /// </summary>
+  vector<float> positions;
+
+  /// <summary>
+  /// u, v of each uv in the file
+  /// </summary>
+  vector<float> uvs;
+
+  /// <summary>
+  /// x, y, z of each normal in the file
+  /// </summary>
+  vector<float> normals;
+
+  /// <summary>
+  /// corners that make up the vertices of the mesh
+  /// </summary>
+  vector<CornerKey> vertices;
+
+  /// <summary>
+  /// triangle list indices into vertices
+  /// </summary>
+  vector<uint32_t> indices;
+
+  /// <summary>
+  /// index in indices where each submesh starts
+  /// </summary>
+  vector<uint32_t> submesh_starts;
+};
+
+/// <summary>
+/// Reads an entire file into memory, followed by a null terminator
+/// </summary>
+/// <param name="path">
+/// path to the file
+/// </param>
+/// <param name="data">
+/// receives the contents of the file
+/// </param>
+/// <returns>
+/// true  if the file was read
+/// false otherwise
+/// </returns>
+static bool LoadFile(const string& path, vector<char>& data)
+{
+  ifstream in(path.c_str(), ios_base::in | ios_base::binary);
+  if (!in.good())
+  {
+    return false;
+  }
+
+  in.seekg(0, ios_base::end);
+  streamoff len = in.tellg();
+  if (len < 0)
+  {
+    return false;
+  }
+  in.seekg(0, ios_base::beg);
+  data.resize((size_t)len + 1);
+  data[(size_t)len] = '\0';
+  return len == 0 || (bool)in.read(&data[0], len);
+}
+
+/// <summary>
+/// Converts a 1 based or negative relative OBJ index into a 0 based index
+/// </summary>
+/// <param name="index">
+/// index from the file
+/// </param>
+/// <param name="count">
+/// number of items of that type read so far
+/// </param>
+/// <returns>
+/// 0 based index, or -1 if the index is out of range
+/// </returns>
+static int ResolveIndex(long index, size_t count)
+{
+  long resolved = index > 0 ? index - 1 : (long)count + index;
+  return resolved >= 0 && (size_t)resolved < count ? (int)resolved : -1;
+}
+
+/// <summary>
+/// Parses the corners of a face line and adds its triangles to the mesh
+/// </summary>
+/// <param name="p">
+/// text following the "f"
+/// </param>
+/// <param name="mesh">
+/// mesh to add to
+/// </param>
+/// <param name="lookup">
+/// vertex each corner already added to the mesh became
+/// </param>
+/// <returns>
+/// true  if the face was valid
+/// false otherwise
+/// </returns>
+static bool ParseFace(const char* p, ObjMesh& mesh, unordered_map<CornerKey, uint32_t, CornerKeyHash>& lookup)
+{
+  uint32_t corners[64];
+  size_t   num_corners = 0;
+  for (;;)
+  {
+    while (*p == ' ' || *p == '\t')
+    {
+      p++;
+    }
+    if (*p == '\0' || *p == '\n' || *p == '\r' || *p == '#')
+    {
+      break;
+    }
+
+    char* end;
+    CornerKey key = { -1, -1, -1 };
+    key.position = ResolveIndex(strtol(p, &end, 10), mesh.positions.size() / 3);
+    if (end == p || key.position < 0)
+    {
+      return false;
+    }
+    p = end;
+    if (*p == '/')
+    {
+      p++;
+      if (*p != '/')
+      {
+        key.uv = ResolveIndex(strtol(p, &end, 10), mesh.uvs.size() / 2);
+        if (end == p || key.uv < 0)
+        {
+          return false;
+        }
+        p = end;
+      }
+      if (*p == '/')
+      {
+        p++;
+        key.normal = ResolveIndex(strtol(p, &end, 10), mesh.normals.size() / 3);
+        if (end == p || key.normal < 0)
+        {
+          return false;
+        }
+        p = end;
+      }
+    }
+
+    if (num_corners == sizeof(corners) / sizeof(corners[0]))
+    {
+      return false;
+    }
+    unordered_map<CornerKey, uint32_t, CornerKeyHash>::iterator it = lookup.find(key);
+    if (it == lookup.end())
+    {
+      it = lookup.insert(make_pair(key, (uint32_t)mesh.vertices.size())).first;
+      mesh.vertices.push_back(key);
+    }
+    corners[num_corners++] = it->second;
+  }
+
+  for (size_t i = 2; i < num_corners; i++)
+  {
+    mesh.indices.push_back(corners[0]);
+    mesh.indices.push_back(corners[i - 1]);
+    mesh.indices.push_back(corners[i]);
+  }
+  return num_corners >= 3;
+}
+
+/// <summary>
+/// Parses the floats following a keyword
+/// </summary>
+/// <param name="p">
+/// text following the keyword
+/// </param>
+/// <param name="num">
+/// number of floats to read
+/// </param>
+/// <param name="dst">
+/// where to add the floats
+/// </param>
+static void ParseFloats(const char* p, size_t num, vector<float>& dst)
+{
+  for (size_t i = 0; i < num; i++)
+  {
+    char* end;
+    dst.push_back(strtof(p, &end));
+    p = end;
+  }
+}
+
+/// <summary>
+/// Parses an OBJ file
+/// </summary>
+/// <param name="text">
+/// null terminated contents of the file
+/// </param>
+/// <param name="mesh">
+/// receives the mesh
+/// </param>
+/// <param name="error_line">
+/// receives the line number of the first invalid face
+/// </param>
+/// <returns>
+/// true  if the file was parsed
+/// false otherwise
+/// </returns>
+static bool ParseObj(const char* text, ObjMesh& mesh, size_t& error_line)
+{
+  unordered_map<CornerKey, uint32_t, CornerKeyHash> lookup;
+  mesh.submesh_starts.push_back(0);
+  size_t line = 1;
+  for (const char* p = text; *p != '\0'; line++)
+  {
+    while (*p == ' ' || *p == '\t')
+    {
+      p++;
+    }
+
+    if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+    {
+      ParseFloats(p + 2, 3, mesh.positions);
+    }
+    else if (p[0] == 'v' && p[1] == 't' && (p[2] == ' ' || p[2] == '\t'))
+    {
+      ParseFloats(p + 3, 2, mesh.uvs);
+    }
+    else if (p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t'))
+    {
+      ParseFloats(p + 3, 3, mesh.normals);
+    }
+    else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+    {
+      if (!ParseFace(p + 2, mesh, lookup))
+      {
+        error_line = line;
+        return false;
+      }
+    }
+    else if (((p[0] == 'o' || p[0] == 'g') && (p[1] == ' ' || p[1] == '\t')) || strncmp(p, "usemtl", 6) == 0)
+    {
+      if (mesh.indices.size() > mesh.submesh_starts.back())
+      {
+        mesh.submesh_starts.push_back((uint32_t)mesh.indices.size());
+      }
+    }
+
+    while (*p != '\0' && *p != '\n')
+    {
+      p++;
+    }
+    if (*p == '\n')
+    {
+      p++;
+    }
+  }
+
+  // a group or material with no faces after it, such as a trailing usemtl, doesn't start a submesh
+  if (mesh.submesh_starts.size() > 1 && mesh.submesh_starts.back() == mesh.indices.size())
+  {
+    mesh.submesh_starts.pop_back();
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc != 3)
+  {
+    fprintf(stderr, "usage: %s <input obj> <output mesh>\n", argv[0]);
+    return 1;
+  }
+
+  vector<char> text;
+  if (!LoadFile(argv[1], text))
+  {
+    fprintf(stderr, "Unable to read \"%s\"\n", argv[1]);
+    return 1;
+  }
+
+  ObjMesh mesh;
+  size_t error_line = 0;
+  if (!ParseObj(&text[0], mesh, error_line))
+  {
+    fprintf(stderr, "\"%s\" has an invalid face on line %u\n", argv[1], (unsigned)error_line);
+    return 1;
+  }
+  if (mesh.indices.empty())
+  {
+    fprintf(stderr, "\"%s\" has no faces\n", argv[1]);
+    return 1;
+  }
+
+  // elements, in the order of Vertex_PositionTextureUVNormal
+  bool has_uvs     = false;
+  bool has_normals = false;
+  for (size_t i = 0; i < mesh.vertices.size(); i++)
+  {
+    has_uvs     = has_uvs || mesh.vertices[i].uv >= 0;
+    has_normals = has_normals || mesh.vertices[i].normal >= 0;
+  }
+  vector<MeshFileElement> elements;
+  MeshFileElement position = { SEM_POSITION, 0, R32G32B32_FLOAT, 0, 0 };
+  elements.push_back(position);
+  uint32_t stride = 3 * sizeof(float);
+  if (has_uvs)
+  {
+    MeshFileElement uv = { SEM_TEXCOORD, 0, R32G32_FLOAT, 0, 0 };
+    elements.push_back(uv);
+    stride += 2 * sizeof(float);
+  }
+  if (has_normals)
+  {
+    MeshFileElement normal = { SEM_NORMAL, 0, R32G32B32_FLOAT, 0, 0 };
+    elements.push_back(normal);
+    stride += 3 * sizeof(float);
+  }
+
+  // interleave the vertices, converting to the left handed convention
+  vector<float> vertices;
+  vertices.reserve(mesh.vertices.size() * (stride / sizeof(float)));
+  for (size_t i = 0; i < mesh.vertices.size(); i++)
+  {
+    const CornerKey& key = mesh.vertices[i];
+    const float* pos = &mesh.positions[key.position * 3];
+    vertices.push_back(pos[0]);
+    vertices.push_back(pos[1]);
+    vertices.push_back(-pos[2]);
+    if (has_uvs)
+    {
+      const float* uv = key.uv >= 0 ? &mesh.uvs[key.uv * 2] : NULL;
+      vertices.push_back(uv != NULL ? uv[0] : 0.0f);
+      vertices.push_back(uv != NULL ? 1.0f - uv[1] : 0.0f);
+    }
+    if (has_normals)
+    {
+      const float* normal = key.normal >= 0 ? &mesh.normals[key.normal * 3] : NULL;
+      vertices.push_back(normal != NULL ? normal[0] : 0.0f);
+      vertices.push_back(normal != NULL ? normal[1] : 0.0f);
+      vertices.push_back(normal != NULL ? -normal[2] : 0.0f);
+    }
+  }
+
+  vector<MeshFileSubmesh> submeshes(mesh.submesh_starts.size());
+  for (size_t i = 0; i < submeshes.size(); i++)
+  {
+    uint32_t end = i + 1 < submeshes.size() ? mesh.submesh_starts[i + 1] : (uint32_t)mesh.indices.size();
+    submeshes[i].first_index = mesh.submesh_starts[i];
+    submeshes[i].num_indices = end - submeshes[i].first_index;
+  }
+
+  // the format computes the offsets, index size and bounds, so every writer produces the same layout
+  vector<uint8_t> file;
+  const char* error = MeshFileFormat::Pack(elements, &vertices[0], (uint32_t)mesh.vertices.size(), mesh.indices, submeshes, file);
+  if (error != NULL)
+  {
+    fprintf(stderr, "Mesh %s\n", error);
+    return 1;
+  }
+  const MeshFileHeader* header = (const MeshFileHeader*)&file[0];
+
+  ofstream out(argv[2], ios_base::out | ios_base::binary | ios_base::trunc);
+  if (!out.write((const char*)&file[0], file.size()))
+  {
+    fprintf(stderr, "Unable to write \"%s\"\n", argv[2]);
+    return 1;
+  }
+
+  printf("Converted \"%s\" into \"%s\": %u vertices, %u triangles, %u submeshes (%u bytes)\n", argv[1], argv[2], header->num_vertices,
+    header->num_indices / 3, header->num_submeshes, (unsigned)file.size());
+  return 0;
+}
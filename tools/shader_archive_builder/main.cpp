@@ -0,0 +1,148 @@
+// Packs every .cso file in a directory into a shader archive that can be opened with ShaderArchive::OpenD3D12.
+//
+// usage: shader_archive_builder <input directory> <output archive>
+//
+// Only standard C++ is used outside of the directory listing, so the tool can also be run as part of a non-Windows
+// content build.
+
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+#include "private_inc/ShaderArchiveFormat.h"
+using namespace std;
+
+/// <summary>
+/// Lists the .cso files in a directory
+/// </summary>
+/// <param name="dir">
+/// directory to list
+/// </param>
+/// <param name="names">
+/// receives the file names, without the directory
+/// </param>
+/// <returns>
+/// true  if the directory could be read
+/// false otherwise
+/// </returns>
+static bool ListShaders(const string& dir, vector<string>& names)
+{
+#ifdef _WIN32
+  WIN32_FIND_DATAA find_data;
+  HANDLE find = FindFirstFileA((dir + "\\*.cso").c_str(), &find_data);
+  if (find == INVALID_HANDLE_VALUE)
+  {
+    return GetLastError() == ERROR_FILE_NOT_FOUND;
+  }
+  do
+  {
+    if ((find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+    {
+      names.push_back(find_data.cFileName);
+    }
+  } while (FindNextFileA(find, &find_data));
+  FindClose(find);
+#else
+  DIR* d = opendir(dir.c_str());
+  if (d == NULL)
+  {
+    return false;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(d)) != NULL)
+  {
+    size_t len = strlen(entry->d_name);
+    if (len > 4 && strcmp(entry->d_name + len - 4, ".cso") == 0)
+    {
+      names.push_back(entry->d_name);
+    }
+  }
+  closedir(d);
+#endif
+  return true;
+}
+
+/// <summary>
+/// Reads an entire file into memory
+/// </summary>
+/// <param name="path">
+/// path to the file
+/// </param>
+/// <param name="data">
+/// receives the contents of the file
+/// </param>
+/// <returns>
+/// true  if the file was read
+/// false otherwise
+/// </returns>
+static bool LoadFile(const string& path, vector<uint8_t>& data)
+{
+  ifstream in(path.c_str(), ios_base::in | ios_base::binary);
+  if (!in.good())
+  {
+    return false;
+  }
+
+  in.seekg(0, ios_base::end);
+  streamoff len = in.tellg();
+  if (len <= 0 || len > 0x7fffffff)
+  {
+    return false;
+  }
+  in.seekg(0, ios_base::beg);
+  data.resize((size_t)len);
+  return (bool)in.read((char*)&data[0], len);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc != 3)
+  {
+    fprintf(stderr, "usage: %s <input directory> <output archive>\n", argv[0]);
+    return 1;
+  }
+
+  const string dir = argv[1];
+  vector<string> names;
+  if (!ListShaders(dir, names))
+  {
+    fprintf(stderr, "Unable to list \"%s\"\n", dir.c_str());
+    return 1;
+  }
+
+  vector<ShaderArchiveShader> shaders(names.size());
+  for (size_t i = 0; i < names.size(); i++)
+  {
+    ShaderArchiveShader& shader = shaders[i];
+    shader.name = names[i];
+    if (!LoadFile(dir + "/" + shader.name, shader.bytecode))
+    {
+      fprintf(stderr, "Unable to read \"%s\"\n", shader.name.c_str());
+      return 1;
+    }
+  }
+
+  vector<uint8_t> archive;
+  const char* error = ShaderArchiveFormat::Pack(shaders, archive);
+  if (error != NULL)
+  {
+    fprintf(stderr, "Archive %s\n", error);
+    return 1;
+  }
+
+  ofstream out(argv[2], ios_base::out | ios_base::binary | ios_base::trunc);
+  if (!out.write((const char*)&archive[0], archive.size()))
+  {
+    fprintf(stderr, "Unable to write \"%s\"\n", argv[2]);
+    return 1;
+  }
+
+  printf("Packed %u shaders into \"%s\" (%u bytes)\n", (unsigned)shaders.size(), argv[2], (unsigned)archive.size());
+  return 0;
+}